@@ -5,43 +5,232 @@
 // #include "peripheral/gpio.h" // FOR TESTING < REMOVE
 
 void* HEAP_START = (void*)0x0;
+void* HEAP_DTCM_START = (void*)0x0;
+void* HEAP_AXI_START = (void*)0x0;
 
 struct block_t{
     struct block_t* next_block;
 };
 
+/**
+ * Internal lookup tables, generated from ALLOC_REGIONS and the pool tables at compile time.
+ *
+ * Pools are numbered across all regions (see ALLOC_TOTAL_POOLS).  pool_offsets[i] is the byte offset
+ * of pool i from its region's start, and pool_first_index[i] is the number of blocks in all pools
+ * before pool i, i.e. where its blocks start in is_free.  Together they turn the block -> pool and
+ * block -> index mappings into a couple of compares and a divide instead of a walk over every block.
+ */
+#define REGION_START_ENTRY(region, start, capacity) &(start),
+#define REGION_SIZE_ENTRY(region, start, capacity) (uint32_t)sizeof(struct alloc_##region##_layout_t),
+#define REGION_FIRST_POOL_ENTRY(region, start, capacity) ALLOC_##region##_FIRST_POOL,
+#define REGION_POOL_MASK_ENTRY(region, start, capacity) \
+    (uint32_t)(((1ull << ALLOC_##region##_END_POOL) - 1) & ~((1ull << ALLOC_##region##_FIRST_POOL) - 1)),
+#define REGION_SIZE_CLASS_ENTRY(region, start, capacity) ALLOC_SIZE_CLASS_##region,
+#define REGION_MAX_BLOCK_ENTRY(region, start, capacity) (uint32_t)ALLOC_##region##_ORDER_END - 1,
+static void* const* const region_start[ALLOC_REGION_COUNT] = { ALLOC_REGIONS(REGION_START_ENTRY) };
+static const uint32_t region_size[ALLOC_REGION_COUNT] = { ALLOC_REGIONS(REGION_SIZE_ENTRY) };
+static const uint8_t region_first_pool[ALLOC_REGION_COUNT + 1] = { ALLOC_REGIONS(REGION_FIRST_POOL_ENTRY) ALLOC_TOTAL_POOLS };
+static const uint32_t region_pool_mask[ALLOC_REGION_COUNT] = { ALLOC_REGIONS(REGION_POOL_MASK_ENTRY) };
+static const uint8_t* const region_size_class[ALLOC_REGION_COUNT] = { ALLOC_REGIONS(REGION_SIZE_CLASS_ENTRY) };
+static const uint32_t region_max_block[ALLOC_REGION_COUNT] = { ALLOC_REGIONS(REGION_MAX_BLOCK_ENTRY) };
+#undef REGION_START_ENTRY
+#undef REGION_SIZE_ENTRY
+#undef REGION_FIRST_POOL_ENTRY
+#undef REGION_POOL_MASK_ENTRY
+#undef REGION_SIZE_CLASS_ENTRY
+#undef REGION_MAX_BLOCK_ENTRY
+
+#define POOL_SIZE_ENTRY(region, size, count) (size),
+#define POOL_COUNT_ENTRY(region, size, count) (count),
+#define POOL_REGION_ENTRY(region, size, count) ALLOC_REGION_##region,
+#define POOL_OFFSET_ENTRY(region, size, count) offsetof(struct alloc_##region##_layout_t, pool_##size),
+#define POOL_FIRST_INDEX_ENTRY(region, size, count) offsetof(struct alloc_block_layout_t, region.pool_##size),
+#define REGION_POOLS(region, start, capacity) ALLOC_POOLS_##region(POOL_ENTRY)
+#define POOL_ENTRY POOL_SIZE_ENTRY
+static const uint32_t pool_block_size[ALLOC_TOTAL_POOLS] = { ALLOC_REGIONS(REGION_POOLS) };
+#undef POOL_ENTRY
+#define POOL_ENTRY POOL_COUNT_ENTRY
+static const uint32_t pool_count[ALLOC_TOTAL_POOLS] = { ALLOC_REGIONS(REGION_POOLS) };
+#undef POOL_ENTRY
+#define POOL_ENTRY POOL_REGION_ENTRY
+static const uint8_t pool_region[ALLOC_TOTAL_POOLS] = { ALLOC_REGIONS(REGION_POOLS) };
+#undef POOL_ENTRY
+#define POOL_ENTRY POOL_OFFSET_ENTRY
+static const uint32_t pool_offsets[ALLOC_TOTAL_POOLS] = { ALLOC_REGIONS(REGION_POOLS) };
+#undef POOL_ENTRY
+#define POOL_ENTRY POOL_FIRST_INDEX_ENTRY
+static const uint32_t pool_first_index[ALLOC_TOTAL_POOLS] = { ALLOC_REGIONS(REGION_POOLS) };
+#undef POOL_ENTRY
+#undef REGION_POOLS
+#undef POOL_SIZE_ENTRY
+#undef POOL_COUNT_ENTRY
+#undef POOL_REGION_ENTRY
+#undef POOL_OFFSET_ENTRY
+#undef POOL_FIRST_INDEX_ENTRY
+
+// get_pool() and get_index() of a pointer outside every pool
+#define POOL_NONE UINT32_MAX
+#define INDEX_NONE UINT32_MAX
+
+// Private hint used by alloc_dma(): AXI only, since no other region's blocks are line aligned
+#define HINT_DMA_ALIGNED (ALLOC_HINT_DMA + 1)
+
+/**
+ * Regions tried by each alloc_hint_t, in order (ALLOC_REGION_COUNT ends the list early)
+ */
+static const uint8_t hint_regions[][2] = {
+    [ALLOC_HINT_DEFAULT] = { ALLOC_REGION_SRAM123, ALLOC_REGION_COUNT },
+    [ALLOC_HINT_FAST] = { ALLOC_REGION_DTCM, ALLOC_REGION_SRAM123 },
+    [ALLOC_HINT_DMA] = { ALLOC_REGION_AXI, ALLOC_REGION_SRAM123 },
+    [HINT_DMA_ALIGNED] = { ALLOC_REGION_AXI, ALLOC_REGION_COUNT },
+};
+
+/**
+ * Hint alloc_resize() moves a block of each region with, so it stays where it was placed
+ */
+static const uint8_t region_resize_hint[ALLOC_REGION_COUNT] = {
+    [ALLOC_REGION_SRAM123] = ALLOC_HINT_DEFAULT,
+    [ALLOC_REGION_DTCM] = ALLOC_HINT_FAST,
+    [ALLOC_REGION_AXI] = HINT_DMA_ALIGNED, // may be an alloc_dma() block, keep it line aligned
+};
+
 
 static uint8_t is_free[IS_FREE_SIZE];
-static struct block_t* pool_heads[NUMBER_OF_POOLS];
 
+/**
+ * Tagged free-list heads, one per pool.
+ *
+ * The low 16 bits hold the slot of the first free block (block number within the pool + 1, so 0
+ * means the pool is empty) and the high 16 bits hold a tag that is bumped on every update.  Packing
+ * both into one word lets a single 32 bit compare-and-swap (LDREX/STREX on the M7) update the head,
+ * and the tag makes the swap fail if the head was popped and pushed back in between (ABA).
+ */
+static uint32_t pool_heads[ALLOC_TOTAL_POOLS];
+
+#define HEAD_SLOT_MASK 0xFFFFu
+#define HEAD_TAG_INC 0x10000u
 
 /**
- * Internal function.  Builds the linked-list associated with each pool
- * @param curr initial head of the pool
- * @param pool_size size of blocks in this pool
- * @param pool_count number of blocks in this pool
- * @param i zero :)
- * @return
+ * Number of blocks of each pool that have ever been handed out.  Blocks past this have never been
+ * used and are not on any list: a pool first hands them out in address order (a bump pointer) and
+ * only then recycles freed blocks from its list, so init_heap() never has to touch the blocks.
+ */
+static uint32_t pool_bump[ALLOC_TOTAL_POOLS];
+
+/**
+ * Bit i is set while pool i has free blocks, so alloc() can find the next non-empty pool with one
+ * count-trailing-zeros.
+ *
+ * It is a hint kept up to date by take_from_pool()/push_block() on the empty <-> non-empty
+ * transitions.
+ * A bit may briefly be set for an empty pool (alloc() then just tries the next one), but is never
+ * left clear for a non-empty pool once the push that filled it has returned.
  */
-struct block_t* build_pool(void* curr, uint32_t pool_size, uint32_t pool_count, uint32_t i)
-{
-    struct block_t* s = (struct block_t*)curr;
+static uint32_t pool_nonempty;
 
-    if(i >= pool_count - 1){
-        struct block_t n = {(void*)0}; // null terminator
-        *s = n;
-        return s;
+#ifdef ALLOC_STATS
+static struct alloc_pool_stats_t pool_stats[ALLOC_TOTAL_POOLS];
+
+#define STAT_ADD(i, field, n) __atomic_fetch_add(&pool_stats[(i)].field, (n), __ATOMIC_RELAXED)
+
+/**
+ * Internal function.  Counts a block of pool i handed out for a request of size bytes whose ideal
+ * pool was ideal
+ */
+static void stat_alloc(uint32_t ideal, uint32_t i, uint32_t size){
+    if(i != ideal){
+        STAT_ADD(ideal, fallbacks, 1);
     }
+    STAT_ADD(i, allocs, 1);
+    STAT_ADD(i, requested_bytes, size);
+    STAT_ADD(i, wasted_bytes, pool_block_size[i] - size);
+
+    uint32_t used = STAT_ADD(i, in_use, 1) + 1;
+    uint32_t peak = __atomic_load_n(&pool_stats[i].peak, __ATOMIC_RELAXED);
+    while(used > peak && !__atomic_compare_exchange_n(&pool_stats[i].peak, &peak, used, true,
+                                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
 
-    struct block_t t = (struct block_t)
-    {
-        build_pool((uint8_t*)curr + pool_size, pool_size, pool_count, i + 1)
+#define STAT_ALLOC(ideal, i, size) stat_alloc((ideal), (i), (size))
+#define STAT_FAILED(ideal) STAT_ADD((ideal), failed, 1)
+#define STAT_FREE(i) __atomic_fetch_sub(&pool_stats[(i)].in_use, 1, __ATOMIC_RELAXED)
+#else
+#define STAT_ALLOC(ideal, i, size) ((void)(ideal), (void)(size))
+#define STAT_FAILED(ideal) ((void)(ideal))
+#define STAT_FREE(i) ((void)0)
+#endif
+
+#ifdef ALLOC_TRACE
+struct alloc_trace_t alloc_trace;
+
+/**
+ * Internal function.
+ *
+ * Appends one entry to the trace ring.  Addresses are truncated to 32 bits (only matters on the host).
+ */
+static void trace_record(uint32_t op, uint32_t hint, uint32_t size, uint32_t pool, void* addr, uint32_t caller){
+    uint32_t n = __atomic_fetch_add(&alloc_trace.count, 1, __ATOMIC_RELAXED);
+    alloc_trace.entries[n & (ALLOC_TRACE_DEPTH - 1)] = (struct alloc_trace_entry_t){
+        .time = alloc_trace_clock(),
+        .caller = caller,
+        .addr = (uint32_t)(uintptr_t)addr,
+        .size = size > 0xFFFF ? 0xFFFF : (uint16_t)size,
+        .op = op,
+        .hint = hint,
+        .pool = (uint8_t)pool,
     };
-    *s = t;
+}
+
+// return address of the current function, i.e. the code that called into the allocator
+#define TRACE_CALLER() ((uint32_t)(uintptr_t)__builtin_extract_return_addr(__builtin_return_address(0)))
+#define TRACE(op, hint, size, pool, addr, caller) trace_record((op), (hint), (size), (pool), (addr), (caller))
+#else
+#define TRACE_CALLER() 0u
+#define TRACE(op, hint, size, pool, addr, caller) ((void)(caller))
+#endif
+
+
+/**
+ * Internal function
+ *
+ * Gets the index of the pool that a given block of memory is in.
+ * For example, if you passed in HEAP_START as block, this function would return
+ * 0; since the block at HEAP_START is always in the first pool
+ *
+ * Runs in constant time: one range check per region, then the pool is the number of pool boundaries
+ * in the region at or below the block's offset, so there is no data dependent loop.
+ */
+uint32_t get_pool(void* block){
+
+    for(uint32_t r = 0; r < ALLOC_REGION_COUNT; r++){
+        uint8_t* start = (uint8_t*)*region_start[r];
+
+        // start + region_size[r] is 1 out of range, so anything at or past it is not in this region
+        if(start == (void*)0 || (uint8_t*)block < start || (uint8_t*)block >= start + region_size[r]){
+            continue;
+        }
+
+        uint32_t offset = (uint32_t)((uint8_t*)block - start);
 
-    return s;
+        uint32_t i = region_first_pool[r];
+        for(uint32_t j = region_first_pool[r] + 1; j < region_first_pool[r + 1]; j++){
+            i += offset >= pool_offsets[j];
+        }
+
+        return i;
+    }
+
+    return POOL_NONE; // out of range
 }
 
+/**
+ * Internal function.
+ *
+ * Address of the first block of pool i
+ */
+static inline uint8_t* pool_base(uint32_t i){
+    return (uint8_t*)*region_start[pool_region[i]] + pool_offsets[i];
+}
 
 /**
  * Internal function.
@@ -49,105 +238,274 @@ struct block_t* build_pool(void* curr, uint32_t pool_size, uint32_t pool_count,
  * Gets the number of blocks before the given block (its index in is_free)
  */
 uint32_t get_index(void* block){
-    /**
-     * This function really annoyed me.  Basically we need the amount of total blocks before this pointer
-     * (which is its index ofc), but I can not think of a way to do this in constant time.  Maybe some sort
-     * of hash function would do.  For now I am writing this in linear time to just work for testing,
-     * and maybe sometime in the future we can optimize it (I can think of a way to get it to logorithmic time).
-     * Reguardless, I feel like it should be possible in constant time so if you're reading this and are
-     * bored then I would be forever grateful if you could make this fast.
-     */
 
-     // updated condition to >= because:
-     // HEAP_START + TOTAL_HEAP_SIZE will be 1 out of range, so if block equals that, that's 1 OOB
-    if((uint8_t*)block < (uint8_t*)HEAP_START || (uint8_t*)block >= ((uint8_t*)HEAP_START) + TOTAL_HEAP_SIZE){ // out of range
-        return -1;
+    uint32_t i = get_pool(block);
+    if(i == POOL_NONE){
+        return INDEX_NONE;
     }
 
-    uint8_t* blk = (uint8_t*) block;
+    return pool_first_index[i] + (uint32_t)((uint8_t*)block - pool_base(i)) / pool_block_size[i];
+}
+/**
+ * Internal function.
+ *
+ * Converts between a block and its slot in pool i (block number + 1, 0 for NULL).
+ */
+static inline struct block_t* slot_to_block(uint32_t i, uint32_t slot){
+    if(slot == 0){
+        return (void*)0;
+    }
+    return (struct block_t*)(pool_base(i) + (slot - 1) * pool_block_size[i]);
+}
 
-    uint32_t i = 0;
-    uint32_t pool_left = POOL_SIZES[i];
+static inline uint32_t block_to_slot(uint32_t i, struct block_t* block){
+    if(block == (void*)0){
+        return 0;
+    }
+    return (uint32_t)((uint8_t*)block - pool_base(i)) / pool_block_size[i] + 1;
+}
 
-    uint32_t index = -1;
+/**
+ * Internal function.
+ *
+ * Lock-free pop from the free list of pool i.  Safe against concurrent pops/pushes from threads and
+ * interrupt handlers; interrupts are never disabled.
+ *
+ * @param list_empty set if the list is empty after the call (also when nothing was popped)
+ * @return the block, or NULL if the list is empty
+ */
+static struct block_t* pop_block(uint32_t i, bool* list_empty){
+    uint32_t old_head = __atomic_load_n(&pool_heads[i], __ATOMIC_ACQUIRE);
+    struct block_t* block;
+    uint32_t new_head;
 
-    while(blk >= (uint8_t*)HEAP_START){
-        if(pool_left <= 0){
-            pool_left = POOL_SIZES[++i];
+    do {
+        block = slot_to_block(i, old_head & HEAD_SLOT_MASK);
+        if(block == (void*)0){
+            *list_empty = true;
+            return (void*)0;
         }
+        // if another context takes this block first, next may be garbage, but then the tag has
+        // moved on and the swap below fails
+        struct block_t* next = __atomic_load_n(&block->next_block, __ATOMIC_RELAXED);
+        new_head = ((old_head + HEAD_TAG_INC) & ~HEAD_SLOT_MASK) | block_to_slot(i, next);
+    } while(!__atomic_compare_exchange_n(&pool_heads[i], &old_head, new_head, true,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
 
-        blk -= POOL_BLOCK_SIZES[i];
-        pool_left -= 1;
-        index++;
-    }
+    *list_empty = (new_head & HEAD_SLOT_MASK) == 0;
+    return block;
+}
 
-    return index;
+/**
+ * Internal function.
+ *
+ * Lock-free take of the next never-used block of pool i.
+ *
+ * @return the block, or NULL once every block of the pool has been handed out at least once
+ */
+static struct block_t* bump_block(uint32_t i){
+    uint32_t used = __atomic_load_n(&pool_bump[i], __ATOMIC_RELAXED);
+
+    do {
+        if(used >= pool_count[i]){
+            return (void*)0;
+        }
+    } while(!__atomic_compare_exchange_n(&pool_bump[i], &used, used + 1, true,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return slot_to_block(i, used + 1);
 }
 
 /**
- * Internal function
+ * Internal function.
  *
- * Gets the index of the pool that a given block of memory is in.
- * For example, if you passed in HEAP_START as block, this function would return
- * 0; since the block at HEAP_START is always in the first pool
+ * Takes a free block from pool i, recycled blocks first, then never-used ones, and clears the pool's
+ * pool_nonempty bit if that was the last one.
  *
+ * @return the block, or NULL if the pool is empty
  */
-uint32_t get_pool(void* block){
+static struct block_t* take_from_pool(uint32_t i){
+    bool list_empty;
+    struct block_t* block = pop_block(i, &list_empty);
+    if(block == (void*)0){
+        block = bump_block(i);
+    }
 
-    if((uint8_t*)block < (uint8_t*)HEAP_START || (uint8_t*)block > ((uint8_t*)HEAP_START) + TOTAL_HEAP_SIZE){ // out of range
-        return -1;
+    // pool_bump only grows, so once it is exhausted only a push can refill the pool.  A push may
+    // have landed since we looked at the list, so look again after clearing, it will either see
+    // our clear or we see its block
+    if(list_empty && __atomic_load_n(&pool_bump[i], __ATOMIC_RELAXED) >= pool_count[i]){
+        __atomic_fetch_and(&pool_nonempty, ~((uint32_t)1 << i), __ATOMIC_SEQ_CST);
+        if((__atomic_load_n(&pool_heads[i], __ATOMIC_SEQ_CST) & HEAD_SLOT_MASK) != 0){
+            __atomic_fetch_or(&pool_nonempty, (uint32_t)1 << i, __ATOMIC_RELAXED);
+        }
+    }
+
+    return block;
+}
+
+/**
+ * Internal function.
+ *
+ * Lock-free push of the chain first -> ... -> last (already linked through next_block) onto the
+ * free list of pool i, with a single compare-and-swap however long the chain is.
+ */
+static void push_chain(uint32_t i, struct block_t* first, struct block_t* last){
+    uint32_t old_head = __atomic_load_n(&pool_heads[i], __ATOMIC_RELAXED);
+    uint32_t new_head;
+
+    do {
+        __atomic_store_n(&last->next_block, slot_to_block(i, old_head & HEAD_SLOT_MASK), __ATOMIC_RELAXED);
+        new_head = ((old_head + HEAD_TAG_INC) & ~HEAD_SLOT_MASK) | block_to_slot(i, first);
+    } while(!__atomic_compare_exchange_n(&pool_heads[i], &old_head, new_head, true,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+
+    if((old_head & HEAD_SLOT_MASK) == 0){
+        __atomic_fetch_or(&pool_nonempty, (uint32_t)1 << i, __ATOMIC_RELEASE); // empty -> non-empty
     }
+}
 
-    uint8_t* blk = (uint8_t*) block;
+/**
+ * Internal function.
+ *
+ * Lock-free push of block onto the free list of pool i.
+ */
+static void push_block(uint32_t i, struct block_t* block){
+    push_chain(i, block, block);
+}
 
-    uint32_t i = 0;
-    uint32_t pool_left = POOL_SIZES[i];
+/**
+ * Internal function.
+ *
+ * Set/clear the is_free bit of a block in the heap.
+ */
+static void mark_used(void* block){
+    uint32_t index = get_index(block);
+    __atomic_fetch_and(&is_free[index / 8], (uint8_t)~((uint8_t)1 << (index % 8)), __ATOMIC_RELAXED);
+}
 
-    while(blk >= (uint8_t*)HEAP_START){
-        if(pool_left <= 0){
-            pool_left = POOL_SIZES[++i];
+/**
+ * @return false if the block was already marked free, from the same atomic or, so two contexts
+ * freeing one block can't both get true
+ */
+static bool mark_free(void* block){
+    uint32_t index = get_index(block);
+    uint8_t bit = (uint8_t)1 << (index % 8);
+    return (__atomic_fetch_or(&is_free[index / 8], bit, __ATOMIC_RELAXED) & bit) == 0;
+}
+
+static inline bool index_is_free(uint32_t index){
+    return (__atomic_load_n(&is_free[index / 8], __ATOMIC_RELAXED) & (1 << (index % 8))) != 0;
+}
+
+__attribute__((weak)) void alloc_fault_handler(enum alloc_fault_t fault, void* block){
+    (void)fault;
+    (void)block;
+#ifdef __arm__
+    asm volatile("BKPT #0");
+#endif
+}
+
+#ifdef ALLOC_DEBUG
+#define GUARD_WORD 0xA110C8EDu
+#define DEBUG_FAULT(fault, block) alloc_fault_handler((fault), (block))
+
+/**
+ * Internal function.
+ *
+ * The guard words in the last ALLOC_GUARD_SIZE bytes of a block of pool i
+ */
+static inline uint32_t* guard_of(void* block, uint32_t i){
+    return (uint32_t*)((uint8_t*)block + pool_block_size[i] - ALLOC_GUARD_SIZE);
+}
+
+static void guard_arm(void* block, uint32_t i){
+    uint32_t* guard = guard_of(block, i);
+    for(uint32_t k = 0; k < ALLOC_GUARD_SIZE / sizeof(uint32_t); k++){
+        guard[k] = GUARD_WORD;
+    }
+}
+
+static bool guard_intact(void* block, uint32_t i){
+    uint32_t* guard = guard_of(block, i);
+    for(uint32_t k = 0; k < ALLOC_GUARD_SIZE / sizeof(uint32_t); k++){
+        if(guard[k] != GUARD_WORD){
+            return false;
         }
-        blk -= POOL_BLOCK_SIZES[i];
-        pool_left -= 1;
     }
+    return true;
+}
 
-    return i;
+/**
+ * Internal function.
+ *
+ * Checks a pointer about to be freed into pool i.
+ *
+ * @return false if it must not be freed (it is not the start of a block)
+ */
+static bool check_free(void* mem, uint32_t i){
+    if((uint32_t)((uint8_t*)mem - pool_base(i)) % pool_block_size[i] != 0){
+        DEBUG_FAULT(ALLOC_FAULT_MISALIGNED, mem);
+        return false;
+    }
+    if(!guard_intact(mem, i)){
+        DEBUG_FAULT(ALLOC_FAULT_GUARD, mem); // the block is still ours, free it anyway
+    }
+    return true;
 }
 
+#define GUARD_ARM(block, i) guard_arm((block), (i))
+#else
+#define DEBUG_FAULT(fault, block) ((void)(block))
+#define GUARD_ARM(block, i) ((void)0)
+#endif
+
 
 
 /**
- * Usage: Check for success or failure when used to make sure it was
- * configured correctly
+ * Usage: Check for success or failure when used to make sure HEAP_START (and the other
+ * region starts) were set up correctly.  The pool tables themselves are checked at compile time.
  *
  * @return 1 for success, -1 for failure
  */
 
 uint32_t init_heap() {
 
-    uint32_t s = 0;
-    for(int i = 0; i < NUMBER_OF_POOLS; i++){
-        s += POOL_BLOCK_SIZES[i] * POOL_SIZES[i];
+    for(uint32_t r = 0; r < ALLOC_REGION_COUNT; r++){
+        if(((uintptr_t)*region_start[r] % ALLOC_ALIGN) != 0){
+            return -1; // blocks hold pointers that are updated atomically, they must be aligned
+        }
+    }
+    if(((uintptr_t)HEAP_AXI_START % ALLOC_DMA_ALIGN) != 0){
+        return -1; // alloc_dma() blocks must start on a cache line
     }
 
-    if (s != TOTAL_HEAP_SIZE) {
-        return -1; // sum(pool_sizes * pool_counts) != tota_pool_size, configuration error
+    // O(pools): every list starts empty and every block is handed out by the bump pointer first, so
+    // the blocks themselves are not touched here.  Pools of regions without a start stay empty
+    uint32_t nonempty = 0;
+    for(uint32_t i = 0; i < ALLOC_TOTAL_POOLS; i++){
+        pool_heads[i] = 0;
+        pool_bump[i] = 0;
+        if(pool_count[i] > 0 && *region_start[pool_region[i]] != (void*)0){
+            nonempty |= (uint32_t)1 << i;
+        }
     }
 
-    void* start = HEAP_START;
-    for(int i = 0; i < NUMBER_OF_POOLS; i++){
-        // build linked list for each pool
-        pool_heads[i] = build_pool(
-            start,
-            POOL_BLOCK_SIZES[i],
-            POOL_SIZES[i],
-            0
-            );
+    pool_nonempty = nonempty;
 
-        start += POOL_BLOCK_SIZES[i] * POOL_SIZES[i]; // block size (bytes) * amount of blocks
+#ifdef ALLOC_STATS
+    for(uint32_t i = 0; i < ALLOC_TOTAL_POOLS; i++){
+        pool_stats[i] = (struct alloc_pool_stats_t){0};
     }
+#endif
+#ifdef ALLOC_TRACE
+    alloc_trace.magic = ALLOC_TRACE_MAGIC;
+    alloc_trace.depth = ALLOC_TRACE_DEPTH;
+    alloc_trace.entry_size = sizeof(struct alloc_trace_entry_t);
+    alloc_trace.count = 0;
+#endif
 
-    for(int i = 0; i < IS_FREE_SIZE; i++){
+    for(uint32_t i = 0; i < IS_FREE_SIZE; i++){
         is_free[i] = 255;
     }
 
@@ -155,70 +513,254 @@ uint32_t init_heap() {
 }
 
 /**
+ * Internal function.
  *
- * @param size
- * @return
+ * Takes a block for a request of size bytes off the free lists of region r and marks it in use,
+ * without touching its contents.  The pool it came from is stored in *pool.
+ *
+ * @param ideal the smallest pool of region r that fits size
+ * @return the block, or NULL if every pool of the region that fits it is empty
  */
-void* alloc(uint32_t size) {
-    if (size == 0 || size > POOL_BLOCK_SIZES[NUMBER_OF_POOLS - 1]) {
+static struct block_t* take_from_region(uint32_t r, uint32_t ideal, uint32_t* pool) {
+    // if the pool for ideal i is already full, take the smallest non-empty pool above it.  Normally
+    // one pass, it only loops if another context empties the chosen pool first
+    uint32_t candidates = __atomic_load_n(&pool_nonempty, __ATOMIC_ACQUIRE) & (~(uint32_t)0 << ideal) & region_pool_mask[r];
+    while(candidates != 0){
+        uint32_t i = (uint32_t)__builtin_ctz(candidates);
+        struct block_t* block = take_from_pool(i);
+        if(block != (void*)0){
+            mark_used(block);
+            *pool = i;
+            return block;
+        }
+        candidates &= candidates - 1; // drop pool i
+    }
+
+    return (void*)0;
+}
+
+/**
+ * Internal function.
+ *
+ * Takes a block for a request of size bytes from the regions listed for hint, in order, and marks
+ * it in use without touching its contents.  The pool it came from is stored in *pool.
+ *
+ * @param caller code address the request is traced against (TRACE_CALLER() of the public function)
+ * @return the block, or NULL if hint is unknown, size is 0 or too large, or every pool that fits it is empty
+ */
+static struct block_t* take_block(uint32_t hint, uint32_t size, uint32_t* pool, uint32_t caller) {
+    if (hint > HINT_DMA_ALIGNED || size == 0 || size > UINT32_MAX - ALLOC_GUARD_SIZE) {
+        TRACE(ALLOC_TRACE_ALLOC, hint, size, 0xFF, (void*)0, caller);
         return (void*)(0);
     }
-    // find ideal i
-    uint32_t i = 0;
-    // i < NUMBER_OF_POOLS comes first so that it can terminate condition early
-    for(; i < NUMBER_OF_POOLS && size > POOL_BLOCK_SIZES[i]; i++);
-    if (i >= NUMBER_OF_POOLS) return (void*)(0);
-    // if the pool for ideal i is already full (null head), keep going to next block until we find a free one
-    struct block_t* block = pool_heads[i];
-    while(block == ((void*)0) && i < NUMBER_OF_POOLS-1){ // subtracting 1 here because of ++i
-        block = pool_heads[++i];
+    uint32_t requested = size;
+    size += ALLOC_GUARD_SIZE;
+
+    uint32_t charged = ALLOC_TOTAL_POOLS; // pool a failure or fallback is counted against
+    for(uint32_t k = 0; k < sizeof(hint_regions[0]); k++){
+        uint32_t r = hint_regions[hint][k];
+        if(r >= ALLOC_REGION_COUNT){
+            break;
+        }
+        if(*region_start[r] == (void*)0 || region_first_pool[r] == region_first_pool[r + 1]){
+            continue; // region not in use
+        }
+
+        if(size > region_max_block[r]){ // bigger than the region's largest block
+            if(charged == ALLOC_TOTAL_POOLS){
+                charged = region_first_pool[r + 1] - 1;
+            }
+            continue;
+        }
+
+        // find ideal i
+        uint32_t ideal = region_first_pool[r] + region_size_class[r][(size + ALLOC_ALIGN - 1) / ALLOC_ALIGN];
+        if(charged == ALLOC_TOTAL_POOLS){
+            charged = ideal;
+        }
+
+        struct block_t* block = take_from_region(r, ideal, pool);
+        if(block != (void*)0){
+            STAT_ALLOC(charged, *pool, requested);
+            GUARD_ARM(block, *pool);
+            TRACE(ALLOC_TRACE_ALLOC, hint, requested, *pool, block, caller);
+            return block;
+        }
     }
 
-    if(block == ((void*)0)){
-        return ((void*)0); // no space for a new block of this size
+    if(charged != ALLOC_TOTAL_POOLS){
+        STAT_FAILED(charged);
     }
+    TRACE(ALLOC_TRACE_ALLOC, hint, requested, 0xFF, (void*)0, caller);
+    return ((void*)0); // no space for a new block of this size
+}
 
-    // update free blocks
-    uint32_t index = get_index(block);
-    uint32_t big_index = index / 8;
-    uint32_t small_index = index % 8;
+_Static_assert(ALLOC_ALIGN % sizeof(uint64_t) == 0, "zero_block() stores whole double words");
 
-    // update linked list
-    pool_heads[i] = block->next_block;
+/**
+ * Internal function.
+ *
+ * Zeroes size bytes at block with double-word stores (STRD on the M7).  Blocks are ALLOC_ALIGN
+ * aligned and a multiple of ALLOC_ALIGN long, so there is no head or tail to handle.
+ *
+ * The build passes -fno-tree-loop-distribute-patterns so GCC keeps this a loop instead of turning
+ * it into a call to memset, which we don't link.
+ */
+static inline void zero_block(void* block, uint32_t size){
+    uint64_t* word = (uint64_t*)block;
+    uint64_t* end = (uint64_t*)((uint8_t*)block + size);
+    while(word < end){
+        *word++ = 0;
+    }
+}
 
-    is_free[big_index] &= ~((uint8_t)1 << small_index);
+/**
+ * Internal function.
+ *
+ * alloc_hint() on behalf of caller (see take_block())
+ */
+static void* alloc_zeroed(uint32_t size, uint32_t hint, uint32_t caller) {
+    uint32_t i;
+    struct block_t* block = take_block(hint, size, &i, caller);
 
-    for(int j = 0; j < POOL_BLOCK_SIZES[i]; j++){ // zero this block before returning
-        *(((uint8_t*)block) + j) = 0; // changed this to j? not sure why this was i before.
+    if(block != (void*)0){
+        zero_block(block, pool_block_size[i] - ALLOC_GUARD_SIZE); // zero this block before returning
     }
 
     return block;
 }
 
+/**
+ *
+ * @param size
+ * @return
+ */
+void* alloc(uint32_t size) {
+    return alloc_zeroed(size, ALLOC_HINT_DEFAULT, TRACE_CALLER());
+}
+
+void* alloc_hint(uint32_t size, enum alloc_hint_t hint) {
+    return alloc_zeroed(size, hint, TRACE_CALLER());
+}
+
+void* alloc_uninit(uint32_t size) {
+    uint32_t i;
+    return take_block(ALLOC_HINT_DEFAULT, size, &i, TRACE_CALLER());
+}
+
+void* alloc_dma(uint32_t size) {
+    uint32_t i;
+    return take_block(HINT_DMA_ALIGNED, size, &i, TRACE_CALLER()); // not zeroed, see alloc.h
+}
+
+/**
+ * Internal function.
+ *
+ * free() on behalf of caller (see take_block())
+ */
+static void free_block(void* mem, uint32_t caller) {
+
+    if(mem == (void*)0){
+        return; // free(NULL) is a no-op
+    }
+
+    uint32_t i = get_pool(mem);
+    if(i == POOL_NONE){
+        DEBUG_FAULT(ALLOC_FAULT_BAD_POINTER, mem);
+        return; // bad call, already "free" since it's not in heap
+    }
+
+#ifdef ALLOC_DEBUG
+    if(!check_free(mem, i)){
+        return;
+    }
+#endif
+
+    // mark free before the block is visible on the free list, so a concurrent alloc() that pops it
+    // can't have its "in use" mark overwritten by us
+    if(!mark_free(mem)){
+        DEBUG_FAULT(ALLOC_FAULT_DOUBLE_FREE, mem);
+        return; // already free, pushing it again would put it on the list twice
+    }
+
+    STAT_FREE(i); // before the push, so a re-alloc of this block can't push in_use past the truth
+    TRACE(ALLOC_TRACE_FREE, 0, 0, i, mem, caller);
+
+    push_block(i, (struct block_t*)mem);
+}
+
 /**
  *
  * @param mem
  */
 void free(void* mem) {
+    free_block(mem, TRACE_CALLER());
+}
+
+uint32_t alloc_usable_size(void* mem) {
+    if(mem == (void*)0){
+        return 0;
+    }
 
     uint32_t i = get_pool(mem);
-    if(i == -1){
-        return; // bad call, already "free" since it's not in heap
+    if(i == POOL_NONE){
+        return 0;
     }
+    return pool_block_size[i] - ALLOC_GUARD_SIZE;
+}
 
-    struct block_t new_head = (struct block_t){
-        pool_heads[i]
-    };
+/**
+ * Internal function.
+ *
+ * Copies size bytes from src to dst with double-word loads/stores, like zero_block().  Both are block
+ * starts and size is a multiple of ALLOC_ALIGN.
+ */
+static inline void copy_block(void* dst, const void* src, uint32_t size){
+    uint64_t* to = (uint64_t*)dst;
+    const uint64_t* from = (const uint64_t*)src;
+    const uint64_t* end = (const uint64_t*)((const uint8_t*)src + size);
+    while(from < end){
+        *to++ = *from++;
+    }
+}
 
-    *((struct block_t*)mem) = new_head;
+void* alloc_resize(void* mem, uint32_t size) {
+    uint32_t caller = TRACE_CALLER();
+    if(mem == (void*)0){
+        return alloc_zeroed(size, ALLOC_HINT_DEFAULT, caller);
+    }
+    if(size == 0){
+        free_block(mem, caller);
+        return (void*)0;
+    }
 
-    pool_heads[i] = (struct block_t*)mem;
+    uint32_t i = get_pool(mem);
+    if(i == POOL_NONE){
+        DEBUG_FAULT(ALLOC_FAULT_BAD_POINTER, mem);
+        return (void*)0;
+    }
+#ifdef ALLOC_DEBUG
+    if((uint32_t)((uint8_t*)mem - pool_base(i)) % pool_block_size[i] != 0){
+        DEBUG_FAULT(ALLOC_FAULT_MISALIGNED, mem);
+        return (void*)0;
+    }
+#endif
 
-    uint32_t index = get_index(mem);
-    uint32_t big_index = index / 8;
-    uint32_t small_index = index % 8;
+    uint32_t usable = pool_block_size[i] - ALLOC_GUARD_SIZE;
+    if(size <= usable){
+        TRACE(ALLOC_TRACE_RESIZE, 0, size, i, mem, caller);
+        return mem; // still fits, the common case for a growing buffer
+    }
+
+    uint32_t j;
+    struct block_t* block = take_block(region_resize_hint[pool_region[i]], size, &j, caller);
+    if(block == (void*)0){
+        return (void*)0;
+    }
 
-    is_free[big_index] |= (uint8_t)1 << small_index;
+    copy_block(block, mem, usable);
+    free_block(mem, caller);
+    return block;
 }
 
 /**
@@ -230,11 +772,407 @@ bool isFree(void* mem) {
 
     uint32_t index = get_index(mem);
 
-    if(index == -1){
+    if(index == INDEX_NONE){
+        return false;
+    }
+    return index_is_free(index);
+}
+
+_Static_assert(ALLOC_CACHE_DEPTH >= 2 && ALLOC_CACHE_DEPTH <= 255, "cache counts are uint8_t, and batches are half a cache");
+
+#define CACHE_BATCH (ALLOC_CACHE_DEPTH / 2)
+
+/**
+ * Internal function.
+ *
+ * Moves up to CACHE_BATCH blocks from the shared pool i into cache.  Blocks stay marked in use
+ * while they sit in a cache.
+ */
+static void cache_refill(struct alloc_cache_t* cache, uint32_t i){
+    if((__atomic_load_n(&pool_nonempty, __ATOMIC_ACQUIRE) & ((uint32_t)1 << i)) == 0){
+        return; // empty, or its region is not in use
+    }
+    for(int k = 0; k < CACHE_BATCH; k++){
+        struct block_t* block = take_from_pool(i);
+        if(block == (void*)0){
+            return;
+        }
+        STAT_ALLOC(i, i, pool_block_size[i] - ALLOC_GUARD_SIZE);
+        GUARD_ARM(block, i);
+        mark_used(block);
+        block->next_block = cache->head[i];
+        cache->head[i] = block;
+        cache->count[i]++;
+    }
+}
+
+/**
+ * Internal function.
+ *
+ * Moves the first n blocks of cache's pool i list back to the shared pool with one push.
+ */
+static void cache_drain(struct alloc_cache_t* cache, uint32_t i, uint32_t n){
+    if(n == 0){
+        return;
+    }
+    struct block_t* first = cache->head[i];
+    struct block_t* last = first;
+    for(uint32_t k = 0; ; k++){
+        mark_free(last);
+        STAT_FREE(i);
+        if(k == n - 1){
+            break;
+        }
+        last = last->next_block;
+    }
+    cache->head[i] = last->next_block;
+    cache->count[i] -= n;
+    push_chain(i, first, last);
+}
+
+void* alloc_cached(struct alloc_cache_t* cache, uint32_t size) {
+    uint32_t i = alloc_pool_for_size(size);
+    if(size == 0 || i >= NUMBER_OF_POOLS){
+        return alloc_zeroed(size, ALLOC_HINT_DEFAULT, TRACE_CALLER()); // let alloc() fail (and count the failure)
+    }
+
+    if(cache->count[i] == 0){
+        cache_refill(cache, i);
+        if(cache->count[i] == 0){
+            return alloc_zeroed(size, ALLOC_HINT_DEFAULT, TRACE_CALLER()); // pool i is empty, alloc() falls back to larger pools
+        }
+    }
+
+    struct block_t* block = cache->head[i];
+    cache->head[i] = block->next_block;
+    cache->count[i]--;
+
+    zero_block(block, pool_block_size[i] - ALLOC_GUARD_SIZE);
+    return block;
+}
+
+void free_cached(struct alloc_cache_t* cache, void* mem) {
+    if(mem == (void*)0){
+        return;
+    }
+
+    uint32_t i = get_pool(mem);
+    if(i == POOL_NONE){
+        DEBUG_FAULT(ALLOC_FAULT_BAD_POINTER, mem);
+        return; // not in heap
+    }
+
+#ifdef ALLOC_DEBUG
+    if(!check_free(mem, i)){
+        return;
+    }
+    if(isFree(mem)){
+        DEBUG_FAULT(ALLOC_FAULT_DOUBLE_FREE, mem); // blocks sitting in a cache can't be told apart
+        return;
+    }
+#endif
+
+    if(cache->count[i] >= ALLOC_CACHE_DEPTH){
+        cache_drain(cache, i, CACHE_BATCH); // keep the other half for the next allocs
+    }
+
+    struct block_t* block = (struct block_t*)mem;
+    block->next_block = cache->head[i];
+    cache->head[i] = block;
+    cache->count[i]++;
+}
+
+void alloc_cache_flush(struct alloc_cache_t* cache) {
+    for(uint32_t i = 0; i < ALLOC_TOTAL_POOLS; i++){
+        cache_drain(cache, i, cache->count[i]);
+    }
+}
+
+/**
+ * Internal function.
+ *
+ * Converts between an object of slab and its slot (object number + 1, 0 for NULL).
+ */
+static inline struct block_t* slab_slot_to_obj(struct alloc_slab_t* slab, uint32_t slot){
+    if(slot == 0){
+        return (void*)0;
+    }
+    return (struct block_t*)(slab->base + (slot - 1) * slab->stride);
+}
+
+static inline uint32_t slab_obj_to_slot(struct alloc_slab_t* slab, struct block_t* obj){
+    if(obj == (void*)0){
+        return 0;
+    }
+    return (uint32_t)((uint8_t*)obj - slab->base) / slab->stride + 1;
+}
+
+bool slab_init(struct alloc_slab_t* slab, void* buffer, uint32_t obj_size, uint32_t count) {
+    if(buffer == (void*)0 || ((uintptr_t)buffer % ALLOC_ALIGN) != 0 || obj_size == 0 || count == 0 || count >= HEAD_SLOT_MASK){
         return false;
     }
-    uint32_t big_index = index / 8;
-    uint32_t small_index = index % 8;
+    if(SLAB_STRIDE((uint64_t)obj_size) * count > UINT32_MAX){
+        return false; // the stride or the slab would wrap in 32 bits
+    }
+
+    *slab = (struct alloc_slab_t){
+        .base = (uint8_t*)buffer,
+        .stride = SLAB_STRIDE(obj_size),
+        .count = count,
+        .head = 0,
+        .bump = 0,
+    };
+    return true;
+}
+
+// descriptor of a slab_create() slab, rounded up so the objects after it stay aligned
+#define SLAB_HEADER_SIZE ((sizeof(struct alloc_slab_t) + ALLOC_ALIGN - 1) / ALLOC_ALIGN * ALLOC_ALIGN)
 
-    return (is_free[big_index] & (1 << small_index)) != 0;
-}
\ No newline at end of file
+struct alloc_slab_t* slab_create(uint32_t obj_size, uint32_t count, enum alloc_hint_t hint) {
+    if(obj_size == 0 || count == 0 || count >= HEAD_SLOT_MASK){
+        return (void*)0;
+    }
+    uint64_t size = SLAB_HEADER_SIZE + SLAB_STRIDE((uint64_t)obj_size) * count; // no 32 bit overflow
+    if(size > UINT32_MAX){
+        return (void*)0; // too large for any block
+    }
+
+    uint32_t i;
+    struct alloc_slab_t* slab = (struct alloc_slab_t*)take_block(hint, (uint32_t)size, &i, TRACE_CALLER());
+    if(slab == (void*)0){
+        return (void*)0;
+    }
+
+    slab_init(slab, (uint8_t*)slab + SLAB_HEADER_SIZE, obj_size, count);
+    return slab;
+}
+
+void* slab_alloc(struct alloc_slab_t* slab) {
+    // recycled objects first, same tagged pop as pop_block()
+    uint32_t old_head = __atomic_load_n(&slab->head, __ATOMIC_ACQUIRE);
+    struct block_t* obj;
+    uint32_t new_head;
+
+    do {
+        obj = slab_slot_to_obj(slab, old_head & HEAD_SLOT_MASK);
+        if(obj == (void*)0){
+            break;
+        }
+        struct block_t* next = __atomic_load_n(&obj->next_block, __ATOMIC_RELAXED);
+        new_head = ((old_head + HEAD_TAG_INC) & ~HEAD_SLOT_MASK) | slab_obj_to_slot(slab, next);
+    } while(!__atomic_compare_exchange_n(&slab->head, &old_head, new_head, true,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    if(obj == (void*)0){
+        // then never-used ones, same as bump_block()
+        uint32_t used = __atomic_load_n(&slab->bump, __ATOMIC_RELAXED);
+        do {
+            if(used >= slab->count){
+                return (void*)0;
+            }
+        } while(!__atomic_compare_exchange_n(&slab->bump, &used, used + 1, true,
+                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+        obj = slab_slot_to_obj(slab, used + 1);
+    }
+
+    zero_block(obj, slab->stride);
+    return obj;
+}
+
+void slab_free(struct alloc_slab_t* slab, void* obj) {
+    uint8_t* p = (uint8_t*)obj;
+    if(p < slab->base || p >= slab->base + slab->stride * slab->count || (uint32_t)(p - slab->base) % slab->stride != 0){
+        return; // NULL or not one of this slab's objects
+    }
+
+    // same tagged push as push_chain()
+    struct block_t* block = (struct block_t*)obj;
+    uint32_t old_head = __atomic_load_n(&slab->head, __ATOMIC_RELAXED);
+    uint32_t new_head;
+
+    do {
+        __atomic_store_n(&block->next_block, slab_slot_to_obj(slab, old_head & HEAD_SLOT_MASK), __ATOMIC_RELAXED);
+        new_head = ((old_head + HEAD_TAG_INC) & ~HEAD_SLOT_MASK) | slab_obj_to_slot(slab, block);
+    } while(!__atomic_compare_exchange_n(&slab->head, &old_head, new_head, true,
+                                         __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+bool arena_init(struct alloc_arena_t* arena, void* buffer, uint32_t size) {
+    if(buffer == (void*)0 || ((uintptr_t)buffer % ALLOC_ALIGN) != 0){
+        return false;
+    }
+
+    *arena = (struct alloc_arena_t){
+        .base = (uint8_t*)buffer,
+        .size = size / ALLOC_ALIGN * ALLOC_ALIGN,
+        .used = 0,
+    };
+    return true;
+}
+
+// descriptor of an arena_create() arena, rounded up so the memory after it stays aligned
+#define ARENA_HEADER_SIZE ((sizeof(struct alloc_arena_t) + ALLOC_ALIGN - 1) / ALLOC_ALIGN * ALLOC_ALIGN)
+
+struct alloc_arena_t* arena_create(uint32_t size, enum alloc_hint_t hint) {
+    if(size > UINT32_MAX - ARENA_HEADER_SIZE){
+        return (void*)0;
+    }
+
+    uint32_t i;
+    struct alloc_arena_t* arena = (struct alloc_arena_t*)take_block(hint, ARENA_HEADER_SIZE + size, &i, TRACE_CALLER());
+    if(arena == (void*)0){
+        return (void*)0;
+    }
+
+    // the arena gets the whole block, not just size bytes
+    arena_init(arena, (uint8_t*)arena + ARENA_HEADER_SIZE, pool_block_size[i] - ARENA_HEADER_SIZE - ALLOC_GUARD_SIZE);
+    return arena;
+}
+
+void* arena_alloc(struct alloc_arena_t* arena, uint32_t size) {
+    // compare against what is left rather than used + size, which could wrap.  What is left is a
+    // multiple of ALLOC_ALIGN, so size still fits once rounded up
+    if(size == 0 || size > arena->size - arena->used){
+        return (void*)0;
+    }
+
+    void* mem = arena->base + arena->used;
+    arena->used += (size + ALLOC_ALIGN - 1) / ALLOC_ALIGN * ALLOC_ALIGN;
+    return mem;
+}
+
+uint32_t arena_mark(struct alloc_arena_t* arena) {
+    return arena->used;
+}
+
+void arena_release(struct alloc_arena_t* arena, uint32_t mark) {
+    if(mark <= arena->used){
+        arena->used = mark;
+    }
+}
+
+void arena_reset(struct alloc_arena_t* arena) {
+    arena->used = 0;
+}
+
+bool alloc_get_stats(uint32_t pool, struct alloc_pool_stats_t* out) {
+    *out = (struct alloc_pool_stats_t){0};
+#ifdef ALLOC_STATS
+    if(pool >= ALLOC_TOTAL_POOLS){
+        return false;
+    }
+    out->in_use = __atomic_load_n(&pool_stats[pool].in_use, __ATOMIC_RELAXED);
+    out->peak = __atomic_load_n(&pool_stats[pool].peak, __ATOMIC_RELAXED);
+    out->allocs = __atomic_load_n(&pool_stats[pool].allocs, __ATOMIC_RELAXED);
+    out->failed = __atomic_load_n(&pool_stats[pool].failed, __ATOMIC_RELAXED);
+    out->fallbacks = __atomic_load_n(&pool_stats[pool].fallbacks, __ATOMIC_RELAXED);
+    out->requested_bytes = __atomic_load_n(&pool_stats[pool].requested_bytes, __ATOMIC_RELAXED);
+    out->wasted_bytes = __atomic_load_n(&pool_stats[pool].wasted_bytes, __ATOMIC_RELAXED);
+    return true;
+#else
+    (void)pool;
+    return false;
+#endif
+}
+
+void alloc_reset_stats() {
+#ifdef ALLOC_STATS
+    for(uint32_t i = 0; i < ALLOC_TOTAL_POOLS; i++){
+        // in_use tracks live blocks, so it is the one counter that is not reset
+        __atomic_store_n(&pool_stats[i].peak, __atomic_load_n(&pool_stats[i].in_use, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+        __atomic_store_n(&pool_stats[i].allocs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pool_stats[i].failed, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pool_stats[i].fallbacks, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pool_stats[i].requested_bytes, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pool_stats[i].wasted_bytes, 0, __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+__attribute__((weak)) uint32_t alloc_trace_clock(void){
+#ifdef __arm__
+    return *(volatile uint32_t*)0xE0001004; // DWT_CYCCNT
+#else
+    return 0;
+#endif
+}
+
+uint32_t alloc_trace_copy(struct alloc_trace_entry_t* out, uint32_t max) {
+#ifdef ALLOC_TRACE
+    uint32_t count = __atomic_load_n(&alloc_trace.count, __ATOMIC_RELAXED);
+    uint32_t n = count < ALLOC_TRACE_DEPTH ? count : ALLOC_TRACE_DEPTH;
+    if(n > max){
+        n = max;
+    }
+    for(uint32_t k = 0; k < n; k++){
+        out[k] = alloc_trace.entries[(count - n + k) & (ALLOC_TRACE_DEPTH - 1)];
+    }
+    return n;
+#else
+    (void)out;
+    (void)max;
+    return 0;
+#endif
+}
+
+void alloc_trace_clear() {
+#ifdef ALLOC_TRACE
+    __atomic_store_n(&alloc_trace.count, 0, __ATOMIC_RELAXED);
+#endif
+}
+
+enum alloc_fault_t heap_validate() {
+    for(uint32_t i = 0; i < ALLOC_TOTAL_POOLS; i++){
+        if(*region_start[pool_region[i]] == (void*)0){
+            continue; // region not in use
+        }
+
+        uint8_t* base = pool_base(i);
+        uint32_t bump = __atomic_load_n(&pool_bump[i], __ATOMIC_RELAXED);
+        if(bump > pool_count[i]){
+            alloc_fault_handler(ALLOC_FAULT_FREE_LIST, base);
+            return ALLOC_FAULT_FREE_LIST;
+        }
+
+        // every listed block is a block of pool i that was handed out and is marked free.  A list
+        // longer than the blocks handed out must have a cycle
+        uint32_t listed = 0;
+        uint32_t slot = __atomic_load_n(&pool_heads[i], __ATOMIC_RELAXED) & HEAD_SLOT_MASK;
+        struct block_t* block = slot_to_block(i, slot); // range checked below before it is read
+        while(block != (void*)0){
+            uint8_t* p = (uint8_t*)block;
+            if(p < base || p >= base + pool_block_size[i] * bump || (uint32_t)(p - base) % pool_block_size[i] != 0 ||
+               !index_is_free(pool_first_index[i] + (uint32_t)(p - base) / pool_block_size[i]) || ++listed > bump){
+                alloc_fault_handler(ALLOC_FAULT_FREE_LIST, block);
+                return ALLOC_FAULT_FREE_LIST;
+            }
+            block = block->next_block;
+        }
+
+        // and the other way around: the free marked blocks that were handed out are exactly the
+        // listed ones, and blocks never handed out are all marked free
+        uint32_t marked = 0;
+        for(uint32_t k = 0; k < pool_count[i]; k++){
+            bool free_bit = index_is_free(pool_first_index[i] + k);
+            if(k >= bump && !free_bit){
+                alloc_fault_handler(ALLOC_FAULT_FREE_LIST, base + k * pool_block_size[i]);
+                return ALLOC_FAULT_FREE_LIST;
+            }
+            if(k < bump){
+                marked += free_bit;
+#ifdef ALLOC_DEBUG
+                if(!guard_intact(base + k * pool_block_size[i], i)){
+                    alloc_fault_handler(ALLOC_FAULT_GUARD, base + k * pool_block_size[i]);
+                    return ALLOC_FAULT_GUARD;
+                }
+#endif
+            }
+        }
+        if(marked != listed){
+            alloc_fault_handler(ALLOC_FAULT_FREE_LIST, base);
+            return ALLOC_FAULT_FREE_LIST;
+        }
+    }
+
+    return ALLOC_OK;
+}
@@ -1,60 +1,623 @@
 #pragma once
 #include "stdbool.h"
+#include "stddef.h"
 #include "stdint.h"
 
-// POINTER TO START OF HEAP
+// POINTER TO START OF HEAP (SRAM1-3, the default region)
 extern void* HEAP_START;
 
+// Start of the DTCM and AXI SRAM heaps.  A region whose start is left NULL is not used
+extern void* HEAP_DTCM_START;
+extern void* HEAP_AXI_START;
+
 //----------------------------------------------------------------------------------
 // BEGIN CONFIGURATION SECTION
-// IF YOU CHANGE ANY OF THESE VALUES, IT IS HIGHLY LIKELY OTHERS WILL NEED TO CHANGE IN RESPONSE
+// THE POOL TABLES ARE THE ONLY THING TO EDIT, EVERYTHING ELSE IS DERIVED FROM THEM AT COMPILE TIME
 //----------------------------------------------------------------------------------
 
-#define NUMBER_OF_POOLS 7
-// Must have POOL_BLOCK_SIZES[n + 1] > POOL_BLOCK_SIZES[n] && POOL_BLOCK_SIZES[0] >= sizeof(void*)
-// The first rule is because of how the algorithm works
-// The second is because all blocks need to be large enough to store a pointer (8 bytes for my system)
-static uint32_t POOL_BLOCK_SIZES[NUMBER_OF_POOLS] = {16, 32, 64, 128, 256, 512, 1024}; // note these do not need to be powers of two
-static uint32_t POOL_SIZES[NUMBER_OF_POOLS] = {118, 100, 200, 100, 100, 5, 5};
+// One pool table per memory region, one X(region, block size, number of blocks) entry per pool.
+// Rules (all checked with _Static_assert below):
+//   - block sizes are strictly increasing within a region (the size class lookup relies on it)
+//   - block sizes are at least sizeof(void*), since free blocks store a pointer
+//   - block sizes are a multiple of ALLOC_ALIGN, so every block stays aligned
+//   - each table fits in its region's capacity
+// note block sizes do not need to be powers of two
+
+// SRAM1-3: general purpose, reachable by the CPU and DMA1/DMA2.  Used by alloc()
+#define ALLOC_POOLS_SRAM123(X) \
+    X(SRAM123, 16,   118) \
+    X(SRAM123, 32,   100) \
+    X(SRAM123, 64,   200) \
+    X(SRAM123, 128,  100) \
+    X(SRAM123, 256,  100) \
+    X(SRAM123, 512,  5)   \
+    X(SRAM123, 1024, 5)
+
+// DTCM: zero wait state for the CM7, but not reachable by DMA1/DMA2.  Small, latency critical data
+#define ALLOC_POOLS_DTCM(X) \
+    X(DTCM, 16,  512) \
+    X(DTCM, 32,  256) \
+    X(DTCM, 64,  256) \
+    X(DTCM, 128, 128) \
+    X(DTCM, 256, 32)
+
+// AXI SRAM: reachable by every DMA master (MDMA, DMA1, DMA2).  Sizes are whole cache lines
+#define ALLOC_POOLS_AXI(X) \
+    X(AXI, 32,   256) \
+    X(AXI, 64,   256) \
+    X(AXI, 256,  128) \
+    X(AXI, 512,  64)  \
+    X(AXI, 1024, 64)  \
+    X(AXI, 4096, 16)
+
+// Alignment of each region's start and of every block size
+#define ALLOC_ALIGN 8
 
-// POOL_BLOCK_SIZES ⋅ POOL_SIZES, it would be nice to generate this line
-// (16 * 2) + (32 * 2) + (64 * 3) + (128 * 3) = 672
-#define TOTAL_HEAP_SIZE 63968
+// Cortex-M7 D-cache line size.  The AXI region's start and its block sizes must be multiples of it,
+// so alloc_dma() blocks never share a cache line with anything else
+#define ALLOC_DMA_ALIGN 32
 
+// Bytes reserved for each region's heap, must match __HEAP_SIZE, __HEAP_DTCM_SIZE and
+// __HEAP_AXI_SIZE in internal/linker.ld
+#define ALLOC_HEAP_CAPACITY (64 * 1024)
+#define ALLOC_DTCM_CAPACITY (64 * 1024)
+#define ALLOC_AXI_CAPACITY (256 * 1024)
 
-// STEPS TO FIND IS_FREE_SIZE
-// 1: SUM POOL SIZES (number of blocks total between all pools)
-// 2: DIVIDE BY 8 (since is_free is an array of uint8_t's and each bit in the uint_8 represents if a
-// block is free).
-// 3.a: IF THIS IS AN INTEGER, THIS IS THE SIZE
-// 3.b: IF THIS IS NOT AN INTEGER, ROUND UP
+// Most blocks of each pool an alloc_cache_t holds before it gives half of them back
+#define ALLOC_CACHE_DEPTH 8
 
-// Example:
-// ceil [ sum(POOL_SIZES) / 8 ] => ceil[ (2 + 2 + 3 + 3) / 8 ] => 2
-#define IS_FREE_SIZE 79
+// Per-pool usage statistics, see alloc_get_stats().  Usually set from the build (-DALLOC_STATS)
+// rather than here.  Costs a few atomic adds per alloc()/free() when on, nothing when off
+// #define ALLOC_STATS
+
+// Heap corruption checks for soak tests, see alloc_fault_t.  Usually set from the build
+// (-DALLOC_DEBUG).  Puts a guard word in the last ALLOC_ALIGN bytes of every block (so each block
+// holds that much less, and requests are sized up accordingly) and checks each pointer given to
+// free().  Release builds only get the (free) double-free skip in free()
+// #define ALLOC_DEBUG
+
+// Allocation trace for post-mortem heap analysis, see alloc_trace_t.  Usually set from the build
+// (-DALLOC_TRACE).  Records every alloc/free into a ring of the last ALLOC_TRACE_DEPTH calls (16
+// bytes each); costs an atomic add and a few stores per call when on, nothing when off
+// #define ALLOC_TRACE
+
+// Entries in the trace ring, a power of two
+#define ALLOC_TRACE_DEPTH 256
 
 //----------------------------------------------------------------------------------
 // END CONFIGURATION SECTION
 //----------------------------------------------------------------------------------
 
 
+// The regions, X(name, start pointer, capacity).  The first one is the default region
+#define ALLOC_REGIONS(X) \
+    X(SRAM123, HEAP_START,      ALLOC_HEAP_CAPACITY) \
+    X(DTCM,    HEAP_DTCM_START, ALLOC_DTCM_CAPACITY) \
+    X(AXI,     HEAP_AXI_START,  ALLOC_AXI_CAPACITY)
+
+#define ALLOC_REGION_ENUM(region, start, capacity) ALLOC_REGION_##region,
+enum alloc_region_t {
+    ALLOC_REGIONS(ALLOC_REGION_ENUM)
+    ALLOC_REGION_COUNT
+};
+#undef ALLOC_REGION_ENUM
+
+// Pool indices, numbered across all regions in order: ALLOC_POOL_SRAM123_16 == 0, ... and the pools
+// of region R are ALLOC_R_FIRST_POOL up to (not including) ALLOC_R_END_POOL.  The *_RESET entries
+// only rewind the counter so the markers don't take up an index.
+#define ALLOC_POOL_ENUM(region, size, count) ALLOC_POOL_##region##_##size,
+#define ALLOC_REGION_POOL_ENUM(region, start, capacity) \
+    ALLOC_##region##_FIRST_POOL, ALLOC_##region##_FIRST_POOL_RESET = ALLOC_##region##_FIRST_POOL - 1, \
+    ALLOC_POOLS_##region(ALLOC_POOL_ENUM) \
+    ALLOC_##region##_END_POOL, ALLOC_##region##_END_POOL_RESET = ALLOC_##region##_END_POOL - 1,
+enum {
+    ALLOC_REGIONS(ALLOC_REGION_POOL_ENUM)
+    ALLOC_TOTAL_POOLS
+};
+#undef ALLOC_REGION_POOL_ENUM
+#undef ALLOC_POOL_ENUM
+
+// Number of pools in the default region, which come first
+#define NUMBER_OF_POOLS ((uint32_t)ALLOC_SRAM123_END_POOL)
+
+// Region layouts as structs: sizeof gives a region's size and offsetof gives each pool's offset, all
+// as integer constant expressions.  The same trick counting blocks instead of bytes gives the index
+// of each pool's first block.  Never instantiated.
+#define ALLOC_POOL_BYTES(region, size, count) uint8_t pool_##size[(size) * (count)];
+#define ALLOC_POOL_BLOCKS(region, size, count) uint8_t pool_##size[(count)];
+#define ALLOC_REGION_LAYOUT(region, start, capacity) \
+    struct alloc_##region##_layout_t { ALLOC_POOLS_##region(ALLOC_POOL_BYTES) }; \
+    struct alloc_##region##_blocks_t { ALLOC_POOLS_##region(ALLOC_POOL_BLOCKS) };
+ALLOC_REGIONS(ALLOC_REGION_LAYOUT)
+#undef ALLOC_REGION_LAYOUT
+#undef ALLOC_POOL_BLOCKS
+#undef ALLOC_POOL_BYTES
+
+#define ALLOC_REGION_BLOCKS_MEMBER(region, start, capacity) struct alloc_##region##_blocks_t region;
+struct alloc_block_layout_t {
+    ALLOC_REGIONS(ALLOC_REGION_BLOCKS_MEMBER)
+};
+#undef ALLOC_REGION_BLOCKS_MEMBER
+
+// POOL_BLOCK_SIZES ⋅ POOL_SIZES (default region)
+#define TOTAL_HEAP_SIZE ((uint32_t)sizeof(struct alloc_SRAM123_layout_t))
+
+// sum(POOL_SIZES) (default region)
+#define TOTAL_BLOCK_COUNT ((uint32_t)sizeof(struct alloc_SRAM123_blocks_t))
+
+// Blocks in all regions
+#define ALLOC_TOTAL_BLOCKS ((uint32_t)sizeof(struct alloc_block_layout_t))
+
+// ceil[ ALLOC_TOTAL_BLOCKS / 8 ], is_free is an array of uint8_t's and each bit represents a block
+#define IS_FREE_SIZE ((ALLOC_TOTAL_BLOCKS + 7) / 8)
+
+// Default region pool geometry.  const, so these live in flash and fold to immediates wherever the
+// index is known
+#define ALLOC_POOL_SIZE_ENTRY(region, size, count) (size),
+#define ALLOC_POOL_COUNT_ENTRY(region, size, count) (count),
+static const uint32_t POOL_BLOCK_SIZES[NUMBER_OF_POOLS] = { ALLOC_POOLS_SRAM123(ALLOC_POOL_SIZE_ENTRY) };
+static const uint32_t POOL_SIZES[NUMBER_OF_POOLS] = { ALLOC_POOLS_SRAM123(ALLOC_POOL_COUNT_ENTRY) };
+#undef ALLOC_POOL_SIZE_ENTRY
+#undef ALLOC_POOL_COUNT_ENTRY
+
+// Ordering check.  In this enum ALLOC_R_AFTER_PREV_<size> picks up the previous entry's size + 1, so
+// "size >= ALLOC_R_AFTER_PREV_<size>" means strictly increasing.  (A repeated size is caught too, as
+// a duplicate enumerator.)  ALLOC_R_ORDER_END is the region's largest block size + 1.
+#define ALLOC_POOL_ORDER(region, size, count) \
+    ALLOC_##region##_AFTER_PREV_##size, ALLOC_##region##_AT_##size = (size),
+#define ALLOC_REGION_ORDER(region, start, capacity) \
+    ALLOC_##region##_ORDER_START = 0, ALLOC_POOLS_##region(ALLOC_POOL_ORDER) ALLOC_##region##_ORDER_END,
+enum {
+    ALLOC_REGIONS(ALLOC_REGION_ORDER)
+};
+#undef ALLOC_REGION_ORDER
+#undef ALLOC_POOL_ORDER
+
+// Largest block size of the default region, usable in constant expressions
+#define ALLOC_MAX_BLOCK_SIZE ((uint32_t)ALLOC_SRAM123_ORDER_END - 1)
+
+// Bytes at the end of each block taken by the ALLOC_DEBUG guard word
+#ifdef ALLOC_DEBUG
+#define ALLOC_GUARD_SIZE ALLOC_ALIGN
+#else
+#define ALLOC_GUARD_SIZE 0
+#endif
+
+#define ALLOC_POOL_CHECK(region, size, count) \
+    _Static_assert((size) >= ALLOC_##region##_AFTER_PREV_##size, "pool block sizes must be strictly increasing"); \
+    _Static_assert((size) >= sizeof(void*) + ALLOC_GUARD_SIZE, "pool block size must be able to hold a pointer (and guard)"); \
+    _Static_assert((size) % ALLOC_ALIGN == 0, "pool block size must be a multiple of ALLOC_ALIGN"); \
+    _Static_assert((count) < 0xFFFF, "pool has too many blocks for a tagged free list head");
+#define ALLOC_REGION_CHECK(region, start, capacity) \
+    ALLOC_POOLS_##region(ALLOC_POOL_CHECK) \
+    _Static_assert(sizeof(struct alloc_##region##_layout_t) <= (capacity), "pools of " #region " do not fit in its heap section");
+ALLOC_REGIONS(ALLOC_REGION_CHECK)
+#undef ALLOC_REGION_CHECK
+#undef ALLOC_POOL_CHECK
+
+#define ALLOC_CHECK_DMA_POOL(region, size, count) \
+    _Static_assert((size) % ALLOC_DMA_ALIGN == 0, "AXI pool block sizes must be whole cache lines");
+ALLOC_POOLS_AXI(ALLOC_CHECK_DMA_POOL)
+#undef ALLOC_CHECK_DMA_POOL
+_Static_assert(ALLOC_DMA_ALIGN % ALLOC_ALIGN == 0, "ALLOC_DMA_ALIGN must be a multiple of ALLOC_ALIGN");
+
+_Static_assert(NUMBER_OF_POOLS > 0, "need at least one pool in the default region");
+_Static_assert(ALLOC_TOTAL_POOLS <= 32, "pool_nonempty mask is one 32 bit word");
+
+// Size class tables, one per region: entry k is the region-relative pool for sizes
+// ((k - 1) * ALLOC_ALIGN, k * ALLOC_ALIGN], i.e. it is indexed by size rounded up to ALLOC_ALIGN.
+// Every block size is a multiple of ALLOC_ALIGN, so each pool owns a contiguous run of entries,
+// filled in with range designators from the pool table.  One byte per ALLOC_ALIGN bytes of the
+// largest block (129 bytes of flash for the default table).
+#define ALLOC_SIZE_CLASS_RANGE(region, size, count) \
+    [(ALLOC_##region##_AFTER_PREV_##size - 1) / ALLOC_ALIGN + 1 ... (size) / ALLOC_ALIGN] = \
+        ALLOC_POOL_##region##_##size - ALLOC_##region##_FIRST_POOL,
+#define ALLOC_REGION_SIZE_CLASS(region, start, capacity) \
+    static const uint8_t ALLOC_SIZE_CLASS_##region[(ALLOC_##region##_ORDER_END - 1) / ALLOC_ALIGN + 1] = { \
+        [0] = 0, /* size 0 maps to the first pool, alloc() rejects it separately */ \
+        ALLOC_POOLS_##region(ALLOC_SIZE_CLASS_RANGE) \
+    };
+ALLOC_REGIONS(ALLOC_REGION_SIZE_CLASS)
+#undef ALLOC_REGION_SIZE_CLASS
+#undef ALLOC_SIZE_CLASS_RANGE
+
 /**
- * Initialize heap.  Draws on parameters set up above
+ * Index of the smallest default region pool whose blocks can hold @param size bytes, or
+ * NUMBER_OF_POOLS if none can.  One compare and one table load, whatever the number of pools.
+ */
+static inline uint32_t alloc_pool_for_size(uint32_t size) {
+    if (size <= ALLOC_MAX_BLOCK_SIZE - ALLOC_GUARD_SIZE) {
+        return ALLOC_SIZE_CLASS_SRAM123[(size + ALLOC_GUARD_SIZE + ALLOC_ALIGN - 1) / ALLOC_ALIGN];
+    }
+    return NUMBER_OF_POOLS;
+}
+
+/**
+ * Where alloc_hint() should place a block.  Each hint tries its preferred region first and then the
+ * default region; regions whose start pointer is NULL are skipped.
+ */
+enum alloc_hint_t {
+    ALLOC_HINT_DEFAULT, // SRAM1-3 only, same as alloc()
+    ALLOC_HINT_FAST,    // DTCM, for CPU-only data on latency critical paths.  Never hand these to DMA1/DMA2
+    ALLOC_HINT_DMA,     // AXI SRAM, for buffers any DMA master (MDMA, DMA1, DMA2) has to reach
+};
+
+
+/**
+ * Initialize heap.  Draws on parameters set up above.  Regions whose start pointer is NULL are left
+ * out (their pools stay empty)
+ *
+ * @return 1 for success, -1 if a region's start is not aligned to ALLOC_ALIGN (ALLOC_DMA_ALIGN for
+ * the AXI region)
  */
 uint32_t init_heap();
 
 /**
- * Allocate a block of size @param size
+ * Allocate a block of size @param size, zeroed
+ *
+ * Lock-free: safe to call from interrupt handlers while threads are also allocating (for example to
+ * hand a buffer off from a DMA completion ISR).  Interrupts are never disabled.
  */
 void* alloc(uint32_t size);
 
+/**
+ * Same as alloc(), but the block is not zeroed, so its contents are whatever the last owner left
+ * (a recycled block's first word is overwritten by the free list).  Use when the caller overwrites the
+ * whole buffer anyway, e.g. a DMA receive buffer.
+ */
+void* alloc_uninit(uint32_t size);
+
+/**
+ * Allocate a zeroed block of size @param size, placed according to @param hint (see alloc_hint_t)
+ *
+ * Same guarantees as alloc().
+ */
+void* alloc_hint(uint32_t size, enum alloc_hint_t hint);
+
+/**
+ * Allocate a DMA buffer of size @param size from the AXI region, which every DMA master can reach
+ *
+ * The block starts on a cache line (ALLOC_DMA_ALIGN) and is padded to whole lines, so cache
+ * maintenance on it (see internal/cache.h) never clobbers a neighbouring block.  There is no fallback
+ * to another region, since SRAM1-3 blocks are only ALLOC_ALIGN aligned: returns NULL if the AXI
+ * region is not set up or full.
+ *
+ * The block is NOT zeroed.  Zeroing through the D-cache would leave dirty lines that could be
+ * evicted on top of a transfer, so clean (TX) or invalidate (RX) the buffer before handing it to
+ * DMA.  Freed with free().
+ */
+void* alloc_dma(uint32_t size);
+
 /**
  * Free the block at @param mem
+ *
+ * Lock-free, with the same ISR/thread guarantees as alloc().
  */
 void free(void* mem);
 
 /**
- * Check if the block at @param mem is free
+ * Check if the block at @param mem is free (in any region)
  */
 bool isFree(void* mem);
 
+/**
+ * Number of bytes the block at @param mem can hold, i.e. its pool's block size (less the ALLOC_DEBUG
+ * guard).  Callers may use all of it, so a growing buffer only needs alloc_resize() once it passes
+ * this.  Constant time, same lookup as free().
+ *
+ * @return the usable size, or 0 for NULL or a pointer outside every region
+ */
+uint32_t alloc_usable_size(void* mem);
+
+/**
+ * Resize the block at @param mem to hold at least @param size bytes
+ *
+ * Returns mem itself whenever size still fits the block (alloc_usable_size()), including every
+ * shrink.  Otherwise takes a larger block from the same region (falling back as alloc_hint() would;
+ * blocks from alloc_dma() stay in the AXI region), copies the old block over with a single copy and
+ * frees it.  Bytes past the old contents are not zeroed.
+ *
+ * alloc_resize(NULL, size) is alloc(size), and alloc_resize(mem, 0) frees mem and returns NULL.
+ *
+ * @return the block, or NULL if no larger block is free (mem is then left as it was)
+ */
+void* alloc_resize(void* mem, uint32_t size);
+
+/**
+ * Private block cache (magazine) for one thread or core, see alloc_cached().
+ *
+ * Holds up to ALLOC_CACHE_DEPTH free blocks per pool, linked through their first word.  alloc_cached()
+ * and free_cached() only touch the cache, going to the shared pools for half a cache of blocks at a
+ * time when it runs dry or overflows.  Start from a zeroed struct (= {0}).
+ *
+ * alloc_cached() allocates from the default region, free_cached() takes blocks from any region.
+ */
+struct alloc_cache_t {
+    void* head[ALLOC_TOTAL_POOLS];
+    uint8_t count[ALLOC_TOTAL_POOLS];
+};
+
+/**
+ * Allocate a zeroed block of size @param size through @param cache
+ *
+ * Same result as alloc(), but most calls touch no shared state.  A cache is not thread safe: use
+ * one per thread/core, and never share one with an interrupt handler (ISRs use alloc()/free()).
+ */
+void* alloc_cached(struct alloc_cache_t* cache, uint32_t size);
+
+/**
+ * Free the block at @param mem into @param cache
+ *
+ * Blocks from alloc() and alloc_cached() can be freed with either free() or free_cached().  A block
+ * sitting in a cache still reads as in use to isFree() (and to ALLOC_STATS) until the cache gives
+ * it back.
+ */
+void free_cached(struct alloc_cache_t* cache, void* mem);
+
+/**
+ * Give every block held by @param cache back to the shared pools, e.g. before its thread exits.
+ * Caches must be flushed or discarded before init_heap() is called again.
+ */
+void alloc_cache_flush(struct alloc_cache_t* cache);
+
+/**
+ * Fixed-size object slab, see slab_create().
+ *
+ * Objects are packed back to back at a stride of their size rounded up to ALLOC_ALIGN, instead of
+ * being rounded up to the next pool block.  Free objects are linked through their first word with a
+ * tagged head like the pools', so slab_alloc() and slab_free() are O(1) and lock-free.  Like the
+ * pools, objects are first handed out in address order and only then recycled, so a slab needs no
+ * set up beyond its descriptor.  Do not touch the fields directly.
+ */
+struct alloc_slab_t {
+    uint8_t* base;     // first object
+    uint32_t stride;   // bytes between objects
+    uint32_t count;    // number of objects
+    uint32_t head;     // tagged free list head (slot in the low 16 bits, 0 for empty)
+    uint32_t bump;     // objects handed out at least once
+};
+
+// Bytes between objects of size obj_size in a slab (at least a pointer, a multiple of ALLOC_ALIGN)
+#define SLAB_STRIDE(obj_size) \
+    ((((obj_size) < sizeof(void*) ? sizeof(void*) : (obj_size)) + ALLOC_ALIGN - 1) / ALLOC_ALIGN * ALLOC_ALIGN)
+
+// Bytes of storage a slab of count objects of size obj_size needs
+#define SLAB_BYTES(obj_size, count) (SLAB_STRIDE(obj_size) * (count))
+
+/**
+ * Define a static slab @param name of @param n objects of @param type, with its storage.  Needs
+ * no init call, use it as &name:
+ *
+ *     SLAB_DEFINE(spi_transfers, struct spi_transfer_t, 16);
+ *     struct spi_transfer_t* t = slab_alloc(&spi_transfers);
+ */
+#define SLAB_DEFINE(name, type, n) \
+    _Static_assert((n) > 0 && (n) < 0xFFFF, "slab " #name " needs 1 to 0xFFFE objects"); \
+    static _Alignas(ALLOC_ALIGN) uint8_t name##_storage[SLAB_BYTES(sizeof(type), (n))]; \
+    static struct alloc_slab_t name = { \
+        .base = name##_storage, .stride = SLAB_STRIDE(sizeof(type)), .count = (n), .head = 0, .bump = 0 \
+    }
+
+/**
+ * Set up @param slab to carve @param count objects of @param obj_size bytes out of @param buffer,
+ * which must be ALLOC_ALIGN aligned and at least SLAB_BYTES(obj_size, count) long.  O(1).
+ *
+ * @return false if obj_size or count is 0, count is too large, SLAB_BYTES(obj_size, count) does not
+ *         fit in 32 bits, or buffer is NULL or misaligned
+ */
+bool slab_init(struct alloc_slab_t* slab, void* buffer, uint32_t obj_size, uint32_t count);
+
+/**
+ * Create a slab of @param count objects of @param obj_size bytes in a single pool block, placed
+ * according to @param hint.  The descriptor lives at the start of the block.  O(1), and the objects
+ * are not touched.
+ *
+ * Release it with free() once none of its objects are in use.
+ *
+ * @return the slab, or NULL if obj_size or count is 0 or no free block is large enough
+ */
+struct alloc_slab_t* slab_create(uint32_t obj_size, uint32_t count, enum alloc_hint_t hint);
+
+/**
+ * Allocate a zeroed object from @param slab.  O(1), lock-free (safe from interrupt handlers).
+ *
+ * @return the object, or NULL if every object of the slab is in use
+ */
+void* slab_alloc(struct alloc_slab_t* slab);
+
+/**
+ * Return @param obj to @param slab.  O(1), lock-free.  NULL, and pointers that are not an object of
+ * the slab, are ignored.
+ */
+void slab_free(struct alloc_slab_t* slab, void* obj);
+
+/**
+ * Scratch arena (bump allocator), see arena_init().
+ *
+ * arena_alloc() only moves a pointer and arena_reset() hands everything back at once, for
+ * temporaries that all die together, e.g. per control loop iteration.  arena_mark()/arena_release()
+ * save and restore the pointer, and nest.  An arena is not thread safe: use one per thread/core, and
+ * never share one with an interrupt handler.  Do not touch the fields directly.
+ */
+struct alloc_arena_t {
+    uint8_t* base;  // start of the arena's memory
+    uint32_t size;  // usable bytes, a multiple of ALLOC_ALIGN
+    uint32_t used;  // bytes handed out, a multiple of ALLOC_ALIGN
+};
+
+/**
+ * Set up @param arena over @param size bytes at @param buffer, e.g. the linker's .scratch section
+ * (__scratch_start/__scratch_end).  buffer must be ALLOC_ALIGN aligned; size is rounded down to a
+ * multiple of ALLOC_ALIGN.
+ *
+ * @return false if buffer is NULL or misaligned
+ */
+bool arena_init(struct alloc_arena_t* arena, void* buffer, uint32_t size);
+
+/**
+ * Create an arena of at least @param size bytes in a single pool block, placed according to
+ * @param hint.  The descriptor lives at the start of the block and the arena gets the rest of it.
+ *
+ * Release it with free().
+ *
+ * @return the arena, or NULL if no free block is large enough
+ */
+struct alloc_arena_t* arena_create(uint32_t size, enum alloc_hint_t hint);
+
+/**
+ * Allocate @param size bytes from @param arena, ALLOC_ALIGN aligned.  O(1).  Not zeroed: scratch
+ * buffers are normally written before they are read.
+ *
+ * @return the memory, or NULL if size is 0 or the arena does not have size bytes left
+ */
+void* arena_alloc(struct alloc_arena_t* arena, uint32_t size);
+
+/**
+ * Save the current fill of @param arena, to be restored with arena_release()
+ */
+uint32_t arena_mark(struct alloc_arena_t* arena);
+
+/**
+ * Free everything allocated from @param arena since @param mark was taken.  O(1).  Marks nest:
+ * releasing an outer mark also releases everything after inner ones.  A mark above the current fill
+ * (from after an older release) is ignored.
+ */
+void arena_release(struct alloc_arena_t* arena, uint32_t mark);
+
+/**
+ * Free everything allocated from @param arena.  O(1).
+ */
+void arena_reset(struct alloc_arena_t* arena);
+
+/**
+ * Usage counters for one pool.  Sizes are in bytes, counts in blocks/requests.
+ *
+ * A request is charged to its ideal pool (the smallest one it fits in, in the first region it tried)
+ * for failed and fallbacks, and to the pool that actually served it for everything else.  Requests
+ * larger than the largest block count as failures of the region's last pool.  Counters are 32 bit
+ * and wrap.
+ */
+struct alloc_pool_stats_t {
+    uint32_t in_use;          // blocks currently allocated
+    uint32_t peak;            // high-water mark of in_use since init_heap() / alloc_reset_stats()
+    uint32_t allocs;          // successful allocations served from this pool
+    uint32_t failed;          // requests for this pool that returned NULL
+    uint32_t fallbacks;       // requests for this pool served by a larger pool because it was empty
+    uint32_t requested_bytes; // sum of sizes asked for by allocations served from this pool
+    uint32_t wasted_bytes;    // sum of (block size - size asked for) over the same allocations
+};
+
+/**
+ * Copy the counters for pool @param pool (an index across all regions, so 0 to NUMBER_OF_POOLS - 1
+ * are the default region's) into @param out
+ *
+ * Each counter is read atomically, but the set is not a single snapshot if other contexts are
+ * allocating at the same time.
+ *
+ * @return true on success, false if @param pool is out of range or the allocator was built without
+ * ALLOC_STATS (out is zeroed in both cases)
+ */
+bool alloc_get_stats(uint32_t pool, struct alloc_pool_stats_t* out);
+
+/**
+ * Zero the counters of every pool and restart each peak from the current in_use.  No-op without
+ * ALLOC_STATS.
+ */
+void alloc_reset_stats();
+
+/**
+ * Kind of heap call in a trace entry
+ */
+enum alloc_trace_op_t {
+    ALLOC_TRACE_ALLOC,  // a block was handed out (or, with addr 0, the request failed)
+    ALLOC_TRACE_FREE,   // a block was given back
+    ALLOC_TRACE_RESIZE, // alloc_resize() kept the block in place for a new size
+};
+
+/**
+ * One heap call.  Blocks that alloc_resize() moves show up as an ALLOC of the new block and a FREE of
+ * the old one, both with the caller of alloc_resize().  Blocks moving in and out of alloc_cache_t
+ * caches are not traced (a block taken with alloc_cached() can show up as a FREE only).
+ */
+struct alloc_trace_entry_t {
+    uint32_t time;    // alloc_trace_clock() at the call
+    uint32_t caller;  // return address into the code that called the allocator
+    uint32_t addr;    // block address, 0 for a failed request
+    uint16_t size;    // bytes requested (ALLOC / RESIZE, saturates at 0xFFFF), 0 for FREE
+    uint8_t op : 4;   // alloc_trace_op_t
+    uint8_t hint : 4; // ALLOC: alloc_hint_t the request was made with (ALLOC_HINT_DMA + 1 for alloc_dma())
+    uint8_t pool;     // pool of the block (index across all regions), 0xFF for a failed request
+};
+
+_Static_assert(sizeof(struct alloc_trace_entry_t) == 16, "trace entries are parsed by tools/alloc_replay.py");
+_Static_assert((ALLOC_TRACE_DEPTH & (ALLOC_TRACE_DEPTH - 1)) == 0, "ALLOC_TRACE_DEPTH must be a power of two");
+
+#define ALLOC_TRACE_MAGIC 0x54434C41u // "ALCT"
+
+/**
+ * Trace ring of the last ALLOC_TRACE_DEPTH heap calls.  Self-describing so a raw dump of the
+ * alloc_trace symbol (e.g. gdb's "dump binary value trace.bin alloc_trace") can be read by
+ * tools/alloc_replay.py.  Entry n (counting from init_heap()) is in entries[n % ALLOC_TRACE_DEPTH].
+ *
+ * Entries are written lock-free from any context: each call claims a slot with one atomic add, so an
+ * entry that is being written while the ring is read may be torn.
+ */
+struct alloc_trace_t {
+    uint32_t magic;      // ALLOC_TRACE_MAGIC once init_heap() ran
+    uint16_t depth;      // ALLOC_TRACE_DEPTH
+    uint16_t entry_size; // sizeof(struct alloc_trace_entry_t)
+    uint32_t count;      // entries written since init_heap() / alloc_trace_clear(), wraps
+    uint32_t reserved;
+    struct alloc_trace_entry_t entries[ALLOC_TRACE_DEPTH];
+};
+
+#ifdef ALLOC_TRACE
+extern struct alloc_trace_t alloc_trace;
+#endif
+
+/**
+ * Timestamp for trace entries.  Weak: the default reads the DWT cycle counter on the target (0
+ * unless something enabled it) and returns 0 on the host; override it with a system tick instead.
+ */
+uint32_t alloc_trace_clock(void);
+
+/**
+ * Copy up to @param max of the most recent trace entries into @param out, oldest first
+ *
+ * @return the number of entries copied, 0 without ALLOC_TRACE
+ */
+uint32_t alloc_trace_copy(struct alloc_trace_entry_t* out, uint32_t max);
+
+/**
+ * Empty the trace ring.  No-op without ALLOC_TRACE.
+ */
+void alloc_trace_clear();
+
+/**
+ * Heap corruption found by free() (with ALLOC_DEBUG) or heap_validate()
+ */
+enum alloc_fault_t {
+    ALLOC_OK,                 // no corruption found
+    ALLOC_FAULT_BAD_POINTER,  // free() of a pointer outside every region
+    ALLOC_FAULT_MISALIGNED,   // free() of a pointer into the middle of a block
+    ALLOC_FAULT_DOUBLE_FREE,  // free() of a block that is already free
+    ALLOC_FAULT_GUARD,        // a block's guard word was overwritten (overrun of the block before it ends)
+    ALLOC_FAULT_FREE_LIST,    // a free list or the is_free bitmap is inconsistent (write after free)
+};
+
+/**
+ * Called with each fault found and the block involved.  Weak: the default stops at a breakpoint on
+ * the target and does nothing on the host; override it to log or reset instead.  If it returns,
+ * free() leaves the bad block alone (except for a GUARD fault, where the block is still freed).
+ */
+void alloc_fault_handler(enum alloc_fault_t fault, void* block);
+
+/**
+ * Walk every pool and check its free list against the is_free bitmap: each listed block is a
+ * block of that pool marked free, the list has no cycle, and every other free marked block has never
+ * been handed out.  With ALLOC_DEBUG also checks the guard word of every block handed out so far.
+ * O(blocks), for soak tests and debug builds.  Only call while nothing else allocates or frees.
+ *
+ * @return ALLOC_OK, or the first fault found (which is also passed to alloc_fault_handler())
+ */
+enum alloc_fault_t heap_validate();
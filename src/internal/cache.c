@@ -0,0 +1,65 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * @file src/internal/cache.c
+ * @authors UW SARP
+ * @brief CM7 data cache maintenance for DMA buffers.
+ */
+
+#include "cache.h"
+#include "mmio.h"
+
+/**************************************************************************************************
+ * @section Private Functions
+ **************************************************************************************************/
+
+// Applies a by-address maintenance operation to every line overlapping [addr, addr + size).
+// Lines only partly inside the range get edge_reg instead of reg.
+static void cache_maintain(uintptr_t addr, uint32_t size, rw_reg32_t reg, rw_reg32_t edge_reg) {
+  if (size == 0 || !IS_FIELD_SET(SCB_CCR, SCB_CCR_DC)) {
+    return;
+  }
+  const uintptr_t end = addr + size;
+  uintptr_t line = addr & ~(uintptr_t)(CACHE_LINE_SIZE - 1);
+
+#ifdef __arm__ // the host tests run this against the register fake
+  asm volatile("dsb" ::: "memory"); // prior CPU writes reach the cache first
+#endif
+  for (; line < end; line += CACHE_LINE_SIZE) {
+    bool partial = line < addr || line + CACHE_LINE_SIZE > end;
+    *(partial ? edge_reg : reg) = (uint32_t)line;
+  }
+#ifdef __arm__
+  asm volatile("dsb" ::: "memory"); // maintenance completes before any DMA is started
+  asm volatile("isb");
+#endif
+}
+
+/**************************************************************************************************
+ * @section Public Functions
+ **************************************************************************************************/
+
+void cache_clean_range(const void* addr, uint32_t size) {
+  cache_maintain((uintptr_t)addr, size, SCB_DCCMVAC, SCB_DCCMVAC);
+}
+
+void cache_invalidate_range(void* addr, uint32_t size) {
+  cache_maintain((uintptr_t)addr, size, SCB_DCIMVAC, SCB_DCCIMVAC);
+}
+
+void cache_clean_invalidate_range(void* addr, uint32_t size) {
+  cache_maintain((uintptr_t)addr, size, SCB_DCCIMVAC, SCB_DCCIMVAC);
+}
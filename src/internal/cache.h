@@ -0,0 +1,63 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * @file src/internal/cache.h
+ * @authors UW SARP
+ * @brief CM7 data cache maintenance for DMA buffers.
+ */
+
+#pragma once
+#include <stdint.h>
+
+/**************************************************************************************************
+ * @section Constants
+ **************************************************************************************************/
+
+#define CACHE_LINE_SIZE 32 /** @brief CM7 D-cache line size in bytes (same as ALLOC_DMA_ALIGN). */
+
+/**************************************************************************************************
+ * @section Public Functions
+ **************************************************************************************************/
+
+/**
+ * @brief Writes any dirty D-cache lines covering a range back to memory.
+ * Call on a TX buffer after the CPU has filled it and before a DMA master reads it.
+ * @param addr Start of the range.
+ * @param size Length of the range in bytes.
+ * @note - Does nothing if the D-cache is disabled.
+ */
+void cache_clean_range(const void* addr, uint32_t size);
+
+/**
+ * @brief Discards the D-cache lines covering a range, so the next CPU read comes from memory.
+ * Call on an RX buffer before starting the transfer (so no dirty line can be evicted on top of
+ * it) and again once the transfer is complete (to drop lines speculatively refilled meanwhile).
+ * @param addr Start of the range.
+ * @param size Length of the range in bytes.
+ * @note - Lines only partly covered by the range are cleaned before they are invalidated, so
+ *         neighbouring data is never lost.  Buffers from alloc_dma() have no such lines.
+ * @note - Does nothing if the D-cache is disabled.
+ */
+void cache_invalidate_range(void* addr, uint32_t size);
+
+/**
+ * @brief Writes back and then discards the D-cache lines covering a range.
+ * For buffers the CPU writes and a DMA master then overwrites (e.g. SPI full duplex).
+ * @param addr Start of the range.
+ * @param size Length of the range in bytes.
+ * @note - Does nothing if the D-cache is disabled.
+ */
+void cache_clean_invalidate_range(void* addr, uint32_t size);
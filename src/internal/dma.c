@@ -1,16 +1,657 @@
+/**
+ * This file is part of the Titan Flight Computer Project
+ * Copyright (c) 2024 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file src/internal/dma.c
+ * @authors Charles Faisandier, UW SARP
+ * @brief DMA1/DMA2 stream driver.
+ */
+
 #include "dma.h"
+#include "interrupt.h"
+#include "internal/mmio/dmax.h"
+#include "internal/mmio/dmamux1.h"
+#include "internal/mmio/rcc.h"
+
+/**************************************************************************************************
+ * @section Private Data
+ **************************************************************************************************/
+
+// Number of DMAMUX1 channels in front of each controller (DMA1 uses 0-7, DMA2 uses 8-15)
+#define DMAMUX_CHANNELS_PER_DMA 8
+
+// Largest number of items a single transfer can move (size of the NDT field)
+#define DMA_MAX_ITEMS 0xFFFFU
+
+// Stream configuration registers, which are separate registers rather than an array in mmio.
+// Every stream's CR has the layout of DMAx_S0CR, so the DMAx_S0CR_* fields are used for all of them.
+static rw_reg32_t const *const stream_cr[DMA_STREAM_COUNT] = {
+    DMAx_S0CR, DMAx_S1CR, DMAx_S2CR, DMAx_S3CR,
+    DMAx_S4CR, DMAx_S5CR, DMAx_S6CR, DMAx_S7CR,
+};
+
+// FTH encoding of each dma_fifo_threshold_t (the enum counts down from full)
+static const uint32_t fifo_threshold_fth[DMA_FIFO_THRESHOLD_COUNT] = {
+    [DMA_FIFO_THRESHOLD_FULL]          = 3,
+    [DMA_FIFO_THRESHOLD_THREEQUARTERS] = 2,
+    [DMA_FIFO_THRESHOLD_HALF]          = 1,
+    [DMA_FIFO_THRESHOLD_QUARTER]       = 0,
+};
+
+// Per-stream state, written by dma_configure_stream()/dma_start_transfer() and read by the IRQs
+typedef struct {
+    dma_callback_t callback;
+    void *context;
+    bool configured;
+    dma_lease_t *lease; // Lease running on the stream, if it is leased
+    dma_event_callback_t event_callback; // Set while a continuous transfer runs
+    size_t buffer_size; // Buffer size of the continuous transfer
+    bool half_events;
+    const dma_iovec_t *sg_next; // Buffers of a scatter-gather transfer still to start
+    size_t sg_left;
+} dma_stream_state_t;
+
+static volatile dma_stream_state_t stream_state[DMA_INSTANCE_COUNT][DMA_STREAM_COUNT];
+
+// Free streams, bit (stream * 2 + instance - 1). Interleaving the controllers makes the lowest set
+// bit the lowest free stream number (DMA1 first), which is also the one the arbiter favours.
+#define ALL_STREAMS_FREE 0xFFFFU
+static uint32_t free_streams = ALL_STREAMS_FREE;
+
+// Claimer of each stream (by bit), the config's owner (NULL for a fixed stream) for streams taken by
+// dma_configure_stream()
+static const void *stream_owner[2 * DMA_STREAM_COUNT];
+
+// Owner token of leased streams
+static const char lease_owner;
+
+// Leases waiting for a stream, highest priority first
+static dma_lease_t *pending_leases;
+
+/**************************************************************************************************
+ * @section Private Functions
+ **************************************************************************************************/
+
+static bool valid_stream(dma_instance_t instance, dma_stream_t stream) {
+    return instance >= DMA_INSTANCE_MIN && instance < DMA_INSTANCE_COUNT &&
+           stream >= DMA_STREAM_MIN && stream < DMA_STREAM_COUNT;
+}
+
+// Checks everything in a stream configuration except the instance and stream
+static bool valid_config(const dma_config_t* config) {
+    if (config->direction >= DMA_DIR_COUNT || config->priority >= DMA_PRIORITY_COUNT ||
+        config->src_data_size >= DMA_DATA_SIZE_COUNT || config->dest_data_size >= DMA_DATA_SIZE_COUNT ||
+        config->fifo_threshold >= DMA_FIFO_THRESHOLD_COUNT) {
+        return false;
+    }
+    // Request 0 is "no request", a peripheral stream always needs one
+    if (config->request_id == 0 || !IN_RANGE_FIELD(DMAMUX1_CxCR_DMAREQ_ID, config->request_id)) {
+        return false;
+    }
+    // In direct mode (no FIFO) the memory width is forced to the peripheral width
+    return config->fifo_enabled || config->src_data_size == config->dest_data_size;
+}
+
+static uint32_t stream_bit(dma_instance_t instance, dma_stream_t stream) {
+    return stream * 2 + (instance - DMA_INSTANCE_MIN);
+}
+
+/**
+ * Internal function.
+ * Masks interrupts, for the lease queue which the stream IRQs also use.
+ * Returns the previous mask to pass to irq_unlock().
+ */
+static inline uint32_t irq_lock(void) {
+    uint32_t primask = 0;
+#ifdef __arm__
+    asm volatile("MRS %0, PRIMASK\n\tCPSID i" : "=r"(primask) : : "memory");
+#endif
+    return primask;
+}
+
+static inline void irq_unlock(uint32_t primask) {
+#ifdef __arm__
+    asm volatile("MSR PRIMASK, %0" : : "r"(primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+// Takes a stream out of the free mask, returns false if it was not free
+static bool take_stream(uint32_t bit) {
+    uint32_t free = __atomic_load_n(&free_streams, __ATOMIC_RELAXED);
+    do {
+        if ((free & (1U << bit)) == 0) {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&free_streams, &free, free & ~(1U << bit), true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+    return true;
+}
+
+// Interrupt flags of a stream. Streams 4-7 use the high registers at the bit positions of streams 0-3.
+static uint32_t stream_flag_mask(dma_stream_t stream) {
+    const uint32_t slot = stream % 4;
+    return DMAx_LISR_FEIFx[slot].msk | DMAx_LISR_DMEIFx[slot].msk | DMAx_LISR_TEIFx[slot].msk |
+           DMAx_LISR_HTIFx[slot].msk | DMAx_LISR_TCIFx[slot].msk;
+}
+
+static uint32_t read_stream_flags(dma_instance_t instance, dma_stream_t stream) {
+    const uint32_t isr = (stream < 4) ? *DMAx_LISR[instance] : *DMAx_HISR[instance];
+    return isr & stream_flag_mask(stream);
+}
+
+// Clears the given flags (as returned by read_stream_flags()) of a stream
+static void clear_stream_flags(dma_instance_t instance, dma_stream_t stream, uint32_t flags) {
+    if (stream < 4) {
+        *DMAx_LIFCR[instance] = flags;
+    } else {
+        *DMAx_HIFCR[instance] = flags;
+    }
+}
+
+// Number of items (NDT) to move size bytes between the addresses, 0 if the stream's data sizes
+// do not fit them. NDT counts items of the peripheral width, both addresses must be aligned.
+static size_t transfer_items(rw_reg32_t cr, uintptr_t periph_addr, uintptr_t mem_addr, size_t size) {
+    const uint32_t periph_width = 1U << READ_FIELD(cr, DMAx_S0CR_PSIZE);
+    const uint32_t mem_width = 1U << READ_FIELD(cr, DMAx_S0CR_MSIZE);
+    const size_t items = size / periph_width;
+    if (items > DMA_MAX_ITEMS || size % periph_width != 0 || size % mem_width != 0 ||
+        periph_addr % periph_width != 0 || mem_addr % mem_width != 0) {
+        return 0;
+    }
+    return items;
+}
+
+// Disables a stream and waits for the hardware to finish the current beat
+static void stop_stream(dma_instance_t instance, dma_stream_t stream) {
+    rw_reg32_t cr = stream_cr[stream][instance];
+    CLR_FIELD(cr, DMAx_S0CR_EN);
+    while (IS_FIELD_SET(cr, DMAx_S0CR_EN)) {}
+}
+
+// Starts the transfer of one scatter-gather buffer, already checked by dma_start_sg()
+static void start_sg_buffer(dma_instance_t instance, dma_stream_t stream, const dma_iovec_t *iov) {
+    rw_reg32_t cr = stream_cr[stream][instance];
+    const size_t items = transfer_items(cr, *DMAx_SxPAR[instance][stream], (uintptr_t)iov->base, iov->size);
+    *DMAx_SxM0AR[instance][stream] = (uint32_t)(uintptr_t)iov->base;
+    WRITE_FIELD(DMAx_SxNDTR[instance][stream], DMAx_SxNDTR_NDT, items);
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+    SET_FIELD(cr, DMAx_S0CR_EN);
+}
+
+// Configures the leased stream for a lease and starts it
+static bool start_lease(dma_lease_t *lease, dma_instance_t instance, dma_stream_t stream) {
+    lease->config.instance = instance;
+    lease->config.stream = stream;
+    lease->config.owner = &lease_owner;
+    lease->transfer.instance = instance;
+    lease->transfer.stream = stream;
+    if (!dma_configure_stream(&lease->config)) {
+        return false;
+    }
+    stream_state[instance][stream].lease = lease;
+    return dma_start_transfer(&lease->transfer);
+}
+
+// Stops a stream and leaves it unconfigured, with its IRQ masked
+static void reset_stream(dma_instance_t instance, dma_stream_t stream) {
+    stop_stream(instance, stream);
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+    irq_disable(DMAx_STRx_IRQ_NUM[instance][stream]);
+    stream_state[instance][stream].configured = false;
+    stream_state[instance][stream].callback = NULL;
+}
+
+// Starts the first waiting lease that can run on a stream being freed, call with the IRQs masked.
+// Leases that could not start are appended to *failed (linked through next) for the caller to
+// report once the IRQs are unmasked. Returns false if no lease took the stream.
+static bool pass_to_pending_lease(dma_instance_t instance, dma_stream_t stream, dma_lease_t **failed) {
+    stream_owner[stream_bit(instance, stream)] = &lease_owner;
+    while (pending_leases != NULL) {
+        dma_lease_t *next = pending_leases;
+        pending_leases = next->next;
+        if (start_lease(next, instance, stream)) {
+            return true;
+        }
+        // Could not start, undo whatever it set up and try the one after
+        stream_state[instance][stream].lease = NULL;
+        reset_stream(instance, stream);
+        next->next = NULL;
+        *failed = next;
+        failed = &next->next;
+    }
+    return false;
+}
+
+// Hands a leased stream whose transfer ended to the next waiting lease, or back to the pool
+static void end_lease(dma_instance_t instance, dma_stream_t stream) {
+    stream_state[instance][stream].lease = NULL;
+    dma_release_stream((dma_stream_id_t){instance, stream}, &lease_owner);
+}
+
+// Event dispatch of a stream running a continuous transfer
+static void continuous_irq(dma_instance_t instance, dma_stream_t stream, uint32_t flags) {
+    const uint32_t slot = stream % 4;
+    const dma_event_callback_t callback = stream_state[instance][stream].event_callback;
+    void *const context = stream_state[instance][stream].context;
+    if ((flags & DMAx_LISR_TEIFx[slot].msk) != 0) {
+        stream_state[instance][stream].event_callback = NULL;
+        callback(DMA_EVENT_ERROR, NULL, 0, context);
+        return;
+    }
+
+    // In double-buffer mode CT is the buffer in use, and has already switched when TCIF is seen
+    rw_reg32_t cr = stream_cr[stream][instance];
+    const size_t size = stream_state[instance][stream].buffer_size;
+    const bool half_events = stream_state[instance][stream].half_events;
+    const bool on_m1 = IS_FIELD_SET(cr, DMAx_S0CR_DBM) && IS_FIELD_SET(cr, DMAx_S0CR_CT);
+    uint8_t *const m0 = (uint8_t*)(uintptr_t)*DMAx_SxM0AR[instance][stream];
+    uint8_t *const m1 = (uint8_t*)(uintptr_t)*DMAx_SxM1AR[instance][stream];
+
+    const bool complete = (flags & DMAx_LISR_TCIFx[slot].msk) != 0;
+    uint8_t *const done = (IS_FIELD_SET(cr, DMAx_S0CR_DBM) && !on_m1) ? m1 : m0;
+
+    // A half transfer pending together with TCIF was in the buffer that completed, not the one CT now names
+    if ((flags & DMAx_LISR_HTIFx[slot].msk) != 0 && half_events) {
+        callback(DMA_EVENT_HALF_TRANSFER, complete ? done : (on_m1 ? m1 : m0), size / 2, context);
+    }
+    if (complete) {
+        if (half_events) {
+            callback(DMA_EVENT_TRANSFER_COMPLETE, done + size / 2, size / 2, context);
+        } else {
+            callback(DMA_EVENT_TRANSFER_COMPLETE, done, size, context);
+        }
+    }
+}
+
+// Common completion/error handling for all stream IRQs
+static void dma_stream_irq(dma_instance_t instance, dma_stream_t stream) {
+    const uint32_t flags = read_stream_flags(instance, stream);
+    clear_stream_flags(instance, stream, flags);
+    if (stream_state[instance][stream].event_callback != NULL) {
+        continuous_irq(instance, stream, flags);
+        return;
+    }
+
+    const uint32_t slot = stream % 4;
+    const bool error = (flags & DMAx_LISR_TEIFx[slot].msk) != 0;
+    const bool complete = (flags & DMAx_LISR_TCIFx[slot].msk) != 0;
+    if (!error && !complete) {
+        return;
+    }
+
+    // A scatter-gather transfer goes on with its next buffer, and ends at its first error
+    if (!error && stream_state[instance][stream].sg_left > 0) {
+        const dma_iovec_t *next = stream_state[instance][stream].sg_next;
+        stream_state[instance][stream].sg_next = next + 1;
+        stream_state[instance][stream].sg_left--;
+        start_sg_buffer(instance, stream, next);
+        return;
+    }
+    stream_state[instance][stream].sg_left = 0;
+
+    // The hardware has already cleared EN, the stream is free for the next transfer
+    const dma_callback_t callback = stream_state[instance][stream].callback;
+    void *const context = stream_state[instance][stream].context;
+    if (stream_state[instance][stream].lease != NULL) {
+        end_lease(instance, stream);
+    }
+    if (callback != NULL) {
+        callback(!error, context);
+    }
+}
+
+/**************************************************************************************************
+ * @section Public Functions
+ **************************************************************************************************/
 
 tal_err_t *dma_init(void) {
-    return (void*) (0);
+    WRITE_FIELDS(RCC_AHB1ENR, FIELD_SET(RCC_AHB1ENR_DMAxEN[1]), FIELD_SET(RCC_AHB1ENR_DMAxEN[2]));
+    return NULL;
 }
 
 bool dma_configure_stream(const dma_config_t* config) {
-    return 1;
+    if (config == NULL || !valid_stream(config->instance, config->stream) || !valid_config(config)) {
+        return false;
+    }
+
+    const dma_instance_t instance = config->instance;
+    const dma_stream_t stream = config->stream;
+    const uint32_t bit = stream_bit(instance, stream);
+    // Drivers with a fixed stream keep it out of the pool, a claimed stream stays with its owner
+    if (take_stream(bit)) {
+        stream_owner[bit] = config->owner;
+    } else if (stream_owner[bit] != config->owner) {
+        return false;
+    }
+    stop_stream(instance, stream);
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+
+    // Route the peripheral request to this stream
+    const uint32_t mux_channel = (instance - DMA_INSTANCE_MIN) * DMAMUX_CHANNELS_PER_DMA + stream;
+    WRITE_FIELD(DMAMUX1_CxCR[mux_channel], DMAMUX1_CxCR_DMAREQ_ID, config->request_id);
+
+    // PSIZE always describes the peripheral side, MSIZE the memory side
+    const bool to_periph = (config->direction == MEM_TO_PERIPH);
+    const dma_data_size_t periph_size = to_periph ? config->dest_data_size : config->src_data_size;
+    const dma_data_size_t mem_size = to_periph ? config->src_data_size : config->dest_data_size;
+
+    WRITE_FIELDS(stream_cr[stream][instance],
+        FIELD_VAL(DMAx_S0CR_DIR, config->direction),
+        FIELD_VAL(DMAx_S0CR_PSIZE, periph_size),
+        FIELD_VAL(DMAx_S0CR_MSIZE, mem_size),
+        FIELD_VAL(DMAx_S0CR_PL, config->priority),
+        FIELD_CLR(DMAx_S0CR_PINC),
+        FIELD_SET(DMAx_S0CR_MINC),
+        FIELD_CLR(DMAx_S0CR_CIRC),
+        FIELD_CLR(DMAx_S0CR_DBM),
+        FIELD_CLR(DMAx_S0CR_PFCTRL),
+        FIELD_SET(DMAx_S0CR_TCIE),
+        FIELD_SET(DMAx_S0CR_TEIE),
+        FIELD_CLR(DMAx_S0CR_HTIE),
+        FIELD_CLR(DMAx_S0CR_DMEIE));
+
+    WRITE_FIELDS(DMAx_SxFCR[instance][stream],
+        FIELD_VAL(DMAx_SxFCR_DMDIS, config->fifo_enabled),
+        FIELD_VAL(DMAx_SxFCR_FTH, fifo_threshold_fth[config->fifo_threshold]),
+        FIELD_CLR(DMAx_SxFCR_FEIE));
+
+    stream_state[instance][stream].callback = config->callback;
+    stream_state[instance][stream].context = NULL;
+    stream_state[instance][stream].configured = true;
+
+    irq_enable(DMAx_STRx_IRQ_NUM[instance][stream]);
+    return true;
+}
+
+bool check_periph_dma_config_validity(periph_dma_config_t *dma_config) {
+    if (dma_config == NULL || !valid_stream(dma_config->instance, dma_config->stream)) {
+        return false;
+    }
+    if (dma_config->direction >= DMA_DIR_COUNT || dma_config->priority >= DMA_PRIORITY_COUNT ||
+        dma_config->src_data_size >= DMA_DATA_SIZE_COUNT ||
+        dma_config->dest_data_size >= DMA_DATA_SIZE_COUNT ||
+        dma_config->fifo_threshold >= DMA_FIFO_THRESHOLD_COUNT) {
+        return false;
+    }
+    return dma_config->fifo_enabled || dma_config->src_data_size == dma_config->dest_data_size;
+}
+
+bool dma_start_transfer(dma_transfer_t *dma_transfer) {
+    if (dma_transfer == NULL || !valid_stream(dma_transfer->instance, dma_transfer->stream)) {
+        return false;
+    }
+    const dma_instance_t instance = dma_transfer->instance;
+    const dma_stream_t stream = dma_transfer->stream;
+    rw_reg32_t cr = stream_cr[stream][instance];
+    if (!stream_state[instance][stream].configured || IS_FIELD_SET(cr, DMAx_S0CR_EN)) {
+        return false;
+    }
+    if (dma_transfer->src == NULL || dma_transfer->dest == NULL) {
+        return false;
+    }
+
+    const bool to_periph = (READ_FIELD(cr, DMAx_S0CR_DIR) == MEM_TO_PERIPH);
+    const uintptr_t periph_addr = to_periph ? (uintptr_t)dma_transfer->dest : (uintptr_t)dma_transfer->src;
+    const uintptr_t mem_addr = to_periph ? (uintptr_t)dma_transfer->src : (uintptr_t)dma_transfer->dest;
+
+    const size_t items = transfer_items(cr, periph_addr, mem_addr, dma_transfer->size);
+    if (items == 0) {
+        return false;
+    }
+
+    *DMAx_SxPAR[instance][stream] = (uint32_t)periph_addr;
+    *DMAx_SxM0AR[instance][stream] = (uint32_t)mem_addr;
+    WRITE_FIELD(DMAx_SxNDTR[instance][stream], DMAx_SxNDTR_NDT, items);
+    WRITE_FIELDS(cr,
+        FIELD_VAL(DMAx_S0CR_MINC, !dma_transfer->disable_mem_inc),
+        FIELD_CLR(DMAx_S0CR_CIRC),
+        FIELD_CLR(DMAx_S0CR_DBM),
+        FIELD_CLR(DMAx_S0CR_HTIE));
+
+    stream_state[instance][stream].event_callback = NULL;
+    stream_state[instance][stream].sg_left = 0;
+    stream_state[instance][stream].context = dma_transfer->context;
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+    SET_FIELD(cr, DMAx_S0CR_EN);
+    return true;
+}
+
+bool dma_start_sg(const dma_sg_transfer_t *sg) {
+    if (sg == NULL || !valid_stream(sg->instance, sg->stream)) {
+        return false;
+    }
+    const dma_instance_t instance = sg->instance;
+    const dma_stream_t stream = sg->stream;
+    rw_reg32_t cr = stream_cr[stream][instance];
+    if (!stream_state[instance][stream].configured || IS_FIELD_SET(cr, DMAx_S0CR_EN)) {
+        return false;
+    }
+    if (sg->periph == NULL || sg->iov == NULL || sg->iov_count == 0) {
+        return false;
+    }
+    // Every buffer is checked up front, so the IRQ can start each one without failing
+    const uintptr_t periph_addr = (uintptr_t)sg->periph;
+    for (size_t i = 0; i < sg->iov_count; i++) {
+        const uintptr_t base = (uintptr_t)sg->iov[i].base;
+        if (base == 0 || transfer_items(cr, periph_addr, base, sg->iov[i].size) == 0) {
+            return false;
+        }
+    }
+
+    *DMAx_SxPAR[instance][stream] = (uint32_t)periph_addr;
+    WRITE_FIELDS(cr,
+        FIELD_SET(DMAx_S0CR_MINC),
+        FIELD_CLR(DMAx_S0CR_CIRC),
+        FIELD_CLR(DMAx_S0CR_DBM),
+        FIELD_CLR(DMAx_S0CR_HTIE));
+
+    stream_state[instance][stream].event_callback = NULL;
+    stream_state[instance][stream].context = sg->context;
+    stream_state[instance][stream].sg_next = &sg->iov[1];
+    stream_state[instance][stream].sg_left = sg->iov_count - 1;
+    start_sg_buffer(instance, stream, &sg->iov[0]);
+    return true;
+}
+
+bool dma_start_continuous(const dma_continuous_t *continuous) {
+    if (continuous == NULL || !valid_stream(continuous->instance, continuous->stream)) {
+        return false;
+    }
+    const dma_instance_t instance = continuous->instance;
+    const dma_stream_t stream = continuous->stream;
+    rw_reg32_t cr = stream_cr[stream][instance];
+    if (!stream_state[instance][stream].configured || IS_FIELD_SET(cr, DMAx_S0CR_EN)) {
+        return false;
+    }
+    if (continuous->periph == NULL || continuous->buffers[0] == NULL || continuous->callback == NULL) {
+        return false;
+    }
+
+    // Both buffers use the same count, half transfer events need an even one
+    const bool double_buffer = (continuous->buffers[1] != NULL);
+    const uintptr_t periph_addr = (uintptr_t)continuous->periph;
+    const size_t items = transfer_items(cr, periph_addr, (uintptr_t)continuous->buffers[0], continuous->size);
+    if (items == 0 || (continuous->half_transfer && items % 2 != 0)) {
+        return false;
+    }
+    if (double_buffer && transfer_items(cr, periph_addr, (uintptr_t)continuous->buffers[1], continuous->size) != items) {
+        return false;
+    }
+
+    *DMAx_SxPAR[instance][stream] = (uint32_t)periph_addr;
+    *DMAx_SxM0AR[instance][stream] = (uint32_t)(uintptr_t)continuous->buffers[0];
+    if (double_buffer) {
+        *DMAx_SxM1AR[instance][stream] = (uint32_t)(uintptr_t)continuous->buffers[1];
+    }
+    WRITE_FIELD(DMAx_SxNDTR[instance][stream], DMAx_SxNDTR_NDT, items);
+    WRITE_FIELDS(cr,
+        FIELD_SET(DMAx_S0CR_MINC),
+        FIELD_SET(DMAx_S0CR_CIRC),
+        FIELD_VAL(DMAx_S0CR_DBM, double_buffer),
+        FIELD_CLR(DMAx_S0CR_CT),
+        FIELD_VAL(DMAx_S0CR_HTIE, continuous->half_transfer));
+
+    stream_state[instance][stream].sg_left = 0;
+    stream_state[instance][stream].event_callback = continuous->callback;
+    stream_state[instance][stream].context = continuous->context;
+    stream_state[instance][stream].buffer_size = continuous->size;
+    stream_state[instance][stream].half_events = continuous->half_transfer;
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+    SET_FIELD(cr, DMAx_S0CR_EN);
+    return true;
+}
+
+bool dma_swap_buffer(dma_instance_t instance, dma_stream_t stream, void *buffer) {
+    if (!valid_stream(instance, stream) || buffer == NULL) {
+        return false;
+    }
+    rw_reg32_t cr = stream_cr[stream][instance];
+    if (stream_state[instance][stream].event_callback == NULL || IS_FIELD_CLR(cr, DMAx_S0CR_DBM)) {
+        return false;
+    }
+    const uintptr_t periph_addr = *DMAx_SxPAR[instance][stream];
+    if (transfer_items(cr, periph_addr, (uintptr_t)buffer, stream_state[instance][stream].buffer_size) == 0) {
+        return false;
+    }
+    // Only the address register not in use may be written while the stream runs
+    if (IS_FIELD_SET(cr, DMAx_S0CR_CT)) {
+        *DMAx_SxM0AR[instance][stream] = (uint32_t)(uintptr_t)buffer;
+    } else {
+        *DMAx_SxM1AR[instance][stream] = (uint32_t)(uintptr_t)buffer;
+    }
+    return true;
+}
+
+bool dma_stop_transfer(dma_instance_t instance, dma_stream_t stream) {
+    if (!valid_stream(instance, stream)) {
+        return false;
+    }
+    // Stopped with its flags cleared first, so an IRQ in between still sees the running transfer's
+    // state and no flags, rather than a one-shot completion
+    stop_stream(instance, stream);
+    clear_stream_flags(instance, stream, stream_flag_mask(stream));
+    stream_state[instance][stream].event_callback = NULL;
+    stream_state[instance][stream].sg_left = 0;
+    // A leased stream goes to the next waiting lease or back to the pool
+    if (stream_state[instance][stream].lease != NULL) {
+        end_lease(instance, stream);
+    }
+    return true;
 }
-inline static bool check_periph_dma_config_validity(periph_dma_config_t *dma_config) {
-    return 1;
+
+enum ti_errc_t dma_claim_stream(dma_priority_t priority_class, const void *owner, dma_stream_id_t *stream) {
+    if (stream == NULL || priority_class >= DMA_PRIORITY_COUNT) {
+        return TI_ERRC_INVALID_ARG;
+    }
+    // High classes take the lowest free stream number, low classes the highest
+    const bool high = priority_class >= DMA_PRIORITY_HIGH;
+    uint32_t free = __atomic_load_n(&free_streams, __ATOMIC_RELAXED);
+    uint32_t bit;
+    do {
+        if (free == 0) {
+            return TI_ERRC_DMA_NO_AVAIL_STREAM;
+        }
+        bit = high ? (uint32_t)__builtin_ctz(free) : 31U - (uint32_t)__builtin_clz(free);
+    } while (!__atomic_compare_exchange_n(&free_streams, &free, free & ~(1U << bit), true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    stream_owner[bit] = owner;
+    stream->instance = (dma_instance_t)(DMA_INSTANCE_MIN + bit % 2);
+    stream->stream = (dma_stream_t)(bit / 2);
+    return TI_ERRC_NONE;
+}
+
+enum ti_errc_t dma_release_stream(dma_stream_id_t stream, const void *owner) {
+    if (!valid_stream(stream.instance, stream.stream)) {
+        return TI_ERRC_INVALID_ARG;
+    }
+    const uint32_t bit = stream_bit(stream.instance, stream.stream);
+    if ((__atomic_load_n(&free_streams, __ATOMIC_RELAXED) & (1U << bit)) != 0 || stream_owner[bit] != owner) {
+        return TI_ERRC_INVALID_ARG;
+    }
+
+    reset_stream(stream.instance, stream.stream);
+
+    // A waiting lease takes the stream before it goes back to the pool
+    dma_lease_t *failed = NULL;
+    const uint32_t primask = irq_lock();
+    if (!pass_to_pending_lease(stream.instance, stream.stream, &failed)) {
+        stream_owner[bit] = NULL;
+        __atomic_fetch_or(&free_streams, 1U << bit, __ATOMIC_RELEASE);
+    }
+    irq_unlock(primask);
+
+    // Waiting leases that could not start report it, outside the masked section
+    while (failed != NULL) {
+        dma_lease_t *const lease = failed;
+        failed = lease->next;
+        if (lease->config.callback != NULL) {
+            lease->config.callback(false, lease->transfer.context);
+        }
+    }
+    return TI_ERRC_NONE;
+}
+
+enum ti_errc_t dma_lease_transfer(dma_lease_t *lease) {
+    if (lease == NULL || !valid_config(&lease->config)) {
+        return TI_ERRC_INVALID_ARG;
+    }
+
+    // Claim and queue under the lock, dma_release_stream() checks the queue under it too, so a
+    // stream released in between cannot be missed
+    const uint32_t primask = irq_lock();
+    dma_stream_id_t id;
+    if (dma_claim_stream(lease->config.priority, &lease_owner, &id) != TI_ERRC_NONE) {
+        dma_lease_t **link = &pending_leases;
+        while (*link != NULL && (*link)->config.priority >= lease->config.priority) {
+            link = &(*link)->next;
+        }
+        lease->next = *link;
+        *link = lease;
+        irq_unlock(primask);
+        return TI_ERRC_NONE;
+    }
+    irq_unlock(primask);
+
+    if (!start_lease(lease, id.instance, id.stream)) {
+        stream_state[id.instance][id.stream].lease = NULL;
+        dma_release_stream(id, &lease_owner);
+        return TI_ERRC_INVALID_ARG;
+    }
+    return TI_ERRC_NONE;
 }
 
-bool dma_start_transfer( dma_transfer_t *dma_transfer) {
-    return 1;
-}
\ No newline at end of file
+/**************************************************************************************************
+ * @section IRQ Handlers
+ **************************************************************************************************/
+
+void dma_str0_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_0); }
+void dma_str1_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_1); }
+void dma_str2_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_2); }
+void dma_str3_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_3); }
+void dma_str4_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_4); }
+void dma_str5_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_5); }
+void dma_str6_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_6); }
+void dma1_str7_irq_handler() { dma_stream_irq(DMA1, DMA_STREAM_7); }
+void dma2_str0_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_0); }
+void dma2_str1_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_1); }
+void dma2_str2_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_2); }
+void dma2_str3_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_3); }
+void dma2_str4_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_4); }
+void dma2_str5_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_5); }
+void dma2_str6_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_6); }
+void dma2_str7_irq_handler() { dma_stream_irq(DMA2, DMA_STREAM_7); }
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include "../util/error.h"
+#include "../peripheral/errc.h"
 
 /**************************************************************************************************
  * @section Type Definitions
@@ -102,6 +103,8 @@ typedef struct {
     dma_fifo_threshold_t fifo_threshold; // FIFO threshold for DMA1/2 (e.g., DMA_FIFO_THRESHOLD_FULL)
     // Callback for this stream
     dma_callback_t   callback;
+    // Token the stream was claimed with (dma_claim_stream()), NULL for a fixed stream
+    const void       *owner;
 } dma_config_t;
 
 /**
@@ -139,6 +142,61 @@ typedef struct {
     bool disable_mem_inc; // Useful for dummy spi transactions
 } dma_transfer_t;
 
+// Events of a continuous (circular or double-buffer) transfer
+typedef enum {
+    DMA_EVENT_HALF_TRANSFER,     // The first half of the active buffer is done
+    DMA_EVENT_TRANSFER_COMPLETE, // A buffer (or its second half) is done
+    DMA_EVENT_ERROR,             // Transfer error, the stream has stopped
+} dma_event_t;
+
+/**
+ * @brief Callback for continuous transfers, runs from the stream's IRQ.
+ * @param event What happened.
+ * @param done The region of the buffer the DMA just finished with (NULL for errors), free
+ *             to process until the DMA comes back around to it.
+ * @param size Size of @p done in bytes.
+ * @param context The context passed with the transfer.
+ */
+typedef void (*dma_event_callback_t)(dma_event_t event, void *done, size_t size, void *context);
+
+/**
+ * @brief Continuous transfer config (see dma_start_continuous()).
+ *
+ * With one buffer the stream runs in circular mode over it, with two it runs in hardware
+ * double-buffer mode and alternates between them.
+ */
+typedef struct {
+    dma_instance_t instance;
+    dma_stream_t stream;
+    volatile void *periph;        // Peripheral data register
+    void *buffers[2];             // buffers[1] is NULL for circular mode
+    size_t size;                  // Size of each buffer in bytes
+    bool half_transfer;           // Report each buffer in halves (DMA_EVENT_HALF_TRANSFER)
+    dma_event_callback_t callback;
+    void *context;
+} dma_continuous_t;
+
+// One buffer of a scatter-gather list
+typedef struct {
+    void *base;
+    size_t size; // In bytes, not 0
+} dma_iovec_t;
+
+/**
+ * @brief Scatter-gather transfer config (see dma_start_sg()).
+ *
+ * Moves a list of buffers through one peripheral register as if they were one buffer: gathered
+ * in order towards a peripheral, or scattered in order from it, depending on the stream's direction.
+ */
+typedef struct {
+    dma_instance_t instance;
+    dma_stream_t stream;
+    volatile void *periph;    // Peripheral data register
+    const dma_iovec_t *iov;   // The buffers, the list must stay valid until the callback
+    size_t iov_count;
+    void *context;
+} dma_sg_transfer_t;
+
 // Used to track rx/tx stream/instance for peripheral instances
 typedef struct {
     dma_instance_t rx_instance; // TODO: Perhaps simplify this so only one instance
@@ -147,6 +205,24 @@ typedef struct {
     dma_stream_t tx_stream;
 } dma_periph_streaminfo_t;
 
+// A DMA1/DMA2 stream, as handed out by dma_claim_stream()
+typedef struct {
+    dma_instance_t instance;
+    dma_stream_t stream;
+} dma_stream_id_t;
+
+/**
+ * @brief A transfer that borrows a stream only while it runs (see dma_lease_transfer()).
+ *
+ * Owned by the caller and must stay valid until its callback has run. The instance, stream
+ * and owner fields of config and transfer are filled in when a stream is leased.
+ */
+typedef struct dma_lease_t {
+    dma_config_t config;
+    dma_transfer_t transfer;
+    struct dma_lease_t *next; // Private, links leases waiting for a stream
+} dma_lease_t;
+
 /**************************************************************************************************
 * @section Public Functions
 **************************************************************************************************/
@@ -159,26 +235,109 @@ tal_err_t *dma_init(void);
 /**
  * @brief Configures a specific DMA stream to a specific request ID, and enables it.
  * This allocates and sets up the chosen stream based on the provided configuration.
+ * A stream that was still free is taken out of the pool dma_claim_stream() hands out, a
+ * claimed one is only configured for the owner it was claimed with (config->owner).
  * @param config Pointer to the configuration structure.
- * @return true if the stream was successfully configured, false otherwise.
+ * @return true if the stream was successfully configured, false otherwise (also when the
+ *         stream belongs to another owner, which it is then left to).
  */
 bool dma_configure_stream(const dma_config_t* config);
 
 /**
  * @brief Starts a DMA transfer for the specified stream.
  * This function initiates the transfer based on the previously configured settings.
+ * The stream's callback runs from its IRQ when the transfer completes or fails.
  * @param instance The DMA instance (DMA1, DMA2, MDMA, BDMA).
  * @param stream The specific stream to start.
  * @param src Pointer to the source data buffer.
  * @param dest Pointer to the destination data buffer.
- * @param size Number of bytes to transfer.
- * @return bool, whether the transfer was successfully started.
+ * @param size Number of bytes to transfer, a multiple of both data sizes and at most
+ *             65535 peripheral-sized items.
+ * @return bool, whether the transfer was successfully started. Fails if the stream is
+ *         not configured or still busy.
  */
 bool dma_start_transfer( dma_transfer_t *dma_transfer);
 
+/**
+ * @brief Starts a scatter-gather transfer on a configured stream.
+ * Each buffer runs as a transfer of its own, and the stream IRQ starts the next one as soon as
+ * the previous completes, so there is no copy into a contiguous buffer. The peripheral sees a
+ * short pause between buffers, harmless when sending (the peripheral waits for data) but a
+ * possible overrun when receiving at high rates. The stream's callback runs once, after the last
+ * buffer or the first error.
+ * @param sg The transfer.
+ * @return bool, whether the transfer was started. Fails if the stream is not configured or busy,
+ *         or a buffer does not fit the data sizes (as for dma_start_transfer()).
+ */
+bool dma_start_sg(const dma_sg_transfer_t *sg);
+
 /**
  * @brief Checks the validity of a DMA peripheral config
  * @param config The config to check.
  * @return bool Whether the config is valid.
  */
-inline static bool check_periph_dma_config_validity(periph_dma_config_t *dma_config);
\ No newline at end of file
+bool check_periph_dma_config_validity(periph_dma_config_t *dma_config);
+
+/**
+ * @brief Claims a free DMA1/DMA2 stream.
+ * Streams are arbitrated by priority level, then by stream number (lower wins), so high and
+ * very high priority classes get the lowest free stream number and low and medium ones the
+ * highest, alternating between DMA1 and DMA2 for the same stream number. Safe to call from
+ * interrupts.
+ * @param priority_class The priority the stream will be configured with.
+ * @param owner Token identifying the claimer (e.g. the driver's context), checked on release.
+ * @param stream Output, the claimed stream.
+ * @return TI_ERRC_NONE, or TI_ERRC_DMA_NO_AVAIL_STREAM if every stream is in use.
+ */
+enum ti_errc_t dma_claim_stream(dma_priority_t priority_class, const void *owner, dma_stream_id_t *stream);
+
+/**
+ * @brief Stops a claimed stream and returns it to the pool, or starts a waiting lease on it.
+ * @param stream The stream to release.
+ * @param owner The token the stream was claimed with.
+ * @return TI_ERRC_NONE, or TI_ERRC_INVALID_ARG if the stream is not claimed by @p owner.
+ */
+enum ti_errc_t dma_release_stream(dma_stream_id_t stream, const void *owner);
+
+/**
+ * @brief Runs a transfer on a stream leased for just this transfer.
+ * Lets more peripherals share the streams than there are streams: a stream is claimed with
+ * lease->config.priority, configured and started, and released again before the callback
+ * runs. If every stream is in use, the lease waits (highest priority first, then in order)
+ * and starts on the next stream that is released or whose leased transfer finishes. A waiting
+ * transfer that cannot start then reports failure through its callback.
+ * @param lease The transfer, the instance and stream fields are ignored.
+ * @return TI_ERRC_NONE if the transfer started or is waiting, TI_ERRC_INVALID_ARG otherwise.
+ */
+enum ti_errc_t dma_lease_transfer(dma_lease_t *lease);
+
+/**
+ * @brief Starts a gap-free circular or double-buffer transfer on a configured stream.
+ * The stream runs until dma_stop_transfer() or an error, reporting each finished buffer
+ * (or half buffer) through the continuous callback instead of the stream's dma_callback_t.
+ * @param continuous The transfer, the stream must have been set up with dma_configure_stream().
+ * @return bool, whether the transfer was started. Fails if the stream is not configured or
+ *         busy, or the size does not fit the data sizes (an even number of peripheral-sized
+ *         items, at most 65535, when half_transfer is set).
+ */
+bool dma_start_continuous(const dma_continuous_t *continuous);
+
+/**
+ * @brief Replaces the idle buffer of a running double-buffer transfer, without stopping it.
+ * The idle buffer is the one last reported done, so the call belongs in (or shortly after)
+ * the DMA_EVENT_TRANSFER_COMPLETE callback; the new buffer is used from the next switch.
+ * @param instance The DMA instance.
+ * @param stream The stream running the transfer.
+ * @param buffer The new buffer, the same size as the one it replaces.
+ * @return bool, whether the buffer was swapped. Fails if the stream is not running a
+ *         double-buffer transfer.
+ */
+bool dma_swap_buffer(dma_instance_t instance, dma_stream_t stream, void *buffer);
+
+/**
+ * @brief Stops whatever transfer a stream is running, without a callback.
+ * @param instance The DMA instance.
+ * @param stream The stream to stop.
+ * @return bool, whether the stream is valid.
+ */
+bool dma_stop_transfer(dma_instance_t instance, dma_stream_t stream);
@@ -20,6 +20,7 @@
  */
 
 #include "interrupt.h"
+#include "internal/mmio.h"
 
 /**************************************************************************************************
  * @section Miscellaneous Constants
@@ -278,3 +279,15 @@ const int32_t FDCANx_ITx_IRQ_NUM[3][2] = {
     [1] = 22,
   },
 };
+
+/**************************************************************************************************
+ * @section NVIC Functions
+ **************************************************************************************************/
+
+void irq_enable(int32_t irq_num) {
+  *NVIC_ISERx[irq_num / 32] = 1U << (irq_num % 32);
+}
+
+void irq_disable(int32_t irq_num) {
+  *NVIC_ICERx[irq_num / 32] = 1U << (irq_num % 32);
+}
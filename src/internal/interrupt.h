@@ -317,4 +317,20 @@ extern const int32_t USARTx_IRQ_NUM[7];         /** @brief USART global interrup
 extern const int32_t UARTx_IRQ_NUM[9];          /** @brief UART global interrupt. */
 extern const int32_t TIMx_CC_IRQ_NUM[9];        /** @brief TIM capture/compare global interrupt. */
 extern const int32_t DMAx_STRx_IRQ_NUM[3][8];   /** @brief DMA1 stream x interrupt. */
-extern const int32_t FDCANx_ITx_IRQ_NUM[3][2];  /** @brief FDCAN1 interrupt x. */
\ No newline at end of file
+extern const int32_t FDCANx_ITx_IRQ_NUM[3][2];  /** @brief FDCAN1 interrupt x. */
+
+/**************************************************************************************************
+ * @section NVIC Functions
+ **************************************************************************************************/
+
+/**
+ * @brief Enables an IRQ in the NVIC.
+ * @param irq_num (int32_t) The IRQ number (not exception number) to enable.
+ */
+void irq_enable(int32_t irq_num);
+
+/**
+ * @brief Disables an IRQ in the NVIC.
+ * @param irq_num (int32_t) The IRQ number (not exception number) to disable.
+ */
+void irq_disable(int32_t irq_num);
@@ -0,0 +1,413 @@
+/**
+ * This file is part of the Titan Flight Computer Project
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file src/internal/mdma.c
+ * @authors UW SARP
+ * @brief Memory-to-memory copy engine on the MDMA.
+ */
+
+#include "mdma.h"
+#include "cache.h"
+#include "interrupt.h"
+#include "internal/mmio/mdma.h"
+#include "internal/mmio/rcc.h"
+
+/**************************************************************************************************
+ * @section Private Data
+ **************************************************************************************************/
+
+#define MDMA_CHANNEL_COUNT 16
+
+#if MDMA_COPY_CHANNELS < 1 || MDMA_COPY_CHANNELS > MDMA_CHANNEL_COUNT
+#error "MDMA_COPY_CHANNELS must be between 1 and 16"
+#endif
+
+// Channel status and flag clear registers, which are separate registers rather than an array in
+// mmio. Every channel's flags sit at the positions of channel 0's, so the C0 fields are used for all.
+static ro_reg32_t const channel_isr[MDMA_CHANNEL_COUNT] = {
+    MDMA_MDMA_C0ISR,  MDMA_MDMA_C1ISR,  MDMA_MDMA_C2ISR,  MDMA_MDMA_C3ISR,
+    MDMA_MDMA_C4ISR,  MDMA_MDMA_C5ISR,  MDMA_MDMA_C6ISR,  MDMA_MDMA_C7ISR,
+    MDMA_MDMA_C8ISR,  MDMA_MDMA_C9ISR,  MDMA_MDMA_C10ISR, MDMA_MDMA_C11ISR,
+    MDMA_MDMA_C12ISR, MDMA_MDMA_C13ISR, MDMA_MDMA_C14ISR, MDMA_MDMA_C15ISR,
+};
+static rw_reg32_t const channel_ifcr[MDMA_CHANNEL_COUNT] = {
+    MDMA_MDMA_C0IFCR,  MDMA_MDMA_C1IFCR,  MDMA_MDMA_C2IFCR,  MDMA_MDMA_C3IFCR,
+    MDMA_MDMA_C4IFCR,  MDMA_MDMA_C5IFCR,  MDMA_MDMA_C6IFCR,  MDMA_MDMA_C7IFCR,
+    MDMA_MDMA_C8IFCR,  MDMA_MDMA_C9IFCR,  MDMA_MDMA_C10IFCR, MDMA_MDMA_C11IFCR,
+    MDMA_MDMA_C12IFCR, MDMA_MDMA_C13IFCR, MDMA_MDMA_C14IFCR, MDMA_MDMA_C15IFCR,
+};
+
+// Every flag of a channel, at the positions of both the ISR and the IFCR
+#define CHANNEL_FLAGS (MDMA_MDMA_C0ISR_TEIF0.msk | MDMA_MDMA_C0ISR_CTCIF0.msk | \
+                       MDMA_MDMA_C0ISR_BRTIF0.msk | MDMA_MDMA_C0ISR_BTIF0.msk | MDMA_MDMA_C0ISR_TCIF0.msk)
+
+// SINC/DINC encodings
+#define ADDR_FIXED 0
+#define ADDR_INCREMENT 2
+
+// TRGM encoding where one software request runs the whole chain
+#define TRIGGER_WHOLE_LIST 3
+
+// Largest buffer (TLEN + 1 bytes) moved per request, 128 bytes
+#define TLEN_MAX 127
+
+// Tightly coupled memories, which the MDMA reaches through its AHB port (words at most)
+#define ITCM_END 0x00010000U
+#define DTCM_START 0x20000000U
+#define DTCM_END 0x20020000U
+
+// Per-channel state, written when a chain starts and read by the IRQ
+typedef struct {
+    mdma_callback_t callback;
+    void *context;
+    mdma_desc_t *descs; // Chain running on the channel
+    size_t count;
+    mdma_desc_t nodes[2]; // Chain of mdma_memcpy()/mdma_memset(): the repeated blocks, then the rest
+    uint64_t pattern;     // Source of mdma_memset()
+} mdma_channel_state_t;
+
+static mdma_channel_state_t channel_state[MDMA_COPY_CHANNELS];
+
+// Free channels, one bit each
+#define ALL_CHANNELS_FREE ((1U << MDMA_COPY_CHANNELS) - 1U)
+static uint32_t free_channels = ALL_CHANNELS_FREE;
+
+// Lets the CPU copies access bytes as words without breaking strict aliasing
+typedef uint32_t __attribute__((may_alias)) word_t;
+
+/**************************************************************************************************
+ * @section Private Functions
+ **************************************************************************************************/
+
+static bool on_tcm(uintptr_t addr) {
+    return addr < ITCM_END || (addr >= DTCM_START && addr < DTCM_END);
+}
+
+// Takes the lowest free channel, returns false if every channel is busy
+static bool take_channel(uint32_t *channel) {
+    uint32_t free = __atomic_load_n(&free_channels, __ATOMIC_RELAXED);
+    do {
+        if (free == 0) {
+            return false;
+        }
+        *channel = (uint32_t)__builtin_ctz(free);
+    } while (!__atomic_compare_exchange_n(&free_channels, &free, free & ~(1U << *channel), true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+    return true;
+}
+
+// Returns a channel taken with take_channel()
+static void release_channel(uint32_t channel) {
+    __atomic_fetch_or(&free_channels, 1U << channel, __ATOMIC_RELEASE);
+}
+
+// Encodes a transfer of size bytes into a descriptor. A fill reads the same source address throughout.
+static bool build_desc(mdma_desc_t *desc, uintptr_t dest, uintptr_t src, size_t size, bool fill) {
+    if (desc == NULL || dest == 0 || src == 0 || size == 0 || size > MDMA_MAX_SIZE) {
+        return false;
+    }
+    // Larger transfers repeat a full block, the addresses carry on from where each block ended
+    size_t block = size;
+    uint32_t repeats = 0;
+    if (size > MDMA_BLOCK_SIZE) {
+        if (size % MDMA_BLOCK_SIZE != 0) {
+            return false;
+        }
+        block = MDMA_BLOCK_SIZE;
+        repeats = size / MDMA_BLOCK_SIZE - 1;
+    }
+
+    // The AHB port cannot hold an address fixed, nor move double words
+    const bool src_tcm = on_tcm(src);
+    const bool dest_tcm = on_tcm(dest);
+    if (fill && src_tcm) {
+        return false;
+    }
+    // Widest item both addresses and the size are aligned to
+    const uintptr_t align = dest | size | (fill ? 0 : src);
+    uint32_t log_width = (src_tcm || dest_tcm) ? 2 : 3;
+    while (log_width > 0 && align % (1U << log_width) != 0) {
+        log_width--;
+    }
+
+    WRITE_WO_FIELDS(&desc->tcr,
+        FIELD_VAL(MDMA_MDMA_CxTCR_SINC, fill ? ADDR_FIXED : ADDR_INCREMENT),
+        FIELD_VAL(MDMA_MDMA_CxTCR_DINC, ADDR_INCREMENT),
+        FIELD_VAL(MDMA_MDMA_CxTCR_SSIZE, log_width),
+        FIELD_VAL(MDMA_MDMA_CxTCR_DSIZE, log_width),
+        FIELD_VAL(MDMA_MDMA_CxTCR_SINCOS, log_width),
+        FIELD_VAL(MDMA_MDMA_CxTCR_DINCOS, log_width),
+        FIELD_VAL(MDMA_MDMA_CxTCR_TLEN, TLEN_MAX),
+        FIELD_VAL(MDMA_MDMA_CxTCR_TRGM, TRIGGER_WHOLE_LIST),
+        FIELD_SET(MDMA_MDMA_CxTCR_SWRM),
+        FIELD_SET(MDMA_MDMA_CxTCR_BWM));
+    WRITE_WO_FIELDS(&desc->bndtr,
+        FIELD_VAL(MDMA_MDMA_CxBNDTR_BNDT, block),
+        FIELD_VAL(MDMA_MDMA_CxBNDTR_BRC, repeats));
+    desc->sar = (uint32_t)src;
+    desc->dar = (uint32_t)dest;
+    desc->brur = 0;
+    desc->lar = 0;
+    WRITE_WO_FIELDS(&desc->tbr,
+        FIELD_VAL(MDMA_MDMA_CxTBR_SBUS, src_tcm),
+        FIELD_VAL(MDMA_MDMA_CxTBR_DBUS, dest_tcm));
+    desc->reserved = 0;
+    desc->mar = 0;
+    desc->mdr = 0;
+    return true;
+}
+
+// Bytes a descriptor moves
+static size_t desc_size(const mdma_desc_t *desc) {
+    const size_t block = (desc->bndtr & MDMA_MDMA_CxBNDTR_BNDT.msk) >> MDMA_MDMA_CxBNDTR_BNDT.pos;
+    const size_t repeats = (desc->bndtr & MDMA_MDMA_CxBNDTR_BRC.msk) >> MDMA_MDMA_CxBNDTR_BRC.pos;
+    return block * (repeats + 1);
+}
+
+// Makes a chain and its sources visible to the MDMA, and keeps dirty lines off its destinations
+static void cache_before(const mdma_desc_t *descs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const size_t size = desc_size(&descs[i]);
+        const bool fill = ((descs[i].tcr & MDMA_MDMA_CxTCR_SINC.msk) >> MDMA_MDMA_CxTCR_SINC.pos) == ADDR_FIXED;
+        cache_clean_range((const void*)(uintptr_t)descs[i].sar, fill ? sizeof(uint64_t) : size);
+        cache_clean_invalidate_range((void*)(uintptr_t)descs[i].dar, size);
+    }
+    cache_clean_range(descs, count * sizeof(mdma_desc_t));
+}
+
+// Drops lines of the destinations the CPU may have speculatively read while the chain ran
+static void cache_after(const mdma_desc_t *descs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        cache_invalidate_range((void*)(uintptr_t)descs[i].dar, desc_size(&descs[i]));
+    }
+}
+
+// Links a chain in array order and starts it on a taken channel
+static void start_chain(uint32_t channel, mdma_desc_t *descs, size_t count, mdma_callback_t callback,
+                        void *context) {
+    for (size_t i = 0; i + 1 < count; i++) {
+        descs[i].lar = (uint32_t)(uintptr_t)&descs[i + 1];
+    }
+    descs[count - 1].lar = 0;
+
+    channel_state[channel].callback = callback;
+    channel_state[channel].context = context;
+    channel_state[channel].descs = descs;
+    channel_state[channel].count = count;
+    cache_before(descs, count);
+
+    rw_reg32_t cr = MDMA_MDMA_CxCR[channel];
+    WRITE_FIELDS(cr,
+        FIELD_CLR(MDMA_MDMA_CxCR_EN),
+        FIELD_SET(MDMA_MDMA_CxCR_TEIE),
+        FIELD_SET(MDMA_MDMA_CxCR_CTCIE),
+        FIELD_CLR(MDMA_MDMA_CxCR_BRTIE),
+        FIELD_CLR(MDMA_MDMA_CxCR_BTIE),
+        FIELD_CLR(MDMA_MDMA_CxCR_TCIE),
+        FIELD_VAL(MDMA_MDMA_CxCR_PL, 0),
+        FIELD_CLR(MDMA_MDMA_CxCR_BEX),
+        FIELD_CLR(MDMA_MDMA_CxCR_HEX),
+        FIELD_CLR(MDMA_MDMA_CxCR_WEX));
+    *channel_ifcr[channel] = CHANNEL_FLAGS;
+
+    // The first descriptor goes straight into the registers, the MDMA loads the rest through LAR
+    *MDMA_MDMA_CxTCR[channel] = descs[0].tcr;
+    *MDMA_MDMA_CxBNDTR[channel] = descs[0].bndtr;
+    *MDMA_MDMA_CxSAR[channel] = descs[0].sar;
+    *MDMA_MDMA_CxDAR[channel] = descs[0].dar;
+    *MDMA_MDMA_CxBRUR[channel] = descs[0].brur;
+    *MDMA_MDMA_CxLAR[channel] = descs[0].lar;
+    *MDMA_MDMA_CxTBR[channel] = descs[0].tbr;
+    *MDMA_MDMA_CxMAR[channel] = descs[0].mar;
+    *MDMA_MDMA_CxMDR[channel] = descs[0].mdr;
+
+    SET_FIELD(cr, MDMA_MDMA_CxCR_EN);
+    SET_FIELD(cr, MDMA_MDMA_CxCR_SWRQ);
+}
+
+// Runs a copy, or a fill with *fill if it is not NULL, on a free channel, as the repeated full
+// blocks followed by the rest. Returns false if the CPU should do it instead.
+static bool start_transfer(uintptr_t dest, uintptr_t src, size_t size, const uint8_t *fill,
+                           mdma_callback_t callback, void *context) {
+    uint32_t channel;
+    if (size < MDMA_CPU_THRESHOLD || size == 0 || !take_channel(&channel)) {
+        return false;
+    }
+    mdma_channel_state_t *state = &channel_state[channel];
+    if (fill != NULL) {
+        state->pattern = MDMA_FILL_PATTERN(*fill);
+        src = (uintptr_t)&state->pattern;
+    }
+
+    const size_t blocks = size - size % MDMA_BLOCK_SIZE;
+    size_t count = 0;
+    bool built = true;
+    if (blocks > 0) {
+        built = build_desc(&state->nodes[count++], dest, src, blocks, fill != NULL);
+    }
+    if (built && blocks < size) {
+        const uintptr_t rest_src = (fill != NULL) ? src : src + blocks;
+        built = build_desc(&state->nodes[count++], dest + blocks, rest_src, size - blocks, fill != NULL);
+    }
+    // E.g. a fill pattern the MDMA cannot read in place, never start the channel's old descriptors
+    if (!built) {
+        release_channel(channel);
+        return false;
+    }
+    start_chain(channel, state->nodes, count, callback, context);
+    return true;
+}
+
+// Completion/error handling of one channel
+static void channel_irq(uint32_t channel) {
+    const uint32_t flags = *channel_isr[channel] & CHANNEL_FLAGS;
+    *channel_ifcr[channel] = flags;
+    const bool error = (flags & MDMA_MDMA_C0ISR_TEIF0.msk) != 0;
+    const bool complete = (flags & MDMA_MDMA_C0ISR_CTCIF0.msk) != 0;
+    if (!error && !complete) {
+        return;
+    }
+    if (error) {
+        CLR_FIELD(MDMA_MDMA_CxCR[channel], MDMA_MDMA_CxCR_EN);
+    }
+
+    mdma_channel_state_t *state = &channel_state[channel];
+    const mdma_callback_t callback = state->callback;
+    void *const context = state->context;
+    cache_after(state->descs, state->count);
+    state->descs = NULL;
+    release_channel(channel);
+    if (callback != NULL) {
+        callback(!error, context);
+    }
+}
+
+/**************************************************************************************************
+ * @section Public Functions
+ **************************************************************************************************/
+
+tal_err_t *mdma_init(void) {
+    SET_FIELD(RCC_AHB3ENR, RCC_AHB3ENR_MDMAEN);
+    irq_enable(MDMA_IRQ_NUM);
+    return NULL;
+}
+
+bool mdma_memcpy(void *dest, const void *src, size_t size, mdma_callback_t callback, void *context) {
+    if (dest == NULL || src == NULL || size > MDMA_MAX_SIZE) {
+        return false;
+    }
+    if (!start_transfer((uintptr_t)dest, (uintptr_t)src, size, NULL, callback, context)) {
+        mdma_cpu_memcpy(dest, src, size);
+        if (callback != NULL) {
+            callback(true, context);
+        }
+    }
+    return true;
+}
+
+bool mdma_memset(void *dest, uint8_t value, size_t size, mdma_callback_t callback, void *context) {
+    if (dest == NULL || size > MDMA_MAX_SIZE) {
+        return false;
+    }
+    if (!start_transfer((uintptr_t)dest, 0, size, &value, callback, context)) {
+        mdma_cpu_memset(dest, value, size);
+        if (callback != NULL) {
+            callback(true, context);
+        }
+    }
+    return true;
+}
+
+bool mdma_desc_copy(mdma_desc_t *desc, void *dest, const void *src, size_t size) {
+    return build_desc(desc, (uintptr_t)dest, (uintptr_t)src, size, false);
+}
+
+bool mdma_desc_fill(mdma_desc_t *desc, void *dest, const uint64_t *pattern, size_t size) {
+    return build_desc(desc, (uintptr_t)dest, (uintptr_t)pattern, size, true);
+}
+
+bool mdma_submit(mdma_desc_t *descs, size_t count, mdma_callback_t callback, void *context) {
+    uint32_t channel;
+    if (descs == NULL || count == 0 || !take_channel(&channel)) {
+        return false;
+    }
+    start_chain(channel, descs, count, callback, context);
+    return true;
+}
+
+void mdma_cpu_memcpy(void *dest, const void *src, size_t size) {
+    uint8_t *d = dest;
+    const uint8_t *s = src;
+    // Words only line up when both pointers are equally far from a word boundary
+    if ((((uintptr_t)d ^ (uintptr_t)s) & 3U) == 0) {
+        for (; ((uintptr_t)d & 3U) != 0 && size > 0; size--) {
+            *d++ = *s++;
+        }
+        word_t *dw = (word_t*)d;
+        const word_t *sw = (const word_t*)s;
+        // Four loads before four stores, which the M7 pairs into LDRD/STRD
+        for (; size >= 16; size -= 16, dw += 4, sw += 4) {
+            const uint32_t w0 = sw[0], w1 = sw[1], w2 = sw[2], w3 = sw[3];
+            dw[0] = w0;
+            dw[1] = w1;
+            dw[2] = w2;
+            dw[3] = w3;
+        }
+        for (; size >= 4; size -= 4) {
+            *dw++ = *sw++;
+        }
+        d = (uint8_t*)dw;
+        s = (const uint8_t*)sw;
+    }
+    while (size-- > 0) {
+        *d++ = *s++;
+    }
+}
+
+void mdma_cpu_memset(void *dest, uint8_t value, size_t size) {
+    uint8_t *d = dest;
+    for (; ((uintptr_t)d & 3U) != 0 && size > 0; size--) {
+        *d++ = value;
+    }
+    const uint32_t word = (uint32_t)MDMA_FILL_PATTERN(value);
+    word_t *dw = (word_t*)d;
+    for (; size >= 16; size -= 16, dw += 4) {
+        dw[0] = word;
+        dw[1] = word;
+        dw[2] = word;
+        dw[3] = word;
+    }
+    for (; size >= 4; size -= 4) {
+        *dw++ = word;
+    }
+    d = (uint8_t*)dw;
+    while (size-- > 0) {
+        *d++ = value;
+    }
+}
+
+/**************************************************************************************************
+ * @section IRQ Handlers
+ **************************************************************************************************/
+
+void mdma_irq_handler() {
+    const uint32_t pending = *MDMA_MDMA_GISR0;
+    for (uint32_t channel = 0; channel < MDMA_COPY_CHANNELS; channel++) {
+        if ((pending & MDMA_MDMA_GISR0_GIFx[channel].msk) != 0) {
+            channel_irq(channel);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * This file is part of the Titan Flight Computer Project
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file src/internal/mdma.h
+ * @authors UW SARP
+ * @brief Memory-to-memory copy engine on the MDMA.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "../util/error.h"
+
+/**************************************************************************************************
+ * @section Configuration
+ **************************************************************************************************/
+
+// Copies and fills smaller than this many bytes run on the CPU, where they cost less than setting
+// up the MDMA. test/bench_mdma.c measures the break-even point: about 2 KiB on the host with the
+// D-cache off, lower on the M7, whose CPU copies are far slower per byte. With the D-cache on, the
+// per-line maintenance of both buffers moves it up again.
+#ifndef MDMA_CPU_THRESHOLD
+#define MDMA_CPU_THRESHOLD 1024
+#endif
+
+// Number of MDMA channels the engine uses (channels 0 to MDMA_COPY_CHANNELS - 1), which is how
+// many copies can be in flight at once.
+#ifndef MDMA_COPY_CHANNELS
+#define MDMA_COPY_CHANNELS 4
+#endif
+
+// Largest size of one descriptor, larger descriptors must be a multiple of it (see mdma_desc_copy())
+#define MDMA_BLOCK_SIZE 0x10000U
+
+// Largest mdma_memcpy()/mdma_memset() size (4096 repeated blocks)
+#define MDMA_MAX_SIZE (4096U * MDMA_BLOCK_SIZE)
+
+// A fill pattern for mdma_desc_fill() that repeats one byte
+#define MDMA_FILL_PATTERN(byte) ((uint64_t)(uint8_t)(byte) * 0x0101010101010101ULL)
+
+/**************************************************************************************************
+ * @section Type Definitions
+ **************************************************************************************************/
+
+// Completion callback, runs from the MDMA IRQ (or before the call returns, for CPU copies)
+typedef void (*mdma_callback_t)(bool success, void *context);
+
+/**
+ * @brief One link of a descriptor chain, in the layout the MDMA loads it from memory.
+ *
+ * Fill with mdma_desc_copy()/mdma_desc_fill() and run with mdma_submit(). The MDMA reads the
+ * descriptors itself, so they and everything they point to must stay valid until the callback.
+ */
+typedef struct mdma_desc_t {
+    uint32_t tcr;
+    uint32_t bndtr;
+    uint32_t sar;
+    uint32_t dar;
+    uint32_t brur;
+    uint32_t lar; // Next descriptor, set by mdma_submit()
+    uint32_t tbr;
+    uint32_t reserved;
+    uint32_t mar;
+    uint32_t mdr;
+} __attribute__((aligned(8))) mdma_desc_t;
+
+/**************************************************************************************************
+ * @section Public Functions
+ **************************************************************************************************/
+
+/**
+ * @brief Enables the MDMA clock and interrupt. Should be called once during system boot.
+ */
+tal_err_t *mdma_init(void);
+
+/**
+ * @brief Copies a buffer in the background.
+ * Copies under MDMA_CPU_THRESHOLD bytes, and copies made while every channel is busy, run on the
+ * CPU and call the callback before returning. D-cache maintenance of both buffers is handled.
+ * @param dest Destination, must not overlap @p src.
+ * @param src Source.
+ * @param size Size in bytes, at most MDMA_MAX_SIZE.
+ * @param callback Called when the copy is done, may be NULL.
+ * @param context Passed to the callback.
+ * @return bool, whether the copy was started. Fails on NULL buffers or a size that is too large.
+ */
+bool mdma_memcpy(void *dest, const void *src, size_t size, mdma_callback_t callback, void *context);
+
+/**
+ * @brief Fills a buffer with a byte in the background, under the same rules as mdma_memcpy().
+ * @param dest Destination.
+ * @param value Byte to fill with.
+ * @param size Size in bytes, at most MDMA_MAX_SIZE.
+ * @param callback Called when the fill is done, may be NULL.
+ * @param context Passed to the callback.
+ * @return bool, whether the fill was started.
+ */
+bool mdma_memset(void *dest, uint8_t value, size_t size, mdma_callback_t callback, void *context);
+
+/**
+ * @brief Fills in a descriptor that copies a buffer.
+ * @param desc The descriptor.
+ * @param dest Destination.
+ * @param src Source.
+ * @param size Size in bytes, at most MDMA_BLOCK_SIZE or a multiple of it up to MDMA_MAX_SIZE.
+ * @return bool, whether the size fits one descriptor.
+ */
+bool mdma_desc_copy(mdma_desc_t *desc, void *dest, const void *src, size_t size);
+
+/**
+ * @brief Fills in a descriptor that fills a buffer with a pattern.
+ * @param desc The descriptor.
+ * @param dest Destination.
+ * @param pattern Pattern to repeat, read in place by the MDMA while it runs, so not in the TCMs.
+ *                A pattern of one repeated byte (MDMA_FILL_PATTERN()) fills the same at any
+ *                alignment, others only when @p dest and @p size are multiples of 8.
+ * @param size Size in bytes, with the same limits as mdma_desc_copy().
+ * @return bool, whether the size fits one descriptor and the pattern is readable.
+ */
+bool mdma_desc_fill(mdma_desc_t *desc, void *dest, const uint64_t *pattern, size_t size);
+
+/**
+ * @brief Runs a chain of descriptors as a single transfer, linking them in array order.
+ * D-cache maintenance of the descriptors and their buffers is handled.
+ * @param descs The descriptors, in memory the MDMA can read.
+ * @param count Number of descriptors.
+ * @param callback Called once the whole chain is done or has failed, may be NULL.
+ * @param context Passed to the callback.
+ * @return bool, whether the chain was started. Fails if every channel is busy.
+ */
+bool mdma_submit(mdma_desc_t *descs, size_t count, mdma_callback_t callback, void *context);
+
+/**
+ * @brief Copies a buffer on the CPU, word at a time where the alignment allows it.
+ * The fallback of mdma_memcpy(), for callers that want a synchronous copy.
+ */
+void mdma_cpu_memcpy(void *dest, const void *src, size_t size);
+
+/**
+ * @brief Fills a buffer with a byte on the CPU, word at a time where the alignment allows it.
+ */
+void mdma_cpu_memset(void *dest, uint8_t value, size_t size);
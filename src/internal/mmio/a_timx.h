@@ -0,0 +1,653 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/a_timx.h
+ * @authors UW SARP
+ * @brief Registers and fields of TIM1, TIM8.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section A_TIMx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated A_TIMx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const A_TIMx_CR1[9] = {
+  [1] = (rw_reg32_t)0x40010000U,
+  [8] = (rw_reg32_t)0x40010400U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const A_TIMx_CR2[9] = {
+  [1] = (rw_reg32_t)0x40010004U,
+  [8] = (rw_reg32_t)0x40010404U,
+};
+
+/** @brief Slave mode control register. */
+static rw_reg32_t const A_TIMx_SMCR[9] = {
+  [1] = (rw_reg32_t)0x40010008U,
+  [8] = (rw_reg32_t)0x40010408U,
+};
+
+/** @brief DMA/Interrupt enable register. */
+static rw_reg32_t const A_TIMx_DIER[9] = {
+  [1] = (rw_reg32_t)0x4001000CU,
+  [8] = (rw_reg32_t)0x4001040CU,
+};
+
+/** @brief Status register. */
+static rw_reg32_t const A_TIMx_SR[9] = {
+  [1] = (rw_reg32_t)0x40010010U,
+  [8] = (rw_reg32_t)0x40010410U,
+};
+
+/** @brief Event generation register. */
+static rw_reg32_t const A_TIMx_EGR[9] = {
+  [1] = (rw_reg32_t)0x40010014U,
+  [8] = (rw_reg32_t)0x40010414U,
+};
+
+/** @brief Capture/compare mode register 1 (output mode). */
+static rw_reg32_t const A_TIMx_CCMR1_OUTPUT[9] = {
+  [1] = (rw_reg32_t)0x40010018U,
+  [8] = (rw_reg32_t)0x40010418U,
+};
+
+/** @brief Capture/compare mode register 1 (input mode). */
+static rw_reg32_t const A_TIMx_CCMR1_INPUT[9] = {
+  [1] = (rw_reg32_t)0x40010018U,
+  [8] = (rw_reg32_t)0x40010418U,
+};
+
+/** @brief Capture/compare mode register 2 (output mode). */
+static rw_reg32_t const A_TIMx_CCMR2_OUTPUT[9] = {
+  [1] = (rw_reg32_t)0x4001001CU,
+  [8] = (rw_reg32_t)0x4001041CU,
+};
+
+/** @brief Capture/compare mode register 2 (input mode). */
+static rw_reg32_t const A_TIMx_CCMR2_INPUT[9] = {
+  [1] = (rw_reg32_t)0x4001001CU,
+  [8] = (rw_reg32_t)0x4001041CU,
+};
+
+/** @brief Capture/compare enable register. */
+static rw_reg32_t const A_TIMx_CCER[9] = {
+  [1] = (rw_reg32_t)0x40010020U,
+  [8] = (rw_reg32_t)0x40010420U,
+};
+
+/** @brief Counter. */
+static rw_reg32_t const A_TIMx_CNT[9] = {
+  [1] = (rw_reg32_t)0x40010024U,
+  [8] = (rw_reg32_t)0x40010424U,
+};
+
+/** @brief Prescaler. */
+static rw_reg32_t const A_TIMx_PSC[9] = {
+  [1] = (rw_reg32_t)0x40010028U,
+  [8] = (rw_reg32_t)0x40010428U,
+};
+
+/** @brief Auto-reload register. */
+static rw_reg32_t const A_TIMx_ARR[9] = {
+  [1] = (rw_reg32_t)0x4001002CU,
+  [8] = (rw_reg32_t)0x4001042CU,
+};
+
+/** @brief Capture/compare register 1. */
+static rw_reg32_t const A_TIMx_CCR1[9] = {
+  [1] = (rw_reg32_t)0x40010034U,
+  [8] = (rw_reg32_t)0x40010434U,
+};
+
+/** @brief Capture/compare register 2. */
+static rw_reg32_t const A_TIMx_CCR2[9] = {
+  [1] = (rw_reg32_t)0x40010038U,
+  [8] = (rw_reg32_t)0x40010438U,
+};
+
+/** @brief Capture/compare register 3. */
+static rw_reg32_t const A_TIMx_CCR3[9] = {
+  [1] = (rw_reg32_t)0x4001003CU,
+  [8] = (rw_reg32_t)0x4001043CU,
+};
+
+/** @brief Capture/compare register 4. */
+static rw_reg32_t const A_TIMx_CCR4[9] = {
+  [1] = (rw_reg32_t)0x40010040U,
+  [8] = (rw_reg32_t)0x40010440U,
+};
+
+/** @brief DMA control register. */
+static rw_reg32_t const A_TIMx_DCR[9] = {
+  [1] = (rw_reg32_t)0x40010048U,
+  [8] = (rw_reg32_t)0x40010448U,
+};
+
+/** @brief DMA address for full transfer. */
+static rw_reg32_t const A_TIMx_DMAR[9] = {
+  [1] = (rw_reg32_t)0x4001004CU,
+  [8] = (rw_reg32_t)0x4001044CU,
+};
+
+/** @brief Repetition counter register. */
+static rw_reg32_t const A_TIMx_RCR[9] = {
+  [1] = (rw_reg32_t)0x40010030U,
+  [8] = (rw_reg32_t)0x40010430U,
+};
+
+/** @brief Break and dead-time register. */
+static rw_reg32_t const A_TIMx_BDTR[9] = {
+  [1] = (rw_reg32_t)0x40010044U,
+  [8] = (rw_reg32_t)0x40010444U,
+};
+
+/** @brief Capture/compare mode register 3 (output mode). */
+static rw_reg32_t const A_TIMx_CCMR3_OUTPUT[9] = {
+  [1] = (rw_reg32_t)0x40010054U,
+  [8] = (rw_reg32_t)0x40010454U,
+};
+
+/** @brief Capture/compare register 5. */
+static rw_reg32_t const A_TIMx_CCR5[9] = {
+  [1] = (rw_reg32_t)0x40010058U,
+  [8] = (rw_reg32_t)0x40010458U,
+};
+
+/** @brief Capture/compare register 6. */
+static rw_reg32_t const A_TIMx_CCR6[9] = {
+  [1] = (rw_reg32_t)0x4001005CU,
+  [8] = (rw_reg32_t)0x4001045CU,
+};
+
+/** @brief TIM1 alternate function option register 1. */
+static rw_reg32_t const A_TIMx_AF1[9] = {
+  [1] = (rw_reg32_t)0x40010060U,
+  [8] = (rw_reg32_t)0x40010460U,
+};
+
+/** @brief TIM1 Alternate function odfsdm1_breakster 2. */
+static rw_reg32_t const A_TIMx_AF2[9] = {
+  [1] = (rw_reg32_t)0x40010064U,
+  [8] = (rw_reg32_t)0x40010464U,
+};
+
+/** @brief TIM1 timer input selection register. */
+static rw_reg32_t const A_TIMx_TISEL[9] = {
+  [1] = (rw_reg32_t)0x40010068U,
+  [8] = (rw_reg32_t)0x40010468U,
+};
+
+/** @subsection A_TIMx Register Field Definitions */
+
+static const field32_t A_TIMx_CR1_CEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief Counter enable. */
+static const field32_t A_TIMx_CR1_UDIS            = {.msk = 0x00000002U, .pos = 1};  /** @brief Update disable. */
+static const field32_t A_TIMx_CR1_URS             = {.msk = 0x00000004U, .pos = 2};  /** @brief Update request source. */
+static const field32_t A_TIMx_CR1_OPM             = {.msk = 0x00000008U, .pos = 3};  /** @brief One-pulse mode. */
+static const field32_t A_TIMx_CR1_DIR             = {.msk = 0x00000010U, .pos = 4};  /** @brief Direction. */
+static const field32_t A_TIMx_CR1_CMS             = {.msk = 0x00000060U, .pos = 5};  /** @brief Center-aligned mode selection. */
+static const field32_t A_TIMx_CR1_ARPE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Auto-reload preload enable. */
+static const field32_t A_TIMx_CR1_CKD             = {.msk = 0x00000300U, .pos = 8};  /** @brief Clock division. */
+static const field32_t A_TIMx_CR1_UIFREMAP        = {.msk = 0x00000800U, .pos = 11}; /** @brief UIF status bit remapping. */
+static const field32_t A_TIMx_CR2_MMS2            = {.msk = 0x00F00000U, .pos = 20}; /** @brief Master mode selection 2. */
+static const field32_t A_TIMx_CR2_OIS6            = {.msk = 0x00040000U, .pos = 18}; /** @brief Output Idle state 6. */
+static const field32_t A_TIMx_CR2_OIS5            = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Idle state 5. */
+static const field32_t A_TIMx_CR2_OIS4            = {.msk = 0x00004000U, .pos = 14}; /** @brief Output Idle state 4. */
+static const field32_t A_TIMx_CR2_OIS3N           = {.msk = 0x00002000U, .pos = 13}; /** @brief Output Idle state 3. */
+static const field32_t A_TIMx_CR2_OIS3            = {.msk = 0x00001000U, .pos = 12}; /** @brief Output Idle state 3. */
+static const field32_t A_TIMx_CR2_OIS2N           = {.msk = 0x00000800U, .pos = 11}; /** @brief Output Idle state 2. */
+static const field32_t A_TIMx_CR2_OIS2            = {.msk = 0x00000400U, .pos = 10}; /** @brief Output Idle state 2. */
+static const field32_t A_TIMx_CR2_OIS1N           = {.msk = 0x00000200U, .pos = 9};  /** @brief Output Idle state 1. */
+static const field32_t A_TIMx_CR2_OIS1            = {.msk = 0x00000100U, .pos = 8};  /** @brief Output Idle state 1. */
+static const field32_t A_TIMx_CR2_TI1S            = {.msk = 0x00000080U, .pos = 7};  /** @brief TI1 selection. */
+static const field32_t A_TIMx_CR2_MMS             = {.msk = 0x00000070U, .pos = 4};  /** @brief Master mode selection. */
+static const field32_t A_TIMx_CR2_CCDS            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare DMA selection. */
+static const field32_t A_TIMx_CR2_CCUS            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare control update selection. */
+static const field32_t A_TIMx_CR2_CCPC            = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/compare preloaded control. */
+static const field32_t A_TIMx_SMCR_SMS            = {.msk = 0x00000007U, .pos = 0};  /** @brief Slave mode selection. */
+static const field32_t A_TIMx_SMCR_TS             = {.msk = 0x00000070U, .pos = 4};  /** @brief Trigger selection. */
+static const field32_t A_TIMx_SMCR_MSM            = {.msk = 0x00000080U, .pos = 7};  /** @brief Master/Slave mode. */
+static const field32_t A_TIMx_SMCR_ETF            = {.msk = 0x00000F00U, .pos = 8};  /** @brief External trigger filter. */
+static const field32_t A_TIMx_SMCR_ETPS           = {.msk = 0x00003000U, .pos = 12}; /** @brief External trigger prescaler. */
+static const field32_t A_TIMx_SMCR_ECE            = {.msk = 0x00004000U, .pos = 14}; /** @brief External clock enable. */
+static const field32_t A_TIMx_SMCR_ETP            = {.msk = 0x00008000U, .pos = 15}; /** @brief External trigger polarity. */
+static const field32_t A_TIMx_SMCR_SMS_3          = {.msk = 0x00010000U, .pos = 16}; /** @brief Slave mode selection - bit 3. */
+static const field32_t A_TIMx_SMCR_TS_4_3         = {.msk = 0x00300000U, .pos = 20}; /** @brief Trigger selection - bit 4:3. */
+static const field32_t A_TIMx_DIER_TDE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Trigger DMA request enable. */
+static const field32_t A_TIMx_DIER_COMDE          = {.msk = 0x00002000U, .pos = 13}; /** @brief COM DMA request enable. */
+static const field32_t A_TIMx_DIER_CC4DE          = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 DMA request enable. */
+static const field32_t A_TIMx_DIER_CC3DE          = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 DMA request enable. */
+static const field32_t A_TIMx_DIER_CC2DE          = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/Compare 2 DMA request enable. */
+static const field32_t A_TIMx_DIER_CC1DE          = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t A_TIMx_DIER_UDE            = {.msk = 0x00000100U, .pos = 8};  /** @brief Update DMA request enable. */
+static const field32_t A_TIMx_DIER_TIE            = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt enable. */
+static const field32_t A_TIMx_DIER_CC4IE          = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 4 interrupt enable. */
+static const field32_t A_TIMx_DIER_CC3IE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 3 interrupt enable. */
+static const field32_t A_TIMx_DIER_CC2IE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt enable. */
+static const field32_t A_TIMx_DIER_CC1IE          = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t A_TIMx_DIER_UIE            = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt enable. */
+static const field32_t A_TIMx_DIER_BIE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt enable. */
+static const field32_t A_TIMx_DIER_COMIE          = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt enable. */
+static const field32_t A_TIMx_SR_CC6IF            = {.msk = 0x00020000U, .pos = 17}; /** @brief Compare 6 interrupt flag. */
+static const field32_t A_TIMx_SR_CC5IF            = {.msk = 0x00010000U, .pos = 16}; /** @brief Compare 5 interrupt flag. */
+static const field32_t A_TIMx_SR_SBIF             = {.msk = 0x00002000U, .pos = 13}; /** @brief System Break interrupt flag. */
+static const field32_t A_TIMx_SR_CC4OF            = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 overcapture flag. */
+static const field32_t A_TIMx_SR_CC3OF            = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 overcapture flag. */
+static const field32_t A_TIMx_SR_CC2OF            = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/compare 2 overcapture flag. */
+static const field32_t A_TIMx_SR_CC1OF            = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t A_TIMx_SR_B2IF             = {.msk = 0x00000100U, .pos = 8};  /** @brief Break 2 interrupt flag. */
+static const field32_t A_TIMx_SR_BIF              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt flag. */
+static const field32_t A_TIMx_SR_TIF              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt flag. */
+static const field32_t A_TIMx_SR_COMIF            = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt flag. */
+static const field32_t A_TIMx_SR_CC4IF            = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 4 interrupt flag. */
+static const field32_t A_TIMx_SR_CC3IF            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 3 interrupt flag. */
+static const field32_t A_TIMx_SR_CC2IF            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt flag. */
+static const field32_t A_TIMx_SR_CC1IF            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 interrupt flag. */
+static const field32_t A_TIMx_SR_UIF              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt flag. */
+static const field32_t A_TIMx_EGR_UG              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update generation. */
+static const field32_t A_TIMx_EGR_CC1G            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 generation. */
+static const field32_t A_TIMx_EGR_CC2G            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare 2 generation. */
+static const field32_t A_TIMx_EGR_CC3G            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare 3 generation. */
+static const field32_t A_TIMx_EGR_CC4G            = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/compare 4 generation. */
+static const field32_t A_TIMx_EGR_COMG            = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare control update generation. */
+static const field32_t A_TIMx_EGR_TG              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger generation. */
+static const field32_t A_TIMx_EGR_BG              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break generation. */
+static const field32_t A_TIMx_EGR_B2G             = {.msk = 0x00000100U, .pos = 8};  /** @brief Break 2 generation. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_CC1S   = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC1FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Output Compare 1 fast enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC1PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Output Compare 1 preload enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC1M   = {.msk = 0x00000070U, .pos = 4};  /** @brief Output Compare 1 mode. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC1CE  = {.msk = 0x00000080U, .pos = 7};  /** @brief Output Compare 1 clear enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_CC2S   = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 2 selection. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC2FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief Output Compare 2 fast enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC2PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief Output Compare 2 preload enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC2M   = {.msk = 0x00007000U, .pos = 12}; /** @brief Output Compare 2 mode. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC2CE  = {.msk = 0x00008000U, .pos = 15}; /** @brief Output Compare 2 clear enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC1M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 1 mode - bit 3. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OC2M_3 = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 2 mode - bit 3. */
+static const field32_t A_TIMx_CCMR1_INPUT_IC2F    = {.msk = 0x0000F000U, .pos = 12}; /** @brief Input capture 2 filter. */
+static const field32_t A_TIMx_CCMR1_INPUT_IC2PCS  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Input capture 2 prescaler. */
+static const field32_t A_TIMx_CCMR1_INPUT_CC2S    = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 2 selection. */
+static const field32_t A_TIMx_CCMR1_INPUT_IC1F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 1 filter. */
+static const field32_t A_TIMx_CCMR1_INPUT_ICPCS   = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 1 prescaler. */
+static const field32_t A_TIMx_CCMR1_INPUT_CC1S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_CC3S   = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 3 selection. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC3FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Output compare 3 fast enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC3PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Output compare 3 preload enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC3M   = {.msk = 0x00000070U, .pos = 4};  /** @brief Output compare 3 mode. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC3CE  = {.msk = 0x00000080U, .pos = 7};  /** @brief Output compare 3 clear enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_CC4S   = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 4 selection. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC4FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief Output compare 4 fast enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC4PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief Output compare 4 preload enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC4M   = {.msk = 0x00007000U, .pos = 12}; /** @brief Output compare 4 mode. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC4CE  = {.msk = 0x00008000U, .pos = 15}; /** @brief Output compare 4 clear enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC3M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 3 mode - bit 3. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OC4M_4 = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 4 mode - bit 3. */
+static const field32_t A_TIMx_CCMR2_INPUT_IC4F    = {.msk = 0x0000F000U, .pos = 12}; /** @brief Input capture 4 filter. */
+static const field32_t A_TIMx_CCMR2_INPUT_IC4PSC  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Input capture 4 prescaler. */
+static const field32_t A_TIMx_CCMR2_INPUT_CC4S    = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 4 selection. */
+static const field32_t A_TIMx_CCMR2_INPUT_IC3F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 3 filter. */
+static const field32_t A_TIMx_CCMR2_INPUT_IC3PSC  = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 3 prescaler. */
+static const field32_t A_TIMx_CCMR2_INPUT_CC3S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/compare 3 selection. */
+static const field32_t A_TIMx_CCER_CC1E           = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/Compare 1 output enable. */
+static const field32_t A_TIMx_CCER_CC1P           = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t A_TIMx_CCER_CC1NE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 1 complementary output enable. */
+static const field32_t A_TIMx_CCER_CC1NP          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t A_TIMx_CCER_CC2E           = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 2 output enable. */
+static const field32_t A_TIMx_CCER_CC2P           = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t A_TIMx_CCER_CC2NE          = {.msk = 0x00000040U, .pos = 6};  /** @brief Capture/Compare 2 complementary output enable. */
+static const field32_t A_TIMx_CCER_CC2NP          = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t A_TIMx_CCER_CC3E           = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture/Compare 3 output enable. */
+static const field32_t A_TIMx_CCER_CC3P           = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t A_TIMx_CCER_CC3NE          = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/Compare 3 complementary output enable. */
+static const field32_t A_TIMx_CCER_CC3NP          = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t A_TIMx_CCER_CC4E           = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 output enable. */
+static const field32_t A_TIMx_CCER_CC4P           = {.msk = 0x00002000U, .pos = 13}; /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t A_TIMx_CCER_CC4NP          = {.msk = 0x00008000U, .pos = 15}; /** @brief Capture/Compare 4 complementary output polarity. */
+static const field32_t A_TIMx_CCER_CC5E           = {.msk = 0x00010000U, .pos = 16}; /** @brief Capture/Compare 5 output enable. */
+static const field32_t A_TIMx_CCER_CC5P           = {.msk = 0x00020000U, .pos = 17}; /** @brief Capture/Compare 5 output polarity. */
+static const field32_t A_TIMx_CCER_CC6E           = {.msk = 0x00100000U, .pos = 20}; /** @brief Capture/Compare 6 output enable. */
+static const field32_t A_TIMx_CCER_CC6P           = {.msk = 0x00200000U, .pos = 21}; /** @brief Capture/Compare 6 output polarity. */
+static const field32_t A_TIMx_CNT_CNT             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter value. */
+static const field32_t A_TIMx_CNT_UIFCPY          = {.msk = 0x80000000U, .pos = 31}; /** @brief UIF copy. */
+static const field32_t A_TIMx_PSC_PSC             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t A_TIMx_ARR_ARR             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Auto-reload value. */
+static const field32_t A_TIMx_CCR1_CCR1           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 1 value. */
+static const field32_t A_TIMx_CCR2_CCR2           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 2 value. */
+static const field32_t A_TIMx_CCR3_CCR3           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare value. */
+static const field32_t A_TIMx_CCR4_CCR4           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare value. */
+static const field32_t A_TIMx_DCR_DBL             = {.msk = 0x00001F00U, .pos = 8};  /** @brief DMA burst length. */
+static const field32_t A_TIMx_DCR_DBA             = {.msk = 0x0000001FU, .pos = 0};  /** @brief DMA base address. */
+static const field32_t A_TIMx_DMAR_DMAB           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief DMA register for burst accesses. */
+static const field32_t A_TIMx_RCR_REP             = {.msk = 0x000000FFU, .pos = 0};  /** @brief Repetition counter value. */
+static const field32_t A_TIMx_BDTR_DTG            = {.msk = 0x000000FFU, .pos = 0};  /** @brief Dead-time generator setup. */
+static const field32_t A_TIMx_BDTR_LOCK           = {.msk = 0x00000300U, .pos = 8};  /** @brief Lock configuration. */
+static const field32_t A_TIMx_BDTR_OSSI           = {.msk = 0x00000400U, .pos = 10}; /** @brief Off-state selection for Idle mode. */
+static const field32_t A_TIMx_BDTR_OSSR           = {.msk = 0x00000800U, .pos = 11}; /** @brief Off-state selection for Run mode. */
+static const field32_t A_TIMx_BDTR_BKE            = {.msk = 0x00001000U, .pos = 12}; /** @brief Break enable. */
+static const field32_t A_TIMx_BDTR_BKP            = {.msk = 0x00002000U, .pos = 13}; /** @brief Break polarity. */
+static const field32_t A_TIMx_BDTR_AOE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Automatic output enable. */
+static const field32_t A_TIMx_BDTR_MOE            = {.msk = 0x00008000U, .pos = 15}; /** @brief Main output enable. */
+static const field32_t A_TIMx_BDTR_BKF            = {.msk = 0x000F0000U, .pos = 16}; /** @brief Break filter. */
+static const field32_t A_TIMx_BDTR_BK2F           = {.msk = 0x00F00000U, .pos = 20}; /** @brief Break 2 filter. */
+static const field32_t A_TIMx_BDTR_BK2E           = {.msk = 0x01000000U, .pos = 24}; /** @brief Break 2 enable. */
+static const field32_t A_TIMx_BDTR_BK2P           = {.msk = 0x02000000U, .pos = 25}; /** @brief Break 2 polarity. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC5FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Output compare 5 fast enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC5PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Output compare 5 preload enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC5M   = {.msk = 0x00000070U, .pos = 4};  /** @brief Output compare 5 mode. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC5CE  = {.msk = 0x00000080U, .pos = 7};  /** @brief Output compare 5 clear enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC6FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief Output compare 6 fast enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC6PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief Output compare 6 preload enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC6M   = {.msk = 0x00007000U, .pos = 12}; /** @brief Output compare 6 mode. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC6CE  = {.msk = 0x00008000U, .pos = 15}; /** @brief Output compare 6 clear enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC5M3  = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 5 mode. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OC6M3  = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 6 mode. */
+static const field32_t A_TIMx_CCR5_CCR5           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 5 value. */
+static const field32_t A_TIMx_CCR5_GC5C1          = {.msk = 0x20000000U, .pos = 29}; /** @brief Group Channel 5 and Channel 1. */
+static const field32_t A_TIMx_CCR5_GC5C2          = {.msk = 0x40000000U, .pos = 30}; /** @brief Group Channel 5 and Channel 2. */
+static const field32_t A_TIMx_CCR5_GC5C3          = {.msk = 0x80000000U, .pos = 31}; /** @brief Group Channel 5 and Channel 3. */
+static const field32_t A_TIMx_CCR6_CCR6           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 6 value. */
+static const field32_t A_TIMx_AF1_BKINE           = {.msk = 0x00000001U, .pos = 0};  /** @brief BRK BKIN input enable. */
+static const field32_t A_TIMx_AF1_BKCMP1E         = {.msk = 0x00000002U, .pos = 1};  /** @brief BRK COMP1 enable. */
+static const field32_t A_TIMx_AF1_BKCMP2E         = {.msk = 0x00000004U, .pos = 2};  /** @brief BRK COMP2 enable. */
+static const field32_t A_TIMx_AF1_BKDF1BK0E       = {.msk = 0x00000100U, .pos = 8};  /** @brief BRK dfsdm1_break[0] enable. */
+static const field32_t A_TIMx_AF1_BKINP           = {.msk = 0x00000200U, .pos = 9};  /** @brief BRK BKIN input polarity. */
+static const field32_t A_TIMx_AF1_BKCMP1P         = {.msk = 0x00000400U, .pos = 10}; /** @brief BRK COMP1 input polarity. */
+static const field32_t A_TIMx_AF1_BKCMP2P         = {.msk = 0x00000800U, .pos = 11}; /** @brief BRK COMP2 input polarity. */
+static const field32_t A_TIMx_AF1_ETRSEL          = {.msk = 0x0003C000U, .pos = 14}; /** @brief ETR source selection. */
+static const field32_t A_TIMx_AF2_BK2INE          = {.msk = 0x00000001U, .pos = 0};  /** @brief BRK2 BKIN input enable. */
+static const field32_t A_TIMx_AF2_BK2CMP1E        = {.msk = 0x00000002U, .pos = 1};  /** @brief BRK2 COMP1 enable. */
+static const field32_t A_TIMx_AF2_BK2CMP2E        = {.msk = 0x00000004U, .pos = 2};  /** @brief BRK2 COMP2 enable. */
+static const field32_t A_TIMx_AF2_BK2DF1BK1E      = {.msk = 0x00000100U, .pos = 8};  /** @brief BRK2 dfsdm1_break[1] enable. */
+static const field32_t A_TIMx_AF2_BK2INP          = {.msk = 0x00000200U, .pos = 9};  /** @brief BRK2 BKIN2 input polarity. */
+static const field32_t A_TIMx_AF2_BK2CMP1P        = {.msk = 0x00000400U, .pos = 10}; /** @brief BRK2 COMP1 input polarit. */
+static const field32_t A_TIMx_AF2_BK2CMP2P        = {.msk = 0x00000800U, .pos = 11}; /** @brief BRK2 COMP2 input polarity. */
+static const field32_t A_TIMx_TISEL_TI1SEL        = {.msk = 0x0000000FU, .pos = 0};  /** @brief Selects TI1[0] to TI1[15] input. */
+static const field32_t A_TIMx_TISEL_TI2SEL        = {.msk = 0x00000F00U, .pos = 8};  /** @brief Selects TI2[0] to TI2[15] input. */
+static const field32_t A_TIMx_TISEL_TI3SEL        = {.msk = 0x000F0000U, .pos = 16}; /** @brief Selects TI3[0] to TI3[15] input. */
+static const field32_t A_TIMx_TISEL_TI4SEL        = {.msk = 0x0F000000U, .pos = 24}; /** @brief Selects TI4[0] to TI4[15] input. */
+
+/** @subsection Enumerated A_TIMx Register Field Definitions */
+
+/** @brief Output Idle state 1. */
+static const field32_t A_TIMx_CR2_OISx[7] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00004000U, .pos = 14},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief Output Idle state 1. */
+static const field32_t A_TIMx_CR2_OISxN[4] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+  [3] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t A_TIMx_DIER_CCxDE[5] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t A_TIMx_DIER_CCxIE[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Capture/compare 1 interrupt flag. */
+static const field32_t A_TIMx_SR_CCxIF[7] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t A_TIMx_SR_CCxOF[5] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Capture/compare 1 generation. */
+static const field32_t A_TIMx_EGR_CCxG[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Capture/Compare 1 selection. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Output Compare 1 fast enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OCxFE[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Output Compare 1 preload enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OCxPE[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Output Compare 1 mode. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OCxM[3] = {
+  [1] = {.msk = 0x00000070U, .pos = 4},
+  [2] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief Output Compare 1 clear enable. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OCxCE[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Output Compare 1 mode - bit 3. */
+static const field32_t A_TIMx_CCMR1_OUTPUT_OCxM_3[3] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Input capture 1 filter. */
+static const field32_t A_TIMx_CCMR1_INPUT_ICxF[3] = {
+  [1] = {.msk = 0x000000F0U, .pos = 4},
+  [2] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief Capture/Compare 1 selection. */
+static const field32_t A_TIMx_CCMR1_INPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Capture/Compare 3 selection. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_CCxS[5] = {
+  [3] = {.msk = 0x00000003U, .pos = 0},
+  [4] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Output compare 3 fast enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OCxFE[5] = {
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Output compare 3 preload enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OCxPE[5] = {
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Output compare 3 mode. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OCxM[5] = {
+  [3] = {.msk = 0x00000070U, .pos = 4},
+  [4] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief Output compare 3 clear enable. */
+static const field32_t A_TIMx_CCMR2_OUTPUT_OCxCE[5] = {
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Input capture 3 filter. */
+static const field32_t A_TIMx_CCMR2_INPUT_ICxF[5] = {
+  [3] = {.msk = 0x000000F0U, .pos = 4},
+  [4] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief Input capture 3 prescaler. */
+static const field32_t A_TIMx_CCMR2_INPUT_ICxPSC[5] = {
+  [3] = {.msk = 0x0000000CU, .pos = 2},
+  [4] = {.msk = 0x00000C00U, .pos = 10},
+};
+
+/** @brief Capture/compare 3 selection. */
+static const field32_t A_TIMx_CCMR2_INPUT_CCxS[5] = {
+  [3] = {.msk = 0x00000003U, .pos = 0},
+  [4] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Capture/Compare 1 output enable. */
+static const field32_t A_TIMx_CCER_CCxE[7] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t A_TIMx_CCER_CCxP[7] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00020000U, .pos = 17},
+  [6] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief Capture/Compare 1 complementary output enable. */
+static const field32_t A_TIMx_CCER_CCxNE[4] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t A_TIMx_CCER_CCxNP[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Output compare 5 fast enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OCxFE[7] = {
+  [5] = {.msk = 0x00000004U, .pos = 2},
+  [6] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Output compare 5 preload enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OCxPE[7] = {
+  [5] = {.msk = 0x00000008U, .pos = 3},
+  [6] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Output compare 5 mode. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OCxM[7] = {
+  [5] = {.msk = 0x00000070U, .pos = 4},
+  [6] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief Output compare 5 clear enable. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OCxCE[7] = {
+  [5] = {.msk = 0x00000080U, .pos = 7},
+  [6] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Output Compare 5 mode. */
+static const field32_t A_TIMx_CCMR3_OUTPUT_OCxM3[7] = {
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Group Channel 5 and Channel 1. */
+static const field32_t A_TIMx_CCR5_GC5Cx[4] = {
+  [1] = {.msk = 0x20000000U, .pos = 29},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+  [3] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief BRK COMP1 enable. */
+static const field32_t A_TIMx_AF1_BKCMPxE[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief BRK COMP1 input polarity. */
+static const field32_t A_TIMx_AF1_BKCMPxP[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief BRK2 COMP1 enable. */
+static const field32_t A_TIMx_AF2_BK2CMPxE[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief BRK2 COMP1 input polarit. */
+static const field32_t A_TIMx_AF2_BK2CMPxP[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Selects TI1[0] to TI1[15] input. */
+static const field32_t A_TIMx_TISEL_TIxSEL[5] = {
+  [1] = {.msk = 0x0000000FU, .pos = 0},
+  [2] = {.msk = 0x00000F00U, .pos = 8},
+  [3] = {.msk = 0x000F0000U, .pos = 16},
+  [4] = {.msk = 0x0F000000U, .pos = 24},
+};
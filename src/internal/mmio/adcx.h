@@ -0,0 +1,477 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/adcx.h
+ * @authors UW SARP
+ * @brief Registers and fields of ADC1, ADC2, ADC3.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section ADCx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated ADCx Register Definitions */
+
+/** @brief ADC interrupt and status register. */
+static rw_reg32_t const ADCx_ISR[4] = {
+  [1] = (rw_reg32_t)0x40022000U,
+  [2] = (rw_reg32_t)0x40022100U,
+  [3] = (rw_reg32_t)0x58026000U,
+};
+
+/** @brief ADC interrupt enable register. */
+static rw_reg32_t const ADCx_IER[4] = {
+  [1] = (rw_reg32_t)0x40022004U,
+  [2] = (rw_reg32_t)0x40022104U,
+  [3] = (rw_reg32_t)0x58026004U,
+};
+
+/** @brief ADC control register. */
+static rw_reg32_t const ADCx_CR[4] = {
+  [1] = (rw_reg32_t)0x40022008U,
+  [2] = (rw_reg32_t)0x40022108U,
+  [3] = (rw_reg32_t)0x58026008U,
+};
+
+/** @brief ADC configuration register 1. */
+static rw_reg32_t const ADCx_CFGR[4] = {
+  [1] = (rw_reg32_t)0x4002200CU,
+  [2] = (rw_reg32_t)0x4002210CU,
+  [3] = (rw_reg32_t)0x5802600CU,
+};
+
+/** @brief ADC configuration register 2. */
+static rw_reg32_t const ADCx_CFGR2[4] = {
+  [1] = (rw_reg32_t)0x40022010U,
+  [2] = (rw_reg32_t)0x40022110U,
+  [3] = (rw_reg32_t)0x58026010U,
+};
+
+/** @brief ADC sampling time register 1. */
+static rw_reg32_t const ADCx_SMPR1[4] = {
+  [1] = (rw_reg32_t)0x40022014U,
+  [2] = (rw_reg32_t)0x40022114U,
+  [3] = (rw_reg32_t)0x58026014U,
+};
+
+/** @brief ADC sampling time register 2. */
+static rw_reg32_t const ADCx_SMPR2[4] = {
+  [1] = (rw_reg32_t)0x40022018U,
+  [2] = (rw_reg32_t)0x40022118U,
+  [3] = (rw_reg32_t)0x58026018U,
+};
+
+/** @brief ADC analog watchdog 1 threshold register. */
+static rw_reg32_t const ADCx_LTR1[4] = {
+  [1] = (rw_reg32_t)0x40022020U,
+  [2] = (rw_reg32_t)0x40022120U,
+  [3] = (rw_reg32_t)0x58026020U,
+};
+
+/** @brief ADC analog watchdog 2 threshold register. */
+static rw_reg32_t const ADCx_LHTR1[4] = {
+  [1] = (rw_reg32_t)0x40022024U,
+  [2] = (rw_reg32_t)0x40022124U,
+  [3] = (rw_reg32_t)0x58026024U,
+};
+
+/** @brief ADC group regular sequencer ranks register 1. */
+static rw_reg32_t const ADCx_SQR1[4] = {
+  [1] = (rw_reg32_t)0x40022030U,
+  [2] = (rw_reg32_t)0x40022130U,
+  [3] = (rw_reg32_t)0x58026030U,
+};
+
+/** @brief ADC group regular sequencer ranks register 2. */
+static rw_reg32_t const ADCx_SQR2[4] = {
+  [1] = (rw_reg32_t)0x40022034U,
+  [2] = (rw_reg32_t)0x40022134U,
+  [3] = (rw_reg32_t)0x58026034U,
+};
+
+/** @brief ADC group regular sequencer ranks register 3. */
+static rw_reg32_t const ADCx_SQR3[4] = {
+  [1] = (rw_reg32_t)0x40022038U,
+  [2] = (rw_reg32_t)0x40022138U,
+  [3] = (rw_reg32_t)0x58026038U,
+};
+
+/** @brief ADC group regular sequencer ranks register 4. */
+static rw_reg32_t const ADCx_SQR4[4] = {
+  [1] = (rw_reg32_t)0x4002203CU,
+  [2] = (rw_reg32_t)0x4002213CU,
+  [3] = (rw_reg32_t)0x5802603CU,
+};
+
+/** @brief ADC group regular conversion data register. */
+static ro_reg32_t const ADCx_DR[4] = {
+  [1] = (ro_reg32_t)0x40022040U,
+  [2] = (ro_reg32_t)0x40022140U,
+  [3] = (ro_reg32_t)0x58026040U,
+};
+
+/** @brief ADC group injected sequencer register. */
+static rw_reg32_t const ADCx_JSQR[4] = {
+  [1] = (rw_reg32_t)0x4002204CU,
+  [2] = (rw_reg32_t)0x4002214CU,
+  [3] = (rw_reg32_t)0x5802604CU,
+};
+
+/** @brief ADC group injected sequencer rank 1 register. */
+static ro_reg32_t const ADCx_JDR1[4] = {
+  [1] = (ro_reg32_t)0x40022080U,
+  [2] = (ro_reg32_t)0x40022180U,
+  [3] = (ro_reg32_t)0x58026080U,
+};
+
+/** @brief ADC group injected sequencer rank 2 register. */
+static ro_reg32_t const ADCx_JDR2[4] = {
+  [1] = (ro_reg32_t)0x40022084U,
+  [2] = (ro_reg32_t)0x40022184U,
+  [3] = (ro_reg32_t)0x58026084U,
+};
+
+/** @brief ADC group injected sequencer rank 3 register. */
+static ro_reg32_t const ADCx_JDR3[4] = {
+  [1] = (ro_reg32_t)0x40022088U,
+  [2] = (ro_reg32_t)0x40022188U,
+  [3] = (ro_reg32_t)0x58026088U,
+};
+
+/** @brief ADC group injected sequencer rank 4 register. */
+static ro_reg32_t const ADCx_JDR4[4] = {
+  [1] = (ro_reg32_t)0x4002208CU,
+  [2] = (ro_reg32_t)0x4002218CU,
+  [3] = (ro_reg32_t)0x5802608CU,
+};
+
+/** @brief ADC analog watchdog 2 configuration register. */
+static rw_reg32_t const ADCx_AWD2CR[4] = {
+  [1] = (rw_reg32_t)0x400220A0U,
+  [2] = (rw_reg32_t)0x400221A0U,
+  [3] = (rw_reg32_t)0x580260A0U,
+};
+
+/** @brief ADC analog watchdog 3 configuration register. */
+static rw_reg32_t const ADCx_AWD3CR[4] = {
+  [1] = (rw_reg32_t)0x400220A4U,
+  [2] = (rw_reg32_t)0x400221A4U,
+  [3] = (rw_reg32_t)0x580260A4U,
+};
+
+/** @brief ADC channel differential or single-ended mode selection register. */
+static rw_reg32_t const ADCx_DIFSEL[4] = {
+  [1] = (rw_reg32_t)0x400220C0U,
+  [2] = (rw_reg32_t)0x400221C0U,
+  [3] = (rw_reg32_t)0x580260C0U,
+};
+
+/** @brief ADC calibration factors register. */
+static rw_reg32_t const ADCx_CALFACT[4] = {
+  [1] = (rw_reg32_t)0x400220C4U,
+  [2] = (rw_reg32_t)0x400221C4U,
+  [3] = (rw_reg32_t)0x580260C4U,
+};
+
+/** @brief ADC pre channel selection register. */
+static rw_reg32_t const ADCx_PCSEL[4] = {
+  [1] = (rw_reg32_t)0x4002201CU,
+  [2] = (rw_reg32_t)0x4002211CU,
+  [3] = (rw_reg32_t)0x5802601CU,
+};
+
+/** @brief ADC watchdog lower threshold register 2. */
+static rw_reg32_t const ADCx_LTR2[4] = {
+  [1] = (rw_reg32_t)0x400220B0U,
+  [2] = (rw_reg32_t)0x400221B0U,
+  [3] = (rw_reg32_t)0x580260B0U,
+};
+
+/** @brief ADC watchdog higher threshold register 2. */
+static rw_reg32_t const ADCx_HTR2[4] = {
+  [1] = (rw_reg32_t)0x400220B4U,
+  [2] = (rw_reg32_t)0x400221B4U,
+  [3] = (rw_reg32_t)0x580260B4U,
+};
+
+/** @brief ADC watchdog lower threshold register 3. */
+static rw_reg32_t const ADCx_LTR3[4] = {
+  [1] = (rw_reg32_t)0x400220B8U,
+  [2] = (rw_reg32_t)0x400221B8U,
+  [3] = (rw_reg32_t)0x580260B8U,
+};
+
+/** @brief ADC watchdog higher threshold register 3. */
+static rw_reg32_t const ADCx_HTR3[4] = {
+  [1] = (rw_reg32_t)0x400220BCU,
+  [2] = (rw_reg32_t)0x400221BCU,
+  [3] = (rw_reg32_t)0x580260BCU,
+};
+
+/** @brief ADC Calibration Factor register 2. */
+static rw_reg32_t const ADCx_CALFACT2[4] = {
+  [1] = (rw_reg32_t)0x400220C8U,
+  [2] = (rw_reg32_t)0x400221C8U,
+  [3] = (rw_reg32_t)0x580260C8U,
+};
+
+/** @brief ADC offset number 1 register. */
+static rw_reg32_t const ADCx_OFRx[4][5] = {
+  [1] = {[1] = (rw_reg32_t)0x40022060U, [2] = (rw_reg32_t)0x40022064U, [3] = (rw_reg32_t)0x40022068U, [4] = (rw_reg32_t)0x4002206CU},
+  [2] = {[1] = (rw_reg32_t)0x40022160U, [2] = (rw_reg32_t)0x40022164U, [3] = (rw_reg32_t)0x40022168U, [4] = (rw_reg32_t)0x4002216CU},
+  [3] = {[1] = (rw_reg32_t)0x58026060U, [2] = (rw_reg32_t)0x58026064U, [3] = (rw_reg32_t)0x58026068U, [4] = (rw_reg32_t)0x5802606CU},
+};
+
+/** @subsection ADCx Register Field Definitions */
+
+static const field32_t ADCx_ISR_JQOVF           = {.msk = 0x00000400U, .pos = 10}; /** @brief ADC group injected contexts queue overflow flag. */
+static const field32_t ADCx_ISR_AWD3            = {.msk = 0x00000200U, .pos = 9};  /** @brief ADC analog watchdog 3 flag. */
+static const field32_t ADCx_ISR_AWD2            = {.msk = 0x00000100U, .pos = 8};  /** @brief ADC analog watchdog 2 flag. */
+static const field32_t ADCx_ISR_AWD1            = {.msk = 0x00000080U, .pos = 7};  /** @brief ADC analog watchdog 1 flag. */
+static const field32_t ADCx_ISR_JEOS            = {.msk = 0x00000040U, .pos = 6};  /** @brief ADC group injected end of sequence conversions flag. */
+static const field32_t ADCx_ISR_JEOC            = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC group injected end of unitary conversion flag. */
+static const field32_t ADCx_ISR_OVR             = {.msk = 0x00000010U, .pos = 4};  /** @brief ADC group regular overrun flag. */
+static const field32_t ADCx_ISR_EOS             = {.msk = 0x00000008U, .pos = 3};  /** @brief ADC group regular end of sequence conversions flag. */
+static const field32_t ADCx_ISR_EOC             = {.msk = 0x00000004U, .pos = 2};  /** @brief ADC group regular end of unitary conversion flag. */
+static const field32_t ADCx_ISR_EOSMP           = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC group regular end of sampling flag. */
+static const field32_t ADCx_ISR_ADRDY           = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC ready flag. */
+static const field32_t ADCx_IER_JQOVFIE         = {.msk = 0x00000400U, .pos = 10}; /** @brief ADC group injected contexts queue overflow interrupt. */
+static const field32_t ADCx_IER_AWD3IE          = {.msk = 0x00000200U, .pos = 9};  /** @brief ADC analog watchdog 3 interrupt. */
+static const field32_t ADCx_IER_AWD2IE          = {.msk = 0x00000100U, .pos = 8};  /** @brief ADC analog watchdog 2 interrupt. */
+static const field32_t ADCx_IER_AWD1IE          = {.msk = 0x00000080U, .pos = 7};  /** @brief ADC analog watchdog 1 interrupt. */
+static const field32_t ADCx_IER_JEOSIE          = {.msk = 0x00000040U, .pos = 6};  /** @brief ADC group injected end of sequence conversions interrupt. */
+static const field32_t ADCx_IER_JEOCIE          = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC group injected end of unitary conversion interrupt. */
+static const field32_t ADCx_IER_OVRIE           = {.msk = 0x00000010U, .pos = 4};  /** @brief ADC group regular overrun interrupt. */
+static const field32_t ADCx_IER_EOSIE           = {.msk = 0x00000008U, .pos = 3};  /** @brief ADC group regular end of sequence conversions interrupt. */
+static const field32_t ADCx_IER_EOCIE           = {.msk = 0x00000004U, .pos = 2};  /** @brief ADC group regular end of unitary conversion interrupt. */
+static const field32_t ADCx_IER_EOSMPIE         = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC group regular end of sampling interrupt. */
+static const field32_t ADCx_IER_ADRDYIE         = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC ready interrupt. */
+static const field32_t ADCx_CR_ADCAL            = {.msk = 0x80000000U, .pos = 31}; /** @brief ADC calibration. */
+static const field32_t ADCx_CR_ADCALDIF         = {.msk = 0x40000000U, .pos = 30}; /** @brief ADC differential mode for calibration. */
+static const field32_t ADCx_CR_DEEPPWD          = {.msk = 0x20000000U, .pos = 29}; /** @brief ADC deep power down enable. */
+static const field32_t ADCx_CR_ADVREGEN         = {.msk = 0x10000000U, .pos = 28}; /** @brief ADC voltage regulator enable. */
+static const field32_t ADCx_CR_LINCALRDYW6      = {.msk = 0x08000000U, .pos = 27}; /** @brief Linearity calibration ready Word 6. */
+static const field32_t ADCx_CR_LINCALRDYW5      = {.msk = 0x04000000U, .pos = 26}; /** @brief Linearity calibration ready Word 5. */
+static const field32_t ADCx_CR_LINCALRDYW4      = {.msk = 0x02000000U, .pos = 25}; /** @brief Linearity calibration ready Word 4. */
+static const field32_t ADCx_CR_LINCALRDYW3      = {.msk = 0x01000000U, .pos = 24}; /** @brief Linearity calibration ready Word 3. */
+static const field32_t ADCx_CR_LINCALRDYW2      = {.msk = 0x00800000U, .pos = 23}; /** @brief Linearity calibration ready Word 2. */
+static const field32_t ADCx_CR_LINCALRDYW1      = {.msk = 0x00400000U, .pos = 22}; /** @brief Linearity calibration ready Word 1. */
+static const field32_t ADCx_CR_ADCALLIN         = {.msk = 0x00010000U, .pos = 16}; /** @brief Linearity calibration. */
+static const field32_t ADCx_CR_BOOST            = {.msk = 0x00000300U, .pos = 8};  /** @brief Boost mode control. */
+static const field32_t ADCx_CR_JADSTP           = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC group injected conversion stop. */
+static const field32_t ADCx_CR_ADSTP            = {.msk = 0x00000010U, .pos = 4};  /** @brief ADC group regular conversion stop. */
+static const field32_t ADCx_CR_JADSTART         = {.msk = 0x00000008U, .pos = 3};  /** @brief ADC group injected conversion start. */
+static const field32_t ADCx_CR_ADSTART          = {.msk = 0x00000004U, .pos = 2};  /** @brief ADC group regular conversion start. */
+static const field32_t ADCx_CR_ADDIS            = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC disable. */
+static const field32_t ADCx_CR_ADEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC enable. */
+static const field32_t ADCx_CFGR_JQDIS          = {.msk = 0x80000000U, .pos = 31}; /** @brief ADC group injected contexts queue disable. */
+static const field32_t ADCx_CFGR_AWDCH1CH       = {.msk = 0x7C000000U, .pos = 26}; /** @brief ADC analog watchdog 1 monitored channel selection. */
+static const field32_t ADCx_CFGR_JAUTO          = {.msk = 0x02000000U, .pos = 25}; /** @brief ADC group injected automatic trigger mode. */
+static const field32_t ADCx_CFGR_JAWD1EN        = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC analog watchdog 1 enable on scope ADC group injected. */
+static const field32_t ADCx_CFGR_AWD1EN         = {.msk = 0x00800000U, .pos = 23}; /** @brief ADC analog watchdog 1 enable on scope ADC group regular. */
+static const field32_t ADCx_CFGR_AWD1SGL        = {.msk = 0x00400000U, .pos = 22}; /** @brief ADC analog watchdog 1 monitoring a single channel or all channels. */
+static const field32_t ADCx_CFGR_JQM            = {.msk = 0x00200000U, .pos = 21}; /** @brief ADC group injected contexts queue mode. */
+static const field32_t ADCx_CFGR_JDISCEN        = {.msk = 0x00100000U, .pos = 20}; /** @brief ADC group injected sequencer discontinuous mode. */
+static const field32_t ADCx_CFGR_DISCNUM        = {.msk = 0x000E0000U, .pos = 17}; /** @brief ADC group regular sequencer discontinuous number of ranks. */
+static const field32_t ADCx_CFGR_DISCEN         = {.msk = 0x00010000U, .pos = 16}; /** @brief ADC group regular sequencer discontinuous mode. */
+static const field32_t ADCx_CFGR_AUTDLY         = {.msk = 0x00004000U, .pos = 14}; /** @brief ADC low power auto wait. */
+static const field32_t ADCx_CFGR_CONT           = {.msk = 0x00002000U, .pos = 13}; /** @brief ADC group regular continuous conversion mode. */
+static const field32_t ADCx_CFGR_OVRMOD         = {.msk = 0x00001000U, .pos = 12}; /** @brief ADC group regular overrun configuration. */
+static const field32_t ADCx_CFGR_EXTEN          = {.msk = 0x00000C00U, .pos = 10}; /** @brief ADC group regular external trigger polarity. */
+static const field32_t ADCx_CFGR_EXTSEL         = {.msk = 0x000003E0U, .pos = 5};  /** @brief ADC group regular external trigger source. */
+static const field32_t ADCx_CFGR_RES            = {.msk = 0x0000001CU, .pos = 2};  /** @brief ADC data resolution. */
+static const field32_t ADCx_CFGR_DMNGT          = {.msk = 0x00000003U, .pos = 0};  /** @brief ADC DMA transfer enable. */
+static const field32_t ADCx_CFGR2_ROVSE         = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC oversampler enable on scope ADC group regular. */
+static const field32_t ADCx_CFGR2_JOVSE         = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC oversampler enable on scope ADC group injected. */
+static const field32_t ADCx_CFGR2_OVSS          = {.msk = 0x000001E0U, .pos = 5};  /** @brief ADC oversampling shift. */
+static const field32_t ADCx_CFGR2_TROVS         = {.msk = 0x00000200U, .pos = 9};  /** @brief ADC oversampling discontinuous mode (triggered mode) for ADC group regular. */
+static const field32_t ADCx_CFGR2_ROVSM         = {.msk = 0x00000400U, .pos = 10}; /** @brief Regular Oversampling mode. */
+static const field32_t ADCx_CFGR2_RSHIFT1       = {.msk = 0x00000800U, .pos = 11}; /** @brief Right-shift data after Offset 1 correction. */
+static const field32_t ADCx_CFGR2_RSHIFT2       = {.msk = 0x00001000U, .pos = 12}; /** @brief Right-shift data after Offset 2 correction. */
+static const field32_t ADCx_CFGR2_RSHIFT3       = {.msk = 0x00002000U, .pos = 13}; /** @brief Right-shift data after Offset 3 correction. */
+static const field32_t ADCx_CFGR2_RSHIFT4       = {.msk = 0x00004000U, .pos = 14}; /** @brief Right-shift data after Offset 4 correction. */
+static const field32_t ADCx_CFGR2_OSR           = {.msk = 0x03FF0000U, .pos = 16}; /** @brief Oversampling ratio. */
+static const field32_t ADCx_CFGR2_LSHIFT        = {.msk = 0xF0000000U, .pos = 28}; /** @brief Left shift factor. */
+static const field32_t ADCx_SMPR1_SMP9          = {.msk = 0x38000000U, .pos = 27}; /** @brief ADC channel 9 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP8          = {.msk = 0x07000000U, .pos = 24}; /** @brief ADC channel 8 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP7          = {.msk = 0x00E00000U, .pos = 21}; /** @brief ADC channel 7 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP6          = {.msk = 0x001C0000U, .pos = 18}; /** @brief ADC channel 6 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP5          = {.msk = 0x00038000U, .pos = 15}; /** @brief ADC channel 5 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP4          = {.msk = 0x00007000U, .pos = 12}; /** @brief ADC channel 4 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP3          = {.msk = 0x00000E00U, .pos = 9};  /** @brief ADC channel 3 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP2          = {.msk = 0x000001C0U, .pos = 6};  /** @brief ADC channel 2 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMP1          = {.msk = 0x00000038U, .pos = 3};  /** @brief ADC channel 1 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP19         = {.msk = 0x38000000U, .pos = 27}; /** @brief ADC channel 18 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP18         = {.msk = 0x07000000U, .pos = 24}; /** @brief ADC channel 18 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP17         = {.msk = 0x00E00000U, .pos = 21}; /** @brief ADC channel 17 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP16         = {.msk = 0x001C0000U, .pos = 18}; /** @brief ADC channel 16 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP15         = {.msk = 0x00038000U, .pos = 15}; /** @brief ADC channel 15 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP14         = {.msk = 0x00007000U, .pos = 12}; /** @brief ADC channel 14 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP13         = {.msk = 0x00000E00U, .pos = 9};  /** @brief ADC channel 13 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP12         = {.msk = 0x000001C0U, .pos = 6};  /** @brief ADC channel 12 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP11         = {.msk = 0x00000038U, .pos = 3};  /** @brief ADC channel 11 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMP10         = {.msk = 0x00000007U, .pos = 0};  /** @brief ADC channel 10 sampling time selection. */
+static const field32_t ADCx_LTR1_LTR1           = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief ADC analog watchdog 1 threshold low. */
+static const field32_t ADCx_LHTR1_LHTR1         = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief ADC analog watchdog 2 threshold low. */
+static const field32_t ADCx_SQR1_SQ4            = {.msk = 0x1F000000U, .pos = 24}; /** @brief ADC group regular sequencer rank 4. */
+static const field32_t ADCx_SQR1_SQ3            = {.msk = 0x007C0000U, .pos = 18}; /** @brief ADC group regular sequencer rank 3. */
+static const field32_t ADCx_SQR1_SQ2            = {.msk = 0x0001F000U, .pos = 12}; /** @brief ADC group regular sequencer rank 2. */
+static const field32_t ADCx_SQR1_SQ1            = {.msk = 0x000007C0U, .pos = 6};  /** @brief ADC group regular sequencer rank 1. */
+static const field32_t ADCx_SQR1_L3             = {.msk = 0x0000000FU, .pos = 0};  /** @brief L3. */
+static const field32_t ADCx_SQR2_SQ9            = {.msk = 0x1F000000U, .pos = 24}; /** @brief ADC group regular sequencer rank 9. */
+static const field32_t ADCx_SQR2_SQ8            = {.msk = 0x007C0000U, .pos = 18}; /** @brief ADC group regular sequencer rank 8. */
+static const field32_t ADCx_SQR2_SQ7            = {.msk = 0x0001F000U, .pos = 12}; /** @brief ADC group regular sequencer rank 7. */
+static const field32_t ADCx_SQR2_SQ6            = {.msk = 0x000007C0U, .pos = 6};  /** @brief ADC group regular sequencer rank 6. */
+static const field32_t ADCx_SQR2_SQ5            = {.msk = 0x0000001FU, .pos = 0};  /** @brief ADC group regular sequencer rank 5. */
+static const field32_t ADCx_SQR3_SQ14           = {.msk = 0x1F000000U, .pos = 24}; /** @brief ADC group regular sequencer rank 14. */
+static const field32_t ADCx_SQR3_SQ13           = {.msk = 0x007C0000U, .pos = 18}; /** @brief ADC group regular sequencer rank 13. */
+static const field32_t ADCx_SQR3_SQ12           = {.msk = 0x0001F000U, .pos = 12}; /** @brief ADC group regular sequencer rank 12. */
+static const field32_t ADCx_SQR3_SQ11           = {.msk = 0x000007C0U, .pos = 6};  /** @brief ADC group regular sequencer rank 11. */
+static const field32_t ADCx_SQR3_SQ10           = {.msk = 0x0000001FU, .pos = 0};  /** @brief ADC group regular sequencer rank 10. */
+static const field32_t ADCx_SQR4_SQ16           = {.msk = 0x000007C0U, .pos = 6};  /** @brief ADC group regular sequencer rank 16. */
+static const field32_t ADCx_SQR4_SQ15           = {.msk = 0x0000001FU, .pos = 0};  /** @brief ADC group regular sequencer rank 15. */
+static const field32_t ADCx_DR_RDATA            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief ADC group regular conversion data. */
+static const field32_t ADCx_JSQR_JSQ4           = {.msk = 0xF8000000U, .pos = 27}; /** @brief ADC group injected sequencer rank 4. */
+static const field32_t ADCx_JSQR_JSQ3           = {.msk = 0x03E00000U, .pos = 21}; /** @brief ADC group injected sequencer rank 3. */
+static const field32_t ADCx_JSQR_JSQ2           = {.msk = 0x000F8000U, .pos = 15}; /** @brief ADC group injected sequencer rank 2. */
+static const field32_t ADCx_JSQR_JSQ1           = {.msk = 0x00003E00U, .pos = 9};  /** @brief ADC group injected sequencer rank 1. */
+static const field32_t ADCx_JSQR_JEXTEN         = {.msk = 0x00000180U, .pos = 7};  /** @brief ADC group injected external trigger polarity. */
+static const field32_t ADCx_JSQR_JEXTSEL        = {.msk = 0x0000007CU, .pos = 2};  /** @brief ADC group injected external trigger source. */
+static const field32_t ADCx_JSQR_JL             = {.msk = 0x00000003U, .pos = 0};  /** @brief ADC group injected sequencer scan length. */
+static const field32_t ADCx_AWD2CR_AWD2CH       = {.msk = 0x000FFFFFU, .pos = 0};  /** @brief ADC analog watchdog 2 monitored channel selection. */
+static const field32_t ADCx_AWD3CR_AWD3CH       = {.msk = 0x001FFFFEU, .pos = 1};  /** @brief ADC analog watchdog 3 monitored channel selection. */
+static const field32_t ADCx_DIFSEL_DIFSEL       = {.msk = 0x000FFFFFU, .pos = 0};  /** @brief ADC channel differential or single-ended mode for channel. */
+static const field32_t ADCx_CALFACT_CALFACT_D   = {.msk = 0x07FF0000U, .pos = 16}; /** @brief ADC calibration factor in differential mode. */
+static const field32_t ADCx_CALFACT_CALFACT_S   = {.msk = 0x000007FFU, .pos = 0};  /** @brief ADC calibration factor in single-ended mode. */
+static const field32_t ADCx_PCSEL_PCSEL         = {.msk = 0x000FFFFFU, .pos = 0};  /** @brief Channel x (VINP[i]) pre selection. */
+static const field32_t ADCx_LTR2_LTR2           = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief Analog watchdog 2 lower threshold. */
+static const field32_t ADCx_HTR2_HTR2           = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief Analog watchdog 2 higher threshold. */
+static const field32_t ADCx_LTR3_LTR3           = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief Analog watchdog 3 lower threshold. */
+static const field32_t ADCx_HTR3_HTR3           = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief Analog watchdog 3 higher threshold. */
+static const field32_t ADCx_CALFACT2_LINCALFACT = {.msk = 0x3FFFFFFFU, .pos = 0};  /** @brief Linearity Calibration Factor. */
+static const field32_t ADCx_OFRx_SSATE          = {.msk = 0x80000000U, .pos = 31}; /** @brief ADC offset number 1 enable. */
+static const field32_t ADCx_OFRx_OFFSET1_CH     = {.msk = 0x7C000000U, .pos = 26}; /** @brief ADC offset number 1 channel selection. */
+static const field32_t ADCx_OFRx_OFFSET1        = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief ADC offset number 1 offset level. */
+
+/** @subsection Enumerated ADCx Register Field Definitions */
+
+/** @brief ADC analog watchdog 1 flag. */
+static const field32_t ADCx_ISR_AWDx[4] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief ADC analog watchdog 1 interrupt. */
+static const field32_t ADCx_IER_AWDxIE[4] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief Linearity calibration ready Word 1. */
+static const field32_t ADCx_CR_LINCALRDYWx[7] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+  [5] = {.msk = 0x04000000U, .pos = 26},
+  [6] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Right-shift data after Offset 1 correction. */
+static const field32_t ADCx_CFGR2_RSHIFTx[5] = {
+  [1] = {.msk = 0x00000800U, .pos = 11},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+  [3] = {.msk = 0x00002000U, .pos = 13},
+  [4] = {.msk = 0x00004000U, .pos = 14},
+};
+
+/** @brief ADC channel 1 sampling time selection. */
+static const field32_t ADCx_SMPR1_SMPx[10] = {
+  [1] = {.msk = 0x00000038U, .pos = 3},
+  [2] = {.msk = 0x000001C0U, .pos = 6},
+  [3] = {.msk = 0x00000E00U, .pos = 9},
+  [4] = {.msk = 0x00007000U, .pos = 12},
+  [5] = {.msk = 0x00038000U, .pos = 15},
+  [6] = {.msk = 0x001C0000U, .pos = 18},
+  [7] = {.msk = 0x00E00000U, .pos = 21},
+  [8] = {.msk = 0x07000000U, .pos = 24},
+  [9] = {.msk = 0x38000000U, .pos = 27},
+};
+
+/** @brief ADC channel 10 sampling time selection. */
+static const field32_t ADCx_SMPR2_SMPx[20] = {
+  [10] = {.msk = 0x00000007U, .pos = 0},
+  [11] = {.msk = 0x00000038U, .pos = 3},
+  [12] = {.msk = 0x000001C0U, .pos = 6},
+  [13] = {.msk = 0x00000E00U, .pos = 9},
+  [14] = {.msk = 0x00007000U, .pos = 12},
+  [15] = {.msk = 0x00038000U, .pos = 15},
+  [16] = {.msk = 0x001C0000U, .pos = 18},
+  [17] = {.msk = 0x00E00000U, .pos = 21},
+  [18] = {.msk = 0x07000000U, .pos = 24},
+  [19] = {.msk = 0x38000000U, .pos = 27},
+};
+
+/** @brief ADC group regular sequencer rank 1. */
+static const field32_t ADCx_SQR1_SQx[5] = {
+  [1] = {.msk = 0x000007C0U, .pos = 6},
+  [2] = {.msk = 0x0001F000U, .pos = 12},
+  [3] = {.msk = 0x007C0000U, .pos = 18},
+  [4] = {.msk = 0x1F000000U, .pos = 24},
+};
+
+/** @brief ADC group regular sequencer rank 5. */
+static const field32_t ADCx_SQR2_SQx[10] = {
+  [5] = {.msk = 0x0000001FU, .pos = 0},
+  [6] = {.msk = 0x000007C0U, .pos = 6},
+  [7] = {.msk = 0x0001F000U, .pos = 12},
+  [8] = {.msk = 0x007C0000U, .pos = 18},
+  [9] = {.msk = 0x1F000000U, .pos = 24},
+};
+
+/** @brief ADC group regular sequencer rank 10. */
+static const field32_t ADCx_SQR3_SQx[15] = {
+  [10] = {.msk = 0x0000001FU, .pos = 0},
+  [11] = {.msk = 0x000007C0U, .pos = 6},
+  [12] = {.msk = 0x0001F000U, .pos = 12},
+  [13] = {.msk = 0x007C0000U, .pos = 18},
+  [14] = {.msk = 0x1F000000U, .pos = 24},
+};
+
+/** @brief ADC group regular sequencer rank 15. */
+static const field32_t ADCx_SQR4_SQx[17] = {
+  [15] = {.msk = 0x0000001FU, .pos = 0},
+  [16] = {.msk = 0x000007C0U, .pos = 6},
+};
+
+/** @brief ADC group injected sequencer rank 1. */
+static const field32_t ADCx_JSQR_JSQx[5] = {
+  [1] = {.msk = 0x00003E00U, .pos = 9},
+  [2] = {.msk = 0x000F8000U, .pos = 15},
+  [3] = {.msk = 0x03E00000U, .pos = 21},
+  [4] = {.msk = 0xF8000000U, .pos = 27},
+};
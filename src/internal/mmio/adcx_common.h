@@ -0,0 +1,110 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/adcx_common.h
+ * @authors UW SARP
+ * @brief Registers and fields of ADC3_COMMON, ADC12_COMMON.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section ADCx_COMMON Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated ADCx_COMMON Register Definitions */
+
+/** @brief ADC Common status register. */
+static ro_reg32_t const ADCx_COMMON_CSR[13] = {
+  [3]  = (ro_reg32_t)0x58026300U,
+  [12] = (ro_reg32_t)0x40022300U,
+};
+
+/** @brief ADC common control register. */
+static rw_reg32_t const ADCx_COMMON_CCR[13] = {
+  [3]  = (rw_reg32_t)0x58026308U,
+  [12] = (rw_reg32_t)0x40022308U,
+};
+
+/** @brief ADC common regular data register for dual and triple modes. */
+static ro_reg32_t const ADCx_COMMON_CDR[13] = {
+  [3]  = (ro_reg32_t)0x5802630CU,
+  [12] = (ro_reg32_t)0x4002230CU,
+};
+
+/** @brief ADC x common regular data register for 32-bit dual mode. */
+static ro_reg32_t const ADCx_COMMON_CDR2[13] = {
+  [3]  = (ro_reg32_t)0x58026310U,
+  [12] = (ro_reg32_t)0x40022310U,
+};
+
+/** @subsection ADCx_COMMON Register Field Definitions */
+
+static const field32_t ADCx_COMMON_CSR_ADRDY_MST = {.msk = 0x00000001U, .pos = 0};  /** @brief Master ADC ready. */
+static const field32_t ADCx_COMMON_CSR_EOSMP_MST = {.msk = 0x00000002U, .pos = 1};  /** @brief End of Sampling phase flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_EOC_MST   = {.msk = 0x00000004U, .pos = 2};  /** @brief End of regular conversion of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_EOS_MST   = {.msk = 0x00000008U, .pos = 3};  /** @brief End of regular sequence flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_OVR_MST   = {.msk = 0x00000010U, .pos = 4};  /** @brief Overrun flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_JEOC_MST  = {.msk = 0x00000020U, .pos = 5};  /** @brief End of injected conversion flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_JEOS_MST  = {.msk = 0x00000040U, .pos = 6};  /** @brief End of injected sequence flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD1_MST  = {.msk = 0x00000080U, .pos = 7};  /** @brief Analog watchdog 1 flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD2_MST  = {.msk = 0x00000100U, .pos = 8};  /** @brief Analog watchdog 2 flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD3_MST  = {.msk = 0x00000200U, .pos = 9};  /** @brief Analog watchdog 3 flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_JQOVF_MST = {.msk = 0x00000400U, .pos = 10}; /** @brief Injected Context Queue Overflow flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_ADRDY_SLV = {.msk = 0x00010000U, .pos = 16}; /** @brief Slave ADC ready. */
+static const field32_t ADCx_COMMON_CSR_EOSMP_SLV = {.msk = 0x00020000U, .pos = 17}; /** @brief End of Sampling phase flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_EOC_SLV   = {.msk = 0x00040000U, .pos = 18}; /** @brief End of regular conversion of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_EOS_SLV   = {.msk = 0x00080000U, .pos = 19}; /** @brief End of regular sequence flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_OVR_SLV   = {.msk = 0x00100000U, .pos = 20}; /** @brief Overrun flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_JEOC_SLV  = {.msk = 0x00200000U, .pos = 21}; /** @brief End of injected conversion flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_JEOS_SLV  = {.msk = 0x00400000U, .pos = 22}; /** @brief End of injected sequence flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD1_SLV  = {.msk = 0x00800000U, .pos = 23}; /** @brief Analog watchdog 1 flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD2_SLV  = {.msk = 0x01000000U, .pos = 24}; /** @brief Analog watchdog 2 flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_AWD3_SLV  = {.msk = 0x02000000U, .pos = 25}; /** @brief Analog watchdog 3 flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_JQOVF_SLV = {.msk = 0x04000000U, .pos = 26}; /** @brief Injected Context Queue Overflow flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CCR_DUAL      = {.msk = 0x0000001FU, .pos = 0};  /** @brief Dual ADC mode selection. */
+static const field32_t ADCx_COMMON_CCR_DELAY     = {.msk = 0x00000F00U, .pos = 8};  /** @brief Delay between 2 sampling phases. */
+static const field32_t ADCx_COMMON_CCR_DAMDF     = {.msk = 0x0000C000U, .pos = 14}; /** @brief Dual ADC Mode Data Format. */
+static const field32_t ADCx_COMMON_CCR_CKMODE    = {.msk = 0x00030000U, .pos = 16}; /** @brief ADC clock mode. */
+static const field32_t ADCx_COMMON_CCR_PRESC     = {.msk = 0x003C0000U, .pos = 18}; /** @brief ADC prescaler. */
+static const field32_t ADCx_COMMON_CCR_VREFEN    = {.msk = 0x00400000U, .pos = 22}; /** @brief VREFINT enable. */
+static const field32_t ADCx_COMMON_CCR_VSENSEEN  = {.msk = 0x00800000U, .pos = 23}; /** @brief Temperature sensor enable. */
+static const field32_t ADCx_COMMON_CCR_VBATEN    = {.msk = 0x01000000U, .pos = 24}; /** @brief VBAT enable. */
+static const field32_t ADCx_COMMON_CDR_RDATA_SLV = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Regular data of the slave ADC. */
+static const field32_t ADCx_COMMON_CDR_RDATA_MST = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Regular data of the master ADC. */
+
+/** @subsection Enumerated ADCx_COMMON Register Field Definitions */
+
+/** @brief Analog watchdog 1 flag of the master ADC. */
+static const field32_t ADCx_COMMON_CSR_AWDx_MST[4] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief Analog watchdog 1 flag of the slave ADC. */
+static const field32_t ADCx_COMMON_CSR_AWDx_SLV[4] = {
+  [1] = {.msk = 0x00800000U, .pos = 23},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+  [3] = {.msk = 0x02000000U, .pos = 25},
+};
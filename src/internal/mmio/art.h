@@ -0,0 +1,42 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/art.h
+ * @authors UW SARP
+ * @brief Registers and fields of ART.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section ART Definitions
+ **************************************************************************************************/
+
+/** @subsection ART Register Definitions */
+
+static rw_reg32_t const ART_CTR = (rw_reg32_t)0x40024400U; /** @brief Control register. */
+
+/** @subsection ART Register Field Definitions */
+
+static const field32_t ART_CTR_EN         = {.msk = 0x00000001U, .pos = 0}; /** @brief Cache enable. */
+static const field32_t ART_CTR_PCACHEADDR = {.msk = 0x000FFF00U, .pos = 8}; /** @brief Cacheable page index. */
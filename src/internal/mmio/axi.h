@@ -0,0 +1,151 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/axi.h
+ * @authors UW SARP
+ * @brief Registers and fields of AXI.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section AXI Definitions
+ **************************************************************************************************/
+
+/** @subsection AXI Register Definitions */
+
+static ro_reg32_t const AXI_AXI_PERIPH_ID_4 = (ro_reg32_t)0x51001FD0U; /** @brief AXI interconnect - peripheral ID4 register. */
+static ro_reg32_t const AXI_AXI_PERIPH_ID_0 = (ro_reg32_t)0x51001FE0U; /** @brief AXI interconnect - peripheral ID0 register. */
+static ro_reg32_t const AXI_AXI_PERIPH_ID_1 = (ro_reg32_t)0x51001FE4U; /** @brief AXI interconnect - peripheral ID1 register. */
+static ro_reg32_t const AXI_AXI_PERIPH_ID_2 = (ro_reg32_t)0x51001FE8U; /** @brief AXI interconnect - peripheral ID2 register. */
+static ro_reg32_t const AXI_AXI_PERIPH_ID_3 = (ro_reg32_t)0x51001FECU; /** @brief AXI interconnect - peripheral ID3 register. */
+static ro_reg32_t const AXI_AXI_COMP_ID_0   = (ro_reg32_t)0x51001FF0U; /** @brief AXI interconnect - component ID0 register. */
+static ro_reg32_t const AXI_AXI_COMP_ID_1   = (ro_reg32_t)0x51001FF4U; /** @brief AXI interconnect - component ID1 register. */
+static ro_reg32_t const AXI_AXI_COMP_ID_2   = (ro_reg32_t)0x51001FF8U; /** @brief AXI interconnect - component ID2 register. */
+static ro_reg32_t const AXI_AXI_COMP_ID_3   = (ro_reg32_t)0x51001FFCU; /** @brief AXI interconnect - component ID3 register. */
+
+/** @subsection Enumerated AXI Register Definitions */
+
+/** @brief AXI interconnect - TARG x bus matrix issuing functionality register. */
+static rw_reg32_t const AXI_AXI_TARGx_FN_MOD_ISS_BM[8] = {
+  [1] = (rw_reg32_t)0x51002008U,
+  [2] = (rw_reg32_t)0x51003008U,
+  [3] = (rw_reg32_t)0x51004008U,
+  [4] = (rw_reg32_t)0x51005008U,
+  [5] = (rw_reg32_t)0x51006008U,
+  [6] = (rw_reg32_t)0x51007008U,
+  [7] = (rw_reg32_t)0x5100800CU,
+};
+
+/** @brief AXI interconnect - TARG x bus matrix functionality 2 register. */
+static rw_reg32_t const AXI_AXI_TARGx_FN_MOD2[8] = {
+  [1] = (rw_reg32_t)0x51002024U,
+  [2] = (rw_reg32_t)0x51003024U,
+  [7] = (rw_reg32_t)0x51008024U,
+};
+
+/** @brief AXI interconnect - TARG x long burst functionality modification. */
+static rw_reg32_t const AXI_AXI_TARGx_FN_MOD_LB[3] = {
+  [1] = (rw_reg32_t)0x5100202CU,
+  [2] = (rw_reg32_t)0x5100302CU,
+};
+
+/** @brief AXI interconnect - TARG x long burst functionality modification. */
+static rw_reg32_t const AXI_AXI_TARGx_FN_MOD[8] = {
+  [1] = (rw_reg32_t)0x51002108U,
+  [2] = (rw_reg32_t)0x51003108U,
+  [7] = (rw_reg32_t)0x51008108U,
+};
+
+/** @brief AXI interconnect - INI x functionality modification 2 register. */
+static rw_reg32_t const AXI_AXI_INIx_FN_MOD2[4] = {
+  [1] = (rw_reg32_t)0x51042024U,
+  [3] = (rw_reg32_t)0x51044024U,
+};
+
+/** @brief AXI interconnect - INI x AHB functionality modification register. */
+static rw_reg32_t const AXI_AXI_INIx_FN_MOD_AHB[4] = {
+  [1] = (rw_reg32_t)0x51042028U,
+  [3] = (rw_reg32_t)0x51044028U,
+};
+
+/** @brief AXI interconnect - INI x read QoS register. */
+static rw_reg32_t const AXI_AXI_INIx_READ_QOS[7] = {
+  [1] = (rw_reg32_t)0x51042100U,
+  [2] = (rw_reg32_t)0x51043100U,
+  [3] = (rw_reg32_t)0x51044100U,
+  [4] = (rw_reg32_t)0x51045100U,
+  [5] = (rw_reg32_t)0x51046100U,
+  [6] = (rw_reg32_t)0x51047100U,
+};
+
+/** @brief AXI interconnect - INI x write QoS register. */
+static rw_reg32_t const AXI_AXI_INIx_WRITE_QOS[7] = {
+  [1] = (rw_reg32_t)0x51042104U,
+  [2] = (rw_reg32_t)0x51043104U,
+  [3] = (rw_reg32_t)0x51044104U,
+  [4] = (rw_reg32_t)0x51045104U,
+  [5] = (rw_reg32_t)0x51046104U,
+  [6] = (rw_reg32_t)0x51047104U,
+};
+
+/** @brief AXI interconnect - INI x issuing functionality modification register. */
+static rw_reg32_t const AXI_AXI_INIx_FN_MOD[7] = {
+  [1] = (rw_reg32_t)0x51042108U,
+  [2] = (rw_reg32_t)0x51043108U,
+  [3] = (rw_reg32_t)0x51044108U,
+  [4] = (rw_reg32_t)0x51045108U,
+  [5] = (rw_reg32_t)0x51046108U,
+  [6] = (rw_reg32_t)0x51047108U,
+};
+
+/** @subsection AXI Register Field Definitions */
+
+static const field32_t AXI_AXI_PERIPH_ID_4_JEP106CON                  = {.msk = 0x0000000FU, .pos = 0}; /** @brief JEP106 continuation code. */
+static const field32_t AXI_AXI_PERIPH_ID_4_KCOUNT4                    = {.msk = 0x000000F0U, .pos = 4}; /** @brief Register file size. */
+static const field32_t AXI_AXI_PERIPH_ID_0_PARTNUM                    = {.msk = 0x000000FFU, .pos = 0}; /** @brief Peripheral part number bits 0 to 7. */
+static const field32_t AXI_AXI_PERIPH_ID_1_PARTNUM                    = {.msk = 0x0000000FU, .pos = 0}; /** @brief Peripheral part number bits 8 to 11. */
+static const field32_t AXI_AXI_PERIPH_ID_1_JEP106I                    = {.msk = 0x000000F0U, .pos = 4}; /** @brief JEP106 identity bits 0 to 3. */
+static const field32_t AXI_AXI_PERIPH_ID_2_JEP106ID                   = {.msk = 0x00000007U, .pos = 0}; /** @brief JEP106 Identity bits 4 to 6. */
+static const field32_t AXI_AXI_PERIPH_ID_2_JEDEC                      = {.msk = 0x00000008U, .pos = 3}; /** @brief JEP106 code flag. */
+static const field32_t AXI_AXI_PERIPH_ID_2_REVISION                   = {.msk = 0x000000F0U, .pos = 4}; /** @brief Peripheral revision number. */
+static const field32_t AXI_AXI_PERIPH_ID_3_CUST_MOD_NUM               = {.msk = 0x0000000FU, .pos = 0}; /** @brief Customer modification. */
+static const field32_t AXI_AXI_PERIPH_ID_3_REV_AND                    = {.msk = 0x000000F0U, .pos = 4}; /** @brief Customer version. */
+static const field32_t AXI_AXI_COMP_ID_0_PREAMBLE                     = {.msk = 0x000000FFU, .pos = 0}; /** @brief Preamble bits 0 to 7. */
+static const field32_t AXI_AXI_COMP_ID_1_PREAMBLE                     = {.msk = 0x0000000FU, .pos = 0}; /** @brief Preamble bits 8 to 11. */
+static const field32_t AXI_AXI_COMP_ID_1_CLASS                        = {.msk = 0x000000F0U, .pos = 4}; /** @brief Component class. */
+static const field32_t AXI_AXI_COMP_ID_2_PREAMBLE                     = {.msk = 0x000000FFU, .pos = 0}; /** @brief Preamble bits 12 to 19. */
+static const field32_t AXI_AXI_COMP_ID_3_PREAMBLE                     = {.msk = 0x000000FFU, .pos = 0}; /** @brief Preamble bits 20 to 27. */
+static const field32_t AXI_AXI_TARGx_FN_MOD_ISS_BM_READ_ISS_OVERRIDE  = {.msk = 0x00000001U, .pos = 0}; /** @brief READ_ISS_OVERRIDE. */
+static const field32_t AXI_AXI_TARGx_FN_MOD_ISS_BM_WRITE_ISS_OVERRIDE = {.msk = 0x00000002U, .pos = 1}; /** @brief Switch matrix write issuing override for target. */
+static const field32_t AXI_AXI_TARGx_FN_MOD2_BYPASS_MERGE             = {.msk = 0x00000001U, .pos = 0}; /** @brief Disable packing of beats to match the output data width. */
+static const field32_t AXI_AXI_TARGx_FN_MOD_LB_FN_MOD_LB              = {.msk = 0x00000001U, .pos = 0}; /** @brief Controls burst breaking of long bursts. */
+static const field32_t AXI_AXI_TARGx_FN_MOD_READ_ISS_OVERRIDE         = {.msk = 0x00000001U, .pos = 0}; /** @brief Override AMIB read issuing capability. */
+static const field32_t AXI_AXI_TARGx_FN_MOD_WRITE_ISS_OVERRIDE        = {.msk = 0x00000002U, .pos = 1}; /** @brief Override AMIB write issuing capability. */
+static const field32_t AXI_AXI_INIx_FN_MOD2_BYPASS_MERGE              = {.msk = 0x00000001U, .pos = 0}; /** @brief Disables alteration of transactions by the up-sizer unless required by the protocol. */
+static const field32_t AXI_AXI_INIx_FN_MOD_AHB_RD_INC_OVERRIDE        = {.msk = 0x00000001U, .pos = 0}; /** @brief Converts all AHB-Lite write transactions to a series of single beat AXI. */
+static const field32_t AXI_AXI_INIx_FN_MOD_AHB_WR_INC_OVERRIDE        = {.msk = 0x00000002U, .pos = 1}; /** @brief Converts all AHB-Lite read transactions to a series of single beat AXI. */
+static const field32_t AXI_AXI_INIx_READ_QOS_AR_QOS                   = {.msk = 0x0000000FU, .pos = 0}; /** @brief Read channel QoS setting. */
+static const field32_t AXI_AXI_INIx_WRITE_QOS_AW_QOS                  = {.msk = 0x0000000FU, .pos = 0}; /** @brief Write channel QoS setting. */
+static const field32_t AXI_AXI_INIx_FN_MOD_READ_ISS_OVERRIDE          = {.msk = 0x00000001U, .pos = 0}; /** @brief Override ASIB read issuing capability. */
+static const field32_t AXI_AXI_INIx_FN_MOD_WRITE_ISS_OVERRIDE         = {.msk = 0x00000002U, .pos = 1}; /** @brief Override ASIB write issuing capability. */
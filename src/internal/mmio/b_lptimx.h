@@ -0,0 +1,144 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/b_lptimx.h
+ * @authors UW SARP
+ * @brief Registers and fields of LPTIM3, LPTIM4, LPTIM5.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section B_LPTIMx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated B_LPTIMx Register Definitions */
+
+/** @brief Interrupt and Status Register. */
+static ro_reg32_t const B_LPTIMx_ISR[6] = {
+  [3] = (ro_reg32_t)0x58002800U,
+  [4] = (ro_reg32_t)0x58002C00U,
+  [5] = (ro_reg32_t)0x58003000U,
+};
+
+/** @brief Interrupt Clear Register. */
+static rw_reg32_t const B_LPTIMx_ICR[6] = {
+  [3] = (rw_reg32_t)0x58002804U,
+  [4] = (rw_reg32_t)0x58002C04U,
+  [5] = (rw_reg32_t)0x58003004U,
+};
+
+/** @brief Interrupt Enable Register. */
+static rw_reg32_t const B_LPTIMx_IER[6] = {
+  [3] = (rw_reg32_t)0x58002808U,
+  [4] = (rw_reg32_t)0x58002C08U,
+  [5] = (rw_reg32_t)0x58003008U,
+};
+
+/** @brief Configuration Register. */
+static rw_reg32_t const B_LPTIMx_CFGR[6] = {
+  [3] = (rw_reg32_t)0x5800280CU,
+  [4] = (rw_reg32_t)0x58002C0CU,
+  [5] = (rw_reg32_t)0x5800300CU,
+};
+
+/** @brief Control Register. */
+static rw_reg32_t const B_LPTIMx_CR[6] = {
+  [3] = (rw_reg32_t)0x58002810U,
+  [4] = (rw_reg32_t)0x58002C10U,
+  [5] = (rw_reg32_t)0x58003010U,
+};
+
+/** @brief Compare Register. */
+static rw_reg32_t const B_LPTIMx_CMP[6] = {
+  [3] = (rw_reg32_t)0x58002814U,
+  [4] = (rw_reg32_t)0x58002C14U,
+  [5] = (rw_reg32_t)0x58003014U,
+};
+
+/** @brief Autoreload Register. */
+static rw_reg32_t const B_LPTIMx_ARR[6] = {
+  [3] = (rw_reg32_t)0x58002818U,
+  [4] = (rw_reg32_t)0x58002C18U,
+  [5] = (rw_reg32_t)0x58003018U,
+};
+
+/** @brief Counter Register. */
+static ro_reg32_t const B_LPTIMx_CNT[6] = {
+  [3] = (ro_reg32_t)0x5800281CU,
+  [4] = (ro_reg32_t)0x58002C1CU,
+  [5] = (ro_reg32_t)0x5800301CU,
+};
+
+/** @brief LPTIM configuration register 2. */
+static rw_reg32_t const B_LPTIMx_CFGR2[6] = {
+  [3] = (rw_reg32_t)0x58002824U,
+  [4] = (rw_reg32_t)0x58002C24U,
+  [5] = (rw_reg32_t)0x58003024U,
+};
+
+/** @subsection B_LPTIMx Register Field Definitions */
+
+static const field32_t B_LPTIMx_ISR_DOWN       = {.msk = 0x00000040U, .pos = 6};  /** @brief Counter direction change up to down. */
+static const field32_t B_LPTIMx_ISR_UP         = {.msk = 0x00000020U, .pos = 5};  /** @brief Counter direction change down to up. */
+static const field32_t B_LPTIMx_ISR_ARROK      = {.msk = 0x00000010U, .pos = 4};  /** @brief Autoreload register update OK. */
+static const field32_t B_LPTIMx_ISR_CMPOK      = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare register update OK. */
+static const field32_t B_LPTIMx_ISR_EXTTRIG    = {.msk = 0x00000004U, .pos = 2};  /** @brief External trigger edge event. */
+static const field32_t B_LPTIMx_ISR_ARRM       = {.msk = 0x00000002U, .pos = 1};  /** @brief Autoreload match. */
+static const field32_t B_LPTIMx_ISR_CMPM       = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare match. */
+static const field32_t B_LPTIMx_ICR_DOWNCF     = {.msk = 0x00000040U, .pos = 6};  /** @brief Direction change to down Clear Flag. */
+static const field32_t B_LPTIMx_ICR_UPCF       = {.msk = 0x00000020U, .pos = 5};  /** @brief Direction change to UP Clear Flag. */
+static const field32_t B_LPTIMx_ICR_ARROKCF    = {.msk = 0x00000010U, .pos = 4};  /** @brief Autoreload register update OK Clear Flag. */
+static const field32_t B_LPTIMx_ICR_CMPOKCF    = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare register update OK Clear Flag. */
+static const field32_t B_LPTIMx_ICR_EXTTRIGCF  = {.msk = 0x00000004U, .pos = 2};  /** @brief External trigger valid edge Clear Flag. */
+static const field32_t B_LPTIMx_ICR_ARRMCF     = {.msk = 0x00000002U, .pos = 1};  /** @brief Autoreload match Clear Flag. */
+static const field32_t B_LPTIMx_ICR_CMPMCF     = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare match Clear Flag. */
+static const field32_t B_LPTIMx_IER_DOWNIE     = {.msk = 0x00000040U, .pos = 6};  /** @brief Direction change to down Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_UPIE       = {.msk = 0x00000020U, .pos = 5};  /** @brief Direction change to UP Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_ARROKIE    = {.msk = 0x00000010U, .pos = 4};  /** @brief Autoreload register update OK Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_CMPOKIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare register update OK Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_EXTTRIGIE  = {.msk = 0x00000004U, .pos = 2};  /** @brief External trigger valid edge Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_ARRMIE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Autoreload match Interrupt Enable. */
+static const field32_t B_LPTIMx_IER_CMPMIE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare match Interrupt Enable. */
+static const field32_t B_LPTIMx_CFGR_ENC       = {.msk = 0x01000000U, .pos = 24}; /** @brief Encoder mode enable. */
+static const field32_t B_LPTIMx_CFGR_COUNTMODE = {.msk = 0x00800000U, .pos = 23}; /** @brief Counter mode enabled. */
+static const field32_t B_LPTIMx_CFGR_PRELOAD   = {.msk = 0x00400000U, .pos = 22}; /** @brief Registers update mode. */
+static const field32_t B_LPTIMx_CFGR_WAVPOL    = {.msk = 0x00200000U, .pos = 21}; /** @brief Waveform shape polarity. */
+static const field32_t B_LPTIMx_CFGR_WAVE      = {.msk = 0x00100000U, .pos = 20}; /** @brief Waveform shape. */
+static const field32_t B_LPTIMx_CFGR_TIMOUT    = {.msk = 0x00080000U, .pos = 19}; /** @brief Timeout enable. */
+static const field32_t B_LPTIMx_CFGR_TRIGEN    = {.msk = 0x00060000U, .pos = 17}; /** @brief Trigger enable and polarity. */
+static const field32_t B_LPTIMx_CFGR_TRIGSEL   = {.msk = 0x0000E000U, .pos = 13}; /** @brief Trigger selector. */
+static const field32_t B_LPTIMx_CFGR_PRESC     = {.msk = 0x00000E00U, .pos = 9};  /** @brief Clock prescaler. */
+static const field32_t B_LPTIMx_CFGR_TRGFLT    = {.msk = 0x000000C0U, .pos = 6};  /** @brief Configurable digital filter for trigger. */
+static const field32_t B_LPTIMx_CFGR_CKFLT     = {.msk = 0x00000018U, .pos = 3};  /** @brief Configurable digital filter for external clock. */
+static const field32_t B_LPTIMx_CFGR_CKPOL     = {.msk = 0x00000006U, .pos = 1};  /** @brief Clock Polarity. */
+static const field32_t B_LPTIMx_CFGR_CKSEL     = {.msk = 0x00000001U, .pos = 0};  /** @brief Clock selector. */
+static const field32_t B_LPTIMx_CR_ENABLE      = {.msk = 0x00000001U, .pos = 0};  /** @brief LPTIM Enable. */
+static const field32_t B_LPTIMx_CR_SNGSTRT     = {.msk = 0x00000002U, .pos = 1};  /** @brief LPTIM start in single mode. */
+static const field32_t B_LPTIMx_CR_CNTSTRT     = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer start in continuous mode. */
+static const field32_t B_LPTIMx_CR_COUNTRST    = {.msk = 0x00000008U, .pos = 3};  /** @brief Counter reset. */
+static const field32_t B_LPTIMx_CR_RSTARE      = {.msk = 0x00000010U, .pos = 4};  /** @brief Reset after read enable. */
+static const field32_t B_LPTIMx_CMP_CMP        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Compare value. */
+static const field32_t B_LPTIMx_ARR_ARR        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Auto reload value. */
+static const field32_t B_LPTIMx_CNT_CNT        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter value. */
+static const field32_t B_LPTIMx_CFGR2_IN1SEL   = {.msk = 0x00000003U, .pos = 0};  /** @brief LPTIM Input 1 selection. */
@@ -0,0 +1,101 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/b_timx.h
+ * @authors UW SARP
+ * @brief Registers and fields of TIM6, TIM7.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section B_TIMx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated B_TIMx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const B_TIMx_CR1[8] = {
+  [6] = (rw_reg32_t)0x40001000U,
+  [7] = (rw_reg32_t)0x40001400U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const B_TIMx_CR2[8] = {
+  [6] = (rw_reg32_t)0x40001004U,
+  [7] = (rw_reg32_t)0x40001404U,
+};
+
+/** @brief DMA/Interrupt enable register. */
+static rw_reg32_t const B_TIMx_DIER[8] = {
+  [6] = (rw_reg32_t)0x4000100CU,
+  [7] = (rw_reg32_t)0x4000140CU,
+};
+
+/** @brief Status register. */
+static rw_reg32_t const B_TIMx_SR[8] = {
+  [6] = (rw_reg32_t)0x40001010U,
+  [7] = (rw_reg32_t)0x40001410U,
+};
+
+/** @brief Event generation register. */
+static rw_reg32_t const B_TIMx_EGR[8] = {
+  [6] = (rw_reg32_t)0x40001014U,
+  [7] = (rw_reg32_t)0x40001414U,
+};
+
+/** @brief Counter. */
+static rw_reg32_t const B_TIMx_CNT[8] = {
+  [6] = (rw_reg32_t)0x40001024U,
+  [7] = (rw_reg32_t)0x40001424U,
+};
+
+/** @brief Prescaler. */
+static rw_reg32_t const B_TIMx_PSC[8] = {
+  [6] = (rw_reg32_t)0x40001028U,
+  [7] = (rw_reg32_t)0x40001428U,
+};
+
+/** @brief Auto-reload register. */
+static rw_reg32_t const B_TIMx_ARR[8] = {
+  [6] = (rw_reg32_t)0x4000102CU,
+  [7] = (rw_reg32_t)0x4000142CU,
+};
+
+/** @subsection B_TIMx Register Field Definitions */
+
+static const field32_t B_TIMx_CR1_UIFREMAP = {.msk = 0x00000800U, .pos = 11}; /** @brief UIF status bit remapping. */
+static const field32_t B_TIMx_CR1_ARPE     = {.msk = 0x00000080U, .pos = 7};  /** @brief Auto-reload preload enable. */
+static const field32_t B_TIMx_CR1_OPM      = {.msk = 0x00000008U, .pos = 3};  /** @brief One-pulse mode. */
+static const field32_t B_TIMx_CR1_URS      = {.msk = 0x00000004U, .pos = 2};  /** @brief Update request source. */
+static const field32_t B_TIMx_CR1_UDIS     = {.msk = 0x00000002U, .pos = 1};  /** @brief Update disable. */
+static const field32_t B_TIMx_CR1_CEN      = {.msk = 0x00000001U, .pos = 0};  /** @brief Counter enable. */
+static const field32_t B_TIMx_CR2_MMS      = {.msk = 0x00000070U, .pos = 4};  /** @brief Master mode selection. */
+static const field32_t B_TIMx_DIER_UDE     = {.msk = 0x00000100U, .pos = 8};  /** @brief Update DMA request enable. */
+static const field32_t B_TIMx_DIER_UIE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt enable. */
+static const field32_t B_TIMx_SR_UIF       = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt flag. */
+static const field32_t B_TIMx_EGR_UG       = {.msk = 0x00000001U, .pos = 0};  /** @brief Update generation. */
+static const field32_t B_TIMx_CNT_CNT      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low counter value. */
+static const field32_t B_TIMx_CNT_UIFCPY   = {.msk = 0x80000000U, .pos = 31}; /** @brief UIF Copy. */
+static const field32_t B_TIMx_PSC_PSC      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t B_TIMx_ARR_ARR      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Auto-reload value. */
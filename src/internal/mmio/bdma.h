@@ -0,0 +1,266 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/bdma.h
+ * @authors UW SARP
+ * @brief Registers and fields of BDMA.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section BDMA Definitions
+ **************************************************************************************************/
+
+/** @subsection BDMA Register Definitions */
+
+static ro_reg32_t const BDMA_ISR  = (ro_reg32_t)0x58025400U; /** @brief DMA interrupt status register. */
+static rw_reg32_t const BDMA_IFCR = (rw_reg32_t)0x58025404U; /** @brief DMA interrupt flag clear register. */
+
+/** @subsection Enumerated BDMA Register Definitions */
+
+/** @brief DMA channel x configuration register. */
+static rw_reg32_t const BDMA_CCRx[9] = {
+  [1] = (rw_reg32_t)0x58025408U,
+  [2] = (rw_reg32_t)0x5802541CU,
+  [3] = (rw_reg32_t)0x58025430U,
+  [4] = (rw_reg32_t)0x58025444U,
+  [5] = (rw_reg32_t)0x58025458U,
+  [6] = (rw_reg32_t)0x5802546CU,
+  [7] = (rw_reg32_t)0x58025480U,
+  [8] = (rw_reg32_t)0x58025494U,
+};
+
+/** @brief DMA channel x number of data register. */
+static rw_reg32_t const BDMA_CNDTRx[9] = {
+  [1] = (rw_reg32_t)0x5802540CU,
+  [2] = (rw_reg32_t)0x58025420U,
+  [3] = (rw_reg32_t)0x58025434U,
+  [4] = (rw_reg32_t)0x58025448U,
+  [5] = (rw_reg32_t)0x5802545CU,
+  [6] = (rw_reg32_t)0x58025470U,
+  [7] = (rw_reg32_t)0x58025484U,
+  [8] = (rw_reg32_t)0x58025498U,
+};
+
+/** @brief This register must not be written when the channel is enabled. */
+static rw_reg32_t const BDMA_CPARx[9] = {
+  [1] = (rw_reg32_t)0x58025410U,
+  [2] = (rw_reg32_t)0x58025424U,
+  [3] = (rw_reg32_t)0x58025438U,
+  [4] = (rw_reg32_t)0x5802544CU,
+  [5] = (rw_reg32_t)0x58025460U,
+  [6] = (rw_reg32_t)0x58025474U,
+  [7] = (rw_reg32_t)0x58025488U,
+  [8] = (rw_reg32_t)0x5802549CU,
+};
+
+/** @brief This register must not be written when the channel is enabled. */
+static rw_reg32_t const BDMA_CMARx[9] = {
+  [1] = (rw_reg32_t)0x58025414U,
+  [2] = (rw_reg32_t)0x58025428U,
+  [3] = (rw_reg32_t)0x5802543CU,
+  [4] = (rw_reg32_t)0x58025450U,
+  [5] = (rw_reg32_t)0x58025464U,
+  [6] = (rw_reg32_t)0x58025478U,
+  [7] = (rw_reg32_t)0x5802548CU,
+  [8] = (rw_reg32_t)0x580254A0U,
+};
+
+/** @subsection BDMA Register Field Definitions */
+
+static const field32_t BDMA_ISR_GIF1     = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF1    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF1    = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF1    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF2     = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF2    = {.msk = 0x00000020U, .pos = 5};  /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF2    = {.msk = 0x00000040U, .pos = 6};  /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF2    = {.msk = 0x00000080U, .pos = 7};  /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF3     = {.msk = 0x00000100U, .pos = 8};  /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF3    = {.msk = 0x00000200U, .pos = 9};  /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF3    = {.msk = 0x00000400U, .pos = 10}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF3    = {.msk = 0x00000800U, .pos = 11}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF4     = {.msk = 0x00001000U, .pos = 12}; /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF4    = {.msk = 0x00002000U, .pos = 13}; /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF4    = {.msk = 0x00004000U, .pos = 14}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF4    = {.msk = 0x00008000U, .pos = 15}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF5     = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF5    = {.msk = 0x00020000U, .pos = 17}; /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF5    = {.msk = 0x00040000U, .pos = 18}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF5    = {.msk = 0x00080000U, .pos = 19}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF6     = {.msk = 0x00100000U, .pos = 20}; /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF6    = {.msk = 0x00200000U, .pos = 21}; /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF6    = {.msk = 0x00400000U, .pos = 22}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF6    = {.msk = 0x00800000U, .pos = 23}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF7     = {.msk = 0x01000000U, .pos = 24}; /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF7    = {.msk = 0x02000000U, .pos = 25}; /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF7    = {.msk = 0x04000000U, .pos = 26}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF7    = {.msk = 0x08000000U, .pos = 27}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIF8     = {.msk = 0x10000000U, .pos = 28}; /** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIF8    = {.msk = 0x20000000U, .pos = 29}; /** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIF8    = {.msk = 0x40000000U, .pos = 30}; /** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIF8    = {.msk = 0x80000000U, .pos = 31}; /** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_IFCR_CGIF1   = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF1  = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF1  = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF1  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF2   = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF2  = {.msk = 0x00000020U, .pos = 5};  /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF2  = {.msk = 0x00000040U, .pos = 6};  /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF2  = {.msk = 0x00000080U, .pos = 7};  /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF3   = {.msk = 0x00000100U, .pos = 8};  /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF3  = {.msk = 0x00000200U, .pos = 9};  /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF3  = {.msk = 0x00000400U, .pos = 10}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF3  = {.msk = 0x00000800U, .pos = 11}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF4   = {.msk = 0x00001000U, .pos = 12}; /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF4  = {.msk = 0x00002000U, .pos = 13}; /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF4  = {.msk = 0x00004000U, .pos = 14}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF4  = {.msk = 0x00008000U, .pos = 15}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF5   = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF5  = {.msk = 0x00020000U, .pos = 17}; /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF5  = {.msk = 0x00040000U, .pos = 18}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF5  = {.msk = 0x00080000U, .pos = 19}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF6   = {.msk = 0x00100000U, .pos = 20}; /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF6  = {.msk = 0x00200000U, .pos = 21}; /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF6  = {.msk = 0x00400000U, .pos = 22}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF6  = {.msk = 0x00800000U, .pos = 23}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF7   = {.msk = 0x01000000U, .pos = 24}; /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF7  = {.msk = 0x02000000U, .pos = 25}; /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF7  = {.msk = 0x04000000U, .pos = 26}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF7  = {.msk = 0x08000000U, .pos = 27}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIF8   = {.msk = 0x10000000U, .pos = 28}; /** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIF8  = {.msk = 0x20000000U, .pos = 29}; /** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIF8  = {.msk = 0x40000000U, .pos = 30}; /** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIF8  = {.msk = 0x80000000U, .pos = 31}; /** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_EN      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel enable This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_TCIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Transfer complete interrupt enable This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_HTIE    = {.msk = 0x00000004U, .pos = 2};  /** @brief Half transfer interrupt enable This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_TEIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Transfer error interrupt enable This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_DIR     = {.msk = 0x00000010U, .pos = 4};  /** @brief Data transfer direction This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_CIRC    = {.msk = 0x00000020U, .pos = 5};  /** @brief Circular mode This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_PINC    = {.msk = 0x00000040U, .pos = 6};  /** @brief Peripheral increment mode This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_MINC    = {.msk = 0x00000080U, .pos = 7};  /** @brief Memory increment mode This bit is set and cleared by software. */
+static const field32_t BDMA_CCRx_PSIZE   = {.msk = 0x00000300U, .pos = 8};  /** @brief Peripheral size These bits are set and cleared by software. */
+static const field32_t BDMA_CCRx_MSIZE   = {.msk = 0x00000C00U, .pos = 10}; /** @brief Memory size These bits are set and cleared by software. */
+static const field32_t BDMA_CCRx_PL      = {.msk = 0x00003000U, .pos = 12}; /** @brief Channel priority level These bits are set and cleared by software. */
+static const field32_t BDMA_CCRx_MEM2MEM = {.msk = 0x00004000U, .pos = 14}; /** @brief Memory to memory mode This bit is set and cleared by software. */
+static const field32_t BDMA_CNDTRx_NDT   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Number of data to transfer Number of data to be transferred (0 up to 65535). This register can only be written when the channel is disabled. Once the channel is enabled, this register is read-only, indicating the remaining bytes to be transmitted. This register decrements after each DMA transfer. Once the transfer is completed, this register can either stay at zero or be reloaded automatically by the value previously programmed if the channel is configured in auto-reload mode. If this register is zero, no transaction can be served whether the channel is enabled or not. */
+
+/** @subsection Enumerated BDMA Register Field Definitions */
+
+/** @brief Channel x global interrupt flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_GIFx[9] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00100000U, .pos = 20},
+  [7] = {.msk = 0x01000000U, .pos = 24},
+  [8] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief Channel x transfer complete flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TCIFx[9] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00020000U, .pos = 17},
+  [6] = {.msk = 0x00200000U, .pos = 21},
+  [7] = {.msk = 0x02000000U, .pos = 25},
+  [8] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief Channel x half transfer flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_HTIFx[9] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00004000U, .pos = 14},
+  [5] = {.msk = 0x00040000U, .pos = 18},
+  [6] = {.msk = 0x00400000U, .pos = 22},
+  [7] = {.msk = 0x04000000U, .pos = 26},
+  [8] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Channel x transfer error flag (x = 1..8) This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCR register. */
+static const field32_t BDMA_ISR_TEIFx[9] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00080000U, .pos = 19},
+  [6] = {.msk = 0x00800000U, .pos = 23},
+  [7] = {.msk = 0x08000000U, .pos = 27},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Channel x global interrupt clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CGIFx[9] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00100000U, .pos = 20},
+  [7] = {.msk = 0x01000000U, .pos = 24},
+  [8] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief Channel x transfer complete clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTCIFx[9] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00020000U, .pos = 17},
+  [6] = {.msk = 0x00200000U, .pos = 21},
+  [7] = {.msk = 0x02000000U, .pos = 25},
+  [8] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief Channel x half transfer clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CHTIFx[9] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00004000U, .pos = 14},
+  [5] = {.msk = 0x00040000U, .pos = 18},
+  [6] = {.msk = 0x00400000U, .pos = 22},
+  [7] = {.msk = 0x04000000U, .pos = 26},
+  [8] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Channel x transfer error clear This bit is set and cleared by software. */
+static const field32_t BDMA_IFCR_CTEIFx[9] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00080000U, .pos = 19},
+  [6] = {.msk = 0x00800000U, .pos = 23},
+  [7] = {.msk = 0x08000000U, .pos = 27},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
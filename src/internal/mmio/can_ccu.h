@@ -0,0 +1,66 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/can_ccu.h
+ * @authors UW SARP
+ * @brief Registers and fields of CAN_CCU.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section CAN_CCU Definitions
+ **************************************************************************************************/
+
+/** @subsection CAN_CCU Register Definitions */
+
+static rw_reg32_t const CAN_CCU_CREL  = (rw_reg32_t)0x4000A800U; /** @brief Clock Calibration Unit Core Release Register. */
+static rw_reg32_t const CAN_CCU_CCFG  = (rw_reg32_t)0x4000A804U; /** @brief Calibration Configuration Register. */
+static rw_reg32_t const CAN_CCU_CSTAT = (rw_reg32_t)0x4000A808U; /** @brief Calibration Status Register. */
+static rw_reg32_t const CAN_CCU_CWD   = (rw_reg32_t)0x4000A80CU; /** @brief Calibration Watchdog Register. */
+static rw_reg32_t const CAN_CCU_IR    = (rw_reg32_t)0x4000A810U; /** @brief Clock Calibration Unit Interrupt Register. */
+static rw_reg32_t const CAN_CCU_IE    = (rw_reg32_t)0x4000A814U; /** @brief Clock Calibration Unit Interrupt Enable Register. */
+
+/** @subsection CAN_CCU Register Field Definitions */
+
+static const field32_t CAN_CCU_CREL_DAY     = {.msk = 0x000000FFU, .pos = 0};  /** @brief Time Stamp Day. */
+static const field32_t CAN_CCU_CREL_MON     = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Time Stamp Month. */
+static const field32_t CAN_CCU_CREL_YEAR    = {.msk = 0x000F0000U, .pos = 16}; /** @brief Time Stamp Year. */
+static const field32_t CAN_CCU_CREL_SUBSTEP = {.msk = 0x00F00000U, .pos = 20}; /** @brief Sub-step of Core Release. */
+static const field32_t CAN_CCU_CREL_STEP    = {.msk = 0x0F000000U, .pos = 24}; /** @brief Step of Core Release. */
+static const field32_t CAN_CCU_CREL_REL     = {.msk = 0xF0000000U, .pos = 28}; /** @brief Core Release. */
+static const field32_t CAN_CCU_CCFG_TQBT    = {.msk = 0x0000001FU, .pos = 0};  /** @brief Time Quanta per Bit Time. */
+static const field32_t CAN_CCU_CCFG_BCC     = {.msk = 0x00000040U, .pos = 6};  /** @brief Bypass Clock Calibration. */
+static const field32_t CAN_CCU_CCFG_CFL     = {.msk = 0x00000080U, .pos = 7};  /** @brief Calibration Field Length. */
+static const field32_t CAN_CCU_CCFG_OCPM    = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Oscillator Clock Periods Minimum. */
+static const field32_t CAN_CCU_CCFG_CDIV    = {.msk = 0x000F0000U, .pos = 16}; /** @brief Clock Divider. */
+static const field32_t CAN_CCU_CCFG_SWR     = {.msk = 0x80000000U, .pos = 31}; /** @brief Software Reset. */
+static const field32_t CAN_CCU_CSTAT_OCPC   = {.msk = 0x0003FFFFU, .pos = 0};  /** @brief Oscillator Clock Period Counter. */
+static const field32_t CAN_CCU_CSTAT_TQC    = {.msk = 0x1FFC0000U, .pos = 18}; /** @brief Time Quanta Counter. */
+static const field32_t CAN_CCU_CSTAT_CALS   = {.msk = 0xC0000000U, .pos = 30}; /** @brief Calibration State. */
+static const field32_t CAN_CCU_CWD_WDC      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief WDC. */
+static const field32_t CAN_CCU_CWD_WDV      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief WDV. */
+static const field32_t CAN_CCU_IR_CWE       = {.msk = 0x00000001U, .pos = 0};  /** @brief Calibration Watchdog Event. */
+static const field32_t CAN_CCU_IR_CSC       = {.msk = 0x00000002U, .pos = 1};  /** @brief Calibration State Changed. */
+static const field32_t CAN_CCU_IE_CWEE      = {.msk = 0x00000001U, .pos = 0};  /** @brief Calibration Watchdog Event Enable. */
+static const field32_t CAN_CCU_IE_CSCE      = {.msk = 0x00000002U, .pos = 1};  /** @brief Calibration State Changed Enable. */
@@ -0,0 +1,85 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/cec.h
+ * @authors UW SARP
+ * @brief Registers and fields of CEC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section CEC Definitions
+ **************************************************************************************************/
+
+/** @subsection CEC Register Definitions */
+
+static rw_reg32_t const CEC_CR   = (rw_reg32_t)0x40006C00U; /** @brief CEC control register. */
+static rw_reg32_t const CEC_CFGR = (rw_reg32_t)0x40006C04U; /** @brief This register is used to configure the HDMI-CEC controller. It is mandatory to write CEC_CFGR only when CECEN=0. */
+static rw_reg32_t const CEC_TXDR = (rw_reg32_t)0x40006C08U; /** @brief CEC Tx data register. */
+static ro_reg32_t const CEC_RXDR = (ro_reg32_t)0x40006C0CU; /** @brief CEC Rx Data Register. */
+static rw_reg32_t const CEC_ISR  = (rw_reg32_t)0x40006C10U; /** @brief CEC Interrupt and Status Register. */
+static rw_reg32_t const CEC_IER  = (rw_reg32_t)0x40006C14U; /** @brief CEC interrupt enable register. */
+
+/** @subsection CEC Register Field Definitions */
+
+static const field32_t CEC_CR_CECEN      = {.msk = 0x00000001U, .pos = 0};  /** @brief CEC Enable The CECEN bit is set and cleared by software. CECEN=1 starts message reception and enables the TXSOM control. CECEN=0 disables the CEC peripheral, clears all bits of CEC_CR register and aborts any on-going reception or transmission. */
+static const field32_t CEC_CR_TXSOM      = {.msk = 0x00000002U, .pos = 1};  /** @brief Tx Start Of Message TXSOM is set by software to command transmission of the first byte of a CEC message. If the CEC message consists of only one byte, TXEOM must be set before of TXSOM. Start-Bit is effectively started on the CEC line after SFT is counted. If TXSOM is set while a message reception is ongoing, transmission will start after the end of reception. TXSOM is cleared by hardware after the last byte of the message is sent with a positive acknowledge (TXEND=1), in case of transmission underrun (TXUDR=1), negative acknowledge (TXACKE=1), and transmission error (TXERR=1). It is also cleared by CECEN=0. It is not cleared and transmission is automatically retried in case of arbitration lost (ARBLST=1). TXSOM can be also used as a status bit informing application whether any transmission request is pending or under execution. The application can abort a transmission request at any time by clearing the CECEN bit. Note: TXSOM must be set when CECEN=1 TXSOM must be set when transmission data is available into TXDR HEADERs first four bits containing own peripheral address are taken from TXDR[7:4], not from CEC_CFGR.OAR which is used only for reception. */
+static const field32_t CEC_CR_TXEOM      = {.msk = 0x00000004U, .pos = 2};  /** @brief Tx End Of Message The TXEOM bit is set by software to command transmission of the last byte of a CEC message. TXEOM is cleared by hardware at the same time and under the same conditions as for TXSOM. Note: TXEOM must be set when CECEN=1 TXEOM must be set before writing transmission data to TXDR If TXEOM is set when TXSOM=0, transmitted message will consist of 1 byte (HEADER) only (PING message). */
+static const field32_t CEC_CFGR_SFT      = {.msk = 0x00000007U, .pos = 0};  /** @brief Signal Free Time SFT bits are set by software. In the SFT=0x0 configuration the number of nominal data bit periods waited before transmission is ruled by hardware according to the transmission history. In all the other configurations the SFT number is determined by software. * 0x0 ** 2.5 Data-Bit periods if CEC is the last bus initiator with unsuccessful transmission (ARBLST=1, TXERR=1, TXUDR=1 or TXACKE= 1) ** 4 Data-Bit periods if CEC is the new bus initiator ** 6 Data-Bit periods if CEC is the last bus initiator with successful transmission (TXEOM=1) * 0x1: 0.5 nominal data bit periods * 0x2: 1.5 nominal data bit periods * 0x3: 2.5 nominal data bit periods * 0x4: 3.5 nominal data bit periods * 0x5: 4.5 nominal data bit periods * 0x6: 5.5 nominal data bit periods * 0x7: 6.5 nominal data bit periods. */
+static const field32_t CEC_CFGR_RXTOL    = {.msk = 0x00000008U, .pos = 3};  /** @brief Rx-Tolerance The RXTOL bit is set and cleared by software. ** Start-Bit, +/- 200 s rise, +/- 200 s fall. ** Data-Bit: +/- 200 s rise. +/- 350 s fall. ** Start-Bit: +/- 400 s rise, +/- 400 s fall ** Data-Bit: +/-300 s rise, +/- 500 s fall. */
+static const field32_t CEC_CFGR_BRESTP   = {.msk = 0x00000010U, .pos = 4};  /** @brief Rx-Stop on Bit Rising Error The BRESTP bit is set and cleared by software. */
+static const field32_t CEC_CFGR_BREGEN   = {.msk = 0x00000020U, .pos = 5};  /** @brief Generate Error-Bit on Bit Rising Error The BREGEN bit is set and cleared by software. Note: If BRDNOGEN=0, an Error-bit is generated upon BRE detection with BRESTP=1 in broadcast even if BREGEN=0. */
+static const field32_t CEC_CFGR_LBPEGEN  = {.msk = 0x00000040U, .pos = 6};  /** @brief Generate Error-Bit on Long Bit Period Error The LBPEGEN bit is set and cleared by software. Note: If BRDNOGEN=0, an Error-bit is generated upon LBPE detection in broadcast even if LBPEGEN=0. */
+static const field32_t CEC_CFGR_BRDNOGEN = {.msk = 0x00000080U, .pos = 7};  /** @brief Avoid Error-Bit Generation in Broadcast The BRDNOGEN bit is set and cleared by software. */
+static const field32_t CEC_CFGR_SFTOPT   = {.msk = 0x00000100U, .pos = 8};  /** @brief SFT Option Bit The SFTOPT bit is set and cleared by software. */
+static const field32_t CEC_CFGR_OAR      = {.msk = 0x7FFF0000U, .pos = 16}; /** @brief Own addresses configuration The OAR bits are set by software to select which destination logical addresses has to be considered in receive mode. Each bit, when set, enables the CEC logical address identified by the given bit position. At the end of HEADER reception, the received destination address is compared with the enabled addresses. In case of matching address, the incoming message is acknowledged and received. In case of non-matching address, the incoming message is received only in listen mode (LSTN=1), but without acknowledge sent. Broadcast messages are always received. Example: OAR = 0b000 0000 0010 0001 means that CEC acknowledges addresses 0x0 and 0x5. Consequently, each message directed to one of these addresses is received. */
+static const field32_t CEC_CFGR_LSTN     = {.msk = 0x80000000U, .pos = 31}; /** @brief Listen mode LSTN bit is set and cleared by software. */
+static const field32_t CEC_TXDR_TXD      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Tx Data register. TXD is a write-only register containing the data byte to be transmitted. Note: TXD must be written when TXSTART=1. */
+static const field32_t CEC_RXDR_RXD      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Rx Data register. RXD is read-only and contains the last data byte which has been received from the CEC line. */
+static const field32_t CEC_ISR_RXBR      = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx-Byte Received The RXBR bit is set by hardware to inform application that a new byte has been received from the CEC line and stored into the RXD buffer. RXBR is cleared by software write at 1. */
+static const field32_t CEC_ISR_RXEND     = {.msk = 0x00000002U, .pos = 1};  /** @brief End Of Reception RXEND is set by hardware to inform application that the last byte of a CEC message is received from the CEC line and stored into the RXD buffer. RXEND is set at the same time of RXBR. RXEND is cleared by software write at 1. */
+static const field32_t CEC_ISR_RXOVR     = {.msk = 0x00000004U, .pos = 2};  /** @brief Rx-Overrun RXOVR is set by hardware if RXBR is not yet cleared at the time a new byte is received on the CEC line and stored into RXD. RXOVR assertion stops message reception so that no acknowledge is sent. In case of broadcast, a negative acknowledge is sent. RXOVR is cleared by software write at 1. */
+static const field32_t CEC_ISR_BRE       = {.msk = 0x00000008U, .pos = 3};  /** @brief Rx-Bit Rising Error BRE is set by hardware in case a Data-Bit waveform is detected with Bit Rising Error. BRE is set either at the time the misplaced rising edge occurs, or at the end of the maximum BRE tolerance allowed by RXTOL, in case rising edge is still longing. BRE stops message reception if BRESTP=1. BRE generates an Error-Bit on the CEC line if BREGEN=1. BRE is cleared by software write at 1. */
+static const field32_t CEC_ISR_SBPE      = {.msk = 0x00000010U, .pos = 4};  /** @brief Rx-Short Bit Period Error SBPE is set by hardware in case a Data-Bit waveform is detected with Short Bit Period Error. SBPE is set at the time the anticipated falling edge occurs. SBPE generates an Error-Bit on the CEC line. SBPE is cleared by software write at 1. */
+static const field32_t CEC_ISR_LBPE      = {.msk = 0x00000020U, .pos = 5};  /** @brief Rx-Long Bit Period Error LBPE is set by hardware in case a Data-Bit waveform is detected with Long Bit Period Error. LBPE is set at the end of the maximum bit-extension tolerance allowed by RXTOL, in case falling edge is still longing. LBPE always stops reception of the CEC message. LBPE generates an Error-Bit on the CEC line if LBPEGEN=1. In case of broadcast, Error-Bit is generated even in case of LBPEGEN=0. LBPE is cleared by software write at 1. */
+static const field32_t CEC_ISR_RXACKE    = {.msk = 0x00000040U, .pos = 6};  /** @brief Rx-Missing Acknowledge In receive mode, RXACKE is set by hardware to inform application that no acknowledge was seen on the CEC line. RXACKE applies only for broadcast messages and in listen mode also for not directly addressed messages (destination address not enabled in OAR). RXACKE aborts message reception. RXACKE is cleared by software write at 1. */
+static const field32_t CEC_ISR_ARBLST    = {.msk = 0x00000080U, .pos = 7};  /** @brief Arbitration Lost ARBLST is set by hardware to inform application that CEC device is switching to reception due to arbitration lost event following the TXSOM command. ARBLST can be due either to a contending CEC device starting earlier or starting at the same time but with higher HEADER priority. After ARBLST assertion TXSOM bit keeps pending for next transmission attempt. ARBLST is cleared by software write at 1. */
+static const field32_t CEC_ISR_TXBR      = {.msk = 0x00000100U, .pos = 8};  /** @brief Tx-Byte Request TXBR is set by hardware to inform application that the next transmission data has to be written to TXDR. TXBR is set when the 4th bit of currently transmitted byte is sent. Application must write the next byte to TXDR within 6 nominal data-bit periods before transmission underrun error occurs (TXUDR). TXBR is cleared by software write at 1. */
+static const field32_t CEC_ISR_TXEND     = {.msk = 0x00000200U, .pos = 9};  /** @brief End of Transmission TXEND is set by hardware to inform application that the last byte of the CEC message has been successfully transmitted. TXEND clears the TXSOM and TXEOM control bits. TXEND is cleared by software write at 1. */
+static const field32_t CEC_ISR_TXUDR     = {.msk = 0x00000400U, .pos = 10}; /** @brief Tx-Buffer Underrun In transmission mode, TXUDR is set by hardware if application was not in time to load TXDR before of next byte transmission. TXUDR aborts message transmission and clears TXSOM and TXEOM control bits. TXUDR is cleared by software write at 1. */
+static const field32_t CEC_ISR_TXERR     = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx-Error In transmission mode, TXERR is set by hardware if the CEC initiator detects low impedance on the CEC line while it is released. TXERR aborts message transmission and clears TXSOM and TXEOM controls. TXERR is cleared by software write at 1. */
+static const field32_t CEC_ISR_TXACKE    = {.msk = 0x00001000U, .pos = 12}; /** @brief Tx-Missing Acknowledge Error In transmission mode, TXACKE is set by hardware to inform application that no acknowledge was received. In case of broadcast transmission, TXACKE informs application that a negative acknowledge was received. TXACKE aborts message transmission and clears TXSOM and TXEOM controls. TXACKE is cleared by software write at 1. */
+static const field32_t CEC_IER_RXBRIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx-Byte Received Interrupt Enable The RXBRIE bit is set and cleared by software. */
+static const field32_t CEC_IER_RXENDIE   = {.msk = 0x00000002U, .pos = 1};  /** @brief End Of Reception Interrupt Enable The RXENDIE bit is set and cleared by software. */
+static const field32_t CEC_IER_RXOVRIE   = {.msk = 0x00000004U, .pos = 2};  /** @brief Rx-Buffer Overrun Interrupt Enable The RXOVRIE bit is set and cleared by software. */
+static const field32_t CEC_IER_BREIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Bit Rising Error Interrupt Enable The BREIE bit is set and cleared by software. */
+static const field32_t CEC_IER_SBPEIE    = {.msk = 0x00000010U, .pos = 4};  /** @brief Short Bit Period Error Interrupt Enable The SBPEIE bit is set and cleared by software. */
+static const field32_t CEC_IER_LBPEIE    = {.msk = 0x00000020U, .pos = 5};  /** @brief Long Bit Period Error Interrupt Enable The LBPEIE bit is set and cleared by software. */
+static const field32_t CEC_IER_RXACKIE   = {.msk = 0x00000040U, .pos = 6};  /** @brief Rx-Missing Acknowledge Error Interrupt Enable The RXACKIE bit is set and cleared by software. */
+static const field32_t CEC_IER_ARBLSTIE  = {.msk = 0x00000080U, .pos = 7};  /** @brief Arbitration Lost Interrupt Enable The ARBLSTIE bit is set and cleared by software. */
+static const field32_t CEC_IER_TXBRIE    = {.msk = 0x00000100U, .pos = 8};  /** @brief Tx-Byte Request Interrupt Enable The TXBRIE bit is set and cleared by software. */
+static const field32_t CEC_IER_TXENDIE   = {.msk = 0x00000200U, .pos = 9};  /** @brief Tx-End Of Message Interrupt Enable The TXENDIE bit is set and cleared by software. */
+static const field32_t CEC_IER_TXUDRIE   = {.msk = 0x00000400U, .pos = 10}; /** @brief Tx-Underrun Interrupt Enable The TXUDRIE bit is set and cleared by software. */
+static const field32_t CEC_IER_TXERRIE   = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx-Error Interrupt Enable The TXERRIE bit is set and cleared by software. */
+static const field32_t CEC_IER_TXACKIE   = {.msk = 0x00001000U, .pos = 12}; /** @brief Tx-Missing Acknowledge Error Interrupt Enable The TXACKEIE bit is set and cleared by software. */
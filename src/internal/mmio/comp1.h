@@ -0,0 +1,95 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/comp1.h
+ * @authors UW SARP
+ * @brief Registers and fields of COMP1.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section COMP1 Definitions
+ **************************************************************************************************/
+
+/** @subsection COMP1 Register Definitions */
+
+static ro_reg32_t const COMP1_SR    = (ro_reg32_t)0x58003800U; /** @brief Comparator status register. */
+static rw_reg32_t const COMP1_ICFR  = (rw_reg32_t)0x58003804U; /** @brief Comparator interrupt clear flag register. */
+static rw_reg32_t const COMP1_OR    = (rw_reg32_t)0x58003808U; /** @brief Comparator option register. */
+static rw_reg32_t const COMP1_CFGR1 = (rw_reg32_t)0x5800380CU; /** @brief Comparator configuration register 1. */
+static rw_reg32_t const COMP1_CFGR2 = (rw_reg32_t)0x58003810U; /** @brief Comparator configuration register 2. */
+
+/** @subsection COMP1 Register Field Definitions */
+
+static const field32_t COMP1_SR_C1VAL       = {.msk = 0x00000001U, .pos = 0};  /** @brief COMP channel 1 output status bit. */
+static const field32_t COMP1_SR_C2VAL       = {.msk = 0x00000002U, .pos = 1};  /** @brief COMP channel 2 output status bit. */
+static const field32_t COMP1_SR_C1IF        = {.msk = 0x00010000U, .pos = 16}; /** @brief COMP channel 1 Interrupt Flag. */
+static const field32_t COMP1_SR_C2IF        = {.msk = 0x00020000U, .pos = 17}; /** @brief COMP channel 2 Interrupt Flag. */
+static const field32_t COMP1_ICFR_CC1IF     = {.msk = 0x00010000U, .pos = 16}; /** @brief Clear COMP channel 1 Interrupt Flag. */
+static const field32_t COMP1_ICFR_CC2IF     = {.msk = 0x00020000U, .pos = 17}; /** @brief Clear COMP channel 2 Interrupt Flag. */
+static const field32_t COMP1_OR_AFOP        = {.msk = 0x000007FFU, .pos = 0};  /** @brief Selection of source for alternate function of output ports. */
+static const field32_t COMP1_OR_OR          = {.msk = 0xFFFFF800U, .pos = 11}; /** @brief Option Register. */
+static const field32_t COMP1_CFGR1_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief COMP channel 1 enable bit. */
+static const field32_t COMP1_CFGR1_BRGEN    = {.msk = 0x00000002U, .pos = 1};  /** @brief Scaler bridge enable. */
+static const field32_t COMP1_CFGR1_SCALEN   = {.msk = 0x00000004U, .pos = 2};  /** @brief Voltage scaler enable bit. */
+static const field32_t COMP1_CFGR1_POLARITY = {.msk = 0x00000008U, .pos = 3};  /** @brief COMP channel 1 polarity selection bit. */
+static const field32_t COMP1_CFGR1_ITEN     = {.msk = 0x00000040U, .pos = 6};  /** @brief COMP channel 1 interrupt enable. */
+static const field32_t COMP1_CFGR1_HYST     = {.msk = 0x00000300U, .pos = 8};  /** @brief COMP channel 1 hysteresis selection bits. */
+static const field32_t COMP1_CFGR1_PWRMODE  = {.msk = 0x00003000U, .pos = 12}; /** @brief Power Mode of the COMP channel 1. */
+static const field32_t COMP1_CFGR1_INMSEL   = {.msk = 0x00070000U, .pos = 16}; /** @brief COMP channel 1 inverting input selection field. */
+static const field32_t COMP1_CFGR1_INPSEL   = {.msk = 0x00100000U, .pos = 20}; /** @brief COMP channel 1 non-inverting input selection bit. */
+static const field32_t COMP1_CFGR1_BLANKING = {.msk = 0x0F000000U, .pos = 24}; /** @brief COMP channel 1 blanking source selection bits. */
+static const field32_t COMP1_CFGR1_LOCK     = {.msk = 0x80000000U, .pos = 31}; /** @brief Lock bit. */
+static const field32_t COMP1_CFGR2_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief COMP channel 1 enable bit. */
+static const field32_t COMP1_CFGR2_BRGEN    = {.msk = 0x00000002U, .pos = 1};  /** @brief Scaler bridge enable. */
+static const field32_t COMP1_CFGR2_SCALEN   = {.msk = 0x00000004U, .pos = 2};  /** @brief Voltage scaler enable bit. */
+static const field32_t COMP1_CFGR2_POLARITY = {.msk = 0x00000008U, .pos = 3};  /** @brief COMP channel 1 polarity selection bit. */
+static const field32_t COMP1_CFGR2_WINMODE  = {.msk = 0x00000010U, .pos = 4};  /** @brief Window comparator mode selection bit. */
+static const field32_t COMP1_CFGR2_ITEN     = {.msk = 0x00000040U, .pos = 6};  /** @brief COMP channel 1 interrupt enable. */
+static const field32_t COMP1_CFGR2_HYST     = {.msk = 0x00000300U, .pos = 8};  /** @brief COMP channel 1 hysteresis selection bits. */
+static const field32_t COMP1_CFGR2_PWRMODE  = {.msk = 0x00003000U, .pos = 12}; /** @brief Power Mode of the COMP channel 1. */
+static const field32_t COMP1_CFGR2_INMSEL   = {.msk = 0x00070000U, .pos = 16}; /** @brief COMP channel 1 inverting input selection field. */
+static const field32_t COMP1_CFGR2_INPSEL   = {.msk = 0x00100000U, .pos = 20}; /** @brief COMP channel 1 non-inverting input selection bit. */
+static const field32_t COMP1_CFGR2_BLANKING = {.msk = 0x0F000000U, .pos = 24}; /** @brief COMP channel 1 blanking source selection bits. */
+static const field32_t COMP1_CFGR2_LOCK     = {.msk = 0x80000000U, .pos = 31}; /** @brief Lock bit. */
+
+/** @subsection Enumerated COMP1 Register Field Definitions */
+
+/** @brief COMP channel 1 output status bit. */
+static const field32_t COMP1_SR_CxVAL[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief COMP channel 1 Interrupt Flag. */
+static const field32_t COMP1_SR_CxIF[3] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief Clear COMP channel 1 Interrupt Flag. */
+static const field32_t COMP1_ICFR_CCxIF[3] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+};
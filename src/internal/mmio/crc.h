@@ -0,0 +1,48 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/crc.h
+ * @authors UW SARP
+ * @brief Registers and fields of CRC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section CRC Definitions
+ **************************************************************************************************/
+
+/** @subsection CRC Register Definitions */
+
+static rw_reg32_t const CRC_DR   = (rw_reg32_t)0x58024C00U; /** @brief Data register. */
+static rw_reg32_t const CRC_IDR  = (rw_reg32_t)0x58024C04U; /** @brief Independent Data register. */
+static rw_reg32_t const CRC_CR   = (rw_reg32_t)0x58024C08U; /** @brief Control register. */
+static rw_reg32_t const CRC_INIT = (rw_reg32_t)0x58024C10U; /** @brief Initial CRC value. */
+static rw_reg32_t const CRC_POL  = (rw_reg32_t)0x58024C14U; /** @brief CRC polynomial. */
+
+/** @subsection CRC Register Field Definitions */
+
+static const field32_t CRC_CR_RESET    = {.msk = 0x00000001U, .pos = 0}; /** @brief RESET bit. */
+static const field32_t CRC_CR_POLYSIZE = {.msk = 0x00000018U, .pos = 3}; /** @brief Polynomial size. */
+static const field32_t CRC_CR_REV_IN   = {.msk = 0x00000060U, .pos = 5}; /** @brief Reverse input data. */
+static const field32_t CRC_CR_REV_OUT  = {.msk = 0x00000080U, .pos = 7}; /** @brief Reverse output data. */
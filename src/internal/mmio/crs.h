@@ -0,0 +1,69 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/crs.h
+ * @authors UW SARP
+ * @brief Registers and fields of CRS.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section CRS Definitions
+ **************************************************************************************************/
+
+/** @subsection CRS Register Definitions */
+
+static rw_reg32_t const CRS_CR   = (rw_reg32_t)0x40008400U; /** @brief CRS control register. */
+static rw_reg32_t const CRS_CFGR = (rw_reg32_t)0x40008404U; /** @brief This register can be written only when the frequency error counter is disabled (CEN bit is cleared in CRS_CR). When the counter is enabled, this register is write-protected. */
+static ro_reg32_t const CRS_ISR  = (ro_reg32_t)0x40008408U; /** @brief CRS interrupt and status register. */
+static rw_reg32_t const CRS_ICR  = (rw_reg32_t)0x4000840CU; /** @brief CRS interrupt flag clear register. */
+
+/** @subsection CRS Register Field Definitions */
+
+static const field32_t CRS_CR_SYNCOKIE   = {.msk = 0x00000001U, .pos = 0};  /** @brief SYNC event OK interrupt enable. */
+static const field32_t CRS_CR_SYNCWARNIE = {.msk = 0x00000002U, .pos = 1};  /** @brief SYNC warning interrupt enable. */
+static const field32_t CRS_CR_ERRIE      = {.msk = 0x00000004U, .pos = 2};  /** @brief Synchronization or trimming error interrupt enable. */
+static const field32_t CRS_CR_ESYNCIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Expected SYNC interrupt enable. */
+static const field32_t CRS_CR_CEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief Frequency error counter enable This bit enables the oscillator clock for the frequency error counter. When this bit is set, the CRS_CFGR register is write-protected and cannot be modified. */
+static const field32_t CRS_CR_AUTOTRIMEN = {.msk = 0x00000040U, .pos = 6};  /** @brief Automatic trimming enable This bit enables the automatic hardware adjustment of TRIM bits according to the measured frequency error between two SYNC events. If this bit is set, the TRIM bits are read-only. The TRIM value can be adjusted by hardware by one or two steps at a time, depending on the measured frequency error value. Refer to Section7.3.4: Frequency error evaluation and automatic trimming for more details. */
+static const field32_t CRS_CR_SWSYNC     = {.msk = 0x00000080U, .pos = 7};  /** @brief Generate software SYNC event This bit is set by software in order to generate a software SYNC event. It is automatically cleared by hardware. */
+static const field32_t CRS_CR_TRIM       = {.msk = 0x00003F00U, .pos = 8};  /** @brief HSI48 oscillator smooth trimming These bits provide a user-programmable trimming value to the HSI48 oscillator. They can be programmed to adjust to variations in voltage and temperature that influence the frequency of the HSI48. The default value is 32, which corresponds to the middle of the trimming interval. The trimming step is around 67 kHz between two consecutive TRIM steps. A higher TRIM value corresponds to a higher output frequency. When the AUTOTRIMEN bit is set, this field is controlled by hardware and is read-only. */
+static const field32_t CRS_CFGR_RELOAD   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter reload value RELOAD is the value to be loaded in the frequency error counter with each SYNC event. Refer to Section7.3.3: Frequency error measurement for more details about counter behavior. */
+static const field32_t CRS_CFGR_FELIM    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Frequency error limit FELIM contains the value to be used to evaluate the captured frequency error value latched in the FECAP[15:0] bits of the CRS_ISR register. Refer to Section7.3.4: Frequency error evaluation and automatic trimming for more details about FECAP evaluation. */
+static const field32_t CRS_CFGR_SYNCDIV  = {.msk = 0x07000000U, .pos = 24}; /** @brief SYNC divider These bits are set and cleared by software to control the division factor of the SYNC signal. */
+static const field32_t CRS_CFGR_SYNCSRC  = {.msk = 0x30000000U, .pos = 28}; /** @brief SYNC signal source selection These bits are set and cleared by software to select the SYNC signal source. Note: When using USB LPM (Link Power Management) and the device is in Sleep mode, the periodic USB SOF will not be generated by the host. No SYNC signal will therefore be provided to the CRS to calibrate the HSI48 on the run. To guarantee the required clock precision after waking up from Sleep mode, the LSE or reference clock on the GPIOs should be used as SYNC signal. */
+static const field32_t CRS_CFGR_SYNCPOL  = {.msk = 0x80000000U, .pos = 31}; /** @brief SYNC polarity selection This bit is set and cleared by software to select the input polarity for the SYNC signal source. */
+static const field32_t CRS_ISR_SYNCOKF   = {.msk = 0x00000001U, .pos = 0};  /** @brief SYNC event OK flag This flag is set by hardware when the measured frequency error is smaller than FELIM * 3. This means that either no adjustment of the TRIM value is needed or that an adjustment by one trimming step is enough to compensate the frequency error. An interrupt is generated if the SYNCOKIE bit is set in the CRS_CR register. It is cleared by software by setting the SYNCOKC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_SYNCWARNF = {.msk = 0x00000002U, .pos = 1};  /** @brief SYNC warning flag This flag is set by hardware when the measured frequency error is greater than or equal to FELIM * 3, but smaller than FELIM * 128. This means that to compensate the frequency error, the TRIM value must be adjusted by two steps or more. An interrupt is generated if the SYNCWARNIE bit is set in the CRS_CR register. It is cleared by software by setting the SYNCWARNC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_ERRF      = {.msk = 0x00000004U, .pos = 2};  /** @brief Error flag This flag is set by hardware in case of any synchronization or trimming error. It is the logical OR of the TRIMOVF, SYNCMISS and SYNCERR bits. An interrupt is generated if the ERRIE bit is set in the CRS_CR register. It is cleared by software in reaction to setting the ERRC bit in the CRS_ICR register, which clears the TRIMOVF, SYNCMISS and SYNCERR bits. */
+static const field32_t CRS_ISR_ESYNCF    = {.msk = 0x00000008U, .pos = 3};  /** @brief Expected SYNC flag This flag is set by hardware when the frequency error counter reached a zero value. An interrupt is generated if the ESYNCIE bit is set in the CRS_CR register. It is cleared by software by setting the ESYNCC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_SYNCERR   = {.msk = 0x00000100U, .pos = 8};  /** @brief SYNC error This flag is set by hardware when the SYNC pulse arrives before the ESYNC event and the measured frequency error is greater than or equal to FELIM * 128. This means that the frequency error is too big (internal frequency too low) to be compensated by adjusting the TRIM value, and that some other action should be taken. An interrupt is generated if the ERRIE bit is set in the CRS_CR register. It is cleared by software by setting the ERRC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_SYNCMISS  = {.msk = 0x00000200U, .pos = 9};  /** @brief SYNC missed This flag is set by hardware when the frequency error counter reached value FELIM * 128 and no SYNC was detected, meaning either that a SYNC pulse was missed or that the frequency error is too big (internal frequency too high) to be compensated by adjusting the TRIM value, and that some other action should be taken. At this point, the frequency error counter is stopped (waiting for a next SYNC) and an interrupt is generated if the ERRIE bit is set in the CRS_CR register. It is cleared by software by setting the ERRC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_TRIMOVF   = {.msk = 0x00000400U, .pos = 10}; /** @brief Trimming overflow or underflow This flag is set by hardware when the automatic trimming tries to over- or under-flow the TRIM value. An interrupt is generated if the ERRIE bit is set in the CRS_CR register. It is cleared by software by setting the ERRC bit in the CRS_ICR register. */
+static const field32_t CRS_ISR_FEDIR     = {.msk = 0x00008000U, .pos = 15}; /** @brief Frequency error direction FEDIR is the counting direction of the frequency error counter latched in the time of the last SYNC event. It shows whether the actual frequency is below or above the target. */
+static const field32_t CRS_ISR_FECAP     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Frequency error capture FECAP is the frequency error counter value latched in the time of the last SYNC event. Refer to Section7.3.4: Frequency error evaluation and automatic trimming for more details about FECAP usage. */
+static const field32_t CRS_ICR_SYNCOKC   = {.msk = 0x00000001U, .pos = 0};  /** @brief SYNC event OK clear flag Writing 1 to this bit clears the SYNCOKF flag in the CRS_ISR register. */
+static const field32_t CRS_ICR_SYNCWARNC = {.msk = 0x00000002U, .pos = 1};  /** @brief SYNC warning clear flag Writing 1 to this bit clears the SYNCWARNF flag in the CRS_ISR register. */
+static const field32_t CRS_ICR_ERRC      = {.msk = 0x00000004U, .pos = 2};  /** @brief Error clear flag Writing 1 to this bit clears TRIMOVF, SYNCMISS and SYNCERR bits and consequently also the ERRF flag in the CRS_ISR register. */
+static const field32_t CRS_ICR_ESYNCC    = {.msk = 0x00000008U, .pos = 3};  /** @brief Expected SYNC clear flag Writing 1 to this bit clears the ESYNCF flag in the CRS_ISR register. */
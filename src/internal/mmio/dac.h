@@ -0,0 +1,223 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dac.h
+ * @authors UW SARP
+ * @brief Registers and fields of DAC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DAC Definitions
+ **************************************************************************************************/
+
+/** @subsection DAC Register Definitions */
+
+static rw_reg32_t const DAC_CR      = (rw_reg32_t)0x40007400U; /** @brief DAC control register. */
+static rw_reg32_t const DAC_SWTRGR  = (rw_reg32_t)0x40007404U; /** @brief DAC software trigger register. */
+static rw_reg32_t const DAC_DHR12R1 = (rw_reg32_t)0x40007408U; /** @brief DAC channel1 12-bit right-aligned data holding register. */
+static rw_reg32_t const DAC_DHR12L1 = (rw_reg32_t)0x4000740CU; /** @brief DAC channel1 12-bit left aligned data holding register. */
+static rw_reg32_t const DAC_DHR8R1  = (rw_reg32_t)0x40007410U; /** @brief DAC channel1 8-bit right aligned data holding register. */
+static rw_reg32_t const DAC_DHR12R2 = (rw_reg32_t)0x40007414U; /** @brief DAC channel2 12-bit right aligned data holding register. */
+static rw_reg32_t const DAC_DHR12L2 = (rw_reg32_t)0x40007418U; /** @brief DAC channel2 12-bit left aligned data holding register. */
+static rw_reg32_t const DAC_DHR8R2  = (rw_reg32_t)0x4000741CU; /** @brief DAC channel2 8-bit right-aligned data holding register. */
+static rw_reg32_t const DAC_DHR12RD = (rw_reg32_t)0x40007420U; /** @brief Dual DAC 12-bit right-aligned data holding register. */
+static rw_reg32_t const DAC_DHR12LD = (rw_reg32_t)0x40007424U; /** @brief DUAL DAC 12-bit left aligned data holding register. */
+static rw_reg32_t const DAC_DHR8RD  = (rw_reg32_t)0x40007428U; /** @brief DUAL DAC 8-bit right aligned data holding register. */
+static ro_reg32_t const DAC_DOR1    = (ro_reg32_t)0x4000742CU; /** @brief DAC channel1 data output register. */
+static ro_reg32_t const DAC_DOR2    = (ro_reg32_t)0x40007430U; /** @brief DAC channel2 data output register. */
+static rw_reg32_t const DAC_SR      = (rw_reg32_t)0x40007434U; /** @brief DAC status register. */
+static rw_reg32_t const DAC_CCR     = (rw_reg32_t)0x40007438U; /** @brief DAC calibration control register. */
+static rw_reg32_t const DAC_MCR     = (rw_reg32_t)0x4000743CU; /** @brief DAC mode control register. */
+static rw_reg32_t const DAC_SHSR1   = (rw_reg32_t)0x40007440U; /** @brief DAC Sample and Hold sample time register 1. */
+static rw_reg32_t const DAC_SHSR2   = (rw_reg32_t)0x40007444U; /** @brief DAC Sample and Hold sample time register 2. */
+static rw_reg32_t const DAC_SHHR    = (rw_reg32_t)0x40007448U; /** @brief DAC Sample and Hold hold time register. */
+static rw_reg32_t const DAC_SHRR    = (rw_reg32_t)0x4000744CU; /** @brief DAC Sample and Hold refresh time register. */
+
+/** @subsection DAC Register Field Definitions */
+
+static const field32_t DAC_CR_EN1           = {.msk = 0x00000001U, .pos = 0};  /** @brief DAC channel1 enable This bit is set and cleared by software to enable/disable DAC channel1. */
+static const field32_t DAC_CR_TEN1          = {.msk = 0x00000002U, .pos = 1};  /** @brief DAC channel1 trigger enable. */
+static const field32_t DAC_CR_TSEL1         = {.msk = 0x0000001CU, .pos = 2};  /** @brief DAC channel1 trigger selection These bits select the external event used to trigger DAC channel1. Note: Only used if bit TEN1 = 1 (DAC channel1 trigger enabled). */
+static const field32_t DAC_CR_WAVE1         = {.msk = 0x000000C0U, .pos = 6};  /** @brief DAC channel1 noise/triangle wave generation enable These bits are set and cleared by software. Note: Only used if bit TEN1 = 1 (DAC channel1 trigger enabled). */
+static const field32_t DAC_CR_MAMP1         = {.msk = 0x00000F00U, .pos = 8};  /** @brief DAC channel1 mask/amplitude selector These bits are written by software to select mask in wave generation mode or amplitude in triangle generation mode. = 1011: Unmask bits[11:0] of LFSR/ triangle amplitude equal to 4095. */
+static const field32_t DAC_CR_DMAEN1        = {.msk = 0x00001000U, .pos = 12}; /** @brief DAC channel1 DMA enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_DMAUDRIE1     = {.msk = 0x00002000U, .pos = 13}; /** @brief DAC channel1 DMA Underrun Interrupt enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_CEN1          = {.msk = 0x00004000U, .pos = 14}; /** @brief DAC Channel 1 calibration enable This bit is set and cleared by software to enable/disable DAC channel 1 calibration, it can be written only if bit EN1=0 into DAC_CR (the calibration mode can be entered/exit only when the DAC channel is disabled) Otherwise, the write operation is ignored. */
+static const field32_t DAC_CR_EN2           = {.msk = 0x00010000U, .pos = 16}; /** @brief DAC channel2 enable This bit is set and cleared by software to enable/disable DAC channel2. */
+static const field32_t DAC_CR_TEN2          = {.msk = 0x00020000U, .pos = 17}; /** @brief DAC channel2 trigger enable. */
+static const field32_t DAC_CR_TSEL2         = {.msk = 0x001C0000U, .pos = 18}; /** @brief DAC channel2 trigger selection These bits select the external event used to trigger DAC channel2 Note: Only used if bit TEN2 = 1 (DAC channel2 trigger enabled). */
+static const field32_t DAC_CR_WAVE2         = {.msk = 0x00C00000U, .pos = 22}; /** @brief DAC channel2 noise/triangle wave generation enable These bits are set/reset by software. 1x: Triangle wave generation enabled Note: Only used if bit TEN2 = 1 (DAC channel2 trigger enabled). */
+static const field32_t DAC_CR_MAMP2         = {.msk = 0x0F000000U, .pos = 24}; /** @brief DAC channel2 mask/amplitude selector These bits are written by software to select mask in wave generation mode or amplitude in triangle generation mode. = 1011: Unmask bits[11:0] of LFSR/ triangle amplitude equal to 4095. */
+static const field32_t DAC_CR_DMAEN2        = {.msk = 0x10000000U, .pos = 28}; /** @brief DAC channel2 DMA enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_DMAUDRIE2     = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC channel2 DMA underrun interrupt enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_CEN2          = {.msk = 0x40000000U, .pos = 30}; /** @brief DAC Channel 2 calibration enable This bit is set and cleared by software to enable/disable DAC channel 2 calibration, it can be written only if bit EN2=0 into DAC_CR (the calibration mode can be entered/exit only when the DAC channel is disabled) Otherwise, the write operation is ignored. */
+static const field32_t DAC_SWTRGR_SWTRIG1   = {.msk = 0x00000001U, .pos = 0};  /** @brief DAC channel1 software trigger This bit is set by software to trigger the DAC in software trigger mode. Note: This bit is cleared by hardware (one APB1 clock cycle later) once the DAC_DHR1 register value has been loaded into the DAC_DOR1 register. */
+static const field32_t DAC_SWTRGR_SWTRIG2   = {.msk = 0x00000002U, .pos = 1};  /** @brief DAC channel2 software trigger This bit is set by software to trigger the DAC in software trigger mode. Note: This bit is cleared by hardware (one APB1 clock cycle later) once the DAC_DHR2 register value has been loaded into the DAC_DOR2 register. */
+static const field32_t DAC_DHR12R1_DACC1DHR = {.msk = 0x00000FFFU, .pos = 0};  /** @brief DAC channel1 12-bit right-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR12L1_DACC1DHR = {.msk = 0x0000FFF0U, .pos = 4};  /** @brief DAC channel1 12-bit left-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR8R1_DACC1DHR  = {.msk = 0x000000FFU, .pos = 0};  /** @brief DAC channel1 8-bit right-aligned data These bits are written by software which specifies 8-bit data for DAC channel1. */
+static const field32_t DAC_DHR12R2_DACC2DHR = {.msk = 0x00000FFFU, .pos = 0};  /** @brief DAC channel2 12-bit right-aligned data These bits are written by software which specifies 12-bit data for DAC channel2. */
+static const field32_t DAC_DHR12L2_DACC2DHR = {.msk = 0x0000FFF0U, .pos = 4};  /** @brief DAC channel2 12-bit left-aligned data These bits are written by software which specify 12-bit data for DAC channel2. */
+static const field32_t DAC_DHR8R2_DACC2DHR  = {.msk = 0x000000FFU, .pos = 0};  /** @brief DAC channel2 8-bit right-aligned data These bits are written by software which specifies 8-bit data for DAC channel2. */
+static const field32_t DAC_DHR12RD_DACC1DHR = {.msk = 0x00000FFFU, .pos = 0};  /** @brief DAC channel1 12-bit right-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR12RD_DACC2DHR = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief DAC channel2 12-bit right-aligned data These bits are written by software which specifies 12-bit data for DAC channel2. */
+static const field32_t DAC_DHR12LD_DACC1DHR = {.msk = 0x0000FFF0U, .pos = 4};  /** @brief DAC channel1 12-bit left-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR12LD_DACC2DHR = {.msk = 0xFFF00000U, .pos = 20}; /** @brief DAC channel2 12-bit left-aligned data These bits are written by software which specifies 12-bit data for DAC channel2. */
+static const field32_t DAC_DHR8RD_DACC1DHR  = {.msk = 0x000000FFU, .pos = 0};  /** @brief DAC channel1 8-bit right-aligned data These bits are written by software which specifies 8-bit data for DAC channel1. */
+static const field32_t DAC_DHR8RD_DACC2DHR  = {.msk = 0x0000FF00U, .pos = 8};  /** @brief DAC channel2 8-bit right-aligned data These bits are written by software which specifies 8-bit data for DAC channel2. */
+static const field32_t DAC_DOR1_DACC1DOR    = {.msk = 0x00000FFFU, .pos = 0};  /** @brief DAC channel1 data output These bits are read-only, they contain data output for DAC channel1. */
+static const field32_t DAC_DOR2_DACC2DOR    = {.msk = 0x00000FFFU, .pos = 0};  /** @brief DAC channel2 data output These bits are read-only, they contain data output for DAC channel2. */
+static const field32_t DAC_SR_DMAUDR1       = {.msk = 0x00002000U, .pos = 13}; /** @brief DAC channel1 DMA underrun flag This bit is set by hardware and cleared by software (by writing it to 1). */
+static const field32_t DAC_SR_CAL_FLAG1     = {.msk = 0x00004000U, .pos = 14}; /** @brief DAC Channel 1 calibration offset status This bit is set and cleared by hardware. */
+static const field32_t DAC_SR_BWST1         = {.msk = 0x00008000U, .pos = 15}; /** @brief DAC Channel 1 busy writing sample time flag This bit is systematically set just after Sample & Hold mode enable and is set each time the software writes the register DAC_SHSR1, It is cleared by hardware when the write operation of DAC_SHSR1 is complete. (It takes about 3LSI periods of synchronization). */
+static const field32_t DAC_SR_DMAUDR2       = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC channel2 DMA underrun flag This bit is set by hardware and cleared by software (by writing it to 1). */
+static const field32_t DAC_SR_CAL_FLAG2     = {.msk = 0x40000000U, .pos = 30}; /** @brief DAC Channel 2 calibration offset status This bit is set and cleared by hardware. */
+static const field32_t DAC_SR_BWST2         = {.msk = 0x80000000U, .pos = 31}; /** @brief DAC Channel 2 busy writing sample time flag This bit is systematically set just after Sample & Hold mode enable and is set each time the software writes the register DAC_SHSR2, It is cleared by hardware when the write operation of DAC_SHSR2 is complete. (It takes about 3 LSI periods of synchronization). */
+static const field32_t DAC_CCR_OTRIM1       = {.msk = 0x0000001FU, .pos = 0};  /** @brief DAC Channel 1 offset trimming value. */
+static const field32_t DAC_CCR_OTRIM2       = {.msk = 0x001F0000U, .pos = 16}; /** @brief DAC Channel 2 offset trimming value. */
+static const field32_t DAC_MCR_MODE1        = {.msk = 0x00000007U, .pos = 0};  /** @brief DAC Channel 1 mode These bits can be written only when the DAC is disabled and not in the calibration mode (when bit EN1=0 and bit CEN1 =0 in the DAC_CR register). If EN1=1 or CEN1 =1 the write operation is ignored. They can be set and cleared by software to select the DAC Channel 1 mode: DAC Channel 1 in normal Mode DAC Channel 1 in sample &amp; hold mode. */
+static const field32_t DAC_MCR_MODE2        = {.msk = 0x00070000U, .pos = 16}; /** @brief DAC Channel 2 mode These bits can be written only when the DAC is disabled and not in the calibration mode (when bit EN2=0 and bit CEN2 =0 in the DAC_CR register). If EN2=1 or CEN2 =1 the write operation is ignored. They can be set and cleared by software to select the DAC Channel 2 mode: DAC Channel 2 in normal Mode DAC Channel 2 in sample &amp; hold mode. */
+static const field32_t DAC_SHSR1_TSAMPLE1   = {.msk = 0x000003FFU, .pos = 0};  /** @brief DAC Channel 1 sample Time (only valid in sample &amp; hold mode) These bits can be written when the DAC channel1 is disabled or also during normal operation. in the latter case, the write can be done only when BWSTx of DAC_SR register is low, If BWSTx=1, the write operation is ignored. */
+static const field32_t DAC_SHSR2_TSAMPLE2   = {.msk = 0x000003FFU, .pos = 0};  /** @brief DAC Channel 2 sample Time (only valid in sample &amp; hold mode) These bits can be written when the DAC channel2 is disabled or also during normal operation. in the latter case, the write can be done only when BWSTx of DAC_SR register is low, if BWSTx=1, the write operation is ignored. */
+static const field32_t DAC_SHHR_THOLD1      = {.msk = 0x000003FFU, .pos = 0};  /** @brief DAC Channel 1 hold Time (only valid in sample &amp; hold mode) Hold time= (THOLD[9:0]) x T LSI. */
+static const field32_t DAC_SHHR_THOLD2      = {.msk = 0x03FF0000U, .pos = 16}; /** @brief DAC Channel 2 hold time (only valid in sample &amp; hold mode). Hold time= (THOLD[9:0]) x T LSI. */
+static const field32_t DAC_SHRR_TREFRESH1   = {.msk = 0x000000FFU, .pos = 0};  /** @brief DAC Channel 1 refresh Time (only valid in sample &amp; hold mode) Refresh time= (TREFRESH[7:0]) x T LSI. */
+static const field32_t DAC_SHRR_TREFRESH2   = {.msk = 0x00FF0000U, .pos = 16}; /** @brief DAC Channel 2 refresh Time (only valid in sample &amp; hold mode) Refresh time= (TREFRESH[7:0]) x T LSI. */
+
+/** @subsection Enumerated DAC Register Field Definitions */
+
+/** @brief DAC channel1 enable This bit is set and cleared by software to enable/disable DAC channel1. */
+static const field32_t DAC_CR_ENx[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief DAC channel1 trigger enable. */
+static const field32_t DAC_CR_TENx[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief DAC channel1 trigger selection These bits select the external event used to trigger DAC channel1. Note: Only used if bit TEN1 = 1 (DAC channel1 trigger enabled). */
+static const field32_t DAC_CR_TSELx[3] = {
+  [1] = {.msk = 0x0000001CU, .pos = 2},
+  [2] = {.msk = 0x001C0000U, .pos = 18},
+};
+
+/** @brief DAC channel1 noise/triangle wave generation enable These bits are set and cleared by software. Note: Only used if bit TEN1 = 1 (DAC channel1 trigger enabled). */
+static const field32_t DAC_CR_WAVEx[3] = {
+  [1] = {.msk = 0x000000C0U, .pos = 6},
+  [2] = {.msk = 0x00C00000U, .pos = 22},
+};
+
+/** @brief DAC channel1 mask/amplitude selector These bits are written by software to select mask in wave generation mode or amplitude in triangle generation mode. = 1011: Unmask bits[11:0] of LFSR/ triangle amplitude equal to 4095. */
+static const field32_t DAC_CR_MAMPx[3] = {
+  [1] = {.msk = 0x00000F00U, .pos = 8},
+  [2] = {.msk = 0x0F000000U, .pos = 24},
+};
+
+/** @brief DAC channel1 DMA enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_DMAENx[3] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief DAC channel1 DMA Underrun Interrupt enable This bit is set and cleared by software. */
+static const field32_t DAC_CR_DMAUDRIEx[3] = {
+  [1] = {.msk = 0x00002000U, .pos = 13},
+  [2] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief DAC Channel 1 calibration enable This bit is set and cleared by software to enable/disable DAC channel 1 calibration, it can be written only if bit EN1=0 into DAC_CR (the calibration mode can be entered/exit only when the DAC channel is disabled) Otherwise, the write operation is ignored. */
+static const field32_t DAC_CR_CENx[3] = {
+  [1] = {.msk = 0x00004000U, .pos = 14},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief DAC channel1 software trigger This bit is set by software to trigger the DAC in software trigger mode. Note: This bit is cleared by hardware (one APB1 clock cycle later) once the DAC_DHR1 register value has been loaded into the DAC_DOR1 register. */
+static const field32_t DAC_SWTRGR_SWTRIGx[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief DAC channel1 12-bit right-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR12RD_DACCxDHR[3] = {
+  [1] = {.msk = 0x00000FFFU, .pos = 0},
+  [2] = {.msk = 0x0FFF0000U, .pos = 16},
+};
+
+/** @brief DAC channel1 12-bit left-aligned data These bits are written by software which specifies 12-bit data for DAC channel1. */
+static const field32_t DAC_DHR12LD_DACCxDHR[3] = {
+  [1] = {.msk = 0x0000FFF0U, .pos = 4},
+  [2] = {.msk = 0xFFF00000U, .pos = 20},
+};
+
+/** @brief DAC channel1 8-bit right-aligned data These bits are written by software which specifies 8-bit data for DAC channel1. */
+static const field32_t DAC_DHR8RD_DACCxDHR[3] = {
+  [1] = {.msk = 0x000000FFU, .pos = 0},
+  [2] = {.msk = 0x0000FF00U, .pos = 8},
+};
+
+/** @brief DAC channel1 DMA underrun flag This bit is set by hardware and cleared by software (by writing it to 1). */
+static const field32_t DAC_SR_DMAUDRx[3] = {
+  [1] = {.msk = 0x00002000U, .pos = 13},
+  [2] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief DAC Channel 1 calibration offset status This bit is set and cleared by hardware. */
+static const field32_t DAC_SR_CAL_FLAGx[3] = {
+  [1] = {.msk = 0x00004000U, .pos = 14},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief DAC Channel 1 busy writing sample time flag This bit is systematically set just after Sample & Hold mode enable and is set each time the software writes the register DAC_SHSR1, It is cleared by hardware when the write operation of DAC_SHSR1 is complete. (It takes about 3LSI periods of synchronization). */
+static const field32_t DAC_SR_BWSTx[3] = {
+  [1] = {.msk = 0x00008000U, .pos = 15},
+  [2] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief DAC Channel 1 offset trimming value. */
+static const field32_t DAC_CCR_OTRIMx[3] = {
+  [1] = {.msk = 0x0000001FU, .pos = 0},
+  [2] = {.msk = 0x001F0000U, .pos = 16},
+};
+
+/** @brief DAC Channel 1 mode These bits can be written only when the DAC is disabled and not in the calibration mode (when bit EN1=0 and bit CEN1 =0 in the DAC_CR register). If EN1=1 or CEN1 =1 the write operation is ignored. They can be set and cleared by software to select the DAC Channel 1 mode: DAC Channel 1 in normal Mode DAC Channel 1 in sample &amp; hold mode. */
+static const field32_t DAC_MCR_MODEx[3] = {
+  [1] = {.msk = 0x00000007U, .pos = 0},
+  [2] = {.msk = 0x00070000U, .pos = 16},
+};
+
+/** @brief DAC Channel 1 hold Time (only valid in sample &amp; hold mode) Hold time= (THOLD[9:0]) x T LSI. */
+static const field32_t DAC_SHHR_THOLDx[3] = {
+  [1] = {.msk = 0x000003FFU, .pos = 0},
+  [2] = {.msk = 0x03FF0000U, .pos = 16},
+};
+
+/** @brief DAC Channel 1 refresh Time (only valid in sample &amp; hold mode) Refresh time= (TREFRESH[7:0]) x T LSI. */
+static const field32_t DAC_SHRR_TREFRESHx[3] = {
+  [1] = {.msk = 0x000000FFU, .pos = 0},
+  [2] = {.msk = 0x00FF0000U, .pos = 16},
+};
@@ -0,0 +1,114 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dcmi.h
+ * @authors UW SARP
+ * @brief Registers and fields of DCMI.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DCMI Definitions
+ **************************************************************************************************/
+
+/** @subsection DCMI Register Definitions */
+
+static rw_reg32_t const DCMI_CR     = (rw_reg32_t)0x48020000U; /** @brief Control register 1. */
+static ro_reg32_t const DCMI_SR     = (ro_reg32_t)0x48020004U; /** @brief Status register. */
+static ro_reg32_t const DCMI_RIS    = (ro_reg32_t)0x48020008U; /** @brief Raw interrupt status register. */
+static rw_reg32_t const DCMI_IER    = (rw_reg32_t)0x4802000CU; /** @brief Interrupt enable register. */
+static ro_reg32_t const DCMI_MIS    = (ro_reg32_t)0x48020010U; /** @brief Masked interrupt status register. */
+static rw_reg32_t const DCMI_ICR    = (rw_reg32_t)0x48020014U; /** @brief Interrupt clear register. */
+static rw_reg32_t const DCMI_ESCR   = (rw_reg32_t)0x48020018U; /** @brief Embedded synchronization code register. */
+static rw_reg32_t const DCMI_ESUR   = (rw_reg32_t)0x4802001CU; /** @brief Embedded synchronization unmask register. */
+static rw_reg32_t const DCMI_CWSTRT = (rw_reg32_t)0x48020020U; /** @brief Crop window start. */
+static rw_reg32_t const DCMI_CWSIZE = (rw_reg32_t)0x48020024U; /** @brief Crop window size. */
+static ro_reg32_t const DCMI_DR     = (ro_reg32_t)0x48020028U; /** @brief Data register. */
+
+/** @subsection DCMI Register Field Definitions */
+
+static const field32_t DCMI_CR_OELS        = {.msk = 0x00100000U, .pos = 20}; /** @brief Odd/Even Line Select (Line Select Start). */
+static const field32_t DCMI_CR_LSM         = {.msk = 0x00080000U, .pos = 19}; /** @brief Line Select mode. */
+static const field32_t DCMI_CR_OEBS        = {.msk = 0x00040000U, .pos = 18}; /** @brief Odd/Even Byte Select (Byte Select Start). */
+static const field32_t DCMI_CR_BSM         = {.msk = 0x00030000U, .pos = 16}; /** @brief Byte Select mode. */
+static const field32_t DCMI_CR_ENABLE      = {.msk = 0x00004000U, .pos = 14}; /** @brief DCMI enable. */
+static const field32_t DCMI_CR_EDM         = {.msk = 0x00000C00U, .pos = 10}; /** @brief Extended data mode. */
+static const field32_t DCMI_CR_FCRC        = {.msk = 0x00000300U, .pos = 8};  /** @brief Frame capture rate control. */
+static const field32_t DCMI_CR_VSPOL       = {.msk = 0x00000080U, .pos = 7};  /** @brief Vertical synchronization polarity. */
+static const field32_t DCMI_CR_HSPOL       = {.msk = 0x00000040U, .pos = 6};  /** @brief Horizontal synchronization polarity. */
+static const field32_t DCMI_CR_PCKPOL      = {.msk = 0x00000020U, .pos = 5};  /** @brief Pixel clock polarity. */
+static const field32_t DCMI_CR_ESS         = {.msk = 0x00000010U, .pos = 4};  /** @brief Embedded synchronization select. */
+static const field32_t DCMI_CR_JPEG        = {.msk = 0x00000008U, .pos = 3};  /** @brief JPEG format. */
+static const field32_t DCMI_CR_CROP        = {.msk = 0x00000004U, .pos = 2};  /** @brief Crop feature. */
+static const field32_t DCMI_CR_CM          = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture mode. */
+static const field32_t DCMI_CR_CAPTURE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture enable. */
+static const field32_t DCMI_SR_FNE         = {.msk = 0x00000004U, .pos = 2};  /** @brief FIFO not empty. */
+static const field32_t DCMI_SR_VSYNC       = {.msk = 0x00000002U, .pos = 1};  /** @brief VSYNC. */
+static const field32_t DCMI_SR_HSYNC       = {.msk = 0x00000001U, .pos = 0};  /** @brief HSYNC. */
+static const field32_t DCMI_RIS_LINE_RIS   = {.msk = 0x00000010U, .pos = 4};  /** @brief Line raw interrupt status. */
+static const field32_t DCMI_RIS_VSYNC_RIS  = {.msk = 0x00000008U, .pos = 3};  /** @brief VSYNC raw interrupt status. */
+static const field32_t DCMI_RIS_ERR_RIS    = {.msk = 0x00000004U, .pos = 2};  /** @brief Synchronization error raw interrupt status. */
+static const field32_t DCMI_RIS_OVR_RIS    = {.msk = 0x00000002U, .pos = 1};  /** @brief Overrun raw interrupt status. */
+static const field32_t DCMI_RIS_FRAME_RIS  = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture complete raw interrupt status. */
+static const field32_t DCMI_IER_LINE_IE    = {.msk = 0x00000010U, .pos = 4};  /** @brief Line interrupt enable. */
+static const field32_t DCMI_IER_VSYNC_IE   = {.msk = 0x00000008U, .pos = 3};  /** @brief VSYNC interrupt enable. */
+static const field32_t DCMI_IER_ERR_IE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Synchronization error interrupt enable. */
+static const field32_t DCMI_IER_OVR_IE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Overrun interrupt enable. */
+static const field32_t DCMI_IER_FRAME_IE   = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture complete interrupt enable. */
+static const field32_t DCMI_MIS_LINE_MIS   = {.msk = 0x00000010U, .pos = 4};  /** @brief Line masked interrupt status. */
+static const field32_t DCMI_MIS_VSYNC_MIS  = {.msk = 0x00000008U, .pos = 3};  /** @brief VSYNC masked interrupt status. */
+static const field32_t DCMI_MIS_ERR_MIS    = {.msk = 0x00000004U, .pos = 2};  /** @brief Synchronization error masked interrupt status. */
+static const field32_t DCMI_MIS_OVR_MIS    = {.msk = 0x00000002U, .pos = 1};  /** @brief Overrun masked interrupt status. */
+static const field32_t DCMI_MIS_FRAME_MIS  = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture complete masked interrupt status. */
+static const field32_t DCMI_ICR_LINE_ISC   = {.msk = 0x00000010U, .pos = 4};  /** @brief Line interrupt status clear. */
+static const field32_t DCMI_ICR_VSYNC_ISC  = {.msk = 0x00000008U, .pos = 3};  /** @brief Vertical synch interrupt status clear. */
+static const field32_t DCMI_ICR_ERR_ISC    = {.msk = 0x00000004U, .pos = 2};  /** @brief Synchronization error interrupt status clear. */
+static const field32_t DCMI_ICR_OVR_ISC    = {.msk = 0x00000002U, .pos = 1};  /** @brief Overrun interrupt status clear. */
+static const field32_t DCMI_ICR_FRAME_ISC  = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture complete interrupt status clear. */
+static const field32_t DCMI_ESCR_FEC       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Frame end delimiter code. */
+static const field32_t DCMI_ESCR_LEC       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Line end delimiter code. */
+static const field32_t DCMI_ESCR_LSC       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Line start delimiter code. */
+static const field32_t DCMI_ESCR_FSC       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Frame start delimiter code. */
+static const field32_t DCMI_ESUR_FEU       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Frame end delimiter unmask. */
+static const field32_t DCMI_ESUR_LEU       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Line end delimiter unmask. */
+static const field32_t DCMI_ESUR_LSU       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Line start delimiter unmask. */
+static const field32_t DCMI_ESUR_FSU       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Frame start delimiter unmask. */
+static const field32_t DCMI_CWSTRT_VST     = {.msk = 0x1FFF0000U, .pos = 16}; /** @brief Vertical start line count. */
+static const field32_t DCMI_CWSTRT_HOFFCNT = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Horizontal offset count. */
+static const field32_t DCMI_CWSIZE_VLINE   = {.msk = 0x3FFF0000U, .pos = 16}; /** @brief Vertical line count. */
+static const field32_t DCMI_CWSIZE_CAPCNT  = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Capture count. */
+static const field32_t DCMI_DR_BYTE3       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Data byte 3. */
+static const field32_t DCMI_DR_BYTE2       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Data byte 2. */
+static const field32_t DCMI_DR_BYTE1       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Data byte 1. */
+static const field32_t DCMI_DR_BYTE0       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Data byte 0. */
+
+/** @subsection Enumerated DCMI Register Field Definitions */
+
+/** @brief Data byte 0. */
+static const field32_t DCMI_DR_BYTEx[4] = {
+  [0] = {.msk = 0x000000FFU, .pos = 0},
+  [1] = {.msk = 0x0000FF00U, .pos = 8},
+  [2] = {.msk = 0x00FF0000U, .pos = 16},
+  [3] = {.msk = 0xFF000000U, .pos = 24},
+};
@@ -0,0 +1,74 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/delay_block_sdmmcx.h
+ * @authors UW SARP
+ * @brief Registers and fields of DELAY_BLOCK_QUADSPI, DELAY_BLOCK_SDMMC1, DELAY_BLOCK_SDMMC2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DELAY_BLOCK_QUADSPI Definitions
+ **************************************************************************************************/
+
+/** @subsection DELAY_BLOCK_QUADSPI Register Definitions */
+
+static rw_reg32_t const DELAY_BLOCK_QUADSPI_CR   = (rw_reg32_t)0x52006000U; /** @brief DLYB control register. */
+static rw_reg32_t const DELAY_BLOCK_QUADSPI_CFGR = (rw_reg32_t)0x52006004U; /** @brief DLYB configuration register. */
+
+/** @subsection DELAY_BLOCK_QUADSPI Register Field Definitions */
+
+static const field32_t DELAY_BLOCK_QUADSPI_CR_DEN    = {.msk = 0x00000001U, .pos = 0};  /** @brief Delay block enable bit. */
+static const field32_t DELAY_BLOCK_QUADSPI_CR_SEN    = {.msk = 0x00000002U, .pos = 1};  /** @brief Sampler length enable bit. */
+static const field32_t DELAY_BLOCK_QUADSPI_CFGR_SEL  = {.msk = 0x0000000FU, .pos = 0};  /** @brief Select the phase for the Output clock. */
+static const field32_t DELAY_BLOCK_QUADSPI_CFGR_UNIT = {.msk = 0x00007F00U, .pos = 8};  /** @brief Delay Defines the delay of a Unit delay cell. */
+static const field32_t DELAY_BLOCK_QUADSPI_CFGR_LNG  = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Delay line length value. */
+static const field32_t DELAY_BLOCK_QUADSPI_CFGR_LNGF = {.msk = 0x80000000U, .pos = 31}; /** @brief Length valid flag. */
+
+/**************************************************************************************************
+ * @section DELAY_BLOCK_SDMMCx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated DELAY_BLOCK_SDMMCx Register Definitions */
+
+/** @brief DLYB control register. */
+static rw_reg32_t const DELAY_BLOCK_SDMMCx_CR[3] = {
+  [1] = (rw_reg32_t)0x52008000U,
+  [2] = (rw_reg32_t)0x48022800U,
+};
+
+/** @brief DLYB configuration register. */
+static rw_reg32_t const DELAY_BLOCK_SDMMCx_CFGR[3] = {
+  [1] = (rw_reg32_t)0x52008004U,
+  [2] = (rw_reg32_t)0x48022804U,
+};
+
+/** @subsection DELAY_BLOCK_SDMMCx Register Field Definitions */
+
+static const field32_t DELAY_BLOCK_SDMMCx_CR_DEN    = {.msk = 0x00000001U, .pos = 0};  /** @brief Delay block enable bit. */
+static const field32_t DELAY_BLOCK_SDMMCx_CR_SEN    = {.msk = 0x00000002U, .pos = 1};  /** @brief Sampler length enable bit. */
+static const field32_t DELAY_BLOCK_SDMMCx_CFGR_SEL  = {.msk = 0x0000000FU, .pos = 0};  /** @brief Select the phase for the Output clock. */
+static const field32_t DELAY_BLOCK_SDMMCx_CFGR_UNIT = {.msk = 0x00007F00U, .pos = 8};  /** @brief Delay Defines the delay of a Unit delay cell. */
+static const field32_t DELAY_BLOCK_SDMMCx_CFGR_LNG  = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Delay line length value. */
+static const field32_t DELAY_BLOCK_SDMMCx_CFGR_LNGF = {.msk = 0x80000000U, .pos = 31}; /** @brief Length valid flag. */
@@ -0,0 +1,373 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dfsdm.h
+ * @authors UW SARP
+ * @brief Registers and fields of DFSDM.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DFSDM Definitions
+ **************************************************************************************************/
+
+/** @subsection DFSDM Register Definitions */
+
+static rw_reg32_t const DFSDM_CH0CFGR1       = (rw_reg32_t)0x40017000U; /** @brief Channel configuration y register. */
+static rw_reg32_t const DFSDM_CH1CFGR1       = (rw_reg32_t)0x40017020U; /** @brief CH1CFGR1. */
+static rw_reg32_t const DFSDM_CH2CFGR1       = (rw_reg32_t)0x40017040U; /** @brief CH2CFGR1. */
+static rw_reg32_t const DFSDM_CH3CFGR1       = (rw_reg32_t)0x40017060U; /** @brief CH3CFGR1. */
+static rw_reg32_t const DFSDM_CH4CFGR1       = (rw_reg32_t)0x40017080U; /** @brief CH4CFGR1. */
+static rw_reg32_t const DFSDM_CH5CFGR1       = (rw_reg32_t)0x400170A0U; /** @brief CH5CFGR1. */
+static rw_reg32_t const DFSDM_CH6CFGR1       = (rw_reg32_t)0x400170C0U; /** @brief CH6CFGR1. */
+static rw_reg32_t const DFSDM_CH7CFGR1       = (rw_reg32_t)0x400170E0U; /** @brief CH7CFGR1. */
+static rw_reg32_t const DFSDM_DFSDM_FLT1CHGR = (rw_reg32_t)0x40017190U; /** @brief Injected channel group selection register. */
+
+/** @subsection Enumerated DFSDM Register Definitions */
+
+/** @brief Channel configuration y register. */
+static rw_reg32_t const DFSDM_CHxCFGR2[8] = {
+  [0] = (rw_reg32_t)0x40017004U,
+  [1] = (rw_reg32_t)0x40017024U,
+  [2] = (rw_reg32_t)0x40017044U,
+  [3] = (rw_reg32_t)0x40017064U,
+  [4] = (rw_reg32_t)0x40017084U,
+  [5] = (rw_reg32_t)0x400170A4U,
+  [6] = (rw_reg32_t)0x400170C4U,
+  [7] = (rw_reg32_t)0x400170E4U,
+};
+
+/** @brief Analog watchdog and short-circuit detector register. */
+static rw_reg32_t const DFSDM_CHxAWSCDR[8] = {
+  [0] = (rw_reg32_t)0x40017008U,
+  [1] = (rw_reg32_t)0x40017028U,
+  [2] = (rw_reg32_t)0x40017048U,
+  [3] = (rw_reg32_t)0x40017068U,
+  [4] = (rw_reg32_t)0x40017088U,
+  [5] = (rw_reg32_t)0x400170A8U,
+  [6] = (rw_reg32_t)0x400170C8U,
+  [7] = (rw_reg32_t)0x400170E8U,
+};
+
+/** @brief Channel watchdog filter data register. */
+static rw_reg32_t const DFSDM_CHxWDATR[8] = {
+  [0] = (rw_reg32_t)0x4001700CU,
+  [1] = (rw_reg32_t)0x4001702CU,
+  [2] = (rw_reg32_t)0x4001704CU,
+  [3] = (rw_reg32_t)0x4001706CU,
+  [4] = (rw_reg32_t)0x4001708CU,
+  [5] = (rw_reg32_t)0x400170ACU,
+  [6] = (rw_reg32_t)0x400170CCU,
+  [7] = (rw_reg32_t)0x400170ECU,
+};
+
+/** @brief Channel data input register. */
+static rw_reg32_t const DFSDM_CHxDATINR[8] = {
+  [0] = (rw_reg32_t)0x40017010U,
+  [1] = (rw_reg32_t)0x40017030U,
+  [2] = (rw_reg32_t)0x40017050U,
+  [3] = (rw_reg32_t)0x40017070U,
+  [4] = (rw_reg32_t)0x40017090U,
+  [5] = (rw_reg32_t)0x400170B0U,
+  [6] = (rw_reg32_t)0x400170D0U,
+  [7] = (rw_reg32_t)0x400170F0U,
+};
+
+/** @brief Channel y delay register. */
+static rw_reg32_t const DFSDM_CHxDLYR[8] = {
+  [0] = (rw_reg32_t)0x40017014U,
+  [1] = (rw_reg32_t)0x40017034U,
+  [2] = (rw_reg32_t)0x40017054U,
+  [3] = (rw_reg32_t)0x40017074U,
+  [4] = (rw_reg32_t)0x40017094U,
+  [5] = (rw_reg32_t)0x400170B4U,
+  [6] = (rw_reg32_t)0x400170D4U,
+  [7] = (rw_reg32_t)0x400170F4U,
+};
+
+/** @brief Control register 1. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxCR1[4] = {
+  [0] = (rw_reg32_t)0x40017100U,
+  [1] = (rw_reg32_t)0x40017180U,
+  [2] = (rw_reg32_t)0x40017200U,
+  [3] = (rw_reg32_t)0x40017280U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxCR2[4] = {
+  [0] = (rw_reg32_t)0x40017104U,
+  [1] = (rw_reg32_t)0x40017184U,
+  [2] = (rw_reg32_t)0x40017204U,
+  [3] = (rw_reg32_t)0x40017284U,
+};
+
+/** @brief Interrupt and status register. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxISR[4] = {
+  [0] = (ro_reg32_t)0x40017108U,
+  [1] = (ro_reg32_t)0x40017188U,
+  [2] = (ro_reg32_t)0x40017208U,
+  [3] = (ro_reg32_t)0x40017288U,
+};
+
+/** @brief Interrupt flag clear register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxICR[4] = {
+  [0] = (rw_reg32_t)0x4001710CU,
+  [1] = (rw_reg32_t)0x4001718CU,
+  [2] = (rw_reg32_t)0x4001720CU,
+  [3] = (rw_reg32_t)0x4001728CU,
+};
+
+/** @brief Injected channel group selection register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxJCHGR[4] = {
+  [0] = (rw_reg32_t)0x40017110U,
+  [2] = (rw_reg32_t)0x40017210U,
+  [3] = (rw_reg32_t)0x40017290U,
+};
+
+/** @brief Filter control register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxFCR[4] = {
+  [0] = (rw_reg32_t)0x40017114U,
+  [1] = (rw_reg32_t)0x40017194U,
+  [2] = (rw_reg32_t)0x40017214U,
+  [3] = (rw_reg32_t)0x40017294U,
+};
+
+/** @brief Data register for injected group. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxJDATAR[4] = {
+  [0] = (ro_reg32_t)0x40017118U,
+  [1] = (ro_reg32_t)0x40017198U,
+  [2] = (ro_reg32_t)0x40017218U,
+  [3] = (ro_reg32_t)0x40017298U,
+};
+
+/** @brief Data register for the regular channel. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxRDATAR[4] = {
+  [0] = (ro_reg32_t)0x4001711CU,
+  [1] = (ro_reg32_t)0x4001719CU,
+  [2] = (ro_reg32_t)0x4001721CU,
+  [3] = (ro_reg32_t)0x4001729CU,
+};
+
+/** @brief Analog watchdog high threshold register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxAWHTR[4] = {
+  [0] = (rw_reg32_t)0x40017120U,
+  [1] = (rw_reg32_t)0x400171A0U,
+  [2] = (rw_reg32_t)0x40017220U,
+  [3] = (rw_reg32_t)0x400172A0U,
+};
+
+/** @brief Analog watchdog low threshold register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxAWLTR[4] = {
+  [0] = (rw_reg32_t)0x40017124U,
+  [1] = (rw_reg32_t)0x400171A4U,
+  [2] = (rw_reg32_t)0x40017224U,
+  [3] = (rw_reg32_t)0x400172A4U,
+};
+
+/** @brief Analog watchdog status register. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxAWSR[4] = {
+  [0] = (ro_reg32_t)0x40017128U,
+  [1] = (ro_reg32_t)0x400171A8U,
+  [2] = (ro_reg32_t)0x40017228U,
+  [3] = (ro_reg32_t)0x400172A8U,
+};
+
+/** @brief Analog watchdog clear flag register. */
+static rw_reg32_t const DFSDM_DFSDM_FLTxAWCFR[4] = {
+  [0] = (rw_reg32_t)0x4001712CU,
+  [1] = (rw_reg32_t)0x400171ACU,
+  [2] = (rw_reg32_t)0x4001722CU,
+  [3] = (rw_reg32_t)0x400172ACU,
+};
+
+/** @brief Extremes detector maximum register. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxEXMAX[4] = {
+  [0] = (ro_reg32_t)0x40017130U,
+  [1] = (ro_reg32_t)0x400171B0U,
+  [2] = (ro_reg32_t)0x40017230U,
+  [3] = (ro_reg32_t)0x400172B0U,
+};
+
+/** @brief Extremes detector minimum register. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxEXMIN[4] = {
+  [0] = (ro_reg32_t)0x40017134U,
+  [1] = (ro_reg32_t)0x400171B4U,
+  [2] = (ro_reg32_t)0x40017234U,
+  [3] = (ro_reg32_t)0x400172B4U,
+};
+
+/** @brief Conversion timer register. */
+static ro_reg32_t const DFSDM_DFSDM_FLTxCNVTIMR[4] = {
+  [0] = (ro_reg32_t)0x40017138U,
+  [1] = (ro_reg32_t)0x400171B8U,
+  [2] = (ro_reg32_t)0x40017238U,
+  [3] = (ro_reg32_t)0x400172B8U,
+};
+
+/** @subsection DFSDM Register Field Definitions */
+
+static const field32_t DFSDM_CH0CFGR1_DFSDMEN         = {.msk = 0x80000000U, .pos = 31}; /** @brief DFSDMEN. */
+static const field32_t DFSDM_CH0CFGR1_CKOUTSRC        = {.msk = 0x40000000U, .pos = 30}; /** @brief CKOUTSRC. */
+static const field32_t DFSDM_CH0CFGR1_CKOUTDIV        = {.msk = 0x00FF0000U, .pos = 16}; /** @brief CKOUTDIV. */
+static const field32_t DFSDM_CH0CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH0CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH0CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH0CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH0CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH0CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH0CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH0CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH1CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH1CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH1CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH1CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH1CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH1CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH1CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH1CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH2CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH2CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH2CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH2CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH2CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH2CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH2CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH2CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH3CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH3CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH3CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH3CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH3CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH3CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH3CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH3CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH4CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH4CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH4CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH4CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH4CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH4CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH4CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH4CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH5CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH5CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH5CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH5CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH5CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH5CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH5CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH5CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH6CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH6CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH6CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH6CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH6CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH6CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH6CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH6CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_CH7CFGR1_DATPACK         = {.msk = 0x0000C000U, .pos = 14}; /** @brief DATPACK. */
+static const field32_t DFSDM_CH7CFGR1_DATMPX          = {.msk = 0x00003000U, .pos = 12}; /** @brief DATMPX. */
+static const field32_t DFSDM_CH7CFGR1_CHINSEL         = {.msk = 0x00000100U, .pos = 8};  /** @brief CHINSEL. */
+static const field32_t DFSDM_CH7CFGR1_CHEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief CHEN. */
+static const field32_t DFSDM_CH7CFGR1_CKABEN          = {.msk = 0x00000040U, .pos = 6};  /** @brief CKABEN. */
+static const field32_t DFSDM_CH7CFGR1_SCDEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief SCDEN. */
+static const field32_t DFSDM_CH7CFGR1_SPICKSEL        = {.msk = 0x0000000CU, .pos = 2};  /** @brief SPICKSEL. */
+static const field32_t DFSDM_CH7CFGR1_SITP            = {.msk = 0x00000003U, .pos = 0};  /** @brief SITP. */
+static const field32_t DFSDM_DFSDM_FLT1CHGR_JCHG      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Injected channel group selection. */
+static const field32_t DFSDM_CHxCFGR2_OFFSET          = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief OFFSET. */
+static const field32_t DFSDM_CHxCFGR2_DTRBS           = {.msk = 0x000000F8U, .pos = 3};  /** @brief DTRBS. */
+static const field32_t DFSDM_CHxAWSCDR_AWFORD         = {.msk = 0x00C00000U, .pos = 22}; /** @brief AWFORD. */
+static const field32_t DFSDM_CHxAWSCDR_AWFOSR         = {.msk = 0x001F0000U, .pos = 16}; /** @brief AWFOSR. */
+static const field32_t DFSDM_CHxAWSCDR_BKSCD          = {.msk = 0x0000F000U, .pos = 12}; /** @brief BKSCD. */
+static const field32_t DFSDM_CHxAWSCDR_SCDT           = {.msk = 0x000000FFU, .pos = 0};  /** @brief SCDT. */
+static const field32_t DFSDM_CHxWDATR_WDATA           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief WDATA. */
+static const field32_t DFSDM_CHxDATINR_INDAT1         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief INDAT1. */
+static const field32_t DFSDM_CHxDATINR_INDAT0         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief INDAT0. */
+static const field32_t DFSDM_CHxDLYR_PLSSKP           = {.msk = 0x0000003FU, .pos = 0};  /** @brief PLSSKP. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_AWFSEL     = {.msk = 0x40000000U, .pos = 30}; /** @brief Analog watchdog fast mode select. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_FAST       = {.msk = 0x20000000U, .pos = 29}; /** @brief Fast conversion mode selection for regular conversions. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_RCH        = {.msk = 0x07000000U, .pos = 24}; /** @brief Regular channel selection. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_RDMAEN     = {.msk = 0x00200000U, .pos = 21}; /** @brief DMA channel enabled to read data for the regular conversion. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_RSYNC      = {.msk = 0x00080000U, .pos = 19}; /** @brief Launch regular conversion synchronously with DFSDM0. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_RCONT      = {.msk = 0x00040000U, .pos = 18}; /** @brief Continuous mode selection for regular conversions. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_RSWSTART   = {.msk = 0x00020000U, .pos = 17}; /** @brief Software start of a conversion on the regular channel. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JEXTEN     = {.msk = 0x00006000U, .pos = 13}; /** @brief Trigger enable and trigger edge selection for injected conversions. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JEXTSEL    = {.msk = 0x00000700U, .pos = 8};  /** @brief Trigger signal selection for launching injected conversions. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JDMAEN     = {.msk = 0x00000020U, .pos = 5};  /** @brief DMA channel enabled to read data for the injected channel group. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JSCAN      = {.msk = 0x00000010U, .pos = 4};  /** @brief Scanning conversion mode for injected conversions. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JSYNC      = {.msk = 0x00000008U, .pos = 3};  /** @brief Launch an injected conversion synchronously with the DFSDM0 JSWSTART trigger. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_JSWSTART   = {.msk = 0x00000002U, .pos = 1};  /** @brief Start a conversion of the injected group of channels. */
+static const field32_t DFSDM_DFSDM_FLTxCR1_DFEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief DFSDM enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_AWDCH      = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Analog watchdog channel selection. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_EXCH       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Extremes detector channel selection. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_CKABIE     = {.msk = 0x00000040U, .pos = 6};  /** @brief Clock absence interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_SCDIE      = {.msk = 0x00000020U, .pos = 5};  /** @brief Short-circuit detector interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_AWDIE      = {.msk = 0x00000010U, .pos = 4};  /** @brief Analog watchdog interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_ROVRIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Regular data overrun interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_JOVRIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Injected data overrun interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_REOCIE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Regular end of conversion interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxCR2_JEOCIE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Injected end of conversion interrupt enable. */
+static const field32_t DFSDM_DFSDM_FLTxISR_SCDF       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Short-circuit detector flag. */
+static const field32_t DFSDM_DFSDM_FLTxISR_CKABF      = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Clock absence flag. */
+static const field32_t DFSDM_DFSDM_FLTxISR_RCIP       = {.msk = 0x00004000U, .pos = 14}; /** @brief Regular conversion in progress status. */
+static const field32_t DFSDM_DFSDM_FLTxISR_JCIP       = {.msk = 0x00002000U, .pos = 13}; /** @brief Injected conversion in progress status. */
+static const field32_t DFSDM_DFSDM_FLTxISR_AWDF       = {.msk = 0x00000010U, .pos = 4};  /** @brief Analog watchdog. */
+static const field32_t DFSDM_DFSDM_FLTxISR_ROVRF      = {.msk = 0x00000008U, .pos = 3};  /** @brief Regular conversion overrun flag. */
+static const field32_t DFSDM_DFSDM_FLTxISR_JOVRF      = {.msk = 0x00000004U, .pos = 2};  /** @brief Injected conversion overrun flag. */
+static const field32_t DFSDM_DFSDM_FLTxISR_REOCF      = {.msk = 0x00000002U, .pos = 1};  /** @brief End of regular conversion flag. */
+static const field32_t DFSDM_DFSDM_FLTxISR_JEOCF      = {.msk = 0x00000001U, .pos = 0};  /** @brief End of injected conversion flag. */
+static const field32_t DFSDM_DFSDM_FLTxICR_CLRSCDF    = {.msk = 0xFF000000U, .pos = 24}; /** @brief Clear the short-circuit detector flag. */
+static const field32_t DFSDM_DFSDM_FLTxICR_CLRCKABF   = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Clear the clock absence flag. */
+static const field32_t DFSDM_DFSDM_FLTxICR_CLRROVRF   = {.msk = 0x00000008U, .pos = 3};  /** @brief Clear the regular conversion overrun flag. */
+static const field32_t DFSDM_DFSDM_FLTxICR_CLRJOVRF   = {.msk = 0x00000004U, .pos = 2};  /** @brief Clear the injected conversion overrun flag. */
+static const field32_t DFSDM_DFSDM_FLTxJCHGR_JCHG     = {.msk = 0x000000FFU, .pos = 0};  /** @brief Injected channel group selection. */
+static const field32_t DFSDM_DFSDM_FLTxFCR_FORD       = {.msk = 0xE0000000U, .pos = 29}; /** @brief Sinc filter order. */
+static const field32_t DFSDM_DFSDM_FLTxFCR_FOSR       = {.msk = 0x03FF0000U, .pos = 16}; /** @brief Sinc filter oversampling ratio (decimation rate). */
+static const field32_t DFSDM_DFSDM_FLTxFCR_IOSR       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Integrator oversampling ratio (averaging length). */
+static const field32_t DFSDM_DFSDM_FLTxJDATAR_JDATA   = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Injected group conversion data. */
+static const field32_t DFSDM_DFSDM_FLTxJDATAR_JDATACH = {.msk = 0x00000007U, .pos = 0};  /** @brief Injected channel most recently converted. */
+static const field32_t DFSDM_DFSDM_FLTxRDATAR_RDATA   = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Regular channel conversion data. */
+static const field32_t DFSDM_DFSDM_FLTxRDATAR_RPEND   = {.msk = 0x00000010U, .pos = 4};  /** @brief Regular channel pending data. */
+static const field32_t DFSDM_DFSDM_FLTxRDATAR_RDATACH = {.msk = 0x00000007U, .pos = 0};  /** @brief Regular channel most recently converted. */
+static const field32_t DFSDM_DFSDM_FLTxAWHTR_AWHT     = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Analog watchdog high threshold. */
+static const field32_t DFSDM_DFSDM_FLTxAWHTR_BKAWH    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Break signal assignment to analog watchdog high threshold event. */
+static const field32_t DFSDM_DFSDM_FLTxAWLTR_AWLT     = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Analog watchdog low threshold. */
+static const field32_t DFSDM_DFSDM_FLTxAWLTR_BKAWL    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Break signal assignment to analog watchdog low threshold event. */
+static const field32_t DFSDM_DFSDM_FLTxAWSR_AWHTF     = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Analog watchdog high threshold flag. */
+static const field32_t DFSDM_DFSDM_FLTxAWSR_AWLTF     = {.msk = 0x000000FFU, .pos = 0};  /** @brief Analog watchdog low threshold flag. */
+static const field32_t DFSDM_DFSDM_FLTxAWCFR_CLRAWHTF = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Clear the analog watchdog high threshold flag. */
+static const field32_t DFSDM_DFSDM_FLTxAWCFR_CLRAWLTF = {.msk = 0x000000FFU, .pos = 0};  /** @brief Clear the analog watchdog low threshold flag. */
+static const field32_t DFSDM_DFSDM_FLTxEXMAX_EXMAX    = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Extremes detector maximum value. */
+static const field32_t DFSDM_DFSDM_FLTxEXMAX_EXMAXCH  = {.msk = 0x00000007U, .pos = 0};  /** @brief Extremes detector maximum data channel. */
+static const field32_t DFSDM_DFSDM_FLTxEXMIN_EXMIN    = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief EXMIN. */
+static const field32_t DFSDM_DFSDM_FLTxEXMIN_EXMINCH  = {.msk = 0x00000007U, .pos = 0};  /** @brief Extremes detector minimum data channel. */
+static const field32_t DFSDM_DFSDM_FLTxCNVTIMR_CNVCNT = {.msk = 0xFFFFFFF0U, .pos = 4};  /** @brief 28-bit timer counting conversion time t = CNVCNT[27:0] / fDFSDM_CKIN. */
+
+/** @subsection Enumerated DFSDM Register Field Definitions */
+
+/** @brief INDAT0. */
+static const field32_t DFSDM_CHxDATINR_INDATx[2] = {
+  [0] = {.msk = 0x0000FFFFU, .pos = 0},
+  [1] = {.msk = 0xFFFF0000U, .pos = 16},
+};
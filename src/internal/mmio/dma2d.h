@@ -0,0 +1,119 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dma2d.h
+ * @authors UW SARP
+ * @brief Registers and fields of DMA2D.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DMA2D Definitions
+ **************************************************************************************************/
+
+/** @subsection DMA2D Register Definitions */
+
+static rw_reg32_t const DMA2D_CR      = (rw_reg32_t)0x52001000U; /** @brief DMA2D control register. */
+static ro_reg32_t const DMA2D_ISR     = (ro_reg32_t)0x52001004U; /** @brief DMA2D Interrupt Status Register. */
+static rw_reg32_t const DMA2D_IFCR    = (rw_reg32_t)0x52001008U; /** @brief DMA2D interrupt flag clear register. */
+static rw_reg32_t const DMA2D_FGMAR   = (rw_reg32_t)0x5200100CU; /** @brief DMA2D foreground memory address register. */
+static rw_reg32_t const DMA2D_FGOR    = (rw_reg32_t)0x52001010U; /** @brief DMA2D foreground offset register. */
+static rw_reg32_t const DMA2D_BGMAR   = (rw_reg32_t)0x52001014U; /** @brief DMA2D background memory address register. */
+static rw_reg32_t const DMA2D_BGOR    = (rw_reg32_t)0x52001018U; /** @brief DMA2D background offset register. */
+static rw_reg32_t const DMA2D_FGPFCCR = (rw_reg32_t)0x5200101CU; /** @brief DMA2D foreground PFC control register. */
+static rw_reg32_t const DMA2D_FGCOLR  = (rw_reg32_t)0x52001020U; /** @brief DMA2D foreground color register. */
+static rw_reg32_t const DMA2D_BGPFCCR = (rw_reg32_t)0x52001024U; /** @brief DMA2D background PFC control register. */
+static rw_reg32_t const DMA2D_BGCOLR  = (rw_reg32_t)0x52001028U; /** @brief DMA2D background color register. */
+static rw_reg32_t const DMA2D_FGCMAR  = (rw_reg32_t)0x5200102CU; /** @brief DMA2D foreground CLUT memory address register. */
+static rw_reg32_t const DMA2D_BGCMAR  = (rw_reg32_t)0x52001030U; /** @brief DMA2D background CLUT memory address register. */
+static rw_reg32_t const DMA2D_OPFCCR  = (rw_reg32_t)0x52001034U; /** @brief DMA2D output PFC control register. */
+static rw_reg32_t const DMA2D_OCOLR   = (rw_reg32_t)0x52001038U; /** @brief DMA2D output color register. */
+static rw_reg32_t const DMA2D_OMAR    = (rw_reg32_t)0x5200103CU; /** @brief DMA2D output memory address register. */
+static rw_reg32_t const DMA2D_OOR     = (rw_reg32_t)0x52001040U; /** @brief DMA2D output offset register. */
+static rw_reg32_t const DMA2D_NLR     = (rw_reg32_t)0x52001044U; /** @brief DMA2D number of line register. */
+static rw_reg32_t const DMA2D_LWR     = (rw_reg32_t)0x52001048U; /** @brief DMA2D line watermark register. */
+static rw_reg32_t const DMA2D_AMTCR   = (rw_reg32_t)0x5200104CU; /** @brief DMA2D AXI master timer configuration register. */
+
+/** @subsection DMA2D Register Field Definitions */
+
+static const field32_t DMA2D_CR_START      = {.msk = 0x00000001U, .pos = 0};  /** @brief Start This bit can be used to launch the DMA2D according to the parameters loaded in the various configuration registers. */
+static const field32_t DMA2D_CR_SUSP       = {.msk = 0x00000002U, .pos = 1};  /** @brief Suspend This bit can be used to suspend the current transfer. This bit is set and reset by software. It is automatically reset by hardware when the START bit is reset. */
+static const field32_t DMA2D_CR_ABORT      = {.msk = 0x00000004U, .pos = 2};  /** @brief Abort This bit can be used to abort the current transfer. This bit is set by software and is automatically reset by hardware when the START bit is reset. */
+static const field32_t DMA2D_CR_TEIE       = {.msk = 0x00000100U, .pos = 8};  /** @brief Transfer error interrupt enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_TCIE       = {.msk = 0x00000200U, .pos = 9};  /** @brief Transfer complete interrupt enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_TWIE       = {.msk = 0x00000400U, .pos = 10}; /** @brief Transfer watermark interrupt enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_CAEIE      = {.msk = 0x00000800U, .pos = 11}; /** @brief CLUT access error interrupt enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_CTCIE      = {.msk = 0x00001000U, .pos = 12}; /** @brief CLUT transfer complete interrupt enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_CEIE       = {.msk = 0x00002000U, .pos = 13}; /** @brief Configuration Error Interrupt Enable This bit is set and cleared by software. */
+static const field32_t DMA2D_CR_MODE       = {.msk = 0x00030000U, .pos = 16}; /** @brief DMA2D mode This bit is set and cleared by software. It cannot be modified while a transfer is ongoing. */
+static const field32_t DMA2D_ISR_TEIF      = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer error interrupt flag This bit is set when an error occurs during a DMA transfer (data transfer or automatic CLUT loading). */
+static const field32_t DMA2D_ISR_TCIF      = {.msk = 0x00000002U, .pos = 1};  /** @brief Transfer complete interrupt flag This bit is set when a DMA2D transfer operation is complete (data transfer only). */
+static const field32_t DMA2D_ISR_TWIF      = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer watermark interrupt flag This bit is set when the last pixel of the watermarked line has been transferred. */
+static const field32_t DMA2D_ISR_CAEIF     = {.msk = 0x00000008U, .pos = 3};  /** @brief CLUT access error interrupt flag This bit is set when the CPU accesses the CLUT while the CLUT is being automatically copied from a system memory to the internal DMA2D. */
+static const field32_t DMA2D_ISR_CTCIF     = {.msk = 0x00000010U, .pos = 4};  /** @brief CLUT transfer complete interrupt flag This bit is set when the CLUT copy from a system memory area to the internal DMA2D memory is complete. */
+static const field32_t DMA2D_ISR_CEIF      = {.msk = 0x00000020U, .pos = 5};  /** @brief Configuration error interrupt flag This bit is set when the START bit of DMA2D_CR, DMA2DFGPFCCR or DMA2D_BGPFCCR is set and a wrong configuration has been programmed. */
+static const field32_t DMA2D_IFCR_CTEIF    = {.msk = 0x00000001U, .pos = 0};  /** @brief Clear Transfer error interrupt flag Programming this bit to 1 clears the TEIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_IFCR_CTCIF    = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear transfer complete interrupt flag Programming this bit to 1 clears the TCIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_IFCR_CTWIF    = {.msk = 0x00000004U, .pos = 2};  /** @brief Clear transfer watermark interrupt flag Programming this bit to 1 clears the TWIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_IFCR_CAECIF   = {.msk = 0x00000008U, .pos = 3};  /** @brief Clear CLUT access error interrupt flag Programming this bit to 1 clears the CAEIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_IFCR_CCTCIF   = {.msk = 0x00000010U, .pos = 4};  /** @brief Clear CLUT transfer complete interrupt flag Programming this bit to 1 clears the CTCIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_IFCR_CCEIF    = {.msk = 0x00000020U, .pos = 5};  /** @brief Clear configuration error interrupt flag Programming this bit to 1 clears the CEIF flag in the DMA2D_ISR register. */
+static const field32_t DMA2D_FGOR_LO       = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Line offset Line offset used for the foreground expressed in pixel. This value is used to generate the address. It is added at the end of each line to determine the starting address of the next line. These bits can only be written when data transfers are disabled. Once a data transfer has started, they become read-only. If the image format is 4-bit per pixel, the line offset must be even. */
+static const field32_t DMA2D_BGOR_LO       = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Line offset Line offset used for the background image (expressed in pixel). This value is used for the address generation. It is added at the end of each line to determine the starting address of the next line. These bits can only be written when data transfers are disabled. Once data transfer has started, they become read-only. If the image format is 4-bit per pixel, the line offset must be even. */
+static const field32_t DMA2D_FGPFCCR_CM    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Color mode These bits defines the color format of the foreground image. They can only be written when data transfers are disabled. Once the transfer has started, they are read-only. others: meaningless. */
+static const field32_t DMA2D_FGPFCCR_CCM   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLUT color mode This bit defines the color format of the CLUT. It can only be written when the transfer is disabled. Once the CLUT transfer has started, this bit is read-only. */
+static const field32_t DMA2D_FGPFCCR_START = {.msk = 0x00000020U, .pos = 5};  /** @brief Start This bit can be set to start the automatic loading of the CLUT. It is automatically reset: ** at the end of the transfer ** when the transfer is aborted by the user application by setting the ABORT bit in DMA2D_CR ** when a transfer error occurs ** when the transfer has not started due to a configuration error or another transfer operation already ongoing (data transfer or automatic background CLUT transfer). */
+static const field32_t DMA2D_FGPFCCR_CS    = {.msk = 0x0000FF00U, .pos = 8};  /** @brief CLUT size These bits define the size of the CLUT used for the foreground image. Once the CLUT transfer has started, this field is read-only. The number of CLUT entries is equal to CS[7:0] + 1. */
+static const field32_t DMA2D_FGPFCCR_AM    = {.msk = 0x00030000U, .pos = 16}; /** @brief Alpha mode These bits select the alpha channel value to be used for the foreground image. They can only be written data the transfer are disabled. Once the transfer has started, they become read-only. other configurations are meaningless. */
+static const field32_t DMA2D_FGPFCCR_CSS   = {.msk = 0x000C0000U, .pos = 18}; /** @brief Chroma Sub-Sampling These bits define the chroma sub-sampling mode for YCbCr color mode. Once the transfer has started, these bits are read-only. others: meaningless. */
+static const field32_t DMA2D_FGPFCCR_AI    = {.msk = 0x00100000U, .pos = 20}; /** @brief Alpha Inverted This bit inverts the alpha value. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_FGPFCCR_RBS   = {.msk = 0x00200000U, .pos = 21}; /** @brief Red Blue Swap This bit allows to swap the R &amp; B to support BGR or ABGR color formats. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_FGPFCCR_ALPHA = {.msk = 0xFF000000U, .pos = 24}; /** @brief Alpha value These bits define a fixed alpha channel value which can replace the original alpha value or be multiplied by the original alpha value according to the alpha mode selected through the AM[1:0] bits. These bits can only be written when data transfers are disabled. Once a transfer has started, they become read-only. */
+static const field32_t DMA2D_FGCOLR_BLUE   = {.msk = 0x000000FFU, .pos = 0};  /** @brief Blue Value These bits defines the blue value for the A4 or A8 mode of the foreground image. They can only be written when data transfers are disabled. Once the transfer has started, They are read-only. */
+static const field32_t DMA2D_FGCOLR_GREEN  = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Green Value These bits defines the green value for the A4 or A8 mode of the foreground image. They can only be written when data transfers are disabled. Once the transfer has started, They are read-only. */
+static const field32_t DMA2D_FGCOLR_RED    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Red Value These bits defines the red value for the A4 or A8 mode of the foreground image. They can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_BGPFCCR_CM    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Color mode These bits define the color format of the foreground image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. others: meaningless. */
+static const field32_t DMA2D_BGPFCCR_CCM   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLUT Color mode These bits define the color format of the CLUT. This register can only be written when the transfer is disabled. Once the CLUT transfer has started, this bit is read-only. */
+static const field32_t DMA2D_BGPFCCR_START = {.msk = 0x00000020U, .pos = 5};  /** @brief Start This bit is set to start the automatic loading of the CLUT. This bit is automatically reset: ** at the end of the transfer ** when the transfer is aborted by the user application by setting the ABORT bit in the DMA2D_CR ** when a transfer error occurs ** when the transfer has not started due to a configuration error or another transfer operation already on going (data transfer or automatic BackGround CLUT transfer). */
+static const field32_t DMA2D_BGPFCCR_CS    = {.msk = 0x0000FF00U, .pos = 8};  /** @brief CLUT size These bits define the size of the CLUT used for the BG. Once the CLUT transfer has started, this field is read-only. The number of CLUT entries is equal to CS[7:0] + 1. */
+static const field32_t DMA2D_BGPFCCR_AM    = {.msk = 0x00030000U, .pos = 16}; /** @brief Alpha mode These bits define which alpha channel value to be used for the background image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. others: meaningless. */
+static const field32_t DMA2D_BGPFCCR_AI    = {.msk = 0x00100000U, .pos = 20}; /** @brief Alpha Inverted This bit inverts the alpha value. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_BGPFCCR_RBS   = {.msk = 0x00200000U, .pos = 21}; /** @brief Red Blue Swap This bit allows to swap the R &amp; B to support BGR or ABGR color formats. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_BGPFCCR_ALPHA = {.msk = 0xFF000000U, .pos = 24}; /** @brief Alpha value These bits define a fixed alpha channel value which can replace the original alpha value or be multiplied with the original alpha value according to the alpha mode selected with bits AM[1: 0]. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_BGCOLR_BLUE   = {.msk = 0x000000FFU, .pos = 0};  /** @brief Blue Value These bits define the blue value for the A4 or A8 mode of the background. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_BGCOLR_GREEN  = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Green Value These bits define the green value for the A4 or A8 mode of the background. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_BGCOLR_RED    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Red Value These bits define the red value for the A4 or A8 mode of the background. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_OPFCCR_CM     = {.msk = 0x00000007U, .pos = 0};  /** @brief Color mode These bits define the color format of the output image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. others: meaningless. */
+static const field32_t DMA2D_OPFCCR_AI     = {.msk = 0x00100000U, .pos = 20}; /** @brief Alpha Inverted This bit inverts the alpha value. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_OPFCCR_RBS    = {.msk = 0x00200000U, .pos = 21}; /** @brief Red Blue Swap This bit allows to swap the R &amp; B to support BGR or ABGR color formats. Once the transfer has started, this bit is read-only. */
+static const field32_t DMA2D_OCOLR_BLUE    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Blue Value These bits define the blue value of the output image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_OCOLR_GREEN   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Green Value These bits define the green value of the output image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_OCOLR_RED     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Red Value These bits define the red value of the output image. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_OCOLR_ALPHA   = {.msk = 0xFF000000U, .pos = 24}; /** @brief Alpha Channel Value These bits define the alpha channel of the output color. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_OOR_LO        = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Line Offset Line offset used for the output (expressed in pixels). This value is used for the address generation. It is added at the end of each line to determine the starting address of the next line. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_NLR_NL        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Number of lines Number of lines of the area to be transferred. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_NLR_PL        = {.msk = 0x3FFF0000U, .pos = 16}; /** @brief Pixel per lines Number of pixels per lines of the area to be transferred. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. If any of the input image format is 4-bit per pixel, pixel per lines must be even. */
+static const field32_t DMA2D_LWR_LW        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Line watermark These bits allow to configure the line watermark for interrupt generation. An interrupt is raised when the last pixel of the watermarked line has been transferred. These bits can only be written when data transfers are disabled. Once the transfer has started, they are read-only. */
+static const field32_t DMA2D_AMTCR_EN      = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable Enables the dead time functionality. */
+static const field32_t DMA2D_AMTCR_DT      = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Dead Time Dead time value in the AXI clock cycle inserted between two consecutive accesses on the AXI master port. These bits represent the minimum guaranteed number of cycles between two consecutive AXI accesses. */
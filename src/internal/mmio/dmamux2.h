@@ -0,0 +1,85 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dmamux2.h
+ * @authors UW SARP
+ * @brief Registers and fields of DMAMUX2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DMAMUX2 Definitions
+ **************************************************************************************************/
+
+/** @subsection DMAMUX2 Register Definitions */
+
+static ro_reg32_t const DMAMUX2_RGSR  = (ro_reg32_t)0x58025940U; /** @brief DMAMux - DMA request generator status register. */
+static rw_reg32_t const DMAMUX2_RGCFR = (rw_reg32_t)0x58025944U; /** @brief DMAMux - DMA request generator clear flag register. */
+static ro_reg32_t const DMAMUX2_CSR   = (ro_reg32_t)0x58025880U; /** @brief DMAMUX request line multiplexer interrupt channel status register. */
+static rw_reg32_t const DMAMUX2_CFR   = (rw_reg32_t)0x58025884U; /** @brief DMAMUX request line multiplexer interrupt clear flag register. */
+
+/** @subsection Enumerated DMAMUX2 Register Definitions */
+
+/** @brief DMAMux - DMA request line multiplexer channel x control register. */
+static rw_reg32_t const DMAMUX2_CxCR[8] = {
+  [0] = (rw_reg32_t)0x58025800U,
+  [1] = (rw_reg32_t)0x58025804U,
+  [2] = (rw_reg32_t)0x58025808U,
+  [3] = (rw_reg32_t)0x5802580CU,
+  [4] = (rw_reg32_t)0x58025810U,
+  [5] = (rw_reg32_t)0x58025814U,
+  [6] = (rw_reg32_t)0x58025818U,
+  [7] = (rw_reg32_t)0x5802581CU,
+};
+
+/** @brief DMAMux - DMA request generator channel x control register. */
+static rw_reg32_t const DMAMUX2_RGxCR[8] = {
+  [0] = (rw_reg32_t)0x58025900U,
+  [1] = (rw_reg32_t)0x58025904U,
+  [2] = (rw_reg32_t)0x58025908U,
+  [3] = (rw_reg32_t)0x5802590CU,
+  [4] = (rw_reg32_t)0x58025910U,
+  [5] = (rw_reg32_t)0x58025914U,
+  [6] = (rw_reg32_t)0x58025918U,
+  [7] = (rw_reg32_t)0x5802591CU,
+};
+
+/** @subsection DMAMUX2 Register Field Definitions */
+
+static const field32_t DMAMUX2_RGSR_OF        = {.msk = 0x000000FFU, .pos = 0};  /** @brief Trigger event overrun flag The flag is set when a trigger event occurs on DMA request generator channel x, while the DMA request generator counter value is lower than GNBREQ. The flag is cleared by writing 1 to the corresponding COFx bit in DMAMUX_RGCFR register. */
+static const field32_t DMAMUX2_RGCFR_COF      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Clear trigger event overrun flag Upon setting, this bit clears the corresponding overrun flag OFx in the DMAMUX_RGCSR register. */
+static const field32_t DMAMUX2_CSR_SOF        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Synchronization overrun event flag. */
+static const field32_t DMAMUX2_CFR_CSOF       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Clear synchronization overrun event flag. */
+static const field32_t DMAMUX2_CxCR_DMAREQ_ID = {.msk = 0x000000FFU, .pos = 0};  /** @brief Input DMA request line selected. */
+static const field32_t DMAMUX2_CxCR_SOIE      = {.msk = 0x00000100U, .pos = 8};  /** @brief Interrupt enable at synchronization event overrun. */
+static const field32_t DMAMUX2_CxCR_EGE       = {.msk = 0x00000200U, .pos = 9};  /** @brief Event generation enable/disable. */
+static const field32_t DMAMUX2_CxCR_SE        = {.msk = 0x00010000U, .pos = 16}; /** @brief Synchronous operating mode enable/disable. */
+static const field32_t DMAMUX2_CxCR_SPOL      = {.msk = 0x00060000U, .pos = 17}; /** @brief Synchronization event type selector Defines the synchronization event on the selected synchronization input:. */
+static const field32_t DMAMUX2_CxCR_NBREQ     = {.msk = 0x00F80000U, .pos = 19}; /** @brief Number of DMA requests to forward Defines the number of DMA requests forwarded before output event is generated. In synchronous mode, it also defines the number of DMA requests to forward after a synchronization event, then stop forwarding. The actual number of DMA requests forwarded is NBREQ+1. Note: This field can only be written when both SE and EGE bits are reset. */
+static const field32_t DMAMUX2_CxCR_SYNC_ID   = {.msk = 0x1F000000U, .pos = 24}; /** @brief Synchronization input selected. */
+static const field32_t DMAMUX2_RGxCR_SIG_ID   = {.msk = 0x0000001FU, .pos = 0};  /** @brief DMA request trigger input selected. */
+static const field32_t DMAMUX2_RGxCR_OIE      = {.msk = 0x00000100U, .pos = 8};  /** @brief Interrupt enable at trigger event overrun. */
+static const field32_t DMAMUX2_RGxCR_GE       = {.msk = 0x00010000U, .pos = 16}; /** @brief DMA request generator channel enable/disable. */
+static const field32_t DMAMUX2_RGxCR_GPOL     = {.msk = 0x00060000U, .pos = 17}; /** @brief DMA request generator trigger event type selection Defines the trigger event on the selected DMA request trigger input. */
+static const field32_t DMAMUX2_RGxCR_GNBREQ   = {.msk = 0x00F80000U, .pos = 19}; /** @brief Number of DMA requests to generate Defines the number of DMA requests generated after a trigger event, then stop generating. The actual number of generated DMA requests is GNBREQ+1. Note: This field can only be written when GE bit is reset. */
@@ -0,0 +1,538 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dmax.h
+ * @authors UW SARP
+ * @brief Registers and fields of DMA1, DMA2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DMAx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated DMAx Register Definitions */
+
+/** @brief Low interrupt status register. */
+static ro_reg32_t const DMAx_LISR[3] = {
+  [1] = (ro_reg32_t)0x40020000U,
+  [2] = (ro_reg32_t)0x40020400U,
+};
+
+/** @brief High interrupt status register. */
+static ro_reg32_t const DMAx_HISR[3] = {
+  [1] = (ro_reg32_t)0x40020004U,
+  [2] = (ro_reg32_t)0x40020404U,
+};
+
+/** @brief Low interrupt flag clear register. */
+static rw_reg32_t const DMAx_LIFCR[3] = {
+  [1] = (rw_reg32_t)0x40020008U,
+  [2] = (rw_reg32_t)0x40020408U,
+};
+
+/** @brief High interrupt flag clear register. */
+static rw_reg32_t const DMAx_HIFCR[3] = {
+  [1] = (rw_reg32_t)0x4002000CU,
+  [2] = (rw_reg32_t)0x4002040CU,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S0CR[3] = {
+  [1] = (rw_reg32_t)0x40020010U,
+  [2] = (rw_reg32_t)0x40020410U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S1CR[3] = {
+  [1] = (rw_reg32_t)0x40020028U,
+  [2] = (rw_reg32_t)0x40020428U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S2CR[3] = {
+  [1] = (rw_reg32_t)0x40020040U,
+  [2] = (rw_reg32_t)0x40020440U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S3CR[3] = {
+  [1] = (rw_reg32_t)0x40020058U,
+  [2] = (rw_reg32_t)0x40020458U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S4CR[3] = {
+  [1] = (rw_reg32_t)0x40020070U,
+  [2] = (rw_reg32_t)0x40020470U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S5CR[3] = {
+  [1] = (rw_reg32_t)0x40020088U,
+  [2] = (rw_reg32_t)0x40020488U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S6CR[3] = {
+  [1] = (rw_reg32_t)0x400200A0U,
+  [2] = (rw_reg32_t)0x400204A0U,
+};
+
+/** @brief Stream x configuration register. */
+static rw_reg32_t const DMAx_S7CR[3] = {
+  [1] = (rw_reg32_t)0x400200B8U,
+  [2] = (rw_reg32_t)0x400204B8U,
+};
+
+/** @brief Stream x number of data register. */
+static rw_reg32_t const DMAx_SxNDTR[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40020014U, [1] = (rw_reg32_t)0x4002002CU, [2] = (rw_reg32_t)0x40020044U, [3] = (rw_reg32_t)0x4002005CU, [4] = (rw_reg32_t)0x40020074U, [5] = (rw_reg32_t)0x4002008CU, [6] = (rw_reg32_t)0x400200A4U, [7] = (rw_reg32_t)0x400200BCU},
+  [2] = {[0] = (rw_reg32_t)0x40020414U, [1] = (rw_reg32_t)0x4002042CU, [2] = (rw_reg32_t)0x40020444U, [3] = (rw_reg32_t)0x4002045CU, [4] = (rw_reg32_t)0x40020474U, [5] = (rw_reg32_t)0x4002048CU, [6] = (rw_reg32_t)0x400204A4U, [7] = (rw_reg32_t)0x400204BCU},
+};
+
+/** @brief Stream x peripheral address register. */
+static rw_reg32_t const DMAx_SxPAR[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40020018U, [1] = (rw_reg32_t)0x40020030U, [2] = (rw_reg32_t)0x40020048U, [3] = (rw_reg32_t)0x40020060U, [4] = (rw_reg32_t)0x40020078U, [5] = (rw_reg32_t)0x40020090U, [6] = (rw_reg32_t)0x400200A8U, [7] = (rw_reg32_t)0x400200C0U},
+  [2] = {[0] = (rw_reg32_t)0x40020418U, [1] = (rw_reg32_t)0x40020430U, [2] = (rw_reg32_t)0x40020448U, [3] = (rw_reg32_t)0x40020460U, [4] = (rw_reg32_t)0x40020478U, [5] = (rw_reg32_t)0x40020490U, [6] = (rw_reg32_t)0x400204A8U, [7] = (rw_reg32_t)0x400204C0U},
+};
+
+/** @brief Stream x memory 0 address register. */
+static rw_reg32_t const DMAx_SxM0AR[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x4002001CU, [1] = (rw_reg32_t)0x40020034U, [2] = (rw_reg32_t)0x4002004CU, [3] = (rw_reg32_t)0x40020064U, [4] = (rw_reg32_t)0x4002007CU, [5] = (rw_reg32_t)0x40020094U, [6] = (rw_reg32_t)0x400200ACU, [7] = (rw_reg32_t)0x400200C4U},
+  [2] = {[0] = (rw_reg32_t)0x4002041CU, [1] = (rw_reg32_t)0x40020434U, [2] = (rw_reg32_t)0x4002044CU, [3] = (rw_reg32_t)0x40020464U, [4] = (rw_reg32_t)0x4002047CU, [5] = (rw_reg32_t)0x40020494U, [6] = (rw_reg32_t)0x400204ACU, [7] = (rw_reg32_t)0x400204C4U},
+};
+
+/** @brief Stream x memory 1 address register. */
+static rw_reg32_t const DMAx_SxM1AR[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40020020U, [1] = (rw_reg32_t)0x40020038U, [2] = (rw_reg32_t)0x40020050U, [3] = (rw_reg32_t)0x40020068U, [4] = (rw_reg32_t)0x40020080U, [5] = (rw_reg32_t)0x40020098U, [6] = (rw_reg32_t)0x400200B0U, [7] = (rw_reg32_t)0x400200C8U},
+  [2] = {[0] = (rw_reg32_t)0x40020420U, [1] = (rw_reg32_t)0x40020438U, [2] = (rw_reg32_t)0x40020450U, [3] = (rw_reg32_t)0x40020468U, [4] = (rw_reg32_t)0x40020480U, [5] = (rw_reg32_t)0x40020498U, [6] = (rw_reg32_t)0x400204B0U, [7] = (rw_reg32_t)0x400204C8U},
+};
+
+/** @brief Stream x FIFO control register. */
+static rw_reg32_t const DMAx_SxFCR[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40020024U, [1] = (rw_reg32_t)0x4002003CU, [2] = (rw_reg32_t)0x40020054U, [3] = (rw_reg32_t)0x4002006CU, [4] = (rw_reg32_t)0x40020084U, [5] = (rw_reg32_t)0x4002009CU, [6] = (rw_reg32_t)0x400200B4U, [7] = (rw_reg32_t)0x400200CCU},
+  [2] = {[0] = (rw_reg32_t)0x40020424U, [1] = (rw_reg32_t)0x4002043CU, [2] = (rw_reg32_t)0x40020454U, [3] = (rw_reg32_t)0x4002046CU, [4] = (rw_reg32_t)0x40020484U, [5] = (rw_reg32_t)0x4002049CU, [6] = (rw_reg32_t)0x400204B4U, [7] = (rw_reg32_t)0x400204CCU},
+};
+
+/** @subsection DMAx Register Field Definitions */
+
+static const field32_t DMAx_LISR_TCIF3    = {.msk = 0x08000000U, .pos = 27}; /** @brief Stream x transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LISR_HTIF3    = {.msk = 0x04000000U, .pos = 26}; /** @brief Stream x half transfer interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TEIF3    = {.msk = 0x02000000U, .pos = 25}; /** @brief Stream x transfer error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_DMEIF3   = {.msk = 0x01000000U, .pos = 24}; /** @brief Stream x direct mode error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_FEIF3    = {.msk = 0x00400000U, .pos = 22}; /** @brief Stream x FIFO error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TCIF2    = {.msk = 0x00200000U, .pos = 21}; /** @brief Stream x transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LISR_HTIF2    = {.msk = 0x00100000U, .pos = 20}; /** @brief Stream x half transfer interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TEIF2    = {.msk = 0x00080000U, .pos = 19}; /** @brief Stream x transfer error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_DMEIF2   = {.msk = 0x00040000U, .pos = 18}; /** @brief Stream x direct mode error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_FEIF2    = {.msk = 0x00010000U, .pos = 16}; /** @brief Stream x FIFO error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TCIF1    = {.msk = 0x00000800U, .pos = 11}; /** @brief Stream x transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LISR_HTIF1    = {.msk = 0x00000400U, .pos = 10}; /** @brief Stream x half transfer interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TEIF1    = {.msk = 0x00000200U, .pos = 9};  /** @brief Stream x transfer error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_DMEIF1   = {.msk = 0x00000100U, .pos = 8};  /** @brief Stream x direct mode error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_FEIF1    = {.msk = 0x00000040U, .pos = 6};  /** @brief Stream x FIFO error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TCIF0    = {.msk = 0x00000020U, .pos = 5};  /** @brief Stream x transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LISR_HTIF0    = {.msk = 0x00000010U, .pos = 4};  /** @brief Stream x half transfer interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TEIF0    = {.msk = 0x00000008U, .pos = 3};  /** @brief Stream x transfer error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_DMEIF0   = {.msk = 0x00000004U, .pos = 2};  /** @brief Stream x direct mode error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_FEIF0    = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream x FIFO error interrupt flag (x=3..0). */
+static const field32_t DMAx_HISR_TCIF7    = {.msk = 0x08000000U, .pos = 27}; /** @brief Stream x transfer complete interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_HTIF7    = {.msk = 0x04000000U, .pos = 26}; /** @brief Stream x half transfer interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TEIF7    = {.msk = 0x02000000U, .pos = 25}; /** @brief Stream x transfer error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_DMEIF7   = {.msk = 0x01000000U, .pos = 24}; /** @brief Stream x direct mode error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_FEIF7    = {.msk = 0x00400000U, .pos = 22}; /** @brief Stream x FIFO error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TCIF6    = {.msk = 0x00200000U, .pos = 21}; /** @brief Stream x transfer complete interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_HTIF6    = {.msk = 0x00100000U, .pos = 20}; /** @brief Stream x half transfer interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TEIF6    = {.msk = 0x00080000U, .pos = 19}; /** @brief Stream x transfer error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_DMEIF6   = {.msk = 0x00040000U, .pos = 18}; /** @brief Stream x direct mode error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_FEIF6    = {.msk = 0x00010000U, .pos = 16}; /** @brief Stream x FIFO error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TCIF5    = {.msk = 0x00000800U, .pos = 11}; /** @brief Stream x transfer complete interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_HTIF5    = {.msk = 0x00000400U, .pos = 10}; /** @brief Stream x half transfer interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TEIF5    = {.msk = 0x00000200U, .pos = 9};  /** @brief Stream x transfer error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_DMEIF5   = {.msk = 0x00000100U, .pos = 8};  /** @brief Stream x direct mode error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_FEIF5    = {.msk = 0x00000040U, .pos = 6};  /** @brief Stream x FIFO error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TCIF4    = {.msk = 0x00000020U, .pos = 5};  /** @brief Stream x transfer complete interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_HTIF4    = {.msk = 0x00000010U, .pos = 4};  /** @brief Stream x half transfer interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TEIF4    = {.msk = 0x00000008U, .pos = 3};  /** @brief Stream x transfer error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_DMEIF4   = {.msk = 0x00000004U, .pos = 2};  /** @brief Stream x direct mode error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_FEIF4    = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream x FIFO error interrupt flag (x=7..4). */
+static const field32_t DMAx_LIFCR_CTCIF3  = {.msk = 0x08000000U, .pos = 27}; /** @brief Stream x clear transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CHTIF3  = {.msk = 0x04000000U, .pos = 26}; /** @brief Stream x clear half transfer interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTEIF3  = {.msk = 0x02000000U, .pos = 25}; /** @brief Stream x clear transfer error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CDMEIF3 = {.msk = 0x01000000U, .pos = 24}; /** @brief Stream x clear direct mode error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CFEIF3  = {.msk = 0x00400000U, .pos = 22}; /** @brief Stream x clear FIFO error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTCIF2  = {.msk = 0x00200000U, .pos = 21}; /** @brief Stream x clear transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CHTIF2  = {.msk = 0x00100000U, .pos = 20}; /** @brief Stream x clear half transfer interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTEIF2  = {.msk = 0x00080000U, .pos = 19}; /** @brief Stream x clear transfer error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CDMEIF2 = {.msk = 0x00040000U, .pos = 18}; /** @brief Stream x clear direct mode error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CFEIF2  = {.msk = 0x00010000U, .pos = 16}; /** @brief Stream x clear FIFO error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTCIF1  = {.msk = 0x00000800U, .pos = 11}; /** @brief Stream x clear transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CHTIF1  = {.msk = 0x00000400U, .pos = 10}; /** @brief Stream x clear half transfer interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTEIF1  = {.msk = 0x00000200U, .pos = 9};  /** @brief Stream x clear transfer error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CDMEIF1 = {.msk = 0x00000100U, .pos = 8};  /** @brief Stream x clear direct mode error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CFEIF1  = {.msk = 0x00000040U, .pos = 6};  /** @brief Stream x clear FIFO error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTCIF0  = {.msk = 0x00000020U, .pos = 5};  /** @brief Stream x clear transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CHTIF0  = {.msk = 0x00000010U, .pos = 4};  /** @brief Stream x clear half transfer interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTEIF0  = {.msk = 0x00000008U, .pos = 3};  /** @brief Stream x clear transfer error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CDMEIF0 = {.msk = 0x00000004U, .pos = 2};  /** @brief Stream x clear direct mode error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CFEIF0  = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream x clear FIFO error interrupt flag (x = 3..0). */
+static const field32_t DMAx_HIFCR_CTCIF7  = {.msk = 0x08000000U, .pos = 27}; /** @brief Stream x clear transfer complete interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CHTIF7  = {.msk = 0x04000000U, .pos = 26}; /** @brief Stream x clear half transfer interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTEIF7  = {.msk = 0x02000000U, .pos = 25}; /** @brief Stream x clear transfer error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CDMEIF7 = {.msk = 0x01000000U, .pos = 24}; /** @brief Stream x clear direct mode error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CFEIF7  = {.msk = 0x00400000U, .pos = 22}; /** @brief Stream x clear FIFO error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTCIF6  = {.msk = 0x00200000U, .pos = 21}; /** @brief Stream x clear transfer complete interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CHTIF6  = {.msk = 0x00100000U, .pos = 20}; /** @brief Stream x clear half transfer interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTEIF6  = {.msk = 0x00080000U, .pos = 19}; /** @brief Stream x clear transfer error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CDMEIF6 = {.msk = 0x00040000U, .pos = 18}; /** @brief Stream x clear direct mode error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CFEIF6  = {.msk = 0x00010000U, .pos = 16}; /** @brief Stream x clear FIFO error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTCIF5  = {.msk = 0x00000800U, .pos = 11}; /** @brief Stream x clear transfer complete interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CHTIF5  = {.msk = 0x00000400U, .pos = 10}; /** @brief Stream x clear half transfer interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTEIF5  = {.msk = 0x00000200U, .pos = 9};  /** @brief Stream x clear transfer error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CDMEIF5 = {.msk = 0x00000100U, .pos = 8};  /** @brief Stream x clear direct mode error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CFEIF5  = {.msk = 0x00000040U, .pos = 6};  /** @brief Stream x clear FIFO error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTCIF4  = {.msk = 0x00000020U, .pos = 5};  /** @brief Stream x clear transfer complete interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CHTIF4  = {.msk = 0x00000010U, .pos = 4};  /** @brief Stream x clear half transfer interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTEIF4  = {.msk = 0x00000008U, .pos = 3};  /** @brief Stream x clear transfer error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CDMEIF4 = {.msk = 0x00000004U, .pos = 2};  /** @brief Stream x clear direct mode error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CFEIF4  = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream x clear FIFO error interrupt flag (x = 7..4). */
+static const field32_t DMAx_S0CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S0CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S0CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S0CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S0CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S0CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S0CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S0CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S0CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S0CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S0CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S0CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S0CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S0CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S0CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S0CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S0CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S0CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S1CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S1CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S1CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S1CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S1CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S1CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S1CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S1CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S1CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S1CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S1CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S1CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S1CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S1CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S1CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S1CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S1CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S1CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S1CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S2CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S2CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S2CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S2CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S2CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S2CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S2CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S2CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S2CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S2CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S2CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S2CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S2CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S2CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S2CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S2CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S2CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S2CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S2CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S3CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S3CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S3CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S3CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S3CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S3CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S3CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S3CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S3CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S3CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S3CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S3CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S3CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S3CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S3CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S3CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S3CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S3CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S3CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S4CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S4CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S4CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S4CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S4CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S4CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S4CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S4CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S4CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S4CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S4CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S4CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S4CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S4CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S4CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S4CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S4CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S4CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S4CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S5CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S5CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S5CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S5CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S5CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S5CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S5CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S5CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S5CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S5CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S5CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S5CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S5CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S5CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S5CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S5CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S5CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S5CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S5CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S6CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S6CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S6CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S6CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S6CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S6CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S6CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S6CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S6CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S6CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S6CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S6CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S6CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S6CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S6CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S6CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S6CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S6CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S6CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_S7CR_MBURST   = {.msk = 0x01800000U, .pos = 23}; /** @brief Memory burst transfer configuration. */
+static const field32_t DMAx_S7CR_PBURST   = {.msk = 0x00600000U, .pos = 21}; /** @brief Peripheral burst transfer configuration. */
+static const field32_t DMAx_S7CR_ACK      = {.msk = 0x00100000U, .pos = 20}; /** @brief ACK. */
+static const field32_t DMAx_S7CR_CT       = {.msk = 0x00080000U, .pos = 19}; /** @brief Current target (only in double buffer mode). */
+static const field32_t DMAx_S7CR_DBM      = {.msk = 0x00040000U, .pos = 18}; /** @brief Double buffer mode. */
+static const field32_t DMAx_S7CR_PL       = {.msk = 0x00030000U, .pos = 16}; /** @brief Priority level. */
+static const field32_t DMAx_S7CR_PINCOS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Peripheral increment offset size. */
+static const field32_t DMAx_S7CR_MSIZE    = {.msk = 0x00006000U, .pos = 13}; /** @brief Memory data size. */
+static const field32_t DMAx_S7CR_PSIZE    = {.msk = 0x00001800U, .pos = 11}; /** @brief Peripheral data size. */
+static const field32_t DMAx_S7CR_MINC     = {.msk = 0x00000400U, .pos = 10}; /** @brief Memory increment mode. */
+static const field32_t DMAx_S7CR_PINC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Peripheral increment mode. */
+static const field32_t DMAx_S7CR_CIRC     = {.msk = 0x00000100U, .pos = 8};  /** @brief Circular mode. */
+static const field32_t DMAx_S7CR_DIR      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Data transfer direction. */
+static const field32_t DMAx_S7CR_PFCTRL   = {.msk = 0x00000020U, .pos = 5};  /** @brief Peripheral flow controller. */
+static const field32_t DMAx_S7CR_TCIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Transfer complete interrupt enable. */
+static const field32_t DMAx_S7CR_HTIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Half transfer interrupt enable. */
+static const field32_t DMAx_S7CR_TEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer error interrupt enable. */
+static const field32_t DMAx_S7CR_DMEIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Direct mode error interrupt enable. */
+static const field32_t DMAx_S7CR_EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Stream enable / flag stream ready when read low. */
+static const field32_t DMAx_SxNDTR_NDT    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Number of data items to transfer. */
+static const field32_t DMAx_SxFCR_FEIE    = {.msk = 0x00000080U, .pos = 7};  /** @brief FIFO error interrupt enable. */
+static const field32_t DMAx_SxFCR_FS      = {.msk = 0x00000038U, .pos = 3};  /** @brief FIFO status. */
+static const field32_t DMAx_SxFCR_DMDIS   = {.msk = 0x00000004U, .pos = 2};  /** @brief Direct mode disable. */
+static const field32_t DMAx_SxFCR_FTH     = {.msk = 0x00000003U, .pos = 0};  /** @brief FIFO threshold selection. */
+
+/** @subsection Enumerated DMAx Register Field Definitions */
+
+/** @brief Stream x transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LISR_TCIFx[4] = {
+  [0] = {.msk = 0x00000020U, .pos = 5},
+  [1] = {.msk = 0x00000800U, .pos = 11},
+  [2] = {.msk = 0x00200000U, .pos = 21},
+  [3] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Stream x half transfer interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_HTIFx[4] = {
+  [0] = {.msk = 0x00000010U, .pos = 4},
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief Stream x transfer error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_TEIFx[4] = {
+  [0] = {.msk = 0x00000008U, .pos = 3},
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+  [3] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief Stream x direct mode error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_DMEIFx[4] = {
+  [0] = {.msk = 0x00000004U, .pos = 2},
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Stream x FIFO error interrupt flag (x=3..0). */
+static const field32_t DMAx_LISR_FEIFx[4] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00010000U, .pos = 16},
+  [3] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Stream x transfer complete interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TCIFx[8] = {
+  [4] = {.msk = 0x00000020U, .pos = 5},
+  [5] = {.msk = 0x00000800U, .pos = 11},
+  [6] = {.msk = 0x00200000U, .pos = 21},
+  [7] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Stream x half transfer interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_HTIFx[8] = {
+  [4] = {.msk = 0x00000010U, .pos = 4},
+  [5] = {.msk = 0x00000400U, .pos = 10},
+  [6] = {.msk = 0x00100000U, .pos = 20},
+  [7] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief Stream x transfer error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_TEIFx[8] = {
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000200U, .pos = 9},
+  [6] = {.msk = 0x00080000U, .pos = 19},
+  [7] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief Stream x direct mode error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_DMEIFx[8] = {
+  [4] = {.msk = 0x00000004U, .pos = 2},
+  [5] = {.msk = 0x00000100U, .pos = 8},
+  [6] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Stream x FIFO error interrupt flag (x=7..4). */
+static const field32_t DMAx_HISR_FEIFx[8] = {
+  [4] = {.msk = 0x00000001U, .pos = 0},
+  [5] = {.msk = 0x00000040U, .pos = 6},
+  [6] = {.msk = 0x00010000U, .pos = 16},
+  [7] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Stream x clear transfer complete interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTCIFx[4] = {
+  [0] = {.msk = 0x00000020U, .pos = 5},
+  [1] = {.msk = 0x00000800U, .pos = 11},
+  [2] = {.msk = 0x00200000U, .pos = 21},
+  [3] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Stream x clear half transfer interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CHTIFx[4] = {
+  [0] = {.msk = 0x00000010U, .pos = 4},
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief Stream x clear transfer error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CTEIFx[4] = {
+  [0] = {.msk = 0x00000008U, .pos = 3},
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+  [3] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief Stream x clear direct mode error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CDMEIFx[4] = {
+  [0] = {.msk = 0x00000004U, .pos = 2},
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Stream x clear FIFO error interrupt flag (x = 3..0). */
+static const field32_t DMAx_LIFCR_CFEIFx[4] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00010000U, .pos = 16},
+  [3] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Stream x clear transfer complete interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTCIFx[8] = {
+  [4] = {.msk = 0x00000020U, .pos = 5},
+  [5] = {.msk = 0x00000800U, .pos = 11},
+  [6] = {.msk = 0x00200000U, .pos = 21},
+  [7] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Stream x clear half transfer interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CHTIFx[8] = {
+  [4] = {.msk = 0x00000010U, .pos = 4},
+  [5] = {.msk = 0x00000400U, .pos = 10},
+  [6] = {.msk = 0x00100000U, .pos = 20},
+  [7] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief Stream x clear transfer error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CTEIFx[8] = {
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000200U, .pos = 9},
+  [6] = {.msk = 0x00080000U, .pos = 19},
+  [7] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief Stream x clear direct mode error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CDMEIFx[8] = {
+  [4] = {.msk = 0x00000004U, .pos = 2},
+  [5] = {.msk = 0x00000100U, .pos = 8},
+  [6] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Stream x clear FIFO error interrupt flag (x = 7..4). */
+static const field32_t DMAx_HIFCR_CFEIFx[8] = {
+  [4] = {.msk = 0x00000001U, .pos = 0},
+  [5] = {.msk = 0x00000040U, .pos = 6},
+  [6] = {.msk = 0x00010000U, .pos = 16},
+  [7] = {.msk = 0x00400000U, .pos = 22},
+};
@@ -0,0 +1,554 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/dsihost.h
+ * @authors UW SARP
+ * @brief Registers and fields of DSIHOST.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section DSIHOST Definitions
+ **************************************************************************************************/
+
+/** @subsection DSIHOST Register Definitions */
+
+static ro_reg32_t const DSIHOST_DSI_VR      = (ro_reg32_t)0x50000000U; /** @brief DSI Host version register. */
+static rw_reg32_t const DSIHOST_DSI_CR      = (rw_reg32_t)0x50000004U; /** @brief DSI Host control register. */
+static rw_reg32_t const DSIHOST_DSI_CCR     = (rw_reg32_t)0x50000008U; /** @brief DSI Host clock control register. */
+static rw_reg32_t const DSIHOST_DSI_LVCIDR  = (rw_reg32_t)0x5000000CU; /** @brief DSI Host LTDC VCID register. */
+static rw_reg32_t const DSIHOST_DSI_LCOLCR  = (rw_reg32_t)0x50000010U; /** @brief DSI Host LTDC color coding register. */
+static rw_reg32_t const DSIHOST_DSI_LPCR    = (rw_reg32_t)0x50000014U; /** @brief DSI Host LTDC polarity configuration register. */
+static rw_reg32_t const DSIHOST_DSI_LPMCR   = (rw_reg32_t)0x50000018U; /** @brief DSI Host low-power mode configuration register. */
+static rw_reg32_t const DSIHOST_DSI_PCR     = (rw_reg32_t)0x5000002CU; /** @brief DSI Host protocol configuration register. */
+static ro_reg32_t const DSIHOST_DSI_GVCIDR  = (ro_reg32_t)0x50000030U; /** @brief DSI Host generic VCID register. */
+static rw_reg32_t const DSIHOST_DSI_MCR     = (rw_reg32_t)0x50000034U; /** @brief DSI Host mode configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VMCR    = (rw_reg32_t)0x50000038U; /** @brief DSI Host video mode configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VPCR    = (rw_reg32_t)0x5000003CU; /** @brief DSI Host video packet configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VCCR    = (rw_reg32_t)0x50000040U; /** @brief DSI Host video chunks configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VNPCR   = (rw_reg32_t)0x50000044U; /** @brief DSI Host video null packet configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VHSACR  = (rw_reg32_t)0x50000048U; /** @brief DSI Host video HSA configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VHBPCR  = (rw_reg32_t)0x5000004CU; /** @brief DSI Host video HBP configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VLCR    = (rw_reg32_t)0x50000050U; /** @brief DSI Host video line configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VVSACR  = (rw_reg32_t)0x50000054U; /** @brief DSI Host video VSA configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VVBPCR  = (rw_reg32_t)0x50000058U; /** @brief DSI Host video VBP configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VVFPCR  = (rw_reg32_t)0x5000005CU; /** @brief DSI Host video VFP configuration register. */
+static rw_reg32_t const DSIHOST_DSI_VVACR   = (rw_reg32_t)0x50000060U; /** @brief DSI Host video VA configuration register. */
+static rw_reg32_t const DSIHOST_DSI_LCCR    = (rw_reg32_t)0x50000064U; /** @brief DSI Host LTDC command configuration register. */
+static rw_reg32_t const DSIHOST_DSI_CMCR    = (rw_reg32_t)0x50000068U; /** @brief DSI Host command mode configuration register. */
+static rw_reg32_t const DSIHOST_DSI_GHCR    = (rw_reg32_t)0x5000006CU; /** @brief DSI Host generic header configuration register. */
+static rw_reg32_t const DSIHOST_DSI_GPDR    = (rw_reg32_t)0x50000070U; /** @brief DSI Host generic payload data register. */
+static ro_reg32_t const DSIHOST_DSI_GPSR    = (ro_reg32_t)0x50000074U; /** @brief DSI Host generic packet status register. */
+static rw_reg32_t const DSIHOST_DSI_TCCR0   = (rw_reg32_t)0x50000078U; /** @brief DSI Host timeout counter configuration register 0. */
+static rw_reg32_t const DSIHOST_DSI_TCCR1   = (rw_reg32_t)0x5000007CU; /** @brief DSI Host timeout counter configuration register 1. */
+static rw_reg32_t const DSIHOST_DSI_TCCR2   = (rw_reg32_t)0x50000080U; /** @brief DSI Host timeout counter configuration register 2. */
+static rw_reg32_t const DSIHOST_DSI_TCCR3   = (rw_reg32_t)0x50000084U; /** @brief DSI Host timeout counter configuration register 3. */
+static rw_reg32_t const DSIHOST_DSI_TCCR4   = (rw_reg32_t)0x50000088U; /** @brief DSI Host timeout counter configuration register 4. */
+static rw_reg32_t const DSIHOST_DSI_TCCR5   = (rw_reg32_t)0x5000008CU; /** @brief DSI Host timeout counter configuration register 5. */
+static rw_reg32_t const DSIHOST_DSI_CLCR    = (rw_reg32_t)0x50000094U; /** @brief DSI Host clock lane configuration register. */
+static rw_reg32_t const DSIHOST_DSI_CLTCR   = (rw_reg32_t)0x50000098U; /** @brief DSI Host clock lane timer configuration register. */
+static rw_reg32_t const DSIHOST_DSI_DLTCR   = (rw_reg32_t)0x5000009CU; /** @brief DSI Host data lane timer configuration register. */
+static rw_reg32_t const DSIHOST_DSI_PCTLR   = (rw_reg32_t)0x500000A0U; /** @brief DSI Host PHY control register. */
+static rw_reg32_t const DSIHOST_DSI_PCONFR  = (rw_reg32_t)0x500000A4U; /** @brief DSI Host PHY configuration register. */
+static rw_reg32_t const DSIHOST_DSI_PUCR    = (rw_reg32_t)0x500000A8U; /** @brief DSI Host PHY ULPS control register. */
+static rw_reg32_t const DSIHOST_DSI_PTTCR   = (rw_reg32_t)0x500000ACU; /** @brief DSI Host PHY TX triggers configuration register. */
+static ro_reg32_t const DSIHOST_DSI_PSR     = (ro_reg32_t)0x500000B0U; /** @brief DSI Host PHY status register. */
+static ro_reg32_t const DSIHOST_DSI_ISR0    = (ro_reg32_t)0x500000BCU; /** @brief DSI Host interrupt and status register 0. */
+static ro_reg32_t const DSIHOST_DSI_ISR1    = (ro_reg32_t)0x500000C0U; /** @brief DSI Host interrupt and status register 1. */
+static rw_reg32_t const DSIHOST_DSI_IER0    = (rw_reg32_t)0x500000C4U; /** @brief DSI Host interrupt enable register 0. */
+static rw_reg32_t const DSIHOST_DSI_IER1    = (rw_reg32_t)0x500000C8U; /** @brief DSI Host interrupt enable register 1. */
+static rw_reg32_t const DSIHOST_DSI_FIR0    = (rw_reg32_t)0x500000D8U; /** @brief DSI Host force interrupt register 0. */
+static rw_reg32_t const DSIHOST_DSI_FIR1    = (rw_reg32_t)0x500000DCU; /** @brief DSI Host force interrupt register 1. */
+static rw_reg32_t const DSIHOST_DSI_VSCR    = (rw_reg32_t)0x50000100U; /** @brief DSI Host video shadow control register. */
+static rw_reg32_t const DSIHOST_DSI_LCVCIDR = (rw_reg32_t)0x5000010CU; /** @brief DSI Host LTDC current VCID register. */
+static ro_reg32_t const DSIHOST_DSI_LCCCR   = (ro_reg32_t)0x50000110U; /** @brief DSI Host LTDC current color coding register. */
+static ro_reg32_t const DSIHOST_DSI_LPMCCR  = (ro_reg32_t)0x50000118U; /** @brief DSI Host low-power mode current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VMCCR   = (ro_reg32_t)0x50000138U; /** @brief DSI Host video mode current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VPCCR   = (ro_reg32_t)0x5000013CU; /** @brief DSI Host video packet current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VCCCR   = (ro_reg32_t)0x50000140U; /** @brief DSI Host video chunks current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VNPCCR  = (ro_reg32_t)0x50000144U; /** @brief DSI Host video null packet current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VHSACCR = (ro_reg32_t)0x50000148U; /** @brief DSI Host video HSA current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VHBPCCR = (ro_reg32_t)0x5000014CU; /** @brief DSI Host video HBP current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VLCCR   = (ro_reg32_t)0x50000150U; /** @brief DSI Host video line current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VVSACCR = (ro_reg32_t)0x50000154U; /** @brief DSI Host video VSA current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VVBPCCR = (ro_reg32_t)0x50000158U; /** @brief DSI Host video VBP current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VVFPCCR = (ro_reg32_t)0x5000015CU; /** @brief DSI Host video VFP current configuration register. */
+static ro_reg32_t const DSIHOST_DSI_VVACCR  = (ro_reg32_t)0x50000160U; /** @brief DSI Host video VA current configuration register. */
+static rw_reg32_t const DSIHOST_DSI_WCFGR   = (rw_reg32_t)0x50000400U; /** @brief DSI wrapper configuration register. */
+static rw_reg32_t const DSIHOST_DSI_WCR     = (rw_reg32_t)0x50000404U; /** @brief DSI wrapper control register. */
+static rw_reg32_t const DSIHOST_DSI_WIER    = (rw_reg32_t)0x50000408U; /** @brief DSI wrapper interrupt enable register. */
+static ro_reg32_t const DSIHOST_DSI_WISR    = (ro_reg32_t)0x5000040CU; /** @brief DSI wrapper interrupt and status register. */
+static rw_reg32_t const DSIHOST_DSI_WIFCR   = (rw_reg32_t)0x50000410U; /** @brief DSI wrapper interrupt flag clear register. */
+static rw_reg32_t const DSIHOST_DSI_WPCR0   = (rw_reg32_t)0x50000418U; /** @brief DSI wrapper PHY configuration register 0. */
+static rw_reg32_t const DSIHOST_DSI_WPCR1   = (rw_reg32_t)0x5000041CU; /** @brief This register shall be programmed only when DSI is stopped (CR. DSIEN=0 and CR.EN = 0). */
+static rw_reg32_t const DSIHOST_DSI_WPCR2   = (rw_reg32_t)0x50000420U; /** @brief DSI wrapper PHY configuration register 2. */
+static rw_reg32_t const DSIHOST_DSI_WPCR3   = (rw_reg32_t)0x50000424U; /** @brief DSI wrapper PHY configuration register 3. */
+static rw_reg32_t const DSIHOST_DSI_WPCR4   = (rw_reg32_t)0x50000428U; /** @brief DSI wrapper PHY configuration register 4. */
+static rw_reg32_t const DSIHOST_DSI_WRPCR   = (rw_reg32_t)0x50000430U; /** @brief DSI wrapper regulator and PLL control register. */
+
+/** @subsection DSIHOST Register Field Definitions */
+
+static const field32_t DSIHOST_DSI_CR_EN            = {.msk = 0x00000001U, .pos = 0};  /** @brief EN. */
+static const field32_t DSIHOST_DSI_CCR_TXECKDIV     = {.msk = 0x000000FFU, .pos = 0};  /** @brief TXECKDIV. */
+static const field32_t DSIHOST_DSI_CCR_TOCKDIV      = {.msk = 0x0000FF00U, .pos = 8};  /** @brief TOCKDIV. */
+static const field32_t DSIHOST_DSI_LVCIDR_VCID      = {.msk = 0x00000003U, .pos = 0};  /** @brief VCID. */
+static const field32_t DSIHOST_DSI_LCOLCR_COLC      = {.msk = 0x0000000FU, .pos = 0};  /** @brief COLC. */
+static const field32_t DSIHOST_DSI_LCOLCR_LPE       = {.msk = 0x00000100U, .pos = 8};  /** @brief LPE. */
+static const field32_t DSIHOST_DSI_LPCR_DEP         = {.msk = 0x00000001U, .pos = 0};  /** @brief DEP. */
+static const field32_t DSIHOST_DSI_LPCR_VSP         = {.msk = 0x00000002U, .pos = 1};  /** @brief VSP. */
+static const field32_t DSIHOST_DSI_LPCR_HSP         = {.msk = 0x00000004U, .pos = 2};  /** @brief HSP. */
+static const field32_t DSIHOST_DSI_LPMCR_VLPSIZE    = {.msk = 0x000000FFU, .pos = 0};  /** @brief VLPSIZE. */
+static const field32_t DSIHOST_DSI_LPMCR_LPSIZE     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief LPSIZE. */
+static const field32_t DSIHOST_DSI_PCR_ETTXE        = {.msk = 0x00000001U, .pos = 0};  /** @brief ETTXE. */
+static const field32_t DSIHOST_DSI_PCR_ETRXE        = {.msk = 0x00000002U, .pos = 1};  /** @brief ETRXE. */
+static const field32_t DSIHOST_DSI_PCR_BTAE         = {.msk = 0x00000004U, .pos = 2};  /** @brief BTAE. */
+static const field32_t DSIHOST_DSI_PCR_ECCRXE       = {.msk = 0x00000008U, .pos = 3};  /** @brief ECCRXE. */
+static const field32_t DSIHOST_DSI_PCR_CRCRXE       = {.msk = 0x00000010U, .pos = 4};  /** @brief CRCRXE. */
+static const field32_t DSIHOST_DSI_GVCIDR_VCID      = {.msk = 0x00000003U, .pos = 0};  /** @brief VCID. */
+static const field32_t DSIHOST_DSI_MCR_CMDM         = {.msk = 0x00000001U, .pos = 0};  /** @brief CMDM. */
+static const field32_t DSIHOST_DSI_VMCR_VMT         = {.msk = 0x00000003U, .pos = 0};  /** @brief VMT. */
+static const field32_t DSIHOST_DSI_VMCR_LPVSAE      = {.msk = 0x00000100U, .pos = 8};  /** @brief LPVSAE. */
+static const field32_t DSIHOST_DSI_VMCR_LPVBPE      = {.msk = 0x00000200U, .pos = 9};  /** @brief LPVBPE. */
+static const field32_t DSIHOST_DSI_VMCR_LPVFPE      = {.msk = 0x00000400U, .pos = 10}; /** @brief LPVFPE. */
+static const field32_t DSIHOST_DSI_VMCR_LPVAE       = {.msk = 0x00000800U, .pos = 11}; /** @brief LPVAE. */
+static const field32_t DSIHOST_DSI_VMCR_LPHBPE      = {.msk = 0x00001000U, .pos = 12}; /** @brief LPHBPE. */
+static const field32_t DSIHOST_DSI_VMCR_LPHFPE      = {.msk = 0x00002000U, .pos = 13}; /** @brief LPHFPE. */
+static const field32_t DSIHOST_DSI_VMCR_FBTAAE      = {.msk = 0x00004000U, .pos = 14}; /** @brief FBTAAE. */
+static const field32_t DSIHOST_DSI_VMCR_LPCE        = {.msk = 0x00008000U, .pos = 15}; /** @brief LPCE. */
+static const field32_t DSIHOST_DSI_VMCR_PGE         = {.msk = 0x00010000U, .pos = 16}; /** @brief PGE. */
+static const field32_t DSIHOST_DSI_VMCR_PGM         = {.msk = 0x00100000U, .pos = 20}; /** @brief PGM. */
+static const field32_t DSIHOST_DSI_VMCR_PGO         = {.msk = 0x01000000U, .pos = 24}; /** @brief PGO. */
+static const field32_t DSIHOST_DSI_VPCR_VPSIZE      = {.msk = 0x00003FFFU, .pos = 0};  /** @brief VPSIZE. */
+static const field32_t DSIHOST_DSI_VCCR_NUMC        = {.msk = 0x00001FFFU, .pos = 0};  /** @brief NUMC. */
+static const field32_t DSIHOST_DSI_VNPCR_NPSIZE     = {.msk = 0x00001FFFU, .pos = 0};  /** @brief NPSIZE. */
+static const field32_t DSIHOST_DSI_VHSACR_HSA       = {.msk = 0x00000FFFU, .pos = 0};  /** @brief HSA. */
+static const field32_t DSIHOST_DSI_VHBPCR_HBP       = {.msk = 0x00000FFFU, .pos = 0};  /** @brief HBP. */
+static const field32_t DSIHOST_DSI_VLCR_HLINE       = {.msk = 0x00007FFFU, .pos = 0};  /** @brief HLINE. */
+static const field32_t DSIHOST_DSI_VVSACR_VSA       = {.msk = 0x000003FFU, .pos = 0};  /** @brief VSA. */
+static const field32_t DSIHOST_DSI_VVBPCR_VBP       = {.msk = 0x000003FFU, .pos = 0};  /** @brief VBP. */
+static const field32_t DSIHOST_DSI_VVFPCR_VFP       = {.msk = 0x000003FFU, .pos = 0};  /** @brief VFP. */
+static const field32_t DSIHOST_DSI_VVACR_VA         = {.msk = 0x00003FFFU, .pos = 0};  /** @brief VA. */
+static const field32_t DSIHOST_DSI_LCCR_CMDSIZE     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief CMDSIZE. */
+static const field32_t DSIHOST_DSI_CMCR_TEARE       = {.msk = 0x00000001U, .pos = 0};  /** @brief TEARE. */
+static const field32_t DSIHOST_DSI_CMCR_ARE         = {.msk = 0x00000002U, .pos = 1};  /** @brief ARE. */
+static const field32_t DSIHOST_DSI_CMCR_GSW0TX      = {.msk = 0x00000100U, .pos = 8};  /** @brief GSW0TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSW1TX      = {.msk = 0x00000200U, .pos = 9};  /** @brief GSW1TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSW2TX      = {.msk = 0x00000400U, .pos = 10}; /** @brief GSW2TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSR0TX      = {.msk = 0x00000800U, .pos = 11}; /** @brief GSR0TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSR1TX      = {.msk = 0x00001000U, .pos = 12}; /** @brief GSR1TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSR2TX      = {.msk = 0x00002000U, .pos = 13}; /** @brief GSR2TX. */
+static const field32_t DSIHOST_DSI_CMCR_GLWTX       = {.msk = 0x00004000U, .pos = 14}; /** @brief GLWTX. */
+static const field32_t DSIHOST_DSI_CMCR_DSW0TX      = {.msk = 0x00010000U, .pos = 16}; /** @brief DSW0TX. */
+static const field32_t DSIHOST_DSI_CMCR_DSW1TX      = {.msk = 0x00020000U, .pos = 17}; /** @brief DSW1TX. */
+static const field32_t DSIHOST_DSI_CMCR_DSR0TX      = {.msk = 0x00040000U, .pos = 18}; /** @brief DSR0TX. */
+static const field32_t DSIHOST_DSI_CMCR_DLWTX       = {.msk = 0x00080000U, .pos = 19}; /** @brief DLWTX. */
+static const field32_t DSIHOST_DSI_CMCR_MRDPS       = {.msk = 0x01000000U, .pos = 24}; /** @brief MRDPS. */
+static const field32_t DSIHOST_DSI_GHCR_DT          = {.msk = 0x0000003FU, .pos = 0};  /** @brief DT. */
+static const field32_t DSIHOST_DSI_GHCR_VCID        = {.msk = 0x000000C0U, .pos = 6};  /** @brief VCID. */
+static const field32_t DSIHOST_DSI_GHCR_WCLSB       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief WCLSB. */
+static const field32_t DSIHOST_DSI_GHCR_WCMSB       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief WCMSB. */
+static const field32_t DSIHOST_DSI_GPDR_DATA1       = {.msk = 0x000000FFU, .pos = 0};  /** @brief DATA1. */
+static const field32_t DSIHOST_DSI_GPDR_DATA2       = {.msk = 0x0000FF00U, .pos = 8};  /** @brief DATA2. */
+static const field32_t DSIHOST_DSI_GPDR_DATA3       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief DATA3. */
+static const field32_t DSIHOST_DSI_GPDR_DATA4       = {.msk = 0xFF000000U, .pos = 24}; /** @brief DATA4. */
+static const field32_t DSIHOST_DSI_GPSR_CMDFE       = {.msk = 0x00000001U, .pos = 0};  /** @brief CMDFE. */
+static const field32_t DSIHOST_DSI_GPSR_CMDFF       = {.msk = 0x00000002U, .pos = 1};  /** @brief CMDFF. */
+static const field32_t DSIHOST_DSI_GPSR_PWRFE       = {.msk = 0x00000004U, .pos = 2};  /** @brief PWRFE. */
+static const field32_t DSIHOST_DSI_GPSR_PWRFF       = {.msk = 0x00000008U, .pos = 3};  /** @brief PWRFF. */
+static const field32_t DSIHOST_DSI_GPSR_PRDFE       = {.msk = 0x00000010U, .pos = 4};  /** @brief PRDFE. */
+static const field32_t DSIHOST_DSI_GPSR_PRDFF       = {.msk = 0x00000020U, .pos = 5};  /** @brief PRDFF. */
+static const field32_t DSIHOST_DSI_GPSR_RCB         = {.msk = 0x00000040U, .pos = 6};  /** @brief RCB. */
+static const field32_t DSIHOST_DSI_TCCR0_LPRX_TOCNT = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief LPRX_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR0_HSTX_TOCNT = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief HSTX_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR1_HSRD_TOCNT = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief HSRD_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR2_LPRD_TOCNT = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief LPRD_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR3_HSWR_TOCNT = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief HSWR_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR3_PM         = {.msk = 0x01000000U, .pos = 24}; /** @brief PM. */
+static const field32_t DSIHOST_DSI_TCCR4_LPWR_TOCNT = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief LPWR_TOCNT. */
+static const field32_t DSIHOST_DSI_TCCR5_BTA_TOCNT  = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief BTA_TOCNT. */
+static const field32_t DSIHOST_DSI_CLCR_DPCC        = {.msk = 0x00000001U, .pos = 0};  /** @brief DPCC. */
+static const field32_t DSIHOST_DSI_CLCR_ACR         = {.msk = 0x00000002U, .pos = 1};  /** @brief ACR. */
+static const field32_t DSIHOST_DSI_CLTCR_LP2HS_TIME = {.msk = 0x000003FFU, .pos = 0};  /** @brief LP2HS_TIME. */
+static const field32_t DSIHOST_DSI_CLTCR_HS2LP_TIME = {.msk = 0x03FF0000U, .pos = 16}; /** @brief HS2LP_TIME. */
+static const field32_t DSIHOST_DSI_DLTCR_MRD_TIME   = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Maximum read time. */
+static const field32_t DSIHOST_DSI_DLTCR_LP2HS_TIME = {.msk = 0x00FF0000U, .pos = 16}; /** @brief LP2HS_TIME. */
+static const field32_t DSIHOST_DSI_DLTCR_HS2LP_TIME = {.msk = 0xFF000000U, .pos = 24}; /** @brief HS2LP_TIME. */
+static const field32_t DSIHOST_DSI_PCTLR_DEN        = {.msk = 0x00000002U, .pos = 1};  /** @brief DEN. */
+static const field32_t DSIHOST_DSI_PCTLR_CKE        = {.msk = 0x00000004U, .pos = 2};  /** @brief CKE. */
+static const field32_t DSIHOST_DSI_PCONFR_NL        = {.msk = 0x00000003U, .pos = 0};  /** @brief NL. */
+static const field32_t DSIHOST_DSI_PCONFR_SW_TIME   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief SW_TIME. */
+static const field32_t DSIHOST_DSI_PUCR_URCL        = {.msk = 0x00000001U, .pos = 0};  /** @brief URCL. */
+static const field32_t DSIHOST_DSI_PUCR_UECL        = {.msk = 0x00000002U, .pos = 1};  /** @brief UECL. */
+static const field32_t DSIHOST_DSI_PUCR_URDL        = {.msk = 0x00000004U, .pos = 2};  /** @brief URDL. */
+static const field32_t DSIHOST_DSI_PUCR_UEDL        = {.msk = 0x00000008U, .pos = 3};  /** @brief UEDL. */
+static const field32_t DSIHOST_DSI_PTTCR_TX_TRIG    = {.msk = 0x0000000FU, .pos = 0};  /** @brief TX_TRIG. */
+static const field32_t DSIHOST_DSI_PSR_PD           = {.msk = 0x00000002U, .pos = 1};  /** @brief PD. */
+static const field32_t DSIHOST_DSI_PSR_PSSC         = {.msk = 0x00000004U, .pos = 2};  /** @brief PSSC. */
+static const field32_t DSIHOST_DSI_PSR_UANC         = {.msk = 0x00000008U, .pos = 3};  /** @brief UANC. */
+static const field32_t DSIHOST_DSI_PSR_PSS0         = {.msk = 0x00000010U, .pos = 4};  /** @brief PSS0. */
+static const field32_t DSIHOST_DSI_PSR_UAN0         = {.msk = 0x00000020U, .pos = 5};  /** @brief UAN0. */
+static const field32_t DSIHOST_DSI_PSR_RUE0         = {.msk = 0x00000040U, .pos = 6};  /** @brief RUE0. */
+static const field32_t DSIHOST_DSI_PSR_PSS1         = {.msk = 0x00000080U, .pos = 7};  /** @brief PSS1. */
+static const field32_t DSIHOST_DSI_PSR_UAN1         = {.msk = 0x00000100U, .pos = 8};  /** @brief UAN1. */
+static const field32_t DSIHOST_DSI_ISR0_AE0         = {.msk = 0x00000001U, .pos = 0};  /** @brief AE0. */
+static const field32_t DSIHOST_DSI_ISR0_AE1         = {.msk = 0x00000002U, .pos = 1};  /** @brief AE1. */
+static const field32_t DSIHOST_DSI_ISR0_AE2         = {.msk = 0x00000004U, .pos = 2};  /** @brief AE2. */
+static const field32_t DSIHOST_DSI_ISR0_AE3         = {.msk = 0x00000008U, .pos = 3};  /** @brief AE3. */
+static const field32_t DSIHOST_DSI_ISR0_AE4         = {.msk = 0x00000010U, .pos = 4};  /** @brief AE4. */
+static const field32_t DSIHOST_DSI_ISR0_AE5         = {.msk = 0x00000020U, .pos = 5};  /** @brief AE5. */
+static const field32_t DSIHOST_DSI_ISR0_AE6         = {.msk = 0x00000040U, .pos = 6};  /** @brief AE6. */
+static const field32_t DSIHOST_DSI_ISR0_AE7         = {.msk = 0x00000080U, .pos = 7};  /** @brief AE7. */
+static const field32_t DSIHOST_DSI_ISR0_AE8         = {.msk = 0x00000100U, .pos = 8};  /** @brief AE8. */
+static const field32_t DSIHOST_DSI_ISR0_AE9         = {.msk = 0x00000200U, .pos = 9};  /** @brief AE9. */
+static const field32_t DSIHOST_DSI_ISR0_AE10        = {.msk = 0x00000400U, .pos = 10}; /** @brief AE10. */
+static const field32_t DSIHOST_DSI_ISR0_AE11        = {.msk = 0x00000800U, .pos = 11}; /** @brief AE11. */
+static const field32_t DSIHOST_DSI_ISR0_AE12        = {.msk = 0x00001000U, .pos = 12}; /** @brief AE12. */
+static const field32_t DSIHOST_DSI_ISR0_AE13        = {.msk = 0x00002000U, .pos = 13}; /** @brief AE13. */
+static const field32_t DSIHOST_DSI_ISR0_AE14        = {.msk = 0x00004000U, .pos = 14}; /** @brief AE14. */
+static const field32_t DSIHOST_DSI_ISR0_AE15        = {.msk = 0x00008000U, .pos = 15}; /** @brief AE15. */
+static const field32_t DSIHOST_DSI_ISR0_PE0         = {.msk = 0x00010000U, .pos = 16}; /** @brief PE0. */
+static const field32_t DSIHOST_DSI_ISR0_PE1         = {.msk = 0x00020000U, .pos = 17}; /** @brief PE1. */
+static const field32_t DSIHOST_DSI_ISR0_PE2         = {.msk = 0x00040000U, .pos = 18}; /** @brief PE2. */
+static const field32_t DSIHOST_DSI_ISR0_PE3         = {.msk = 0x00080000U, .pos = 19}; /** @brief PE3. */
+static const field32_t DSIHOST_DSI_ISR0_PE4         = {.msk = 0x00100000U, .pos = 20}; /** @brief PE4. */
+static const field32_t DSIHOST_DSI_ISR1_TOHSTX      = {.msk = 0x00000001U, .pos = 0};  /** @brief TOHSTX. */
+static const field32_t DSIHOST_DSI_ISR1_TOLPRX      = {.msk = 0x00000002U, .pos = 1};  /** @brief TOLPRX. */
+static const field32_t DSIHOST_DSI_ISR1_ECCSE       = {.msk = 0x00000004U, .pos = 2};  /** @brief ECCSE. */
+static const field32_t DSIHOST_DSI_ISR1_ECCME       = {.msk = 0x00000008U, .pos = 3};  /** @brief ECCME. */
+static const field32_t DSIHOST_DSI_ISR1_CRCE        = {.msk = 0x00000010U, .pos = 4};  /** @brief CRCE. */
+static const field32_t DSIHOST_DSI_ISR1_PSE         = {.msk = 0x00000020U, .pos = 5};  /** @brief PSE. */
+static const field32_t DSIHOST_DSI_ISR1_EOTPE       = {.msk = 0x00000040U, .pos = 6};  /** @brief EOTPE. */
+static const field32_t DSIHOST_DSI_ISR1_LPWRE       = {.msk = 0x00000080U, .pos = 7};  /** @brief LPWRE. */
+static const field32_t DSIHOST_DSI_ISR1_GCWRE       = {.msk = 0x00000100U, .pos = 8};  /** @brief GCWRE. */
+static const field32_t DSIHOST_DSI_ISR1_GPWRE       = {.msk = 0x00000200U, .pos = 9};  /** @brief GPWRE. */
+static const field32_t DSIHOST_DSI_ISR1_GPTXE       = {.msk = 0x00000400U, .pos = 10}; /** @brief GPTXE. */
+static const field32_t DSIHOST_DSI_ISR1_GPRDE       = {.msk = 0x00000800U, .pos = 11}; /** @brief GPRDE. */
+static const field32_t DSIHOST_DSI_ISR1_GPRXE       = {.msk = 0x00001000U, .pos = 12}; /** @brief GPRXE. */
+static const field32_t DSIHOST_DSI_IER0_AE0IE       = {.msk = 0x00000001U, .pos = 0};  /** @brief AE0IE. */
+static const field32_t DSIHOST_DSI_IER0_AE1IE       = {.msk = 0x00000002U, .pos = 1};  /** @brief AE1IE. */
+static const field32_t DSIHOST_DSI_IER0_AE2IE       = {.msk = 0x00000004U, .pos = 2};  /** @brief AE2IE. */
+static const field32_t DSIHOST_DSI_IER0_AE3IE       = {.msk = 0x00000008U, .pos = 3};  /** @brief AE3IE. */
+static const field32_t DSIHOST_DSI_IER0_AE4IE       = {.msk = 0x00000010U, .pos = 4};  /** @brief AE4IE. */
+static const field32_t DSIHOST_DSI_IER0_AE5IE       = {.msk = 0x00000020U, .pos = 5};  /** @brief AE5IE. */
+static const field32_t DSIHOST_DSI_IER0_AE6IE       = {.msk = 0x00000040U, .pos = 6};  /** @brief AE6IE. */
+static const field32_t DSIHOST_DSI_IER0_AE7IE       = {.msk = 0x00000080U, .pos = 7};  /** @brief AE7IE. */
+static const field32_t DSIHOST_DSI_IER0_AE8IE       = {.msk = 0x00000100U, .pos = 8};  /** @brief AE8IE. */
+static const field32_t DSIHOST_DSI_IER0_AE9IE       = {.msk = 0x00000200U, .pos = 9};  /** @brief AE9IE. */
+static const field32_t DSIHOST_DSI_IER0_AE10IE      = {.msk = 0x00000400U, .pos = 10}; /** @brief AE10IE. */
+static const field32_t DSIHOST_DSI_IER0_AE11IE      = {.msk = 0x00000800U, .pos = 11}; /** @brief AE11IE. */
+static const field32_t DSIHOST_DSI_IER0_AE12IE      = {.msk = 0x00001000U, .pos = 12}; /** @brief AE12IE. */
+static const field32_t DSIHOST_DSI_IER0_AE13IE      = {.msk = 0x00002000U, .pos = 13}; /** @brief AE13IE. */
+static const field32_t DSIHOST_DSI_IER0_AE14IE      = {.msk = 0x00004000U, .pos = 14}; /** @brief AE14IE. */
+static const field32_t DSIHOST_DSI_IER0_AE15IE      = {.msk = 0x00008000U, .pos = 15}; /** @brief AE15IE. */
+static const field32_t DSIHOST_DSI_IER0_PE0IE       = {.msk = 0x00010000U, .pos = 16}; /** @brief PE0IE. */
+static const field32_t DSIHOST_DSI_IER0_PE1IE       = {.msk = 0x00020000U, .pos = 17}; /** @brief PE1IE. */
+static const field32_t DSIHOST_DSI_IER0_PE2IE       = {.msk = 0x00040000U, .pos = 18}; /** @brief PE2IE. */
+static const field32_t DSIHOST_DSI_IER0_PE3IE       = {.msk = 0x00080000U, .pos = 19}; /** @brief PE3IE. */
+static const field32_t DSIHOST_DSI_IER0_PE4IE       = {.msk = 0x00100000U, .pos = 20}; /** @brief PE4IE. */
+static const field32_t DSIHOST_DSI_IER1_TOHSTXIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief TOHSTXIE. */
+static const field32_t DSIHOST_DSI_IER1_TOLPRXIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief TOLPRXIE. */
+static const field32_t DSIHOST_DSI_IER1_ECCSEIE     = {.msk = 0x00000004U, .pos = 2};  /** @brief ECCSEIE. */
+static const field32_t DSIHOST_DSI_IER1_ECCMEIE     = {.msk = 0x00000008U, .pos = 3};  /** @brief ECCMEIE. */
+static const field32_t DSIHOST_DSI_IER1_CRCEIE      = {.msk = 0x00000010U, .pos = 4};  /** @brief CRCEIE. */
+static const field32_t DSIHOST_DSI_IER1_PSEIE       = {.msk = 0x00000020U, .pos = 5};  /** @brief PSEIE. */
+static const field32_t DSIHOST_DSI_IER1_EOTPEIE     = {.msk = 0x00000040U, .pos = 6};  /** @brief EOTPEIE. */
+static const field32_t DSIHOST_DSI_IER1_LPWREIE     = {.msk = 0x00000080U, .pos = 7};  /** @brief LPWREIE. */
+static const field32_t DSIHOST_DSI_IER1_GCWREIE     = {.msk = 0x00000100U, .pos = 8};  /** @brief GCWREIE. */
+static const field32_t DSIHOST_DSI_IER1_GPWREIE     = {.msk = 0x00000200U, .pos = 9};  /** @brief GPWREIE. */
+static const field32_t DSIHOST_DSI_IER1_GPTXEIE     = {.msk = 0x00000400U, .pos = 10}; /** @brief GPTXEIE. */
+static const field32_t DSIHOST_DSI_IER1_GPRDEIE     = {.msk = 0x00000800U, .pos = 11}; /** @brief GPRDEIE. */
+static const field32_t DSIHOST_DSI_IER1_GPRXEIE     = {.msk = 0x00001000U, .pos = 12}; /** @brief GPRXEIE. */
+static const field32_t DSIHOST_DSI_FIR0_FAE0        = {.msk = 0x00000001U, .pos = 0};  /** @brief FAE0. */
+static const field32_t DSIHOST_DSI_FIR0_FAE1        = {.msk = 0x00000002U, .pos = 1};  /** @brief FAE1. */
+static const field32_t DSIHOST_DSI_FIR0_FAE2        = {.msk = 0x00000004U, .pos = 2};  /** @brief FAE2. */
+static const field32_t DSIHOST_DSI_FIR0_FAE3        = {.msk = 0x00000008U, .pos = 3};  /** @brief FAE3. */
+static const field32_t DSIHOST_DSI_FIR0_FAE4        = {.msk = 0x00000010U, .pos = 4};  /** @brief FAE4. */
+static const field32_t DSIHOST_DSI_FIR0_FAE5        = {.msk = 0x00000020U, .pos = 5};  /** @brief FAE5. */
+static const field32_t DSIHOST_DSI_FIR0_FAE6        = {.msk = 0x00000040U, .pos = 6};  /** @brief FAE6. */
+static const field32_t DSIHOST_DSI_FIR0_FAE7        = {.msk = 0x00000080U, .pos = 7};  /** @brief FAE7. */
+static const field32_t DSIHOST_DSI_FIR0_FAE8        = {.msk = 0x00000100U, .pos = 8};  /** @brief FAE8. */
+static const field32_t DSIHOST_DSI_FIR0_FAE9        = {.msk = 0x00000200U, .pos = 9};  /** @brief FAE9. */
+static const field32_t DSIHOST_DSI_FIR0_FAE10       = {.msk = 0x00000400U, .pos = 10}; /** @brief FAE10. */
+static const field32_t DSIHOST_DSI_FIR0_FAE11       = {.msk = 0x00000800U, .pos = 11}; /** @brief FAE11. */
+static const field32_t DSIHOST_DSI_FIR0_FAE12       = {.msk = 0x00001000U, .pos = 12}; /** @brief FAE12. */
+static const field32_t DSIHOST_DSI_FIR0_FAE13       = {.msk = 0x00002000U, .pos = 13}; /** @brief FAE13. */
+static const field32_t DSIHOST_DSI_FIR0_FAE14       = {.msk = 0x00004000U, .pos = 14}; /** @brief FAE14. */
+static const field32_t DSIHOST_DSI_FIR0_FAE15       = {.msk = 0x00008000U, .pos = 15}; /** @brief FAE15. */
+static const field32_t DSIHOST_DSI_FIR0_FPE0        = {.msk = 0x00010000U, .pos = 16}; /** @brief FPE0. */
+static const field32_t DSIHOST_DSI_FIR0_FPE1        = {.msk = 0x00020000U, .pos = 17}; /** @brief FPE1. */
+static const field32_t DSIHOST_DSI_FIR0_FPE2        = {.msk = 0x00040000U, .pos = 18}; /** @brief FPE2. */
+static const field32_t DSIHOST_DSI_FIR0_FPE3        = {.msk = 0x00080000U, .pos = 19}; /** @brief FPE3. */
+static const field32_t DSIHOST_DSI_FIR0_FPE4        = {.msk = 0x00100000U, .pos = 20}; /** @brief FPE4. */
+static const field32_t DSIHOST_DSI_FIR1_FTOHSTX     = {.msk = 0x00000001U, .pos = 0};  /** @brief FTOHSTX. */
+static const field32_t DSIHOST_DSI_FIR1_FTOLPRX     = {.msk = 0x00000002U, .pos = 1};  /** @brief FTOLPRX. */
+static const field32_t DSIHOST_DSI_FIR1_FECCSE      = {.msk = 0x00000004U, .pos = 2};  /** @brief FECCSE. */
+static const field32_t DSIHOST_DSI_FIR1_FECCME      = {.msk = 0x00000008U, .pos = 3};  /** @brief FECCME. */
+static const field32_t DSIHOST_DSI_FIR1_FCRCE       = {.msk = 0x00000010U, .pos = 4};  /** @brief FCRCE. */
+static const field32_t DSIHOST_DSI_FIR1_FPSE        = {.msk = 0x00000020U, .pos = 5};  /** @brief FPSE. */
+static const field32_t DSIHOST_DSI_FIR1_FEOTPE      = {.msk = 0x00000040U, .pos = 6};  /** @brief FEOTPE. */
+static const field32_t DSIHOST_DSI_FIR1_FLPWRE      = {.msk = 0x00000080U, .pos = 7};  /** @brief FLPWRE. */
+static const field32_t DSIHOST_DSI_FIR1_FGCWRE      = {.msk = 0x00000100U, .pos = 8};  /** @brief FGCWRE. */
+static const field32_t DSIHOST_DSI_FIR1_FGPWRE      = {.msk = 0x00000200U, .pos = 9};  /** @brief FGPWRE. */
+static const field32_t DSIHOST_DSI_FIR1_FGPTXE      = {.msk = 0x00000400U, .pos = 10}; /** @brief FGPTXE. */
+static const field32_t DSIHOST_DSI_FIR1_FGPRDE      = {.msk = 0x00000800U, .pos = 11}; /** @brief FGPRDE. */
+static const field32_t DSIHOST_DSI_FIR1_FGPRXE      = {.msk = 0x00001000U, .pos = 12}; /** @brief FGPRXE. */
+static const field32_t DSIHOST_DSI_VSCR_EN          = {.msk = 0x00000001U, .pos = 0};  /** @brief EN. */
+static const field32_t DSIHOST_DSI_VSCR_UR          = {.msk = 0x00000100U, .pos = 8};  /** @brief UR. */
+static const field32_t DSIHOST_DSI_LCVCIDR_VCID     = {.msk = 0x00000003U, .pos = 0};  /** @brief VCID. */
+static const field32_t DSIHOST_DSI_LCCCR_COLC       = {.msk = 0x0000000FU, .pos = 0};  /** @brief COLC. */
+static const field32_t DSIHOST_DSI_LCCCR_LPE        = {.msk = 0x00000100U, .pos = 8};  /** @brief LPE. */
+static const field32_t DSIHOST_DSI_LPMCCR_VLPSIZE   = {.msk = 0x000000FFU, .pos = 0};  /** @brief VLPSIZE. */
+static const field32_t DSIHOST_DSI_LPMCCR_LPSIZE    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief LPSIZE. */
+static const field32_t DSIHOST_DSI_VMCCR_VMT        = {.msk = 0x00000003U, .pos = 0};  /** @brief VMT. */
+static const field32_t DSIHOST_DSI_VMCCR_LPVSAE     = {.msk = 0x00000004U, .pos = 2};  /** @brief LPVSAE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPVBPE     = {.msk = 0x00000008U, .pos = 3};  /** @brief LPVBPE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPVFPE     = {.msk = 0x00000010U, .pos = 4};  /** @brief LPVFPE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPVAE      = {.msk = 0x00000020U, .pos = 5};  /** @brief LPVAE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPHBPE     = {.msk = 0x00000040U, .pos = 6};  /** @brief LPHBPE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPHFE      = {.msk = 0x00000080U, .pos = 7};  /** @brief LPHFE. */
+static const field32_t DSIHOST_DSI_VMCCR_FBTAAE     = {.msk = 0x00000100U, .pos = 8};  /** @brief FBTAAE. */
+static const field32_t DSIHOST_DSI_VMCCR_LPCE       = {.msk = 0x00000200U, .pos = 9};  /** @brief LPCE. */
+static const field32_t DSIHOST_DSI_VPCCR_VPSIZE     = {.msk = 0x00003FFFU, .pos = 0};  /** @brief VPSIZE. */
+static const field32_t DSIHOST_DSI_VCCCR_NUMC       = {.msk = 0x00001FFFU, .pos = 0};  /** @brief NUMC. */
+static const field32_t DSIHOST_DSI_VNPCCR_NPSIZE    = {.msk = 0x00001FFFU, .pos = 0};  /** @brief NPSIZE. */
+static const field32_t DSIHOST_DSI_VHSACCR_HSA      = {.msk = 0x00000FFFU, .pos = 0};  /** @brief HSA. */
+static const field32_t DSIHOST_DSI_VHBPCCR_HBP      = {.msk = 0x00000FFFU, .pos = 0};  /** @brief HBP. */
+static const field32_t DSIHOST_DSI_VLCCR_HLINE      = {.msk = 0x00007FFFU, .pos = 0};  /** @brief HLINE. */
+static const field32_t DSIHOST_DSI_VVSACCR_VSA      = {.msk = 0x000003FFU, .pos = 0};  /** @brief VSA. */
+static const field32_t DSIHOST_DSI_VVBPCCR_VBP      = {.msk = 0x000003FFU, .pos = 0};  /** @brief VBP. */
+static const field32_t DSIHOST_DSI_VVFPCCR_VFP      = {.msk = 0x000003FFU, .pos = 0};  /** @brief VFP. */
+static const field32_t DSIHOST_DSI_VVACCR_VA        = {.msk = 0x00003FFFU, .pos = 0};  /** @brief VA. */
+static const field32_t DSIHOST_DSI_WCFGR_DSIM       = {.msk = 0x00000001U, .pos = 0};  /** @brief DSIM. */
+static const field32_t DSIHOST_DSI_WCFGR_COLMUX     = {.msk = 0x0000000EU, .pos = 1};  /** @brief COLMUX. */
+static const field32_t DSIHOST_DSI_WCFGR_TESRC      = {.msk = 0x00000010U, .pos = 4};  /** @brief TESRC. */
+static const field32_t DSIHOST_DSI_WCFGR_TEPOL      = {.msk = 0x00000020U, .pos = 5};  /** @brief TEPOL. */
+static const field32_t DSIHOST_DSI_WCFGR_AR         = {.msk = 0x00000040U, .pos = 6};  /** @brief AR. */
+static const field32_t DSIHOST_DSI_WCFGR_VSPOL      = {.msk = 0x00000080U, .pos = 7};  /** @brief VSPOL. */
+static const field32_t DSIHOST_DSI_WCR_COLM         = {.msk = 0x00000001U, .pos = 0};  /** @brief COLM. */
+static const field32_t DSIHOST_DSI_WCR_SHTDN        = {.msk = 0x00000002U, .pos = 1};  /** @brief SHTDN. */
+static const field32_t DSIHOST_DSI_WCR_LTDCEN       = {.msk = 0x00000004U, .pos = 2};  /** @brief LTDCEN. */
+static const field32_t DSIHOST_DSI_WCR_DSIEN        = {.msk = 0x00000008U, .pos = 3};  /** @brief DSIEN. */
+static const field32_t DSIHOST_DSI_WIER_TEIE        = {.msk = 0x00000001U, .pos = 0};  /** @brief TEIE. */
+static const field32_t DSIHOST_DSI_WIER_ERIE        = {.msk = 0x00000002U, .pos = 1};  /** @brief ERIE. */
+static const field32_t DSIHOST_DSI_WIER_PLLLIE      = {.msk = 0x00000200U, .pos = 9};  /** @brief PLLLIE. */
+static const field32_t DSIHOST_DSI_WIER_PLLUIE      = {.msk = 0x00000400U, .pos = 10}; /** @brief PLLUIE. */
+static const field32_t DSIHOST_DSI_WIER_RRIE        = {.msk = 0x00002000U, .pos = 13}; /** @brief RRIE. */
+static const field32_t DSIHOST_DSI_WISR_TEIF        = {.msk = 0x00000001U, .pos = 0};  /** @brief TEIF. */
+static const field32_t DSIHOST_DSI_WISR_ERIF        = {.msk = 0x00000002U, .pos = 1};  /** @brief ERIF. */
+static const field32_t DSIHOST_DSI_WISR_BUSY        = {.msk = 0x00000004U, .pos = 2};  /** @brief BUSY. */
+static const field32_t DSIHOST_DSI_WISR_PLLLS       = {.msk = 0x00000100U, .pos = 8};  /** @brief PLLLS. */
+static const field32_t DSIHOST_DSI_WISR_PLLLIF      = {.msk = 0x00000200U, .pos = 9};  /** @brief PLLLIF. */
+static const field32_t DSIHOST_DSI_WISR_PLLUIF      = {.msk = 0x00000400U, .pos = 10}; /** @brief PLLUIF. */
+static const field32_t DSIHOST_DSI_WISR_RRS         = {.msk = 0x00001000U, .pos = 12}; /** @brief RRS. */
+static const field32_t DSIHOST_DSI_WISR_RRIF        = {.msk = 0x00002000U, .pos = 13}; /** @brief RRIF. */
+static const field32_t DSIHOST_DSI_WIFCR_CTEIF      = {.msk = 0x00000001U, .pos = 0};  /** @brief CTEIF. */
+static const field32_t DSIHOST_DSI_WIFCR_CERIF      = {.msk = 0x00000002U, .pos = 1};  /** @brief CERIF. */
+static const field32_t DSIHOST_DSI_WIFCR_CPLLLIF    = {.msk = 0x00000200U, .pos = 9};  /** @brief CPLLLIF. */
+static const field32_t DSIHOST_DSI_WIFCR_CPLLUIF    = {.msk = 0x00000400U, .pos = 10}; /** @brief CPLLUIF. */
+static const field32_t DSIHOST_DSI_WIFCR_CRRIF      = {.msk = 0x00002000U, .pos = 13}; /** @brief CRRIF. */
+static const field32_t DSIHOST_DSI_WPCR0_UIX4       = {.msk = 0x0000003FU, .pos = 0};  /** @brief UIX4. */
+static const field32_t DSIHOST_DSI_WPCR0_SWCL       = {.msk = 0x00000040U, .pos = 6};  /** @brief SWCL. */
+static const field32_t DSIHOST_DSI_WPCR0_SWDL0      = {.msk = 0x00000080U, .pos = 7};  /** @brief SWDL0. */
+static const field32_t DSIHOST_DSI_WPCR0_SWDL1      = {.msk = 0x00000100U, .pos = 8};  /** @brief SWDL1. */
+static const field32_t DSIHOST_DSI_WPCR0_HSICL      = {.msk = 0x00000200U, .pos = 9};  /** @brief HSICL. */
+static const field32_t DSIHOST_DSI_WPCR0_HSIDL0     = {.msk = 0x00000400U, .pos = 10}; /** @brief HSIDL0. */
+static const field32_t DSIHOST_DSI_WPCR0_HSIDL1     = {.msk = 0x00000800U, .pos = 11}; /** @brief HSIDL1. */
+static const field32_t DSIHOST_DSI_WPCR0_FTXSMCL    = {.msk = 0x00001000U, .pos = 12}; /** @brief FTXSMCL. */
+static const field32_t DSIHOST_DSI_WPCR0_FTXSMDL    = {.msk = 0x00002000U, .pos = 13}; /** @brief FTXSMDL. */
+static const field32_t DSIHOST_DSI_WPCR0_CDOFFDL    = {.msk = 0x00004000U, .pos = 14}; /** @brief CDOFFDL. */
+static const field32_t DSIHOST_DSI_WPCR0_TDDL       = {.msk = 0x00010000U, .pos = 16}; /** @brief TDDL. */
+static const field32_t DSIHOST_DSI_WPCR0_PDEN       = {.msk = 0x00040000U, .pos = 18}; /** @brief Pull-down enable. */
+static const field32_t DSIHOST_DSI_WPCR0_TCLKPREPEN = {.msk = 0x00080000U, .pos = 19}; /** @brief Custom time for tCLK-PREPARE enable. */
+static const field32_t DSIHOST_DSI_WPCR0_TCLKZEROEN = {.msk = 0x00100000U, .pos = 20}; /** @brief Custom time for tCLK-ZERO enable. */
+static const field32_t DSIHOST_DSI_WPCR0_THSPREPEN  = {.msk = 0x00200000U, .pos = 21}; /** @brief Custom time for tHS-PREPARE enable. */
+static const field32_t DSIHOST_DSI_WPCR0_THSTRAILEN = {.msk = 0x00400000U, .pos = 22}; /** @brief Custom time for tHS-TRAIL enable. */
+static const field32_t DSIHOST_DSI_WPCR0_THSZEROEN  = {.msk = 0x00800000U, .pos = 23}; /** @brief Custom time for tHS-ZERO enable. */
+static const field32_t DSIHOST_DSI_WPCR0_TLPXDEN    = {.msk = 0x01000000U, .pos = 24}; /** @brief Custom time for tLPX for data lanes enable. */
+static const field32_t DSIHOST_DSI_WPCR0_THSEXITEN  = {.msk = 0x02000000U, .pos = 25}; /** @brief Custom time for tHS-EXIT enable. */
+static const field32_t DSIHOST_DSI_WPCR0_TLPXCEN    = {.msk = 0x04000000U, .pos = 26}; /** @brief Custom time for tLPX for clock lane enable. */
+static const field32_t DSIHOST_DSI_WPCR0_TCLKPOSTEN = {.msk = 0x08000000U, .pos = 27}; /** @brief Custom time for tCLK-POST enable. */
+static const field32_t DSIHOST_DSI_WPCR1_HSTXDCL    = {.msk = 0x00000003U, .pos = 0};  /** @brief High-speed transmission delay on clock lane. */
+static const field32_t DSIHOST_DSI_WPCR1_HSTXDDL    = {.msk = 0x0000000CU, .pos = 2};  /** @brief High-speed transmission delay on data lanes. */
+static const field32_t DSIHOST_DSI_WPCR1_LPSRCCL    = {.msk = 0x000000C0U, .pos = 6};  /** @brief Low-power transmission slew-rate compensation on clock lane. */
+static const field32_t DSIHOST_DSI_WPCR1_LPSRCDL    = {.msk = 0x00000300U, .pos = 8};  /** @brief Low-power transmission slew-rate compensation on data lanes. */
+static const field32_t DSIHOST_DSI_WPCR1_SDDC       = {.msk = 0x00001000U, .pos = 12}; /** @brief SDD control. */
+static const field32_t DSIHOST_DSI_WPCR1_HSTXSRCCL  = {.msk = 0x00030000U, .pos = 16}; /** @brief High-speed transmission slew-rate control on clock lane. */
+static const field32_t DSIHOST_DSI_WPCR1_HSTXSRCDL  = {.msk = 0x000C0000U, .pos = 18}; /** @brief High-speed transmission slew-rate control on data lanes. */
+static const field32_t DSIHOST_DSI_WPCR1_FLPRXLPM   = {.msk = 0x00400000U, .pos = 22}; /** @brief Forces LP receiver in low-power mode. */
+static const field32_t DSIHOST_DSI_WPCR1_LPRXFT     = {.msk = 0x06000000U, .pos = 25}; /** @brief Low-power RX low-pass filtering tuning. */
+static const field32_t DSIHOST_DSI_WPCR2_TCLKPREP   = {.msk = 0x000000FFU, .pos = 0};  /** @brief TCLKPREP. */
+static const field32_t DSIHOST_DSI_WPCR2_TCLKZERO   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief TCLKZERO. */
+static const field32_t DSIHOST_DSI_WPCR2_THSPREP    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief THSPREP. */
+static const field32_t DSIHOST_DSI_WPCR2_THSTRAIL   = {.msk = 0xFF000000U, .pos = 24}; /** @brief THSTRAIL. */
+static const field32_t DSIHOST_DSI_WPCR3_THSZERO    = {.msk = 0x000000FFU, .pos = 0};  /** @brief THSZERO. */
+static const field32_t DSIHOST_DSI_WPCR3_TLPXD      = {.msk = 0x0000FF00U, .pos = 8};  /** @brief TLPXD. */
+static const field32_t DSIHOST_DSI_WPCR3_THSEXIT    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief THSEXIT. */
+static const field32_t DSIHOST_DSI_WPCR3_TLPXC      = {.msk = 0xFF000000U, .pos = 24}; /** @brief TLPXC. */
+static const field32_t DSIHOST_DSI_WPCR4_TCLKPOST   = {.msk = 0x000000FFU, .pos = 0};  /** @brief TCLKPOST. */
+static const field32_t DSIHOST_DSI_WRPCR_PLLEN      = {.msk = 0x00000001U, .pos = 0};  /** @brief PLLEN. */
+static const field32_t DSIHOST_DSI_WRPCR_NDIV       = {.msk = 0x000001FCU, .pos = 2};  /** @brief NDIV. */
+static const field32_t DSIHOST_DSI_WRPCR_IDF        = {.msk = 0x00007800U, .pos = 11}; /** @brief IDF. */
+static const field32_t DSIHOST_DSI_WRPCR_ODF        = {.msk = 0x00030000U, .pos = 16}; /** @brief ODF. */
+static const field32_t DSIHOST_DSI_WRPCR_REGEN      = {.msk = 0x01000000U, .pos = 24}; /** @brief REGEN. */
+
+/** @subsection Enumerated DSIHOST Register Field Definitions */
+
+/** @brief GSW0TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSWxTX[3] = {
+  [0] = {.msk = 0x00000100U, .pos = 8},
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief GSR0TX. */
+static const field32_t DSIHOST_DSI_CMCR_GSRxTX[3] = {
+  [0] = {.msk = 0x00000800U, .pos = 11},
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief DSW0TX. */
+static const field32_t DSIHOST_DSI_CMCR_DSWxTX[2] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief DATA1. */
+static const field32_t DSIHOST_DSI_GPDR_DATAx[5] = {
+  [1] = {.msk = 0x000000FFU, .pos = 0},
+  [2] = {.msk = 0x0000FF00U, .pos = 8},
+  [3] = {.msk = 0x00FF0000U, .pos = 16},
+  [4] = {.msk = 0xFF000000U, .pos = 24},
+};
+
+/** @brief PSS0. */
+static const field32_t DSIHOST_DSI_PSR_PSSx[2] = {
+  [0] = {.msk = 0x00000010U, .pos = 4},
+  [1] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief UAN0. */
+static const field32_t DSIHOST_DSI_PSR_UANx[2] = {
+  [0] = {.msk = 0x00000020U, .pos = 5},
+  [1] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief AE0. */
+static const field32_t DSIHOST_DSI_ISR0_AEx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief PE0. */
+static const field32_t DSIHOST_DSI_ISR0_PEx[5] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief AE0IE. */
+static const field32_t DSIHOST_DSI_IER0_AExIE[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief PE0IE. */
+static const field32_t DSIHOST_DSI_IER0_PExIE[5] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief FAE0. */
+static const field32_t DSIHOST_DSI_FIR0_FAEx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief FPE0. */
+static const field32_t DSIHOST_DSI_FIR0_FPEx[5] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SWDL0. */
+static const field32_t DSIHOST_DSI_WPCR0_SWDLx[2] = {
+  [0] = {.msk = 0x00000080U, .pos = 7},
+  [1] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief HSIDL0. */
+static const field32_t DSIHOST_DSI_WPCR0_HSIDLx[2] = {
+  [0] = {.msk = 0x00000400U, .pos = 10},
+  [1] = {.msk = 0x00000800U, .pos = 11},
+};
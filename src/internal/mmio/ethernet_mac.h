@@ -0,0 +1,578 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/ethernet_mac.h
+ * @authors UW SARP
+ * @brief Registers and fields of ETHERNET_MAC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section ETHERNET_MAC Definitions
+ **************************************************************************************************/
+
+/** @subsection ETHERNET_MAC Register Definitions */
+
+static rw_reg32_t const ETHERNET_MAC_DMAMR                              = (rw_reg32_t)0x40029000U; /** @brief DMA mode register. */
+static rw_reg32_t const ETHERNET_MAC_DMASBMR                            = (rw_reg32_t)0x40029004U; /** @brief System bus mode register. */
+static ro_reg32_t const ETHERNET_MAC_DMAISR                             = (ro_reg32_t)0x40029008U; /** @brief Interrupt status register. */
+static ro_reg32_t const ETHERNET_MAC_DMADSR                             = (ro_reg32_t)0x4002900CU; /** @brief Debug status register. */
+static rw_reg32_t const ETHERNET_MAC_DMACCR                             = (rw_reg32_t)0x40029100U; /** @brief Channel control register. */
+static rw_reg32_t const ETHERNET_MAC_DMACTXCR                           = (rw_reg32_t)0x40029104U; /** @brief Channel transmit control register. */
+static rw_reg32_t const ETHERNET_MAC_DMACRXCR                           = (rw_reg32_t)0x40029108U; /** @brief Channel receive control register. */
+static rw_reg32_t const ETHERNET_MAC_DMACTXDLAR                         = (rw_reg32_t)0x40029114U; /** @brief Channel Tx descriptor list address register. */
+static rw_reg32_t const ETHERNET_MAC_DMACRXDLAR                         = (rw_reg32_t)0x4002911CU; /** @brief Channel Rx descriptor list address register. */
+static rw_reg32_t const ETHERNET_MAC_DMACTXDTPR                         = (rw_reg32_t)0x40029120U; /** @brief Channel Tx descriptor tail pointer register. */
+static rw_reg32_t const ETHERNET_MAC_DMACRXDTPR                         = (rw_reg32_t)0x40029128U; /** @brief Channel Rx descriptor tail pointer register. */
+static rw_reg32_t const ETHERNET_MAC_DMACTXRLR                          = (rw_reg32_t)0x4002912CU; /** @brief Channel Tx descriptor ring length register. */
+static rw_reg32_t const ETHERNET_MAC_DMACRXRLR                          = (rw_reg32_t)0x40029130U; /** @brief Channel Rx descriptor ring length register. */
+static rw_reg32_t const ETHERNET_MAC_DMACIER                            = (rw_reg32_t)0x40029134U; /** @brief Channel interrupt enable register. */
+static rw_reg32_t const ETHERNET_MAC_DMACRXIWTR                         = (rw_reg32_t)0x40029138U; /** @brief Channel Rx interrupt watchdog timer register. */
+static ro_reg32_t const ETHERNET_MAC_DMACCATXDR                         = (ro_reg32_t)0x40029144U; /** @brief Channel current application transmit descriptor register. */
+static ro_reg32_t const ETHERNET_MAC_DMACCARXDR                         = (ro_reg32_t)0x4002914CU; /** @brief Channel current application receive descriptor register. */
+static ro_reg32_t const ETHERNET_MAC_DMACCATXBR                         = (ro_reg32_t)0x40029154U; /** @brief Channel current application transmit buffer register. */
+static ro_reg32_t const ETHERNET_MAC_DMACCARXBR                         = (ro_reg32_t)0x4002915CU; /** @brief Channel current application receive buffer register. */
+static rw_reg32_t const ETHERNET_MAC_DMACSR                             = (rw_reg32_t)0x40029160U; /** @brief Channel status register. */
+static ro_reg32_t const ETHERNET_MAC_DMACMFCR                           = (ro_reg32_t)0x4002916CU; /** @brief Channel missed frame count register. */
+static rw_reg32_t const ETHERNET_MAC_MTLOMR                             = (rw_reg32_t)0x40028C00U; /** @brief Operating mode Register. */
+static ro_reg32_t const ETHERNET_MAC_MTLISR                             = (ro_reg32_t)0x40028C20U; /** @brief Interrupt status Register. */
+static rw_reg32_t const ETHERNET_MAC_MTLTXQOMR                          = (rw_reg32_t)0x40028D00U; /** @brief Tx queue operating mode Register. */
+static ro_reg32_t const ETHERNET_MAC_MTLTXQUR                           = (ro_reg32_t)0x40028D04U; /** @brief Tx queue underflow register. */
+static ro_reg32_t const ETHERNET_MAC_MTLTXQDR                           = (ro_reg32_t)0x40028D08U; /** @brief Tx queue debug Register. */
+static rw_reg32_t const ETHERNET_MAC_MTLQICSR                           = (rw_reg32_t)0x40028D2CU; /** @brief Queue interrupt control status Register. */
+static rw_reg32_t const ETHERNET_MAC_MTLRXQOMR                          = (rw_reg32_t)0x40028D30U; /** @brief Rx queue operating mode register. */
+static ro_reg32_t const ETHERNET_MAC_MTLRXQMPOCR                        = (ro_reg32_t)0x40028D34U; /** @brief Rx queue missed packet and overflow counter register. */
+static ro_reg32_t const ETHERNET_MAC_MTLRXQDR                           = (ro_reg32_t)0x40028D38U; /** @brief Rx queue debug register. */
+static rw_reg32_t const ETHERNET_MAC_MACCR                              = (rw_reg32_t)0x40028000U; /** @brief Operating mode configuration register. */
+static rw_reg32_t const ETHERNET_MAC_MACECR                             = (rw_reg32_t)0x40028004U; /** @brief Extended operating mode configuration register. */
+static rw_reg32_t const ETHERNET_MAC_MACPFR                             = (rw_reg32_t)0x40028008U; /** @brief Packet filtering control register. */
+static rw_reg32_t const ETHERNET_MAC_MACWTR                             = (rw_reg32_t)0x4002800CU; /** @brief Watchdog timeout register. */
+static rw_reg32_t const ETHERNET_MAC_MACHT0R                            = (rw_reg32_t)0x40028010U; /** @brief Hash Table 0 register. */
+static rw_reg32_t const ETHERNET_MAC_MACHT1R                            = (rw_reg32_t)0x40028014U; /** @brief Hash Table 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACVTR                             = (rw_reg32_t)0x40028050U; /** @brief VLAN tag register. */
+static rw_reg32_t const ETHERNET_MAC_MACVHTR                            = (rw_reg32_t)0x40028058U; /** @brief VLAN Hash table register. */
+static rw_reg32_t const ETHERNET_MAC_MACVIR                             = (rw_reg32_t)0x40028060U; /** @brief VLAN inclusion register. */
+static rw_reg32_t const ETHERNET_MAC_MACIVIR                            = (rw_reg32_t)0x40028064U; /** @brief Inner VLAN inclusion register. */
+static rw_reg32_t const ETHERNET_MAC_MACQTXFCR                          = (rw_reg32_t)0x40028070U; /** @brief Tx Queue flow control register. */
+static rw_reg32_t const ETHERNET_MAC_MACRXFCR                           = (rw_reg32_t)0x40028090U; /** @brief Rx flow control register. */
+static ro_reg32_t const ETHERNET_MAC_MACISR                             = (ro_reg32_t)0x400280B0U; /** @brief Interrupt status register. */
+static rw_reg32_t const ETHERNET_MAC_MACIER                             = (rw_reg32_t)0x400280B4U; /** @brief Interrupt enable register. */
+static ro_reg32_t const ETHERNET_MAC_MACRXTXSR                          = (ro_reg32_t)0x400280B8U; /** @brief Rx Tx status register. */
+static rw_reg32_t const ETHERNET_MAC_MACPCSR                            = (rw_reg32_t)0x400280C0U; /** @brief PMT control status register. */
+static rw_reg32_t const ETHERNET_MAC_MACRWKPFR                          = (rw_reg32_t)0x400280C4U; /** @brief Remove wakeup packet filter register. */
+static rw_reg32_t const ETHERNET_MAC_MACLCSR                            = (rw_reg32_t)0x400280D0U; /** @brief LPI control status register. */
+static rw_reg32_t const ETHERNET_MAC_MACLTCR                            = (rw_reg32_t)0x400280D4U; /** @brief LPI timers control register. */
+static rw_reg32_t const ETHERNET_MAC_MACLETR                            = (rw_reg32_t)0x400280D8U; /** @brief LPI entry timer register. */
+static rw_reg32_t const ETHERNET_MAC_MAC1USTCR                          = (rw_reg32_t)0x400280DCU; /** @brief 1-microsecond-tick counter register. */
+static ro_reg32_t const ETHERNET_MAC_MACVR                              = (ro_reg32_t)0x40028110U; /** @brief Version register. */
+static ro_reg32_t const ETHERNET_MAC_MACHWF1R                           = (ro_reg32_t)0x40028120U; /** @brief HW feature 1 register. */
+static ro_reg32_t const ETHERNET_MAC_MACHWF2R                           = (ro_reg32_t)0x40028124U; /** @brief HW feature 2 register. */
+static rw_reg32_t const ETHERNET_MAC_MACMDIOAR                          = (rw_reg32_t)0x40028200U; /** @brief MDIO address register. */
+static rw_reg32_t const ETHERNET_MAC_MACMDIODR                          = (rw_reg32_t)0x40028204U; /** @brief MDIO data register. */
+static rw_reg32_t const ETHERNET_MAC_MACARPAR                           = (rw_reg32_t)0x40028AE0U; /** @brief ARP address register. */
+static rw_reg32_t const ETHERNET_MAC_MACA0HR                            = (rw_reg32_t)0x40028300U; /** @brief Address 0 high register. */
+static rw_reg32_t const ETHERNET_MAC_MACA1HR                            = (rw_reg32_t)0x40028308U; /** @brief Address 1 high register. */
+static rw_reg32_t const ETHERNET_MAC_MACA2HR                            = (rw_reg32_t)0x40028310U; /** @brief Address 2 high register. */
+static rw_reg32_t const ETHERNET_MAC_MACA3HR                            = (rw_reg32_t)0x40028318U; /** @brief Address 3 high register. */
+static rw_reg32_t const ETHERNET_MAC_MMC_CONTROL                        = (rw_reg32_t)0x40028700U; /** @brief MMC control register. */
+static ro_reg32_t const ETHERNET_MAC_MMC_RX_INTERRUPT                   = (ro_reg32_t)0x40028704U; /** @brief MMC Rx interrupt register. */
+static ro_reg32_t const ETHERNET_MAC_MMC_TX_INTERRUPT                   = (ro_reg32_t)0x40028708U; /** @brief MMC Tx interrupt register. */
+static rw_reg32_t const ETHERNET_MAC_MMC_RX_INTERRUPT_MASK              = (rw_reg32_t)0x4002870CU; /** @brief MMC Rx interrupt mask register. */
+static rw_reg32_t const ETHERNET_MAC_MMC_TX_INTERRUPT_MASK              = (rw_reg32_t)0x40028710U; /** @brief MMC Tx interrupt mask register. */
+static ro_reg32_t const ETHERNET_MAC_TX_SINGLE_COLLISION_GOOD_PACKETS   = (ro_reg32_t)0x4002874CU; /** @brief Tx single collision good packets register. */
+static ro_reg32_t const ETHERNET_MAC_TX_MULTIPLE_COLLISION_GOOD_PACKETS = (ro_reg32_t)0x40028750U; /** @brief Tx multiple collision good packets register. */
+static ro_reg32_t const ETHERNET_MAC_TX_PACKET_COUNT_GOOD               = (ro_reg32_t)0x40028768U; /** @brief Tx packet count good register. */
+static ro_reg32_t const ETHERNET_MAC_RX_CRC_ERROR_PACKETS               = (ro_reg32_t)0x40028794U; /** @brief Rx CRC error packets register. */
+static ro_reg32_t const ETHERNET_MAC_RX_ALIGNMENT_ERROR_PACKETS         = (ro_reg32_t)0x40028798U; /** @brief Rx alignment error packets register. */
+static ro_reg32_t const ETHERNET_MAC_RX_UNICAST_PACKETS_GOOD            = (ro_reg32_t)0x400287C4U; /** @brief Rx unicast packets good register. */
+static ro_reg32_t const ETHERNET_MAC_TX_LPI_USEC_CNTR                   = (ro_reg32_t)0x400287ECU; /** @brief Tx LPI microsecond timer register. */
+static ro_reg32_t const ETHERNET_MAC_TX_LPI_TRAN_CNTR                   = (ro_reg32_t)0x400287F0U; /** @brief Tx LPI transition counter register. */
+static ro_reg32_t const ETHERNET_MAC_RX_LPI_USEC_CNTR                   = (ro_reg32_t)0x400287F4U; /** @brief Rx LPI microsecond counter register. */
+static ro_reg32_t const ETHERNET_MAC_RX_LPI_TRAN_CNTR                   = (ro_reg32_t)0x400287F8U; /** @brief Rx LPI transition counter register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3L4C0R                         = (rw_reg32_t)0x40028900U; /** @brief L3 and L4 control 0 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL4A0R                           = (rw_reg32_t)0x40028904U; /** @brief Layer4 address filter 0 register. */
+static ro_reg32_t const ETHERNET_MAC_MACDR                              = (ro_reg32_t)0x40028114U; /** @brief Debug register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A00R                          = (rw_reg32_t)0x40028910U; /** @brief MACL3A00R. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A10R                          = (rw_reg32_t)0x40028914U; /** @brief Layer3 address 1 filter 0 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A20                           = (rw_reg32_t)0x40028918U; /** @brief Layer3 Address 2 filter 0 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A30                           = (rw_reg32_t)0x4002891CU; /** @brief Layer3 Address 3 filter 0 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3L4C1R                         = (rw_reg32_t)0x40028930U; /** @brief L3 and L4 control 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL4A1R                           = (rw_reg32_t)0x40028934U; /** @brief Layer 4 address filter 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A01R                          = (rw_reg32_t)0x40028940U; /** @brief Layer3 address 0 filter 1 Register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A11R                          = (rw_reg32_t)0x40028944U; /** @brief Layer3 address 1 filter 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A21R                          = (rw_reg32_t)0x40028948U; /** @brief Layer3 address 2 filter 1 Register. */
+static rw_reg32_t const ETHERNET_MAC_MACL3A31R                          = (rw_reg32_t)0x4002894CU; /** @brief Layer3 address 3 filter 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSCR                            = (rw_reg32_t)0x40028B00U; /** @brief Timestamp control Register. */
+static rw_reg32_t const ETHERNET_MAC_MACSSIR                            = (rw_reg32_t)0x40028B04U; /** @brief Sub-second increment register. */
+static ro_reg32_t const ETHERNET_MAC_MACSTSR                            = (ro_reg32_t)0x40028B08U; /** @brief System time seconds register. */
+static ro_reg32_t const ETHERNET_MAC_MACSTNR                            = (ro_reg32_t)0x40028B0CU; /** @brief System time nanoseconds register. */
+static rw_reg32_t const ETHERNET_MAC_MACSTSUR                           = (rw_reg32_t)0x40028B10U; /** @brief System time seconds update register. */
+static rw_reg32_t const ETHERNET_MAC_MACSTNUR                           = (rw_reg32_t)0x40028B14U; /** @brief System time nanoseconds update register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSAR                            = (rw_reg32_t)0x40028B18U; /** @brief Timestamp addend register. */
+static ro_reg32_t const ETHERNET_MAC_MACTSSR                            = (ro_reg32_t)0x40028B20U; /** @brief Timestamp status register. */
+static ro_reg32_t const ETHERNET_MAC_MACTXTSSNR                         = (ro_reg32_t)0x40028B30U; /** @brief Tx timestamp status nanoseconds register. */
+static ro_reg32_t const ETHERNET_MAC_MACTXTSSSR                         = (ro_reg32_t)0x40028B34U; /** @brief Tx timestamp status seconds register. */
+static rw_reg32_t const ETHERNET_MAC_MACACR                             = (rw_reg32_t)0x40028B40U; /** @brief Auxiliary control register. */
+static ro_reg32_t const ETHERNET_MAC_MACATSNR                           = (ro_reg32_t)0x40028B48U; /** @brief Auxiliary timestamp nanoseconds register. */
+static ro_reg32_t const ETHERNET_MAC_MACATSSR                           = (ro_reg32_t)0x40028B4CU; /** @brief Auxiliary timestamp seconds register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSIACR                          = (rw_reg32_t)0x40028B50U; /** @brief Timestamp Ingress asymmetric correction register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSEACR                          = (rw_reg32_t)0x40028B54U; /** @brief Timestamp Egress asymmetric correction register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSICNR                          = (rw_reg32_t)0x40028B58U; /** @brief Timestamp Ingress correction nanosecond register. */
+static rw_reg32_t const ETHERNET_MAC_MACTSECNR                          = (rw_reg32_t)0x40028B5CU; /** @brief Timestamp Egress correction nanosecond register. */
+static rw_reg32_t const ETHERNET_MAC_MACPPSCR                           = (rw_reg32_t)0x40028B70U; /** @brief PPS control register. */
+static rw_reg32_t const ETHERNET_MAC_MACPPSTTSR                         = (rw_reg32_t)0x40028B80U; /** @brief PPS target time seconds register. */
+static rw_reg32_t const ETHERNET_MAC_MACPPSTTNR                         = (rw_reg32_t)0x40028B84U; /** @brief PPS target time nanoseconds register. */
+static rw_reg32_t const ETHERNET_MAC_MACPPSIR                           = (rw_reg32_t)0x40028B88U; /** @brief PPS interval register. */
+static rw_reg32_t const ETHERNET_MAC_MACPPSWR                           = (rw_reg32_t)0x40028B8CU; /** @brief PPS width register. */
+static rw_reg32_t const ETHERNET_MAC_MACPOCR                            = (rw_reg32_t)0x40028BC0U; /** @brief PTP Offload control register. */
+static rw_reg32_t const ETHERNET_MAC_MACSPI0R                           = (rw_reg32_t)0x40028BC4U; /** @brief PTP Source Port Identity 0 Register. */
+static rw_reg32_t const ETHERNET_MAC_MACSPI1R                           = (rw_reg32_t)0x40028BC8U; /** @brief PTP Source port identity 1 register. */
+static rw_reg32_t const ETHERNET_MAC_MACSPI2R                           = (rw_reg32_t)0x40028BCCU; /** @brief PTP Source port identity 2 register. */
+static rw_reg32_t const ETHERNET_MAC_MACLMIR                            = (rw_reg32_t)0x40028BD0U; /** @brief Log message interval register. */
+
+/** @subsection Enumerated ETHERNET_MAC Register Definitions */
+
+/** @brief Address 0 low register. */
+static rw_reg32_t const ETHERNET_MAC_MACAxLR[4] = {
+  [0] = (rw_reg32_t)0x40028304U,
+  [1] = (rw_reg32_t)0x4002830CU,
+  [2] = (rw_reg32_t)0x40028314U,
+  [3] = (rw_reg32_t)0x4002831CU,
+};
+
+/** @subsection ETHERNET_MAC Register Field Definitions */
+
+static const field32_t ETHERNET_MAC_DMAMR_SWR                         = {.msk = 0x00000001U, .pos = 0};  /** @brief Software Reset. */
+static const field32_t ETHERNET_MAC_DMAMR_DA                          = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA Tx or Rx Arbitration Scheme. */
+static const field32_t ETHERNET_MAC_DMAMR_TXPR                        = {.msk = 0x00000800U, .pos = 11}; /** @brief Transmit priority. */
+static const field32_t ETHERNET_MAC_DMAMR_PR                          = {.msk = 0x00007000U, .pos = 12}; /** @brief Priority ratio. */
+static const field32_t ETHERNET_MAC_DMAMR_INTM                        = {.msk = 0x00010000U, .pos = 16}; /** @brief Interrupt Mode. */
+static const field32_t ETHERNET_MAC_DMASBMR_FB                        = {.msk = 0x00000001U, .pos = 0};  /** @brief Fixed Burst Length. */
+static const field32_t ETHERNET_MAC_DMASBMR_AAL                       = {.msk = 0x00001000U, .pos = 12}; /** @brief Address-Aligned Beats. */
+static const field32_t ETHERNET_MAC_DMASBMR_MB                        = {.msk = 0x00004000U, .pos = 14}; /** @brief Mixed Burst. */
+static const field32_t ETHERNET_MAC_DMASBMR_RB                        = {.msk = 0x00008000U, .pos = 15}; /** @brief Rebuild INCRx Burst. */
+static const field32_t ETHERNET_MAC_DMAISR_DC0IS                      = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA Channel Interrupt Status. */
+static const field32_t ETHERNET_MAC_DMAISR_MTLIS                      = {.msk = 0x00010000U, .pos = 16}; /** @brief MTL Interrupt Status. */
+static const field32_t ETHERNET_MAC_DMAISR_MACIS                      = {.msk = 0x00020000U, .pos = 17}; /** @brief MAC Interrupt Status. */
+static const field32_t ETHERNET_MAC_DMADSR_AXWHSTS                    = {.msk = 0x00000001U, .pos = 0};  /** @brief AHB Master Write Channel. */
+static const field32_t ETHERNET_MAC_DMADSR_RPS0                       = {.msk = 0x00000F00U, .pos = 8};  /** @brief DMA Channel Receive Process State. */
+static const field32_t ETHERNET_MAC_DMADSR_TPS0                       = {.msk = 0x0000F000U, .pos = 12}; /** @brief DMA Channel Transmit Process State. */
+static const field32_t ETHERNET_MAC_DMACCR_MSS                        = {.msk = 0x00003FFFU, .pos = 0};  /** @brief Maximum Segment Size. */
+static const field32_t ETHERNET_MAC_DMACCR_PBLX8                      = {.msk = 0x00010000U, .pos = 16}; /** @brief 8xPBL mode. */
+static const field32_t ETHERNET_MAC_DMACCR_DSL                        = {.msk = 0x001C0000U, .pos = 18}; /** @brief Descriptor Skip Length. */
+static const field32_t ETHERNET_MAC_DMACTXCR_ST                       = {.msk = 0x00000001U, .pos = 0};  /** @brief Start or Stop Transmission Command. */
+static const field32_t ETHERNET_MAC_DMACTXCR_OSF                      = {.msk = 0x00000010U, .pos = 4};  /** @brief Operate on Second Packet. */
+static const field32_t ETHERNET_MAC_DMACTXCR_TSE                      = {.msk = 0x00001000U, .pos = 12}; /** @brief TCP Segmentation Enabled. */
+static const field32_t ETHERNET_MAC_DMACTXCR_TXPBL                    = {.msk = 0x003F0000U, .pos = 16}; /** @brief Transmit Programmable Burst Length. */
+static const field32_t ETHERNET_MAC_DMACRXCR_SR                       = {.msk = 0x00000001U, .pos = 0};  /** @brief Start or Stop Receive Command. */
+static const field32_t ETHERNET_MAC_DMACRXCR_RBSZ                     = {.msk = 0x00007FFEU, .pos = 1};  /** @brief Receive Buffer size. */
+static const field32_t ETHERNET_MAC_DMACRXCR_RXPBL                    = {.msk = 0x003F0000U, .pos = 16}; /** @brief RXPBL. */
+static const field32_t ETHERNET_MAC_DMACRXCR_RPF                      = {.msk = 0x80000000U, .pos = 31}; /** @brief DMA Rx Channel Packet Flush. */
+static const field32_t ETHERNET_MAC_DMACTXDLAR_TDESLA                 = {.msk = 0xFFFFFFFCU, .pos = 2};  /** @brief Start of Transmit List. */
+static const field32_t ETHERNET_MAC_DMACRXDLAR_RDESLA                 = {.msk = 0xFFFFFFFCU, .pos = 2};  /** @brief Start of Receive List. */
+static const field32_t ETHERNET_MAC_DMACTXDTPR_TDT                    = {.msk = 0xFFFFFFFCU, .pos = 2};  /** @brief Transmit Descriptor Tail Pointer. */
+static const field32_t ETHERNET_MAC_DMACRXDTPR_RDT                    = {.msk = 0xFFFFFFFCU, .pos = 2};  /** @brief Receive Descriptor Tail Pointer. */
+static const field32_t ETHERNET_MAC_DMACTXRLR_TDRL                    = {.msk = 0x000003FFU, .pos = 0};  /** @brief Transmit Descriptor Ring Length. */
+static const field32_t ETHERNET_MAC_DMACRXRLR_RDRL                    = {.msk = 0x000003FFU, .pos = 0};  /** @brief Receive Descriptor Ring Length. */
+static const field32_t ETHERNET_MAC_DMACIER_TIE                       = {.msk = 0x00000001U, .pos = 0};  /** @brief Transmit Interrupt Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_TXSE                      = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit Stopped Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_TBUE                      = {.msk = 0x00000004U, .pos = 2};  /** @brief Transmit Buffer Unavailable Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_RIE                       = {.msk = 0x00000040U, .pos = 6};  /** @brief Receive Interrupt Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_RBUE                      = {.msk = 0x00000080U, .pos = 7};  /** @brief Receive Buffer Unavailable Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_RSE                       = {.msk = 0x00000100U, .pos = 8};  /** @brief Receive Stopped Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_RWTE                      = {.msk = 0x00000200U, .pos = 9};  /** @brief Receive Watchdog Timeout Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_ETIE                      = {.msk = 0x00000400U, .pos = 10}; /** @brief Early Transmit Interrupt Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_ERIE                      = {.msk = 0x00000800U, .pos = 11}; /** @brief Early Receive Interrupt Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_FBEE                      = {.msk = 0x00001000U, .pos = 12}; /** @brief Fatal Bus Error Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_CDEE                      = {.msk = 0x00002000U, .pos = 13}; /** @brief Context Descriptor Error Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_AIE                       = {.msk = 0x00004000U, .pos = 14}; /** @brief Abnormal Interrupt Summary Enable. */
+static const field32_t ETHERNET_MAC_DMACIER_NIE                       = {.msk = 0x00008000U, .pos = 15}; /** @brief Normal Interrupt Summary Enable. */
+static const field32_t ETHERNET_MAC_DMACRXIWTR_RWT                    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Receive Interrupt Watchdog Timer Count. */
+static const field32_t ETHERNET_MAC_DMACSR_TI                         = {.msk = 0x00000001U, .pos = 0};  /** @brief Transmit Interrupt. */
+static const field32_t ETHERNET_MAC_DMACSR_TPS                        = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit Process Stopped. */
+static const field32_t ETHERNET_MAC_DMACSR_TBU                        = {.msk = 0x00000004U, .pos = 2};  /** @brief Transmit Buffer Unavailable. */
+static const field32_t ETHERNET_MAC_DMACSR_RI                         = {.msk = 0x00000040U, .pos = 6};  /** @brief Receive Interrupt. */
+static const field32_t ETHERNET_MAC_DMACSR_RBU                        = {.msk = 0x00000080U, .pos = 7};  /** @brief Receive Buffer Unavailable. */
+static const field32_t ETHERNET_MAC_DMACSR_RPS                        = {.msk = 0x00000100U, .pos = 8};  /** @brief Receive Process Stopped. */
+static const field32_t ETHERNET_MAC_DMACSR_RWT                        = {.msk = 0x00000200U, .pos = 9};  /** @brief Receive Watchdog Timeout. */
+static const field32_t ETHERNET_MAC_DMACSR_ET                         = {.msk = 0x00000400U, .pos = 10}; /** @brief Early Transmit Interrupt. */
+static const field32_t ETHERNET_MAC_DMACSR_ER                         = {.msk = 0x00000800U, .pos = 11}; /** @brief Early Receive Interrupt. */
+static const field32_t ETHERNET_MAC_DMACSR_FBE                        = {.msk = 0x00001000U, .pos = 12}; /** @brief Fatal Bus Error. */
+static const field32_t ETHERNET_MAC_DMACSR_CDE                        = {.msk = 0x00002000U, .pos = 13}; /** @brief Context Descriptor Error. */
+static const field32_t ETHERNET_MAC_DMACSR_AIS                        = {.msk = 0x00004000U, .pos = 14}; /** @brief Abnormal Interrupt Summary. */
+static const field32_t ETHERNET_MAC_DMACSR_NIS                        = {.msk = 0x00008000U, .pos = 15}; /** @brief Normal Interrupt Summary. */
+static const field32_t ETHERNET_MAC_DMACSR_TEB                        = {.msk = 0x00070000U, .pos = 16}; /** @brief Tx DMA Error Bits. */
+static const field32_t ETHERNET_MAC_DMACSR_REB                        = {.msk = 0x00380000U, .pos = 19}; /** @brief Rx DMA Error Bits. */
+static const field32_t ETHERNET_MAC_DMACMFCR_MFC                      = {.msk = 0x000007FFU, .pos = 0};  /** @brief Dropped Packet Counters. */
+static const field32_t ETHERNET_MAC_DMACMFCR_MFCO                     = {.msk = 0x00008000U, .pos = 15}; /** @brief Overflow status of the MFC Counter. */
+static const field32_t ETHERNET_MAC_MTLOMR_DTXSTS                     = {.msk = 0x00000002U, .pos = 1};  /** @brief DTXSTS. */
+static const field32_t ETHERNET_MAC_MTLOMR_CNTPRST                    = {.msk = 0x00000100U, .pos = 8};  /** @brief CNTPRST. */
+static const field32_t ETHERNET_MAC_MTLOMR_CNTCLR                     = {.msk = 0x00000200U, .pos = 9};  /** @brief CNTCLR. */
+static const field32_t ETHERNET_MAC_MTLISR_Q0IS                       = {.msk = 0x00000001U, .pos = 0};  /** @brief Queue interrupt status. */
+static const field32_t ETHERNET_MAC_MTLTXQOMR_FTQ                     = {.msk = 0x00000001U, .pos = 0};  /** @brief Flush Transmit Queue. */
+static const field32_t ETHERNET_MAC_MTLTXQOMR_TSF                     = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit Store and Forward. */
+static const field32_t ETHERNET_MAC_MTLTXQOMR_TXQEN                   = {.msk = 0x0000000CU, .pos = 2};  /** @brief Transmit Queue Enable. */
+static const field32_t ETHERNET_MAC_MTLTXQOMR_TTC                     = {.msk = 0x00000070U, .pos = 4};  /** @brief Transmit Threshold Control. */
+static const field32_t ETHERNET_MAC_MTLTXQOMR_TQS                     = {.msk = 0x01FF0000U, .pos = 16}; /** @brief Transmit Queue Size. */
+static const field32_t ETHERNET_MAC_MTLTXQUR_UFFRMCNT                 = {.msk = 0x000007FFU, .pos = 0};  /** @brief Underflow Packet Counter. */
+static const field32_t ETHERNET_MAC_MTLTXQUR_UFCNTOVF                 = {.msk = 0x00000800U, .pos = 11}; /** @brief UFCNTOVF. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_TXQPAUSED                = {.msk = 0x00000001U, .pos = 0};  /** @brief TXQPAUSED. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_TRCSTS                   = {.msk = 0x00000006U, .pos = 1};  /** @brief TRCSTS. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_TWCSTS                   = {.msk = 0x00000008U, .pos = 3};  /** @brief TWCSTS. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_TXQSTS                   = {.msk = 0x00000010U, .pos = 4};  /** @brief TXQSTS. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_TXSTSFSTS                = {.msk = 0x00000020U, .pos = 5};  /** @brief TXSTSFSTS. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_PTXQ                     = {.msk = 0x00070000U, .pos = 16}; /** @brief PTXQ. */
+static const field32_t ETHERNET_MAC_MTLTXQDR_STXSTSF                  = {.msk = 0x00700000U, .pos = 20}; /** @brief STXSTSF. */
+static const field32_t ETHERNET_MAC_MTLQICSR_TXUNFIS                  = {.msk = 0x00000001U, .pos = 0};  /** @brief TXUNFIS. */
+static const field32_t ETHERNET_MAC_MTLQICSR_TXUIE                    = {.msk = 0x00000100U, .pos = 8};  /** @brief TXUIE. */
+static const field32_t ETHERNET_MAC_MTLQICSR_RXOVFIS                  = {.msk = 0x00010000U, .pos = 16}; /** @brief RXOVFIS. */
+static const field32_t ETHERNET_MAC_MTLQICSR_RXOIE                    = {.msk = 0x01000000U, .pos = 24}; /** @brief RXOIE. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_RTC                     = {.msk = 0x00000003U, .pos = 0};  /** @brief RTC. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_FUP                     = {.msk = 0x00000008U, .pos = 3};  /** @brief FUP. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_FEP                     = {.msk = 0x00000010U, .pos = 4};  /** @brief FEP. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_RSF                     = {.msk = 0x00000020U, .pos = 5};  /** @brief RSF. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_DIS_TCP_EF              = {.msk = 0x00000040U, .pos = 6};  /** @brief DIS_TCP_EF. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_EHFC                    = {.msk = 0x00000080U, .pos = 7};  /** @brief EHFC. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_RFA                     = {.msk = 0x00000700U, .pos = 8};  /** @brief RFA. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_RFD                     = {.msk = 0x0001C000U, .pos = 14}; /** @brief RFD. */
+static const field32_t ETHERNET_MAC_MTLRXQOMR_RQS                     = {.msk = 0x00700000U, .pos = 20}; /** @brief RQS. */
+static const field32_t ETHERNET_MAC_MTLRXQMPOCR_OVFPKTCNT             = {.msk = 0x000007FFU, .pos = 0};  /** @brief OVFPKTCNT. */
+static const field32_t ETHERNET_MAC_MTLRXQMPOCR_OVFCNTOVF             = {.msk = 0x00000800U, .pos = 11}; /** @brief OVFCNTOVF. */
+static const field32_t ETHERNET_MAC_MTLRXQMPOCR_MISPKTCNT             = {.msk = 0x07FF0000U, .pos = 16}; /** @brief MISPKTCNT. */
+static const field32_t ETHERNET_MAC_MTLRXQMPOCR_MISCNTOVF             = {.msk = 0x08000000U, .pos = 27}; /** @brief MISCNTOVF. */
+static const field32_t ETHERNET_MAC_MTLRXQDR_RWCSTS                   = {.msk = 0x00000001U, .pos = 0};  /** @brief RWCSTS. */
+static const field32_t ETHERNET_MAC_MTLRXQDR_RRCSTS                   = {.msk = 0x00000006U, .pos = 1};  /** @brief RRCSTS. */
+static const field32_t ETHERNET_MAC_MTLRXQDR_RXQSTS                   = {.msk = 0x00000030U, .pos = 4};  /** @brief RXQSTS. */
+static const field32_t ETHERNET_MAC_MTLRXQDR_PRXQ                     = {.msk = 0x3FFF0000U, .pos = 16}; /** @brief PRXQ. */
+static const field32_t ETHERNET_MAC_MACCR_RE                          = {.msk = 0x00000001U, .pos = 0};  /** @brief Receiver Enable. */
+static const field32_t ETHERNET_MAC_MACCR_TE                          = {.msk = 0x00000002U, .pos = 1};  /** @brief TE. */
+static const field32_t ETHERNET_MAC_MACCR_PRELEN                      = {.msk = 0x0000000CU, .pos = 2};  /** @brief PRELEN. */
+static const field32_t ETHERNET_MAC_MACCR_DC                          = {.msk = 0x00000010U, .pos = 4};  /** @brief DC. */
+static const field32_t ETHERNET_MAC_MACCR_BL                          = {.msk = 0x00000060U, .pos = 5};  /** @brief BL. */
+static const field32_t ETHERNET_MAC_MACCR_DR                          = {.msk = 0x00000100U, .pos = 8};  /** @brief DR. */
+static const field32_t ETHERNET_MAC_MACCR_DCRS                        = {.msk = 0x00000200U, .pos = 9};  /** @brief DCRS. */
+static const field32_t ETHERNET_MAC_MACCR_DO                          = {.msk = 0x00000400U, .pos = 10}; /** @brief DO. */
+static const field32_t ETHERNET_MAC_MACCR_ECRSFD                      = {.msk = 0x00000800U, .pos = 11}; /** @brief ECRSFD. */
+static const field32_t ETHERNET_MAC_MACCR_LM                          = {.msk = 0x00001000U, .pos = 12}; /** @brief LM. */
+static const field32_t ETHERNET_MAC_MACCR_DM                          = {.msk = 0x00002000U, .pos = 13}; /** @brief DM. */
+static const field32_t ETHERNET_MAC_MACCR_FES                         = {.msk = 0x00004000U, .pos = 14}; /** @brief FES. */
+static const field32_t ETHERNET_MAC_MACCR_JE                          = {.msk = 0x00010000U, .pos = 16}; /** @brief JE. */
+static const field32_t ETHERNET_MAC_MACCR_JD                          = {.msk = 0x00020000U, .pos = 17}; /** @brief JD. */
+static const field32_t ETHERNET_MAC_MACCR_WD                          = {.msk = 0x00080000U, .pos = 19}; /** @brief WD. */
+static const field32_t ETHERNET_MAC_MACCR_ACS                         = {.msk = 0x00100000U, .pos = 20}; /** @brief ACS. */
+static const field32_t ETHERNET_MAC_MACCR_CST                         = {.msk = 0x00200000U, .pos = 21}; /** @brief CST. */
+static const field32_t ETHERNET_MAC_MACCR_S2KP                        = {.msk = 0x00400000U, .pos = 22}; /** @brief S2KP. */
+static const field32_t ETHERNET_MAC_MACCR_GPSLCE                      = {.msk = 0x00800000U, .pos = 23}; /** @brief GPSLCE. */
+static const field32_t ETHERNET_MAC_MACCR_IPG                         = {.msk = 0x07000000U, .pos = 24}; /** @brief IPG. */
+static const field32_t ETHERNET_MAC_MACCR_IPC                         = {.msk = 0x08000000U, .pos = 27}; /** @brief IPC. */
+static const field32_t ETHERNET_MAC_MACCR_SARC                        = {.msk = 0x70000000U, .pos = 28}; /** @brief SARC. */
+static const field32_t ETHERNET_MAC_MACCR_ARPEN                       = {.msk = 0x80000000U, .pos = 31}; /** @brief ARPEN. */
+static const field32_t ETHERNET_MAC_MACECR_GPSL                       = {.msk = 0x00003FFFU, .pos = 0};  /** @brief GPSL. */
+static const field32_t ETHERNET_MAC_MACECR_DCRCC                      = {.msk = 0x00010000U, .pos = 16}; /** @brief DCRCC. */
+static const field32_t ETHERNET_MAC_MACECR_SPEN                       = {.msk = 0x00020000U, .pos = 17}; /** @brief SPEN. */
+static const field32_t ETHERNET_MAC_MACECR_USP                        = {.msk = 0x00040000U, .pos = 18}; /** @brief USP. */
+static const field32_t ETHERNET_MAC_MACECR_EIPGEN                     = {.msk = 0x01000000U, .pos = 24}; /** @brief EIPGEN. */
+static const field32_t ETHERNET_MAC_MACECR_EIPG                       = {.msk = 0x3E000000U, .pos = 25}; /** @brief EIPG. */
+static const field32_t ETHERNET_MAC_MACPFR_PR                         = {.msk = 0x00000001U, .pos = 0};  /** @brief PR. */
+static const field32_t ETHERNET_MAC_MACPFR_HUC                        = {.msk = 0x00000002U, .pos = 1};  /** @brief HUC. */
+static const field32_t ETHERNET_MAC_MACPFR_HMC                        = {.msk = 0x00000004U, .pos = 2};  /** @brief HMC. */
+static const field32_t ETHERNET_MAC_MACPFR_DAIF                       = {.msk = 0x00000008U, .pos = 3};  /** @brief DAIF. */
+static const field32_t ETHERNET_MAC_MACPFR_PM                         = {.msk = 0x00000010U, .pos = 4};  /** @brief PM. */
+static const field32_t ETHERNET_MAC_MACPFR_DBF                        = {.msk = 0x00000020U, .pos = 5};  /** @brief DBF. */
+static const field32_t ETHERNET_MAC_MACPFR_PCF                        = {.msk = 0x000000C0U, .pos = 6};  /** @brief PCF. */
+static const field32_t ETHERNET_MAC_MACPFR_SAIF                       = {.msk = 0x00000100U, .pos = 8};  /** @brief SAIF. */
+static const field32_t ETHERNET_MAC_MACPFR_SAF                        = {.msk = 0x00000200U, .pos = 9};  /** @brief SAF. */
+static const field32_t ETHERNET_MAC_MACPFR_HPF                        = {.msk = 0x00000400U, .pos = 10}; /** @brief HPF. */
+static const field32_t ETHERNET_MAC_MACPFR_VTFE                       = {.msk = 0x00010000U, .pos = 16}; /** @brief VTFE. */
+static const field32_t ETHERNET_MAC_MACPFR_IPFE                       = {.msk = 0x00100000U, .pos = 20}; /** @brief IPFE. */
+static const field32_t ETHERNET_MAC_MACPFR_DNTU                       = {.msk = 0x00200000U, .pos = 21}; /** @brief DNTU. */
+static const field32_t ETHERNET_MAC_MACPFR_RA                         = {.msk = 0x80000000U, .pos = 31}; /** @brief RA. */
+static const field32_t ETHERNET_MAC_MACWTR_WTO                        = {.msk = 0x0000000FU, .pos = 0};  /** @brief WTO. */
+static const field32_t ETHERNET_MAC_MACWTR_PWE                        = {.msk = 0x00000100U, .pos = 8};  /** @brief PWE. */
+static const field32_t ETHERNET_MAC_MACVTR_VL                         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief VL. */
+static const field32_t ETHERNET_MAC_MACVTR_ETV                        = {.msk = 0x00010000U, .pos = 16}; /** @brief ETV. */
+static const field32_t ETHERNET_MAC_MACVTR_VTIM                       = {.msk = 0x00020000U, .pos = 17}; /** @brief VTIM. */
+static const field32_t ETHERNET_MAC_MACVTR_ESVL                       = {.msk = 0x00040000U, .pos = 18}; /** @brief ESVL. */
+static const field32_t ETHERNET_MAC_MACVTR_ERSVLM                     = {.msk = 0x00080000U, .pos = 19}; /** @brief ERSVLM. */
+static const field32_t ETHERNET_MAC_MACVTR_DOVLTC                     = {.msk = 0x00100000U, .pos = 20}; /** @brief DOVLTC. */
+static const field32_t ETHERNET_MAC_MACVTR_EVLS                       = {.msk = 0x00600000U, .pos = 21}; /** @brief EVLS. */
+static const field32_t ETHERNET_MAC_MACVTR_EVLRXS                     = {.msk = 0x01000000U, .pos = 24}; /** @brief EVLRXS. */
+static const field32_t ETHERNET_MAC_MACVTR_VTHM                       = {.msk = 0x02000000U, .pos = 25}; /** @brief VTHM. */
+static const field32_t ETHERNET_MAC_MACVTR_EDVLP                      = {.msk = 0x04000000U, .pos = 26}; /** @brief EDVLP. */
+static const field32_t ETHERNET_MAC_MACVTR_ERIVLT                     = {.msk = 0x08000000U, .pos = 27}; /** @brief ERIVLT. */
+static const field32_t ETHERNET_MAC_MACVTR_EIVLS                      = {.msk = 0x30000000U, .pos = 28}; /** @brief EIVLS. */
+static const field32_t ETHERNET_MAC_MACVTR_EIVLRXS                    = {.msk = 0x80000000U, .pos = 31}; /** @brief EIVLRXS. */
+static const field32_t ETHERNET_MAC_MACVHTR_VLHT                      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief VLHT. */
+static const field32_t ETHERNET_MAC_MACVIR_VLT                        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief VLT. */
+static const field32_t ETHERNET_MAC_MACVIR_VLC                        = {.msk = 0x00030000U, .pos = 16}; /** @brief VLC. */
+static const field32_t ETHERNET_MAC_MACVIR_VLP                        = {.msk = 0x00040000U, .pos = 18}; /** @brief VLP. */
+static const field32_t ETHERNET_MAC_MACVIR_CSVL                       = {.msk = 0x00080000U, .pos = 19}; /** @brief CSVL. */
+static const field32_t ETHERNET_MAC_MACVIR_VLTI                       = {.msk = 0x00100000U, .pos = 20}; /** @brief VLTI. */
+static const field32_t ETHERNET_MAC_MACIVIR_VLT                       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief VLT. */
+static const field32_t ETHERNET_MAC_MACIVIR_VLC                       = {.msk = 0x00030000U, .pos = 16}; /** @brief VLC. */
+static const field32_t ETHERNET_MAC_MACIVIR_VLP                       = {.msk = 0x00040000U, .pos = 18}; /** @brief VLP. */
+static const field32_t ETHERNET_MAC_MACIVIR_CSVL                      = {.msk = 0x00080000U, .pos = 19}; /** @brief CSVL. */
+static const field32_t ETHERNET_MAC_MACIVIR_VLTI                      = {.msk = 0x00100000U, .pos = 20}; /** @brief VLTI. */
+static const field32_t ETHERNET_MAC_MACQTXFCR_FCB_BPA                 = {.msk = 0x00000001U, .pos = 0};  /** @brief FCB_BPA. */
+static const field32_t ETHERNET_MAC_MACQTXFCR_TFE                     = {.msk = 0x00000002U, .pos = 1};  /** @brief TFE. */
+static const field32_t ETHERNET_MAC_MACQTXFCR_PLT                     = {.msk = 0x00000070U, .pos = 4};  /** @brief PLT. */
+static const field32_t ETHERNET_MAC_MACQTXFCR_DZPQ                    = {.msk = 0x00000080U, .pos = 7};  /** @brief DZPQ. */
+static const field32_t ETHERNET_MAC_MACQTXFCR_PT                      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief PT. */
+static const field32_t ETHERNET_MAC_MACRXFCR_RFE                      = {.msk = 0x00000001U, .pos = 0};  /** @brief RFE. */
+static const field32_t ETHERNET_MAC_MACRXFCR_UP                       = {.msk = 0x00000002U, .pos = 1};  /** @brief UP. */
+static const field32_t ETHERNET_MAC_MACISR_PHYIS                      = {.msk = 0x00000008U, .pos = 3};  /** @brief PHYIS. */
+static const field32_t ETHERNET_MAC_MACISR_PMTIS                      = {.msk = 0x00000010U, .pos = 4};  /** @brief PMTIS. */
+static const field32_t ETHERNET_MAC_MACISR_LPIIS                      = {.msk = 0x00000020U, .pos = 5};  /** @brief LPIIS. */
+static const field32_t ETHERNET_MAC_MACISR_MMCIS                      = {.msk = 0x00000100U, .pos = 8};  /** @brief MMCIS. */
+static const field32_t ETHERNET_MAC_MACISR_MMCRXIS                    = {.msk = 0x00000200U, .pos = 9};  /** @brief MMCRXIS. */
+static const field32_t ETHERNET_MAC_MACISR_MMCTXIS                    = {.msk = 0x00000400U, .pos = 10}; /** @brief MMCTXIS. */
+static const field32_t ETHERNET_MAC_MACISR_TSIS                       = {.msk = 0x00001000U, .pos = 12}; /** @brief TSIS. */
+static const field32_t ETHERNET_MAC_MACISR_TXSTSIS                    = {.msk = 0x00002000U, .pos = 13}; /** @brief TXSTSIS. */
+static const field32_t ETHERNET_MAC_MACISR_RXSTSIS                    = {.msk = 0x00004000U, .pos = 14}; /** @brief RXSTSIS. */
+static const field32_t ETHERNET_MAC_MACIER_PHYIE                      = {.msk = 0x00000008U, .pos = 3};  /** @brief PHYIE. */
+static const field32_t ETHERNET_MAC_MACIER_PMTIE                      = {.msk = 0x00000010U, .pos = 4};  /** @brief PMTIE. */
+static const field32_t ETHERNET_MAC_MACIER_LPIIE                      = {.msk = 0x00000020U, .pos = 5};  /** @brief LPIIE. */
+static const field32_t ETHERNET_MAC_MACIER_TSIE                       = {.msk = 0x00001000U, .pos = 12}; /** @brief TSIE. */
+static const field32_t ETHERNET_MAC_MACIER_TXSTSIE                    = {.msk = 0x00002000U, .pos = 13}; /** @brief TXSTSIE. */
+static const field32_t ETHERNET_MAC_MACIER_RXSTSIE                    = {.msk = 0x00004000U, .pos = 14}; /** @brief RXSTSIE. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_TJT                     = {.msk = 0x00000001U, .pos = 0};  /** @brief TJT. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_NCARR                   = {.msk = 0x00000002U, .pos = 1};  /** @brief NCARR. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_LCARR                   = {.msk = 0x00000004U, .pos = 2};  /** @brief LCARR. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_EXDEF                   = {.msk = 0x00000008U, .pos = 3};  /** @brief EXDEF. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_LCOL                    = {.msk = 0x00000010U, .pos = 4};  /** @brief LCOL. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_EXCOL                   = {.msk = 0x00000020U, .pos = 5};  /** @brief LCOL. */
+static const field32_t ETHERNET_MAC_MACRXTXSR_RWT                     = {.msk = 0x00000100U, .pos = 8};  /** @brief RWT. */
+static const field32_t ETHERNET_MAC_MACPCSR_PWRDWN                    = {.msk = 0x00000001U, .pos = 0};  /** @brief PWRDWN. */
+static const field32_t ETHERNET_MAC_MACPCSR_MGKPKTEN                  = {.msk = 0x00000002U, .pos = 1};  /** @brief MGKPKTEN. */
+static const field32_t ETHERNET_MAC_MACPCSR_RWKPKTEN                  = {.msk = 0x00000004U, .pos = 2};  /** @brief RWKPKTEN. */
+static const field32_t ETHERNET_MAC_MACPCSR_MGKPRCVD                  = {.msk = 0x00000020U, .pos = 5};  /** @brief MGKPRCVD. */
+static const field32_t ETHERNET_MAC_MACPCSR_RWKPRCVD                  = {.msk = 0x00000040U, .pos = 6};  /** @brief RWKPRCVD. */
+static const field32_t ETHERNET_MAC_MACPCSR_GLBLUCAST                 = {.msk = 0x00000200U, .pos = 9};  /** @brief GLBLUCAST. */
+static const field32_t ETHERNET_MAC_MACPCSR_RWKPFE                    = {.msk = 0x00000400U, .pos = 10}; /** @brief RWKPFE. */
+static const field32_t ETHERNET_MAC_MACPCSR_RWKPTR                    = {.msk = 0x1F000000U, .pos = 24}; /** @brief RWKPTR. */
+static const field32_t ETHERNET_MAC_MACPCSR_RWKFILTRST                = {.msk = 0x80000000U, .pos = 31}; /** @brief RWKFILTRST. */
+static const field32_t ETHERNET_MAC_MACLCSR_TLPIEN                    = {.msk = 0x00000001U, .pos = 0};  /** @brief TLPIEN. */
+static const field32_t ETHERNET_MAC_MACLCSR_TLPIEX                    = {.msk = 0x00000002U, .pos = 1};  /** @brief TLPIEX. */
+static const field32_t ETHERNET_MAC_MACLCSR_RLPIEN                    = {.msk = 0x00000004U, .pos = 2};  /** @brief RLPIEN. */
+static const field32_t ETHERNET_MAC_MACLCSR_RLPIEX                    = {.msk = 0x00000008U, .pos = 3};  /** @brief RLPIEX. */
+static const field32_t ETHERNET_MAC_MACLCSR_TLPIST                    = {.msk = 0x00000100U, .pos = 8};  /** @brief TLPIST. */
+static const field32_t ETHERNET_MAC_MACLCSR_RLPIST                    = {.msk = 0x00000200U, .pos = 9};  /** @brief RLPIST. */
+static const field32_t ETHERNET_MAC_MACLCSR_LPIEN                     = {.msk = 0x00010000U, .pos = 16}; /** @brief LPIEN. */
+static const field32_t ETHERNET_MAC_MACLCSR_PLS                       = {.msk = 0x00020000U, .pos = 17}; /** @brief PLS. */
+static const field32_t ETHERNET_MAC_MACLCSR_PLSEN                     = {.msk = 0x00040000U, .pos = 18}; /** @brief PLSEN. */
+static const field32_t ETHERNET_MAC_MACLCSR_LPITXA                    = {.msk = 0x00080000U, .pos = 19}; /** @brief LPITXA. */
+static const field32_t ETHERNET_MAC_MACLCSR_LPITE                     = {.msk = 0x00100000U, .pos = 20}; /** @brief LPITE. */
+static const field32_t ETHERNET_MAC_MACLCSR_LPITCSE                   = {.msk = 0x00200000U, .pos = 21}; /** @brief LPITCSE. */
+static const field32_t ETHERNET_MAC_MACLTCR_TWT                       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief TWT. */
+static const field32_t ETHERNET_MAC_MACLTCR_LST                       = {.msk = 0x03FF0000U, .pos = 16}; /** @brief LST. */
+static const field32_t ETHERNET_MAC_MACLETR_LPIET                     = {.msk = 0x0001FFFFU, .pos = 0};  /** @brief LPIET. */
+static const field32_t ETHERNET_MAC_MAC1USTCR_TIC_1US_CNTR            = {.msk = 0x00000FFFU, .pos = 0};  /** @brief TIC_1US_CNTR. */
+static const field32_t ETHERNET_MAC_MACVR_SNPSVER                     = {.msk = 0x000000FFU, .pos = 0};  /** @brief SNPSVER. */
+static const field32_t ETHERNET_MAC_MACVR_USERVER                     = {.msk = 0x0000FF00U, .pos = 8};  /** @brief USERVER. */
+static const field32_t ETHERNET_MAC_MACHWF1R_RXFIFOSIZE               = {.msk = 0x0000001FU, .pos = 0};  /** @brief RXFIFOSIZE. */
+static const field32_t ETHERNET_MAC_MACHWF1R_TXFIFOSIZE               = {.msk = 0x000007C0U, .pos = 6};  /** @brief TXFIFOSIZE. */
+static const field32_t ETHERNET_MAC_MACHWF1R_OSTEN                    = {.msk = 0x00000800U, .pos = 11}; /** @brief OSTEN. */
+static const field32_t ETHERNET_MAC_MACHWF1R_PTOEN                    = {.msk = 0x00001000U, .pos = 12}; /** @brief PTOEN. */
+static const field32_t ETHERNET_MAC_MACHWF1R_ADVTHWORD                = {.msk = 0x00002000U, .pos = 13}; /** @brief ADVTHWORD. */
+static const field32_t ETHERNET_MAC_MACHWF1R_DCBEN                    = {.msk = 0x00010000U, .pos = 16}; /** @brief DCBEN. */
+static const field32_t ETHERNET_MAC_MACHWF1R_SPHEN                    = {.msk = 0x00020000U, .pos = 17}; /** @brief SPHEN. */
+static const field32_t ETHERNET_MAC_MACHWF1R_TSOEN                    = {.msk = 0x00040000U, .pos = 18}; /** @brief TSOEN. */
+static const field32_t ETHERNET_MAC_MACHWF1R_DBGMEMA                  = {.msk = 0x00080000U, .pos = 19}; /** @brief DBGMEMA. */
+static const field32_t ETHERNET_MAC_MACHWF1R_AVSEL                    = {.msk = 0x00100000U, .pos = 20}; /** @brief AVSEL. */
+static const field32_t ETHERNET_MAC_MACHWF1R_HASHTBLSZ                = {.msk = 0x03000000U, .pos = 24}; /** @brief HASHTBLSZ. */
+static const field32_t ETHERNET_MAC_MACHWF1R_L3L4FNUM                 = {.msk = 0x78000000U, .pos = 27}; /** @brief L3L4FNUM. */
+static const field32_t ETHERNET_MAC_MACHWF2R_RXQCNT                   = {.msk = 0x0000000FU, .pos = 0};  /** @brief RXQCNT. */
+static const field32_t ETHERNET_MAC_MACHWF2R_TXQCNT                   = {.msk = 0x000003C0U, .pos = 6};  /** @brief TXQCNT. */
+static const field32_t ETHERNET_MAC_MACHWF2R_RXCHCNT                  = {.msk = 0x0000F000U, .pos = 12}; /** @brief RXCHCNT. */
+static const field32_t ETHERNET_MAC_MACHWF2R_TXCHCNT                  = {.msk = 0x003C0000U, .pos = 18}; /** @brief TXCHCNT. */
+static const field32_t ETHERNET_MAC_MACHWF2R_PPSOUTNUM                = {.msk = 0x07000000U, .pos = 24}; /** @brief PPSOUTNUM. */
+static const field32_t ETHERNET_MAC_MACHWF2R_AUXSNAPNUM               = {.msk = 0x70000000U, .pos = 28}; /** @brief AUXSNAPNUM. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_MB                      = {.msk = 0x00000001U, .pos = 0};  /** @brief MB. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_C45E                    = {.msk = 0x00000002U, .pos = 1};  /** @brief C45E. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_GOC                     = {.msk = 0x0000000CU, .pos = 2};  /** @brief GOC. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_SKAP                    = {.msk = 0x00000010U, .pos = 4};  /** @brief SKAP. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_CR                      = {.msk = 0x00000F00U, .pos = 8};  /** @brief CR. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_NTC                     = {.msk = 0x00007000U, .pos = 12}; /** @brief NTC. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_RDA                     = {.msk = 0x001F0000U, .pos = 16}; /** @brief RDA. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_PA                      = {.msk = 0x03E00000U, .pos = 21}; /** @brief PA. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_BTB                     = {.msk = 0x04000000U, .pos = 26}; /** @brief BTB. */
+static const field32_t ETHERNET_MAC_MACMDIOAR_PSE                     = {.msk = 0x08000000U, .pos = 27}; /** @brief PSE. */
+static const field32_t ETHERNET_MAC_MACMDIODR_MD                      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief MD. */
+static const field32_t ETHERNET_MAC_MACMDIODR_RA                      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief RA. */
+static const field32_t ETHERNET_MAC_MACA0HR_ADDRHI                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief ADDRHI. */
+static const field32_t ETHERNET_MAC_MACA0HR_AE                        = {.msk = 0x80000000U, .pos = 31}; /** @brief AE. */
+static const field32_t ETHERNET_MAC_MACA1HR_ADDRHI                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief ADDRHI. */
+static const field32_t ETHERNET_MAC_MACA1HR_MBC                       = {.msk = 0x3F000000U, .pos = 24}; /** @brief MBC. */
+static const field32_t ETHERNET_MAC_MACA1HR_SA                        = {.msk = 0x40000000U, .pos = 30}; /** @brief SA. */
+static const field32_t ETHERNET_MAC_MACA1HR_AE                        = {.msk = 0x80000000U, .pos = 31}; /** @brief AE. */
+static const field32_t ETHERNET_MAC_MACA2HR_ADDRHI                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief ADDRHI. */
+static const field32_t ETHERNET_MAC_MACA2HR_MBC                       = {.msk = 0x3F000000U, .pos = 24}; /** @brief MBC. */
+static const field32_t ETHERNET_MAC_MACA2HR_SA                        = {.msk = 0x40000000U, .pos = 30}; /** @brief SA. */
+static const field32_t ETHERNET_MAC_MACA2HR_AE                        = {.msk = 0x80000000U, .pos = 31}; /** @brief AE. */
+static const field32_t ETHERNET_MAC_MACA3HR_ADDRHI                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief ADDRHI. */
+static const field32_t ETHERNET_MAC_MACA3HR_MBC                       = {.msk = 0x3F000000U, .pos = 24}; /** @brief MBC. */
+static const field32_t ETHERNET_MAC_MACA3HR_SA                        = {.msk = 0x40000000U, .pos = 30}; /** @brief SA. */
+static const field32_t ETHERNET_MAC_MACA3HR_AE                        = {.msk = 0x80000000U, .pos = 31}; /** @brief AE. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_CNTRST                = {.msk = 0x00000001U, .pos = 0};  /** @brief CNTRST. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_CNTSTOPRO             = {.msk = 0x00000002U, .pos = 1};  /** @brief CNTSTOPRO. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_RSTONRD               = {.msk = 0x00000004U, .pos = 2};  /** @brief RSTONRD. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_CNTFREEZ              = {.msk = 0x00000008U, .pos = 3};  /** @brief CNTFREEZ. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_CNTPRST               = {.msk = 0x00000010U, .pos = 4};  /** @brief CNTPRST. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_CNTPRSTLVL            = {.msk = 0x00000020U, .pos = 5};  /** @brief CNTPRSTLVL. */
+static const field32_t ETHERNET_MAC_MMC_CONTROL_UCDBC                 = {.msk = 0x00000100U, .pos = 8};  /** @brief UCDBC. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_RXCRCERPIS       = {.msk = 0x00000020U, .pos = 5};  /** @brief RXCRCERPIS. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_RXALGNERPIS      = {.msk = 0x00000040U, .pos = 6};  /** @brief RXALGNERPIS. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_RXUCGPIS         = {.msk = 0x00020000U, .pos = 17}; /** @brief RXUCGPIS. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_RXLPIUSCIS       = {.msk = 0x04000000U, .pos = 26}; /** @brief RXLPIUSCIS. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_RXLPITRCIS       = {.msk = 0x08000000U, .pos = 27}; /** @brief RXLPITRCIS. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_TXSCOLGPIS       = {.msk = 0x00004000U, .pos = 14}; /** @brief TXSCOLGPIS. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_TXMCOLGPIS       = {.msk = 0x00008000U, .pos = 15}; /** @brief TXMCOLGPIS. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_TXGPKTIS         = {.msk = 0x00200000U, .pos = 21}; /** @brief TXGPKTIS. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_TXLPIUSCIS       = {.msk = 0x04000000U, .pos = 26}; /** @brief TXLPIUSCIS. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_TXLPITRCIS       = {.msk = 0x08000000U, .pos = 27}; /** @brief TXLPITRCIS. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_MASK_RXCRCERPIM  = {.msk = 0x00000020U, .pos = 5};  /** @brief RXCRCERPIM. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_MASK_RXALGNERPIM = {.msk = 0x00000040U, .pos = 6};  /** @brief RXALGNERPIM. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_MASK_RXUCGPIM    = {.msk = 0x00020000U, .pos = 17}; /** @brief RXUCGPIM. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_MASK_RXLPIUSCIM  = {.msk = 0x04000000U, .pos = 26}; /** @brief RXLPIUSCIM. */
+static const field32_t ETHERNET_MAC_MMC_RX_INTERRUPT_MASK_RXLPITRCIM  = {.msk = 0x08000000U, .pos = 27}; /** @brief RXLPITRCIM. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_MASK_TXSCOLGPIM  = {.msk = 0x00004000U, .pos = 14}; /** @brief TXSCOLGPIM. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_MASK_TXMCOLGPIM  = {.msk = 0x00008000U, .pos = 15}; /** @brief TXMCOLGPIM. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_MASK_TXGPKTIM    = {.msk = 0x00200000U, .pos = 21}; /** @brief TXGPKTIM. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_MASK_TXLPIUSCIM  = {.msk = 0x04000000U, .pos = 26}; /** @brief TXLPIUSCIM. */
+static const field32_t ETHERNET_MAC_MMC_TX_INTERRUPT_MASK_TXLPITRCIM  = {.msk = 0x08000000U, .pos = 27}; /** @brief TXLPITRCIM. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3PEN0                 = {.msk = 0x00000001U, .pos = 0};  /** @brief L3PEN0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3SAM0                 = {.msk = 0x00000004U, .pos = 2};  /** @brief L3SAM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3SAIM0                = {.msk = 0x00000008U, .pos = 3};  /** @brief L3SAIM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3DAM0                 = {.msk = 0x00000010U, .pos = 4};  /** @brief L3DAM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3DAIM0                = {.msk = 0x00000020U, .pos = 5};  /** @brief L3DAIM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3HSBM0                = {.msk = 0x000007C0U, .pos = 6};  /** @brief L3HSBM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L3HDBM0                = {.msk = 0x0000F800U, .pos = 11}; /** @brief L3HDBM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L4PEN0                 = {.msk = 0x00010000U, .pos = 16}; /** @brief L4PEN0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L4SPM0                 = {.msk = 0x00040000U, .pos = 18}; /** @brief L4SPM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L4SPIM0                = {.msk = 0x00080000U, .pos = 19}; /** @brief L4SPIM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L4DPM0                 = {.msk = 0x00100000U, .pos = 20}; /** @brief L4DPM0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_L4DPIM0                = {.msk = 0x00200000U, .pos = 21}; /** @brief L4DPIM0. */
+static const field32_t ETHERNET_MAC_MACL4A0R_L4SP0                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief L4SP0. */
+static const field32_t ETHERNET_MAC_MACL4A0R_L4DP0                    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief L4DP0. */
+static const field32_t ETHERNET_MAC_MACDR_RPESTS                      = {.msk = 0x00000001U, .pos = 0};  /** @brief RPESTS. */
+static const field32_t ETHERNET_MAC_MACDR_RFCFCSTS                    = {.msk = 0x00000006U, .pos = 1};  /** @brief RFCFCSTS. */
+static const field32_t ETHERNET_MAC_MACDR_TPESTS                      = {.msk = 0x00010000U, .pos = 16}; /** @brief TPESTS. */
+static const field32_t ETHERNET_MAC_MACDR_TFCSTS                      = {.msk = 0x00060000U, .pos = 17}; /** @brief TFCSTS. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3PEN1                 = {.msk = 0x00000001U, .pos = 0};  /** @brief L3PEN1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3SAM1                 = {.msk = 0x00000004U, .pos = 2};  /** @brief L3SAM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3SAIM1                = {.msk = 0x00000008U, .pos = 3};  /** @brief L3SAIM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3DAM1                 = {.msk = 0x00000010U, .pos = 4};  /** @brief L3DAM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3DAIM1                = {.msk = 0x00000020U, .pos = 5};  /** @brief L3DAIM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3HSBM1                = {.msk = 0x000007C0U, .pos = 6};  /** @brief L3HSBM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L3HDBM1                = {.msk = 0x0000F800U, .pos = 11}; /** @brief L3HDBM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L4PEN1                 = {.msk = 0x00010000U, .pos = 16}; /** @brief L4PEN1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L4SPM1                 = {.msk = 0x00040000U, .pos = 18}; /** @brief L4SPM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L4SPIM1                = {.msk = 0x00080000U, .pos = 19}; /** @brief L4SPIM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L4DPM1                 = {.msk = 0x00100000U, .pos = 20}; /** @brief L4DPM1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_L4DPIM1                = {.msk = 0x00200000U, .pos = 21}; /** @brief L4DPIM1. */
+static const field32_t ETHERNET_MAC_MACL4A1R_L4SP1                    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief L4SP1. */
+static const field32_t ETHERNET_MAC_MACL4A1R_L4DP1                    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief L4DP1. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSENA                     = {.msk = 0x00000001U, .pos = 0};  /** @brief TSENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSCFUPDT                  = {.msk = 0x00000002U, .pos = 1};  /** @brief TSCFUPDT. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSINIT                    = {.msk = 0x00000004U, .pos = 2};  /** @brief TSINIT. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSUPDT                    = {.msk = 0x00000008U, .pos = 3};  /** @brief TSUPDT. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSADDREG                  = {.msk = 0x00000020U, .pos = 5};  /** @brief TSADDREG. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSENALL                   = {.msk = 0x00000100U, .pos = 8};  /** @brief TSENALL. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSCTRLSSR                 = {.msk = 0x00000200U, .pos = 9};  /** @brief TSCTRLSSR. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSVER2ENA                 = {.msk = 0x00000400U, .pos = 10}; /** @brief TSVER2ENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSIPENA                   = {.msk = 0x00000800U, .pos = 11}; /** @brief TSIPENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSIPV6ENA                 = {.msk = 0x00001000U, .pos = 12}; /** @brief TSIPV6ENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSIPV4ENA                 = {.msk = 0x00002000U, .pos = 13}; /** @brief TSIPV4ENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSEVNTENA                 = {.msk = 0x00004000U, .pos = 14}; /** @brief TSEVNTENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSMSTRENA                 = {.msk = 0x00008000U, .pos = 15}; /** @brief TSMSTRENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_SNAPTYPSEL                = {.msk = 0x00030000U, .pos = 16}; /** @brief SNAPTYPSEL. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSENMACADDR               = {.msk = 0x00040000U, .pos = 18}; /** @brief TSENMACADDR. */
+static const field32_t ETHERNET_MAC_MACTSCR_CSC                       = {.msk = 0x00080000U, .pos = 19}; /** @brief CSC. */
+static const field32_t ETHERNET_MAC_MACTSCR_TXTSSTSM                  = {.msk = 0x01000000U, .pos = 24}; /** @brief TXTSSTSM. */
+static const field32_t ETHERNET_MAC_MACSSIR_SNSINC                    = {.msk = 0x0000FF00U, .pos = 8};  /** @brief SNSINC. */
+static const field32_t ETHERNET_MAC_MACSSIR_SSINC                     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief SSINC. */
+static const field32_t ETHERNET_MAC_MACSTNR_TSSS                      = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief TSSS. */
+static const field32_t ETHERNET_MAC_MACSTNUR_TSSS                     = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief TSSS. */
+static const field32_t ETHERNET_MAC_MACSTNUR_ADDSUB                   = {.msk = 0x80000000U, .pos = 31}; /** @brief ADDSUB. */
+static const field32_t ETHERNET_MAC_MACTSSR_TSSOVF                    = {.msk = 0x00000001U, .pos = 0};  /** @brief TSSOVF. */
+static const field32_t ETHERNET_MAC_MACTSSR_TSTARGT0                  = {.msk = 0x00000002U, .pos = 1};  /** @brief TSTARGT0. */
+static const field32_t ETHERNET_MAC_MACTSSR_AUXTSTRIG                 = {.msk = 0x00000004U, .pos = 2};  /** @brief AUXTSTRIG. */
+static const field32_t ETHERNET_MAC_MACTSSR_TSTRGTERR0                = {.msk = 0x00000008U, .pos = 3};  /** @brief TSTRGTERR0. */
+static const field32_t ETHERNET_MAC_MACTSSR_TXTSSIS                   = {.msk = 0x00008000U, .pos = 15}; /** @brief TXTSSIS. */
+static const field32_t ETHERNET_MAC_MACTSSR_ATSSTN                    = {.msk = 0x000F0000U, .pos = 16}; /** @brief ATSSTN. */
+static const field32_t ETHERNET_MAC_MACTSSR_ATSSTM                    = {.msk = 0x01000000U, .pos = 24}; /** @brief ATSSTM. */
+static const field32_t ETHERNET_MAC_MACTSSR_ATSNS                     = {.msk = 0x3E000000U, .pos = 25}; /** @brief ATSNS. */
+static const field32_t ETHERNET_MAC_MACTXTSSNR_TXTSSLO                = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief TXTSSLO. */
+static const field32_t ETHERNET_MAC_MACTXTSSNR_TXTSSMIS               = {.msk = 0x80000000U, .pos = 31}; /** @brief TXTSSMIS. */
+static const field32_t ETHERNET_MAC_MACACR_ATSFC                      = {.msk = 0x00000001U, .pos = 0};  /** @brief ATSFC. */
+static const field32_t ETHERNET_MAC_MACACR_ATSEN0                     = {.msk = 0x00000010U, .pos = 4};  /** @brief ATSEN0. */
+static const field32_t ETHERNET_MAC_MACACR_ATSEN1                     = {.msk = 0x00000020U, .pos = 5};  /** @brief ATSEN1. */
+static const field32_t ETHERNET_MAC_MACACR_ATSEN2                     = {.msk = 0x00000040U, .pos = 6};  /** @brief ATSEN2. */
+static const field32_t ETHERNET_MAC_MACACR_ATSEN3                     = {.msk = 0x00000080U, .pos = 7};  /** @brief ATSEN3. */
+static const field32_t ETHERNET_MAC_MACATSNR_AUXTSLO                  = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief AUXTSLO. */
+static const field32_t ETHERNET_MAC_MACPPSCR_PPSCTRL                  = {.msk = 0x0000000FU, .pos = 0};  /** @brief PPSCTRL. */
+static const field32_t ETHERNET_MAC_MACPPSCR_PPSEN0                   = {.msk = 0x00000010U, .pos = 4};  /** @brief PPSEN0. */
+static const field32_t ETHERNET_MAC_MACPPSCR_TRGTMODSEL0              = {.msk = 0x00000060U, .pos = 5};  /** @brief TRGTMODSEL0. */
+static const field32_t ETHERNET_MAC_MACPPSTTSR_TSTRH0                 = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief TSTRH0. */
+static const field32_t ETHERNET_MAC_MACPPSTTNR_TTSL0                  = {.msk = 0x7FFFFFFFU, .pos = 0};  /** @brief TTSL0. */
+static const field32_t ETHERNET_MAC_MACPPSTTNR_TRGTBUSY0              = {.msk = 0x80000000U, .pos = 31}; /** @brief TRGTBUSY0. */
+static const field32_t ETHERNET_MAC_MACPOCR_PTOEN                     = {.msk = 0x00000001U, .pos = 0};  /** @brief PTOEN. */
+static const field32_t ETHERNET_MAC_MACPOCR_ASYNCEN                   = {.msk = 0x00000002U, .pos = 1};  /** @brief ASYNCEN. */
+static const field32_t ETHERNET_MAC_MACPOCR_APDREQEN                  = {.msk = 0x00000004U, .pos = 2};  /** @brief APDREQEN. */
+static const field32_t ETHERNET_MAC_MACPOCR_ASYNCTRIG                 = {.msk = 0x00000010U, .pos = 4};  /** @brief ASYNCTRIG. */
+static const field32_t ETHERNET_MAC_MACPOCR_APDREQTRIG                = {.msk = 0x00000020U, .pos = 5};  /** @brief APDREQTRIG. */
+static const field32_t ETHERNET_MAC_MACPOCR_DRRDIS                    = {.msk = 0x00000040U, .pos = 6};  /** @brief DRRDIS. */
+static const field32_t ETHERNET_MAC_MACPOCR_DN                        = {.msk = 0x0000FF00U, .pos = 8};  /** @brief DN. */
+static const field32_t ETHERNET_MAC_MACSPI2R_SPI2                     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief SPI2. */
+static const field32_t ETHERNET_MAC_MACLMIR_LSI                       = {.msk = 0x000000FFU, .pos = 0};  /** @brief LSI. */
+static const field32_t ETHERNET_MAC_MACLMIR_DRSYNCR                   = {.msk = 0x00000700U, .pos = 8};  /** @brief DRSYNCR. */
+static const field32_t ETHERNET_MAC_MACLMIR_LMPDRI                    = {.msk = 0xFF000000U, .pos = 24}; /** @brief LMPDRI. */
+
+/** @subsection Enumerated ETHERNET_MAC Register Field Definitions */
+
+/** @brief L3PEN0. */
+static const field32_t ETHERNET_MAC_MACL3L4C0R_LxPEN0[5] = {
+  [3] = {.msk = 0x00000001U, .pos = 0},
+  [4] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief L3PEN1. */
+static const field32_t ETHERNET_MAC_MACL3L4C1R_LxPEN1[5] = {
+  [3] = {.msk = 0x00000001U, .pos = 0},
+  [4] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief TSIPV4ENA. */
+static const field32_t ETHERNET_MAC_MACTSCR_TSIPVxENA[7] = {
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [6] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief ATSEN0. */
+static const field32_t ETHERNET_MAC_MACACR_ATSENx[4] = {
+  [0] = {.msk = 0x00000010U, .pos = 4},
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000080U, .pos = 7},
+};
@@ -0,0 +1,763 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/exti.h
+ * @authors UW SARP
+ * @brief Registers and fields of EXTI.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section EXTI Definitions
+ **************************************************************************************************/
+
+/** @subsection EXTI Register Definitions */
+
+static rw_reg32_t const EXTI_RTSR1   = (rw_reg32_t)0x58000000U; /** @brief EXTI rising trigger selection register. */
+static rw_reg32_t const EXTI_FTSR1   = (rw_reg32_t)0x58000004U; /** @brief EXTI falling trigger selection register. */
+static rw_reg32_t const EXTI_SWIER1  = (rw_reg32_t)0x58000008U; /** @brief EXTI software interrupt event register. */
+static rw_reg32_t const EXTI_D3PMR1  = (rw_reg32_t)0x5800000CU; /** @brief EXTI D3 pending mask register. */
+static rw_reg32_t const EXTI_D3PCR1L = (rw_reg32_t)0x58000010U; /** @brief EXTI D3 pending clear selection register low. */
+static rw_reg32_t const EXTI_D3PCR1H = (rw_reg32_t)0x58000014U; /** @brief EXTI D3 pending clear selection register high. */
+static rw_reg32_t const EXTI_RTSR2   = (rw_reg32_t)0x58000020U; /** @brief EXTI rising trigger selection register. */
+static rw_reg32_t const EXTI_FTSR2   = (rw_reg32_t)0x58000024U; /** @brief EXTI falling trigger selection register. */
+static rw_reg32_t const EXTI_SWIER2  = (rw_reg32_t)0x58000028U; /** @brief EXTI software interrupt event register. */
+static rw_reg32_t const EXTI_D3PMR2  = (rw_reg32_t)0x5800002CU; /** @brief EXTI D3 pending mask register. */
+static rw_reg32_t const EXTI_D3PCR2L = (rw_reg32_t)0x58000030U; /** @brief EXTI D3 pending clear selection register low. */
+static rw_reg32_t const EXTI_D3PCR2H = (rw_reg32_t)0x58000034U; /** @brief EXTI D3 pending clear selection register high. */
+static rw_reg32_t const EXTI_RTSR3   = (rw_reg32_t)0x58000040U; /** @brief EXTI rising trigger selection register. */
+static rw_reg32_t const EXTI_FTSR3   = (rw_reg32_t)0x58000044U; /** @brief EXTI falling trigger selection register. */
+static rw_reg32_t const EXTI_SWIER3  = (rw_reg32_t)0x58000048U; /** @brief EXTI software interrupt event register. */
+static rw_reg32_t const EXTI_D3PMR3  = (rw_reg32_t)0x5800004CU; /** @brief EXTI D3 pending mask register. */
+static rw_reg32_t const EXTI_D3PCR3H = (rw_reg32_t)0x58000054U; /** @brief EXTI D3 pending clear selection register high. */
+static rw_reg32_t const EXTI_CPUIMR1 = (rw_reg32_t)0x58000080U; /** @brief EXTI interrupt mask register. */
+static rw_reg32_t const EXTI_CPUEMR1 = (rw_reg32_t)0x58000084U; /** @brief EXTI event mask register. */
+static rw_reg32_t const EXTI_CPUPR1  = (rw_reg32_t)0x58000088U; /** @brief EXTI pending register. */
+static rw_reg32_t const EXTI_CPUIMR2 = (rw_reg32_t)0x58000090U; /** @brief EXTI interrupt mask register. */
+static rw_reg32_t const EXTI_CPUEMR2 = (rw_reg32_t)0x58000094U; /** @brief EXTI event mask register. */
+static ro_reg32_t const EXTI_CPUPR2  = (ro_reg32_t)0x58000098U; /** @brief EXTI pending register. */
+static ro_reg32_t const EXTI_CPUIMR3 = (ro_reg32_t)0x580000A0U; /** @brief EXTI interrupt mask register. */
+static ro_reg32_t const EXTI_CPUEMR3 = (ro_reg32_t)0x580000A4U; /** @brief EXTI event mask register. */
+static ro_reg32_t const EXTI_CPUPR3  = (ro_reg32_t)0x580000A8U; /** @brief EXTI pending register. */
+
+/** @subsection EXTI Register Field Definitions */
+
+static const field32_t EXTI_RTSR1_TR0      = {.msk = 0x00000001U, .pos = 0};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR1      = {.msk = 0x00000002U, .pos = 1};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR2      = {.msk = 0x00000004U, .pos = 2};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR3      = {.msk = 0x00000008U, .pos = 3};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR4      = {.msk = 0x00000010U, .pos = 4};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR5      = {.msk = 0x00000020U, .pos = 5};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR6      = {.msk = 0x00000040U, .pos = 6};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR7      = {.msk = 0x00000080U, .pos = 7};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR8      = {.msk = 0x00000100U, .pos = 8};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR9      = {.msk = 0x00000200U, .pos = 9};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR10     = {.msk = 0x00000400U, .pos = 10}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR11     = {.msk = 0x00000800U, .pos = 11}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR12     = {.msk = 0x00001000U, .pos = 12}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR13     = {.msk = 0x00002000U, .pos = 13}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR14     = {.msk = 0x00004000U, .pos = 14}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR15     = {.msk = 0x00008000U, .pos = 15}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR16     = {.msk = 0x00010000U, .pos = 16}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR17     = {.msk = 0x00020000U, .pos = 17}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR18     = {.msk = 0x00040000U, .pos = 18}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR19     = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR20     = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TR21     = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR0      = {.msk = 0x00000001U, .pos = 0};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR1      = {.msk = 0x00000002U, .pos = 1};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR2      = {.msk = 0x00000004U, .pos = 2};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR3      = {.msk = 0x00000008U, .pos = 3};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR4      = {.msk = 0x00000010U, .pos = 4};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR5      = {.msk = 0x00000020U, .pos = 5};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR6      = {.msk = 0x00000040U, .pos = 6};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR7      = {.msk = 0x00000080U, .pos = 7};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR8      = {.msk = 0x00000100U, .pos = 8};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR9      = {.msk = 0x00000200U, .pos = 9};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR10     = {.msk = 0x00000400U, .pos = 10}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR11     = {.msk = 0x00000800U, .pos = 11}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR12     = {.msk = 0x00001000U, .pos = 12}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR13     = {.msk = 0x00002000U, .pos = 13}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR14     = {.msk = 0x00004000U, .pos = 14}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR15     = {.msk = 0x00008000U, .pos = 15}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR16     = {.msk = 0x00010000U, .pos = 16}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR17     = {.msk = 0x00020000U, .pos = 17}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR18     = {.msk = 0x00040000U, .pos = 18}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR19     = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR20     = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TR21     = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER0  = {.msk = 0x00000001U, .pos = 0};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER1  = {.msk = 0x00000002U, .pos = 1};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER2  = {.msk = 0x00000004U, .pos = 2};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER3  = {.msk = 0x00000008U, .pos = 3};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER4  = {.msk = 0x00000010U, .pos = 4};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER5  = {.msk = 0x00000020U, .pos = 5};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER6  = {.msk = 0x00000040U, .pos = 6};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER7  = {.msk = 0x00000080U, .pos = 7};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER8  = {.msk = 0x00000100U, .pos = 8};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER9  = {.msk = 0x00000200U, .pos = 9};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER10 = {.msk = 0x00000400U, .pos = 10}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER11 = {.msk = 0x00000800U, .pos = 11}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER12 = {.msk = 0x00001000U, .pos = 12}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER13 = {.msk = 0x00002000U, .pos = 13}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER14 = {.msk = 0x00004000U, .pos = 14}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER15 = {.msk = 0x00008000U, .pos = 15}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER16 = {.msk = 0x00010000U, .pos = 16}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER17 = {.msk = 0x00020000U, .pos = 17}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER18 = {.msk = 0x00040000U, .pos = 18}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER19 = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER20 = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIER21 = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR0     = {.msk = 0x00000001U, .pos = 0};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR1     = {.msk = 0x00000002U, .pos = 1};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR2     = {.msk = 0x00000004U, .pos = 2};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR3     = {.msk = 0x00000008U, .pos = 3};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR4     = {.msk = 0x00000010U, .pos = 4};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR5     = {.msk = 0x00000020U, .pos = 5};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR6     = {.msk = 0x00000040U, .pos = 6};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR7     = {.msk = 0x00000080U, .pos = 7};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR8     = {.msk = 0x00000100U, .pos = 8};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR9     = {.msk = 0x00000200U, .pos = 9};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR10    = {.msk = 0x00000400U, .pos = 10}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR11    = {.msk = 0x00000800U, .pos = 11}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR12    = {.msk = 0x00001000U, .pos = 12}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR13    = {.msk = 0x00002000U, .pos = 13}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR14    = {.msk = 0x00004000U, .pos = 14}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR15    = {.msk = 0x00008000U, .pos = 15}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR19    = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR20    = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR21    = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MR25    = {.msk = 0x02000000U, .pos = 25}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PCR1L_PCS0   = {.msk = 0x00000003U, .pos = 0};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS1   = {.msk = 0x0000000CU, .pos = 2};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS2   = {.msk = 0x00000030U, .pos = 4};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS3   = {.msk = 0x000000C0U, .pos = 6};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS4   = {.msk = 0x00000300U, .pos = 8};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS5   = {.msk = 0x00000C00U, .pos = 10}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS6   = {.msk = 0x00003000U, .pos = 12}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS7   = {.msk = 0x0000C000U, .pos = 14}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS8   = {.msk = 0x00030000U, .pos = 16}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS9   = {.msk = 0x000C0000U, .pos = 18}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS10  = {.msk = 0x00300000U, .pos = 20}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS11  = {.msk = 0x00C00000U, .pos = 22}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS12  = {.msk = 0x03000000U, .pos = 24}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS13  = {.msk = 0x0C000000U, .pos = 26}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS14  = {.msk = 0x30000000U, .pos = 28}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCS15  = {.msk = 0xC0000000U, .pos = 30}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1H_PCS19  = {.msk = 0x000000C0U, .pos = 6};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+32)/2). */
+static const field32_t EXTI_D3PCR1H_PCS20  = {.msk = 0x00000300U, .pos = 8};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+32)/2). */
+static const field32_t EXTI_D3PCR1H_PCS21  = {.msk = 0x00000C00U, .pos = 10}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+32)/2). */
+static const field32_t EXTI_D3PCR1H_PCS25  = {.msk = 0x000C0000U, .pos = 18}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+32)/2). */
+static const field32_t EXTI_RTSR2_TR49     = {.msk = 0x00020000U, .pos = 17}; /** @brief Rising trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_RTSR2_TR51     = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_FTSR2_TR49     = {.msk = 0x00020000U, .pos = 17}; /** @brief Falling trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_FTSR2_TR51     = {.msk = 0x00080000U, .pos = 19}; /** @brief Falling trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_SWIER2_SWIER49 = {.msk = 0x00020000U, .pos = 17}; /** @brief Software interrupt on line x+32. */
+static const field32_t EXTI_SWIER2_SWIER51 = {.msk = 0x00080000U, .pos = 19}; /** @brief Software interrupt on line x+32. */
+static const field32_t EXTI_D3PMR2_MR34    = {.msk = 0x00000004U, .pos = 2};  /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR35    = {.msk = 0x00000008U, .pos = 3};  /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR41    = {.msk = 0x00000200U, .pos = 9};  /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR48    = {.msk = 0x00010000U, .pos = 16}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR49    = {.msk = 0x00020000U, .pos = 17}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR50    = {.msk = 0x00040000U, .pos = 18}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR51    = {.msk = 0x00080000U, .pos = 19}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR52    = {.msk = 0x00100000U, .pos = 20}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MR53    = {.msk = 0x00200000U, .pos = 21}; /** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PCR2L_PCS35  = {.msk = 0x000000C0U, .pos = 6};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+64)/2). */
+static const field32_t EXTI_D3PCR2L_PCS34  = {.msk = 0x00000030U, .pos = 4};  /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+64)/2). */
+static const field32_t EXTI_D3PCR2L_PCS41  = {.msk = 0x000C0000U, .pos = 18}; /** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+64)/2). */
+static const field32_t EXTI_D3PCR2H_PCS48  = {.msk = 0x00000003U, .pos = 0};  /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCS49  = {.msk = 0x0000000CU, .pos = 2};  /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCS50  = {.msk = 0x00000030U, .pos = 4};  /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCS51  = {.msk = 0x000000C0U, .pos = 6};  /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCS52  = {.msk = 0x00000300U, .pos = 8};  /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCS53  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_RTSR3_TR82     = {.msk = 0x00040000U, .pos = 18}; /** @brief Rising trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_RTSR3_TR84     = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_RTSR3_TR85     = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_RTSR3_TR86     = {.msk = 0x00400000U, .pos = 22}; /** @brief Rising trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_FTSR3_TR82     = {.msk = 0x00040000U, .pos = 18}; /** @brief Falling trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_FTSR3_TR84     = {.msk = 0x00100000U, .pos = 20}; /** @brief Falling trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_FTSR3_TR85     = {.msk = 0x00200000U, .pos = 21}; /** @brief Falling trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_FTSR3_TR86     = {.msk = 0x00400000U, .pos = 22}; /** @brief Falling trigger event configuration bit of Configurable Event input x+64. */
+static const field32_t EXTI_SWIER3_SWIER82 = {.msk = 0x00040000U, .pos = 18}; /** @brief Software interrupt on line x+64. */
+static const field32_t EXTI_SWIER3_SWIER84 = {.msk = 0x00100000U, .pos = 20}; /** @brief Software interrupt on line x+64. */
+static const field32_t EXTI_SWIER3_SWIER85 = {.msk = 0x00200000U, .pos = 21}; /** @brief Software interrupt on line x+64. */
+static const field32_t EXTI_SWIER3_SWIER86 = {.msk = 0x00400000U, .pos = 22}; /** @brief Software interrupt on line x+64. */
+static const field32_t EXTI_D3PMR3_MR88    = {.msk = 0x01000000U, .pos = 24}; /** @brief D3 Pending Mask on Event input x+64. */
+static const field32_t EXTI_D3PCR3H_PCS88  = {.msk = 0x000C0000U, .pos = 18}; /** @brief D3 Pending request clear input signal selection on Event input x= truncate N+160/2. */
+static const field32_t EXTI_CPUIMR1_MR0    = {.msk = 0x00000001U, .pos = 0};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR1    = {.msk = 0x00000002U, .pos = 1};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR2    = {.msk = 0x00000004U, .pos = 2};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR3    = {.msk = 0x00000008U, .pos = 3};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR4    = {.msk = 0x00000010U, .pos = 4};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR5    = {.msk = 0x00000020U, .pos = 5};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR6    = {.msk = 0x00000040U, .pos = 6};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR7    = {.msk = 0x00000080U, .pos = 7};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR8    = {.msk = 0x00000100U, .pos = 8};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR9    = {.msk = 0x00000200U, .pos = 9};  /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR10   = {.msk = 0x00000400U, .pos = 10}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR11   = {.msk = 0x00000800U, .pos = 11}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR12   = {.msk = 0x00001000U, .pos = 12}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR13   = {.msk = 0x00002000U, .pos = 13}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR14   = {.msk = 0x00004000U, .pos = 14}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR15   = {.msk = 0x00008000U, .pos = 15}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR16   = {.msk = 0x00010000U, .pos = 16}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR17   = {.msk = 0x00020000U, .pos = 17}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR18   = {.msk = 0x00040000U, .pos = 18}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR19   = {.msk = 0x00080000U, .pos = 19}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR20   = {.msk = 0x00100000U, .pos = 20}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR21   = {.msk = 0x00200000U, .pos = 21}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR22   = {.msk = 0x00400000U, .pos = 22}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR23   = {.msk = 0x00800000U, .pos = 23}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR24   = {.msk = 0x01000000U, .pos = 24}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR25   = {.msk = 0x02000000U, .pos = 25}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR26   = {.msk = 0x04000000U, .pos = 26}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR27   = {.msk = 0x08000000U, .pos = 27}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR28   = {.msk = 0x10000000U, .pos = 28}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR29   = {.msk = 0x20000000U, .pos = 29}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR30   = {.msk = 0x40000000U, .pos = 30}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MR31   = {.msk = 0x80000000U, .pos = 31}; /** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUEMR1_MR0    = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR1    = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR2    = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR3    = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR4    = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR5    = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR6    = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR7    = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR8    = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR9    = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR10   = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR11   = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR12   = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR13   = {.msk = 0x00002000U, .pos = 13}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR14   = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR15   = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR16   = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR17   = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR18   = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR19   = {.msk = 0x00080000U, .pos = 19}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR20   = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR21   = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR22   = {.msk = 0x00400000U, .pos = 22}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR23   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR24   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR25   = {.msk = 0x02000000U, .pos = 25}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR26   = {.msk = 0x04000000U, .pos = 26}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR27   = {.msk = 0x08000000U, .pos = 27}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR28   = {.msk = 0x10000000U, .pos = 28}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR29   = {.msk = 0x20000000U, .pos = 29}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR30   = {.msk = 0x40000000U, .pos = 30}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MR31   = {.msk = 0x80000000U, .pos = 31}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR0     = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR1     = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR2     = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR3     = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR4     = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR5     = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR6     = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR7     = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR8     = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR9     = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR10    = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR11    = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR12    = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR13    = {.msk = 0x00002000U, .pos = 13}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR14    = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR15    = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR16    = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR17    = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR18    = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR19    = {.msk = 0x00080000U, .pos = 19}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR20    = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PR21    = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUIMR2_MR0    = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR1    = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR2    = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR3    = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR4    = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR5    = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR6    = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR7    = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR8    = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR9    = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR10   = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR11   = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR12   = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR14   = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR15   = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR16   = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR17   = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR18   = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR19   = {.msk = 0x00080000U, .pos = 19}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR20   = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR21   = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR22   = {.msk = 0x00400000U, .pos = 22}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR23   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR24   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR25   = {.msk = 0x02000000U, .pos = 25}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR26   = {.msk = 0x04000000U, .pos = 26}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR27   = {.msk = 0x08000000U, .pos = 27}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR28   = {.msk = 0x10000000U, .pos = 28}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR29   = {.msk = 0x20000000U, .pos = 29}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR30   = {.msk = 0x40000000U, .pos = 30}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MR31   = {.msk = 0x80000000U, .pos = 31}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR32   = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR33   = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR34   = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR35   = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR36   = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR37   = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR38   = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR39   = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR40   = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR41   = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR42   = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR43   = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR44   = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR46   = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR47   = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR48   = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR49   = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR50   = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR51   = {.msk = 0x00080000U, .pos = 19}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR52   = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR53   = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR54   = {.msk = 0x00400000U, .pos = 22}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR55   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR56   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR57   = {.msk = 0x02000000U, .pos = 25}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR58   = {.msk = 0x04000000U, .pos = 26}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR59   = {.msk = 0x08000000U, .pos = 27}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR60   = {.msk = 0x10000000U, .pos = 28}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR61   = {.msk = 0x20000000U, .pos = 29}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR62   = {.msk = 0x40000000U, .pos = 30}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MR63   = {.msk = 0x80000000U, .pos = 31}; /** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUPR2_PR49    = {.msk = 0x00020000U, .pos = 17}; /** @brief Configurable event inputs x+32 Pending bit. */
+static const field32_t EXTI_CPUPR2_PR51    = {.msk = 0x00080000U, .pos = 19}; /** @brief Configurable event inputs x+32 Pending bit. */
+static const field32_t EXTI_CPUIMR3_MR64   = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR65   = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR66   = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR67   = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR68   = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR69   = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR70   = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR71   = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR72   = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR73   = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR74   = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR75   = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR76   = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR77   = {.msk = 0x00002000U, .pos = 13}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR78   = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR79   = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR80   = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR82   = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR84   = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR85   = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR86   = {.msk = 0x00400000U, .pos = 22}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR87   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUIMR3_MR88   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPU Interrupt Mask on Direct Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR64   = {.msk = 0x00000001U, .pos = 0};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR65   = {.msk = 0x00000002U, .pos = 1};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR66   = {.msk = 0x00000004U, .pos = 2};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR67   = {.msk = 0x00000008U, .pos = 3};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR68   = {.msk = 0x00000010U, .pos = 4};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR69   = {.msk = 0x00000020U, .pos = 5};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR70   = {.msk = 0x00000040U, .pos = 6};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR71   = {.msk = 0x00000080U, .pos = 7};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR72   = {.msk = 0x00000100U, .pos = 8};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR73   = {.msk = 0x00000200U, .pos = 9};  /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR74   = {.msk = 0x00000400U, .pos = 10}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR75   = {.msk = 0x00000800U, .pos = 11}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR76   = {.msk = 0x00001000U, .pos = 12}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR77   = {.msk = 0x00002000U, .pos = 13}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR78   = {.msk = 0x00004000U, .pos = 14}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR79   = {.msk = 0x00008000U, .pos = 15}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR80   = {.msk = 0x00010000U, .pos = 16}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR82   = {.msk = 0x00040000U, .pos = 18}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR84   = {.msk = 0x00100000U, .pos = 20}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR85   = {.msk = 0x00200000U, .pos = 21}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR86   = {.msk = 0x00400000U, .pos = 22}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR87   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUEMR3_MR88   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPU Event mask on Event input x+64. */
+static const field32_t EXTI_CPUPR3_PR82    = {.msk = 0x00040000U, .pos = 18}; /** @brief Configurable event inputs x+64 Pending bit. */
+static const field32_t EXTI_CPUPR3_PR84    = {.msk = 0x00100000U, .pos = 20}; /** @brief Configurable event inputs x+64 Pending bit. */
+static const field32_t EXTI_CPUPR3_PR85    = {.msk = 0x00200000U, .pos = 21}; /** @brief Configurable event inputs x+64 Pending bit. */
+static const field32_t EXTI_CPUPR3_PR86    = {.msk = 0x00400000U, .pos = 22}; /** @brief Configurable event inputs x+64 Pending bit. */
+
+/** @subsection Enumerated EXTI Register Field Definitions */
+
+/** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_RTSR1_TRx[22] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_FTSR1_TRx[22] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_SWIER1_SWIERx[22] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_D3PMR1_MRx[26] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+  [25] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief D3 Pending request clear input signal selection on Event input x = truncate (n/2). */
+static const field32_t EXTI_D3PCR1L_PCSx[16] = {
+  [0]  = {.msk = 0x00000003U, .pos = 0},
+  [1]  = {.msk = 0x0000000CU, .pos = 2},
+  [2]  = {.msk = 0x00000030U, .pos = 4},
+  [3]  = {.msk = 0x000000C0U, .pos = 6},
+  [4]  = {.msk = 0x00000300U, .pos = 8},
+  [5]  = {.msk = 0x00000C00U, .pos = 10},
+  [6]  = {.msk = 0x00003000U, .pos = 12},
+  [7]  = {.msk = 0x0000C000U, .pos = 14},
+  [8]  = {.msk = 0x00030000U, .pos = 16},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x00300000U, .pos = 20},
+  [11] = {.msk = 0x00C00000U, .pos = 22},
+  [12] = {.msk = 0x03000000U, .pos = 24},
+  [13] = {.msk = 0x0C000000U, .pos = 26},
+  [14] = {.msk = 0x30000000U, .pos = 28},
+  [15] = {.msk = 0xC0000000U, .pos = 30},
+};
+
+/** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+32)/2). */
+static const field32_t EXTI_D3PCR1H_PCSx[26] = {
+  [19] = {.msk = 0x000000C0U, .pos = 6},
+  [20] = {.msk = 0x00000300U, .pos = 8},
+  [21] = {.msk = 0x00000C00U, .pos = 10},
+  [25] = {.msk = 0x000C0000U, .pos = 18},
+};
+
+/** @brief Rising trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_RTSR2_TRx[52] = {
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Falling trigger event configuration bit of Configurable Event input x+32. */
+static const field32_t EXTI_FTSR2_TRx[52] = {
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Software interrupt on line x+32. */
+static const field32_t EXTI_SWIER2_SWIERx[52] = {
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief D3 Pending Mask on Event input x+32. */
+static const field32_t EXTI_D3PMR2_MRx[54] = {
+  [34] = {.msk = 0x00000004U, .pos = 2},
+  [35] = {.msk = 0x00000008U, .pos = 3},
+  [41] = {.msk = 0x00000200U, .pos = 9},
+  [48] = {.msk = 0x00010000U, .pos = 16},
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [50] = {.msk = 0x00040000U, .pos = 18},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+  [52] = {.msk = 0x00100000U, .pos = 20},
+  [53] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief D3 Pending request clear input signal selection on Event input x = truncate ((n+64)/2). */
+static const field32_t EXTI_D3PCR2L_PCSx[42] = {
+  [34] = {.msk = 0x00000030U, .pos = 4},
+  [35] = {.msk = 0x000000C0U, .pos = 6},
+  [41] = {.msk = 0x000C0000U, .pos = 18},
+};
+
+/** @brief Pending request clear input signal selection on Event input x= truncate ((n+96)/2). */
+static const field32_t EXTI_D3PCR2H_PCSx[54] = {
+  [48] = {.msk = 0x00000003U, .pos = 0},
+  [49] = {.msk = 0x0000000CU, .pos = 2},
+  [50] = {.msk = 0x00000030U, .pos = 4},
+  [51] = {.msk = 0x000000C0U, .pos = 6},
+  [52] = {.msk = 0x00000300U, .pos = 8},
+  [53] = {.msk = 0x00000C00U, .pos = 10},
+};
+
+/** @brief Rising trigger event configuration bit of Configurable Event input. */
+static const field32_t EXTI_CPUIMR1_MRx[32] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+  [22] = {.msk = 0x00400000U, .pos = 22},
+  [23] = {.msk = 0x00800000U, .pos = 23},
+  [24] = {.msk = 0x01000000U, .pos = 24},
+  [25] = {.msk = 0x02000000U, .pos = 25},
+  [26] = {.msk = 0x04000000U, .pos = 26},
+  [27] = {.msk = 0x08000000U, .pos = 27},
+  [28] = {.msk = 0x10000000U, .pos = 28},
+  [29] = {.msk = 0x20000000U, .pos = 29},
+  [30] = {.msk = 0x40000000U, .pos = 30},
+  [31] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUEMR1_MRx[32] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+  [22] = {.msk = 0x00400000U, .pos = 22},
+  [23] = {.msk = 0x00800000U, .pos = 23},
+  [24] = {.msk = 0x01000000U, .pos = 24},
+  [25] = {.msk = 0x02000000U, .pos = 25},
+  [26] = {.msk = 0x04000000U, .pos = 26},
+  [27] = {.msk = 0x08000000U, .pos = 27},
+  [28] = {.msk = 0x10000000U, .pos = 28},
+  [29] = {.msk = 0x20000000U, .pos = 29},
+  [30] = {.msk = 0x40000000U, .pos = 30},
+  [31] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief CPU Event mask on Event input x. */
+static const field32_t EXTI_CPUPR1_PRx[22] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUIMR2_MRx[32] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+  [22] = {.msk = 0x00400000U, .pos = 22},
+  [23] = {.msk = 0x00800000U, .pos = 23},
+  [24] = {.msk = 0x01000000U, .pos = 24},
+  [25] = {.msk = 0x02000000U, .pos = 25},
+  [26] = {.msk = 0x04000000U, .pos = 26},
+  [27] = {.msk = 0x08000000U, .pos = 27},
+  [28] = {.msk = 0x10000000U, .pos = 28},
+  [29] = {.msk = 0x20000000U, .pos = 29},
+  [30] = {.msk = 0x40000000U, .pos = 30},
+  [31] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief CPU Interrupt Mask on Direct Event input x+32. */
+static const field32_t EXTI_CPUEMR2_MRx[64] = {
+  [32] = {.msk = 0x00000001U, .pos = 0},
+  [33] = {.msk = 0x00000002U, .pos = 1},
+  [34] = {.msk = 0x00000004U, .pos = 2},
+  [35] = {.msk = 0x00000008U, .pos = 3},
+  [36] = {.msk = 0x00000010U, .pos = 4},
+  [37] = {.msk = 0x00000020U, .pos = 5},
+  [38] = {.msk = 0x00000040U, .pos = 6},
+  [39] = {.msk = 0x00000080U, .pos = 7},
+  [40] = {.msk = 0x00000100U, .pos = 8},
+  [41] = {.msk = 0x00000200U, .pos = 9},
+  [42] = {.msk = 0x00000400U, .pos = 10},
+  [43] = {.msk = 0x00000800U, .pos = 11},
+  [44] = {.msk = 0x00001000U, .pos = 12},
+  [46] = {.msk = 0x00004000U, .pos = 14},
+  [47] = {.msk = 0x00008000U, .pos = 15},
+  [48] = {.msk = 0x00010000U, .pos = 16},
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [50] = {.msk = 0x00040000U, .pos = 18},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+  [52] = {.msk = 0x00100000U, .pos = 20},
+  [53] = {.msk = 0x00200000U, .pos = 21},
+  [54] = {.msk = 0x00400000U, .pos = 22},
+  [55] = {.msk = 0x00800000U, .pos = 23},
+  [56] = {.msk = 0x01000000U, .pos = 24},
+  [57] = {.msk = 0x02000000U, .pos = 25},
+  [58] = {.msk = 0x04000000U, .pos = 26},
+  [59] = {.msk = 0x08000000U, .pos = 27},
+  [60] = {.msk = 0x10000000U, .pos = 28},
+  [61] = {.msk = 0x20000000U, .pos = 29},
+  [62] = {.msk = 0x40000000U, .pos = 30},
+  [63] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Configurable event inputs x+32 Pending bit. */
+static const field32_t EXTI_CPUPR2_PRx[52] = {
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+};
@@ -0,0 +1,991 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/fdcanx.h
+ * @authors UW SARP
+ * @brief Registers and fields of FDCAN1, FDCAN2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section FDCANx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated FDCANx Register Definitions */
+
+/** @brief FDCAN Core Release Register. */
+static ro_reg32_t const FDCANx_FDCAN_CREL[3] = {
+  [1] = (ro_reg32_t)0x4000A000U,
+  [2] = (ro_reg32_t)0x4000A400U,
+};
+
+/** @brief FDCAN Core Release Register. */
+static ro_reg32_t const FDCANx_FDCAN_ENDN[3] = {
+  [1] = (ro_reg32_t)0x4000A004U,
+  [2] = (ro_reg32_t)0x4000A404U,
+};
+
+/** @brief FDCAN Data Bit Timing and Prescaler Register. */
+static ro_reg32_t const FDCANx_FDCAN_DBTP[3] = {
+  [1] = (ro_reg32_t)0x4000A00CU,
+  [2] = (ro_reg32_t)0x4000A40CU,
+};
+
+/** @brief FDCAN Test Register. */
+static ro_reg32_t const FDCANx_FDCAN_TEST[3] = {
+  [1] = (ro_reg32_t)0x4000A010U,
+  [2] = (ro_reg32_t)0x4000A410U,
+};
+
+/** @brief FDCAN RAM Watchdog Register. */
+static ro_reg32_t const FDCANx_FDCAN_RWD[3] = {
+  [1] = (ro_reg32_t)0x4000A014U,
+  [2] = (ro_reg32_t)0x4000A414U,
+};
+
+/** @brief FDCAN CC Control Register. */
+static rw_reg32_t const FDCANx_FDCAN_CCCR[3] = {
+  [1] = (rw_reg32_t)0x4000A018U,
+  [2] = (rw_reg32_t)0x4000A418U,
+};
+
+/** @brief FDCAN Nominal Bit Timing and Prescaler Register. */
+static rw_reg32_t const FDCANx_FDCAN_NBTP[3] = {
+  [1] = (rw_reg32_t)0x4000A01CU,
+  [2] = (rw_reg32_t)0x4000A41CU,
+};
+
+/** @brief FDCAN Timestamp Counter Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TSCC[3] = {
+  [1] = (rw_reg32_t)0x4000A020U,
+  [2] = (rw_reg32_t)0x4000A420U,
+};
+
+/** @brief FDCAN Timestamp Counter Value Register. */
+static rw_reg32_t const FDCANx_FDCAN_TSCV[3] = {
+  [1] = (rw_reg32_t)0x4000A024U,
+  [2] = (rw_reg32_t)0x4000A424U,
+};
+
+/** @brief FDCAN Timeout Counter Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TOCC[3] = {
+  [1] = (rw_reg32_t)0x4000A028U,
+  [2] = (rw_reg32_t)0x4000A428U,
+};
+
+/** @brief FDCAN Timeout Counter Value Register. */
+static rw_reg32_t const FDCANx_FDCAN_TOCV[3] = {
+  [1] = (rw_reg32_t)0x4000A02CU,
+  [2] = (rw_reg32_t)0x4000A42CU,
+};
+
+/** @brief FDCAN Error Counter Register. */
+static rw_reg32_t const FDCANx_FDCAN_ECR[3] = {
+  [1] = (rw_reg32_t)0x4000A040U,
+  [2] = (rw_reg32_t)0x4000A440U,
+};
+
+/** @brief FDCAN Protocol Status Register. */
+static rw_reg32_t const FDCANx_FDCAN_PSR[3] = {
+  [1] = (rw_reg32_t)0x4000A044U,
+  [2] = (rw_reg32_t)0x4000A444U,
+};
+
+/** @brief FDCAN Transmitter Delay Compensation Register. */
+static ro_reg32_t const FDCANx_FDCAN_TDCR[3] = {
+  [1] = (ro_reg32_t)0x4000A048U,
+  [2] = (ro_reg32_t)0x4000A448U,
+};
+
+/** @brief FDCAN Interrupt Register. */
+static ro_reg32_t const FDCANx_FDCAN_IR[3] = {
+  [1] = (ro_reg32_t)0x4000A050U,
+  [2] = (ro_reg32_t)0x4000A450U,
+};
+
+/** @brief FDCAN Interrupt Enable Register. */
+static ro_reg32_t const FDCANx_FDCAN_IE[3] = {
+  [1] = (ro_reg32_t)0x4000A054U,
+  [2] = (ro_reg32_t)0x4000A454U,
+};
+
+/** @brief FDCAN Interrupt Line Select Register. */
+static ro_reg32_t const FDCANx_FDCAN_ILS[3] = {
+  [1] = (ro_reg32_t)0x4000A058U,
+  [2] = (ro_reg32_t)0x4000A458U,
+};
+
+/** @brief FDCAN Interrupt Line Enable Register. */
+static rw_reg32_t const FDCANx_FDCAN_ILE[3] = {
+  [1] = (rw_reg32_t)0x4000A05CU,
+  [2] = (rw_reg32_t)0x4000A45CU,
+};
+
+/** @brief FDCAN Global Filter Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_GFC[3] = {
+  [1] = (rw_reg32_t)0x4000A080U,
+  [2] = (rw_reg32_t)0x4000A480U,
+};
+
+/** @brief FDCAN Standard ID Filter Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_SIDFC[3] = {
+  [1] = (rw_reg32_t)0x4000A084U,
+  [2] = (rw_reg32_t)0x4000A484U,
+};
+
+/** @brief FDCAN Extended ID Filter Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_XIDFC[3] = {
+  [1] = (rw_reg32_t)0x4000A088U,
+  [2] = (rw_reg32_t)0x4000A488U,
+};
+
+/** @brief FDCAN Extended ID and Mask Register. */
+static rw_reg32_t const FDCANx_FDCAN_XIDAM[3] = {
+  [1] = (rw_reg32_t)0x4000A090U,
+  [2] = (rw_reg32_t)0x4000A490U,
+};
+
+/** @brief FDCAN High Priority Message Status Register. */
+static ro_reg32_t const FDCANx_FDCAN_HPMS[3] = {
+  [1] = (ro_reg32_t)0x4000A094U,
+  [2] = (ro_reg32_t)0x4000A494U,
+};
+
+/** @brief FDCAN New Data 1 Register. */
+static ro_reg32_t const FDCANx_FDCAN_NDAT1[3] = {
+  [1] = (ro_reg32_t)0x4000A098U,
+  [2] = (ro_reg32_t)0x4000A498U,
+};
+
+/** @brief FDCAN New Data 2 Register. */
+static ro_reg32_t const FDCANx_FDCAN_NDAT2[3] = {
+  [1] = (ro_reg32_t)0x4000A09CU,
+  [2] = (ro_reg32_t)0x4000A49CU,
+};
+
+/** @brief FDCAN Rx FIFO 0 Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF0C[3] = {
+  [1] = (rw_reg32_t)0x4000A0A0U,
+  [2] = (rw_reg32_t)0x4000A4A0U,
+};
+
+/** @brief FDCAN Rx FIFO 0 Status Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF0S[3] = {
+  [1] = (rw_reg32_t)0x4000A0A4U,
+  [2] = (rw_reg32_t)0x4000A4A4U,
+};
+
+/** @brief CAN Rx FIFO 0 Acknowledge Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF0A[3] = {
+  [1] = (rw_reg32_t)0x4000A0A8U,
+  [2] = (rw_reg32_t)0x4000A4A8U,
+};
+
+/** @brief FDCAN Rx Buffer Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXBC[3] = {
+  [1] = (rw_reg32_t)0x4000A0ACU,
+  [2] = (rw_reg32_t)0x4000A4ACU,
+};
+
+/** @brief FDCAN Rx FIFO 1 Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF1C[3] = {
+  [1] = (rw_reg32_t)0x4000A0B0U,
+  [2] = (rw_reg32_t)0x4000A4B0U,
+};
+
+/** @brief FDCAN Rx FIFO 1 Status Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF1S[3] = {
+  [1] = (rw_reg32_t)0x4000A0B4U,
+  [2] = (rw_reg32_t)0x4000A4B4U,
+};
+
+/** @brief FDCAN Rx FIFO 1 Acknowledge Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXF1A[3] = {
+  [1] = (rw_reg32_t)0x4000A0B8U,
+  [2] = (rw_reg32_t)0x4000A4B8U,
+};
+
+/** @brief FDCAN Rx Buffer Element Size Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_RXESC[3] = {
+  [1] = (rw_reg32_t)0x4000A0BCU,
+  [2] = (rw_reg32_t)0x4000A4BCU,
+};
+
+/** @brief FDCAN Tx Buffer Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBC[3] = {
+  [1] = (rw_reg32_t)0x4000A0C0U,
+  [2] = (rw_reg32_t)0x4000A4C0U,
+};
+
+/** @brief FDCAN Tx FIFO/Queue Status Register. */
+static ro_reg32_t const FDCANx_FDCAN_TXFQS[3] = {
+  [1] = (ro_reg32_t)0x4000A0C4U,
+  [2] = (ro_reg32_t)0x4000A4C4U,
+};
+
+/** @brief FDCAN Tx Buffer Element Size Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXESC[3] = {
+  [1] = (rw_reg32_t)0x4000A0C8U,
+  [2] = (rw_reg32_t)0x4000A4C8U,
+};
+
+/** @brief FDCAN Tx Buffer Request Pending Register. */
+static ro_reg32_t const FDCANx_FDCAN_TXBRP[3] = {
+  [1] = (ro_reg32_t)0x4000A0CCU,
+  [2] = (ro_reg32_t)0x4000A4CCU,
+};
+
+/** @brief FDCAN Tx Buffer Add Request Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBAR[3] = {
+  [1] = (rw_reg32_t)0x4000A0D0U,
+  [2] = (rw_reg32_t)0x4000A4D0U,
+};
+
+/** @brief FDCAN Tx Buffer Cancellation Request Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBCR[3] = {
+  [1] = (rw_reg32_t)0x4000A0D4U,
+  [2] = (rw_reg32_t)0x4000A4D4U,
+};
+
+/** @brief FDCAN Tx Buffer Transmission Occurred Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBTO[3] = {
+  [1] = (rw_reg32_t)0x4000A0D8U,
+  [2] = (rw_reg32_t)0x4000A4D8U,
+};
+
+/** @brief FDCAN Tx Buffer Cancellation Finished Register. */
+static ro_reg32_t const FDCANx_FDCAN_TXBCF[3] = {
+  [1] = (ro_reg32_t)0x4000A0DCU,
+  [2] = (ro_reg32_t)0x4000A4DCU,
+};
+
+/** @brief FDCAN Tx Buffer Transmission Interrupt Enable Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBTIE[3] = {
+  [1] = (rw_reg32_t)0x4000A0E0U,
+  [2] = (rw_reg32_t)0x4000A4E0U,
+};
+
+/** @brief FDCAN Tx Buffer Cancellation Finished Interrupt Enable Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXBCIE[3] = {
+  [1] = (rw_reg32_t)0x4000A0E4U,
+  [2] = (rw_reg32_t)0x4000A4E4U,
+};
+
+/** @brief FDCAN Tx Event FIFO Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXEFC[3] = {
+  [1] = (rw_reg32_t)0x4000A0F0U,
+  [2] = (rw_reg32_t)0x4000A4F0U,
+};
+
+/** @brief FDCAN Tx Event FIFO Status Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXEFS[3] = {
+  [1] = (rw_reg32_t)0x4000A0F4U,
+  [2] = (rw_reg32_t)0x4000A4F4U,
+};
+
+/** @brief FDCAN Tx Event FIFO Acknowledge Register. */
+static rw_reg32_t const FDCANx_FDCAN_TXEFA[3] = {
+  [1] = (rw_reg32_t)0x4000A0F8U,
+  [2] = (rw_reg32_t)0x4000A4F8U,
+};
+
+/** @brief FDCAN TT Trigger Memory Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTTMC[3] = {
+  [1] = (rw_reg32_t)0x4000A100U,
+  [2] = (rw_reg32_t)0x4000A500U,
+};
+
+/** @brief FDCAN TT Reference Message Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTRMC[3] = {
+  [1] = (rw_reg32_t)0x4000A104U,
+  [2] = (rw_reg32_t)0x4000A504U,
+};
+
+/** @brief FDCAN TT Operation Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTOCF[3] = {
+  [1] = (rw_reg32_t)0x4000A108U,
+  [2] = (rw_reg32_t)0x4000A508U,
+};
+
+/** @brief FDCAN TT Matrix Limits Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTMLM[3] = {
+  [1] = (rw_reg32_t)0x4000A10CU,
+  [2] = (rw_reg32_t)0x4000A50CU,
+};
+
+/** @brief FDCAN TUR Configuration Register. */
+static rw_reg32_t const FDCANx_FDCAN_TURCF[3] = {
+  [1] = (rw_reg32_t)0x4000A110U,
+  [2] = (rw_reg32_t)0x4000A510U,
+};
+
+/** @brief FDCAN TT Operation Control Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTOCN[3] = {
+  [1] = (rw_reg32_t)0x4000A114U,
+  [2] = (rw_reg32_t)0x4000A514U,
+};
+
+/** @brief FDCAN TT Global Time Preset Register. */
+static rw_reg32_t const FDCANx_CAN_TTGTP[3] = {
+  [1] = (rw_reg32_t)0x4000A118U,
+  [2] = (rw_reg32_t)0x4000A518U,
+};
+
+/** @brief FDCAN TT Time Mark Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTTMK[3] = {
+  [1] = (rw_reg32_t)0x4000A11CU,
+  [2] = (rw_reg32_t)0x4000A51CU,
+};
+
+/** @brief FDCAN TT Interrupt Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTIR[3] = {
+  [1] = (rw_reg32_t)0x4000A120U,
+  [2] = (rw_reg32_t)0x4000A520U,
+};
+
+/** @brief FDCAN TT Interrupt Enable Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTIE[3] = {
+  [1] = (rw_reg32_t)0x4000A124U,
+  [2] = (rw_reg32_t)0x4000A524U,
+};
+
+/** @brief FDCAN TT Interrupt Line Select Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTILS[3] = {
+  [1] = (rw_reg32_t)0x4000A128U,
+  [2] = (rw_reg32_t)0x4000A528U,
+};
+
+/** @brief FDCAN TT Operation Status Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTOST[3] = {
+  [1] = (rw_reg32_t)0x4000A12CU,
+  [2] = (rw_reg32_t)0x4000A52CU,
+};
+
+/** @brief FDCAN TUR Numerator Actual Register. */
+static ro_reg32_t const FDCANx_FDCAN_TURNA[3] = {
+  [1] = (ro_reg32_t)0x4000A130U,
+  [2] = (ro_reg32_t)0x4000A530U,
+};
+
+/** @brief FDCAN TT Local and Global Time Register. */
+static ro_reg32_t const FDCANx_FDCAN_TTLGT[3] = {
+  [1] = (ro_reg32_t)0x4000A134U,
+  [2] = (ro_reg32_t)0x4000A534U,
+};
+
+/** @brief FDCAN TT Cycle Time and Count Register. */
+static ro_reg32_t const FDCANx_FDCAN_TTCTC[3] = {
+  [1] = (ro_reg32_t)0x4000A138U,
+  [2] = (ro_reg32_t)0x4000A538U,
+};
+
+/** @brief FDCAN TT Capture Time Register. */
+static ro_reg32_t const FDCANx_FDCAN_TTCPT[3] = {
+  [1] = (ro_reg32_t)0x4000A13CU,
+  [2] = (ro_reg32_t)0x4000A53CU,
+};
+
+/** @brief FDCAN TT Cycle Sync Mark Register. */
+static ro_reg32_t const FDCANx_FDCAN_TTCSM[3] = {
+  [1] = (ro_reg32_t)0x4000A140U,
+  [2] = (ro_reg32_t)0x4000A540U,
+};
+
+/** @brief FDCAN TT Trigger Select Register. */
+static rw_reg32_t const FDCANx_FDCAN_TTTS[3] = {
+  [1] = (rw_reg32_t)0x4000A300U,
+  [2] = (rw_reg32_t)0x4000A700U,
+};
+
+/** @subsection FDCANx Register Field Definitions */
+
+static const field32_t FDCANx_FDCAN_CREL_REL     = {.msk = 0xF0000000U, .pos = 28}; /** @brief Core release. */
+static const field32_t FDCANx_FDCAN_CREL_STEP    = {.msk = 0x0F000000U, .pos = 24}; /** @brief Step of Core release. */
+static const field32_t FDCANx_FDCAN_CREL_SUBSTEP = {.msk = 0x00F00000U, .pos = 20}; /** @brief Sub-step of Core release. */
+static const field32_t FDCANx_FDCAN_CREL_YEAR    = {.msk = 0x000F0000U, .pos = 16}; /** @brief Timestamp Year. */
+static const field32_t FDCANx_FDCAN_CREL_MON     = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Timestamp Month. */
+static const field32_t FDCANx_FDCAN_CREL_DAY     = {.msk = 0x000000FFU, .pos = 0};  /** @brief Timestamp Day. */
+static const field32_t FDCANx_FDCAN_DBTP_DSJW    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Synchronization Jump Width. */
+static const field32_t FDCANx_FDCAN_DBTP_DTSEG2  = {.msk = 0x000000F0U, .pos = 4};  /** @brief Data time segment after sample point. */
+static const field32_t FDCANx_FDCAN_DBTP_DTSEG1  = {.msk = 0x00001F00U, .pos = 8};  /** @brief Data time segment after sample point. */
+static const field32_t FDCANx_FDCAN_DBTP_DBRP    = {.msk = 0x001F0000U, .pos = 16}; /** @brief Data BIt Rate Prescaler. */
+static const field32_t FDCANx_FDCAN_DBTP_TDC     = {.msk = 0x00800000U, .pos = 23}; /** @brief Transceiver Delay Compensation. */
+static const field32_t FDCANx_FDCAN_TEST_LBCK    = {.msk = 0x00000010U, .pos = 4};  /** @brief Loop Back mode. */
+static const field32_t FDCANx_FDCAN_TEST_TX      = {.msk = 0x00000060U, .pos = 5};  /** @brief Loop Back mode. */
+static const field32_t FDCANx_FDCAN_TEST_RX      = {.msk = 0x00000080U, .pos = 7};  /** @brief Control of Transmit Pin. */
+static const field32_t FDCANx_FDCAN_RWD_WDV      = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Watchdog value. */
+static const field32_t FDCANx_FDCAN_RWD_WDC      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Watchdog configuration. */
+static const field32_t FDCANx_FDCAN_CCCR_INIT    = {.msk = 0x00000001U, .pos = 0};  /** @brief Initialization. */
+static const field32_t FDCANx_FDCAN_CCCR_CCE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Configuration Change Enable. */
+static const field32_t FDCANx_FDCAN_CCCR_ASM     = {.msk = 0x00000004U, .pos = 2};  /** @brief ASM Restricted Operation Mode. */
+static const field32_t FDCANx_FDCAN_CCCR_CSA     = {.msk = 0x00000008U, .pos = 3};  /** @brief Clock Stop Acknowledge. */
+static const field32_t FDCANx_FDCAN_CCCR_CSR     = {.msk = 0x00000010U, .pos = 4};  /** @brief Clock Stop Request. */
+static const field32_t FDCANx_FDCAN_CCCR_MON     = {.msk = 0x00000020U, .pos = 5};  /** @brief Bus Monitoring Mode. */
+static const field32_t FDCANx_FDCAN_CCCR_DAR     = {.msk = 0x00000040U, .pos = 6};  /** @brief Disable Automatic Retransmission. */
+static const field32_t FDCANx_FDCAN_CCCR_TEST    = {.msk = 0x00000080U, .pos = 7};  /** @brief Test Mode Enable. */
+static const field32_t FDCANx_FDCAN_CCCR_FDOE    = {.msk = 0x00000100U, .pos = 8};  /** @brief FD Operation Enable. */
+static const field32_t FDCANx_FDCAN_CCCR_BSE     = {.msk = 0x00000200U, .pos = 9};  /** @brief FDCAN Bit Rate Switching. */
+static const field32_t FDCANx_FDCAN_CCCR_PXHD    = {.msk = 0x00001000U, .pos = 12}; /** @brief Protocol Exception Handling Disable. */
+static const field32_t FDCANx_FDCAN_CCCR_EFBI    = {.msk = 0x00002000U, .pos = 13}; /** @brief Edge Filtering during Bus Integration. */
+static const field32_t FDCANx_FDCAN_CCCR_TXP     = {.msk = 0x00004000U, .pos = 14}; /** @brief TXP. */
+static const field32_t FDCANx_FDCAN_CCCR_NISO    = {.msk = 0x00008000U, .pos = 15}; /** @brief Non ISO Operation. */
+static const field32_t FDCANx_FDCAN_NBTP_NSJW    = {.msk = 0xFE000000U, .pos = 25}; /** @brief NSJW: Nominal (Re)Synchronization Jump Width. */
+static const field32_t FDCANx_FDCAN_NBTP_NBRP    = {.msk = 0x01FF0000U, .pos = 16}; /** @brief Bit Rate Prescaler. */
+static const field32_t FDCANx_FDCAN_NBTP_NTSEG1  = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Nominal Time segment before sample point. */
+static const field32_t FDCANx_FDCAN_NBTP_TSEG2   = {.msk = 0x0000007FU, .pos = 0};  /** @brief Nominal Time segment after sample point. */
+static const field32_t FDCANx_FDCAN_TSCC_TCP     = {.msk = 0x000F0000U, .pos = 16}; /** @brief Timestamp Counter Prescaler. */
+static const field32_t FDCANx_FDCAN_TSCC_TSS     = {.msk = 0x00000003U, .pos = 0};  /** @brief Timestamp Select. */
+static const field32_t FDCANx_FDCAN_TSCV_TSC     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timestamp Counter. */
+static const field32_t FDCANx_FDCAN_TOCC_ETOC    = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable Timeout Counter. */
+static const field32_t FDCANx_FDCAN_TOCC_TOS     = {.msk = 0x00000006U, .pos = 1};  /** @brief Timeout Select. */
+static const field32_t FDCANx_FDCAN_TOCC_TOP     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Timeout Period. */
+static const field32_t FDCANx_FDCAN_TOCV_TOC     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timeout Counter. */
+static const field32_t FDCANx_FDCAN_ECR_CEL      = {.msk = 0x00FF0000U, .pos = 16}; /** @brief AN Error Logging. */
+static const field32_t FDCANx_FDCAN_ECR_RP       = {.msk = 0x00008000U, .pos = 15}; /** @brief Receive Error Passive. */
+static const field32_t FDCANx_FDCAN_ECR_TREC     = {.msk = 0x00007F00U, .pos = 8};  /** @brief Receive Error Counter. */
+static const field32_t FDCANx_FDCAN_ECR_TEC      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Transmit Error Counter. */
+static const field32_t FDCANx_FDCAN_PSR_LEC      = {.msk = 0x00000007U, .pos = 0};  /** @brief Last Error Code. */
+static const field32_t FDCANx_FDCAN_PSR_ACT      = {.msk = 0x00000018U, .pos = 3};  /** @brief Activity. */
+static const field32_t FDCANx_FDCAN_PSR_EP       = {.msk = 0x00000020U, .pos = 5};  /** @brief Error Passive. */
+static const field32_t FDCANx_FDCAN_PSR_EW       = {.msk = 0x00000040U, .pos = 6};  /** @brief Warning Status. */
+static const field32_t FDCANx_FDCAN_PSR_BO       = {.msk = 0x00000080U, .pos = 7};  /** @brief Bus_Off Status. */
+static const field32_t FDCANx_FDCAN_PSR_DLEC     = {.msk = 0x00000700U, .pos = 8};  /** @brief Data Last Error Code. */
+static const field32_t FDCANx_FDCAN_PSR_RESI     = {.msk = 0x00000800U, .pos = 11}; /** @brief ESI flag of last received FDCAN Message. */
+static const field32_t FDCANx_FDCAN_PSR_RBRS     = {.msk = 0x00001000U, .pos = 12}; /** @brief BRS flag of last received FDCAN Message. */
+static const field32_t FDCANx_FDCAN_PSR_REDL     = {.msk = 0x00002000U, .pos = 13}; /** @brief Received FDCAN Message. */
+static const field32_t FDCANx_FDCAN_PSR_PXE      = {.msk = 0x00004000U, .pos = 14}; /** @brief Protocol Exception Event. */
+static const field32_t FDCANx_FDCAN_PSR_TDCV     = {.msk = 0x007F0000U, .pos = 16}; /** @brief Transmitter Delay Compensation Value. */
+static const field32_t FDCANx_FDCAN_TDCR_TDCF    = {.msk = 0x0000007FU, .pos = 0};  /** @brief Transmitter Delay Compensation Filter Window Length. */
+static const field32_t FDCANx_FDCAN_TDCR_TDCO    = {.msk = 0x00007F00U, .pos = 8};  /** @brief Transmitter Delay Compensation Offset. */
+static const field32_t FDCANx_FDCAN_IR_RF0N      = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx FIFO 0 New Message. */
+static const field32_t FDCANx_FDCAN_IR_RF0W      = {.msk = 0x00000002U, .pos = 1};  /** @brief Rx FIFO 0 Full. */
+static const field32_t FDCANx_FDCAN_IR_RF0F      = {.msk = 0x00000004U, .pos = 2};  /** @brief Rx FIFO 0 Full. */
+static const field32_t FDCANx_FDCAN_IR_RF0L      = {.msk = 0x00000008U, .pos = 3};  /** @brief Rx FIFO 0 Message Lost. */
+static const field32_t FDCANx_FDCAN_IR_RF1N      = {.msk = 0x00000010U, .pos = 4};  /** @brief Rx FIFO 1 New Message. */
+static const field32_t FDCANx_FDCAN_IR_RF1W      = {.msk = 0x00000020U, .pos = 5};  /** @brief Rx FIFO 1 Watermark Reached. */
+static const field32_t FDCANx_FDCAN_IR_RF1F      = {.msk = 0x00000040U, .pos = 6};  /** @brief Rx FIFO 1 Watermark Reached. */
+static const field32_t FDCANx_FDCAN_IR_RF1L      = {.msk = 0x00000080U, .pos = 7};  /** @brief Rx FIFO 1 Message Lost. */
+static const field32_t FDCANx_FDCAN_IR_HPM       = {.msk = 0x00000100U, .pos = 8};  /** @brief High Priority Message. */
+static const field32_t FDCANx_FDCAN_IR_TC        = {.msk = 0x00000200U, .pos = 9};  /** @brief Transmission Completed. */
+static const field32_t FDCANx_FDCAN_IR_TCF       = {.msk = 0x00000400U, .pos = 10}; /** @brief Transmission Cancellation Finished. */
+static const field32_t FDCANx_FDCAN_IR_TEF       = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx FIFO Empty. */
+static const field32_t FDCANx_FDCAN_IR_TEFN      = {.msk = 0x00001000U, .pos = 12}; /** @brief Tx Event FIFO New Entry. */
+static const field32_t FDCANx_FDCAN_IR_TEFW      = {.msk = 0x00002000U, .pos = 13}; /** @brief Tx Event FIFO Watermark Reached. */
+static const field32_t FDCANx_FDCAN_IR_TEFF      = {.msk = 0x00004000U, .pos = 14}; /** @brief Tx Event FIFO Full. */
+static const field32_t FDCANx_FDCAN_IR_TEFL      = {.msk = 0x00008000U, .pos = 15}; /** @brief Tx Event FIFO Element Lost. */
+static const field32_t FDCANx_FDCAN_IR_TSW       = {.msk = 0x00010000U, .pos = 16}; /** @brief Timestamp Wraparound. */
+static const field32_t FDCANx_FDCAN_IR_MRAF      = {.msk = 0x00020000U, .pos = 17}; /** @brief Message RAM Access Failure. */
+static const field32_t FDCANx_FDCAN_IR_TOO       = {.msk = 0x00040000U, .pos = 18}; /** @brief Timeout Occurred. */
+static const field32_t FDCANx_FDCAN_IR_DRX       = {.msk = 0x00080000U, .pos = 19}; /** @brief Message stored to Dedicated Rx Buffer. */
+static const field32_t FDCANx_FDCAN_IR_ELO       = {.msk = 0x00400000U, .pos = 22}; /** @brief Error Logging Overflow. */
+static const field32_t FDCANx_FDCAN_IR_EP        = {.msk = 0x00800000U, .pos = 23}; /** @brief Error Passive. */
+static const field32_t FDCANx_FDCAN_IR_EW        = {.msk = 0x01000000U, .pos = 24}; /** @brief Warning Status. */
+static const field32_t FDCANx_FDCAN_IR_BO        = {.msk = 0x02000000U, .pos = 25}; /** @brief Bus_Off Status. */
+static const field32_t FDCANx_FDCAN_IR_WDI       = {.msk = 0x04000000U, .pos = 26}; /** @brief Watchdog Interrupt. */
+static const field32_t FDCANx_FDCAN_IR_PEA       = {.msk = 0x08000000U, .pos = 27}; /** @brief Protocol Error in Arbitration Phase (Nominal Bit Time is used). */
+static const field32_t FDCANx_FDCAN_IR_PED       = {.msk = 0x10000000U, .pos = 28}; /** @brief Protocol Error in Data Phase (Data Bit Time is used). */
+static const field32_t FDCANx_FDCAN_IR_ARA       = {.msk = 0x20000000U, .pos = 29}; /** @brief Access to Reserved Address. */
+static const field32_t FDCANx_FDCAN_IE_RF0NE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx FIFO 0 New Message Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF0WE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Rx FIFO 0 Full Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF0FE     = {.msk = 0x00000004U, .pos = 2};  /** @brief Rx FIFO 0 Full Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF0LE     = {.msk = 0x00000008U, .pos = 3};  /** @brief Rx FIFO 0 Message Lost Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF1NE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Rx FIFO 1 New Message Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF1WE     = {.msk = 0x00000020U, .pos = 5};  /** @brief Rx FIFO 1 Watermark Reached Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF1FE     = {.msk = 0x00000040U, .pos = 6};  /** @brief Rx FIFO 1 Watermark Reached Enable. */
+static const field32_t FDCANx_FDCAN_IE_RF1LE     = {.msk = 0x00000080U, .pos = 7};  /** @brief Rx FIFO 1 Message Lost Enable. */
+static const field32_t FDCANx_FDCAN_IE_HPME      = {.msk = 0x00000100U, .pos = 8};  /** @brief High Priority Message Enable. */
+static const field32_t FDCANx_FDCAN_IE_TCE       = {.msk = 0x00000200U, .pos = 9};  /** @brief Transmission Completed Enable. */
+static const field32_t FDCANx_FDCAN_IE_TCFE      = {.msk = 0x00000400U, .pos = 10}; /** @brief Transmission Cancellation Finished Enable. */
+static const field32_t FDCANx_FDCAN_IE_TEFE      = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx FIFO Empty Enable. */
+static const field32_t FDCANx_FDCAN_IE_TEFNE     = {.msk = 0x00001000U, .pos = 12}; /** @brief Tx Event FIFO New Entry Enable. */
+static const field32_t FDCANx_FDCAN_IE_TEFWE     = {.msk = 0x00002000U, .pos = 13}; /** @brief Tx Event FIFO Watermark Reached Enable. */
+static const field32_t FDCANx_FDCAN_IE_TEFFE     = {.msk = 0x00004000U, .pos = 14}; /** @brief Tx Event FIFO Full Enable. */
+static const field32_t FDCANx_FDCAN_IE_TEFLE     = {.msk = 0x00008000U, .pos = 15}; /** @brief Tx Event FIFO Element Lost Enable. */
+static const field32_t FDCANx_FDCAN_IE_TSWE      = {.msk = 0x00010000U, .pos = 16}; /** @brief Timestamp Wraparound Enable. */
+static const field32_t FDCANx_FDCAN_IE_MRAFE     = {.msk = 0x00020000U, .pos = 17}; /** @brief Message RAM Access Failure Enable. */
+static const field32_t FDCANx_FDCAN_IE_TOOE      = {.msk = 0x00040000U, .pos = 18}; /** @brief Timeout Occurred Enable. */
+static const field32_t FDCANx_FDCAN_IE_DRXE      = {.msk = 0x00080000U, .pos = 19}; /** @brief Message stored to Dedicated Rx Buffer Enable. */
+static const field32_t FDCANx_FDCAN_IE_BECE      = {.msk = 0x00100000U, .pos = 20}; /** @brief Bit Error Corrected Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_IE_BEUE      = {.msk = 0x00200000U, .pos = 21}; /** @brief Bit Error Uncorrected Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_IE_ELOE      = {.msk = 0x00400000U, .pos = 22}; /** @brief Error Logging Overflow Enable. */
+static const field32_t FDCANx_FDCAN_IE_EPE       = {.msk = 0x00800000U, .pos = 23}; /** @brief Error Passive Enable. */
+static const field32_t FDCANx_FDCAN_IE_EWE       = {.msk = 0x01000000U, .pos = 24}; /** @brief Warning Status Enable. */
+static const field32_t FDCANx_FDCAN_IE_BOE       = {.msk = 0x02000000U, .pos = 25}; /** @brief Bus_Off Status Enable. */
+static const field32_t FDCANx_FDCAN_IE_WDIE      = {.msk = 0x04000000U, .pos = 26}; /** @brief Watchdog Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_IE_PEAE      = {.msk = 0x08000000U, .pos = 27}; /** @brief Protocol Error in Arbitration Phase Enable. */
+static const field32_t FDCANx_FDCAN_IE_PEDE      = {.msk = 0x10000000U, .pos = 28}; /** @brief Protocol Error in Data Phase Enable. */
+static const field32_t FDCANx_FDCAN_IE_ARAE      = {.msk = 0x20000000U, .pos = 29}; /** @brief Access to Reserved Address Enable. */
+static const field32_t FDCANx_FDCAN_ILS_RF0NL    = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx FIFO 0 New Message Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF0WL    = {.msk = 0x00000002U, .pos = 1};  /** @brief Rx FIFO 0 Watermark Reached Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF0FL    = {.msk = 0x00000004U, .pos = 2};  /** @brief Rx FIFO 0 Full Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF0LL    = {.msk = 0x00000008U, .pos = 3};  /** @brief Rx FIFO 0 Message Lost Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF1NL    = {.msk = 0x00000010U, .pos = 4};  /** @brief Rx FIFO 1 New Message Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF1WL    = {.msk = 0x00000020U, .pos = 5};  /** @brief Rx FIFO 1 Watermark Reached Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF1FL    = {.msk = 0x00000040U, .pos = 6};  /** @brief Rx FIFO 1 Full Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RF1LL    = {.msk = 0x00000080U, .pos = 7};  /** @brief Rx FIFO 1 Message Lost Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_HPML     = {.msk = 0x00000100U, .pos = 8};  /** @brief High Priority Message Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TCL      = {.msk = 0x00000200U, .pos = 9};  /** @brief Transmission Completed Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TCFL     = {.msk = 0x00000400U, .pos = 10}; /** @brief Transmission Cancellation Finished Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TEFL     = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx FIFO Empty Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TEFNL    = {.msk = 0x00001000U, .pos = 12}; /** @brief Tx Event FIFO New Entry Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TEFWL    = {.msk = 0x00002000U, .pos = 13}; /** @brief Tx Event FIFO Watermark Reached Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TEFFL    = {.msk = 0x00004000U, .pos = 14}; /** @brief Tx Event FIFO Full Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TEFLL    = {.msk = 0x00008000U, .pos = 15}; /** @brief Tx Event FIFO Element Lost Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TSWL     = {.msk = 0x00010000U, .pos = 16}; /** @brief Timestamp Wraparound Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_MRAFL    = {.msk = 0x00020000U, .pos = 17}; /** @brief Message RAM Access Failure Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_TOOL     = {.msk = 0x00040000U, .pos = 18}; /** @brief Timeout Occurred Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_DRXL     = {.msk = 0x00080000U, .pos = 19}; /** @brief Message stored to Dedicated Rx Buffer Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_BECL     = {.msk = 0x00100000U, .pos = 20}; /** @brief Bit Error Corrected Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_BEUL     = {.msk = 0x00200000U, .pos = 21}; /** @brief Bit Error Uncorrected Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_ELOL     = {.msk = 0x00400000U, .pos = 22}; /** @brief Error Logging Overflow Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_EPL      = {.msk = 0x00800000U, .pos = 23}; /** @brief Error Passive Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_EWL      = {.msk = 0x01000000U, .pos = 24}; /** @brief Warning Status Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_BOL      = {.msk = 0x02000000U, .pos = 25}; /** @brief Bus_Off Status. */
+static const field32_t FDCANx_FDCAN_ILS_WDIL     = {.msk = 0x04000000U, .pos = 26}; /** @brief Watchdog Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_PEAL     = {.msk = 0x08000000U, .pos = 27}; /** @brief Protocol Error in Arbitration Phase Line. */
+static const field32_t FDCANx_FDCAN_ILS_PEDL     = {.msk = 0x10000000U, .pos = 28}; /** @brief Protocol Error in Data Phase Line. */
+static const field32_t FDCANx_FDCAN_ILS_ARAL     = {.msk = 0x20000000U, .pos = 29}; /** @brief Access to Reserved Address Line. */
+static const field32_t FDCANx_FDCAN_ILE_EINT0    = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable Interrupt Line 0. */
+static const field32_t FDCANx_FDCAN_ILE_EINT1    = {.msk = 0x00000002U, .pos = 1};  /** @brief Enable Interrupt Line 1. */
+static const field32_t FDCANx_FDCAN_GFC_RRFE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Reject Remote Frames Extended. */
+static const field32_t FDCANx_FDCAN_GFC_RRFS     = {.msk = 0x00000002U, .pos = 1};  /** @brief Reject Remote Frames Standard. */
+static const field32_t FDCANx_FDCAN_GFC_ANFE     = {.msk = 0x0000000CU, .pos = 2};  /** @brief Accept Non-matching Frames Extended. */
+static const field32_t FDCANx_FDCAN_GFC_ANFS     = {.msk = 0x00000030U, .pos = 4};  /** @brief Accept Non-matching Frames Standard. */
+static const field32_t FDCANx_FDCAN_SIDFC_FLSSA  = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Filter List Standard Start Address. */
+static const field32_t FDCANx_FDCAN_SIDFC_LSS    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief List Size Standard. */
+static const field32_t FDCANx_FDCAN_XIDFC_FLESA  = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Filter List Standard Start Address. */
+static const field32_t FDCANx_FDCAN_XIDFC_LSE    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief List Size Extended. */
+static const field32_t FDCANx_FDCAN_XIDAM_EIDM   = {.msk = 0x1FFFFFFFU, .pos = 0};  /** @brief Extended ID Mask. */
+static const field32_t FDCANx_FDCAN_HPMS_BIDX    = {.msk = 0x0000003FU, .pos = 0};  /** @brief Buffer Index. */
+static const field32_t FDCANx_FDCAN_HPMS_MSI     = {.msk = 0x000000C0U, .pos = 6};  /** @brief Message Storage Indicator. */
+static const field32_t FDCANx_FDCAN_HPMS_FIDX    = {.msk = 0x00007F00U, .pos = 8};  /** @brief Filter Index. */
+static const field32_t FDCANx_FDCAN_HPMS_FLST    = {.msk = 0x00008000U, .pos = 15}; /** @brief Filter List. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND0    = {.msk = 0x00000001U, .pos = 0};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND1    = {.msk = 0x00000002U, .pos = 1};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND2    = {.msk = 0x00000004U, .pos = 2};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND3    = {.msk = 0x00000008U, .pos = 3};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND4    = {.msk = 0x00000010U, .pos = 4};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND5    = {.msk = 0x00000020U, .pos = 5};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND6    = {.msk = 0x00000040U, .pos = 6};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND7    = {.msk = 0x00000080U, .pos = 7};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND8    = {.msk = 0x00000100U, .pos = 8};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND9    = {.msk = 0x00000200U, .pos = 9};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND10   = {.msk = 0x00000400U, .pos = 10}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND11   = {.msk = 0x00000800U, .pos = 11}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND12   = {.msk = 0x00001000U, .pos = 12}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND13   = {.msk = 0x00002000U, .pos = 13}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND14   = {.msk = 0x00004000U, .pos = 14}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND15   = {.msk = 0x00008000U, .pos = 15}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND16   = {.msk = 0x00010000U, .pos = 16}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND17   = {.msk = 0x00020000U, .pos = 17}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND18   = {.msk = 0x00040000U, .pos = 18}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND19   = {.msk = 0x00080000U, .pos = 19}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND20   = {.msk = 0x00100000U, .pos = 20}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND21   = {.msk = 0x00200000U, .pos = 21}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND22   = {.msk = 0x00400000U, .pos = 22}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND23   = {.msk = 0x00800000U, .pos = 23}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND24   = {.msk = 0x01000000U, .pos = 24}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND25   = {.msk = 0x02000000U, .pos = 25}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND26   = {.msk = 0x04000000U, .pos = 26}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND27   = {.msk = 0x08000000U, .pos = 27}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND28   = {.msk = 0x10000000U, .pos = 28}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND29   = {.msk = 0x20000000U, .pos = 29}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND30   = {.msk = 0x40000000U, .pos = 30}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_ND31   = {.msk = 0x80000000U, .pos = 31}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND32   = {.msk = 0x00000001U, .pos = 0};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND33   = {.msk = 0x00000002U, .pos = 1};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND34   = {.msk = 0x00000004U, .pos = 2};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND35   = {.msk = 0x00000008U, .pos = 3};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND36   = {.msk = 0x00000010U, .pos = 4};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND37   = {.msk = 0x00000020U, .pos = 5};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND38   = {.msk = 0x00000040U, .pos = 6};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND39   = {.msk = 0x00000080U, .pos = 7};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND40   = {.msk = 0x00000100U, .pos = 8};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND41   = {.msk = 0x00000200U, .pos = 9};  /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND42   = {.msk = 0x00000400U, .pos = 10}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND43   = {.msk = 0x00000800U, .pos = 11}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND44   = {.msk = 0x00001000U, .pos = 12}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND45   = {.msk = 0x00002000U, .pos = 13}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND46   = {.msk = 0x00004000U, .pos = 14}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND47   = {.msk = 0x00008000U, .pos = 15}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND48   = {.msk = 0x00010000U, .pos = 16}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND49   = {.msk = 0x00020000U, .pos = 17}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND50   = {.msk = 0x00040000U, .pos = 18}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND51   = {.msk = 0x00080000U, .pos = 19}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND52   = {.msk = 0x00100000U, .pos = 20}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND53   = {.msk = 0x00200000U, .pos = 21}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND54   = {.msk = 0x00400000U, .pos = 22}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND55   = {.msk = 0x00800000U, .pos = 23}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND56   = {.msk = 0x01000000U, .pos = 24}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND57   = {.msk = 0x02000000U, .pos = 25}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND58   = {.msk = 0x04000000U, .pos = 26}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND59   = {.msk = 0x08000000U, .pos = 27}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND60   = {.msk = 0x10000000U, .pos = 28}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND61   = {.msk = 0x20000000U, .pos = 29}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND62   = {.msk = 0x40000000U, .pos = 30}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_ND63   = {.msk = 0x80000000U, .pos = 31}; /** @brief New data. */
+static const field32_t FDCANx_FDCAN_RXF0C_F0SA   = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Rx FIFO 0 Start Address. */
+static const field32_t FDCANx_FDCAN_RXF0C_F0S    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Rx FIFO 0 Size. */
+static const field32_t FDCANx_FDCAN_RXF0C_F0WM   = {.msk = 0xFF000000U, .pos = 24}; /** @brief FIFO 0 Watermark. */
+static const field32_t FDCANx_FDCAN_RXF0S_F0FL   = {.msk = 0x0000007FU, .pos = 0};  /** @brief Rx FIFO 0 Fill Level. */
+static const field32_t FDCANx_FDCAN_RXF0S_F0G    = {.msk = 0x00003F00U, .pos = 8};  /** @brief Rx FIFO 0 Get Index. */
+static const field32_t FDCANx_FDCAN_RXF0S_F0P    = {.msk = 0x003F0000U, .pos = 16}; /** @brief Rx FIFO 0 Put Index. */
+static const field32_t FDCANx_FDCAN_RXF0S_F0F    = {.msk = 0x01000000U, .pos = 24}; /** @brief Rx FIFO 0 Full. */
+static const field32_t FDCANx_FDCAN_RXF0S_RF0L   = {.msk = 0x02000000U, .pos = 25}; /** @brief Rx FIFO 0 Message Lost. */
+static const field32_t FDCANx_FDCAN_RXF0A_FA01   = {.msk = 0x0000003FU, .pos = 0};  /** @brief Rx FIFO 0 Acknowledge Index. */
+static const field32_t FDCANx_FDCAN_RXBC_RBSA    = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Rx Buffer Start Address. */
+static const field32_t FDCANx_FDCAN_RXF1C_F1SA   = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Rx FIFO 1 Start Address. */
+static const field32_t FDCANx_FDCAN_RXF1C_F1S    = {.msk = 0x007F0000U, .pos = 16}; /** @brief Rx FIFO 1 Size. */
+static const field32_t FDCANx_FDCAN_RXF1C_F1WM   = {.msk = 0x7F000000U, .pos = 24}; /** @brief Rx FIFO 1 Watermark. */
+static const field32_t FDCANx_FDCAN_RXF1S_F1FL   = {.msk = 0x0000007FU, .pos = 0};  /** @brief Rx FIFO 1 Fill Level. */
+static const field32_t FDCANx_FDCAN_RXF1S_F1GI   = {.msk = 0x00007F00U, .pos = 8};  /** @brief Rx FIFO 1 Get Index. */
+static const field32_t FDCANx_FDCAN_RXF1S_F1PI   = {.msk = 0x007F0000U, .pos = 16}; /** @brief Rx FIFO 1 Put Index. */
+static const field32_t FDCANx_FDCAN_RXF1S_F1F    = {.msk = 0x01000000U, .pos = 24}; /** @brief Rx FIFO 1 Full. */
+static const field32_t FDCANx_FDCAN_RXF1S_RF1L   = {.msk = 0x02000000U, .pos = 25}; /** @brief Rx FIFO 1 Message Lost. */
+static const field32_t FDCANx_FDCAN_RXF1S_DMS    = {.msk = 0xC0000000U, .pos = 30}; /** @brief Debug Message Status. */
+static const field32_t FDCANx_FDCAN_RXF1A_F1AI   = {.msk = 0x0000003FU, .pos = 0};  /** @brief Rx FIFO 1 Acknowledge Index. */
+static const field32_t FDCANx_FDCAN_RXESC_F0DS   = {.msk = 0x00000007U, .pos = 0};  /** @brief Rx FIFO 1 Data Field Size:. */
+static const field32_t FDCANx_FDCAN_RXESC_F1DS   = {.msk = 0x00000070U, .pos = 4};  /** @brief Rx FIFO 0 Data Field Size:. */
+static const field32_t FDCANx_FDCAN_RXESC_RBDS   = {.msk = 0x00000700U, .pos = 8};  /** @brief Rx Buffer Data Field Size:. */
+static const field32_t FDCANx_FDCAN_TXBC_TBSA    = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Tx Buffers Start Address. */
+static const field32_t FDCANx_FDCAN_TXBC_NDTB    = {.msk = 0x003F0000U, .pos = 16}; /** @brief Number of Dedicated Transmit Buffers. */
+static const field32_t FDCANx_FDCAN_TXBC_TFQS    = {.msk = 0x3F000000U, .pos = 24}; /** @brief Transmit FIFO/Queue Size. */
+static const field32_t FDCANx_FDCAN_TXBC_TFQM    = {.msk = 0x40000000U, .pos = 30}; /** @brief Tx FIFO/Queue Mode. */
+static const field32_t FDCANx_FDCAN_TXFQS_TFFL   = {.msk = 0x0000003FU, .pos = 0};  /** @brief Tx FIFO Free Level. */
+static const field32_t FDCANx_FDCAN_TXFQS_TFGI   = {.msk = 0x00001F00U, .pos = 8};  /** @brief TFGI. */
+static const field32_t FDCANx_FDCAN_TXFQS_TFQPI  = {.msk = 0x001F0000U, .pos = 16}; /** @brief Tx FIFO/Queue Put Index. */
+static const field32_t FDCANx_FDCAN_TXFQS_TFQF   = {.msk = 0x00200000U, .pos = 21}; /** @brief Tx FIFO/Queue Full. */
+static const field32_t FDCANx_FDCAN_TXESC_TBDS   = {.msk = 0x00000007U, .pos = 0};  /** @brief Tx Buffer Data Field Size:. */
+static const field32_t FDCANx_FDCAN_TXEFC_EFSA   = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Event FIFO Start Address. */
+static const field32_t FDCANx_FDCAN_TXEFC_EFS    = {.msk = 0x003F0000U, .pos = 16}; /** @brief Event FIFO Size. */
+static const field32_t FDCANx_FDCAN_TXEFC_EFWM   = {.msk = 0x3F000000U, .pos = 24}; /** @brief Event FIFO Watermark. */
+static const field32_t FDCANx_FDCAN_TXEFS_EFFL   = {.msk = 0x0000003FU, .pos = 0};  /** @brief Event FIFO Fill Level. */
+static const field32_t FDCANx_FDCAN_TXEFS_EFGI   = {.msk = 0x00001F00U, .pos = 8};  /** @brief Event FIFO Get Index. */
+static const field32_t FDCANx_FDCAN_TXEFS_EFPI   = {.msk = 0x001F0000U, .pos = 16}; /** @brief Event FIFO put index. */
+static const field32_t FDCANx_FDCAN_TXEFS_EFF    = {.msk = 0x01000000U, .pos = 24}; /** @brief Event FIFO Full. */
+static const field32_t FDCANx_FDCAN_TXEFS_TEFL   = {.msk = 0x02000000U, .pos = 25}; /** @brief Tx Event FIFO Element Lost. */
+static const field32_t FDCANx_FDCAN_TXEFA_EFAI   = {.msk = 0x0000001FU, .pos = 0};  /** @brief Event FIFO Acknowledge Index. */
+static const field32_t FDCANx_FDCAN_TTTMC_TMSA   = {.msk = 0x0000FFFCU, .pos = 2};  /** @brief Trigger Memory Start Address. */
+static const field32_t FDCANx_FDCAN_TTTMC_TME    = {.msk = 0x007F0000U, .pos = 16}; /** @brief Trigger Memory Elements. */
+static const field32_t FDCANx_FDCAN_TTRMC_RID    = {.msk = 0x1FFFFFFFU, .pos = 0};  /** @brief Reference Identifier. */
+static const field32_t FDCANx_FDCAN_TTRMC_XTD    = {.msk = 0x40000000U, .pos = 30}; /** @brief Extended Identifier. */
+static const field32_t FDCANx_FDCAN_TTRMC_RMPS   = {.msk = 0x80000000U, .pos = 31}; /** @brief Reference Message Payload Select. */
+static const field32_t FDCANx_FDCAN_TTOCF_OM     = {.msk = 0x00000003U, .pos = 0};  /** @brief Operation Mode. */
+static const field32_t FDCANx_FDCAN_TTOCF_GEN    = {.msk = 0x00000008U, .pos = 3};  /** @brief Gap Enable. */
+static const field32_t FDCANx_FDCAN_TTOCF_TM     = {.msk = 0x00000010U, .pos = 4};  /** @brief Time Master. */
+static const field32_t FDCANx_FDCAN_TTOCF_LDSDL  = {.msk = 0x000000E0U, .pos = 5};  /** @brief LD of Synchronization Deviation Limit. */
+static const field32_t FDCANx_FDCAN_TTOCF_IRTO   = {.msk = 0x00007F00U, .pos = 8};  /** @brief Initial Reference Trigger Offset. */
+static const field32_t FDCANx_FDCAN_TTOCF_EECS   = {.msk = 0x00008000U, .pos = 15}; /** @brief Enable External Clock Synchronization. */
+static const field32_t FDCANx_FDCAN_TTOCF_AWL    = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Application Watchdog Limit. */
+static const field32_t FDCANx_FDCAN_TTOCF_EGTF   = {.msk = 0x01000000U, .pos = 24}; /** @brief Enable Global Time Filtering. */
+static const field32_t FDCANx_FDCAN_TTOCF_ECC    = {.msk = 0x02000000U, .pos = 25}; /** @brief Enable Clock Calibration. */
+static const field32_t FDCANx_FDCAN_TTOCF_EVTP   = {.msk = 0x04000000U, .pos = 26}; /** @brief Event Trigger Polarity. */
+static const field32_t FDCANx_FDCAN_TTMLM_CCM    = {.msk = 0x0000003FU, .pos = 0};  /** @brief Cycle Count Max. */
+static const field32_t FDCANx_FDCAN_TTMLM_CSS    = {.msk = 0x000000C0U, .pos = 6};  /** @brief Cycle Start Synchronization. */
+static const field32_t FDCANx_FDCAN_TTMLM_TXEW   = {.msk = 0x00000F00U, .pos = 8};  /** @brief Tx Enable Window. */
+static const field32_t FDCANx_FDCAN_TTMLM_ENTT   = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Expected Number of Tx Triggers. */
+static const field32_t FDCANx_FDCAN_TURCF_NCL    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Numerator Configuration Low. */
+static const field32_t FDCANx_FDCAN_TURCF_DC     = {.msk = 0x3FFF0000U, .pos = 16}; /** @brief Denominator Configuration. */
+static const field32_t FDCANx_FDCAN_TURCF_ELT    = {.msk = 0x80000000U, .pos = 31}; /** @brief Enable Local Time. */
+static const field32_t FDCANx_FDCAN_TTOCN_SGT    = {.msk = 0x00000001U, .pos = 0};  /** @brief Set Global time. */
+static const field32_t FDCANx_FDCAN_TTOCN_ECS    = {.msk = 0x00000002U, .pos = 1};  /** @brief External Clock Synchronization. */
+static const field32_t FDCANx_FDCAN_TTOCN_SWP    = {.msk = 0x00000004U, .pos = 2};  /** @brief Stop Watch Polarity. */
+static const field32_t FDCANx_FDCAN_TTOCN_SWS    = {.msk = 0x00000018U, .pos = 3};  /** @brief Stop Watch Source. */
+static const field32_t FDCANx_FDCAN_TTOCN_RTIE   = {.msk = 0x00000020U, .pos = 5};  /** @brief Register Time Mark Interrupt Pulse Enable. */
+static const field32_t FDCANx_FDCAN_TTOCN_TMC    = {.msk = 0x000000C0U, .pos = 6};  /** @brief Register Time Mark Compare. */
+static const field32_t FDCANx_FDCAN_TTOCN_TTIE   = {.msk = 0x00000100U, .pos = 8};  /** @brief Trigger Time Mark Interrupt Pulse Enable. */
+static const field32_t FDCANx_FDCAN_TTOCN_GCS    = {.msk = 0x00000200U, .pos = 9};  /** @brief Gap Control Select. */
+static const field32_t FDCANx_FDCAN_TTOCN_FGP    = {.msk = 0x00000400U, .pos = 10}; /** @brief Finish Gap. */
+static const field32_t FDCANx_FDCAN_TTOCN_TMG    = {.msk = 0x00000800U, .pos = 11}; /** @brief Time Mark Gap. */
+static const field32_t FDCANx_FDCAN_TTOCN_NIG    = {.msk = 0x00001000U, .pos = 12}; /** @brief Next is Gap. */
+static const field32_t FDCANx_FDCAN_TTOCN_ESCN   = {.msk = 0x00002000U, .pos = 13}; /** @brief External Synchronization Control. */
+static const field32_t FDCANx_FDCAN_TTOCN_LCKC   = {.msk = 0x00008000U, .pos = 15}; /** @brief TT Operation Control Register Locked. */
+static const field32_t FDCANx_CAN_TTGTP_NCL      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Time Preset. */
+static const field32_t FDCANx_CAN_TTGTP_CTP      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Cycle Time Target Phase. */
+static const field32_t FDCANx_FDCAN_TTTMK_TM     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Time Mark. */
+static const field32_t FDCANx_FDCAN_TTTMK_TICC   = {.msk = 0x007F0000U, .pos = 16}; /** @brief Time Mark Cycle Code. */
+static const field32_t FDCANx_FDCAN_TTTMK_LCKM   = {.msk = 0x80000000U, .pos = 31}; /** @brief TT Time Mark Register Locked. */
+static const field32_t FDCANx_FDCAN_TTIR_SBC     = {.msk = 0x00000001U, .pos = 0};  /** @brief Start of Basic Cycle. */
+static const field32_t FDCANx_FDCAN_TTIR_SMC     = {.msk = 0x00000002U, .pos = 1};  /** @brief Start of Matrix Cycle. */
+static const field32_t FDCANx_FDCAN_TTIR_CSM     = {.msk = 0x00000004U, .pos = 2};  /** @brief Change of Synchronization Mode. */
+static const field32_t FDCANx_FDCAN_TTIR_SOG     = {.msk = 0x00000008U, .pos = 3};  /** @brief Start of Gap. */
+static const field32_t FDCANx_FDCAN_TTIR_RTMI    = {.msk = 0x00000010U, .pos = 4};  /** @brief Register Time Mark Interrupt. */
+static const field32_t FDCANx_FDCAN_TTIR_TTMI    = {.msk = 0x00000020U, .pos = 5};  /** @brief Trigger Time Mark Event Internal. */
+static const field32_t FDCANx_FDCAN_TTIR_SWE     = {.msk = 0x00000040U, .pos = 6};  /** @brief Stop Watch Event. */
+static const field32_t FDCANx_FDCAN_TTIR_GTW     = {.msk = 0x00000080U, .pos = 7};  /** @brief Global Time Wrap. */
+static const field32_t FDCANx_FDCAN_TTIR_GTD     = {.msk = 0x00000100U, .pos = 8};  /** @brief Global Time Discontinuity. */
+static const field32_t FDCANx_FDCAN_TTIR_GTE     = {.msk = 0x00000200U, .pos = 9};  /** @brief Global Time Error. */
+static const field32_t FDCANx_FDCAN_TTIR_TXU     = {.msk = 0x00000400U, .pos = 10}; /** @brief Tx Count Underflow. */
+static const field32_t FDCANx_FDCAN_TTIR_TXO     = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx Count Overflow. */
+static const field32_t FDCANx_FDCAN_TTIR_SE1     = {.msk = 0x00001000U, .pos = 12}; /** @brief Scheduling Error 1. */
+static const field32_t FDCANx_FDCAN_TTIR_SE2     = {.msk = 0x00002000U, .pos = 13}; /** @brief Scheduling Error 2. */
+static const field32_t FDCANx_FDCAN_TTIR_ELC     = {.msk = 0x00004000U, .pos = 14}; /** @brief Error Level Changed. */
+static const field32_t FDCANx_FDCAN_TTIR_IWTG    = {.msk = 0x00008000U, .pos = 15}; /** @brief Initialization Watch Trigger. */
+static const field32_t FDCANx_FDCAN_TTIR_WT      = {.msk = 0x00010000U, .pos = 16}; /** @brief Watch Trigger. */
+static const field32_t FDCANx_FDCAN_TTIR_AW      = {.msk = 0x00020000U, .pos = 17}; /** @brief Application Watchdog. */
+static const field32_t FDCANx_FDCAN_TTIR_CER     = {.msk = 0x00040000U, .pos = 18}; /** @brief Configuration Error. */
+static const field32_t FDCANx_FDCAN_TTIE_SBCE    = {.msk = 0x00000001U, .pos = 0};  /** @brief Start of Basic Cycle Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SMCE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Start of Matrix Cycle Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_CSME    = {.msk = 0x00000004U, .pos = 2};  /** @brief Change of Synchronization Mode Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SOGE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Start of Gap Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_RTMIE   = {.msk = 0x00000010U, .pos = 4};  /** @brief Register Time Mark Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_TTMIE   = {.msk = 0x00000020U, .pos = 5};  /** @brief Trigger Time Mark Event Internal Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SWEE    = {.msk = 0x00000040U, .pos = 6};  /** @brief Stop Watch Event Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_GTWE    = {.msk = 0x00000080U, .pos = 7};  /** @brief Global Time Wrap Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_GTDE    = {.msk = 0x00000100U, .pos = 8};  /** @brief Global Time Discontinuity Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_GTEE    = {.msk = 0x00000200U, .pos = 9};  /** @brief Global Time Error Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_TXUE    = {.msk = 0x00000400U, .pos = 10}; /** @brief Tx Count Underflow Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_TXOE    = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx Count Overflow Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SE1E    = {.msk = 0x00001000U, .pos = 12}; /** @brief Scheduling Error 1 Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SE2E    = {.msk = 0x00002000U, .pos = 13}; /** @brief Scheduling Error 2 Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_ELCE    = {.msk = 0x00004000U, .pos = 14}; /** @brief Change Error Level Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_IWTGE   = {.msk = 0x00008000U, .pos = 15}; /** @brief Initialization Watch Trigger Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_WTE     = {.msk = 0x00010000U, .pos = 16}; /** @brief Watch Trigger Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_AWE     = {.msk = 0x00020000U, .pos = 17}; /** @brief Application Watchdog Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_CERE    = {.msk = 0x00040000U, .pos = 18}; /** @brief Configuration Error Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTILS_SBCL   = {.msk = 0x00000001U, .pos = 0};  /** @brief Start of Basic Cycle Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SMCL   = {.msk = 0x00000002U, .pos = 1};  /** @brief Start of Matrix Cycle Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_CSML   = {.msk = 0x00000004U, .pos = 2};  /** @brief Change of Synchronization Mode Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SOGL   = {.msk = 0x00000008U, .pos = 3};  /** @brief Start of Gap Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_RTMIL  = {.msk = 0x00000010U, .pos = 4};  /** @brief Register Time Mark Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_TTMIL  = {.msk = 0x00000020U, .pos = 5};  /** @brief Trigger Time Mark Event Internal Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SWEL   = {.msk = 0x00000040U, .pos = 6};  /** @brief Stop Watch Event Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_GTWL   = {.msk = 0x00000080U, .pos = 7};  /** @brief Global Time Wrap Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_GTDL   = {.msk = 0x00000100U, .pos = 8};  /** @brief Global Time Discontinuity Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_GTEL   = {.msk = 0x00000200U, .pos = 9};  /** @brief Global Time Error Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_TXUL   = {.msk = 0x00000400U, .pos = 10}; /** @brief Tx Count Underflow Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_TXOL   = {.msk = 0x00000800U, .pos = 11}; /** @brief Tx Count Overflow Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SE1L   = {.msk = 0x00001000U, .pos = 12}; /** @brief Scheduling Error 1 Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SE2L   = {.msk = 0x00002000U, .pos = 13}; /** @brief Scheduling Error 2 Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_ELCL   = {.msk = 0x00004000U, .pos = 14}; /** @brief Change Error Level Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_IWTGL  = {.msk = 0x00008000U, .pos = 15}; /** @brief Initialization Watch Trigger Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_WTL    = {.msk = 0x00010000U, .pos = 16}; /** @brief Watch Trigger Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_AWL    = {.msk = 0x00020000U, .pos = 17}; /** @brief Application Watchdog Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_CERL   = {.msk = 0x00040000U, .pos = 18}; /** @brief Configuration Error Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTOST_EL     = {.msk = 0x00000003U, .pos = 0};  /** @brief Error Level. */
+static const field32_t FDCANx_FDCAN_TTOST_MS     = {.msk = 0x0000000CU, .pos = 2};  /** @brief Master State. */
+static const field32_t FDCANx_FDCAN_TTOST_SYS    = {.msk = 0x00000030U, .pos = 4};  /** @brief Synchronization State. */
+static const field32_t FDCANx_FDCAN_TTOST_GTP    = {.msk = 0x00000040U, .pos = 6};  /** @brief Quality of Global Time Phase. */
+static const field32_t FDCANx_FDCAN_TTOST_QCS    = {.msk = 0x00000080U, .pos = 7};  /** @brief Quality of Clock Speed. */
+static const field32_t FDCANx_FDCAN_TTOST_RTO    = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Reference Trigger Offset. */
+static const field32_t FDCANx_FDCAN_TTOST_WGTD   = {.msk = 0x00400000U, .pos = 22}; /** @brief Wait for Global Time Discontinuity. */
+static const field32_t FDCANx_FDCAN_TTOST_GFI    = {.msk = 0x00800000U, .pos = 23}; /** @brief Gap Finished Indicator. */
+static const field32_t FDCANx_FDCAN_TTOST_TMP    = {.msk = 0x07000000U, .pos = 24}; /** @brief Time Master Priority. */
+static const field32_t FDCANx_FDCAN_TTOST_GSI    = {.msk = 0x08000000U, .pos = 27}; /** @brief Gap Started Indicator. */
+static const field32_t FDCANx_FDCAN_TTOST_WFE    = {.msk = 0x10000000U, .pos = 28}; /** @brief Wait for Event. */
+static const field32_t FDCANx_FDCAN_TTOST_AWE    = {.msk = 0x20000000U, .pos = 29}; /** @brief Application Watchdog Event. */
+static const field32_t FDCANx_FDCAN_TTOST_WECS   = {.msk = 0x40000000U, .pos = 30}; /** @brief Wait for External Clock Synchronization. */
+static const field32_t FDCANx_FDCAN_TTOST_SPL    = {.msk = 0x80000000U, .pos = 31}; /** @brief Schedule Phase Lock. */
+static const field32_t FDCANx_FDCAN_TURNA_NAV    = {.msk = 0x0003FFFFU, .pos = 0};  /** @brief Numerator Actual Value. */
+static const field32_t FDCANx_FDCAN_TTLGT_LT     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Local Time. */
+static const field32_t FDCANx_FDCAN_TTLGT_GT     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Global Time. */
+static const field32_t FDCANx_FDCAN_TTCTC_CT     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Cycle Time. */
+static const field32_t FDCANx_FDCAN_TTCTC_CC     = {.msk = 0x003F0000U, .pos = 16}; /** @brief Cycle Count. */
+static const field32_t FDCANx_FDCAN_TTCPT_CT     = {.msk = 0x0000003FU, .pos = 0};  /** @brief Cycle Count Value. */
+static const field32_t FDCANx_FDCAN_TTCPT_SWV    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Stop Watch Value. */
+static const field32_t FDCANx_FDCAN_TTCSM_CSM    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Cycle Sync Mark. */
+static const field32_t FDCANx_FDCAN_TTTS_SWTDEL  = {.msk = 0x00000003U, .pos = 0};  /** @brief Stop watch trigger input selection. */
+static const field32_t FDCANx_FDCAN_TTTS_EVTSEL  = {.msk = 0x00000030U, .pos = 4};  /** @brief Event trigger input selection. */
+
+/** @subsection Enumerated FDCANx Register Field Definitions */
+
+/** @brief Data time segment after sample point. */
+static const field32_t FDCANx_FDCAN_DBTP_DTSEGx[3] = {
+  [1] = {.msk = 0x00001F00U, .pos = 8},
+  [2] = {.msk = 0x000000F0U, .pos = 4},
+};
+
+/** @brief Rx FIFO 0 New Message. */
+static const field32_t FDCANx_FDCAN_IR_RFxN[2] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Rx FIFO 0 Full. */
+static const field32_t FDCANx_FDCAN_IR_RFxW[2] = {
+  [0] = {.msk = 0x00000002U, .pos = 1},
+  [1] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Rx FIFO 0 Full. */
+static const field32_t FDCANx_FDCAN_IR_RFxF[2] = {
+  [0] = {.msk = 0x00000004U, .pos = 2},
+  [1] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Rx FIFO 0 Message Lost. */
+static const field32_t FDCANx_FDCAN_IR_RFxL[2] = {
+  [0] = {.msk = 0x00000008U, .pos = 3},
+  [1] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Rx FIFO 0 New Message Enable. */
+static const field32_t FDCANx_FDCAN_IE_RFxNE[2] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Rx FIFO 0 Full Enable. */
+static const field32_t FDCANx_FDCAN_IE_RFxWE[2] = {
+  [0] = {.msk = 0x00000002U, .pos = 1},
+  [1] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Rx FIFO 0 Full Enable. */
+static const field32_t FDCANx_FDCAN_IE_RFxFE[2] = {
+  [0] = {.msk = 0x00000004U, .pos = 2},
+  [1] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Rx FIFO 0 Message Lost Enable. */
+static const field32_t FDCANx_FDCAN_IE_RFxLE[2] = {
+  [0] = {.msk = 0x00000008U, .pos = 3},
+  [1] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Rx FIFO 0 New Message Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RFxNL[2] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Rx FIFO 0 Watermark Reached Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RFxWL[2] = {
+  [0] = {.msk = 0x00000002U, .pos = 1},
+  [1] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Rx FIFO 0 Full Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RFxFL[2] = {
+  [0] = {.msk = 0x00000004U, .pos = 2},
+  [1] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Rx FIFO 0 Message Lost Interrupt Line. */
+static const field32_t FDCANx_FDCAN_ILS_RFxLL[2] = {
+  [0] = {.msk = 0x00000008U, .pos = 3},
+  [1] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Enable Interrupt Line 0. */
+static const field32_t FDCANx_FDCAN_ILE_EINTx[2] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT1_NDx[32] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+  [16] = {.msk = 0x00010000U, .pos = 16},
+  [17] = {.msk = 0x00020000U, .pos = 17},
+  [18] = {.msk = 0x00040000U, .pos = 18},
+  [19] = {.msk = 0x00080000U, .pos = 19},
+  [20] = {.msk = 0x00100000U, .pos = 20},
+  [21] = {.msk = 0x00200000U, .pos = 21},
+  [22] = {.msk = 0x00400000U, .pos = 22},
+  [23] = {.msk = 0x00800000U, .pos = 23},
+  [24] = {.msk = 0x01000000U, .pos = 24},
+  [25] = {.msk = 0x02000000U, .pos = 25},
+  [26] = {.msk = 0x04000000U, .pos = 26},
+  [27] = {.msk = 0x08000000U, .pos = 27},
+  [28] = {.msk = 0x10000000U, .pos = 28},
+  [29] = {.msk = 0x20000000U, .pos = 29},
+  [30] = {.msk = 0x40000000U, .pos = 30},
+  [31] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief New data. */
+static const field32_t FDCANx_FDCAN_NDAT2_NDx[64] = {
+  [32] = {.msk = 0x00000001U, .pos = 0},
+  [33] = {.msk = 0x00000002U, .pos = 1},
+  [34] = {.msk = 0x00000004U, .pos = 2},
+  [35] = {.msk = 0x00000008U, .pos = 3},
+  [36] = {.msk = 0x00000010U, .pos = 4},
+  [37] = {.msk = 0x00000020U, .pos = 5},
+  [38] = {.msk = 0x00000040U, .pos = 6},
+  [39] = {.msk = 0x00000080U, .pos = 7},
+  [40] = {.msk = 0x00000100U, .pos = 8},
+  [41] = {.msk = 0x00000200U, .pos = 9},
+  [42] = {.msk = 0x00000400U, .pos = 10},
+  [43] = {.msk = 0x00000800U, .pos = 11},
+  [44] = {.msk = 0x00001000U, .pos = 12},
+  [45] = {.msk = 0x00002000U, .pos = 13},
+  [46] = {.msk = 0x00004000U, .pos = 14},
+  [47] = {.msk = 0x00008000U, .pos = 15},
+  [48] = {.msk = 0x00010000U, .pos = 16},
+  [49] = {.msk = 0x00020000U, .pos = 17},
+  [50] = {.msk = 0x00040000U, .pos = 18},
+  [51] = {.msk = 0x00080000U, .pos = 19},
+  [52] = {.msk = 0x00100000U, .pos = 20},
+  [53] = {.msk = 0x00200000U, .pos = 21},
+  [54] = {.msk = 0x00400000U, .pos = 22},
+  [55] = {.msk = 0x00800000U, .pos = 23},
+  [56] = {.msk = 0x01000000U, .pos = 24},
+  [57] = {.msk = 0x02000000U, .pos = 25},
+  [58] = {.msk = 0x04000000U, .pos = 26},
+  [59] = {.msk = 0x08000000U, .pos = 27},
+  [60] = {.msk = 0x10000000U, .pos = 28},
+  [61] = {.msk = 0x20000000U, .pos = 29},
+  [62] = {.msk = 0x40000000U, .pos = 30},
+  [63] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Rx FIFO 1 Data Field Size:. */
+static const field32_t FDCANx_FDCAN_RXESC_FxDS[2] = {
+  [0] = {.msk = 0x00000007U, .pos = 0},
+  [1] = {.msk = 0x00000070U, .pos = 4},
+};
+
+/** @brief Scheduling Error 1. */
+static const field32_t FDCANx_FDCAN_TTIR_SEx[3] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief Scheduling Error 1 Interrupt Enable. */
+static const field32_t FDCANx_FDCAN_TTIE_SExE[3] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief Scheduling Error 1 Interrupt Line. */
+static const field32_t FDCANx_FDCAN_TTILS_SExL[3] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+};
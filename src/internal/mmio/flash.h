@@ -0,0 +1,328 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/flash.h
+ * @authors UW SARP
+ * @brief Registers and fields of FLASH.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section FLASH Definitions
+ **************************************************************************************************/
+
+/** @subsection FLASH Register Definitions */
+
+static rw_reg32_t const FLASH_ACR        = (rw_reg32_t)0x52002000U; /** @brief Access control register. */
+static rw_reg32_t const FLASH_ACR_       = (rw_reg32_t)0x52002100U; /** @brief Access control register. */
+static rw_reg32_t const FLASH_KEYR1      = (rw_reg32_t)0x52002004U; /** @brief FLASH key register for bank 1. */
+static rw_reg32_t const FLASH_OPTKEYR    = (rw_reg32_t)0x52002008U; /** @brief FLASH option key register. */
+static rw_reg32_t const FLASH_OPTKEYR_   = (rw_reg32_t)0x52002108U; /** @brief FLASH option key register. */
+static rw_reg32_t const FLASH_CR1        = (rw_reg32_t)0x5200200CU; /** @brief FLASH control register for bank 1. */
+static rw_reg32_t const FLASH_SR1        = (rw_reg32_t)0x52002010U; /** @brief FLASH status register for bank 1. */
+static rw_reg32_t const FLASH_CCR1       = (rw_reg32_t)0x52002014U; /** @brief FLASH clear control register for bank 1. */
+static rw_reg32_t const FLASH_OPTCR      = (rw_reg32_t)0x52002018U; /** @brief FLASH option control register. */
+static rw_reg32_t const FLASH_OPTCR_     = (rw_reg32_t)0x52002118U; /** @brief FLASH option control register. */
+static rw_reg32_t const FLASH_OPTSR_CUR_ = (rw_reg32_t)0x5200211CU; /** @brief FLASH option status register. */
+static rw_reg32_t const FLASH_OPTSR_CUR  = (rw_reg32_t)0x5200201CU; /** @brief FLASH option status register. */
+static rw_reg32_t const FLASH_OPTSR_PRG  = (rw_reg32_t)0x52002020U; /** @brief FLASH option status register. */
+static rw_reg32_t const FLASH_OPTSR_PRG_ = (rw_reg32_t)0x52002120U; /** @brief FLASH option status register. */
+static rw_reg32_t const FLASH_OPTCCR_    = (rw_reg32_t)0x52002124U; /** @brief FLASH option clear control register. */
+static rw_reg32_t const FLASH_OPTCCR     = (rw_reg32_t)0x52002024U; /** @brief FLASH option clear control register. */
+static ro_reg32_t const FLASH_PRAR_CUR1  = (ro_reg32_t)0x52002028U; /** @brief FLASH protection address for bank 1. */
+static rw_reg32_t const FLASH_PRAR_PRG1  = (rw_reg32_t)0x5200202CU; /** @brief FLASH protection address for bank 1. */
+static rw_reg32_t const FLASH_SCAR_CUR1  = (rw_reg32_t)0x52002030U; /** @brief FLASH secure address for bank 1. */
+static rw_reg32_t const FLASH_SCAR_PRG1  = (rw_reg32_t)0x52002034U; /** @brief FLASH secure address for bank 1. */
+static ro_reg32_t const FLASH_WPSN_CUR1R = (ro_reg32_t)0x52002038U; /** @brief FLASH write sector protection for bank 1. */
+static rw_reg32_t const FLASH_WPSN_PRG1R = (rw_reg32_t)0x5200203CU; /** @brief FLASH write sector protection for bank 1. */
+static ro_reg32_t const FLASH_BOOT_CURR  = (ro_reg32_t)0x52002040U; /** @brief FLASH register with boot address. */
+static ro_reg32_t const FLASH_BOOT_PRGR  = (ro_reg32_t)0x52002044U; /** @brief FLASH register with boot address. */
+static rw_reg32_t const FLASH_CRCDATAR   = (rw_reg32_t)0x5200205CU; /** @brief FLASH CRC data register. */
+static ro_reg32_t const FLASH_ECC_FA1R   = (ro_reg32_t)0x52002060U; /** @brief FLASH ECC fail address for bank 1. */
+static ro_reg32_t const FLASH_KEYR2      = (ro_reg32_t)0x52002104U; /** @brief FLASH key register for bank 2. */
+static rw_reg32_t const FLASH_CR2        = (rw_reg32_t)0x5200210CU; /** @brief FLASH control register for bank 2. */
+static rw_reg32_t const FLASH_SR2        = (rw_reg32_t)0x52002110U; /** @brief FLASH status register for bank 2. */
+static rw_reg32_t const FLASH_CCR2       = (rw_reg32_t)0x52002114U; /** @brief FLASH clear control register for bank 2. */
+static ro_reg32_t const FLASH_PRAR_CUR2  = (ro_reg32_t)0x52002128U; /** @brief FLASH protection address for bank 1. */
+static rw_reg32_t const FLASH_PRAR_PRG2  = (rw_reg32_t)0x5200202CU; /** @brief FLASH protection address for bank 2. */
+static rw_reg32_t const FLASH_SCAR_CUR2  = (rw_reg32_t)0x52002130U; /** @brief FLASH secure address for bank 2. */
+static rw_reg32_t const FLASH_SCAR_PRG2  = (rw_reg32_t)0x52002134U; /** @brief FLASH secure address for bank 2. */
+static ro_reg32_t const FLASH_WPSN_CUR2R = (ro_reg32_t)0x52002138U; /** @brief FLASH write sector protection for bank 2. */
+static rw_reg32_t const FLASH_WPSN_PRG2R = (rw_reg32_t)0x5200213CU; /** @brief FLASH write sector protection for bank 2. */
+static ro_reg32_t const FLASH_ECC_FA2R   = (ro_reg32_t)0x52002160U; /** @brief FLASH ECC fail address for bank 2. */
+
+/** @subsection Enumerated FLASH Register Definitions */
+
+/** @brief FLASH CRC control register for bank 1. */
+static rw_reg32_t const FLASH_CRCCRx[3] = {
+  [1] = (rw_reg32_t)0x52002050U,
+  [2] = (rw_reg32_t)0x52002150U,
+};
+
+/** @brief FLASH CRC start address register for bank 1. */
+static rw_reg32_t const FLASH_CRCSADDxR[3] = {
+  [1] = (rw_reg32_t)0x52002054U,
+  [2] = (rw_reg32_t)0x52002154U,
+};
+
+/** @brief FLASH CRC end address register for bank 1. */
+static rw_reg32_t const FLASH_CRCEADDxR[3] = {
+  [1] = (rw_reg32_t)0x52002058U,
+  [2] = (rw_reg32_t)0x52002158U,
+};
+
+/** @subsection FLASH Register Field Definitions */
+
+static const field32_t FLASH_ACR_LATENCY                = {.msk = 0x00000007U, .pos = 0};  /** @brief Read latency. */
+static const field32_t FLASH_ACR_WRHIGHFREQ             = {.msk = 0x00000030U, .pos = 4};  /** @brief Flash signal delay. */
+static const field32_t FLASH_ACR__LATENCY               = {.msk = 0x00000007U, .pos = 0};  /** @brief Read latency. */
+static const field32_t FLASH_ACR__WRHIGHFREQ            = {.msk = 0x00000030U, .pos = 4};  /** @brief Flash signal delay. */
+static const field32_t FLASH_CR1_LOCK1                  = {.msk = 0x00000001U, .pos = 0};  /** @brief Bank 1 configuration lock bit. */
+static const field32_t FLASH_CR1_PG1                    = {.msk = 0x00000002U, .pos = 1};  /** @brief Bank 1 program enable bit. */
+static const field32_t FLASH_CR1_SER1                   = {.msk = 0x00000004U, .pos = 2};  /** @brief Bank 1 sector erase request. */
+static const field32_t FLASH_CR1_BER1                   = {.msk = 0x00000008U, .pos = 3};  /** @brief Bank 1 erase request. */
+static const field32_t FLASH_CR1_PSIZE1                 = {.msk = 0x00000030U, .pos = 4};  /** @brief Bank 1 program size. */
+static const field32_t FLASH_CR1_FW1                    = {.msk = 0x00000040U, .pos = 6};  /** @brief Bank 1 write forcing control bit. */
+static const field32_t FLASH_CR1_START1                 = {.msk = 0x00000080U, .pos = 7};  /** @brief Bank 1 bank or sector erase start control bit. */
+static const field32_t FLASH_CR1_SNB1                   = {.msk = 0x00000700U, .pos = 8};  /** @brief Bank 1 sector erase selection number. */
+static const field32_t FLASH_CR1_CRC_EN                 = {.msk = 0x00008000U, .pos = 15}; /** @brief Bank 1 CRC control bit. */
+static const field32_t FLASH_CR1_EOPIE1                 = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 1 end-of-program interrupt control bit. */
+static const field32_t FLASH_CR1_WRPERRIE1              = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 1 write protection error interrupt enable bit. */
+static const field32_t FLASH_CR1_PGSERRIE1              = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 1 programming sequence error interrupt enable bit. */
+static const field32_t FLASH_CR1_STRBERRIE1             = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 1 strobe error interrupt enable bit. */
+static const field32_t FLASH_CR1_INCERRIE1              = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 1 inconsistency error interrupt enable bit. */
+static const field32_t FLASH_CR1_OPERRIE1               = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 1 write/erase error interrupt enable bit. */
+static const field32_t FLASH_CR1_RDPERRIE1              = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 1 read protection error interrupt enable bit. */
+static const field32_t FLASH_CR1_RDSERRIE1              = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 1 secure error interrupt enable bit. */
+static const field32_t FLASH_CR1_SNECCERRIE1            = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 1 ECC single correction error interrupt enable bit. */
+static const field32_t FLASH_CR1_DBECCERRIE1            = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 1 ECC double detection error interrupt enable bit. */
+static const field32_t FLASH_CR1_CRCENDIE1              = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 1 end of CRC calculation interrupt enable bit. */
+static const field32_t FLASH_SR1_BSY1                   = {.msk = 0x00000001U, .pos = 0};  /** @brief Bank 1 ongoing program flag. */
+static const field32_t FLASH_SR1_WBNE1                  = {.msk = 0x00000002U, .pos = 1};  /** @brief Bank 1 write buffer not empty flag. */
+static const field32_t FLASH_SR1_QW1                    = {.msk = 0x00000004U, .pos = 2};  /** @brief Bank 1 wait queue flag. */
+static const field32_t FLASH_SR1_CRC_BUSY1              = {.msk = 0x00000008U, .pos = 3};  /** @brief Bank 1 CRC busy flag. */
+static const field32_t FLASH_SR1_EOP1                   = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 1 end-of-program flag. */
+static const field32_t FLASH_SR1_WRPERR1                = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 1 write protection error flag. */
+static const field32_t FLASH_SR1_PGSERR1                = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 1 programming sequence error flag. */
+static const field32_t FLASH_SR1_STRBERR1               = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 1 strobe error flag. */
+static const field32_t FLASH_SR1_INCERR1                = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 1 inconsistency error flag. */
+static const field32_t FLASH_SR1_OPERR1                 = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 1 write/erase error flag. */
+static const field32_t FLASH_SR1_RDPERR1                = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 1 read protection error flag. */
+static const field32_t FLASH_SR1_RDSERR1                = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 1 secure error flag. */
+static const field32_t FLASH_SR1_SNECCERR11             = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 1 single correction error flag. */
+static const field32_t FLASH_SR1_DBECCERR1              = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 1 ECC double detection error flag. */
+static const field32_t FLASH_SR1_CRCEND1                = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 1 CRC-complete flag. */
+static const field32_t FLASH_CCR1_CLR_EOP1              = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 1 EOP1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_WRPERR1           = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 1 WRPERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_PGSERR1           = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 1 PGSERR1 flag clear bi. */
+static const field32_t FLASH_CCR1_CLR_STRBERR1          = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 1 STRBERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_INCERR1           = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 1 INCERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_OPERR1            = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 1 OPERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_RDPERR1           = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 1 RDPERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_RDSERR1           = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 1 RDSERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_SNECCERR1         = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 1 SNECCERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_DBECCERR1         = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 1 DBECCERR1 flag clear bit. */
+static const field32_t FLASH_CCR1_CLR_CRCEND1           = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 1 CRCEND1 flag clear bit. */
+static const field32_t FLASH_OPTCR_OPTLOCK              = {.msk = 0x00000001U, .pos = 0};  /** @brief FLASH_OPTCR lock option configuration bit. */
+static const field32_t FLASH_OPTCR_OPTSTART             = {.msk = 0x00000002U, .pos = 1};  /** @brief Option byte start change option configuration bit. */
+static const field32_t FLASH_OPTCR_MER                  = {.msk = 0x00000010U, .pos = 4};  /** @brief Flash mass erase enable bit. */
+static const field32_t FLASH_OPTCR_OPTCHANGEERRIE       = {.msk = 0x40000000U, .pos = 30}; /** @brief Option byte change error interrupt enable bit. */
+static const field32_t FLASH_OPTCR_SWAP_BANK            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping configuration bit. */
+static const field32_t FLASH_OPTCR__OPTLOCK             = {.msk = 0x00000001U, .pos = 0};  /** @brief FLASH_OPTCR lock option configuration bit. */
+static const field32_t FLASH_OPTCR__OPTSTART            = {.msk = 0x00000002U, .pos = 1};  /** @brief Option byte start change option configuration bit. */
+static const field32_t FLASH_OPTCR__MER                 = {.msk = 0x00000010U, .pos = 4};  /** @brief Flash mass erase enable bit. */
+static const field32_t FLASH_OPTCR__OPTCHANGEERRIE      = {.msk = 0x40000000U, .pos = 30}; /** @brief Option byte change error interrupt enable bit. */
+static const field32_t FLASH_OPTCR__SWAP_BANK           = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping configuration bit. */
+static const field32_t FLASH_OPTSR_CUR__OPT_BUSY        = {.msk = 0x00000001U, .pos = 0};  /** @brief Option byte change ongoing flag. */
+static const field32_t FLASH_OPTSR_CUR__BOR_LEV         = {.msk = 0x0000000CU, .pos = 2};  /** @brief Brownout level option status bit. */
+static const field32_t FLASH_OPTSR_CUR__IWDG1_HW        = {.msk = 0x00000010U, .pos = 4};  /** @brief IWDG1 control option status bit. */
+static const field32_t FLASH_OPTSR_CUR__NRST_STOP_D1    = {.msk = 0x00000040U, .pos = 6};  /** @brief D1 DStop entry reset option status bit. */
+static const field32_t FLASH_OPTSR_CUR__NRST_STBY_D1    = {.msk = 0x00000080U, .pos = 7};  /** @brief D1 DStandby entry reset option status bit. */
+static const field32_t FLASH_OPTSR_CUR__RDP             = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Readout protection level option status byte. */
+static const field32_t FLASH_OPTSR_CUR__FZ_IWDG_STOP    = {.msk = 0x00020000U, .pos = 17}; /** @brief IWDG Stop mode freeze option status bit. */
+static const field32_t FLASH_OPTSR_CUR__FZ_IWDG_SDBY    = {.msk = 0x00040000U, .pos = 18}; /** @brief IWDG Standby mode freeze option status bit. */
+static const field32_t FLASH_OPTSR_CUR__ST_RAM_SIZE     = {.msk = 0x00180000U, .pos = 19}; /** @brief DTCM RAM size option status. */
+static const field32_t FLASH_OPTSR_CUR__SECURITY        = {.msk = 0x00200000U, .pos = 21}; /** @brief Security enable option status bit. */
+static const field32_t FLASH_OPTSR_CUR__RSS1            = {.msk = 0x04000000U, .pos = 26}; /** @brief User option bit 1. */
+static const field32_t FLASH_OPTSR_CUR__PERSO_OK        = {.msk = 0x10000000U, .pos = 28}; /** @brief Device personalization status bit. */
+static const field32_t FLASH_OPTSR_CUR__IO_HSLV         = {.msk = 0x20000000U, .pos = 29}; /** @brief I/O high-speed at low-voltage status bit (PRODUCT_BELOW_25V). */
+static const field32_t FLASH_OPTSR_CUR__OPTCHANGEERR    = {.msk = 0x40000000U, .pos = 30}; /** @brief Option byte change error flag. */
+static const field32_t FLASH_OPTSR_CUR__SWAP_BANK_OPT   = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping option status bit. */
+static const field32_t FLASH_OPTSR_CUR_OPT_BUSY         = {.msk = 0x00000001U, .pos = 0};  /** @brief Option byte change ongoing flag. */
+static const field32_t FLASH_OPTSR_CUR_BOR_LEV          = {.msk = 0x0000000CU, .pos = 2};  /** @brief Brownout level option status bit. */
+static const field32_t FLASH_OPTSR_CUR_IWDG1_HW         = {.msk = 0x00000010U, .pos = 4};  /** @brief IWDG1 control option status bit. */
+static const field32_t FLASH_OPTSR_CUR_NRST_STOP_D1     = {.msk = 0x00000040U, .pos = 6};  /** @brief D1 DStop entry reset option status bit. */
+static const field32_t FLASH_OPTSR_CUR_NRST_STBY_D1     = {.msk = 0x00000080U, .pos = 7};  /** @brief D1 DStandby entry reset option status bit. */
+static const field32_t FLASH_OPTSR_CUR_RDP              = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Readout protection level option status byte. */
+static const field32_t FLASH_OPTSR_CUR_FZ_IWDG_STOP     = {.msk = 0x00020000U, .pos = 17}; /** @brief IWDG Stop mode freeze option status bit. */
+static const field32_t FLASH_OPTSR_CUR_FZ_IWDG_SDBY     = {.msk = 0x00040000U, .pos = 18}; /** @brief IWDG Standby mode freeze option status bit. */
+static const field32_t FLASH_OPTSR_CUR_ST_RAM_SIZE      = {.msk = 0x00180000U, .pos = 19}; /** @brief DTCM RAM size option status. */
+static const field32_t FLASH_OPTSR_CUR_SECURITY         = {.msk = 0x00200000U, .pos = 21}; /** @brief Security enable option status bit. */
+static const field32_t FLASH_OPTSR_CUR_RSS1             = {.msk = 0x04000000U, .pos = 26}; /** @brief User option bit 1. */
+static const field32_t FLASH_OPTSR_CUR_PERSO_OK         = {.msk = 0x10000000U, .pos = 28}; /** @brief Device personalization status bit. */
+static const field32_t FLASH_OPTSR_CUR_IO_HSLV          = {.msk = 0x20000000U, .pos = 29}; /** @brief I/O high-speed at low-voltage status bit (PRODUCT_BELOW_25V). */
+static const field32_t FLASH_OPTSR_CUR_OPTCHANGEERR     = {.msk = 0x40000000U, .pos = 30}; /** @brief Option byte change error flag. */
+static const field32_t FLASH_OPTSR_CUR_SWAP_BANK_OPT    = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping option status bit. */
+static const field32_t FLASH_OPTSR_PRG_BOR_LEV          = {.msk = 0x0000000CU, .pos = 2};  /** @brief BOR reset level option configuration bits. */
+static const field32_t FLASH_OPTSR_PRG_IWDG1_HW         = {.msk = 0x00000010U, .pos = 4};  /** @brief IWDG1 option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_NRST_STOP_D1     = {.msk = 0x00000040U, .pos = 6};  /** @brief Option byte erase after D1 DStop option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_NRST_STBY_D1     = {.msk = 0x00000080U, .pos = 7};  /** @brief Option byte erase after D1 DStandby option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_RDP              = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Readout protection level option configuration byte. */
+static const field32_t FLASH_OPTSR_PRG_FZ_IWDG_STOP     = {.msk = 0x00020000U, .pos = 17}; /** @brief IWDG Stop mode freeze option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_FZ_IWDG_SDBY     = {.msk = 0x00040000U, .pos = 18}; /** @brief IWDG Standby mode freeze option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_ST_RAM_SIZE      = {.msk = 0x00180000U, .pos = 19}; /** @brief DTCM size select option configuration bits. */
+static const field32_t FLASH_OPTSR_PRG_SECURITY         = {.msk = 0x00200000U, .pos = 21}; /** @brief Security option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG_RSS1             = {.msk = 0x04000000U, .pos = 26}; /** @brief User option configuration bit 1. */
+static const field32_t FLASH_OPTSR_PRG_RSS2             = {.msk = 0x08000000U, .pos = 27}; /** @brief User option configuration bit 2. */
+static const field32_t FLASH_OPTSR_PRG_IO_HSLV          = {.msk = 0x20000000U, .pos = 29}; /** @brief I/O high-speed at low-voltage (PRODUCT_BELOW_25V). */
+static const field32_t FLASH_OPTSR_PRG_SWAP_BANK_OPT    = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__BOR_LEV         = {.msk = 0x0000000CU, .pos = 2};  /** @brief BOR reset level option configuration bits. */
+static const field32_t FLASH_OPTSR_PRG__IWDG1_HW        = {.msk = 0x00000010U, .pos = 4};  /** @brief IWDG1 option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__NRST_STOP_D1    = {.msk = 0x00000040U, .pos = 6};  /** @brief Option byte erase after D1 DStop option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__NRST_STBY_D1    = {.msk = 0x00000080U, .pos = 7};  /** @brief Option byte erase after D1 DStandby option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__RDP             = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Readout protection level option configuration byte. */
+static const field32_t FLASH_OPTSR_PRG__FZ_IWDG_STOP    = {.msk = 0x00020000U, .pos = 17}; /** @brief IWDG Stop mode freeze option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__FZ_IWDG_SDBY    = {.msk = 0x00040000U, .pos = 18}; /** @brief IWDG Standby mode freeze option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__ST_RAM_SIZE     = {.msk = 0x00180000U, .pos = 19}; /** @brief DTCM size select option configuration bits. */
+static const field32_t FLASH_OPTSR_PRG__SECURITY        = {.msk = 0x00200000U, .pos = 21}; /** @brief Security option configuration bit. */
+static const field32_t FLASH_OPTSR_PRG__RSS1            = {.msk = 0x04000000U, .pos = 26}; /** @brief User option configuration bit 1. */
+static const field32_t FLASH_OPTSR_PRG__RSS2            = {.msk = 0x08000000U, .pos = 27}; /** @brief User option configuration bit 2. */
+static const field32_t FLASH_OPTSR_PRG__IO_HSLV         = {.msk = 0x20000000U, .pos = 29}; /** @brief I/O high-speed at low-voltage (PRODUCT_BELOW_25V). */
+static const field32_t FLASH_OPTSR_PRG__SWAP_BANK_OPT   = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank swapping option configuration bit. */
+static const field32_t FLASH_OPTCCR__CLR_OPTCHANGEERR   = {.msk = 0x40000000U, .pos = 30}; /** @brief OPTCHANGEERR reset bit. */
+static const field32_t FLASH_OPTCCR_CLR_OPTCHANGEERR    = {.msk = 0x40000000U, .pos = 30}; /** @brief OPTCHANGEERR reset bit. */
+static const field32_t FLASH_PRAR_CUR1_PROT_AREA_START1 = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 1 lowest PCROP protected address. */
+static const field32_t FLASH_PRAR_CUR1_PROT_AREA_END1   = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 1 highest PCROP protected address. */
+static const field32_t FLASH_PRAR_CUR1_DMEP1            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 1 PCROP protected erase enable option status bit. */
+static const field32_t FLASH_PRAR_PRG1_PROT_AREA_START1 = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 1 lowest PCROP protected address configuration. */
+static const field32_t FLASH_PRAR_PRG1_PROT_AREA_END1   = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 1 highest PCROP protected address configuration. */
+static const field32_t FLASH_PRAR_PRG1_DMEP1            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 1 PCROP protected erase enable option configuration bit. */
+static const field32_t FLASH_SCAR_CUR1_SEC_AREA_START1  = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 1 lowest secure protected address. */
+static const field32_t FLASH_SCAR_CUR1_SEC_AREA_END1    = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 1 highest secure protected address. */
+static const field32_t FLASH_SCAR_CUR1_DMES1            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 1 secure protected erase enable option status bit. */
+static const field32_t FLASH_SCAR_PRG1_SEC_AREA_START1  = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 1 lowest secure protected address configuration. */
+static const field32_t FLASH_SCAR_PRG1_SEC_AREA_END1    = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 1 highest secure protected address configuration. */
+static const field32_t FLASH_SCAR_PRG1_DMES1            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 1 secure protected erase enable option configuration bit. */
+static const field32_t FLASH_WPSN_CUR1R_WRPSN1          = {.msk = 0x000000FFU, .pos = 0};  /** @brief Bank 1 sector write protection option status byte. */
+static const field32_t FLASH_WPSN_PRG1R_WRPSN1          = {.msk = 0x000000FFU, .pos = 0};  /** @brief Bank 1 sector write protection configuration byte. */
+static const field32_t FLASH_BOOT_CURR_BOOT_ADD0        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Boot address 0. */
+static const field32_t FLASH_BOOT_CURR_BOOT_ADD1        = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Boot address 1. */
+static const field32_t FLASH_BOOT_PRGR_BOOT_ADD0        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Boot address 0. */
+static const field32_t FLASH_BOOT_PRGR_BOOT_ADD1        = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Boot address 1. */
+static const field32_t FLASH_ECC_FA1R_FAIL_ECC_ADDR1    = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Bank 1 ECC error address. */
+static const field32_t FLASH_CR2_LOCK2                  = {.msk = 0x00000001U, .pos = 0};  /** @brief Bank 2 configuration lock bit. */
+static const field32_t FLASH_CR2_PG2                    = {.msk = 0x00000002U, .pos = 1};  /** @brief Bank 2 program enable bit. */
+static const field32_t FLASH_CR2_SER2                   = {.msk = 0x00000004U, .pos = 2};  /** @brief Bank 2 sector erase request. */
+static const field32_t FLASH_CR2_BER2                   = {.msk = 0x00000008U, .pos = 3};  /** @brief Bank 2 erase request. */
+static const field32_t FLASH_CR2_PSIZE2                 = {.msk = 0x00000030U, .pos = 4};  /** @brief Bank 2 program size. */
+static const field32_t FLASH_CR2_FW2                    = {.msk = 0x00000040U, .pos = 6};  /** @brief Bank 2 write forcing control bit. */
+static const field32_t FLASH_CR2_START2                 = {.msk = 0x00000080U, .pos = 7};  /** @brief Bank 2 bank or sector erase start control bit. */
+static const field32_t FLASH_CR2_SNB2                   = {.msk = 0x00000700U, .pos = 8};  /** @brief Bank 2 sector erase selection number. */
+static const field32_t FLASH_CR2_CRC_EN                 = {.msk = 0x00008000U, .pos = 15}; /** @brief Bank 2 CRC control bit. */
+static const field32_t FLASH_CR2_EOPIE2                 = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 2 end-of-program interrupt control bit. */
+static const field32_t FLASH_CR2_WRPERRIE2              = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 2 write protection error interrupt enable bit. */
+static const field32_t FLASH_CR2_PGSERRIE2              = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 2 programming sequence error interrupt enable bit. */
+static const field32_t FLASH_CR2_STRBERRIE2             = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 2 strobe error interrupt enable bit. */
+static const field32_t FLASH_CR2_INCERRIE2              = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 2 inconsistency error interrupt enable bit. */
+static const field32_t FLASH_CR2_OPERRIE2               = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 2 write/erase error interrupt enable bit. */
+static const field32_t FLASH_CR2_RDPERRIE2              = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 2 read protection error interrupt enable bit. */
+static const field32_t FLASH_CR2_RDSERRIE2              = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 2 secure error interrupt enable bit. */
+static const field32_t FLASH_CR2_SNECCERRIE2            = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 2 ECC single correction error interrupt enable bit. */
+static const field32_t FLASH_CR2_DBECCERRIE2            = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 2 ECC double detection error interrupt enable bit. */
+static const field32_t FLASH_CR2_CRCENDIE2              = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 2 end of CRC calculation interrupt enable bit. */
+static const field32_t FLASH_SR2_BSY2                   = {.msk = 0x00000001U, .pos = 0};  /** @brief Bank 2 ongoing program flag. */
+static const field32_t FLASH_SR2_WBNE2                  = {.msk = 0x00000002U, .pos = 1};  /** @brief Bank 2 write buffer not empty flag. */
+static const field32_t FLASH_SR2_QW2                    = {.msk = 0x00000004U, .pos = 2};  /** @brief Bank 2 wait queue flag. */
+static const field32_t FLASH_SR2_CRC_BUSY2              = {.msk = 0x00000008U, .pos = 3};  /** @brief Bank 2 CRC busy flag. */
+static const field32_t FLASH_SR2_EOP2                   = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 2 end-of-program flag. */
+static const field32_t FLASH_SR2_WRPERR2                = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 2 write protection error flag. */
+static const field32_t FLASH_SR2_PGSERR2                = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 2 programming sequence error flag. */
+static const field32_t FLASH_SR2_STRBERR2               = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 2 strobe error flag. */
+static const field32_t FLASH_SR2_INCERR2                = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 2 inconsistency error flag. */
+static const field32_t FLASH_SR2_OPERR2                 = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 2 write/erase error flag. */
+static const field32_t FLASH_SR2_RDPERR2                = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 2 read protection error flag. */
+static const field32_t FLASH_SR2_RDSERR2                = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 2 secure error flag. */
+static const field32_t FLASH_SR2_SNECCERR2              = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 2 single correction error flag. */
+static const field32_t FLASH_SR2_DBECCERR2              = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 2 ECC double detection error flag. */
+static const field32_t FLASH_SR2_CRCEND2                = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 2 CRC-complete flag. */
+static const field32_t FLASH_CCR2_CLR_EOP2              = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 1 EOP1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_WRPERR2           = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 2 WRPERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_PGSERR2           = {.msk = 0x00040000U, .pos = 18}; /** @brief Bank 2 PGSERR1 flag clear bi. */
+static const field32_t FLASH_CCR2_CLR_STRBERR2          = {.msk = 0x00080000U, .pos = 19}; /** @brief Bank 2 STRBERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_INCERR2           = {.msk = 0x00200000U, .pos = 21}; /** @brief Bank 2 INCERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_OPERR2            = {.msk = 0x00400000U, .pos = 22}; /** @brief Bank 2 OPERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_RDPERR2           = {.msk = 0x00800000U, .pos = 23}; /** @brief Bank 2 RDPERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_RDSERR1           = {.msk = 0x01000000U, .pos = 24}; /** @brief Bank 1 RDSERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_SNECCERR2         = {.msk = 0x02000000U, .pos = 25}; /** @brief Bank 2 SNECCERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_DBECCERR1         = {.msk = 0x04000000U, .pos = 26}; /** @brief Bank 1 DBECCERR1 flag clear bit. */
+static const field32_t FLASH_CCR2_CLR_CRCEND2           = {.msk = 0x08000000U, .pos = 27}; /** @brief Bank 2 CRCEND1 flag clear bit. */
+static const field32_t FLASH_PRAR_CUR2_PROT_AREA_START2 = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 2 lowest PCROP protected address. */
+static const field32_t FLASH_PRAR_CUR2_PROT_AREA_END2   = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 2 highest PCROP protected address. */
+static const field32_t FLASH_PRAR_CUR2_DMEP2            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 2 PCROP protected erase enable option status bit. */
+static const field32_t FLASH_PRAR_PRG2_PROT_AREA_START2 = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 2 lowest PCROP protected address configuration. */
+static const field32_t FLASH_PRAR_PRG2_PROT_AREA_END2   = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 2 highest PCROP protected address configuration. */
+static const field32_t FLASH_PRAR_PRG2_DMEP2            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 2 PCROP protected erase enable option configuration bit. */
+static const field32_t FLASH_SCAR_CUR2_SEC_AREA_START2  = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 2 lowest secure protected address. */
+static const field32_t FLASH_SCAR_CUR2_SEC_AREA_END2    = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 2 highest secure protected address. */
+static const field32_t FLASH_SCAR_CUR2_DMES2            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 2 secure protected erase enable option status bit. */
+static const field32_t FLASH_SCAR_PRG2_SEC_AREA_START2  = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bank 2 lowest secure protected address configuration. */
+static const field32_t FLASH_SCAR_PRG2_SEC_AREA_END2    = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bank 2 highest secure protected address configuration. */
+static const field32_t FLASH_SCAR_PRG2_DMES2            = {.msk = 0x80000000U, .pos = 31}; /** @brief Bank 2 secure protected erase enable option configuration bit. */
+static const field32_t FLASH_WPSN_CUR2R_WRPSN2          = {.msk = 0x000000FFU, .pos = 0};  /** @brief Bank 2 sector write protection option status byte. */
+static const field32_t FLASH_WPSN_PRG2R_WRPSN2          = {.msk = 0x000000FFU, .pos = 0};  /** @brief Bank 2 sector write protection configuration byte. */
+static const field32_t FLASH_ECC_FA2R_FAIL_ECC_ADDR2    = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Bank 2 ECC error address. */
+static const field32_t FLASH_CRCCRx_CRC_SECT            = {.msk = 0x00000007U, .pos = 0};  /** @brief Bank 1 CRC sector number. */
+static const field32_t FLASH_CRCCRx_ALL_BANK            = {.msk = 0x00000080U, .pos = 7};  /** @brief Bank 1 CRC select bit. */
+static const field32_t FLASH_CRCCRx_CRC_BY_SECT         = {.msk = 0x00000100U, .pos = 8};  /** @brief Bank 1 CRC sector mode select bit. */
+static const field32_t FLASH_CRCCRx_ADD_SECT            = {.msk = 0x00000200U, .pos = 9};  /** @brief Bank 1 CRC sector select bit. */
+static const field32_t FLASH_CRCCRx_CLEAN_SECT          = {.msk = 0x00000400U, .pos = 10}; /** @brief Bank 1 CRC sector list clear bit. */
+static const field32_t FLASH_CRCCRx_START_CRC           = {.msk = 0x00010000U, .pos = 16}; /** @brief Bank 1 CRC start bit. */
+static const field32_t FLASH_CRCCRx_CLEAN_CRC           = {.msk = 0x00020000U, .pos = 17}; /** @brief Bank 1 CRC clear bit. */
+static const field32_t FLASH_CRCCRx_CRC_BURST           = {.msk = 0x00300000U, .pos = 20}; /** @brief Bank 1 CRC burst size. */
+
+/** @subsection Enumerated FLASH Register Field Definitions */
+
+/** @brief User option configuration bit 1. */
+static const field32_t FLASH_OPTSR_PRG_RSSx[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief User option configuration bit 1. */
+static const field32_t FLASH_OPTSR_PRG__RSSx[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Boot address 0. */
+static const field32_t FLASH_BOOT_CURR_BOOT_ADDx[2] = {
+  [0] = {.msk = 0x0000FFFFU, .pos = 0},
+  [1] = {.msk = 0xFFFF0000U, .pos = 16},
+};
+
+/** @brief Boot address 0. */
+static const field32_t FLASH_BOOT_PRGR_BOOT_ADDx[2] = {
+  [0] = {.msk = 0x0000FFFFU, .pos = 0},
+  [1] = {.msk = 0xFFFF0000U, .pos = 16},
+};
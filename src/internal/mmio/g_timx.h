@@ -0,0 +1,574 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/g_timx.h
+ * @authors UW SARP
+ * @brief Registers and fields of TIM2, TIM3, TIM4, TIM5, TIM12, TIM13, TIM14.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section G_TIMx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated G_TIMx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const G_TIMx_CR1[15] = {
+  [2]  = (rw_reg32_t)0x40000000U,
+  [3]  = (rw_reg32_t)0x40000400U,
+  [4]  = (rw_reg32_t)0x40000800U,
+  [5]  = (rw_reg32_t)0x40000C00U,
+  [12] = (rw_reg32_t)0x40001800U,
+  [13] = (rw_reg32_t)0x40001C00U,
+  [14] = (rw_reg32_t)0x40002000U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const G_TIMx_CR2[15] = {
+  [2]  = (rw_reg32_t)0x40000004U,
+  [3]  = (rw_reg32_t)0x40000404U,
+  [4]  = (rw_reg32_t)0x40000804U,
+  [5]  = (rw_reg32_t)0x40000C04U,
+  [12] = (rw_reg32_t)0x40001804U,
+  [13] = (rw_reg32_t)0x40001C04U,
+  [14] = (rw_reg32_t)0x40002004U,
+};
+
+/** @brief Slave mode control register. */
+static rw_reg32_t const G_TIMx_SMCR[15] = {
+  [2]  = (rw_reg32_t)0x40000008U,
+  [3]  = (rw_reg32_t)0x40000408U,
+  [4]  = (rw_reg32_t)0x40000808U,
+  [5]  = (rw_reg32_t)0x40000C08U,
+  [12] = (rw_reg32_t)0x40001808U,
+  [13] = (rw_reg32_t)0x40001C08U,
+  [14] = (rw_reg32_t)0x40002008U,
+};
+
+/** @brief DMA/Interrupt enable register. */
+static rw_reg32_t const G_TIMx_DIER[15] = {
+  [2]  = (rw_reg32_t)0x4000000CU,
+  [3]  = (rw_reg32_t)0x4000040CU,
+  [4]  = (rw_reg32_t)0x4000080CU,
+  [5]  = (rw_reg32_t)0x40000C0CU,
+  [12] = (rw_reg32_t)0x4000180CU,
+  [13] = (rw_reg32_t)0x40001C0CU,
+  [14] = (rw_reg32_t)0x4000200CU,
+};
+
+/** @brief Status register. */
+static rw_reg32_t const G_TIMx_SR[15] = {
+  [2]  = (rw_reg32_t)0x40000010U,
+  [3]  = (rw_reg32_t)0x40000410U,
+  [4]  = (rw_reg32_t)0x40000810U,
+  [5]  = (rw_reg32_t)0x40000C10U,
+  [12] = (rw_reg32_t)0x40001810U,
+  [13] = (rw_reg32_t)0x40001C10U,
+  [14] = (rw_reg32_t)0x40002010U,
+};
+
+/** @brief Event generation register. */
+static rw_reg32_t const G_TIMx_EGR[15] = {
+  [2]  = (rw_reg32_t)0x40000014U,
+  [3]  = (rw_reg32_t)0x40000414U,
+  [4]  = (rw_reg32_t)0x40000814U,
+  [5]  = (rw_reg32_t)0x40000C14U,
+  [12] = (rw_reg32_t)0x40001814U,
+  [13] = (rw_reg32_t)0x40001C14U,
+  [14] = (rw_reg32_t)0x40002014U,
+};
+
+/** @brief Capture/compare mode register 1 (output mode). */
+static rw_reg32_t const G_TIMx_CCMR1_OUTPUT[15] = {
+  [2]  = (rw_reg32_t)0x40000018U,
+  [3]  = (rw_reg32_t)0x40000418U,
+  [4]  = (rw_reg32_t)0x40000818U,
+  [5]  = (rw_reg32_t)0x40000C18U,
+  [12] = (rw_reg32_t)0x40001818U,
+  [13] = (rw_reg32_t)0x40001C18U,
+  [14] = (rw_reg32_t)0x40002018U,
+};
+
+/** @brief Capture/compare mode register 1 (input mode). */
+static rw_reg32_t const G_TIMx_CCMR1_INPUT[15] = {
+  [2]  = (rw_reg32_t)0x40000018U,
+  [3]  = (rw_reg32_t)0x40000418U,
+  [4]  = (rw_reg32_t)0x40000818U,
+  [5]  = (rw_reg32_t)0x40000C18U,
+  [12] = (rw_reg32_t)0x40001818U,
+  [13] = (rw_reg32_t)0x40001C18U,
+  [14] = (rw_reg32_t)0x40002018U,
+};
+
+/** @brief Capture/compare mode register 2 (output mode). */
+static rw_reg32_t const G_TIMx_CCMR2_OUTPUT[15] = {
+  [2]  = (rw_reg32_t)0x4000001CU,
+  [3]  = (rw_reg32_t)0x4000041CU,
+  [4]  = (rw_reg32_t)0x4000081CU,
+  [5]  = (rw_reg32_t)0x40000C1CU,
+  [12] = (rw_reg32_t)0x4000181CU,
+  [13] = (rw_reg32_t)0x40001C1CU,
+  [14] = (rw_reg32_t)0x4000201CU,
+};
+
+/** @brief Capture/compare mode register 2 (input mode). */
+static rw_reg32_t const G_TIMx_CCMR2_INPUT[15] = {
+  [2]  = (rw_reg32_t)0x4000001CU,
+  [3]  = (rw_reg32_t)0x4000041CU,
+  [4]  = (rw_reg32_t)0x4000081CU,
+  [5]  = (rw_reg32_t)0x40000C1CU,
+  [12] = (rw_reg32_t)0x4000181CU,
+  [13] = (rw_reg32_t)0x40001C1CU,
+  [14] = (rw_reg32_t)0x4000201CU,
+};
+
+/** @brief Capture/compare enable register. */
+static rw_reg32_t const G_TIMx_CCER[15] = {
+  [2]  = (rw_reg32_t)0x40000020U,
+  [3]  = (rw_reg32_t)0x40000420U,
+  [4]  = (rw_reg32_t)0x40000820U,
+  [5]  = (rw_reg32_t)0x40000C20U,
+  [12] = (rw_reg32_t)0x40001820U,
+  [13] = (rw_reg32_t)0x40001C20U,
+  [14] = (rw_reg32_t)0x40002020U,
+};
+
+/** @brief Counter. */
+static rw_reg32_t const G_TIMx_CNT[15] = {
+  [2]  = (rw_reg32_t)0x40000024U,
+  [3]  = (rw_reg32_t)0x40000424U,
+  [4]  = (rw_reg32_t)0x40000824U,
+  [5]  = (rw_reg32_t)0x40000C24U,
+  [12] = (rw_reg32_t)0x40001824U,
+  [13] = (rw_reg32_t)0x40001C24U,
+  [14] = (rw_reg32_t)0x40002024U,
+};
+
+/** @brief Prescaler. */
+static rw_reg32_t const G_TIMx_PSC[15] = {
+  [2]  = (rw_reg32_t)0x40000028U,
+  [3]  = (rw_reg32_t)0x40000428U,
+  [4]  = (rw_reg32_t)0x40000828U,
+  [5]  = (rw_reg32_t)0x40000C28U,
+  [12] = (rw_reg32_t)0x40001828U,
+  [13] = (rw_reg32_t)0x40001C28U,
+  [14] = (rw_reg32_t)0x40002028U,
+};
+
+/** @brief Auto-reload register. */
+static rw_reg32_t const G_TIMx_ARR[15] = {
+  [2]  = (rw_reg32_t)0x4000002CU,
+  [3]  = (rw_reg32_t)0x4000042CU,
+  [4]  = (rw_reg32_t)0x4000082CU,
+  [5]  = (rw_reg32_t)0x40000C2CU,
+  [12] = (rw_reg32_t)0x4000182CU,
+  [13] = (rw_reg32_t)0x40001C2CU,
+  [14] = (rw_reg32_t)0x4000202CU,
+};
+
+/** @brief Capture/compare register 1. */
+static rw_reg32_t const G_TIMx_CCR1[15] = {
+  [2]  = (rw_reg32_t)0x40000034U,
+  [3]  = (rw_reg32_t)0x40000434U,
+  [4]  = (rw_reg32_t)0x40000834U,
+  [5]  = (rw_reg32_t)0x40000C34U,
+  [12] = (rw_reg32_t)0x40001834U,
+  [13] = (rw_reg32_t)0x40001C34U,
+  [14] = (rw_reg32_t)0x40002034U,
+};
+
+/** @brief Capture/compare register 2. */
+static rw_reg32_t const G_TIMx_CCR2[15] = {
+  [2]  = (rw_reg32_t)0x40000038U,
+  [3]  = (rw_reg32_t)0x40000438U,
+  [4]  = (rw_reg32_t)0x40000838U,
+  [5]  = (rw_reg32_t)0x40000C38U,
+  [12] = (rw_reg32_t)0x40001838U,
+  [13] = (rw_reg32_t)0x40001C38U,
+  [14] = (rw_reg32_t)0x40002038U,
+};
+
+/** @brief Capture/compare register 3. */
+static rw_reg32_t const G_TIMx_CCR3[15] = {
+  [2]  = (rw_reg32_t)0x4000003CU,
+  [3]  = (rw_reg32_t)0x4000043CU,
+  [4]  = (rw_reg32_t)0x4000083CU,
+  [5]  = (rw_reg32_t)0x40000C3CU,
+  [12] = (rw_reg32_t)0x4000183CU,
+  [13] = (rw_reg32_t)0x40001C3CU,
+  [14] = (rw_reg32_t)0x4000203CU,
+};
+
+/** @brief Capture/compare register 4. */
+static rw_reg32_t const G_TIMx_CCR4[15] = {
+  [2]  = (rw_reg32_t)0x40000040U,
+  [3]  = (rw_reg32_t)0x40000440U,
+  [4]  = (rw_reg32_t)0x40000840U,
+  [5]  = (rw_reg32_t)0x40000C40U,
+  [12] = (rw_reg32_t)0x40001840U,
+  [13] = (rw_reg32_t)0x40001C40U,
+  [14] = (rw_reg32_t)0x40002040U,
+};
+
+/** @brief DMA control register. */
+static rw_reg32_t const G_TIMx_DCR[15] = {
+  [2]  = (rw_reg32_t)0x40000048U,
+  [3]  = (rw_reg32_t)0x40000448U,
+  [4]  = (rw_reg32_t)0x40000848U,
+  [5]  = (rw_reg32_t)0x40000C48U,
+  [12] = (rw_reg32_t)0x40001848U,
+  [13] = (rw_reg32_t)0x40001C48U,
+  [14] = (rw_reg32_t)0x40002048U,
+};
+
+/** @brief DMA address for full transfer. */
+static rw_reg32_t const G_TIMx_DMAR[15] = {
+  [2]  = (rw_reg32_t)0x4000004CU,
+  [3]  = (rw_reg32_t)0x4000044CU,
+  [4]  = (rw_reg32_t)0x4000084CU,
+  [5]  = (rw_reg32_t)0x40000C4CU,
+  [12] = (rw_reg32_t)0x4000184CU,
+  [13] = (rw_reg32_t)0x40001C4CU,
+  [14] = (rw_reg32_t)0x4000204CU,
+};
+
+/** @brief TIM alternate function option register 1. */
+static rw_reg32_t const G_TIMx_AF1[15] = {
+  [2]  = (rw_reg32_t)0x40000060U,
+  [3]  = (rw_reg32_t)0x40000460U,
+  [4]  = (rw_reg32_t)0x40000860U,
+  [5]  = (rw_reg32_t)0x40000C60U,
+  [12] = (rw_reg32_t)0x40001860U,
+  [13] = (rw_reg32_t)0x40001C60U,
+  [14] = (rw_reg32_t)0x40002060U,
+};
+
+/** @brief TIM timer input selection register. */
+static rw_reg32_t const G_TIMx_TISEL[15] = {
+  [2]  = (rw_reg32_t)0x40000068U,
+  [3]  = (rw_reg32_t)0x40000468U,
+  [4]  = (rw_reg32_t)0x40000868U,
+  [5]  = (rw_reg32_t)0x40000C68U,
+  [12] = (rw_reg32_t)0x40001868U,
+  [13] = (rw_reg32_t)0x40001C68U,
+  [14] = (rw_reg32_t)0x40002068U,
+};
+
+/** @subsection G_TIMx Register Field Definitions */
+
+static const field32_t G_TIMx_CR1_UIFREMAP        = {.msk = 0x00000800U, .pos = 11}; /** @brief UIF status bit remapping. */
+static const field32_t G_TIMx_CR1_CKD             = {.msk = 0x00000300U, .pos = 8};  /** @brief Clock division. */
+static const field32_t G_TIMx_CR1_ARPE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Auto-reload preload enable. */
+static const field32_t G_TIMx_CR1_CMS             = {.msk = 0x00000060U, .pos = 5};  /** @brief Center-aligned mode selection. */
+static const field32_t G_TIMx_CR1_DIR             = {.msk = 0x00000010U, .pos = 4};  /** @brief Direction. */
+static const field32_t G_TIMx_CR1_OPM             = {.msk = 0x00000008U, .pos = 3};  /** @brief One-pulse mode. */
+static const field32_t G_TIMx_CR1_URS             = {.msk = 0x00000004U, .pos = 2};  /** @brief Update request source. */
+static const field32_t G_TIMx_CR1_UDIS            = {.msk = 0x00000002U, .pos = 1};  /** @brief Update disable. */
+static const field32_t G_TIMx_CR1_CEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief Counter enable. */
+static const field32_t G_TIMx_CR2_TI1S            = {.msk = 0x00000080U, .pos = 7};  /** @brief TI1 selection. */
+static const field32_t G_TIMx_CR2_MMS             = {.msk = 0x00000070U, .pos = 4};  /** @brief Master mode selection. */
+static const field32_t G_TIMx_CR2_CCDS            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare DMA selection. */
+static const field32_t G_TIMx_SMCR_TS_4_3         = {.msk = 0x00300000U, .pos = 20}; /** @brief Trigger selection. */
+static const field32_t G_TIMx_SMCR_SMS_3          = {.msk = 0x00010000U, .pos = 16}; /** @brief Slave mode selection - bit 3. */
+static const field32_t G_TIMx_SMCR_ETP            = {.msk = 0x00008000U, .pos = 15}; /** @brief External trigger polarity. */
+static const field32_t G_TIMx_SMCR_ECE            = {.msk = 0x00004000U, .pos = 14}; /** @brief External clock enable. */
+static const field32_t G_TIMx_SMCR_ETPS           = {.msk = 0x00003000U, .pos = 12}; /** @brief External trigger prescaler. */
+static const field32_t G_TIMx_SMCR_ETF            = {.msk = 0x00000F00U, .pos = 8};  /** @brief External trigger filter. */
+static const field32_t G_TIMx_SMCR_MSM            = {.msk = 0x00000080U, .pos = 7};  /** @brief Master/Slave mode. */
+static const field32_t G_TIMx_SMCR_TS             = {.msk = 0x00000070U, .pos = 4};  /** @brief Trigger selection. */
+static const field32_t G_TIMx_SMCR_SMS            = {.msk = 0x00000007U, .pos = 0};  /** @brief Slave mode selection. */
+static const field32_t G_TIMx_DIER_TDE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Trigger DMA request enable. */
+static const field32_t G_TIMx_DIER_CC4DE          = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 DMA request enable. */
+static const field32_t G_TIMx_DIER_CC3DE          = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 DMA request enable. */
+static const field32_t G_TIMx_DIER_CC2DE          = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/Compare 2 DMA request enable. */
+static const field32_t G_TIMx_DIER_CC1DE          = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t G_TIMx_DIER_UDE            = {.msk = 0x00000100U, .pos = 8};  /** @brief Update DMA request enable. */
+static const field32_t G_TIMx_DIER_TIE            = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt enable. */
+static const field32_t G_TIMx_DIER_CC4IE          = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 4 interrupt enable. */
+static const field32_t G_TIMx_DIER_CC3IE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 3 interrupt enable. */
+static const field32_t G_TIMx_DIER_CC2IE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt enable. */
+static const field32_t G_TIMx_DIER_CC1IE          = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t G_TIMx_DIER_UIE            = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt enable. */
+static const field32_t G_TIMx_SR_CC4OF            = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 overcapture flag. */
+static const field32_t G_TIMx_SR_CC3OF            = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 overcapture flag. */
+static const field32_t G_TIMx_SR_CC2OF            = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/compare 2 overcapture flag. */
+static const field32_t G_TIMx_SR_CC1OF            = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t G_TIMx_SR_TIF              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt flag. */
+static const field32_t G_TIMx_SR_CC4IF            = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 4 interrupt flag. */
+static const field32_t G_TIMx_SR_CC3IF            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 3 interrupt flag. */
+static const field32_t G_TIMx_SR_CC2IF            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt flag. */
+static const field32_t G_TIMx_SR_CC1IF            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 interrupt flag. */
+static const field32_t G_TIMx_SR_UIF              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt flag. */
+static const field32_t G_TIMx_EGR_TG              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger generation. */
+static const field32_t G_TIMx_EGR_CC4G            = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/compare 4 generation. */
+static const field32_t G_TIMx_EGR_CC3G            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare 3 generation. */
+static const field32_t G_TIMx_EGR_CC2G            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare 2 generation. */
+static const field32_t G_TIMx_EGR_CC1G            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 generation. */
+static const field32_t G_TIMx_EGR_UG              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update generation. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_CC1S   = {.msk = 0x00000003U, .pos = 0};  /** @brief CC1S. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC1FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief OC1FE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC1PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief OC1PE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC1M   = {.msk = 0x00000070U, .pos = 4};  /** @brief OC1M. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC1CE  = {.msk = 0x00000080U, .pos = 7};  /** @brief OC1CE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_CC2S   = {.msk = 0x00000300U, .pos = 8};  /** @brief CC2S. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC2FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief OC2FE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC2PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief OC2PE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC2M   = {.msk = 0x00007000U, .pos = 12}; /** @brief OC2M. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC2CE  = {.msk = 0x00008000U, .pos = 15}; /** @brief OC2CE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC1M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 1 mode - bit 3. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OC2M_3 = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 2 mode - bit 3. */
+static const field32_t G_TIMx_CCMR1_INPUT_IC2F    = {.msk = 0x0000F000U, .pos = 12}; /** @brief Input capture 2 filter. */
+static const field32_t G_TIMx_CCMR1_INPUT_IC2PCS  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Input capture 2 prescaler. */
+static const field32_t G_TIMx_CCMR1_INPUT_CC2S    = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 2 selection. */
+static const field32_t G_TIMx_CCMR1_INPUT_IC1F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 1 filter. */
+static const field32_t G_TIMx_CCMR1_INPUT_ICPCS   = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 1 prescaler. */
+static const field32_t G_TIMx_CCMR1_INPUT_CC1S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC4M_3 = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 2 mode - bit 3. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC3M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 1 mode - bit 3. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC4CE  = {.msk = 0x00008000U, .pos = 15}; /** @brief OC4CE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC4M   = {.msk = 0x00007000U, .pos = 12}; /** @brief OC4M. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC4PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief OC4PE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC4FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief OC4FE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_CC4S   = {.msk = 0x00000300U, .pos = 8};  /** @brief CC4S. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC3CE  = {.msk = 0x00000080U, .pos = 7};  /** @brief OC3CE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC3M   = {.msk = 0x00000070U, .pos = 4};  /** @brief OC3M. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC3PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief OC3PE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OC3FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief OC3FE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_CC3S   = {.msk = 0x00000003U, .pos = 0};  /** @brief CC3S. */
+static const field32_t G_TIMx_CCMR2_INPUT_IC4F    = {.msk = 0x0000F000U, .pos = 12}; /** @brief Input capture 4 filter. */
+static const field32_t G_TIMx_CCMR2_INPUT_IC4PSC  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Input capture 4 prescaler. */
+static const field32_t G_TIMx_CCMR2_INPUT_CC4S    = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 4 selection. */
+static const field32_t G_TIMx_CCMR2_INPUT_IC3F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 3 filter. */
+static const field32_t G_TIMx_CCMR2_INPUT_IC3PSC  = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 3 prescaler. */
+static const field32_t G_TIMx_CCMR2_INPUT_CC3S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/compare 3 selection. */
+static const field32_t G_TIMx_CCER_CC4NP          = {.msk = 0x00008000U, .pos = 15}; /** @brief Capture/Compare 4 output Polarity. */
+static const field32_t G_TIMx_CCER_CC4P           = {.msk = 0x00002000U, .pos = 13}; /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t G_TIMx_CCER_CC4E           = {.msk = 0x00001000U, .pos = 12}; /** @brief Capture/Compare 4 output enable. */
+static const field32_t G_TIMx_CCER_CC3NP          = {.msk = 0x00000800U, .pos = 11}; /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t G_TIMx_CCER_CC3P           = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 3 output Polarity. */
+static const field32_t G_TIMx_CCER_CC3E           = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture/Compare 3 output enable. */
+static const field32_t G_TIMx_CCER_CC2NP          = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t G_TIMx_CCER_CC2P           = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t G_TIMx_CCER_CC2E           = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 2 output enable. */
+static const field32_t G_TIMx_CCER_CC1NP          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t G_TIMx_CCER_CC1P           = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t G_TIMx_CCER_CC1E           = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/Compare 1 output enable. */
+static const field32_t G_TIMx_CNT_CNT_L           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low counter value. */
+static const field32_t G_TIMx_CNT_CNT_H           = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High counter value. */
+static const field32_t G_TIMx_PSC_PSC             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t G_TIMx_ARR_ARR_H           = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High Auto-reload value. */
+static const field32_t G_TIMx_ARR_ARR_L           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Auto-reload value. */
+static const field32_t G_TIMx_CCR1_CCR1_H         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High Capture/Compare 1 value. */
+static const field32_t G_TIMx_CCR1_CCR1_L         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Capture/Compare 1 value. */
+static const field32_t G_TIMx_CCR2_CCR2_H         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High Capture/Compare 2 value. */
+static const field32_t G_TIMx_CCR2_CCR2_L         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Capture/Compare 2 value. */
+static const field32_t G_TIMx_CCR3_CCR3_H         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High Capture/Compare value. */
+static const field32_t G_TIMx_CCR3_CCR3_L         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Capture/Compare value. */
+static const field32_t G_TIMx_CCR4_CCR4_H         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief High Capture/Compare value. */
+static const field32_t G_TIMx_CCR4_CCR4_L         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Low Capture/Compare value. */
+static const field32_t G_TIMx_DCR_DBL             = {.msk = 0x00001F00U, .pos = 8};  /** @brief DMA burst length. */
+static const field32_t G_TIMx_DCR_DBA             = {.msk = 0x0000001FU, .pos = 0};  /** @brief DMA base address. */
+static const field32_t G_TIMx_DMAR_DMAB           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief DMA register for burst accesses. */
+static const field32_t G_TIMx_AF1_ETRSEL          = {.msk = 0x0003C000U, .pos = 14}; /** @brief ETR source selection. */
+static const field32_t G_TIMx_TISEL_TI1SEL        = {.msk = 0x0000000FU, .pos = 0};  /** @brief TI1[0] to TI1[15] input selection. */
+static const field32_t G_TIMx_TISEL_TI2SEL        = {.msk = 0x00000F00U, .pos = 8};  /** @brief TI2[0] to TI2[15] input selection. */
+static const field32_t G_TIMx_TISEL_TI3SEL        = {.msk = 0x000F0000U, .pos = 16}; /** @brief TI3[0] to TI3[15] input selection. */
+static const field32_t G_TIMx_TISEL_TI4SEL        = {.msk = 0x0F000000U, .pos = 24}; /** @brief TI4[0] to TI4[15] input selection. */
+
+/** @subsection Enumerated G_TIMx Register Field Definitions */
+
+/** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t G_TIMx_DIER_CCxDE[5] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t G_TIMx_DIER_CCxIE[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t G_TIMx_SR_CCxOF[5] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Capture/compare 1 interrupt flag. */
+static const field32_t G_TIMx_SR_CCxIF[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Capture/compare 1 generation. */
+static const field32_t G_TIMx_EGR_CCxG[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief CC1S. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief OC1FE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OCxFE[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief OC1PE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OCxPE[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief OC1M. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OCxM[3] = {
+  [1] = {.msk = 0x00000070U, .pos = 4},
+  [2] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief OC1CE. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OCxCE[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Output Compare 1 mode - bit 3. */
+static const field32_t G_TIMx_CCMR1_OUTPUT_OCxM_3[3] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Input capture 1 filter. */
+static const field32_t G_TIMx_CCMR1_INPUT_ICxF[3] = {
+  [1] = {.msk = 0x000000F0U, .pos = 4},
+  [2] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief Capture/Compare 1 selection. */
+static const field32_t G_TIMx_CCMR1_INPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Output Compare 1 mode - bit 3. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OCxM_3[5] = {
+  [3] = {.msk = 0x00010000U, .pos = 16},
+  [4] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief OC3CE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OCxCE[5] = {
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief OC3M. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OCxM[5] = {
+  [3] = {.msk = 0x00000070U, .pos = 4},
+  [4] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief OC3PE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OCxPE[5] = {
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief OC3FE. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_OCxFE[5] = {
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief CC3S. */
+static const field32_t G_TIMx_CCMR2_OUTPUT_CCxS[5] = {
+  [3] = {.msk = 0x00000003U, .pos = 0},
+  [4] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Input capture 3 filter. */
+static const field32_t G_TIMx_CCMR2_INPUT_ICxF[5] = {
+  [3] = {.msk = 0x000000F0U, .pos = 4},
+  [4] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief Input capture 3 prescaler. */
+static const field32_t G_TIMx_CCMR2_INPUT_ICxPSC[5] = {
+  [3] = {.msk = 0x0000000CU, .pos = 2},
+  [4] = {.msk = 0x00000C00U, .pos = 10},
+};
+
+/** @brief Capture/compare 3 selection. */
+static const field32_t G_TIMx_CCMR2_INPUT_CCxS[5] = {
+  [3] = {.msk = 0x00000003U, .pos = 0},
+  [4] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t G_TIMx_CCER_CCxNP[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t G_TIMx_CCER_CCxP[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief Capture/Compare 1 output enable. */
+static const field32_t G_TIMx_CCER_CCxE[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief TI1[0] to TI1[15] input selection. */
+static const field32_t G_TIMx_TISEL_TIxSEL[5] = {
+  [1] = {.msk = 0x0000000FU, .pos = 0},
+  [2] = {.msk = 0x00000F00U, .pos = 8},
+  [3] = {.msk = 0x000F0000U, .pos = 16},
+  [4] = {.msk = 0x0F000000U, .pos = 24},
+};
@@ -0,0 +1,555 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/gpiox.h
+ * @authors UW SARP
+ * @brief Registers and fields of GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG, GPIOH, GPIOI, GPIOJ, GPIOK.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section GPIOx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated GPIOx Register Definitions */
+
+/** @brief GPIO port mode register. */
+static rw_reg32_t const GPIOx_MODER[11] = {
+  [0]  = (rw_reg32_t)0x58020000U,
+  [1]  = (rw_reg32_t)0x58020400U,
+  [2]  = (rw_reg32_t)0x58020800U,
+  [3]  = (rw_reg32_t)0x58020C00U,
+  [4]  = (rw_reg32_t)0x58021000U,
+  [5]  = (rw_reg32_t)0x58021400U,
+  [6]  = (rw_reg32_t)0x58021800U,
+  [7]  = (rw_reg32_t)0x58021C00U,
+  [8]  = (rw_reg32_t)0x58022000U,
+  [9]  = (rw_reg32_t)0x58022400U,
+  [10] = (rw_reg32_t)0x58022800U,
+};
+
+/** @brief GPIO port output type register. */
+static rw_reg32_t const GPIOx_OTYPER[11] = {
+  [0]  = (rw_reg32_t)0x58020004U,
+  [1]  = (rw_reg32_t)0x58020404U,
+  [2]  = (rw_reg32_t)0x58020804U,
+  [3]  = (rw_reg32_t)0x58020C04U,
+  [4]  = (rw_reg32_t)0x58021004U,
+  [5]  = (rw_reg32_t)0x58021404U,
+  [6]  = (rw_reg32_t)0x58021804U,
+  [7]  = (rw_reg32_t)0x58021C04U,
+  [8]  = (rw_reg32_t)0x58022004U,
+  [9]  = (rw_reg32_t)0x58022404U,
+  [10] = (rw_reg32_t)0x58022804U,
+};
+
+/** @brief GPIO port output speed register. */
+static rw_reg32_t const GPIOx_OSPEEDR[11] = {
+  [0]  = (rw_reg32_t)0x58020008U,
+  [1]  = (rw_reg32_t)0x58020408U,
+  [2]  = (rw_reg32_t)0x58020808U,
+  [3]  = (rw_reg32_t)0x58020C08U,
+  [4]  = (rw_reg32_t)0x58021008U,
+  [5]  = (rw_reg32_t)0x58021408U,
+  [6]  = (rw_reg32_t)0x58021808U,
+  [7]  = (rw_reg32_t)0x58021C08U,
+  [8]  = (rw_reg32_t)0x58022008U,
+  [9]  = (rw_reg32_t)0x58022408U,
+  [10] = (rw_reg32_t)0x58022808U,
+};
+
+/** @brief GPIO port pull-up/pull-down register. */
+static rw_reg32_t const GPIOx_PUPDR[11] = {
+  [0]  = (rw_reg32_t)0x5802000CU,
+  [1]  = (rw_reg32_t)0x5802040CU,
+  [2]  = (rw_reg32_t)0x5802080CU,
+  [3]  = (rw_reg32_t)0x58020C0CU,
+  [4]  = (rw_reg32_t)0x5802100CU,
+  [5]  = (rw_reg32_t)0x5802140CU,
+  [6]  = (rw_reg32_t)0x5802180CU,
+  [7]  = (rw_reg32_t)0x58021C0CU,
+  [8]  = (rw_reg32_t)0x5802200CU,
+  [9]  = (rw_reg32_t)0x5802240CU,
+  [10] = (rw_reg32_t)0x5802280CU,
+};
+
+/** @brief GPIO port input data register. */
+static ro_reg32_t const GPIOx_IDR[11] = {
+  [0]  = (ro_reg32_t)0x58020010U,
+  [1]  = (ro_reg32_t)0x58020410U,
+  [2]  = (ro_reg32_t)0x58020810U,
+  [3]  = (ro_reg32_t)0x58020C10U,
+  [4]  = (ro_reg32_t)0x58021010U,
+  [5]  = (ro_reg32_t)0x58021410U,
+  [6]  = (ro_reg32_t)0x58021810U,
+  [7]  = (ro_reg32_t)0x58021C10U,
+  [8]  = (ro_reg32_t)0x58022010U,
+  [9]  = (ro_reg32_t)0x58022410U,
+  [10] = (ro_reg32_t)0x58022810U,
+};
+
+/** @brief GPIO port output data register. */
+static rw_reg32_t const GPIOx_ODR[11] = {
+  [0]  = (rw_reg32_t)0x58020014U,
+  [1]  = (rw_reg32_t)0x58020414U,
+  [2]  = (rw_reg32_t)0x58020814U,
+  [3]  = (rw_reg32_t)0x58020C14U,
+  [4]  = (rw_reg32_t)0x58021014U,
+  [5]  = (rw_reg32_t)0x58021414U,
+  [6]  = (rw_reg32_t)0x58021814U,
+  [7]  = (rw_reg32_t)0x58021C14U,
+  [8]  = (rw_reg32_t)0x58022014U,
+  [9]  = (rw_reg32_t)0x58022414U,
+  [10] = (rw_reg32_t)0x58022814U,
+};
+
+/** @brief GPIO port bit set/reset register. */
+static rw_reg32_t const GPIOx_BSRR[11] = {
+  [0]  = (rw_reg32_t)0x58020018U,
+  [1]  = (rw_reg32_t)0x58020418U,
+  [2]  = (rw_reg32_t)0x58020818U,
+  [3]  = (rw_reg32_t)0x58020C18U,
+  [4]  = (rw_reg32_t)0x58021018U,
+  [5]  = (rw_reg32_t)0x58021418U,
+  [6]  = (rw_reg32_t)0x58021818U,
+  [7]  = (rw_reg32_t)0x58021C18U,
+  [8]  = (rw_reg32_t)0x58022018U,
+  [9]  = (rw_reg32_t)0x58022418U,
+  [10] = (rw_reg32_t)0x58022818U,
+};
+
+/** @brief This register is used to lock the configuration of the port bits when a correct write sequence is applied to bit 16 (LCKK). The value of bits [15:0] is used to lock the configuration of the GPIO. During the write sequence, the value of LCKR[15:0] must not change. When the LOCK sequence has been applied on a port bit, the value of this port bit can no longer be modified until the next MCU reset or peripheral reset.A specific write sequence is used to write to the GPIOx_LCKR register. Only word access (32-bit long) is allowed during this locking sequence.Each lock bit freezes a specific configuration register (control and alternate function registers). */
+static rw_reg32_t const GPIOx_LCKR[11] = {
+  [0]  = (rw_reg32_t)0x5802001CU,
+  [1]  = (rw_reg32_t)0x5802041CU,
+  [2]  = (rw_reg32_t)0x5802081CU,
+  [3]  = (rw_reg32_t)0x58020C1CU,
+  [4]  = (rw_reg32_t)0x5802101CU,
+  [5]  = (rw_reg32_t)0x5802141CU,
+  [6]  = (rw_reg32_t)0x5802181CU,
+  [7]  = (rw_reg32_t)0x58021C1CU,
+  [8]  = (rw_reg32_t)0x5802201CU,
+  [9]  = (rw_reg32_t)0x5802241CU,
+  [10] = (rw_reg32_t)0x5802281CU,
+};
+
+/** @brief GPIO alternate function low register. */
+static rw_reg32_t const GPIOx_AFRL[11] = {
+  [0]  = (rw_reg32_t)0x58020020U,
+  [1]  = (rw_reg32_t)0x58020420U,
+  [2]  = (rw_reg32_t)0x58020820U,
+  [3]  = (rw_reg32_t)0x58020C20U,
+  [4]  = (rw_reg32_t)0x58021020U,
+  [5]  = (rw_reg32_t)0x58021420U,
+  [6]  = (rw_reg32_t)0x58021820U,
+  [7]  = (rw_reg32_t)0x58021C20U,
+  [8]  = (rw_reg32_t)0x58022020U,
+  [9]  = (rw_reg32_t)0x58022420U,
+  [10] = (rw_reg32_t)0x58022820U,
+};
+
+/** @brief GPIO alternate function high register. */
+static rw_reg32_t const GPIOx_AFRH[11] = {
+  [0]  = (rw_reg32_t)0x58020024U,
+  [1]  = (rw_reg32_t)0x58020424U,
+  [2]  = (rw_reg32_t)0x58020824U,
+  [3]  = (rw_reg32_t)0x58020C24U,
+  [4]  = (rw_reg32_t)0x58021024U,
+  [5]  = (rw_reg32_t)0x58021424U,
+  [6]  = (rw_reg32_t)0x58021824U,
+  [7]  = (rw_reg32_t)0x58021C24U,
+  [8]  = (rw_reg32_t)0x58022024U,
+  [9]  = (rw_reg32_t)0x58022424U,
+  [10] = (rw_reg32_t)0x58022824U,
+};
+
+/** @subsection GPIOx Register Field Definitions */
+
+static const field32_t GPIOx_MODER_MODE0      = {.msk = 0x00000003U, .pos = 0};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE1      = {.msk = 0x0000000CU, .pos = 2};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE2      = {.msk = 0x00000030U, .pos = 4};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE3      = {.msk = 0x000000C0U, .pos = 6};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE4      = {.msk = 0x00000300U, .pos = 8};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE5      = {.msk = 0x00000C00U, .pos = 10}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE6      = {.msk = 0x00003000U, .pos = 12}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE7      = {.msk = 0x0000C000U, .pos = 14}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE8      = {.msk = 0x00030000U, .pos = 16}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE9      = {.msk = 0x000C0000U, .pos = 18}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE10     = {.msk = 0x00300000U, .pos = 20}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE11     = {.msk = 0x00C00000U, .pos = 22}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE12     = {.msk = 0x03000000U, .pos = 24}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE13     = {.msk = 0x0C000000U, .pos = 26}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE14     = {.msk = 0x30000000U, .pos = 28}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODE15     = {.msk = 0xC0000000U, .pos = 30}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_OTYPER_OT0       = {.msk = 0x00000001U, .pos = 0};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT1       = {.msk = 0x00000002U, .pos = 1};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT2       = {.msk = 0x00000004U, .pos = 2};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT3       = {.msk = 0x00000008U, .pos = 3};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT4       = {.msk = 0x00000010U, .pos = 4};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT5       = {.msk = 0x00000020U, .pos = 5};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT6       = {.msk = 0x00000040U, .pos = 6};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT7       = {.msk = 0x00000080U, .pos = 7};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT8       = {.msk = 0x00000100U, .pos = 8};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT9       = {.msk = 0x00000200U, .pos = 9};  /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT10      = {.msk = 0x00000400U, .pos = 10}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT11      = {.msk = 0x00000800U, .pos = 11}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT12      = {.msk = 0x00001000U, .pos = 12}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT13      = {.msk = 0x00002000U, .pos = 13}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT14      = {.msk = 0x00004000U, .pos = 14}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OT15      = {.msk = 0x00008000U, .pos = 15}; /** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OSPEEDR_OSPEED0  = {.msk = 0x00000003U, .pos = 0};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED1  = {.msk = 0x0000000CU, .pos = 2};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED2  = {.msk = 0x00000030U, .pos = 4};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED3  = {.msk = 0x000000C0U, .pos = 6};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED4  = {.msk = 0x00000300U, .pos = 8};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED5  = {.msk = 0x00000C00U, .pos = 10}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED6  = {.msk = 0x00003000U, .pos = 12}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED7  = {.msk = 0x0000C000U, .pos = 14}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED8  = {.msk = 0x00030000U, .pos = 16}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED9  = {.msk = 0x000C0000U, .pos = 18}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED10 = {.msk = 0x00300000U, .pos = 20}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED11 = {.msk = 0x00C00000U, .pos = 22}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED12 = {.msk = 0x03000000U, .pos = 24}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED13 = {.msk = 0x0C000000U, .pos = 26}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED14 = {.msk = 0x30000000U, .pos = 28}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEED15 = {.msk = 0xC0000000U, .pos = 30}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_PUPDR_PUPD0      = {.msk = 0x00000003U, .pos = 0};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD1      = {.msk = 0x0000000CU, .pos = 2};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD2      = {.msk = 0x00000030U, .pos = 4};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD3      = {.msk = 0x000000C0U, .pos = 6};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD4      = {.msk = 0x00000300U, .pos = 8};  /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD5      = {.msk = 0x00000C00U, .pos = 10}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD6      = {.msk = 0x00003000U, .pos = 12}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD7      = {.msk = 0x0000C000U, .pos = 14}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD8      = {.msk = 0x00030000U, .pos = 16}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD9      = {.msk = 0x000C0000U, .pos = 18}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD10     = {.msk = 0x00300000U, .pos = 20}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD11     = {.msk = 0x00C00000U, .pos = 22}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD12     = {.msk = 0x03000000U, .pos = 24}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD13     = {.msk = 0x0C000000U, .pos = 26}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD14     = {.msk = 0x30000000U, .pos = 28}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPD15     = {.msk = 0xC0000000U, .pos = 30}; /** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_IDR_ID0          = {.msk = 0x00000001U, .pos = 0};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID1          = {.msk = 0x00000002U, .pos = 1};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID2          = {.msk = 0x00000004U, .pos = 2};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID3          = {.msk = 0x00000008U, .pos = 3};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID4          = {.msk = 0x00000010U, .pos = 4};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID5          = {.msk = 0x00000020U, .pos = 5};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID6          = {.msk = 0x00000040U, .pos = 6};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID7          = {.msk = 0x00000080U, .pos = 7};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID8          = {.msk = 0x00000100U, .pos = 8};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID9          = {.msk = 0x00000200U, .pos = 9};  /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID10         = {.msk = 0x00000400U, .pos = 10}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID11         = {.msk = 0x00000800U, .pos = 11}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID12         = {.msk = 0x00001000U, .pos = 12}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID13         = {.msk = 0x00002000U, .pos = 13}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID14         = {.msk = 0x00004000U, .pos = 14}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_ID15         = {.msk = 0x00008000U, .pos = 15}; /** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_ODR_OD0          = {.msk = 0x00000001U, .pos = 0};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD1          = {.msk = 0x00000002U, .pos = 1};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD2          = {.msk = 0x00000004U, .pos = 2};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD3          = {.msk = 0x00000008U, .pos = 3};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD4          = {.msk = 0x00000010U, .pos = 4};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD5          = {.msk = 0x00000020U, .pos = 5};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD6          = {.msk = 0x00000040U, .pos = 6};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD7          = {.msk = 0x00000080U, .pos = 7};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD8          = {.msk = 0x00000100U, .pos = 8};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD9          = {.msk = 0x00000200U, .pos = 9};  /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD10         = {.msk = 0x00000400U, .pos = 10}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD11         = {.msk = 0x00000800U, .pos = 11}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD12         = {.msk = 0x00001000U, .pos = 12}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD13         = {.msk = 0x00002000U, .pos = 13}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD14         = {.msk = 0x00004000U, .pos = 14}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_OD15         = {.msk = 0x00008000U, .pos = 15}; /** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_BSRR_BS0         = {.msk = 0x00000001U, .pos = 0};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS1         = {.msk = 0x00000002U, .pos = 1};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS2         = {.msk = 0x00000004U, .pos = 2};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS3         = {.msk = 0x00000008U, .pos = 3};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS4         = {.msk = 0x00000010U, .pos = 4};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS5         = {.msk = 0x00000020U, .pos = 5};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS6         = {.msk = 0x00000040U, .pos = 6};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS7         = {.msk = 0x00000080U, .pos = 7};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS8         = {.msk = 0x00000100U, .pos = 8};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS9         = {.msk = 0x00000200U, .pos = 9};  /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS10        = {.msk = 0x00000400U, .pos = 10}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS11        = {.msk = 0x00000800U, .pos = 11}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS12        = {.msk = 0x00001000U, .pos = 12}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS13        = {.msk = 0x00002000U, .pos = 13}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS14        = {.msk = 0x00004000U, .pos = 14}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BS15        = {.msk = 0x00008000U, .pos = 15}; /** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BR0         = {.msk = 0x00010000U, .pos = 16}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR1         = {.msk = 0x00020000U, .pos = 17}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR2         = {.msk = 0x00040000U, .pos = 18}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR3         = {.msk = 0x00080000U, .pos = 19}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR4         = {.msk = 0x00100000U, .pos = 20}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR5         = {.msk = 0x00200000U, .pos = 21}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR6         = {.msk = 0x00400000U, .pos = 22}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR7         = {.msk = 0x00800000U, .pos = 23}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR8         = {.msk = 0x01000000U, .pos = 24}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR9         = {.msk = 0x02000000U, .pos = 25}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR10        = {.msk = 0x04000000U, .pos = 26}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR11        = {.msk = 0x08000000U, .pos = 27}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR12        = {.msk = 0x10000000U, .pos = 28}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR13        = {.msk = 0x20000000U, .pos = 29}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR14        = {.msk = 0x40000000U, .pos = 30}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BR15        = {.msk = 0x80000000U, .pos = 31}; /** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_LCKR_LCK0        = {.msk = 0x00000001U, .pos = 0};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK1        = {.msk = 0x00000002U, .pos = 1};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK2        = {.msk = 0x00000004U, .pos = 2};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK3        = {.msk = 0x00000008U, .pos = 3};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK4        = {.msk = 0x00000010U, .pos = 4};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK5        = {.msk = 0x00000020U, .pos = 5};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK6        = {.msk = 0x00000040U, .pos = 6};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK7        = {.msk = 0x00000080U, .pos = 7};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK8        = {.msk = 0x00000100U, .pos = 8};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK9        = {.msk = 0x00000200U, .pos = 9};  /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK10       = {.msk = 0x00000400U, .pos = 10}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK11       = {.msk = 0x00000800U, .pos = 11}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK12       = {.msk = 0x00001000U, .pos = 12}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK13       = {.msk = 0x00002000U, .pos = 13}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK14       = {.msk = 0x00004000U, .pos = 14}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCK15       = {.msk = 0x00008000U, .pos = 15}; /** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCKK        = {.msk = 0x00010000U, .pos = 16}; /** @brief Lock key This bit can be read any time. It can only be modified using the lock key write sequence. LOCK key write sequence: WR LCKR[16] = 1 + LCKR[15:0] WR LCKR[16] = 0 + LCKR[15:0] WR LCKR[16] = 1 + LCKR[15:0] RD LCKR RD LCKR[16] = 1 (this read operation is optional but it confirms that the lock is active) Note: During the LOCK key write sequence, the value of LCK[15:0] must not change. Any error in the lock sequence aborts the lock. After the first lock sequence on any bit of the port, any read access on the LCKK bit will return 1 until the next MCU reset or peripheral reset. */
+static const field32_t GPIOx_AFRL_AFSEL0      = {.msk = 0x0000000FU, .pos = 0};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL1      = {.msk = 0x000000F0U, .pos = 4};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL2      = {.msk = 0x00000F00U, .pos = 8};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL3      = {.msk = 0x0000F000U, .pos = 12}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL4      = {.msk = 0x000F0000U, .pos = 16}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL5      = {.msk = 0x00F00000U, .pos = 20}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL6      = {.msk = 0x0F000000U, .pos = 24}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSEL7      = {.msk = 0xF0000000U, .pos = 28}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRH_AFSEL8      = {.msk = 0x0000000FU, .pos = 0};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL9      = {.msk = 0x000000F0U, .pos = 4};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL10     = {.msk = 0x00000F00U, .pos = 8};  /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL11     = {.msk = 0x0000F000U, .pos = 12}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL12     = {.msk = 0x000F0000U, .pos = 16}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL13     = {.msk = 0x00F00000U, .pos = 20}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL14     = {.msk = 0x0F000000U, .pos = 24}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSEL15     = {.msk = 0xF0000000U, .pos = 28}; /** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+
+/** @subsection Enumerated GPIOx Register Field Definitions */
+
+/** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O mode. */
+static const field32_t GPIOx_MODER_MODEx[16] = {
+  [0]  = {.msk = 0x00000003U, .pos = 0},
+  [1]  = {.msk = 0x0000000CU, .pos = 2},
+  [2]  = {.msk = 0x00000030U, .pos = 4},
+  [3]  = {.msk = 0x000000C0U, .pos = 6},
+  [4]  = {.msk = 0x00000300U, .pos = 8},
+  [5]  = {.msk = 0x00000C00U, .pos = 10},
+  [6]  = {.msk = 0x00003000U, .pos = 12},
+  [7]  = {.msk = 0x0000C000U, .pos = 14},
+  [8]  = {.msk = 0x00030000U, .pos = 16},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x00300000U, .pos = 20},
+  [11] = {.msk = 0x00C00000U, .pos = 22},
+  [12] = {.msk = 0x03000000U, .pos = 24},
+  [13] = {.msk = 0x0C000000U, .pos = 26},
+  [14] = {.msk = 0x30000000U, .pos = 28},
+  [15] = {.msk = 0xC0000000U, .pos = 30},
+};
+
+/** @brief Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output type. */
+static const field32_t GPIOx_OTYPER_OTx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O output speed. Note: Refer to the device datasheet for the frequency specifications and the power supply and load conditions for each speed. */
+static const field32_t GPIOx_OSPEEDR_OSPEEDx[16] = {
+  [0]  = {.msk = 0x00000003U, .pos = 0},
+  [1]  = {.msk = 0x0000000CU, .pos = 2},
+  [2]  = {.msk = 0x00000030U, .pos = 4},
+  [3]  = {.msk = 0x000000C0U, .pos = 6},
+  [4]  = {.msk = 0x00000300U, .pos = 8},
+  [5]  = {.msk = 0x00000C00U, .pos = 10},
+  [6]  = {.msk = 0x00003000U, .pos = 12},
+  [7]  = {.msk = 0x0000C000U, .pos = 14},
+  [8]  = {.msk = 0x00030000U, .pos = 16},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x00300000U, .pos = 20},
+  [11] = {.msk = 0x00C00000U, .pos = 22},
+  [12] = {.msk = 0x03000000U, .pos = 24},
+  [13] = {.msk = 0x0C000000U, .pos = 26},
+  [14] = {.msk = 0x30000000U, .pos = 28},
+  [15] = {.msk = 0xC0000000U, .pos = 30},
+};
+
+/** @brief [1:0]: Port x configuration bits (y = 0..15) These bits are written by software to configure the I/O pull-up or pull-down. */
+static const field32_t GPIOx_PUPDR_PUPDx[16] = {
+  [0]  = {.msk = 0x00000003U, .pos = 0},
+  [1]  = {.msk = 0x0000000CU, .pos = 2},
+  [2]  = {.msk = 0x00000030U, .pos = 4},
+  [3]  = {.msk = 0x000000C0U, .pos = 6},
+  [4]  = {.msk = 0x00000300U, .pos = 8},
+  [5]  = {.msk = 0x00000C00U, .pos = 10},
+  [6]  = {.msk = 0x00003000U, .pos = 12},
+  [7]  = {.msk = 0x0000C000U, .pos = 14},
+  [8]  = {.msk = 0x00030000U, .pos = 16},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x00300000U, .pos = 20},
+  [11] = {.msk = 0x00C00000U, .pos = 22},
+  [12] = {.msk = 0x03000000U, .pos = 24},
+  [13] = {.msk = 0x0C000000U, .pos = 26},
+  [14] = {.msk = 0x30000000U, .pos = 28},
+  [15] = {.msk = 0xC0000000U, .pos = 30},
+};
+
+/** @brief Port input data bit (y = 0..15) These bits are read-only. They contain the input value of the corresponding I/O port. */
+static const field32_t GPIOx_IDR_IDx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Port output data bit These bits can be read and written by software. Note: For atomic bit set/reset, the OD bits can be individually set and/or reset by writing to the GPIOx_BSRR or GPIOx_BRR registers (x = A..F). */
+static const field32_t GPIOx_ODR_ODx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Port x set bit y (y= 0..15) These bits are write-only. A read to these bits returns the value 0x0000. */
+static const field32_t GPIOx_BSRR_BSx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Port x reset bit y (y = 0..15) These bits are write-only. A read to these bits returns the value 0x0000. Note: If both BSx and BRx are set, BSx has priority. */
+static const field32_t GPIOx_BSRR_BRx[16] = {
+  [0]  = {.msk = 0x00010000U, .pos = 16},
+  [1]  = {.msk = 0x00020000U, .pos = 17},
+  [2]  = {.msk = 0x00040000U, .pos = 18},
+  [3]  = {.msk = 0x00080000U, .pos = 19},
+  [4]  = {.msk = 0x00100000U, .pos = 20},
+  [5]  = {.msk = 0x00200000U, .pos = 21},
+  [6]  = {.msk = 0x00400000U, .pos = 22},
+  [7]  = {.msk = 0x00800000U, .pos = 23},
+  [8]  = {.msk = 0x01000000U, .pos = 24},
+  [9]  = {.msk = 0x02000000U, .pos = 25},
+  [10] = {.msk = 0x04000000U, .pos = 26},
+  [11] = {.msk = 0x08000000U, .pos = 27},
+  [12] = {.msk = 0x10000000U, .pos = 28},
+  [13] = {.msk = 0x20000000U, .pos = 29},
+  [14] = {.msk = 0x40000000U, .pos = 30},
+  [15] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Port x lock bit y (y= 0..15) These bits are read/write but can only be written when the LCKK bit is 0. */
+static const field32_t GPIOx_LCKR_LCKx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief [3:0]: Alternate function selection for port x pin y (y = 0..7) These bits are written by software to configure alternate function I/Os AFSELy selection:. */
+static const field32_t GPIOx_AFRL_AFSELx[8] = {
+  [0] = {.msk = 0x0000000FU, .pos = 0},
+  [1] = {.msk = 0x000000F0U, .pos = 4},
+  [2] = {.msk = 0x00000F00U, .pos = 8},
+  [3] = {.msk = 0x0000F000U, .pos = 12},
+  [4] = {.msk = 0x000F0000U, .pos = 16},
+  [5] = {.msk = 0x00F00000U, .pos = 20},
+  [6] = {.msk = 0x0F000000U, .pos = 24},
+  [7] = {.msk = 0xF0000000U, .pos = 28},
+};
+
+/** @brief [3:0]: Alternate function selection for port x pin y (y = 8..15) These bits are written by software to configure alternate function I/Os. */
+static const field32_t GPIOx_AFRH_AFSELx[16] = {
+  [8]  = {.msk = 0x0000000FU, .pos = 0},
+  [9]  = {.msk = 0x000000F0U, .pos = 4},
+  [10] = {.msk = 0x00000F00U, .pos = 8},
+  [11] = {.msk = 0x0000F000U, .pos = 12},
+  [12] = {.msk = 0x000F0000U, .pos = 16},
+  [13] = {.msk = 0x00F00000U, .pos = 20},
+  [14] = {.msk = 0x0F000000U, .pos = 24},
+  [15] = {.msk = 0xF0000000U, .pos = 28},
+};
@@ -0,0 +1,957 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/hrtim_common.h
+ * @authors UW SARP
+ * @brief Registers and fields of HRTIM_COMMON.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section HRTIM_COMMON Definitions
+ **************************************************************************************************/
+
+/** @subsection HRTIM_COMMON Register Definitions */
+
+static rw_reg32_t const HRTIM_COMMON_CR1     = (rw_reg32_t)0x40017780U; /** @brief Control Register 1. */
+static rw_reg32_t const HRTIM_COMMON_CR2     = (rw_reg32_t)0x40017784U; /** @brief Control Register 2. */
+static rw_reg32_t const HRTIM_COMMON_ISR     = (rw_reg32_t)0x40017788U; /** @brief Interrupt Status Register. */
+static rw_reg32_t const HRTIM_COMMON_ICR     = (rw_reg32_t)0x4001778CU; /** @brief Interrupt Clear Register. */
+static rw_reg32_t const HRTIM_COMMON_IER     = (rw_reg32_t)0x40017790U; /** @brief Interrupt Enable Register. */
+static rw_reg32_t const HRTIM_COMMON_OENR    = (rw_reg32_t)0x40017794U; /** @brief Output Enable Register. */
+static rw_reg32_t const HRTIM_COMMON_DISR    = (rw_reg32_t)0x40017798U; /** @brief DISR. */
+static ro_reg32_t const HRTIM_COMMON_ODSR    = (ro_reg32_t)0x4001779CU; /** @brief Output Disable Status Register. */
+static rw_reg32_t const HRTIM_COMMON_BMCR    = (rw_reg32_t)0x400177A0U; /** @brief Burst Mode Control Register. */
+static rw_reg32_t const HRTIM_COMMON_BMTRG   = (rw_reg32_t)0x400177A4U; /** @brief BMTRG. */
+static rw_reg32_t const HRTIM_COMMON_BMCMPR6 = (rw_reg32_t)0x400177A8U; /** @brief BMCMPR6. */
+static rw_reg32_t const HRTIM_COMMON_BMPER   = (rw_reg32_t)0x400177ACU; /** @brief Burst Mode Period Register. */
+static rw_reg32_t const HRTIM_COMMON_EECR1   = (rw_reg32_t)0x400177B0U; /** @brief Timer External Event Control Register 1. */
+static rw_reg32_t const HRTIM_COMMON_EECR2   = (rw_reg32_t)0x400177B4U; /** @brief Timer External Event Control Register 2. */
+static rw_reg32_t const HRTIM_COMMON_EECR3   = (rw_reg32_t)0x400177B8U; /** @brief Timer External Event Control Register 3. */
+static rw_reg32_t const HRTIM_COMMON_ADC1R   = (rw_reg32_t)0x400177BCU; /** @brief ADC Trigger 1 Register. */
+static rw_reg32_t const HRTIM_COMMON_ADC2R   = (rw_reg32_t)0x400177C0U; /** @brief ADC Trigger 2 Register. */
+static rw_reg32_t const HRTIM_COMMON_ADC3R   = (rw_reg32_t)0x400177C4U; /** @brief ADC Trigger 3 Register. */
+static rw_reg32_t const HRTIM_COMMON_ADC4R   = (rw_reg32_t)0x400177C8U; /** @brief ADC Trigger 4 Register. */
+static rw_reg32_t const HRTIM_COMMON_DLLCR   = (rw_reg32_t)0x400177CCU; /** @brief DLL Control Register. */
+static rw_reg32_t const HRTIM_COMMON_FLTINR1 = (rw_reg32_t)0x400177D0U; /** @brief HRTIM Fault Input Register 1. */
+static rw_reg32_t const HRTIM_COMMON_FLTINR2 = (rw_reg32_t)0x400177D4U; /** @brief HRTIM Fault Input Register 2. */
+static rw_reg32_t const HRTIM_COMMON_BDMUPDR = (rw_reg32_t)0x400177D8U; /** @brief BDMUPDR. */
+static rw_reg32_t const HRTIM_COMMON_BDTXUPR = (rw_reg32_t)0x400177DCU; /** @brief Burst DMA Timerx update Register. */
+static rw_reg32_t const HRTIM_COMMON_BDMADR  = (rw_reg32_t)0x400177E0U; /** @brief Burst DMA Data Register. */
+
+/** @subsection HRTIM_COMMON Register Field Definitions */
+
+static const field32_t HRTIM_COMMON_CR1_AD4USRC       = {.msk = 0x0E000000U, .pos = 25}; /** @brief ADC Trigger 4 Update Source. */
+static const field32_t HRTIM_COMMON_CR1_AD3USRC       = {.msk = 0x01C00000U, .pos = 22}; /** @brief ADC Trigger 3 Update Source. */
+static const field32_t HRTIM_COMMON_CR1_AD2USRC       = {.msk = 0x00380000U, .pos = 19}; /** @brief ADC Trigger 2 Update Source. */
+static const field32_t HRTIM_COMMON_CR1_AD1USRC       = {.msk = 0x00070000U, .pos = 16}; /** @brief ADC Trigger 1 Update Source. */
+static const field32_t HRTIM_COMMON_CR1_TEUDIS        = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer E Update Disable. */
+static const field32_t HRTIM_COMMON_CR1_TDUDIS        = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer D Update Disable. */
+static const field32_t HRTIM_COMMON_CR1_TCUDIS        = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer C Update Disable. */
+static const field32_t HRTIM_COMMON_CR1_TBUDIS        = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer B Update Disable. */
+static const field32_t HRTIM_COMMON_CR1_TAUDIS        = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Update Disable. */
+static const field32_t HRTIM_COMMON_CR1_MUDIS         = {.msk = 0x00000001U, .pos = 0};  /** @brief Master Update Disable. */
+static const field32_t HRTIM_COMMON_CR2_TERST         = {.msk = 0x00002000U, .pos = 13}; /** @brief Timer E counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_TDRST         = {.msk = 0x00001000U, .pos = 12}; /** @brief Timer D counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_TCRST         = {.msk = 0x00000800U, .pos = 11}; /** @brief Timer C counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_TBRST         = {.msk = 0x00000400U, .pos = 10}; /** @brief Timer B counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_TARST         = {.msk = 0x00000200U, .pos = 9};  /** @brief Timer A counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_MRST          = {.msk = 0x00000100U, .pos = 8};  /** @brief Master Counter software reset. */
+static const field32_t HRTIM_COMMON_CR2_TESWU         = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer E Software Update. */
+static const field32_t HRTIM_COMMON_CR2_TDSWU         = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer D Software Update. */
+static const field32_t HRTIM_COMMON_CR2_TCSWU         = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer C Software Update. */
+static const field32_t HRTIM_COMMON_CR2_TBSWU         = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer B Software Update. */
+static const field32_t HRTIM_COMMON_CR2_TASWU         = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Software update. */
+static const field32_t HRTIM_COMMON_CR2_MSWU          = {.msk = 0x00000001U, .pos = 0};  /** @brief Master Timer Software update. */
+static const field32_t HRTIM_COMMON_ISR_BMPER         = {.msk = 0x00020000U, .pos = 17}; /** @brief Burst mode Period Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_DLLRDY        = {.msk = 0x00010000U, .pos = 16}; /** @brief DLL Ready Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_SYSFLT        = {.msk = 0x00000020U, .pos = 5};  /** @brief System Fault Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLT5          = {.msk = 0x00000010U, .pos = 4};  /** @brief Fault 5 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLT4          = {.msk = 0x00000008U, .pos = 3};  /** @brief Fault 4 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLT3          = {.msk = 0x00000004U, .pos = 2};  /** @brief Fault 3 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLT2          = {.msk = 0x00000002U, .pos = 1};  /** @brief Fault 2 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLT1          = {.msk = 0x00000001U, .pos = 0};  /** @brief Fault 1 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ICR_BMPERC        = {.msk = 0x00020000U, .pos = 17}; /** @brief Burst mode period flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_DLLRDYC       = {.msk = 0x00010000U, .pos = 16}; /** @brief DLL Ready Interrupt flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_SYSFLTC       = {.msk = 0x00000020U, .pos = 5};  /** @brief System Fault Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLT5C         = {.msk = 0x00000010U, .pos = 4};  /** @brief Fault 5 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLT4C         = {.msk = 0x00000008U, .pos = 3};  /** @brief Fault 4 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLT3C         = {.msk = 0x00000004U, .pos = 2};  /** @brief Fault 3 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLT2C         = {.msk = 0x00000002U, .pos = 1};  /** @brief Fault 2 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLT1C         = {.msk = 0x00000001U, .pos = 0};  /** @brief Fault 1 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_IER_BMPERIE       = {.msk = 0x00020000U, .pos = 17}; /** @brief Burst mode period Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_DLLRDYIE      = {.msk = 0x00010000U, .pos = 16}; /** @brief DLL Ready Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_SYSFLTE       = {.msk = 0x00000020U, .pos = 5};  /** @brief System Fault Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLT5IE        = {.msk = 0x00000010U, .pos = 4};  /** @brief Fault 5 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLT4IE        = {.msk = 0x00000008U, .pos = 3};  /** @brief Fault 4 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLT3IE        = {.msk = 0x00000004U, .pos = 2};  /** @brief Fault 3 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLT2IE        = {.msk = 0x00000002U, .pos = 1};  /** @brief Fault 2 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLT1IE        = {.msk = 0x00000001U, .pos = 0};  /** @brief Fault 1 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_OENR_TE2OEN       = {.msk = 0x00000200U, .pos = 9};  /** @brief Timer E Output 2 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TE1OEN       = {.msk = 0x00000100U, .pos = 8};  /** @brief Timer E Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TD2OEN       = {.msk = 0x00000080U, .pos = 7};  /** @brief Timer D Output 2 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TD1OEN       = {.msk = 0x00000040U, .pos = 6};  /** @brief Timer D Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TC2OEN       = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer C Output 2 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TC1OEN       = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer C Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TB2OEN       = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer B Output 2 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TB1OEN       = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer B Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TA2OEN       = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Output 2 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TA1OEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Timer A Output 1 Enable. */
+static const field32_t HRTIM_COMMON_DISR_TE2ODIS      = {.msk = 0x00000200U, .pos = 9};  /** @brief TE2ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TE1ODIS      = {.msk = 0x00000100U, .pos = 8};  /** @brief TE1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TD2ODIS      = {.msk = 0x00000080U, .pos = 7};  /** @brief TD2ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TD1ODIS      = {.msk = 0x00000040U, .pos = 6};  /** @brief TD1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TC2ODIS      = {.msk = 0x00000020U, .pos = 5};  /** @brief TC2ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TC1ODIS      = {.msk = 0x00000010U, .pos = 4};  /** @brief TC1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TB2ODIS      = {.msk = 0x00000008U, .pos = 3};  /** @brief TB2ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TB1ODIS      = {.msk = 0x00000004U, .pos = 2};  /** @brief TB1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TA2ODIS      = {.msk = 0x00000002U, .pos = 1};  /** @brief TA2ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TA1ODIS      = {.msk = 0x00000001U, .pos = 0};  /** @brief TA1ODIS. */
+static const field32_t HRTIM_COMMON_ODSR_TE2ODS       = {.msk = 0x00000200U, .pos = 9};  /** @brief Timer E Output 2 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TE1ODS       = {.msk = 0x00000100U, .pos = 8};  /** @brief Timer E Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TD2ODS       = {.msk = 0x00000080U, .pos = 7};  /** @brief Timer D Output 2 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TD1ODS       = {.msk = 0x00000040U, .pos = 6};  /** @brief Timer D Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TC2ODS       = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer C Output 2 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TC1ODS       = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer C Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TB2ODS       = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer B Output 2 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TB1ODS       = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer B Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TA2ODS       = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Output 2 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TA1ODS       = {.msk = 0x00000001U, .pos = 0};  /** @brief Timer A Output 1 disable status. */
+static const field32_t HRTIM_COMMON_BMCR_BMSTAT       = {.msk = 0x80000000U, .pos = 31}; /** @brief Burst Mode Status. */
+static const field32_t HRTIM_COMMON_BMCR_TEBM         = {.msk = 0x00200000U, .pos = 21}; /** @brief Timer E Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_TDBM         = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer D Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_TCBM         = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer C Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_TBBM         = {.msk = 0x00040000U, .pos = 18}; /** @brief Timer B Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_TABM         = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer A Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_MTBM         = {.msk = 0x00010000U, .pos = 16}; /** @brief Master Timer Burst Mode. */
+static const field32_t HRTIM_COMMON_BMCR_BMPREN       = {.msk = 0x00000400U, .pos = 10}; /** @brief Burst Mode Preload Enable. */
+static const field32_t HRTIM_COMMON_BMCR_BMPRSC       = {.msk = 0x000003C0U, .pos = 6};  /** @brief Burst Mode Prescaler. */
+static const field32_t HRTIM_COMMON_BMCR_BMCLK        = {.msk = 0x0000003CU, .pos = 2};  /** @brief Burst Mode Clock source. */
+static const field32_t HRTIM_COMMON_BMCR_BMOM         = {.msk = 0x00000002U, .pos = 1};  /** @brief Burst Mode operating mode. */
+static const field32_t HRTIM_COMMON_BMCR_BME          = {.msk = 0x00000001U, .pos = 0};  /** @brief Burst Mode enable. */
+static const field32_t HRTIM_COMMON_BMTRG_OCHPEV      = {.msk = 0x80000000U, .pos = 31}; /** @brief OCHPEV. */
+static const field32_t HRTIM_COMMON_BMTRG_TECMP2      = {.msk = 0x04000000U, .pos = 26}; /** @brief TECMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_TECMP1      = {.msk = 0x02000000U, .pos = 25}; /** @brief TECMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TEREP       = {.msk = 0x01000000U, .pos = 24}; /** @brief TEREP. */
+static const field32_t HRTIM_COMMON_BMTRG_TERST       = {.msk = 0x00800000U, .pos = 23}; /** @brief TERST. */
+static const field32_t HRTIM_COMMON_BMTRG_TDCMP2      = {.msk = 0x00400000U, .pos = 22}; /** @brief TDCMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_TDCMP1      = {.msk = 0x00200000U, .pos = 21}; /** @brief TDCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TDREP       = {.msk = 0x00100000U, .pos = 20}; /** @brief TDREP. */
+static const field32_t HRTIM_COMMON_BMTRG_TDRST       = {.msk = 0x00080000U, .pos = 19}; /** @brief TDRST. */
+static const field32_t HRTIM_COMMON_BMTRG_TCCMP2      = {.msk = 0x00040000U, .pos = 18}; /** @brief TCCMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_TCCMP1      = {.msk = 0x00020000U, .pos = 17}; /** @brief TCCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TCREP       = {.msk = 0x00010000U, .pos = 16}; /** @brief TCREP. */
+static const field32_t HRTIM_COMMON_BMTRG_TCRST       = {.msk = 0x00008000U, .pos = 15}; /** @brief TCRST. */
+static const field32_t HRTIM_COMMON_BMTRG_TBCMP2      = {.msk = 0x00004000U, .pos = 14}; /** @brief TBCMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_TBCMP1      = {.msk = 0x00002000U, .pos = 13}; /** @brief TBCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TBREP       = {.msk = 0x00001000U, .pos = 12}; /** @brief TBREP. */
+static const field32_t HRTIM_COMMON_BMTRG_TBRST       = {.msk = 0x00000800U, .pos = 11}; /** @brief TBRST. */
+static const field32_t HRTIM_COMMON_BMTRG_TACMP2      = {.msk = 0x00000400U, .pos = 10}; /** @brief TACMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_TACMP1      = {.msk = 0x00000200U, .pos = 9};  /** @brief TACMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TAREP       = {.msk = 0x00000100U, .pos = 8};  /** @brief TAREP. */
+static const field32_t HRTIM_COMMON_BMTRG_TARST       = {.msk = 0x00000080U, .pos = 7};  /** @brief TARST. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTCMP4     = {.msk = 0x00000040U, .pos = 6};  /** @brief MSTCMP4. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTCMP3     = {.msk = 0x00000020U, .pos = 5};  /** @brief MSTCMP3. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTCMP2     = {.msk = 0x00000010U, .pos = 4};  /** @brief MSTCMP2. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTCMP1     = {.msk = 0x00000008U, .pos = 3};  /** @brief MSTCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTREP      = {.msk = 0x00000004U, .pos = 2};  /** @brief MSTREP. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTRST      = {.msk = 0x00000002U, .pos = 1};  /** @brief MSTRST. */
+static const field32_t HRTIM_COMMON_BMTRG_SW          = {.msk = 0x00000001U, .pos = 0};  /** @brief SW. */
+static const field32_t HRTIM_COMMON_BMCMPR6_BMCMP     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief BMCMP. */
+static const field32_t HRTIM_COMMON_BMPER_BMPER       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Burst mode Period. */
+static const field32_t HRTIM_COMMON_EECR1_EE5FAST     = {.msk = 0x20000000U, .pos = 29}; /** @brief External Event 5 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EE5SNS      = {.msk = 0x18000000U, .pos = 27}; /** @brief External Event 5 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EE5POL      = {.msk = 0x04000000U, .pos = 26}; /** @brief External Event 5 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EE5SRC      = {.msk = 0x03000000U, .pos = 24}; /** @brief External Event 5 Source. */
+static const field32_t HRTIM_COMMON_EECR1_EE4FAST     = {.msk = 0x00800000U, .pos = 23}; /** @brief External Event 4 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EE4SNS      = {.msk = 0x00600000U, .pos = 21}; /** @brief External Event 4 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EE4POL      = {.msk = 0x00100000U, .pos = 20}; /** @brief External Event 4 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EE4SRC      = {.msk = 0x000C0000U, .pos = 18}; /** @brief External Event 4 Source. */
+static const field32_t HRTIM_COMMON_EECR1_EE3FAST     = {.msk = 0x00020000U, .pos = 17}; /** @brief External Event 3 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EE3SNS      = {.msk = 0x00018000U, .pos = 15}; /** @brief External Event 3 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EE3POL      = {.msk = 0x00004000U, .pos = 14}; /** @brief External Event 3 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EE3SRC      = {.msk = 0x00003000U, .pos = 12}; /** @brief External Event 3 Source. */
+static const field32_t HRTIM_COMMON_EECR1_EE2FAST     = {.msk = 0x00000800U, .pos = 11}; /** @brief External Event 2 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EE2SNS      = {.msk = 0x00000600U, .pos = 9};  /** @brief External Event 2 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EE2POL      = {.msk = 0x00000100U, .pos = 8};  /** @brief External Event 2 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EE2SRC      = {.msk = 0x000000C0U, .pos = 6};  /** @brief External Event 2 Source. */
+static const field32_t HRTIM_COMMON_EECR1_EE1FAST     = {.msk = 0x00000020U, .pos = 5};  /** @brief External Event 1 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EE1SNS      = {.msk = 0x00000018U, .pos = 3};  /** @brief External Event 1 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EE1POL      = {.msk = 0x00000004U, .pos = 2};  /** @brief External Event 1 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EE1SRC      = {.msk = 0x00000003U, .pos = 0};  /** @brief External Event 1 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EE10SNS     = {.msk = 0x18000000U, .pos = 27}; /** @brief External Event 10 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EE10POL     = {.msk = 0x04000000U, .pos = 26}; /** @brief External Event 10 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EE10SRC     = {.msk = 0x03000000U, .pos = 24}; /** @brief External Event 10 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EE9SNS      = {.msk = 0x00600000U, .pos = 21}; /** @brief External Event 9 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EE9POL      = {.msk = 0x00100000U, .pos = 20}; /** @brief External Event 9 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EE9SRC      = {.msk = 0x000C0000U, .pos = 18}; /** @brief External Event 9 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EE8SNS      = {.msk = 0x00018000U, .pos = 15}; /** @brief External Event 8 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EE8POL      = {.msk = 0x00004000U, .pos = 14}; /** @brief External Event 8 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EE8SRC      = {.msk = 0x00003000U, .pos = 12}; /** @brief External Event 8 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EE7SNS      = {.msk = 0x00000600U, .pos = 9};  /** @brief External Event 7 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EE7POL      = {.msk = 0x00000100U, .pos = 8};  /** @brief External Event 7 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EE7SRC      = {.msk = 0x000000C0U, .pos = 6};  /** @brief External Event 7 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EE6SNS      = {.msk = 0x00000018U, .pos = 3};  /** @brief External Event 6 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EE6POL      = {.msk = 0x00000004U, .pos = 2};  /** @brief External Event 6 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EE6SRC      = {.msk = 0x00000003U, .pos = 0};  /** @brief External Event 6 Source. */
+static const field32_t HRTIM_COMMON_EECR3_EE10SNS     = {.msk = 0x18000000U, .pos = 27}; /** @brief EE10SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EE10POL     = {.msk = 0x04000000U, .pos = 26}; /** @brief EE10POL. */
+static const field32_t HRTIM_COMMON_EECR3_EE10SRC     = {.msk = 0x03000000U, .pos = 24}; /** @brief EE10SRC. */
+static const field32_t HRTIM_COMMON_EECR3_EE9SNS      = {.msk = 0x00600000U, .pos = 21}; /** @brief EE9SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EE9POL      = {.msk = 0x00100000U, .pos = 20}; /** @brief EE9POL. */
+static const field32_t HRTIM_COMMON_EECR3_EE9SRC      = {.msk = 0x000C0000U, .pos = 18}; /** @brief EE9SRC. */
+static const field32_t HRTIM_COMMON_EECR3_EE8SNS      = {.msk = 0x00018000U, .pos = 15}; /** @brief EE8SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EE8POL      = {.msk = 0x00004000U, .pos = 14}; /** @brief EE8POL. */
+static const field32_t HRTIM_COMMON_EECR3_EE8SRC      = {.msk = 0x00003000U, .pos = 12}; /** @brief EE8SRC. */
+static const field32_t HRTIM_COMMON_EECR3_EE7SNS      = {.msk = 0x00000600U, .pos = 9};  /** @brief EE7SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EE7POL      = {.msk = 0x00000100U, .pos = 8};  /** @brief EE7POL. */
+static const field32_t HRTIM_COMMON_EECR3_EE7SRC      = {.msk = 0x000000C0U, .pos = 6};  /** @brief EE7SRC. */
+static const field32_t HRTIM_COMMON_EECR3_EE6SNS      = {.msk = 0x00000018U, .pos = 3};  /** @brief EE6SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EE6POL      = {.msk = 0x00000004U, .pos = 2};  /** @brief EE6POL. */
+static const field32_t HRTIM_COMMON_EECR3_EE6SRC      = {.msk = 0x00000003U, .pos = 0};  /** @brief EE6SRC. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TEPER    = {.msk = 0x80000000U, .pos = 31}; /** @brief ADC trigger 1 on Timer E Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TEC4     = {.msk = 0x40000000U, .pos = 30}; /** @brief ADC trigger 1 on Timer E compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TEC3     = {.msk = 0x20000000U, .pos = 29}; /** @brief ADC trigger 1 on Timer E compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TEC2     = {.msk = 0x10000000U, .pos = 28}; /** @brief ADC trigger 1 on Timer E compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TDPER    = {.msk = 0x08000000U, .pos = 27}; /** @brief ADC trigger 1 on Timer D Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TDC4     = {.msk = 0x04000000U, .pos = 26}; /** @brief ADC trigger 1 on Timer D compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TDC3     = {.msk = 0x02000000U, .pos = 25}; /** @brief ADC trigger 1 on Timer D compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TDC2     = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC trigger 1 on Timer D compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TCPER    = {.msk = 0x00800000U, .pos = 23}; /** @brief ADC trigger 1 on Timer C Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TCC4     = {.msk = 0x00400000U, .pos = 22}; /** @brief ADC trigger 1 on Timer C compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TCC3     = {.msk = 0x00200000U, .pos = 21}; /** @brief ADC trigger 1 on Timer C compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TCC2     = {.msk = 0x00100000U, .pos = 20}; /** @brief ADC trigger 1 on Timer C compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBRST    = {.msk = 0x00080000U, .pos = 19}; /** @brief ADC trigger 1 on Timer B Reset. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBPER    = {.msk = 0x00040000U, .pos = 18}; /** @brief ADC trigger 1 on Timer B Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBC4     = {.msk = 0x00020000U, .pos = 17}; /** @brief ADC trigger 1 on Timer B compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBC3     = {.msk = 0x00010000U, .pos = 16}; /** @brief ADC trigger 1 on Timer B compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBC2     = {.msk = 0x00008000U, .pos = 15}; /** @brief ADC trigger 1 on Timer B compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TARST    = {.msk = 0x00004000U, .pos = 14}; /** @brief ADC trigger 1 on Timer A Reset. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TAPER    = {.msk = 0x00002000U, .pos = 13}; /** @brief ADC trigger 1 on Timer A Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TAC4     = {.msk = 0x00001000U, .pos = 12}; /** @brief ADC trigger 1 on Timer A compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TAC3     = {.msk = 0x00000800U, .pos = 11}; /** @brief ADC trigger 1 on Timer A compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TAC2     = {.msk = 0x00000400U, .pos = 10}; /** @brief ADC trigger 1 on Timer A compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEV5     = {.msk = 0x00000200U, .pos = 9};  /** @brief ADC trigger 1 on External Event 5. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEV4     = {.msk = 0x00000100U, .pos = 8};  /** @brief ADC trigger 1 on External Event 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEV3     = {.msk = 0x00000080U, .pos = 7};  /** @brief ADC trigger 1 on External Event 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEV2     = {.msk = 0x00000040U, .pos = 6};  /** @brief ADC trigger 1 on External Event 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEV1     = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC trigger 1 on External Event 1. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MPER     = {.msk = 0x00000010U, .pos = 4};  /** @brief ADC trigger 1 on Master Period. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MC4      = {.msk = 0x00000008U, .pos = 3};  /** @brief ADC trigger 1 on Master Compare 4. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MC3      = {.msk = 0x00000004U, .pos = 2};  /** @brief ADC trigger 1 on Master Compare 3. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MC2      = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC trigger 1 on Master Compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MC1      = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC trigger 1 on Master Compare 1. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TERST    = {.msk = 0x80000000U, .pos = 31}; /** @brief ADC trigger 2 on Timer E Reset. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TEC4     = {.msk = 0x40000000U, .pos = 30}; /** @brief ADC trigger 2 on Timer E compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TEC3     = {.msk = 0x20000000U, .pos = 29}; /** @brief ADC trigger 2 on Timer E compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TEC2     = {.msk = 0x10000000U, .pos = 28}; /** @brief ADC trigger 2 on Timer E compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDRST    = {.msk = 0x08000000U, .pos = 27}; /** @brief ADC trigger 2 on Timer D Reset. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDPER    = {.msk = 0x04000000U, .pos = 26}; /** @brief ADC trigger 2 on Timer D Period. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDC4     = {.msk = 0x02000000U, .pos = 25}; /** @brief ADC trigger 2 on Timer D compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDC3     = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC trigger 2 on Timer D compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDC2     = {.msk = 0x00800000U, .pos = 23}; /** @brief ADC trigger 2 on Timer D compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCRST    = {.msk = 0x00400000U, .pos = 22}; /** @brief ADC trigger 2 on Timer C Reset. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCPER    = {.msk = 0x00200000U, .pos = 21}; /** @brief ADC trigger 2 on Timer C Period. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCC4     = {.msk = 0x00100000U, .pos = 20}; /** @brief ADC trigger 2 on Timer C compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCC3     = {.msk = 0x00080000U, .pos = 19}; /** @brief ADC trigger 2 on Timer C compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCC2     = {.msk = 0x00040000U, .pos = 18}; /** @brief ADC trigger 2 on Timer C compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TBPER    = {.msk = 0x00020000U, .pos = 17}; /** @brief ADC trigger 2 on Timer B Period. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TBC4     = {.msk = 0x00010000U, .pos = 16}; /** @brief ADC trigger 2 on Timer B compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TBC3     = {.msk = 0x00008000U, .pos = 15}; /** @brief ADC trigger 2 on Timer B compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TBC2     = {.msk = 0x00004000U, .pos = 14}; /** @brief ADC trigger 2 on Timer B compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TAPER    = {.msk = 0x00002000U, .pos = 13}; /** @brief ADC trigger 2 on Timer A Period. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TAC4     = {.msk = 0x00001000U, .pos = 12}; /** @brief ADC trigger 2 on Timer A compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TAC3     = {.msk = 0x00000800U, .pos = 11}; /** @brief ADC trigger 2 on Timer A compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TAC2     = {.msk = 0x00000400U, .pos = 10}; /** @brief ADC trigger 2 on Timer A compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEV10    = {.msk = 0x00000200U, .pos = 9};  /** @brief ADC trigger 2 on External Event 10. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEV9     = {.msk = 0x00000100U, .pos = 8};  /** @brief ADC trigger 2 on External Event 9. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEV8     = {.msk = 0x00000080U, .pos = 7};  /** @brief ADC trigger 2 on External Event 8. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEV7     = {.msk = 0x00000040U, .pos = 6};  /** @brief ADC trigger 2 on External Event 7. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEV6     = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC trigger 2 on External Event 6. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MPER     = {.msk = 0x00000010U, .pos = 4};  /** @brief ADC trigger 2 on Master Period. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MC4      = {.msk = 0x00000008U, .pos = 3};  /** @brief ADC trigger 2 on Master Compare 4. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MC3      = {.msk = 0x00000004U, .pos = 2};  /** @brief ADC trigger 2 on Master Compare 3. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MC2      = {.msk = 0x00000002U, .pos = 1};  /** @brief ADC trigger 2 on Master Compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MC1      = {.msk = 0x00000001U, .pos = 0};  /** @brief ADC trigger 2 on Master Compare 1. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TEPER    = {.msk = 0x80000000U, .pos = 31}; /** @brief AD1TEPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TEC4     = {.msk = 0x40000000U, .pos = 30}; /** @brief AD1TEC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TEC3     = {.msk = 0x20000000U, .pos = 29}; /** @brief AD1TEC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TEC2     = {.msk = 0x10000000U, .pos = 28}; /** @brief AD1TEC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TDPER    = {.msk = 0x08000000U, .pos = 27}; /** @brief AD1TDPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TDC4     = {.msk = 0x04000000U, .pos = 26}; /** @brief AD1TDC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TDC3     = {.msk = 0x02000000U, .pos = 25}; /** @brief AD1TDC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TDC2     = {.msk = 0x01000000U, .pos = 24}; /** @brief AD1TDC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TCPER    = {.msk = 0x00800000U, .pos = 23}; /** @brief AD1TCPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TCC4     = {.msk = 0x00400000U, .pos = 22}; /** @brief AD1TCC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TCC3     = {.msk = 0x00200000U, .pos = 21}; /** @brief AD1TCC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TCC2     = {.msk = 0x00100000U, .pos = 20}; /** @brief AD1TCC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBRST    = {.msk = 0x00080000U, .pos = 19}; /** @brief AD1TBRST. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBPER    = {.msk = 0x00040000U, .pos = 18}; /** @brief AD1TBPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBC4     = {.msk = 0x00020000U, .pos = 17}; /** @brief AD1TBC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBC3     = {.msk = 0x00010000U, .pos = 16}; /** @brief AD1TBC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBC2     = {.msk = 0x00008000U, .pos = 15}; /** @brief AD1TBC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TARST    = {.msk = 0x00004000U, .pos = 14}; /** @brief AD1TARST. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TAPER    = {.msk = 0x00002000U, .pos = 13}; /** @brief AD1TAPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TAC4     = {.msk = 0x00001000U, .pos = 12}; /** @brief AD1TAC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TAC3     = {.msk = 0x00000800U, .pos = 11}; /** @brief AD1TAC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TAC2     = {.msk = 0x00000400U, .pos = 10}; /** @brief AD1TAC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEV5     = {.msk = 0x00000200U, .pos = 9};  /** @brief AD1EEV5. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEV4     = {.msk = 0x00000100U, .pos = 8};  /** @brief AD1EEV4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEV3     = {.msk = 0x00000080U, .pos = 7};  /** @brief AD1EEV3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEV2     = {.msk = 0x00000040U, .pos = 6};  /** @brief AD1EEV2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEV1     = {.msk = 0x00000020U, .pos = 5};  /** @brief AD1EEV1. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MPER     = {.msk = 0x00000010U, .pos = 4};  /** @brief AD1MPER. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MC4      = {.msk = 0x00000008U, .pos = 3};  /** @brief AD1MC4. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MC3      = {.msk = 0x00000004U, .pos = 2};  /** @brief AD1MC3. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MC2      = {.msk = 0x00000002U, .pos = 1};  /** @brief AD1MC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MC1      = {.msk = 0x00000001U, .pos = 0};  /** @brief AD1MC1. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TERST    = {.msk = 0x80000000U, .pos = 31}; /** @brief AD2TERST. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TEC4     = {.msk = 0x40000000U, .pos = 30}; /** @brief AD2TEC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TEC3     = {.msk = 0x20000000U, .pos = 29}; /** @brief AD2TEC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TEC2     = {.msk = 0x10000000U, .pos = 28}; /** @brief AD2TEC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDRST    = {.msk = 0x08000000U, .pos = 27}; /** @brief AD2TDRST. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDPER    = {.msk = 0x04000000U, .pos = 26}; /** @brief AD2TDPER. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDC4     = {.msk = 0x02000000U, .pos = 25}; /** @brief AD2TDC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDC3     = {.msk = 0x01000000U, .pos = 24}; /** @brief AD2TDC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDC2     = {.msk = 0x00800000U, .pos = 23}; /** @brief AD2TDC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCRST    = {.msk = 0x00400000U, .pos = 22}; /** @brief AD2TCRST. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCPER    = {.msk = 0x00200000U, .pos = 21}; /** @brief AD2TCPER. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCC4     = {.msk = 0x00100000U, .pos = 20}; /** @brief AD2TCC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCC3     = {.msk = 0x00080000U, .pos = 19}; /** @brief AD2TCC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCC2     = {.msk = 0x00040000U, .pos = 18}; /** @brief AD2TCC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TBPER    = {.msk = 0x00020000U, .pos = 17}; /** @brief AD2TBPER. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TBC4     = {.msk = 0x00010000U, .pos = 16}; /** @brief AD2TBC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TBC3     = {.msk = 0x00008000U, .pos = 15}; /** @brief AD2TBC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TBC2     = {.msk = 0x00004000U, .pos = 14}; /** @brief AD2TBC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TAPER    = {.msk = 0x00002000U, .pos = 13}; /** @brief AD2TAPER. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TAC4     = {.msk = 0x00001000U, .pos = 12}; /** @brief AD2TAC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TAC3     = {.msk = 0x00000800U, .pos = 11}; /** @brief AD2TAC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TAC2     = {.msk = 0x00000400U, .pos = 10}; /** @brief AD2TAC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEV10    = {.msk = 0x00000200U, .pos = 9};  /** @brief AD2EEV10. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEV9     = {.msk = 0x00000100U, .pos = 8};  /** @brief AD2EEV9. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEV8     = {.msk = 0x00000080U, .pos = 7};  /** @brief AD2EEV8. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEV7     = {.msk = 0x00000040U, .pos = 6};  /** @brief AD2EEV7. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEV6     = {.msk = 0x00000020U, .pos = 5};  /** @brief AD2EEV6. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MPER     = {.msk = 0x00000010U, .pos = 4};  /** @brief AD2MPER. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MC4      = {.msk = 0x00000008U, .pos = 3};  /** @brief AD2MC4. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MC3      = {.msk = 0x00000004U, .pos = 2};  /** @brief AD2MC3. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MC2      = {.msk = 0x00000002U, .pos = 1};  /** @brief AD2MC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MC1      = {.msk = 0x00000001U, .pos = 0};  /** @brief AD2MC1. */
+static const field32_t HRTIM_COMMON_DLLCR_CALRTE      = {.msk = 0x0000000CU, .pos = 2};  /** @brief DLL Calibration rate. */
+static const field32_t HRTIM_COMMON_DLLCR_CALEN       = {.msk = 0x00000002U, .pos = 1};  /** @brief DLL Calibration Enable. */
+static const field32_t HRTIM_COMMON_DLLCR_CAL         = {.msk = 0x00000001U, .pos = 0};  /** @brief DLL Calibration Start. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT4LCK   = {.msk = 0x80000000U, .pos = 31}; /** @brief FLT4LCK. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT4F     = {.msk = 0x78000000U, .pos = 27}; /** @brief FLT4F. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT4SRC   = {.msk = 0x04000000U, .pos = 26}; /** @brief FLT4SRC. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT4P     = {.msk = 0x02000000U, .pos = 25}; /** @brief FLT4P. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT4E     = {.msk = 0x01000000U, .pos = 24}; /** @brief FLT4E. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT3LCK   = {.msk = 0x00800000U, .pos = 23}; /** @brief FLT3LCK. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT3F     = {.msk = 0x00780000U, .pos = 19}; /** @brief FLT3F. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT3SRC   = {.msk = 0x00040000U, .pos = 18}; /** @brief FLT3SRC. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT3P     = {.msk = 0x00020000U, .pos = 17}; /** @brief FLT3P. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT3E     = {.msk = 0x00010000U, .pos = 16}; /** @brief FLT3E. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT2LCK   = {.msk = 0x00008000U, .pos = 15}; /** @brief FLT2LCK. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT2F     = {.msk = 0x00007800U, .pos = 11}; /** @brief FLT2F. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT2SRC   = {.msk = 0x00000400U, .pos = 10}; /** @brief FLT2SRC. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT2P     = {.msk = 0x00000200U, .pos = 9};  /** @brief FLT2P. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT2E     = {.msk = 0x00000100U, .pos = 8};  /** @brief FLT2E. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT1LCK   = {.msk = 0x00000080U, .pos = 7};  /** @brief FLT1LCK. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT1F     = {.msk = 0x00000078U, .pos = 3};  /** @brief FLT1F. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT1SRC   = {.msk = 0x00000004U, .pos = 2};  /** @brief FLT1SRC. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT1P     = {.msk = 0x00000002U, .pos = 1};  /** @brief FLT1P. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLT1E     = {.msk = 0x00000001U, .pos = 0};  /** @brief FLT1E. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLTSD     = {.msk = 0x03000000U, .pos = 24}; /** @brief FLTSD. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLT5LCK   = {.msk = 0x00000080U, .pos = 7};  /** @brief FLT5LCK. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLT5F     = {.msk = 0x00000078U, .pos = 3};  /** @brief FLT5F. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLT5SRC   = {.msk = 0x00000004U, .pos = 2};  /** @brief FLT5SRC. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLT5P     = {.msk = 0x00000002U, .pos = 1};  /** @brief FLT5P. */
+static const field32_t HRTIM_COMMON_FLTINR2_FLT5E     = {.msk = 0x00000001U, .pos = 0};  /** @brief FLT5E. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCMP4     = {.msk = 0x00000200U, .pos = 9};  /** @brief MCMP4. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCMP3     = {.msk = 0x00000100U, .pos = 8};  /** @brief MCMP3. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCMP2     = {.msk = 0x00000080U, .pos = 7};  /** @brief MCMP2. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCMP1     = {.msk = 0x00000040U, .pos = 6};  /** @brief MCMP1. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MREP      = {.msk = 0x00000020U, .pos = 5};  /** @brief MREP. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MPER      = {.msk = 0x00000010U, .pos = 4};  /** @brief MPER. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCNT      = {.msk = 0x00000008U, .pos = 3};  /** @brief MCNT. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MDIER     = {.msk = 0x00000004U, .pos = 2};  /** @brief MDIER. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MICR      = {.msk = 0x00000002U, .pos = 1};  /** @brief MICR. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCR       = {.msk = 0x00000001U, .pos = 0};  /** @brief MCR. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXFLTR  = {.msk = 0x00100000U, .pos = 20}; /** @brief HRTIM_FLTxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXOUTR  = {.msk = 0x00080000U, .pos = 19}; /** @brief HRTIM_OUTxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCHPR  = {.msk = 0x00040000U, .pos = 18}; /** @brief HRTIM_CHPxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXRSTR  = {.msk = 0x00020000U, .pos = 17}; /** @brief HRTIM_RSTxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXEEFR2 = {.msk = 0x00010000U, .pos = 16}; /** @brief HRTIM_EEFxR2 register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXEEFR1 = {.msk = 0x00008000U, .pos = 15}; /** @brief HRTIM_EEFxR1 register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXRST2R = {.msk = 0x00004000U, .pos = 14}; /** @brief HRTIM_RST2xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXSET2R = {.msk = 0x00002000U, .pos = 13}; /** @brief HRTIM_SET2xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXRST1R = {.msk = 0x00001000U, .pos = 12}; /** @brief HRTIM_RST1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXSET1R = {.msk = 0x00000800U, .pos = 11}; /** @brief HRTIM_SET1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMX_DTXR = {.msk = 0x00000400U, .pos = 10}; /** @brief HRTIM_DTxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCMP4  = {.msk = 0x00000200U, .pos = 9};  /** @brief HRTIM_CMP4xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCMP3  = {.msk = 0x00000100U, .pos = 8};  /** @brief HRTIM_CMP3xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCMP2  = {.msk = 0x00000080U, .pos = 7};  /** @brief HRTIM_CMP2xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCMP1  = {.msk = 0x00000040U, .pos = 6};  /** @brief HRTIM_CMP1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXREP   = {.msk = 0x00000020U, .pos = 5};  /** @brief HRTIM_REPxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXPER   = {.msk = 0x00000010U, .pos = 4};  /** @brief HRTIM_PERxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCNT   = {.msk = 0x00000008U, .pos = 3};  /** @brief HRTIM_CNTxR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXDIER  = {.msk = 0x00000004U, .pos = 2};  /** @brief HRTIM_TIMxDIER register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXICR   = {.msk = 0x00000002U, .pos = 1};  /** @brief HRTIM_TIMxICR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCR    = {.msk = 0x00000001U, .pos = 0};  /** @brief HRTIM_TIMxCR register update enable. */
+
+/** @subsection Enumerated HRTIM_COMMON Register Field Definitions */
+
+/** @brief ADC Trigger 1 Update Source. */
+static const field32_t HRTIM_COMMON_CR1_ADxUSRC[5] = {
+  [1] = {.msk = 0x00070000U, .pos = 16},
+  [2] = {.msk = 0x00380000U, .pos = 19},
+  [3] = {.msk = 0x01C00000U, .pos = 22},
+  [4] = {.msk = 0x0E000000U, .pos = 25},
+};
+
+/** @brief Fault 1 Interrupt Flag. */
+static const field32_t HRTIM_COMMON_ISR_FLTx[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Fault 1 Interrupt Flag Clear. */
+static const field32_t HRTIM_COMMON_ICR_FLTxC[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Fault 1 Interrupt Enable. */
+static const field32_t HRTIM_COMMON_IER_FLTxIE[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief Timer E Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TExOEN[3] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief Timer D Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TDxOEN[3] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Timer C Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TCxOEN[3] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Timer B Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TBxOEN[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Timer A Output 1 Enable. */
+static const field32_t HRTIM_COMMON_OENR_TAxOEN[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief TE1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TExODIS[3] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief TD1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TDxODIS[3] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief TC1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TCxODIS[3] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief TB1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TBxODIS[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief TA1ODIS. */
+static const field32_t HRTIM_COMMON_DISR_TAxODIS[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief Timer E Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TExODS[3] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief Timer D Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TDxODS[3] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Timer C Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TCxODS[3] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Timer B Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TBxODS[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Timer A Output 1 disable status. */
+static const field32_t HRTIM_COMMON_ODSR_TAxODS[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief TECMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TECMPx[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief TDCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TDCMPx[3] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief TCCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TCCMPx[3] = {
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief TBCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TBCMPx[3] = {
+  [1] = {.msk = 0x00002000U, .pos = 13},
+  [2] = {.msk = 0x00004000U, .pos = 14},
+};
+
+/** @brief TACMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_TACMPx[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief MSTCMP1. */
+static const field32_t HRTIM_COMMON_BMTRG_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+  [4] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief External Event 1 Fast mode. */
+static const field32_t HRTIM_COMMON_EECR1_EExFAST[6] = {
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+  [3] = {.msk = 0x00020000U, .pos = 17},
+  [4] = {.msk = 0x00800000U, .pos = 23},
+  [5] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief External Event 1 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR1_EExSNS[6] = {
+  [1] = {.msk = 0x00000018U, .pos = 3},
+  [2] = {.msk = 0x00000600U, .pos = 9},
+  [3] = {.msk = 0x00018000U, .pos = 15},
+  [4] = {.msk = 0x00600000U, .pos = 21},
+  [5] = {.msk = 0x18000000U, .pos = 27},
+};
+
+/** @brief External Event 1 Polarity. */
+static const field32_t HRTIM_COMMON_EECR1_EExPOL[6] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+  [3] = {.msk = 0x00004000U, .pos = 14},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+  [5] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief External Event 1 Source. */
+static const field32_t HRTIM_COMMON_EECR1_EExSRC[6] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x000000C0U, .pos = 6},
+  [3] = {.msk = 0x00003000U, .pos = 12},
+  [4] = {.msk = 0x000C0000U, .pos = 18},
+  [5] = {.msk = 0x03000000U, .pos = 24},
+};
+
+/** @brief External Event 6 Sensitivity. */
+static const field32_t HRTIM_COMMON_EECR2_EExSNS[11] = {
+  [6]  = {.msk = 0x00000018U, .pos = 3},
+  [7]  = {.msk = 0x00000600U, .pos = 9},
+  [8]  = {.msk = 0x00018000U, .pos = 15},
+  [9]  = {.msk = 0x00600000U, .pos = 21},
+  [10] = {.msk = 0x18000000U, .pos = 27},
+};
+
+/** @brief External Event 6 Polarity. */
+static const field32_t HRTIM_COMMON_EECR2_EExPOL[11] = {
+  [6]  = {.msk = 0x00000004U, .pos = 2},
+  [7]  = {.msk = 0x00000100U, .pos = 8},
+  [8]  = {.msk = 0x00004000U, .pos = 14},
+  [9]  = {.msk = 0x00100000U, .pos = 20},
+  [10] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief External Event 6 Source. */
+static const field32_t HRTIM_COMMON_EECR2_EExSRC[11] = {
+  [6]  = {.msk = 0x00000003U, .pos = 0},
+  [7]  = {.msk = 0x000000C0U, .pos = 6},
+  [8]  = {.msk = 0x00003000U, .pos = 12},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x03000000U, .pos = 24},
+};
+
+/** @brief EE6SNS. */
+static const field32_t HRTIM_COMMON_EECR3_EExSNS[11] = {
+  [6]  = {.msk = 0x00000018U, .pos = 3},
+  [7]  = {.msk = 0x00000600U, .pos = 9},
+  [8]  = {.msk = 0x00018000U, .pos = 15},
+  [9]  = {.msk = 0x00600000U, .pos = 21},
+  [10] = {.msk = 0x18000000U, .pos = 27},
+};
+
+/** @brief EE6POL. */
+static const field32_t HRTIM_COMMON_EECR3_EExPOL[11] = {
+  [6]  = {.msk = 0x00000004U, .pos = 2},
+  [7]  = {.msk = 0x00000100U, .pos = 8},
+  [8]  = {.msk = 0x00004000U, .pos = 14},
+  [9]  = {.msk = 0x00100000U, .pos = 20},
+  [10] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief EE6SRC. */
+static const field32_t HRTIM_COMMON_EECR3_EExSRC[11] = {
+  [6]  = {.msk = 0x00000003U, .pos = 0},
+  [7]  = {.msk = 0x000000C0U, .pos = 6},
+  [8]  = {.msk = 0x00003000U, .pos = 12},
+  [9]  = {.msk = 0x000C0000U, .pos = 18},
+  [10] = {.msk = 0x03000000U, .pos = 24},
+};
+
+/** @brief ADC trigger 1 on Timer E compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TECx[5] = {
+  [2] = {.msk = 0x10000000U, .pos = 28},
+  [3] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief ADC trigger 1 on Timer D compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TDCx[5] = {
+  [2] = {.msk = 0x01000000U, .pos = 24},
+  [3] = {.msk = 0x02000000U, .pos = 25},
+  [4] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief ADC trigger 1 on Timer C compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TCCx[5] = {
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x00200000U, .pos = 21},
+  [4] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief ADC trigger 1 on Timer B compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TBCx[5] = {
+  [2] = {.msk = 0x00008000U, .pos = 15},
+  [3] = {.msk = 0x00010000U, .pos = 16},
+  [4] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief ADC trigger 1 on Timer A compare 2. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1TACx[5] = {
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief ADC trigger 1 on External Event 1. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1EEVx[6] = {
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00000100U, .pos = 8},
+  [5] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief ADC trigger 1 on Master Compare 1. */
+static const field32_t HRTIM_COMMON_ADC1R_AD1MCx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief ADC trigger 2 on Timer E compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TECx[5] = {
+  [2] = {.msk = 0x10000000U, .pos = 28},
+  [3] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief ADC trigger 2 on Timer D compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TDCx[5] = {
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief ADC trigger 2 on Timer C compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TCCx[5] = {
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief ADC trigger 2 on Timer B compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TBCx[5] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+  [4] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief ADC trigger 2 on Timer A compare 2. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2TACx[5] = {
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief ADC trigger 2 on External Event 6. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2EEVx[11] = {
+  [6]  = {.msk = 0x00000020U, .pos = 5},
+  [7]  = {.msk = 0x00000040U, .pos = 6},
+  [8]  = {.msk = 0x00000080U, .pos = 7},
+  [9]  = {.msk = 0x00000100U, .pos = 8},
+  [10] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief ADC trigger 2 on Master Compare 1. */
+static const field32_t HRTIM_COMMON_ADC2R_AD2MCx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief AD1TEC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TECx[5] = {
+  [2] = {.msk = 0x10000000U, .pos = 28},
+  [3] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief AD1TDC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TDCx[5] = {
+  [2] = {.msk = 0x01000000U, .pos = 24},
+  [3] = {.msk = 0x02000000U, .pos = 25},
+  [4] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief AD1TCC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TCCx[5] = {
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x00200000U, .pos = 21},
+  [4] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief AD1TBC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TBCx[5] = {
+  [2] = {.msk = 0x00008000U, .pos = 15},
+  [3] = {.msk = 0x00010000U, .pos = 16},
+  [4] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief AD1TAC2. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1TACx[5] = {
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief AD1EEV1. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1EEVx[6] = {
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00000100U, .pos = 8},
+  [5] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief AD1MC1. */
+static const field32_t HRTIM_COMMON_ADC3R_AD1MCx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief AD2TEC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TECx[5] = {
+  [2] = {.msk = 0x10000000U, .pos = 28},
+  [3] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief AD2TDC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TDCx[5] = {
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief AD2TCC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TCCx[5] = {
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief AD2TBC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TBCx[5] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+  [4] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief AD2TAC2. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2TACx[5] = {
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00000800U, .pos = 11},
+  [4] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief AD2EEV6. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2EEVx[11] = {
+  [6]  = {.msk = 0x00000020U, .pos = 5},
+  [7]  = {.msk = 0x00000040U, .pos = 6},
+  [8]  = {.msk = 0x00000080U, .pos = 7},
+  [9]  = {.msk = 0x00000100U, .pos = 8},
+  [10] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief AD2MC1. */
+static const field32_t HRTIM_COMMON_ADC4R_AD2MCx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief FLT1LCK. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLTxLCK[5] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+  [4] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief FLT1F. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLTxF[5] = {
+  [1] = {.msk = 0x00000078U, .pos = 3},
+  [2] = {.msk = 0x00007800U, .pos = 11},
+  [3] = {.msk = 0x00780000U, .pos = 19},
+  [4] = {.msk = 0x78000000U, .pos = 27},
+};
+
+/** @brief FLT1SRC. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLTxSRC[5] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [4] = {.msk = 0x04000000U, .pos = 26},
+};
+
+/** @brief FLT1P. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLTxP[5] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00020000U, .pos = 17},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief FLT1E. */
+static const field32_t HRTIM_COMMON_FLTINR1_FLTxE[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+  [3] = {.msk = 0x00010000U, .pos = 16},
+  [4] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief MCMP1. */
+static const field32_t HRTIM_COMMON_BDMUPDR_MCMPx[5] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief HRTIM_EEFxR1 register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXEEFRx[3] = {
+  [1] = {.msk = 0x00008000U, .pos = 15},
+  [2] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief HRTIM_RST1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXRSTxR[3] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00004000U, .pos = 14},
+};
+
+/** @brief HRTIM_SET1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXSETxR[3] = {
+  [1] = {.msk = 0x00000800U, .pos = 11},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief HRTIM_CMP1xR register update enable. */
+static const field32_t HRTIM_COMMON_BDTXUPR_TIMXCMPx[5] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+  [4] = {.msk = 0x00000200U, .pos = 9},
+};
@@ -0,0 +1,138 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/hrtim_master.h
+ * @authors UW SARP
+ * @brief Registers and fields of HRTIM_MASTER.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section HRTIM_MASTER Definitions
+ **************************************************************************************************/
+
+/** @subsection HRTIM_MASTER Register Definitions */
+
+static rw_reg32_t const HRTIM_MASTER_MCR    = (rw_reg32_t)0x40017400U; /** @brief Master Timer Control Register. */
+static ro_reg32_t const HRTIM_MASTER_MISR   = (ro_reg32_t)0x40017404U; /** @brief Master Timer Interrupt Status Register. */
+static rw_reg32_t const HRTIM_MASTER_MICR   = (rw_reg32_t)0x40017408U; /** @brief Master Timer Interrupt Clear Register. */
+static rw_reg32_t const HRTIM_MASTER_MDIER4 = (rw_reg32_t)0x4001740CU; /** @brief MDIER4. */
+static rw_reg32_t const HRTIM_MASTER_MCNTR  = (rw_reg32_t)0x40017410U; /** @brief Master Timer Counter Register. */
+static rw_reg32_t const HRTIM_MASTER_MPER   = (rw_reg32_t)0x40017414U; /** @brief Master Timer Period Register. */
+static rw_reg32_t const HRTIM_MASTER_MREP   = (rw_reg32_t)0x40017418U; /** @brief Master Timer Repetition Register. */
+static rw_reg32_t const HRTIM_MASTER_MCMP1R = (rw_reg32_t)0x4001741CU; /** @brief Master Timer Compare 1 Register. */
+static rw_reg32_t const HRTIM_MASTER_MCMP2R = (rw_reg32_t)0x40017424U; /** @brief Master Timer Compare 2 Register. */
+static rw_reg32_t const HRTIM_MASTER_MCMP3R = (rw_reg32_t)0x40017428U; /** @brief Master Timer Compare 3 Register. */
+static rw_reg32_t const HRTIM_MASTER_MCMP4R = (rw_reg32_t)0x4001742CU; /** @brief Master Timer Compare 4 Register. */
+
+/** @subsection HRTIM_MASTER Register Field Definitions */
+
+static const field32_t HRTIM_MASTER_MCR_BRSTDMA    = {.msk = 0xC0000000U, .pos = 30}; /** @brief Burst DMA Update. */
+static const field32_t HRTIM_MASTER_MCR_MREPU      = {.msk = 0x20000000U, .pos = 29}; /** @brief Master Timer Repetition update. */
+static const field32_t HRTIM_MASTER_MCR_PREEN      = {.msk = 0x08000000U, .pos = 27}; /** @brief Preload enable. */
+static const field32_t HRTIM_MASTER_MCR_DACSYNC    = {.msk = 0x06000000U, .pos = 25}; /** @brief AC Synchronization. */
+static const field32_t HRTIM_MASTER_MCR_TECEN      = {.msk = 0x00200000U, .pos = 21}; /** @brief Timer E counter enable. */
+static const field32_t HRTIM_MASTER_MCR_TDCEN      = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer D counter enable. */
+static const field32_t HRTIM_MASTER_MCR_TCCEN      = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer C counter enable. */
+static const field32_t HRTIM_MASTER_MCR_TBCEN      = {.msk = 0x00040000U, .pos = 18}; /** @brief Timer B counter enable. */
+static const field32_t HRTIM_MASTER_MCR_TACEN      = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer A counter enable. */
+static const field32_t HRTIM_MASTER_MCR_MCEN       = {.msk = 0x00010000U, .pos = 16}; /** @brief Master Counter enable. */
+static const field32_t HRTIM_MASTER_MCR_SYNC_SRC   = {.msk = 0x0000C000U, .pos = 14}; /** @brief Synchronization source. */
+static const field32_t HRTIM_MASTER_MCR_SYNC_OUT   = {.msk = 0x00003000U, .pos = 12}; /** @brief Synchronization output. */
+static const field32_t HRTIM_MASTER_MCR_SYNCSTRTM  = {.msk = 0x00000800U, .pos = 11}; /** @brief Synchronization Starts Master. */
+static const field32_t HRTIM_MASTER_MCR_SYNCRSTM   = {.msk = 0x00000400U, .pos = 10}; /** @brief Synchronization Resets Master. */
+static const field32_t HRTIM_MASTER_MCR_SYNC_IN    = {.msk = 0x00000300U, .pos = 8};  /** @brief Ynchronization input. */
+static const field32_t HRTIM_MASTER_MCR_HALF       = {.msk = 0x00000020U, .pos = 5};  /** @brief Half mode enable. */
+static const field32_t HRTIM_MASTER_MCR_RETRIG     = {.msk = 0x00000010U, .pos = 4};  /** @brief Master Re-triggerable mode. */
+static const field32_t HRTIM_MASTER_MCR_CONT       = {.msk = 0x00000008U, .pos = 3};  /** @brief Master Continuous mode. */
+static const field32_t HRTIM_MASTER_MCR_CK_PSC     = {.msk = 0x00000007U, .pos = 0};  /** @brief HRTIM Master Clock prescaler. */
+static const field32_t HRTIM_MASTER_MISR_MUPD      = {.msk = 0x00000040U, .pos = 6};  /** @brief Master Update Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_SYNC      = {.msk = 0x00000020U, .pos = 5};  /** @brief Sync Input Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MREP      = {.msk = 0x00000010U, .pos = 4};  /** @brief Master Repetition Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MCMP4     = {.msk = 0x00000008U, .pos = 3};  /** @brief Master Compare 4 Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MCMP3     = {.msk = 0x00000004U, .pos = 2};  /** @brief Master Compare 3 Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MCMP2     = {.msk = 0x00000002U, .pos = 1};  /** @brief Master Compare 2 Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MCMP1     = {.msk = 0x00000001U, .pos = 0};  /** @brief Master Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MICR_MUPDC     = {.msk = 0x00000040U, .pos = 6};  /** @brief Master update Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_SYNCC     = {.msk = 0x00000020U, .pos = 5};  /** @brief Sync Input Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MREPC     = {.msk = 0x00000010U, .pos = 4};  /** @brief Repetition Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MCMP4C    = {.msk = 0x00000008U, .pos = 3};  /** @brief Master Compare 4 Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MCMP3C    = {.msk = 0x00000004U, .pos = 2};  /** @brief Master Compare 3 Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MCMP2C    = {.msk = 0x00000002U, .pos = 1};  /** @brief Master Compare 2 Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MCMP1C    = {.msk = 0x00000001U, .pos = 0};  /** @brief Master Compare 1 Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MDIER4_MUPDDE  = {.msk = 0x00400000U, .pos = 22}; /** @brief MUPDDE. */
+static const field32_t HRTIM_MASTER_MDIER4_SYNCDE  = {.msk = 0x00200000U, .pos = 21}; /** @brief SYNCDE. */
+static const field32_t HRTIM_MASTER_MDIER4_MREPDE  = {.msk = 0x00100000U, .pos = 20}; /** @brief MREPDE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP4DE = {.msk = 0x00080000U, .pos = 19}; /** @brief MCMP4DE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP3DE = {.msk = 0x00040000U, .pos = 18}; /** @brief MCMP3DE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP2DE = {.msk = 0x00020000U, .pos = 17}; /** @brief MCMP2DE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP1DE = {.msk = 0x00010000U, .pos = 16}; /** @brief MCMP1DE. */
+static const field32_t HRTIM_MASTER_MDIER4_MUPDIE  = {.msk = 0x00000040U, .pos = 6};  /** @brief MUPDIE. */
+static const field32_t HRTIM_MASTER_MDIER4_SYNCIE  = {.msk = 0x00000020U, .pos = 5};  /** @brief SYNCIE. */
+static const field32_t HRTIM_MASTER_MDIER4_MREPIE  = {.msk = 0x00000010U, .pos = 4};  /** @brief MREPIE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP4IE = {.msk = 0x00000008U, .pos = 3};  /** @brief MCMP4IE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP3IE = {.msk = 0x00000004U, .pos = 2};  /** @brief MCMP3IE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP2IE = {.msk = 0x00000002U, .pos = 1};  /** @brief MCMP2IE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMP1IE = {.msk = 0x00000001U, .pos = 0};  /** @brief MCMP1IE. */
+static const field32_t HRTIM_MASTER_MCNTR_MCNT     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter value. */
+static const field32_t HRTIM_MASTER_MPER_MPER      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Master Timer Period value. */
+static const field32_t HRTIM_MASTER_MREP_MREP      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Master Timer Repetition counter value. */
+static const field32_t HRTIM_MASTER_MCMP1R_MCMP1   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Master Timer Compare 1 value. */
+static const field32_t HRTIM_MASTER_MCMP2R_MCMP2   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Master Timer Compare 2 value. */
+static const field32_t HRTIM_MASTER_MCMP3R_MCMP3   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Master Timer Compare 3 value. */
+static const field32_t HRTIM_MASTER_MCMP4R_MCMP4   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Master Timer Compare 4 value. */
+
+/** @subsection Enumerated HRTIM_MASTER Register Field Definitions */
+
+/** @brief Master Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_MASTER_MISR_MCMPx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Master Compare 1 Interrupt flag clear. */
+static const field32_t HRTIM_MASTER_MICR_MCMPxC[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief MCMP1DE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMPxDE[5] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [4] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief MCMP1IE. */
+static const field32_t HRTIM_MASTER_MDIER4_MCMPxIE[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
@@ -0,0 +1,712 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/hrtim_timb.h
+ * @authors UW SARP
+ * @brief Registers and fields of HRTIM_TIMB.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section HRTIM_TIMB Definitions
+ **************************************************************************************************/
+
+/** @subsection HRTIM_TIMB Register Definitions */
+
+static rw_reg32_t const HRTIM_TIMB_TIMBCR    = (rw_reg32_t)0x40017500U; /** @brief Timerx Control Register. */
+static ro_reg32_t const HRTIM_TIMB_TIMBISR   = (ro_reg32_t)0x40017504U; /** @brief Timerx Interrupt Status Register. */
+static rw_reg32_t const HRTIM_TIMB_TIMBICR   = (rw_reg32_t)0x40017508U; /** @brief Timerx Interrupt Clear Register. */
+static rw_reg32_t const HRTIM_TIMB_TIMBDIER5 = (rw_reg32_t)0x4001750CU; /** @brief TIMxDIER5. */
+static rw_reg32_t const HRTIM_TIMB_CNTR      = (rw_reg32_t)0x40017510U; /** @brief Timerx Counter Register. */
+static rw_reg32_t const HRTIM_TIMB_PERBR     = (rw_reg32_t)0x40017514U; /** @brief Timerx Period Register. */
+static rw_reg32_t const HRTIM_TIMB_REPBR     = (rw_reg32_t)0x40017518U; /** @brief Timerx Repetition Register. */
+static rw_reg32_t const HRTIM_TIMB_CMP1BR    = (rw_reg32_t)0x4001751CU; /** @brief Timerx Compare 1 Register. */
+static rw_reg32_t const HRTIM_TIMB_CMP1CBR   = (rw_reg32_t)0x40017520U; /** @brief Timerx Compare 1 Compound Register. */
+static rw_reg32_t const HRTIM_TIMB_CMP2BR    = (rw_reg32_t)0x40017524U; /** @brief Timerx Compare 2 Register. */
+static rw_reg32_t const HRTIM_TIMB_CMP3BR    = (rw_reg32_t)0x40017528U; /** @brief Timerx Compare 3 Register. */
+static rw_reg32_t const HRTIM_TIMB_CMP4BR    = (rw_reg32_t)0x4001752CU; /** @brief Timerx Compare 4 Register. */
+static ro_reg32_t const HRTIM_TIMB_CPT1BR    = (ro_reg32_t)0x40017530U; /** @brief Timerx Capture 1 Register. */
+static ro_reg32_t const HRTIM_TIMB_CPT2BR    = (ro_reg32_t)0x40017534U; /** @brief Timerx Capture 2 Register. */
+static rw_reg32_t const HRTIM_TIMB_DTBR      = (rw_reg32_t)0x40017538U; /** @brief Timerx Deadtime Register. */
+static rw_reg32_t const HRTIM_TIMB_EEFBR1    = (rw_reg32_t)0x4001754CU; /** @brief Timerx External Event Filtering Register 1. */
+static rw_reg32_t const HRTIM_TIMB_EEFBR2    = (rw_reg32_t)0x40017550U; /** @brief Timerx External Event Filtering Register 2. */
+static rw_reg32_t const HRTIM_TIMB_RSTBR     = (rw_reg32_t)0x40017554U; /** @brief TimerA Reset Register. */
+static rw_reg32_t const HRTIM_TIMB_CHPBR     = (rw_reg32_t)0x40017558U; /** @brief Timerx Chopper Register. */
+static rw_reg32_t const HRTIM_TIMB_OUTBR     = (rw_reg32_t)0x40017564U; /** @brief Timerx Output Register. */
+static rw_reg32_t const HRTIM_TIMB_FLTBR     = (rw_reg32_t)0x40017568U; /** @brief Timerx Fault Register. */
+
+/** @subsection Enumerated HRTIM_TIMB Register Definitions */
+
+/** @brief Timerx Output1 Set Register. */
+static rw_reg32_t const HRTIM_TIMB_SETBxR[3] = {
+  [1] = (rw_reg32_t)0x4001753CU,
+  [2] = (rw_reg32_t)0x40017544U,
+};
+
+/** @brief Timerx Output1 Reset Register. */
+static rw_reg32_t const HRTIM_TIMB_RSTBxR[3] = {
+  [1] = (rw_reg32_t)0x40017540U,
+  [2] = (rw_reg32_t)0x40017548U,
+};
+
+/** @brief Timerx Capture 2 Control Register. */
+static rw_reg32_t const HRTIM_TIMB_CPTxBCR[3] = {
+  [1] = (rw_reg32_t)0x4001755CU,
+  [2] = (rw_reg32_t)0x40017560U,
+};
+
+/** @subsection HRTIM_TIMB Register Field Definitions */
+
+static const field32_t HRTIM_TIMB_TIMBCR_UPDGAT      = {.msk = 0xF0000000U, .pos = 28}; /** @brief Update Gating. */
+static const field32_t HRTIM_TIMB_TIMBCR_PREEN       = {.msk = 0x08000000U, .pos = 27}; /** @brief Preload enable. */
+static const field32_t HRTIM_TIMB_TIMBCR_DACSYNC     = {.msk = 0x06000000U, .pos = 25}; /** @brief AC Synchronization. */
+static const field32_t HRTIM_TIMB_TIMBCR_MSTU        = {.msk = 0x01000000U, .pos = 24}; /** @brief Master Timer update. */
+static const field32_t HRTIM_TIMB_TIMBCR_TEU         = {.msk = 0x00800000U, .pos = 23}; /** @brief TEU. */
+static const field32_t HRTIM_TIMB_TIMBCR_TDU         = {.msk = 0x00400000U, .pos = 22}; /** @brief TDU. */
+static const field32_t HRTIM_TIMB_TIMBCR_TCU         = {.msk = 0x00200000U, .pos = 21}; /** @brief TCU. */
+static const field32_t HRTIM_TIMB_TIMBCR_TBU         = {.msk = 0x00100000U, .pos = 20}; /** @brief TBU. */
+static const field32_t HRTIM_TIMB_TIMBCR_TXRSTU      = {.msk = 0x00040000U, .pos = 18}; /** @brief Timerx reset update. */
+static const field32_t HRTIM_TIMB_TIMBCR_TXREPU      = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer x Repetition update. */
+static const field32_t HRTIM_TIMB_TIMBCR_DELCMP4     = {.msk = 0x0000C000U, .pos = 14}; /** @brief Delayed CMP4 mode. */
+static const field32_t HRTIM_TIMB_TIMBCR_DELCMP2     = {.msk = 0x00003000U, .pos = 12}; /** @brief Delayed CMP2 mode. */
+static const field32_t HRTIM_TIMB_TIMBCR_SYNCSTRTX   = {.msk = 0x00000800U, .pos = 11}; /** @brief Synchronization Starts Timer x. */
+static const field32_t HRTIM_TIMB_TIMBCR_SYNCRSTX    = {.msk = 0x00000400U, .pos = 10}; /** @brief Synchronization Resets Timer x. */
+static const field32_t HRTIM_TIMB_TIMBCR_PSHPLL      = {.msk = 0x00000040U, .pos = 6};  /** @brief Push-Pull mode enable. */
+static const field32_t HRTIM_TIMB_TIMBCR_HALF        = {.msk = 0x00000020U, .pos = 5};  /** @brief Half mode enable. */
+static const field32_t HRTIM_TIMB_TIMBCR_RETRIG      = {.msk = 0x00000010U, .pos = 4};  /** @brief Re-triggerable mode. */
+static const field32_t HRTIM_TIMB_TIMBCR_CONT        = {.msk = 0x00000008U, .pos = 3};  /** @brief Continuous mode. */
+static const field32_t HRTIM_TIMB_TIMBCR_CK_PSCX     = {.msk = 0x00000007U, .pos = 0};  /** @brief HRTIM Timer x Clock prescaler. */
+static const field32_t HRTIM_TIMB_TIMBISR_O2STAT     = {.msk = 0x00080000U, .pos = 19}; /** @brief Output 2 State. */
+static const field32_t HRTIM_TIMB_TIMBISR_O1STAT     = {.msk = 0x00040000U, .pos = 18}; /** @brief Output 1 State. */
+static const field32_t HRTIM_TIMB_TIMBISR_IPPSTAT    = {.msk = 0x00020000U, .pos = 17}; /** @brief Idle Push Pull Status. */
+static const field32_t HRTIM_TIMB_TIMBISR_CPPSTAT    = {.msk = 0x00010000U, .pos = 16}; /** @brief Current Push Pull Status. */
+static const field32_t HRTIM_TIMB_TIMBISR_DLYPRT     = {.msk = 0x00004000U, .pos = 14}; /** @brief Delayed Protection Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_RST        = {.msk = 0x00002000U, .pos = 13}; /** @brief Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_RSTX2      = {.msk = 0x00001000U, .pos = 12}; /** @brief Output 2 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_SETX2      = {.msk = 0x00000800U, .pos = 11}; /** @brief Output 2 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_RSTX1      = {.msk = 0x00000400U, .pos = 10}; /** @brief Output 1 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_SETX1      = {.msk = 0x00000200U, .pos = 9};  /** @brief Output 1 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CPT2       = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture2 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CPT1       = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture1 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_UPD        = {.msk = 0x00000040U, .pos = 6};  /** @brief Update Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_REP        = {.msk = 0x00000010U, .pos = 4};  /** @brief Repetition Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CMP4       = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare 4 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CMP3       = {.msk = 0x00000004U, .pos = 2};  /** @brief Compare 3 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CMP2       = {.msk = 0x00000002U, .pos = 1};  /** @brief Compare 2 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CMP1       = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBICR_DLYPRTC    = {.msk = 0x00004000U, .pos = 14}; /** @brief Delayed Protection Flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_RSTC       = {.msk = 0x00002000U, .pos = 13}; /** @brief Reset Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_RSTX2C     = {.msk = 0x00001000U, .pos = 12}; /** @brief Output 2 Reset flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_SET2XC     = {.msk = 0x00000800U, .pos = 11}; /** @brief Output 2 Set flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_RSTX1C     = {.msk = 0x00000400U, .pos = 10}; /** @brief Output 1 Reset flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_SET1XC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Output 1 Set flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CPT2C      = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture2 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CPT1C      = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_UPDC       = {.msk = 0x00000040U, .pos = 6};  /** @brief Update Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_REPC       = {.msk = 0x00000010U, .pos = 4};  /** @brief Repetition Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CMP4C      = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare 4 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CMP3C      = {.msk = 0x00000004U, .pos = 2};  /** @brief Compare 3 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CMP2C      = {.msk = 0x00000002U, .pos = 1};  /** @brief Compare 2 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CMP1C      = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare 1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_DLYPRTDE = {.msk = 0x40000000U, .pos = 30}; /** @brief DLYPRTDE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTDE    = {.msk = 0x20000000U, .pos = 29}; /** @brief RSTDE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTX2DE  = {.msk = 0x10000000U, .pos = 28}; /** @brief RSTx2DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_SETX2DE  = {.msk = 0x08000000U, .pos = 27}; /** @brief SETx2DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTX1DE  = {.msk = 0x04000000U, .pos = 26}; /** @brief RSTx1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_SET1XDE  = {.msk = 0x02000000U, .pos = 25}; /** @brief SET1xDE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPT2DE   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPT2DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPT1DE   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPT1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_UPDDE    = {.msk = 0x00400000U, .pos = 22}; /** @brief UPDDE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_REPDE    = {.msk = 0x00100000U, .pos = 20}; /** @brief REPDE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP4DE   = {.msk = 0x00080000U, .pos = 19}; /** @brief CMP4DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP3DE   = {.msk = 0x00040000U, .pos = 18}; /** @brief CMP3DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP2DE   = {.msk = 0x00020000U, .pos = 17}; /** @brief CMP2DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP1DE   = {.msk = 0x00010000U, .pos = 16}; /** @brief CMP1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_DLYPRTIE = {.msk = 0x00004000U, .pos = 14}; /** @brief DLYPRTIE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTIE    = {.msk = 0x00002000U, .pos = 13}; /** @brief RSTIE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTX2IE  = {.msk = 0x00001000U, .pos = 12}; /** @brief RSTx2IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_SETX2IE  = {.msk = 0x00000800U, .pos = 11}; /** @brief SETx2IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTX1IE  = {.msk = 0x00000400U, .pos = 10}; /** @brief RSTx1IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_SET1XIE  = {.msk = 0x00000200U, .pos = 9};  /** @brief SET1xIE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPT2IE   = {.msk = 0x00000100U, .pos = 8};  /** @brief CPT2IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPT1IE   = {.msk = 0x00000080U, .pos = 7};  /** @brief CPT1IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_UPDIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief UPDIE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_REPIE    = {.msk = 0x00000010U, .pos = 4};  /** @brief REPIE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP4IE   = {.msk = 0x00000008U, .pos = 3};  /** @brief CMP4IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP3IE   = {.msk = 0x00000004U, .pos = 2};  /** @brief CMP3IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP2IE   = {.msk = 0x00000002U, .pos = 1};  /** @brief CMP2IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMP1IE   = {.msk = 0x00000001U, .pos = 0};  /** @brief CMP1IE. */
+static const field32_t HRTIM_TIMB_CNTR_CNTX          = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Counter value. */
+static const field32_t HRTIM_TIMB_PERBR_PERX         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Period value. */
+static const field32_t HRTIM_TIMB_REPBR_REPX         = {.msk = 0x000000FFU, .pos = 0};  /** @brief Timerx Repetition counter value. */
+static const field32_t HRTIM_TIMB_CMP1BR_CMP1X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 1 value. */
+static const field32_t HRTIM_TIMB_CMP1CBR_REPX       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Timerx Repetition value (aliased from HRTIM_REPx register). */
+static const field32_t HRTIM_TIMB_CMP1CBR_CMP1X      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 1 value. */
+static const field32_t HRTIM_TIMB_CMP2BR_CMP2X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 2 value. */
+static const field32_t HRTIM_TIMB_CMP3BR_CMP3X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 3 value. */
+static const field32_t HRTIM_TIMB_CMP4BR_CMP4X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 4 value. */
+static const field32_t HRTIM_TIMB_CPT1BR_CPT1X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Capture 1 value. */
+static const field32_t HRTIM_TIMB_CPT2BR_CPT2X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Capture 2 value. */
+static const field32_t HRTIM_TIMB_DTBR_DTFLKX        = {.msk = 0x80000000U, .pos = 31}; /** @brief Deadtime Falling Lock. */
+static const field32_t HRTIM_TIMB_DTBR_DTFSLKX       = {.msk = 0x40000000U, .pos = 30}; /** @brief Deadtime Falling Sign Lock. */
+static const field32_t HRTIM_TIMB_DTBR_SDTFX         = {.msk = 0x02000000U, .pos = 25}; /** @brief Sign Deadtime Falling value. */
+static const field32_t HRTIM_TIMB_DTBR_DTFX          = {.msk = 0x01FF0000U, .pos = 16}; /** @brief Deadtime Falling value. */
+static const field32_t HRTIM_TIMB_DTBR_DTRLKX        = {.msk = 0x00008000U, .pos = 15}; /** @brief Deadtime Rising Lock. */
+static const field32_t HRTIM_TIMB_DTBR_DTRSLKX       = {.msk = 0x00004000U, .pos = 14}; /** @brief Deadtime Rising Sign Lock. */
+static const field32_t HRTIM_TIMB_DTBR_DTPRSC        = {.msk = 0x00001C00U, .pos = 10}; /** @brief Deadtime Prescaler. */
+static const field32_t HRTIM_TIMB_DTBR_SDTRX         = {.msk = 0x00000200U, .pos = 9};  /** @brief Sign Deadtime Rising value. */
+static const field32_t HRTIM_TIMB_DTBR_DTRX          = {.msk = 0x000001FFU, .pos = 0};  /** @brief Deadtime Rising value. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE5FLTR     = {.msk = 0x1E000000U, .pos = 25}; /** @brief External Event 5 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE5LTCH     = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 5 latch. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE4FLTR     = {.msk = 0x00780000U, .pos = 19}; /** @brief External Event 4 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE4LTCH     = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 4 latch. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE3FLTR     = {.msk = 0x0001E000U, .pos = 13}; /** @brief External Event 3 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE3LTCH     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 3 latch. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE2FLTR     = {.msk = 0x00000780U, .pos = 7};  /** @brief External Event 2 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE2LTCH     = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 2 latch. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE1FLTR     = {.msk = 0x0000001EU, .pos = 1};  /** @brief External Event 1 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EE1LTCH     = {.msk = 0x00000001U, .pos = 0};  /** @brief External Event 1 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE10FLTR    = {.msk = 0x1E000000U, .pos = 25}; /** @brief External Event 10 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE10LTCH    = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 10 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE9FLTR     = {.msk = 0x00780000U, .pos = 19}; /** @brief External Event 9 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE9LTCH     = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 9 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE8FLTR     = {.msk = 0x0001E000U, .pos = 13}; /** @brief External Event 8 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE8LTCH     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 8 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE7FLTR     = {.msk = 0x00000780U, .pos = 7};  /** @brief External Event 7 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE7LTCH     = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 7 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE6FLTR     = {.msk = 0x0000001EU, .pos = 1};  /** @brief External Event 6 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EE6LTCH     = {.msk = 0x00000001U, .pos = 0};  /** @brief External Event 6 latch. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMECMP4     = {.msk = 0x40000000U, .pos = 30}; /** @brief Timer E Compare 4. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMECMP2     = {.msk = 0x20000000U, .pos = 29}; /** @brief Timer E Compare 2. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMECMP1     = {.msk = 0x10000000U, .pos = 28}; /** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMDCMP4     = {.msk = 0x08000000U, .pos = 27}; /** @brief Timer D Compare 4. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMDCMP2     = {.msk = 0x04000000U, .pos = 26}; /** @brief Timer D Compare 2. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMDCMP1     = {.msk = 0x02000000U, .pos = 25}; /** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMCCMP4     = {.msk = 0x01000000U, .pos = 24}; /** @brief Timer C Compare 4. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMCCMP2     = {.msk = 0x00800000U, .pos = 23}; /** @brief Timer C Compare 2. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMCCMP1     = {.msk = 0x00400000U, .pos = 22}; /** @brief Timer C Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMACMP4     = {.msk = 0x00200000U, .pos = 21}; /** @brief Timer A Compare 4. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMACMP2     = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer A Compare 2. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMACMP1     = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT10    = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 10. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT9     = {.msk = 0x00020000U, .pos = 17}; /** @brief External Event 9. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT8     = {.msk = 0x00010000U, .pos = 16}; /** @brief External Event 8. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT7     = {.msk = 0x00008000U, .pos = 15}; /** @brief External Event 7. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT6     = {.msk = 0x00004000U, .pos = 14}; /** @brief External Event 6. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT5     = {.msk = 0x00002000U, .pos = 13}; /** @brief External Event 5. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT4     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 4. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT3     = {.msk = 0x00000800U, .pos = 11}; /** @brief External Event 3. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT2     = {.msk = 0x00000400U, .pos = 10}; /** @brief External Event 2. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNT1     = {.msk = 0x00000200U, .pos = 9};  /** @brief External Event 1. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTCMP4      = {.msk = 0x00000100U, .pos = 8};  /** @brief Master compare 4. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTCMP3      = {.msk = 0x00000080U, .pos = 7};  /** @brief Master compare 3. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTCMP2      = {.msk = 0x00000040U, .pos = 6};  /** @brief Master compare 2. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTCMP1      = {.msk = 0x00000020U, .pos = 5};  /** @brief Master compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTPER       = {.msk = 0x00000010U, .pos = 4};  /** @brief Master timer Period. */
+static const field32_t HRTIM_TIMB_RSTBR_CMP4         = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer A compare 4 reset. */
+static const field32_t HRTIM_TIMB_RSTBR_CMP2         = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer A compare 2 reset. */
+static const field32_t HRTIM_TIMB_RSTBR_UPDT         = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Update reset. */
+static const field32_t HRTIM_TIMB_CHPBR_STRTPW       = {.msk = 0x00000780U, .pos = 7};  /** @brief STRTPW. */
+static const field32_t HRTIM_TIMB_CHPBR_CHPDTY       = {.msk = 0x00000070U, .pos = 4};  /** @brief Timerx chopper duty cycle value. */
+static const field32_t HRTIM_TIMB_CHPBR_CHPFRQ       = {.msk = 0x0000000FU, .pos = 0};  /** @brief Timerx carrier frequency value. */
+static const field32_t HRTIM_TIMB_OUTBR_DIDL2        = {.msk = 0x00800000U, .pos = 23}; /** @brief Output 2 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMB_OUTBR_CHP2         = {.msk = 0x00400000U, .pos = 22}; /** @brief Output 2 Chopper enable. */
+static const field32_t HRTIM_TIMB_OUTBR_FAULT2       = {.msk = 0x00300000U, .pos = 20}; /** @brief Output 2 Fault state. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLES2       = {.msk = 0x00080000U, .pos = 19}; /** @brief Output 2 Idle State. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLEM2       = {.msk = 0x00040000U, .pos = 18}; /** @brief Output 2 Idle mode. */
+static const field32_t HRTIM_TIMB_OUTBR_POL2         = {.msk = 0x00020000U, .pos = 17}; /** @brief Output 2 polarity. */
+static const field32_t HRTIM_TIMB_OUTBR_DLYPRT       = {.msk = 0x00001C00U, .pos = 10}; /** @brief Delayed Protection. */
+static const field32_t HRTIM_TIMB_OUTBR_DLYPRTEN     = {.msk = 0x00000200U, .pos = 9};  /** @brief Delayed Protection Enable. */
+static const field32_t HRTIM_TIMB_OUTBR_DTEN         = {.msk = 0x00000100U, .pos = 8};  /** @brief Deadtime enable. */
+static const field32_t HRTIM_TIMB_OUTBR_DIDL1        = {.msk = 0x00000080U, .pos = 7};  /** @brief Output 1 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMB_OUTBR_CHP1         = {.msk = 0x00000040U, .pos = 6};  /** @brief Output 1 Chopper enable. */
+static const field32_t HRTIM_TIMB_OUTBR_FAULT1       = {.msk = 0x00000030U, .pos = 4};  /** @brief Output 1 Fault state. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLES1       = {.msk = 0x00000008U, .pos = 3};  /** @brief Output 1 Idle State. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLEM1       = {.msk = 0x00000004U, .pos = 2};  /** @brief Output 1 Idle mode. */
+static const field32_t HRTIM_TIMB_OUTBR_POL1         = {.msk = 0x00000002U, .pos = 1};  /** @brief Output 1 polarity. */
+static const field32_t HRTIM_TIMB_FLTBR_FLTLCK       = {.msk = 0x80000000U, .pos = 31}; /** @brief Fault sources Lock. */
+static const field32_t HRTIM_TIMB_FLTBR_FLT5EN       = {.msk = 0x00000010U, .pos = 4};  /** @brief Fault 5 enable. */
+static const field32_t HRTIM_TIMB_FLTBR_FLT4EN       = {.msk = 0x00000008U, .pos = 3};  /** @brief Fault 4 enable. */
+static const field32_t HRTIM_TIMB_FLTBR_FLT3EN       = {.msk = 0x00000004U, .pos = 2};  /** @brief Fault 3 enable. */
+static const field32_t HRTIM_TIMB_FLTBR_FLT2EN       = {.msk = 0x00000002U, .pos = 1};  /** @brief Fault 2 enable. */
+static const field32_t HRTIM_TIMB_FLTBR_FLT1EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Fault 1 enable. */
+static const field32_t HRTIM_TIMB_SETBxR_UPDATE      = {.msk = 0x80000000U, .pos = 31}; /** @brief Registers update (transfer preload to active). */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT10   = {.msk = 0x40000000U, .pos = 30}; /** @brief External Event 10. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT9    = {.msk = 0x20000000U, .pos = 29}; /** @brief External Event 9. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT8    = {.msk = 0x10000000U, .pos = 28}; /** @brief External Event 8. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT7    = {.msk = 0x08000000U, .pos = 27}; /** @brief External Event 7. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT6    = {.msk = 0x04000000U, .pos = 26}; /** @brief External Event 6. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT5    = {.msk = 0x02000000U, .pos = 25}; /** @brief External Event 5. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT4    = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 4. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT3    = {.msk = 0x00800000U, .pos = 23}; /** @brief External Event 3. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT2    = {.msk = 0x00400000U, .pos = 22}; /** @brief External Event 2. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNT1    = {.msk = 0x00200000U, .pos = 21}; /** @brief External Event 1. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT9    = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer Event 9. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT8    = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer Event 8. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT7    = {.msk = 0x00040000U, .pos = 18}; /** @brief Timer Event 7. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT6    = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer Event 6. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT5    = {.msk = 0x00010000U, .pos = 16}; /** @brief Timer Event 5. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT4    = {.msk = 0x00008000U, .pos = 15}; /** @brief Timer Event 4. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT3    = {.msk = 0x00004000U, .pos = 14}; /** @brief Timer Event 3. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT2    = {.msk = 0x00002000U, .pos = 13}; /** @brief Timer Event 2. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNT1    = {.msk = 0x00001000U, .pos = 12}; /** @brief Timer Event 1. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTCMP4     = {.msk = 0x00000800U, .pos = 11}; /** @brief Master Compare 4. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTCMP3     = {.msk = 0x00000400U, .pos = 10}; /** @brief Master Compare 3. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTCMP2     = {.msk = 0x00000200U, .pos = 9};  /** @brief Master Compare 2. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTCMP1     = {.msk = 0x00000100U, .pos = 8};  /** @brief Master Compare 1. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTPER      = {.msk = 0x00000080U, .pos = 7};  /** @brief Master Period. */
+static const field32_t HRTIM_TIMB_SETBxR_CMP4        = {.msk = 0x00000040U, .pos = 6};  /** @brief Timer A compare 4. */
+static const field32_t HRTIM_TIMB_SETBxR_CMP3        = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer A compare 3. */
+static const field32_t HRTIM_TIMB_SETBxR_CMP2        = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer A compare 2. */
+static const field32_t HRTIM_TIMB_SETBxR_CMP1        = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer A compare 1. */
+static const field32_t HRTIM_TIMB_SETBxR_PER         = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer A Period. */
+static const field32_t HRTIM_TIMB_SETBxR_RESYNC      = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A resynchronizaton. */
+static const field32_t HRTIM_TIMB_SETBxR_SST         = {.msk = 0x00000001U, .pos = 0};  /** @brief Software Set trigger. */
+static const field32_t HRTIM_TIMB_RSTBxR_UPDATE      = {.msk = 0x80000000U, .pos = 31}; /** @brief UPDATE. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT10   = {.msk = 0x40000000U, .pos = 30}; /** @brief EXTEVNT10. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT9    = {.msk = 0x20000000U, .pos = 29}; /** @brief EXTEVNT9. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT8    = {.msk = 0x10000000U, .pos = 28}; /** @brief EXTEVNT8. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT7    = {.msk = 0x08000000U, .pos = 27}; /** @brief EXTEVNT7. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT6    = {.msk = 0x04000000U, .pos = 26}; /** @brief EXTEVNT6. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT5    = {.msk = 0x02000000U, .pos = 25}; /** @brief EXTEVNT5. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT4    = {.msk = 0x01000000U, .pos = 24}; /** @brief EXTEVNT4. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT3    = {.msk = 0x00800000U, .pos = 23}; /** @brief EXTEVNT3. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT2    = {.msk = 0x00400000U, .pos = 22}; /** @brief EXTEVNT2. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNT1    = {.msk = 0x00200000U, .pos = 21}; /** @brief EXTEVNT1. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT9    = {.msk = 0x00100000U, .pos = 20}; /** @brief TIMEVNT9. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT8    = {.msk = 0x00080000U, .pos = 19}; /** @brief TIMEVNT8. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT7    = {.msk = 0x00040000U, .pos = 18}; /** @brief TIMEVNT7. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT6    = {.msk = 0x00020000U, .pos = 17}; /** @brief TIMEVNT6. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT5    = {.msk = 0x00010000U, .pos = 16}; /** @brief TIMEVNT5. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT4    = {.msk = 0x00008000U, .pos = 15}; /** @brief TIMEVNT4. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT3    = {.msk = 0x00004000U, .pos = 14}; /** @brief TIMEVNT3. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT2    = {.msk = 0x00002000U, .pos = 13}; /** @brief TIMEVNT2. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNT1    = {.msk = 0x00001000U, .pos = 12}; /** @brief TIMEVNT1. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTCMP4     = {.msk = 0x00000800U, .pos = 11}; /** @brief MSTCMP4. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTCMP3     = {.msk = 0x00000400U, .pos = 10}; /** @brief MSTCMP3. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTCMP2     = {.msk = 0x00000200U, .pos = 9};  /** @brief MSTCMP2. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTCMP1     = {.msk = 0x00000100U, .pos = 8};  /** @brief MSTCMP1. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTPER      = {.msk = 0x00000080U, .pos = 7};  /** @brief MSTPER. */
+static const field32_t HRTIM_TIMB_RSTBxR_CMP4        = {.msk = 0x00000040U, .pos = 6};  /** @brief CMP4. */
+static const field32_t HRTIM_TIMB_RSTBxR_CMP3        = {.msk = 0x00000020U, .pos = 5};  /** @brief CMP3. */
+static const field32_t HRTIM_TIMB_RSTBxR_CMP2        = {.msk = 0x00000010U, .pos = 4};  /** @brief CMP2. */
+static const field32_t HRTIM_TIMB_RSTBxR_CMP1        = {.msk = 0x00000008U, .pos = 3};  /** @brief CMP1. */
+static const field32_t HRTIM_TIMB_RSTBxR_PER         = {.msk = 0x00000004U, .pos = 2};  /** @brief PER. */
+static const field32_t HRTIM_TIMB_RSTBxR_RESYNC      = {.msk = 0x00000002U, .pos = 1};  /** @brief RESYNC. */
+static const field32_t HRTIM_TIMB_RSTBxR_SRT         = {.msk = 0x00000001U, .pos = 0};  /** @brief SRT. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TECMP2     = {.msk = 0x80000000U, .pos = 31}; /** @brief Timer E Compare 2. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TECMP1     = {.msk = 0x40000000U, .pos = 30}; /** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TE1RST     = {.msk = 0x20000000U, .pos = 29}; /** @brief Timer E output 1 Reset. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TE1SET     = {.msk = 0x10000000U, .pos = 28}; /** @brief Timer E output 1 Set. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TDCMP2     = {.msk = 0x08000000U, .pos = 27}; /** @brief Timer D Compare 2. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TDCMP1     = {.msk = 0x04000000U, .pos = 26}; /** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TD1RST     = {.msk = 0x02000000U, .pos = 25}; /** @brief Timer D output 1 Reset. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TD1SET     = {.msk = 0x01000000U, .pos = 24}; /** @brief Timer D output 1 Set. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TCCMP2     = {.msk = 0x00800000U, .pos = 23}; /** @brief Timer C Compare 2. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TCCMP1     = {.msk = 0x00400000U, .pos = 22}; /** @brief Timer C Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TC1RST     = {.msk = 0x00200000U, .pos = 21}; /** @brief Timer C output 1 Reset. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TC1SET     = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer C output 1 Set. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TACMP2     = {.msk = 0x00008000U, .pos = 15}; /** @brief Timer A Compare 2. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TACMP1     = {.msk = 0x00004000U, .pos = 14}; /** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TA1RST     = {.msk = 0x00002000U, .pos = 13}; /** @brief Timer A output 1 Reset. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TA1SET     = {.msk = 0x00001000U, .pos = 12}; /** @brief Timer A output 1 Set. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV10CPT  = {.msk = 0x00000800U, .pos = 11}; /** @brief External Event 10 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV9CPT   = {.msk = 0x00000400U, .pos = 10}; /** @brief External Event 9 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV8CPT   = {.msk = 0x00000200U, .pos = 9};  /** @brief External Event 8 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV7CPT   = {.msk = 0x00000100U, .pos = 8};  /** @brief External Event 7 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV6CPT   = {.msk = 0x00000080U, .pos = 7};  /** @brief External Event 6 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV5CPT   = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 5 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV4CPT   = {.msk = 0x00000020U, .pos = 5};  /** @brief External Event 4 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV3CPT   = {.msk = 0x00000010U, .pos = 4};  /** @brief External Event 3 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV2CPT   = {.msk = 0x00000008U, .pos = 3};  /** @brief External Event 2 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEV1CPT   = {.msk = 0x00000004U, .pos = 2};  /** @brief External Event 1 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_UDPCPT     = {.msk = 0x00000002U, .pos = 1};  /** @brief Update Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_SWCPT      = {.msk = 0x00000001U, .pos = 0};  /** @brief Software Capture. */
+
+/** @subsection Enumerated HRTIM_TIMB Register Field Definitions */
+
+/** @brief Delayed CMP2 mode. */
+static const field32_t HRTIM_TIMB_TIMBCR_DELCMPx[5] = {
+  [2] = {.msk = 0x00003000U, .pos = 12},
+  [4] = {.msk = 0x0000C000U, .pos = 14},
+};
+
+/** @brief Output 1 State. */
+static const field32_t HRTIM_TIMB_TIMBISR_OxSTAT[3] = {
+  [1] = {.msk = 0x00040000U, .pos = 18},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Output 1 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_RSTXx[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Output 1 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_SETXx[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Capture1 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CPTx[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_TIMB_TIMBISR_CMPx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Output 1 Reset flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_RSTXxC[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Output 1 Set flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_SETxXC[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Capture1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CPTxC[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Compare 1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMB_TIMBICR_CMPxC[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief RSTx1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTXxDE[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief CPT1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPTxDE[3] = {
+  [1] = {.msk = 0x00800000U, .pos = 23},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief CMP1DE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMPxDE[5] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [4] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief RSTx1IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_RSTXxIE[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief CPT1IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CPTxIE[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief CMP1IE. */
+static const field32_t HRTIM_TIMB_TIMBDIER5_CMPxIE[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief External Event 1 filter. */
+static const field32_t HRTIM_TIMB_EEFBR1_EExFLTR[6] = {
+  [1] = {.msk = 0x0000001EU, .pos = 1},
+  [2] = {.msk = 0x00000780U, .pos = 7},
+  [3] = {.msk = 0x0001E000U, .pos = 13},
+  [4] = {.msk = 0x00780000U, .pos = 19},
+  [5] = {.msk = 0x1E000000U, .pos = 25},
+};
+
+/** @brief External Event 1 latch. */
+static const field32_t HRTIM_TIMB_EEFBR1_EExLTCH[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00040000U, .pos = 18},
+  [5] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief External Event 6 filter. */
+static const field32_t HRTIM_TIMB_EEFBR2_EExFLTR[11] = {
+  [6]  = {.msk = 0x0000001EU, .pos = 1},
+  [7]  = {.msk = 0x00000780U, .pos = 7},
+  [8]  = {.msk = 0x0001E000U, .pos = 13},
+  [9]  = {.msk = 0x00780000U, .pos = 19},
+  [10] = {.msk = 0x1E000000U, .pos = 25},
+};
+
+/** @brief External Event 6 latch. */
+static const field32_t HRTIM_TIMB_EEFBR2_EExLTCH[11] = {
+  [6]  = {.msk = 0x00000001U, .pos = 0},
+  [7]  = {.msk = 0x00000040U, .pos = 6},
+  [8]  = {.msk = 0x00001000U, .pos = 12},
+  [9]  = {.msk = 0x00040000U, .pos = 18},
+  [10] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMECMPx[5] = {
+  [1] = {.msk = 0x10000000U, .pos = 28},
+  [2] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMDCMPx[5] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x04000000U, .pos = 26},
+  [4] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Timer C Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMCCMPx[5] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [4] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_TIMACMPx[5] = {
+  [1] = {.msk = 0x00080000U, .pos = 19},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [4] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief External Event 1. */
+static const field32_t HRTIM_TIMB_RSTBR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00000200U, .pos = 9},
+  [2]  = {.msk = 0x00000400U, .pos = 10},
+  [3]  = {.msk = 0x00000800U, .pos = 11},
+  [4]  = {.msk = 0x00001000U, .pos = 12},
+  [5]  = {.msk = 0x00002000U, .pos = 13},
+  [6]  = {.msk = 0x00004000U, .pos = 14},
+  [7]  = {.msk = 0x00008000U, .pos = 15},
+  [8]  = {.msk = 0x00010000U, .pos = 16},
+  [9]  = {.msk = 0x00020000U, .pos = 17},
+  [10] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief Master compare 1. */
+static const field32_t HRTIM_TIMB_RSTBR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Timer A compare 2 reset. */
+static const field32_t HRTIM_TIMB_RSTBR_CMPx[5] = {
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Output 1 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMB_OUTBR_DIDLx[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief Output 1 Chopper enable. */
+static const field32_t HRTIM_TIMB_OUTBR_CHPx[3] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Output 1 Fault state. */
+static const field32_t HRTIM_TIMB_OUTBR_FAULTx[3] = {
+  [1] = {.msk = 0x00000030U, .pos = 4},
+  [2] = {.msk = 0x00300000U, .pos = 20},
+};
+
+/** @brief Output 1 Idle State. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLESx[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Output 1 Idle mode. */
+static const field32_t HRTIM_TIMB_OUTBR_IDLEMx[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief Output 1 polarity. */
+static const field32_t HRTIM_TIMB_OUTBR_POLx[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief Fault 1 enable. */
+static const field32_t HRTIM_TIMB_FLTBR_FLTxEN[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief External Event 1. */
+static const field32_t HRTIM_TIMB_SETBxR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00200000U, .pos = 21},
+  [2]  = {.msk = 0x00400000U, .pos = 22},
+  [3]  = {.msk = 0x00800000U, .pos = 23},
+  [4]  = {.msk = 0x01000000U, .pos = 24},
+  [5]  = {.msk = 0x02000000U, .pos = 25},
+  [6]  = {.msk = 0x04000000U, .pos = 26},
+  [7]  = {.msk = 0x08000000U, .pos = 27},
+  [8]  = {.msk = 0x10000000U, .pos = 28},
+  [9]  = {.msk = 0x20000000U, .pos = 29},
+  [10] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Timer Event 1. */
+static const field32_t HRTIM_TIMB_SETBxR_TIMEVNTx[10] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+  [3] = {.msk = 0x00004000U, .pos = 14},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00020000U, .pos = 17},
+  [7] = {.msk = 0x00040000U, .pos = 18},
+  [8] = {.msk = 0x00080000U, .pos = 19},
+  [9] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief Master Compare 1. */
+static const field32_t HRTIM_TIMB_SETBxR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Timer A compare 1. */
+static const field32_t HRTIM_TIMB_SETBxR_CMPx[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+  [4] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief EXTEVNT1. */
+static const field32_t HRTIM_TIMB_RSTBxR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00200000U, .pos = 21},
+  [2]  = {.msk = 0x00400000U, .pos = 22},
+  [3]  = {.msk = 0x00800000U, .pos = 23},
+  [4]  = {.msk = 0x01000000U, .pos = 24},
+  [5]  = {.msk = 0x02000000U, .pos = 25},
+  [6]  = {.msk = 0x04000000U, .pos = 26},
+  [7]  = {.msk = 0x08000000U, .pos = 27},
+  [8]  = {.msk = 0x10000000U, .pos = 28},
+  [9]  = {.msk = 0x20000000U, .pos = 29},
+  [10] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief TIMEVNT1. */
+static const field32_t HRTIM_TIMB_RSTBxR_TIMEVNTx[10] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+  [3] = {.msk = 0x00004000U, .pos = 14},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00020000U, .pos = 17},
+  [7] = {.msk = 0x00040000U, .pos = 18},
+  [8] = {.msk = 0x00080000U, .pos = 19},
+  [9] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief MSTCMP1. */
+static const field32_t HRTIM_TIMB_RSTBxR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief CMP1. */
+static const field32_t HRTIM_TIMB_RSTBxR_CMPx[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+  [4] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TECMPx[3] = {
+  [1] = {.msk = 0x40000000U, .pos = 30},
+  [2] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TDCMPx[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Timer C Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TCCMPx[3] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMB_CPTxBCR_TACMPx[3] = {
+  [1] = {.msk = 0x00004000U, .pos = 14},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief External Event 1 Capture. */
+static const field32_t HRTIM_TIMB_CPTxBCR_EXEVxCPT[11] = {
+  [1]  = {.msk = 0x00000004U, .pos = 2},
+  [2]  = {.msk = 0x00000008U, .pos = 3},
+  [3]  = {.msk = 0x00000010U, .pos = 4},
+  [4]  = {.msk = 0x00000020U, .pos = 5},
+  [5]  = {.msk = 0x00000040U, .pos = 6},
+  [6]  = {.msk = 0x00000080U, .pos = 7},
+  [7]  = {.msk = 0x00000100U, .pos = 8},
+  [8]  = {.msk = 0x00000200U, .pos = 9},
+  [9]  = {.msk = 0x00000400U, .pos = 10},
+  [10] = {.msk = 0x00000800U, .pos = 11},
+};
@@ -0,0 +1,712 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/hrtim_timc.h
+ * @authors UW SARP
+ * @brief Registers and fields of HRTIM_TIMC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section HRTIM_TIMC Definitions
+ **************************************************************************************************/
+
+/** @subsection HRTIM_TIMC Register Definitions */
+
+static rw_reg32_t const HRTIM_TIMC_TIMCCR    = (rw_reg32_t)0x40017580U; /** @brief Timerx Control Register. */
+static ro_reg32_t const HRTIM_TIMC_TIMCISR   = (ro_reg32_t)0x40017584U; /** @brief Timerx Interrupt Status Register. */
+static rw_reg32_t const HRTIM_TIMC_TIMCICR   = (rw_reg32_t)0x40017588U; /** @brief Timerx Interrupt Clear Register. */
+static rw_reg32_t const HRTIM_TIMC_TIMCDIER5 = (rw_reg32_t)0x4001758CU; /** @brief TIMxDIER5. */
+static rw_reg32_t const HRTIM_TIMC_CNTCR     = (rw_reg32_t)0x40017590U; /** @brief Timerx Counter Register. */
+static rw_reg32_t const HRTIM_TIMC_PERCR     = (rw_reg32_t)0x40017594U; /** @brief Timerx Period Register. */
+static rw_reg32_t const HRTIM_TIMC_REPCR     = (rw_reg32_t)0x40017598U; /** @brief Timerx Repetition Register. */
+static rw_reg32_t const HRTIM_TIMC_CMP1CR    = (rw_reg32_t)0x4001759CU; /** @brief Timerx Compare 1 Register. */
+static rw_reg32_t const HRTIM_TIMC_CMP1CCR   = (rw_reg32_t)0x400175A0U; /** @brief Timerx Compare 1 Compound Register. */
+static rw_reg32_t const HRTIM_TIMC_CMP2CR    = (rw_reg32_t)0x400175A4U; /** @brief Timerx Compare 2 Register. */
+static rw_reg32_t const HRTIM_TIMC_CMP3CR    = (rw_reg32_t)0x400175A8U; /** @brief Timerx Compare 3 Register. */
+static rw_reg32_t const HRTIM_TIMC_CMP4CR    = (rw_reg32_t)0x400175ACU; /** @brief Timerx Compare 4 Register. */
+static ro_reg32_t const HRTIM_TIMC_CPT1CR    = (ro_reg32_t)0x400175B0U; /** @brief Timerx Capture 1 Register. */
+static ro_reg32_t const HRTIM_TIMC_CPT2CR    = (ro_reg32_t)0x400175B4U; /** @brief Timerx Capture 2 Register. */
+static rw_reg32_t const HRTIM_TIMC_DTCR      = (rw_reg32_t)0x400175B8U; /** @brief Timerx Deadtime Register. */
+static rw_reg32_t const HRTIM_TIMC_EEFCR1    = (rw_reg32_t)0x400175CCU; /** @brief Timerx External Event Filtering Register 1. */
+static rw_reg32_t const HRTIM_TIMC_EEFCR2    = (rw_reg32_t)0x400175D0U; /** @brief Timerx External Event Filtering Register 2. */
+static rw_reg32_t const HRTIM_TIMC_RSTCR     = (rw_reg32_t)0x400175D4U; /** @brief TimerA Reset Register. */
+static rw_reg32_t const HRTIM_TIMC_CHPCR     = (rw_reg32_t)0x400175D8U; /** @brief Timerx Chopper Register. */
+static rw_reg32_t const HRTIM_TIMC_OUTCR     = (rw_reg32_t)0x400175E4U; /** @brief Timerx Output Register. */
+static rw_reg32_t const HRTIM_TIMC_FLTCR     = (rw_reg32_t)0x400175E8U; /** @brief Timerx Fault Register. */
+
+/** @subsection Enumerated HRTIM_TIMC Register Definitions */
+
+/** @brief Timerx Output1 Set Register. */
+static rw_reg32_t const HRTIM_TIMC_SETCxR[3] = {
+  [1] = (rw_reg32_t)0x400175BCU,
+  [2] = (rw_reg32_t)0x400175C4U,
+};
+
+/** @brief Timerx Output1 Reset Register. */
+static rw_reg32_t const HRTIM_TIMC_RSTCxR[3] = {
+  [1] = (rw_reg32_t)0x400175C0U,
+  [2] = (rw_reg32_t)0x400175C8U,
+};
+
+/** @brief Timerx Capture 2 Control Register. */
+static rw_reg32_t const HRTIM_TIMC_CPTxCCR[3] = {
+  [1] = (rw_reg32_t)0x400175DCU,
+  [2] = (rw_reg32_t)0x400175E0U,
+};
+
+/** @subsection HRTIM_TIMC Register Field Definitions */
+
+static const field32_t HRTIM_TIMC_TIMCCR_UPDGAT      = {.msk = 0xF0000000U, .pos = 28}; /** @brief Update Gating. */
+static const field32_t HRTIM_TIMC_TIMCCR_PREEN       = {.msk = 0x08000000U, .pos = 27}; /** @brief Preload enable. */
+static const field32_t HRTIM_TIMC_TIMCCR_DACSYNC     = {.msk = 0x06000000U, .pos = 25}; /** @brief AC Synchronization. */
+static const field32_t HRTIM_TIMC_TIMCCR_MSTU        = {.msk = 0x01000000U, .pos = 24}; /** @brief Master Timer update. */
+static const field32_t HRTIM_TIMC_TIMCCR_TEU         = {.msk = 0x00800000U, .pos = 23}; /** @brief TEU. */
+static const field32_t HRTIM_TIMC_TIMCCR_TDU         = {.msk = 0x00400000U, .pos = 22}; /** @brief TDU. */
+static const field32_t HRTIM_TIMC_TIMCCR_TCU         = {.msk = 0x00200000U, .pos = 21}; /** @brief TCU. */
+static const field32_t HRTIM_TIMC_TIMCCR_TBU         = {.msk = 0x00100000U, .pos = 20}; /** @brief TBU. */
+static const field32_t HRTIM_TIMC_TIMCCR_TXRSTU      = {.msk = 0x00040000U, .pos = 18}; /** @brief Timerx reset update. */
+static const field32_t HRTIM_TIMC_TIMCCR_TXREPU      = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer x Repetition update. */
+static const field32_t HRTIM_TIMC_TIMCCR_DELCMP4     = {.msk = 0x0000C000U, .pos = 14}; /** @brief Delayed CMP4 mode. */
+static const field32_t HRTIM_TIMC_TIMCCR_DELCMP2     = {.msk = 0x00003000U, .pos = 12}; /** @brief Delayed CMP2 mode. */
+static const field32_t HRTIM_TIMC_TIMCCR_SYNCSTRTX   = {.msk = 0x00000800U, .pos = 11}; /** @brief Synchronization Starts Timer x. */
+static const field32_t HRTIM_TIMC_TIMCCR_SYNCRSTX    = {.msk = 0x00000400U, .pos = 10}; /** @brief Synchronization Resets Timer x. */
+static const field32_t HRTIM_TIMC_TIMCCR_PSHPLL      = {.msk = 0x00000040U, .pos = 6};  /** @brief Push-Pull mode enable. */
+static const field32_t HRTIM_TIMC_TIMCCR_HALF        = {.msk = 0x00000020U, .pos = 5};  /** @brief Half mode enable. */
+static const field32_t HRTIM_TIMC_TIMCCR_RETRIG      = {.msk = 0x00000010U, .pos = 4};  /** @brief Re-triggerable mode. */
+static const field32_t HRTIM_TIMC_TIMCCR_CONT        = {.msk = 0x00000008U, .pos = 3};  /** @brief Continuous mode. */
+static const field32_t HRTIM_TIMC_TIMCCR_CK_PSCX     = {.msk = 0x00000007U, .pos = 0};  /** @brief HRTIM Timer x Clock prescaler. */
+static const field32_t HRTIM_TIMC_TIMCISR_O2STAT     = {.msk = 0x00080000U, .pos = 19}; /** @brief Output 2 State. */
+static const field32_t HRTIM_TIMC_TIMCISR_O1STAT     = {.msk = 0x00040000U, .pos = 18}; /** @brief Output 1 State. */
+static const field32_t HRTIM_TIMC_TIMCISR_IPPSTAT    = {.msk = 0x00020000U, .pos = 17}; /** @brief Idle Push Pull Status. */
+static const field32_t HRTIM_TIMC_TIMCISR_CPPSTAT    = {.msk = 0x00010000U, .pos = 16}; /** @brief Current Push Pull Status. */
+static const field32_t HRTIM_TIMC_TIMCISR_DLYPRT     = {.msk = 0x00004000U, .pos = 14}; /** @brief Delayed Protection Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_RST        = {.msk = 0x00002000U, .pos = 13}; /** @brief Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_RSTX2      = {.msk = 0x00001000U, .pos = 12}; /** @brief Output 2 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_SETX2      = {.msk = 0x00000800U, .pos = 11}; /** @brief Output 2 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_RSTX1      = {.msk = 0x00000400U, .pos = 10}; /** @brief Output 1 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_SETX1      = {.msk = 0x00000200U, .pos = 9};  /** @brief Output 1 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CPT2       = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture2 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CPT1       = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture1 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_UPD        = {.msk = 0x00000040U, .pos = 6};  /** @brief Update Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_REP        = {.msk = 0x00000010U, .pos = 4};  /** @brief Repetition Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CMP4       = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare 4 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CMP3       = {.msk = 0x00000004U, .pos = 2};  /** @brief Compare 3 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CMP2       = {.msk = 0x00000002U, .pos = 1};  /** @brief Compare 2 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CMP1       = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCICR_DLYPRTC    = {.msk = 0x00004000U, .pos = 14}; /** @brief Delayed Protection Flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_RSTC       = {.msk = 0x00002000U, .pos = 13}; /** @brief Reset Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_RSTX2C     = {.msk = 0x00001000U, .pos = 12}; /** @brief Output 2 Reset flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_SET2XC     = {.msk = 0x00000800U, .pos = 11}; /** @brief Output 2 Set flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_RSTX1C     = {.msk = 0x00000400U, .pos = 10}; /** @brief Output 1 Reset flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_SET1XC     = {.msk = 0x00000200U, .pos = 9};  /** @brief Output 1 Set flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CPT2C      = {.msk = 0x00000100U, .pos = 8};  /** @brief Capture2 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CPT1C      = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_UPDC       = {.msk = 0x00000040U, .pos = 6};  /** @brief Update Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_REPC       = {.msk = 0x00000010U, .pos = 4};  /** @brief Repetition Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CMP4C      = {.msk = 0x00000008U, .pos = 3};  /** @brief Compare 4 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CMP3C      = {.msk = 0x00000004U, .pos = 2};  /** @brief Compare 3 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CMP2C      = {.msk = 0x00000002U, .pos = 1};  /** @brief Compare 2 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CMP1C      = {.msk = 0x00000001U, .pos = 0};  /** @brief Compare 1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_DLYPRTDE = {.msk = 0x40000000U, .pos = 30}; /** @brief DLYPRTDE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTDE    = {.msk = 0x20000000U, .pos = 29}; /** @brief RSTDE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTX2DE  = {.msk = 0x10000000U, .pos = 28}; /** @brief RSTx2DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_SETX2DE  = {.msk = 0x08000000U, .pos = 27}; /** @brief SETx2DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTX1DE  = {.msk = 0x04000000U, .pos = 26}; /** @brief RSTx1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_SET1XDE  = {.msk = 0x02000000U, .pos = 25}; /** @brief SET1xDE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPT2DE   = {.msk = 0x01000000U, .pos = 24}; /** @brief CPT2DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPT1DE   = {.msk = 0x00800000U, .pos = 23}; /** @brief CPT1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_UPDDE    = {.msk = 0x00400000U, .pos = 22}; /** @brief UPDDE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_REPDE    = {.msk = 0x00100000U, .pos = 20}; /** @brief REPDE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP4DE   = {.msk = 0x00080000U, .pos = 19}; /** @brief CMP4DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP3DE   = {.msk = 0x00040000U, .pos = 18}; /** @brief CMP3DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP2DE   = {.msk = 0x00020000U, .pos = 17}; /** @brief CMP2DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP1DE   = {.msk = 0x00010000U, .pos = 16}; /** @brief CMP1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_DLYPRTIE = {.msk = 0x00004000U, .pos = 14}; /** @brief DLYPRTIE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTIE    = {.msk = 0x00002000U, .pos = 13}; /** @brief RSTIE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTX2IE  = {.msk = 0x00001000U, .pos = 12}; /** @brief RSTx2IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_SETX2IE  = {.msk = 0x00000800U, .pos = 11}; /** @brief SETx2IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTX1IE  = {.msk = 0x00000400U, .pos = 10}; /** @brief RSTx1IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_SET1XIE  = {.msk = 0x00000200U, .pos = 9};  /** @brief SET1xIE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPT2IE   = {.msk = 0x00000100U, .pos = 8};  /** @brief CPT2IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPT1IE   = {.msk = 0x00000080U, .pos = 7};  /** @brief CPT1IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_UPDIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief UPDIE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_REPIE    = {.msk = 0x00000010U, .pos = 4};  /** @brief REPIE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP4IE   = {.msk = 0x00000008U, .pos = 3};  /** @brief CMP4IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP3IE   = {.msk = 0x00000004U, .pos = 2};  /** @brief CMP3IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP2IE   = {.msk = 0x00000002U, .pos = 1};  /** @brief CMP2IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMP1IE   = {.msk = 0x00000001U, .pos = 0};  /** @brief CMP1IE. */
+static const field32_t HRTIM_TIMC_CNTCR_CNTX         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Counter value. */
+static const field32_t HRTIM_TIMC_PERCR_PERX         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Period value. */
+static const field32_t HRTIM_TIMC_REPCR_REPX         = {.msk = 0x000000FFU, .pos = 0};  /** @brief Timerx Repetition counter value. */
+static const field32_t HRTIM_TIMC_CMP1CR_CMP1X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 1 value. */
+static const field32_t HRTIM_TIMC_CMP1CCR_REPX       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Timerx Repetition value (aliased from HRTIM_REPx register). */
+static const field32_t HRTIM_TIMC_CMP1CCR_CMP1X      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 1 value. */
+static const field32_t HRTIM_TIMC_CMP2CR_CMP2X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 2 value. */
+static const field32_t HRTIM_TIMC_CMP3CR_CMP3X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 3 value. */
+static const field32_t HRTIM_TIMC_CMP4CR_CMP4X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Compare 4 value. */
+static const field32_t HRTIM_TIMC_CPT1CR_CPT1X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Capture 1 value. */
+static const field32_t HRTIM_TIMC_CPT2CR_CPT2X       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timerx Capture 2 value. */
+static const field32_t HRTIM_TIMC_DTCR_DTFLKX        = {.msk = 0x80000000U, .pos = 31}; /** @brief Deadtime Falling Lock. */
+static const field32_t HRTIM_TIMC_DTCR_DTFSLKX       = {.msk = 0x40000000U, .pos = 30}; /** @brief Deadtime Falling Sign Lock. */
+static const field32_t HRTIM_TIMC_DTCR_SDTFX         = {.msk = 0x02000000U, .pos = 25}; /** @brief Sign Deadtime Falling value. */
+static const field32_t HRTIM_TIMC_DTCR_DTFX          = {.msk = 0x01FF0000U, .pos = 16}; /** @brief Deadtime Falling value. */
+static const field32_t HRTIM_TIMC_DTCR_DTRLKX        = {.msk = 0x00008000U, .pos = 15}; /** @brief Deadtime Rising Lock. */
+static const field32_t HRTIM_TIMC_DTCR_DTRSLKX       = {.msk = 0x00004000U, .pos = 14}; /** @brief Deadtime Rising Sign Lock. */
+static const field32_t HRTIM_TIMC_DTCR_DTPRSC        = {.msk = 0x00001C00U, .pos = 10}; /** @brief Deadtime Prescaler. */
+static const field32_t HRTIM_TIMC_DTCR_SDTRX         = {.msk = 0x00000200U, .pos = 9};  /** @brief Sign Deadtime Rising value. */
+static const field32_t HRTIM_TIMC_DTCR_DTRX          = {.msk = 0x000001FFU, .pos = 0};  /** @brief Deadtime Rising value. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE5FLTR     = {.msk = 0x1E000000U, .pos = 25}; /** @brief External Event 5 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE5LTCH     = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 5 latch. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE4FLTR     = {.msk = 0x00780000U, .pos = 19}; /** @brief External Event 4 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE4LTCH     = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 4 latch. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE3FLTR     = {.msk = 0x0001E000U, .pos = 13}; /** @brief External Event 3 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE3LTCH     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 3 latch. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE2FLTR     = {.msk = 0x00000780U, .pos = 7};  /** @brief External Event 2 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE2LTCH     = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 2 latch. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE1FLTR     = {.msk = 0x0000001EU, .pos = 1};  /** @brief External Event 1 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EE1LTCH     = {.msk = 0x00000001U, .pos = 0};  /** @brief External Event 1 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE10FLTR    = {.msk = 0x1E000000U, .pos = 25}; /** @brief External Event 10 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE10LTCH    = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 10 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE9FLTR     = {.msk = 0x00780000U, .pos = 19}; /** @brief External Event 9 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE9LTCH     = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 9 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE8FLTR     = {.msk = 0x0001E000U, .pos = 13}; /** @brief External Event 8 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE8LTCH     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 8 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE7FLTR     = {.msk = 0x00000780U, .pos = 7};  /** @brief External Event 7 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE7LTCH     = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 7 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE6FLTR     = {.msk = 0x0000001EU, .pos = 1};  /** @brief External Event 6 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EE6LTCH     = {.msk = 0x00000001U, .pos = 0};  /** @brief External Event 6 latch. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMECMP4     = {.msk = 0x40000000U, .pos = 30}; /** @brief Timer E Compare 4. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMECMP2     = {.msk = 0x20000000U, .pos = 29}; /** @brief Timer E Compare 2. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMECMP1     = {.msk = 0x10000000U, .pos = 28}; /** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMDCMP4     = {.msk = 0x08000000U, .pos = 27}; /** @brief Timer D Compare 4. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMDCMP2     = {.msk = 0x04000000U, .pos = 26}; /** @brief Timer D Compare 2. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMDCMP1     = {.msk = 0x02000000U, .pos = 25}; /** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMBCMP4     = {.msk = 0x01000000U, .pos = 24}; /** @brief Timer B Compare 4. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMBCMP2     = {.msk = 0x00800000U, .pos = 23}; /** @brief Timer B Compare 2. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMBCMP1     = {.msk = 0x00400000U, .pos = 22}; /** @brief Timer B Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMACMP4     = {.msk = 0x00200000U, .pos = 21}; /** @brief Timer A Compare 4. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMACMP2     = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer A Compare 2. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMACMP1     = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT10    = {.msk = 0x00040000U, .pos = 18}; /** @brief External Event 10. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT9     = {.msk = 0x00020000U, .pos = 17}; /** @brief External Event 9. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT8     = {.msk = 0x00010000U, .pos = 16}; /** @brief External Event 8. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT7     = {.msk = 0x00008000U, .pos = 15}; /** @brief External Event 7. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT6     = {.msk = 0x00004000U, .pos = 14}; /** @brief External Event 6. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT5     = {.msk = 0x00002000U, .pos = 13}; /** @brief External Event 5. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT4     = {.msk = 0x00001000U, .pos = 12}; /** @brief External Event 4. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT3     = {.msk = 0x00000800U, .pos = 11}; /** @brief External Event 3. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT2     = {.msk = 0x00000400U, .pos = 10}; /** @brief External Event 2. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNT1     = {.msk = 0x00000200U, .pos = 9};  /** @brief External Event 1. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTCMP4      = {.msk = 0x00000100U, .pos = 8};  /** @brief Master compare 4. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTCMP3      = {.msk = 0x00000080U, .pos = 7};  /** @brief Master compare 3. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTCMP2      = {.msk = 0x00000040U, .pos = 6};  /** @brief Master compare 2. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTCMP1      = {.msk = 0x00000020U, .pos = 5};  /** @brief Master compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTPER       = {.msk = 0x00000010U, .pos = 4};  /** @brief Master timer Period. */
+static const field32_t HRTIM_TIMC_RSTCR_CMP4         = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer A compare 4 reset. */
+static const field32_t HRTIM_TIMC_RSTCR_CMP2         = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer A compare 2 reset. */
+static const field32_t HRTIM_TIMC_RSTCR_UPDT         = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A Update reset. */
+static const field32_t HRTIM_TIMC_CHPCR_STRTPW       = {.msk = 0x00000780U, .pos = 7};  /** @brief STRTPW. */
+static const field32_t HRTIM_TIMC_CHPCR_CHPDTY       = {.msk = 0x00000070U, .pos = 4};  /** @brief Timerx chopper duty cycle value. */
+static const field32_t HRTIM_TIMC_CHPCR_CHPFRQ       = {.msk = 0x0000000FU, .pos = 0};  /** @brief Timerx carrier frequency value. */
+static const field32_t HRTIM_TIMC_OUTCR_DIDL2        = {.msk = 0x00800000U, .pos = 23}; /** @brief Output 2 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMC_OUTCR_CHP2         = {.msk = 0x00400000U, .pos = 22}; /** @brief Output 2 Chopper enable. */
+static const field32_t HRTIM_TIMC_OUTCR_FAULT2       = {.msk = 0x00300000U, .pos = 20}; /** @brief Output 2 Fault state. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLES2       = {.msk = 0x00080000U, .pos = 19}; /** @brief Output 2 Idle State. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLEM2       = {.msk = 0x00040000U, .pos = 18}; /** @brief Output 2 Idle mode. */
+static const field32_t HRTIM_TIMC_OUTCR_POL2         = {.msk = 0x00020000U, .pos = 17}; /** @brief Output 2 polarity. */
+static const field32_t HRTIM_TIMC_OUTCR_DLYPRT       = {.msk = 0x00001C00U, .pos = 10}; /** @brief Delayed Protection. */
+static const field32_t HRTIM_TIMC_OUTCR_DLYPRTEN     = {.msk = 0x00000200U, .pos = 9};  /** @brief Delayed Protection Enable. */
+static const field32_t HRTIM_TIMC_OUTCR_DTEN         = {.msk = 0x00000100U, .pos = 8};  /** @brief Deadtime enable. */
+static const field32_t HRTIM_TIMC_OUTCR_DIDL1        = {.msk = 0x00000080U, .pos = 7};  /** @brief Output 1 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMC_OUTCR_CHP1         = {.msk = 0x00000040U, .pos = 6};  /** @brief Output 1 Chopper enable. */
+static const field32_t HRTIM_TIMC_OUTCR_FAULT1       = {.msk = 0x00000030U, .pos = 4};  /** @brief Output 1 Fault state. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLES1       = {.msk = 0x00000008U, .pos = 3};  /** @brief Output 1 Idle State. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLEM1       = {.msk = 0x00000004U, .pos = 2};  /** @brief Output 1 Idle mode. */
+static const field32_t HRTIM_TIMC_OUTCR_POL1         = {.msk = 0x00000002U, .pos = 1};  /** @brief Output 1 polarity. */
+static const field32_t HRTIM_TIMC_FLTCR_FLTLCK       = {.msk = 0x80000000U, .pos = 31}; /** @brief Fault sources Lock. */
+static const field32_t HRTIM_TIMC_FLTCR_FLT5EN       = {.msk = 0x00000010U, .pos = 4};  /** @brief Fault 5 enable. */
+static const field32_t HRTIM_TIMC_FLTCR_FLT4EN       = {.msk = 0x00000008U, .pos = 3};  /** @brief Fault 4 enable. */
+static const field32_t HRTIM_TIMC_FLTCR_FLT3EN       = {.msk = 0x00000004U, .pos = 2};  /** @brief Fault 3 enable. */
+static const field32_t HRTIM_TIMC_FLTCR_FLT2EN       = {.msk = 0x00000002U, .pos = 1};  /** @brief Fault 2 enable. */
+static const field32_t HRTIM_TIMC_FLTCR_FLT1EN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Fault 1 enable. */
+static const field32_t HRTIM_TIMC_SETCxR_UPDATE      = {.msk = 0x80000000U, .pos = 31}; /** @brief Registers update (transfer preload to active). */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT10   = {.msk = 0x40000000U, .pos = 30}; /** @brief External Event 10. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT9    = {.msk = 0x20000000U, .pos = 29}; /** @brief External Event 9. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT8    = {.msk = 0x10000000U, .pos = 28}; /** @brief External Event 8. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT7    = {.msk = 0x08000000U, .pos = 27}; /** @brief External Event 7. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT6    = {.msk = 0x04000000U, .pos = 26}; /** @brief External Event 6. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT5    = {.msk = 0x02000000U, .pos = 25}; /** @brief External Event 5. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT4    = {.msk = 0x01000000U, .pos = 24}; /** @brief External Event 4. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT3    = {.msk = 0x00800000U, .pos = 23}; /** @brief External Event 3. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT2    = {.msk = 0x00400000U, .pos = 22}; /** @brief External Event 2. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNT1    = {.msk = 0x00200000U, .pos = 21}; /** @brief External Event 1. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT9    = {.msk = 0x00100000U, .pos = 20}; /** @brief Timer Event 9. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT8    = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer Event 8. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT7    = {.msk = 0x00040000U, .pos = 18}; /** @brief Timer Event 7. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT6    = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer Event 6. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT5    = {.msk = 0x00010000U, .pos = 16}; /** @brief Timer Event 5. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT4    = {.msk = 0x00008000U, .pos = 15}; /** @brief Timer Event 4. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT3    = {.msk = 0x00004000U, .pos = 14}; /** @brief Timer Event 3. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT2    = {.msk = 0x00002000U, .pos = 13}; /** @brief Timer Event 2. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNT1    = {.msk = 0x00001000U, .pos = 12}; /** @brief Timer Event 1. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTCMP4     = {.msk = 0x00000800U, .pos = 11}; /** @brief Master Compare 4. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTCMP3     = {.msk = 0x00000400U, .pos = 10}; /** @brief Master Compare 3. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTCMP2     = {.msk = 0x00000200U, .pos = 9};  /** @brief Master Compare 2. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTCMP1     = {.msk = 0x00000100U, .pos = 8};  /** @brief Master Compare 1. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTPER      = {.msk = 0x00000080U, .pos = 7};  /** @brief Master Period. */
+static const field32_t HRTIM_TIMC_SETCxR_CMP4        = {.msk = 0x00000040U, .pos = 6};  /** @brief Timer A compare 4. */
+static const field32_t HRTIM_TIMC_SETCxR_CMP3        = {.msk = 0x00000020U, .pos = 5};  /** @brief Timer A compare 3. */
+static const field32_t HRTIM_TIMC_SETCxR_CMP2        = {.msk = 0x00000010U, .pos = 4};  /** @brief Timer A compare 2. */
+static const field32_t HRTIM_TIMC_SETCxR_CMP1        = {.msk = 0x00000008U, .pos = 3};  /** @brief Timer A compare 1. */
+static const field32_t HRTIM_TIMC_SETCxR_PER         = {.msk = 0x00000004U, .pos = 2};  /** @brief Timer A Period. */
+static const field32_t HRTIM_TIMC_SETCxR_RESYNC      = {.msk = 0x00000002U, .pos = 1};  /** @brief Timer A resynchronizaton. */
+static const field32_t HRTIM_TIMC_SETCxR_SST         = {.msk = 0x00000001U, .pos = 0};  /** @brief Software Set trigger. */
+static const field32_t HRTIM_TIMC_RSTCxR_UPDATE      = {.msk = 0x80000000U, .pos = 31}; /** @brief UPDATE. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT10   = {.msk = 0x40000000U, .pos = 30}; /** @brief EXTEVNT10. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT9    = {.msk = 0x20000000U, .pos = 29}; /** @brief EXTEVNT9. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT8    = {.msk = 0x10000000U, .pos = 28}; /** @brief EXTEVNT8. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT7    = {.msk = 0x08000000U, .pos = 27}; /** @brief EXTEVNT7. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT6    = {.msk = 0x04000000U, .pos = 26}; /** @brief EXTEVNT6. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT5    = {.msk = 0x02000000U, .pos = 25}; /** @brief EXTEVNT5. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT4    = {.msk = 0x01000000U, .pos = 24}; /** @brief EXTEVNT4. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT3    = {.msk = 0x00800000U, .pos = 23}; /** @brief EXTEVNT3. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT2    = {.msk = 0x00400000U, .pos = 22}; /** @brief EXTEVNT2. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNT1    = {.msk = 0x00200000U, .pos = 21}; /** @brief EXTEVNT1. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT9    = {.msk = 0x00100000U, .pos = 20}; /** @brief TIMEVNT9. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT8    = {.msk = 0x00080000U, .pos = 19}; /** @brief TIMEVNT8. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT7    = {.msk = 0x00040000U, .pos = 18}; /** @brief TIMEVNT7. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT6    = {.msk = 0x00020000U, .pos = 17}; /** @brief TIMEVNT6. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT5    = {.msk = 0x00010000U, .pos = 16}; /** @brief TIMEVNT5. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT4    = {.msk = 0x00008000U, .pos = 15}; /** @brief TIMEVNT4. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT3    = {.msk = 0x00004000U, .pos = 14}; /** @brief TIMEVNT3. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT2    = {.msk = 0x00002000U, .pos = 13}; /** @brief TIMEVNT2. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNT1    = {.msk = 0x00001000U, .pos = 12}; /** @brief TIMEVNT1. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTCMP4     = {.msk = 0x00000800U, .pos = 11}; /** @brief MSTCMP4. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTCMP3     = {.msk = 0x00000400U, .pos = 10}; /** @brief MSTCMP3. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTCMP2     = {.msk = 0x00000200U, .pos = 9};  /** @brief MSTCMP2. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTCMP1     = {.msk = 0x00000100U, .pos = 8};  /** @brief MSTCMP1. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTPER      = {.msk = 0x00000080U, .pos = 7};  /** @brief MSTPER. */
+static const field32_t HRTIM_TIMC_RSTCxR_CMP4        = {.msk = 0x00000040U, .pos = 6};  /** @brief CMP4. */
+static const field32_t HRTIM_TIMC_RSTCxR_CMP3        = {.msk = 0x00000020U, .pos = 5};  /** @brief CMP3. */
+static const field32_t HRTIM_TIMC_RSTCxR_CMP2        = {.msk = 0x00000010U, .pos = 4};  /** @brief CMP2. */
+static const field32_t HRTIM_TIMC_RSTCxR_CMP1        = {.msk = 0x00000008U, .pos = 3};  /** @brief CMP1. */
+static const field32_t HRTIM_TIMC_RSTCxR_PER         = {.msk = 0x00000004U, .pos = 2};  /** @brief PER. */
+static const field32_t HRTIM_TIMC_RSTCxR_RESYNC      = {.msk = 0x00000002U, .pos = 1};  /** @brief RESYNC. */
+static const field32_t HRTIM_TIMC_RSTCxR_SRT         = {.msk = 0x00000001U, .pos = 0};  /** @brief SRT. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TECMP2     = {.msk = 0x80000000U, .pos = 31}; /** @brief Timer E Compare 2. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TECMP1     = {.msk = 0x40000000U, .pos = 30}; /** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TE1RST     = {.msk = 0x20000000U, .pos = 29}; /** @brief Timer E output 1 Reset. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TE1SET     = {.msk = 0x10000000U, .pos = 28}; /** @brief Timer E output 1 Set. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TDCMP2     = {.msk = 0x08000000U, .pos = 27}; /** @brief Timer D Compare 2. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TDCMP1     = {.msk = 0x04000000U, .pos = 26}; /** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TD1RST     = {.msk = 0x02000000U, .pos = 25}; /** @brief Timer D output 1 Reset. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TD1SET     = {.msk = 0x01000000U, .pos = 24}; /** @brief Timer D output 1 Set. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TBCMP2     = {.msk = 0x00080000U, .pos = 19}; /** @brief Timer B Compare 2. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TBCMP1     = {.msk = 0x00040000U, .pos = 18}; /** @brief Timer B Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TB1RST     = {.msk = 0x00020000U, .pos = 17}; /** @brief Timer B output 1 Reset. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TB1SET     = {.msk = 0x00010000U, .pos = 16}; /** @brief Timer B output 1 Set. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TACMP2     = {.msk = 0x00008000U, .pos = 15}; /** @brief Timer A Compare 2. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TACMP1     = {.msk = 0x00004000U, .pos = 14}; /** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TA1RST     = {.msk = 0x00002000U, .pos = 13}; /** @brief Timer A output 1 Reset. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TA1SET     = {.msk = 0x00001000U, .pos = 12}; /** @brief Timer A output 1 Set. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV10CPT  = {.msk = 0x00000800U, .pos = 11}; /** @brief External Event 10 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV9CPT   = {.msk = 0x00000400U, .pos = 10}; /** @brief External Event 9 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV8CPT   = {.msk = 0x00000200U, .pos = 9};  /** @brief External Event 8 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV7CPT   = {.msk = 0x00000100U, .pos = 8};  /** @brief External Event 7 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV6CPT   = {.msk = 0x00000080U, .pos = 7};  /** @brief External Event 6 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV5CPT   = {.msk = 0x00000040U, .pos = 6};  /** @brief External Event 5 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV4CPT   = {.msk = 0x00000020U, .pos = 5};  /** @brief External Event 4 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV3CPT   = {.msk = 0x00000010U, .pos = 4};  /** @brief External Event 3 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV2CPT   = {.msk = 0x00000008U, .pos = 3};  /** @brief External Event 2 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEV1CPT   = {.msk = 0x00000004U, .pos = 2};  /** @brief External Event 1 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_UDPCPT     = {.msk = 0x00000002U, .pos = 1};  /** @brief Update Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_SWCPT      = {.msk = 0x00000001U, .pos = 0};  /** @brief Software Capture. */
+
+/** @subsection Enumerated HRTIM_TIMC Register Field Definitions */
+
+/** @brief Delayed CMP2 mode. */
+static const field32_t HRTIM_TIMC_TIMCCR_DELCMPx[5] = {
+  [2] = {.msk = 0x00003000U, .pos = 12},
+  [4] = {.msk = 0x0000C000U, .pos = 14},
+};
+
+/** @brief Output 1 State. */
+static const field32_t HRTIM_TIMC_TIMCISR_OxSTAT[3] = {
+  [1] = {.msk = 0x00040000U, .pos = 18},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Output 1 Reset Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_RSTXx[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Output 1 Set Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_SETXx[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Capture1 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CPTx[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Compare 1 Interrupt Flag. */
+static const field32_t HRTIM_TIMC_TIMCISR_CMPx[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Output 1 Reset flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_RSTXxC[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief Output 1 Set flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_SETxXC[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Capture1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CPTxC[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Compare 1 Interrupt flag Clear. */
+static const field32_t HRTIM_TIMC_TIMCICR_CMPxC[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief RSTx1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTXxDE[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief CPT1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPTxDE[3] = {
+  [1] = {.msk = 0x00800000U, .pos = 23},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief CMP1DE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMPxDE[5] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [4] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief RSTx1IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_RSTXxIE[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief CPT1IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CPTxIE[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief CMP1IE. */
+static const field32_t HRTIM_TIMC_TIMCDIER5_CMPxIE[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief External Event 1 filter. */
+static const field32_t HRTIM_TIMC_EEFCR1_EExFLTR[6] = {
+  [1] = {.msk = 0x0000001EU, .pos = 1},
+  [2] = {.msk = 0x00000780U, .pos = 7},
+  [3] = {.msk = 0x0001E000U, .pos = 13},
+  [4] = {.msk = 0x00780000U, .pos = 19},
+  [5] = {.msk = 0x1E000000U, .pos = 25},
+};
+
+/** @brief External Event 1 latch. */
+static const field32_t HRTIM_TIMC_EEFCR1_EExLTCH[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00040000U, .pos = 18},
+  [5] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief External Event 6 filter. */
+static const field32_t HRTIM_TIMC_EEFCR2_EExFLTR[11] = {
+  [6]  = {.msk = 0x0000001EU, .pos = 1},
+  [7]  = {.msk = 0x00000780U, .pos = 7},
+  [8]  = {.msk = 0x0001E000U, .pos = 13},
+  [9]  = {.msk = 0x00780000U, .pos = 19},
+  [10] = {.msk = 0x1E000000U, .pos = 25},
+};
+
+/** @brief External Event 6 latch. */
+static const field32_t HRTIM_TIMC_EEFCR2_EExLTCH[11] = {
+  [6]  = {.msk = 0x00000001U, .pos = 0},
+  [7]  = {.msk = 0x00000040U, .pos = 6},
+  [8]  = {.msk = 0x00001000U, .pos = 12},
+  [9]  = {.msk = 0x00040000U, .pos = 18},
+  [10] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMECMPx[5] = {
+  [1] = {.msk = 0x10000000U, .pos = 28},
+  [2] = {.msk = 0x20000000U, .pos = 29},
+  [4] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMDCMPx[5] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x04000000U, .pos = 26},
+  [4] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Timer B Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMBCMPx[5] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [4] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_TIMACMPx[5] = {
+  [1] = {.msk = 0x00080000U, .pos = 19},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [4] = {.msk = 0x00200000U, .pos = 21},
+};
+
+/** @brief External Event 1. */
+static const field32_t HRTIM_TIMC_RSTCR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00000200U, .pos = 9},
+  [2]  = {.msk = 0x00000400U, .pos = 10},
+  [3]  = {.msk = 0x00000800U, .pos = 11},
+  [4]  = {.msk = 0x00001000U, .pos = 12},
+  [5]  = {.msk = 0x00002000U, .pos = 13},
+  [6]  = {.msk = 0x00004000U, .pos = 14},
+  [7]  = {.msk = 0x00008000U, .pos = 15},
+  [8]  = {.msk = 0x00010000U, .pos = 16},
+  [9]  = {.msk = 0x00020000U, .pos = 17},
+  [10] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief Master compare 1. */
+static const field32_t HRTIM_TIMC_RSTCR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000020U, .pos = 5},
+  [2] = {.msk = 0x00000040U, .pos = 6},
+  [3] = {.msk = 0x00000080U, .pos = 7},
+  [4] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Timer A compare 2 reset. */
+static const field32_t HRTIM_TIMC_RSTCR_CMPx[5] = {
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief Output 1 Deadtime upon burst mode Idle entry. */
+static const field32_t HRTIM_TIMC_OUTCR_DIDLx[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief Output 1 Chopper enable. */
+static const field32_t HRTIM_TIMC_OUTCR_CHPx[3] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Output 1 Fault state. */
+static const field32_t HRTIM_TIMC_OUTCR_FAULTx[3] = {
+  [1] = {.msk = 0x00000030U, .pos = 4},
+  [2] = {.msk = 0x00300000U, .pos = 20},
+};
+
+/** @brief Output 1 Idle State. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLESx[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Output 1 Idle mode. */
+static const field32_t HRTIM_TIMC_OUTCR_IDLEMx[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief Output 1 polarity. */
+static const field32_t HRTIM_TIMC_OUTCR_POLx[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00020000U, .pos = 17},
+};
+
+/** @brief Fault 1 enable. */
+static const field32_t HRTIM_TIMC_FLTCR_FLTxEN[6] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief External Event 1. */
+static const field32_t HRTIM_TIMC_SETCxR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00200000U, .pos = 21},
+  [2]  = {.msk = 0x00400000U, .pos = 22},
+  [3]  = {.msk = 0x00800000U, .pos = 23},
+  [4]  = {.msk = 0x01000000U, .pos = 24},
+  [5]  = {.msk = 0x02000000U, .pos = 25},
+  [6]  = {.msk = 0x04000000U, .pos = 26},
+  [7]  = {.msk = 0x08000000U, .pos = 27},
+  [8]  = {.msk = 0x10000000U, .pos = 28},
+  [9]  = {.msk = 0x20000000U, .pos = 29},
+  [10] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief Timer Event 1. */
+static const field32_t HRTIM_TIMC_SETCxR_TIMEVNTx[10] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+  [3] = {.msk = 0x00004000U, .pos = 14},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00020000U, .pos = 17},
+  [7] = {.msk = 0x00040000U, .pos = 18},
+  [8] = {.msk = 0x00080000U, .pos = 19},
+  [9] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief Master Compare 1. */
+static const field32_t HRTIM_TIMC_SETCxR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Timer A compare 1. */
+static const field32_t HRTIM_TIMC_SETCxR_CMPx[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+  [4] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief EXTEVNT1. */
+static const field32_t HRTIM_TIMC_RSTCxR_EXTEVNTx[11] = {
+  [1]  = {.msk = 0x00200000U, .pos = 21},
+  [2]  = {.msk = 0x00400000U, .pos = 22},
+  [3]  = {.msk = 0x00800000U, .pos = 23},
+  [4]  = {.msk = 0x01000000U, .pos = 24},
+  [5]  = {.msk = 0x02000000U, .pos = 25},
+  [6]  = {.msk = 0x04000000U, .pos = 26},
+  [7]  = {.msk = 0x08000000U, .pos = 27},
+  [8]  = {.msk = 0x10000000U, .pos = 28},
+  [9]  = {.msk = 0x20000000U, .pos = 29},
+  [10] = {.msk = 0x40000000U, .pos = 30},
+};
+
+/** @brief TIMEVNT1. */
+static const field32_t HRTIM_TIMC_RSTCxR_TIMEVNTx[10] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00002000U, .pos = 13},
+  [3] = {.msk = 0x00004000U, .pos = 14},
+  [4] = {.msk = 0x00008000U, .pos = 15},
+  [5] = {.msk = 0x00010000U, .pos = 16},
+  [6] = {.msk = 0x00020000U, .pos = 17},
+  [7] = {.msk = 0x00040000U, .pos = 18},
+  [8] = {.msk = 0x00080000U, .pos = 19},
+  [9] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief MSTCMP1. */
+static const field32_t HRTIM_TIMC_RSTCxR_MSTCMPx[5] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief CMP1. */
+static const field32_t HRTIM_TIMC_RSTCxR_CMPx[5] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+  [4] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Timer E Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TECMPx[3] = {
+  [1] = {.msk = 0x40000000U, .pos = 30},
+  [2] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Timer D Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TDCMPx[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief Timer B Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TBCMPx[3] = {
+  [1] = {.msk = 0x00040000U, .pos = 18},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+};
+
+/** @brief Timer A Compare 1. */
+static const field32_t HRTIM_TIMC_CPTxCCR_TACMPx[3] = {
+  [1] = {.msk = 0x00004000U, .pos = 14},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief External Event 1 Capture. */
+static const field32_t HRTIM_TIMC_CPTxCCR_EXEVxCPT[11] = {
+  [1]  = {.msk = 0x00000004U, .pos = 2},
+  [2]  = {.msk = 0x00000008U, .pos = 3},
+  [3]  = {.msk = 0x00000010U, .pos = 4},
+  [4]  = {.msk = 0x00000020U, .pos = 5},
+  [5]  = {.msk = 0x00000040U, .pos = 6},
+  [6]  = {.msk = 0x00000080U, .pos = 7},
+  [7]  = {.msk = 0x00000100U, .pos = 8},
+  [8]  = {.msk = 0x00000200U, .pos = 9},
+  [9]  = {.msk = 0x00000400U, .pos = 10},
+  [10] = {.msk = 0x00000800U, .pos = 11},
+};
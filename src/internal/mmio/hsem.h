@@ -0,0 +1,148 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/hsem.h
+ * @authors UW SARP
+ * @brief Registers and fields of HSEM.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section HSEM Definitions
+ **************************************************************************************************/
+
+/** @subsection HSEM Register Definitions */
+
+static rw_reg32_t const HSEM_HSEM_CR   = (rw_reg32_t)0x58026540U; /** @brief HSEM Clear register. */
+static rw_reg32_t const HSEM_HSEM_KEYR = (rw_reg32_t)0x58026544U; /** @brief HSEM Interrupt clear register. */
+
+/** @subsection Enumerated HSEM Register Definitions */
+
+/** @brief HSEM register HSEM_R0 HSEM_R31. */
+static rw_reg32_t const HSEM_HSEM_Rx[32] = {
+  [0]  = (rw_reg32_t)0x58026400U,
+  [1]  = (rw_reg32_t)0x58026404U,
+  [2]  = (rw_reg32_t)0x58026408U,
+  [3]  = (rw_reg32_t)0x5802640CU,
+  [4]  = (rw_reg32_t)0x58026410U,
+  [5]  = (rw_reg32_t)0x58026414U,
+  [6]  = (rw_reg32_t)0x58026418U,
+  [7]  = (rw_reg32_t)0x5802641CU,
+  [8]  = (rw_reg32_t)0x58026420U,
+  [9]  = (rw_reg32_t)0x58026424U,
+  [10] = (rw_reg32_t)0x58026428U,
+  [11] = (rw_reg32_t)0x5802642CU,
+  [12] = (rw_reg32_t)0x58026430U,
+  [13] = (rw_reg32_t)0x58026434U,
+  [14] = (rw_reg32_t)0x58026438U,
+  [15] = (rw_reg32_t)0x5802643CU,
+  [16] = (rw_reg32_t)0x58026440U,
+  [17] = (rw_reg32_t)0x58026444U,
+  [18] = (rw_reg32_t)0x58026448U,
+  [19] = (rw_reg32_t)0x5802644CU,
+  [20] = (rw_reg32_t)0x58026450U,
+  [21] = (rw_reg32_t)0x58026454U,
+  [22] = (rw_reg32_t)0x58026458U,
+  [23] = (rw_reg32_t)0x5802645CU,
+  [24] = (rw_reg32_t)0x58026460U,
+  [25] = (rw_reg32_t)0x58026464U,
+  [26] = (rw_reg32_t)0x58026468U,
+  [27] = (rw_reg32_t)0x5802646CU,
+  [28] = (rw_reg32_t)0x58026470U,
+  [29] = (rw_reg32_t)0x58026474U,
+  [30] = (rw_reg32_t)0x58026478U,
+  [31] = (rw_reg32_t)0x5802647CU,
+};
+
+/** @brief HSEM Read lock register. */
+static ro_reg32_t const HSEM_HSEM_RLRx[32] = {
+  [0]  = (ro_reg32_t)0x58026480U,
+  [1]  = (ro_reg32_t)0x58026484U,
+  [2]  = (ro_reg32_t)0x58026488U,
+  [3]  = (ro_reg32_t)0x5802648CU,
+  [4]  = (ro_reg32_t)0x58026490U,
+  [5]  = (ro_reg32_t)0x58026494U,
+  [6]  = (ro_reg32_t)0x58026498U,
+  [7]  = (ro_reg32_t)0x5802649CU,
+  [8]  = (ro_reg32_t)0x580264A0U,
+  [9]  = (ro_reg32_t)0x580264A4U,
+  [10] = (ro_reg32_t)0x580264A8U,
+  [11] = (ro_reg32_t)0x580264ACU,
+  [12] = (ro_reg32_t)0x580264B0U,
+  [13] = (ro_reg32_t)0x580264B4U,
+  [14] = (ro_reg32_t)0x580264B8U,
+  [15] = (ro_reg32_t)0x580264BCU,
+  [16] = (ro_reg32_t)0x580264C0U,
+  [17] = (ro_reg32_t)0x580264C4U,
+  [18] = (ro_reg32_t)0x580264C8U,
+  [19] = (ro_reg32_t)0x580264CCU,
+  [20] = (ro_reg32_t)0x580264D0U,
+  [21] = (ro_reg32_t)0x580264D4U,
+  [22] = (ro_reg32_t)0x580264D8U,
+  [23] = (ro_reg32_t)0x580264DCU,
+  [24] = (ro_reg32_t)0x580264E0U,
+  [25] = (ro_reg32_t)0x580264E4U,
+  [26] = (ro_reg32_t)0x580264E8U,
+  [27] = (ro_reg32_t)0x580264ECU,
+  [28] = (ro_reg32_t)0x580264F0U,
+  [29] = (ro_reg32_t)0x580264F4U,
+  [30] = (ro_reg32_t)0x580264F8U,
+  [31] = (ro_reg32_t)0x580264FCU,
+};
+
+/** @brief HSEM Interrupt enable register. */
+static rw_reg32_t const HSEM_HSEM_CxIER[3] = {
+  [1] = (rw_reg32_t)0x58026500U,
+  [2] = (rw_reg32_t)0x58026510U,
+};
+
+/** @brief HSEM Interrupt clear register. */
+static rw_reg32_t const HSEM_HSEM_CxICR[3] = {
+  [1] = (rw_reg32_t)0x58026504U,
+  [2] = (rw_reg32_t)0x58026514U,
+};
+
+/** @brief HSEM Interrupt status register. */
+static ro_reg32_t const HSEM_HSEM_CxISR[3] = {
+  [1] = (ro_reg32_t)0x58026508U,
+  [2] = (ro_reg32_t)0x58026518U,
+};
+
+/** @brief HSEM Masked interrupt status register. */
+static ro_reg32_t const HSEM_HSEM_CxMISR[3] = {
+  [1] = (ro_reg32_t)0x5802650CU,
+  [2] = (ro_reg32_t)0x5802651CU,
+};
+
+/** @subsection HSEM Register Field Definitions */
+
+static const field32_t HSEM_HSEM_CR_COREID   = {.msk = 0x00000F00U, .pos = 8};  /** @brief COREID of semaphores to be cleared. */
+static const field32_t HSEM_HSEM_CR_KEY      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Semaphore clear Key. */
+static const field32_t HSEM_HSEM_KEYR_KEY    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Semaphore Clear Key. */
+static const field32_t HSEM_HSEM_Rx_PROCID   = {.msk = 0x000000FFU, .pos = 0};  /** @brief Semaphore ProcessID. */
+static const field32_t HSEM_HSEM_Rx_COREID   = {.msk = 0x00000F00U, .pos = 8};  /** @brief Semaphore COREID. */
+static const field32_t HSEM_HSEM_Rx_LOCK     = {.msk = 0x80000000U, .pos = 31}; /** @brief Lock indication. */
+static const field32_t HSEM_HSEM_RLRx_PROCID = {.msk = 0x000000FFU, .pos = 0};  /** @brief Semaphore ProcessID. */
+static const field32_t HSEM_HSEM_RLRx_COREID = {.msk = 0x00000F00U, .pos = 8};  /** @brief Semaphore COREID. */
+static const field32_t HSEM_HSEM_RLRx_LOCK   = {.msk = 0x80000000U, .pos = 31}; /** @brief Lock indication. */
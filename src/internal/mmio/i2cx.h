@@ -0,0 +1,227 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/i2cx.h
+ * @authors UW SARP
+ * @brief Registers and fields of I2C1, I2C2, I2C3, I2C4.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section I2Cx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated I2Cx Register Definitions */
+
+/** @brief Access: No wait states, except if a write access occurs while a write access to this register is ongoing. In this case, wait states are inserted in the second write access until the previous one is completed. The latency of the second write access can be up to 2 x PCLK1 + 6 x I2CCLK. */
+static rw_reg32_t const I2Cx_CR1[5] = {
+  [1] = (rw_reg32_t)0x40005400U,
+  [2] = (rw_reg32_t)0x40005800U,
+  [3] = (rw_reg32_t)0x40005C00U,
+  [4] = (rw_reg32_t)0x58001C00U,
+};
+
+/** @brief Access: No wait states, except if a write access occurs while a write access to this register is ongoing. In this case, wait states are inserted in the second write access until the previous one is completed. The latency of the second write access can be up to 2 x PCLK1 + 6 x I2CCLK. */
+static rw_reg32_t const I2Cx_CR2[5] = {
+  [1] = (rw_reg32_t)0x40005404U,
+  [2] = (rw_reg32_t)0x40005804U,
+  [3] = (rw_reg32_t)0x40005C04U,
+  [4] = (rw_reg32_t)0x58001C04U,
+};
+
+/** @brief Access: No wait states, except if a write access occurs while a write access to this register is ongoing. In this case, wait states are inserted in the second write access until the previous one is completed. The latency of the second write access can be up to 2 x PCLK1 + 6 x I2CCLK. */
+static rw_reg32_t const I2Cx_OAR1[5] = {
+  [1] = (rw_reg32_t)0x40005408U,
+  [2] = (rw_reg32_t)0x40005808U,
+  [3] = (rw_reg32_t)0x40005C08U,
+  [4] = (rw_reg32_t)0x58001C08U,
+};
+
+/** @brief Access: No wait states, except if a write access occurs while a write access to this register is ongoing. In this case, wait states are inserted in the second write access until the previous one is completed. The latency of the second write access can be up to 2 x PCLK1 + 6 x I2CCLK. */
+static rw_reg32_t const I2Cx_OAR2[5] = {
+  [1] = (rw_reg32_t)0x4000540CU,
+  [2] = (rw_reg32_t)0x4000580CU,
+  [3] = (rw_reg32_t)0x40005C0CU,
+  [4] = (rw_reg32_t)0x58001C0CU,
+};
+
+/** @brief Access: No wait states. */
+static rw_reg32_t const I2Cx_TIMINGR[5] = {
+  [1] = (rw_reg32_t)0x40005410U,
+  [2] = (rw_reg32_t)0x40005810U,
+  [3] = (rw_reg32_t)0x40005C10U,
+  [4] = (rw_reg32_t)0x58001C10U,
+};
+
+/** @brief Access: No wait states, except if a write access occurs while a write access to this register is ongoing. In this case, wait states are inserted in the second write access until the previous one is completed. The latency of the second write access can be up to 2 x PCLK1 + 6 x I2CCLK. */
+static rw_reg32_t const I2Cx_TIMEOUTR[5] = {
+  [1] = (rw_reg32_t)0x40005414U,
+  [2] = (rw_reg32_t)0x40005814U,
+  [3] = (rw_reg32_t)0x40005C14U,
+  [4] = (rw_reg32_t)0x58001C14U,
+};
+
+/** @brief Access: No wait states. */
+static rw_reg32_t const I2Cx_ISR[5] = {
+  [1] = (rw_reg32_t)0x40005418U,
+  [2] = (rw_reg32_t)0x40005818U,
+  [3] = (rw_reg32_t)0x40005C18U,
+  [4] = (rw_reg32_t)0x58001C18U,
+};
+
+/** @brief Access: No wait states. */
+static rw_reg32_t const I2Cx_ICR[5] = {
+  [1] = (rw_reg32_t)0x4000541CU,
+  [2] = (rw_reg32_t)0x4000581CU,
+  [3] = (rw_reg32_t)0x40005C1CU,
+  [4] = (rw_reg32_t)0x58001C1CU,
+};
+
+/** @brief Access: No wait states. */
+static ro_reg32_t const I2Cx_PECR[5] = {
+  [1] = (ro_reg32_t)0x40005420U,
+  [2] = (ro_reg32_t)0x40005820U,
+  [3] = (ro_reg32_t)0x40005C20U,
+  [4] = (ro_reg32_t)0x58001C20U,
+};
+
+/** @brief Access: No wait states. */
+static ro_reg32_t const I2Cx_RXDR[5] = {
+  [1] = (ro_reg32_t)0x40005424U,
+  [2] = (ro_reg32_t)0x40005824U,
+  [3] = (ro_reg32_t)0x40005C24U,
+  [4] = (ro_reg32_t)0x58001C24U,
+};
+
+/** @brief Access: No wait states. */
+static rw_reg32_t const I2Cx_TXDR[5] = {
+  [1] = (rw_reg32_t)0x40005428U,
+  [2] = (rw_reg32_t)0x40005828U,
+  [3] = (rw_reg32_t)0x40005C28U,
+  [4] = (rw_reg32_t)0x58001C28U,
+};
+
+/** @subsection I2Cx Register Field Definitions */
+
+static const field32_t I2Cx_CR1_PE            = {.msk = 0x00000001U, .pos = 0};  /** @brief Peripheral enable Note: When PE=0, the I2C SCL and SDA lines are released. Internal state machines and status bits are put back to their reset value. When cleared, PE must be kept low for at least 3 APB clock cycles. */
+static const field32_t I2Cx_CR1_TXIE          = {.msk = 0x00000002U, .pos = 1};  /** @brief TX Interrupt enable. */
+static const field32_t I2Cx_CR1_RXIE          = {.msk = 0x00000004U, .pos = 2};  /** @brief RX Interrupt enable. */
+static const field32_t I2Cx_CR1_ADDRIE        = {.msk = 0x00000008U, .pos = 3};  /** @brief Address match Interrupt enable (slave only). */
+static const field32_t I2Cx_CR1_NACKIE        = {.msk = 0x00000010U, .pos = 4};  /** @brief Not acknowledge received Interrupt enable. */
+static const field32_t I2Cx_CR1_STOPIE        = {.msk = 0x00000020U, .pos = 5};  /** @brief STOP detection Interrupt enable. */
+static const field32_t I2Cx_CR1_TCIE          = {.msk = 0x00000040U, .pos = 6};  /** @brief Transfer Complete interrupt enable Note: Any of these events will generate an interrupt: Transfer Complete (TC) Transfer Complete Reload (TCR). */
+static const field32_t I2Cx_CR1_ERRIE         = {.msk = 0x00000080U, .pos = 7};  /** @brief Error interrupts enable Note: Any of these errors generate an interrupt: Arbitration Loss (ARLO) Bus Error detection (BERR) Overrun/Underrun (OVR) Timeout detection (TIMEOUT) PEC error detection (PECERR) Alert pin event detection (ALERT). */
+static const field32_t I2Cx_CR1_DNF           = {.msk = 0x00000F00U, .pos = 8};  /** @brief Digital noise filter These bits are used to configure the digital noise filter on SDA and SCL input. The digital filter will filter spikes with a length of up to DNF[3:0] * tI2CCLK ... Note: If the analog filter is also enabled, the digital filter is added to the analog filter. This filter can only be programmed when the I2C is disabled (PE = 0). */
+static const field32_t I2Cx_CR1_ANFOFF        = {.msk = 0x00001000U, .pos = 12}; /** @brief Analog noise filter OFF Note: This bit can only be programmed when the I2C is disabled (PE = 0). */
+static const field32_t I2Cx_CR1_TXDMAEN       = {.msk = 0x00004000U, .pos = 14}; /** @brief DMA transmission requests enable. */
+static const field32_t I2Cx_CR1_RXDMAEN       = {.msk = 0x00008000U, .pos = 15}; /** @brief DMA reception requests enable. */
+static const field32_t I2Cx_CR1_SBC           = {.msk = 0x00010000U, .pos = 16}; /** @brief Slave byte control This bit is used to enable hardware byte control in slave mode. */
+static const field32_t I2Cx_CR1_NOSTRETCH     = {.msk = 0x00020000U, .pos = 17}; /** @brief Clock stretching disable This bit is used to disable clock stretching in slave mode. It must be kept cleared in master mode. Note: This bit can only be programmed when the I2C is disabled (PE = 0). */
+static const field32_t I2Cx_CR1_WUPEN         = {.msk = 0x00040000U, .pos = 18}; /** @brief Wakeup from Stop mode enable Note: If the Wakeup from Stop mode feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. Note: WUPEN can be set only when DNF = 0000. */
+static const field32_t I2Cx_CR1_GCEN          = {.msk = 0x00080000U, .pos = 19}; /** @brief General call enable. */
+static const field32_t I2Cx_CR1_SMBHEN        = {.msk = 0x00100000U, .pos = 20}; /** @brief SMBus Host address enable Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_CR1_SMBDEN        = {.msk = 0x00200000U, .pos = 21}; /** @brief SMBus Device Default address enable Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_CR1_ALERTEN       = {.msk = 0x00400000U, .pos = 22}; /** @brief SMBus alert enable Device mode (SMBHEN=0): Host mode (SMBHEN=1): Note: When ALERTEN=0, the SMBA pin can be used as a standard GPIO. If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_CR1_PECEN         = {.msk = 0x00800000U, .pos = 23}; /** @brief PEC enable Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_CR2_SADD0         = {.msk = 0x00000001U, .pos = 0};  /** @brief Slave address bit 0 (master mode) In 7-bit addressing mode (ADD10 = 0): This bit is dont care In 10-bit addressing mode (ADD10 = 1): This bit should be written with bit 0 of the slave address to be sent Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD1         = {.msk = 0x00000002U, .pos = 1};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD2         = {.msk = 0x00000004U, .pos = 2};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD3         = {.msk = 0x00000008U, .pos = 3};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD4         = {.msk = 0x00000010U, .pos = 4};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD5         = {.msk = 0x00000020U, .pos = 5};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD6         = {.msk = 0x00000040U, .pos = 6};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD7         = {.msk = 0x00000080U, .pos = 7};  /** @brief Slave address bit 7:1 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits should be written with the 7-bit slave address to be sent In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 7:1 of the slave address to be sent. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD8         = {.msk = 0x00000100U, .pos = 8};  /** @brief Slave address bit 9:8 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits are dont care In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 9:8 of the slave address to be sent Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADD9         = {.msk = 0x00000200U, .pos = 9};  /** @brief Slave address bit 9:8 (master mode) In 7-bit addressing mode (ADD10 = 0): These bits are dont care In 10-bit addressing mode (ADD10 = 1): These bits should be written with bits 9:8 of the slave address to be sent Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_RD_WRN        = {.msk = 0x00000400U, .pos = 10}; /** @brief Transfer direction (master mode) Note: Changing this bit when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_ADD10         = {.msk = 0x00000800U, .pos = 11}; /** @brief 10-bit addressing mode (master mode) Note: Changing this bit when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_HEAD10R       = {.msk = 0x00001000U, .pos = 12}; /** @brief 10-bit address header only read direction (master receiver mode) Note: Changing this bit when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_START         = {.msk = 0x00002000U, .pos = 13}; /** @brief Start generation This bit is set by software, and cleared by hardware after the Start followed by the address sequence is sent, by an arbitration loss, by a timeout error detection, or when PE = 0. It can also be cleared by software by writing 1 to the ADDRCF bit in the I2C_ICR register. If the I2C is already in master mode with AUTOEND = 0, setting this bit generates a Repeated Start condition when RELOAD=0, after the end of the NBYTES transfer. Otherwise setting this bit will generate a START condition once the bus is free. Note: Writing 0 to this bit has no effect. The START bit can be set even if the bus is BUSY or I2C is in slave mode. This bit has no effect when RELOAD is set. */
+static const field32_t I2Cx_CR2_STOP          = {.msk = 0x00004000U, .pos = 14}; /** @brief Stop generation (master mode) The bit is set by software, cleared by hardware when a Stop condition is detected, or when PE = 0. In Master Mode: Note: Writing 0 to this bit has no effect. */
+static const field32_t I2Cx_CR2_NACK          = {.msk = 0x00008000U, .pos = 15}; /** @brief NACK generation (slave mode) The bit is set by software, cleared by hardware when the NACK is sent, or when a STOP condition or an Address matched is received, or when PE=0. Note: Writing 0 to this bit has no effect. This bit is used in slave mode only: in master receiver mode, NACK is automatically generated after last byte preceding STOP or RESTART condition, whatever the NACK bit value. When an overrun occurs in slave receiver NOSTRETCH mode, a NACK is automatically generated whatever the NACK bit value. When hardware PEC checking is enabled (PECBYTE=1), the PEC acknowledge value does not depend on the NACK value. */
+static const field32_t I2Cx_CR2_NBYTES        = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Number of bytes The number of bytes to be transmitted/received is programmed there. This field is dont care in slave mode with SBC=0. Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_RELOAD        = {.msk = 0x01000000U, .pos = 24}; /** @brief NBYTES reload mode This bit is set and cleared by software. */
+static const field32_t I2Cx_CR2_AUTOEND       = {.msk = 0x02000000U, .pos = 25}; /** @brief Automatic end mode (master mode) This bit is set and cleared by software. Note: This bit has no effect in slave mode or when the RELOAD bit is set. */
+static const field32_t I2Cx_CR2_PECBYTE       = {.msk = 0x04000000U, .pos = 26}; /** @brief Packet error checking byte This bit is set by software, and cleared by hardware when the PEC is transferred, or when a STOP condition or an Address matched is received, also when PE=0. Note: Writing 0 to this bit has no effect. This bit has no effect when RELOAD is set. This bit has no effect is slave mode when SBC=0. If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_OAR1_OA1          = {.msk = 0x000003FFU, .pos = 0};  /** @brief Interface address 7-bit addressing mode: dont care 10-bit addressing mode: bits 9:8 of address Note: These bits can be written only when OA1EN=0. OA1[7:1]: Interface address Bits 7:1 of address Note: These bits can be written only when OA1EN=0. OA1[0]: Interface address 7-bit addressing mode: dont care 10-bit addressing mode: bit 0 of address Note: This bit can be written only when OA1EN=0. */
+static const field32_t I2Cx_OAR1_OA1MODE      = {.msk = 0x00000400U, .pos = 10}; /** @brief Own Address 1 10-bit mode Note: This bit can be written only when OA1EN=0. */
+static const field32_t I2Cx_OAR1_OA1EN        = {.msk = 0x00008000U, .pos = 15}; /** @brief Own Address 1 enable. */
+static const field32_t I2Cx_OAR2_OA2          = {.msk = 0x000000FEU, .pos = 1};  /** @brief Interface address bits 7:1 of address Note: These bits can be written only when OA2EN=0. */
+static const field32_t I2Cx_OAR2_OA2MSK       = {.msk = 0x00000700U, .pos = 8};  /** @brief Own Address 2 masks Note: These bits can be written only when OA2EN=0. As soon as OA2MSK is not equal to 0, the reserved I2C addresses (0b0000xxx and 0b1111xxx) are not acknowledged even if the comparison matches. */
+static const field32_t I2Cx_OAR2_OA2EN        = {.msk = 0x00008000U, .pos = 15}; /** @brief Own Address 2 enable. */
+static const field32_t I2Cx_TIMINGR_SCLL      = {.msk = 0x000000FFU, .pos = 0};  /** @brief SCL low period (master mode) This field is used to generate the SCL low period in master mode. tSCLL = (SCLL+1) x tPRESC Note: SCLL is also used to generate tBUF and tSU:STA timings. */
+static const field32_t I2Cx_TIMINGR_SCLH      = {.msk = 0x0000FF00U, .pos = 8};  /** @brief SCL high period (master mode) This field is used to generate the SCL high period in master mode. tSCLH = (SCLH+1) x tPRESC Note: SCLH is also used to generate tSU:STO and tHD:STA timing. */
+static const field32_t I2Cx_TIMINGR_SDADEL    = {.msk = 0x000F0000U, .pos = 16}; /** @brief Data hold time This field is used to generate the delay tSDADEL between SCL falling edge and SDA edge. In master mode and in slave mode with NOSTRETCH = 0, the SCL line is stretched low during tSDADEL. tSDADEL= SDADEL x tPRESC Note: SDADEL is used to generate tHD:DAT timing. */
+static const field32_t I2Cx_TIMINGR_SCLDEL    = {.msk = 0x00F00000U, .pos = 20}; /** @brief Data setup time This field is used to generate a delay tSCLDEL between SDA edge and SCL rising edge. In master mode and in slave mode with NOSTRETCH = 0, the SCL line is stretched low during tSCLDEL. tSCLDEL = (SCLDEL+1) x tPRESC Note: tSCLDEL is used to generate tSU:DAT timing. */
+static const field32_t I2Cx_TIMINGR_PRESC     = {.msk = 0xF0000000U, .pos = 28}; /** @brief Timing prescaler This field is used to prescale I2CCLK in order to generate the clock period tPRESC used for data setup and hold counters (refer to I2C timings on page9) and for SCL high and low level counters (refer to I2C master initialization on page24). tPRESC = (PRESC+1) x tI2CCLK. */
+static const field32_t I2Cx_TIMEOUTR_TIMEOUTA = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Bus Timeout A This field is used to configure: The SCL low timeout condition tTIMEOUT when TIDLE=0 tTIMEOUT= (TIMEOUTA+1) x 2048 x tI2CCLK The bus idle condition (both SCL and SDA high) when TIDLE=1 tIDLE= (TIMEOUTA+1) x 4 x tI2CCLK Note: These bits can be written only when TIMOUTEN=0. */
+static const field32_t I2Cx_TIMEOUTR_TIDLE    = {.msk = 0x00001000U, .pos = 12}; /** @brief Idle clock timeout detection Note: This bit can be written only when TIMOUTEN=0. */
+static const field32_t I2Cx_TIMEOUTR_TIMOUTEN = {.msk = 0x00008000U, .pos = 15}; /** @brief Clock timeout enable. */
+static const field32_t I2Cx_TIMEOUTR_TIMEOUTB = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Bus timeout B This field is used to configure the cumulative clock extension timeout: In master mode, the master cumulative clock low extend time (tLOW:MEXT) is detected In slave mode, the slave cumulative clock low extend time (tLOW:SEXT) is detected tLOW:EXT= (TIMEOUTB+1) x 2048 x tI2CCLK Note: These bits can be written only when TEXTEN=0. */
+static const field32_t I2Cx_TIMEOUTR_TEXTEN   = {.msk = 0x80000000U, .pos = 31}; /** @brief Extended clock timeout enable. */
+static const field32_t I2Cx_ISR_TXE           = {.msk = 0x00000001U, .pos = 0};  /** @brief Transmit data register empty (transmitters) This bit is set by hardware when the I2C_TXDR register is empty. It is cleared when the next data to be sent is written in the I2C_TXDR register. This bit can be written to 1 by software in order to flush the transmit data register I2C_TXDR. Note: This bit is set by hardware when PE=0. */
+static const field32_t I2Cx_ISR_TXIS          = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit interrupt status (transmitters) This bit is set by hardware when the I2C_TXDR register is empty and the data to be transmitted must be written in the I2C_TXDR register. It is cleared when the next data to be sent is written in the I2C_TXDR register. This bit can be written to 1 by software when NOSTRETCH=1 only, in order to generate a TXIS event (interrupt if TXIE=1 or DMA request if TXDMAEN=1). Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_RXNE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Receive data register not empty (receivers) This bit is set by hardware when the received data is copied into the I2C_RXDR register, and is ready to be read. It is cleared when I2C_RXDR is read. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_ADDR          = {.msk = 0x00000008U, .pos = 3};  /** @brief Address matched (slave mode) This bit is set by hardware as soon as the received slave address matched with one of the enabled slave addresses. It is cleared by software by setting ADDRCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_NACKF         = {.msk = 0x00000010U, .pos = 4};  /** @brief Not Acknowledge received flag This flag is set by hardware when a NACK is received after a byte transmission. It is cleared by software by setting the NACKCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_STOPF         = {.msk = 0x00000020U, .pos = 5};  /** @brief Stop detection flag This flag is set by hardware when a Stop condition is detected on the bus and the peripheral is involved in this transfer: either as a master, provided that the STOP condition is generated by the peripheral. or as a slave, provided that the peripheral has been addressed previously during this transfer. It is cleared by software by setting the STOPCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_TC            = {.msk = 0x00000040U, .pos = 6};  /** @brief Transfer Complete (master mode) This flag is set by hardware when RELOAD=0, AUTOEND=0 and NBYTES data have been transferred. It is cleared by software when START bit or STOP bit is set. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_TCR           = {.msk = 0x00000080U, .pos = 7};  /** @brief Transfer Complete Reload This flag is set by hardware when RELOAD=1 and NBYTES data have been transferred. It is cleared by software when NBYTES is written to a non-zero value. Note: This bit is cleared by hardware when PE=0. This flag is only for master mode, or for slave mode when the SBC bit is set. */
+static const field32_t I2Cx_ISR_BERR          = {.msk = 0x00000100U, .pos = 8};  /** @brief Bus error This flag is set by hardware when a misplaced Start or Stop condition is detected whereas the peripheral is involved in the transfer. The flag is not set during the address phase in slave mode. It is cleared by software by setting BERRCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_ARLO          = {.msk = 0x00000200U, .pos = 9};  /** @brief Arbitration lost This flag is set by hardware in case of arbitration loss. It is cleared by software by setting the ARLOCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_OVR           = {.msk = 0x00000400U, .pos = 10}; /** @brief Overrun/Underrun (slave mode) This flag is set by hardware in slave mode with NOSTRETCH=1, when an overrun/underrun error occurs. It is cleared by software by setting the OVRCF bit. Note: This bit is cleared by hardware when PE=0. */
+static const field32_t I2Cx_ISR_PECERR        = {.msk = 0x00000800U, .pos = 11}; /** @brief PEC Error in reception This flag is set by hardware when the received PEC does not match with the PEC register content. A NACK is automatically sent after the wrong PEC reception. It is cleared by software by setting the PECCF bit. Note: This bit is cleared by hardware when PE=0. If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_ISR_TIMEOUT       = {.msk = 0x00001000U, .pos = 12}; /** @brief Timeout or tLOW detection flag This flag is set by hardware when a timeout or extended clock timeout occurred. It is cleared by software by setting the TIMEOUTCF bit. Note: This bit is cleared by hardware when PE=0. If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_ISR_ALERT         = {.msk = 0x00002000U, .pos = 13}; /** @brief SMBus alert This flag is set by hardware when SMBHEN=1 (SMBus host configuration), ALERTEN=1 and a SMBALERT event (falling edge) is detected on SMBA pin. It is cleared by software by setting the ALERTCF bit. Note: This bit is cleared by hardware when PE=0. If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_ISR_BUSY          = {.msk = 0x00008000U, .pos = 15}; /** @brief Bus busy This flag indicates that a communication is in progress on the bus. It is set by hardware when a START condition is detected. It is cleared by hardware when a Stop condition is detected, or when PE=0. */
+static const field32_t I2Cx_ISR_DIR           = {.msk = 0x00010000U, .pos = 16}; /** @brief Transfer direction (Slave mode) This flag is updated when an address match event occurs (ADDR=1). */
+static const field32_t I2Cx_ISR_ADDCODE       = {.msk = 0x00FE0000U, .pos = 17}; /** @brief Address match code (Slave mode) These bits are updated with the received address when an address match event occurs (ADDR = 1). In the case of a 10-bit address, ADDCODE provides the 10-bit header followed by the 2 MSBs of the address. */
+static const field32_t I2Cx_ICR_ADDRCF        = {.msk = 0x00000008U, .pos = 3};  /** @brief Address matched flag clear Writing 1 to this bit clears the ADDR flag in the I2C_ISR register. Writing 1 to this bit also clears the START bit in the I2C_CR2 register. */
+static const field32_t I2Cx_ICR_NACKCF        = {.msk = 0x00000010U, .pos = 4};  /** @brief Not Acknowledge flag clear Writing 1 to this bit clears the ACKF flag in I2C_ISR register. */
+static const field32_t I2Cx_ICR_STOPCF        = {.msk = 0x00000020U, .pos = 5};  /** @brief Stop detection flag clear Writing 1 to this bit clears the STOPF flag in the I2C_ISR register. */
+static const field32_t I2Cx_ICR_BERRCF        = {.msk = 0x00000100U, .pos = 8};  /** @brief Bus error flag clear Writing 1 to this bit clears the BERRF flag in the I2C_ISR register. */
+static const field32_t I2Cx_ICR_ARLOCF        = {.msk = 0x00000200U, .pos = 9};  /** @brief Arbitration Lost flag clear Writing 1 to this bit clears the ARLO flag in the I2C_ISR register. */
+static const field32_t I2Cx_ICR_OVRCF         = {.msk = 0x00000400U, .pos = 10}; /** @brief Overrun/Underrun flag clear Writing 1 to this bit clears the OVR flag in the I2C_ISR register. */
+static const field32_t I2Cx_ICR_PECCF         = {.msk = 0x00000800U, .pos = 11}; /** @brief PEC Error flag clear Writing 1 to this bit clears the PECERR flag in the I2C_ISR register. Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_ICR_TIMOUTCF      = {.msk = 0x00001000U, .pos = 12}; /** @brief Timeout detection flag clear Writing 1 to this bit clears the TIMEOUT flag in the I2C_ISR register. Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_ICR_ALERTCF       = {.msk = 0x00002000U, .pos = 13}; /** @brief Alert flag clear Writing 1 to this bit clears the ALERT flag in the I2C_ISR register. Note: If the SMBus feature is not supported, this bit is reserved and forced by hardware to 0. Please refer to Section25.3: I2C implementation. */
+static const field32_t I2Cx_PECR_PEC          = {.msk = 0x000000FFU, .pos = 0};  /** @brief Packet error checking register This field contains the internal PEC when PECEN=1. The PEC is cleared by hardware when PE=0. */
+static const field32_t I2Cx_RXDR_RXDATA       = {.msk = 0x000000FFU, .pos = 0};  /** @brief 8-bit receive data Data byte received from the I2C bus. */
+static const field32_t I2Cx_TXDR_TXDATA       = {.msk = 0x000000FFU, .pos = 0};  /** @brief 8-bit transmit data Data byte to be transmitted to the I2C bus. Note: These bits can be written only when TXE=1. */
+
+/** @subsection Enumerated I2Cx Register Field Definitions */
+
+/** @brief Slave address bit 0 (master mode) In 7-bit addressing mode (ADD10 = 0): This bit is dont care In 10-bit addressing mode (ADD10 = 1): This bit should be written with bit 0 of the slave address to be sent Note: Changing these bits when the START bit is set is not allowed. */
+static const field32_t I2Cx_CR2_SADDx[10] = {
+  [0] = {.msk = 0x00000001U, .pos = 0},
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+  [3] = {.msk = 0x00000008U, .pos = 3},
+  [4] = {.msk = 0x00000010U, .pos = 4},
+  [5] = {.msk = 0x00000020U, .pos = 5},
+  [6] = {.msk = 0x00000040U, .pos = 6},
+  [7] = {.msk = 0x00000080U, .pos = 7},
+  [8] = {.msk = 0x00000100U, .pos = 8},
+  [9] = {.msk = 0x00000200U, .pos = 9},
+};
@@ -0,0 +1,75 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/iwdgx.h
+ * @authors UW SARP
+ * @brief Registers and fields of IWDG1, IWDG2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section IWDGx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated IWDGx Register Definitions */
+
+/** @brief Key register. */
+static rw_reg32_t const IWDGx_KR[3] = {
+  [1] = (rw_reg32_t)0x58004800U,
+  [2] = (rw_reg32_t)0x58004C00U,
+};
+
+/** @brief Prescaler register. */
+static rw_reg32_t const IWDGx_PR[3] = {
+  [1] = (rw_reg32_t)0x58004804U,
+  [2] = (rw_reg32_t)0x58004C04U,
+};
+
+/** @brief Reload register. */
+static rw_reg32_t const IWDGx_RLR[3] = {
+  [1] = (rw_reg32_t)0x58004808U,
+  [2] = (rw_reg32_t)0x58004C08U,
+};
+
+/** @brief Status register. */
+static ro_reg32_t const IWDGx_SR[3] = {
+  [1] = (ro_reg32_t)0x5800480CU,
+  [2] = (ro_reg32_t)0x58004C0CU,
+};
+
+/** @brief Window register. */
+static rw_reg32_t const IWDGx_WINR[3] = {
+  [1] = (rw_reg32_t)0x58004810U,
+  [2] = (rw_reg32_t)0x58004C10U,
+};
+
+/** @subsection IWDGx Register Field Definitions */
+
+static const field32_t IWDGx_KR_KEY   = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Key value (write only, read 0x0000) These bits must be written by software at regular intervals with the key value 0xAAAA, otherwise the watchdog generates a reset when the counter reaches 0. Writing the key value 0x5555 to enable access to the IWDG_PR, IWDG_RLR and IWDG_WINR registers (see Section23.3.6: Register access protection) Writing the key value CCCCh starts the watchdog (except if the hardware watchdog option is selected). */
+static const field32_t IWDGx_PR_PR    = {.msk = 0x00000007U, .pos = 0}; /** @brief Prescaler divider These bits are write access protected see Section23.3.6: Register access protection. They are written by software to select the prescaler divider feeding the counter clock. PVU bit of IWDG_SR must be reset in order to be able to change the prescaler divider. Note: Reading this register returns the prescaler value from the VDD voltage domain. This value may not be up to date/valid if a write operation to this register is ongoing. For this reason the value read from this register is valid only when the PVU bit in the IWDG_SR register is reset. */
+static const field32_t IWDGx_RLR_RL   = {.msk = 0x00000FFFU, .pos = 0}; /** @brief Watchdog counter reload value These bits are write access protected see Section23.3.6. They are written by software to define the value to be loaded in the watchdog counter each time the value 0xAAAA is written in the IWDG_KR register. The watchdog counter counts down from this value. The timeout period is a function of this value and the clock prescaler. Refer to the datasheet for the timeout information. The RVU bit in the IWDG_SR register must be reset in order to be able to change the reload value. Note: Reading this register returns the reload value from the VDD voltage domain. This value may not be up to date/valid if a write operation to this register is ongoing on this register. For this reason the value read from this register is valid only when the RVU bit in the IWDG_SR register is reset. */
+static const field32_t IWDGx_SR_PVU   = {.msk = 0x00000001U, .pos = 0}; /** @brief Watchdog prescaler value update This bit is set by hardware to indicate that an update of the prescaler value is ongoing. It is reset by hardware when the prescaler update operation is completed in the VDD voltage domain (takes up to 5 RC 40 kHz cycles). Prescaler value can be updated only when PVU bit is reset. */
+static const field32_t IWDGx_SR_RVU   = {.msk = 0x00000002U, .pos = 1}; /** @brief Watchdog counter reload value update This bit is set by hardware to indicate that an update of the reload value is ongoing. It is reset by hardware when the reload value update operation is completed in the VDD voltage domain (takes up to 5 RC 40 kHz cycles). Reload value can be updated only when RVU bit is reset. */
+static const field32_t IWDGx_SR_WVU   = {.msk = 0x00000004U, .pos = 2}; /** @brief Watchdog counter window value update This bit is set by hardware to indicate that an update of the window value is ongoing. It is reset by hardware when the reload value update operation is completed in the VDD voltage domain (takes up to 5 RC 40 kHz cycles). Window value can be updated only when WVU bit is reset. This bit is generated only if generic window = 1. */
+static const field32_t IWDGx_WINR_WIN = {.msk = 0x00000FFFU, .pos = 0}; /** @brief Watchdog counter window value These bits are write access protected see Section23.3.6. These bits contain the high limit of the window value to be compared to the downcounter. To prevent a reset, the downcounter must be reloaded when its value is lower than the window register value and greater than 0x0 The WVU bit in the IWDG_SR register must be reset in order to be able to change the reload value. Note: Reading this register returns the reload value from the VDD voltage domain. This value may not be valid if a write operation to this register is ongoing. For this reason the value read from this register is valid only when the WVU bit in the IWDG_SR register is reset. */
@@ -0,0 +1,93 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/jpeg.h
+ * @authors UW SARP
+ * @brief Registers and fields of JPEG.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section JPEG Definitions
+ **************************************************************************************************/
+
+/** @subsection JPEG Register Definitions */
+
+static rw_reg32_t const JPEG_CONFR0 = (rw_reg32_t)0x52003000U; /** @brief JPEG codec control register. */
+static rw_reg32_t const JPEG_CONFR1 = (rw_reg32_t)0x52003004U; /** @brief JPEG codec configuration register 1. */
+static rw_reg32_t const JPEG_CONFR2 = (rw_reg32_t)0x52003008U; /** @brief JPEG codec configuration register 2. */
+static rw_reg32_t const JPEG_CONFR3 = (rw_reg32_t)0x5200300CU; /** @brief JPEG codec configuration register 3. */
+static rw_reg32_t const JPEG_CR     = (rw_reg32_t)0x52003030U; /** @brief JPEG control register. */
+static ro_reg32_t const JPEG_SR     = (ro_reg32_t)0x52003034U; /** @brief JPEG status register. */
+static rw_reg32_t const JPEG_CFR    = (rw_reg32_t)0x52003038U; /** @brief JPEG clear flag register. */
+static rw_reg32_t const JPEG_DIR    = (rw_reg32_t)0x52003040U; /** @brief JPEG data input register. */
+static ro_reg32_t const JPEG_DOR    = (ro_reg32_t)0x52003044U; /** @brief JPEG data output register. */
+
+/** @subsection Enumerated JPEG Register Definitions */
+
+/** @brief JPEG codec configuration register 4-7. */
+static rw_reg32_t const JPEG_CONFRNx[5] = {
+  [1] = (rw_reg32_t)0x52003010U,
+  [2] = (rw_reg32_t)0x52003014U,
+  [3] = (rw_reg32_t)0x52003018U,
+  [4] = (rw_reg32_t)0x5200301CU,
+};
+
+/** @subsection JPEG Register Field Definitions */
+
+static const field32_t JPEG_CONFR0_START      = {.msk = 0x00000001U, .pos = 0};  /** @brief Start This bit start or stop the encoding or decoding process. Read this register always return 0. */
+static const field32_t JPEG_CONFR1_NF         = {.msk = 0x00000003U, .pos = 0};  /** @brief Number of color components This field defines the number of color components minus 1. */
+static const field32_t JPEG_CONFR1_DE         = {.msk = 0x00000008U, .pos = 3};  /** @brief Decoding Enable This bit selects the coding or decoding process. */
+static const field32_t JPEG_CONFR1_COLORSPACE = {.msk = 0x00000030U, .pos = 4};  /** @brief Color Space This filed defines the number of quantization tables minus 1 to insert in the output stream. */
+static const field32_t JPEG_CONFR1_NS         = {.msk = 0x000000C0U, .pos = 6};  /** @brief Number of components for Scan This field defines the number of components minus 1 for scan header marker segment. */
+static const field32_t JPEG_CONFR1_HDR        = {.msk = 0x00000100U, .pos = 8};  /** @brief Header Processing This bit enable the header processing (generation/parsing). */
+static const field32_t JPEG_CONFR1_YSIZE      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Y Size This field defines the number of lines in source image. */
+static const field32_t JPEG_CONFR2_NMCU       = {.msk = 0x03FFFFFFU, .pos = 0};  /** @brief Number of MCU For encoding: this field defines the number of MCU units minus 1 to encode. For decoding: this field indicates the number of complete MCU units minus 1 to be decoded (this field is updated after the JPEG header parsing). If the decoded image size has not a X or Y size multiple of 8 or 16 (depending on the sub-sampling process), the resulting incomplete or empty MCU must be added to this value to get the total number of MCU generated. */
+static const field32_t JPEG_CONFR3_XSIZE      = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief X size This field defines the number of pixels per line. */
+static const field32_t JPEG_CR_JCEN           = {.msk = 0x00000001U, .pos = 0};  /** @brief JPEG Core Enable Enable the JPEG codec Core. */
+static const field32_t JPEG_CR_IFTIE          = {.msk = 0x00000002U, .pos = 1};  /** @brief Input FIFO Threshold Interrupt Enable This bit enables the interrupt generation when input FIFO reach the threshold. */
+static const field32_t JPEG_CR_IFNFIE         = {.msk = 0x00000004U, .pos = 2};  /** @brief Input FIFO Not Full Interrupt Enable This bit enables the interrupt generation when input FIFO is not empty. */
+static const field32_t JPEG_CR_OFTIE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Output FIFO Threshold Interrupt Enable This bit enables the interrupt generation when output FIFO reach the threshold. */
+static const field32_t JPEG_CR_OFNEIE         = {.msk = 0x00000010U, .pos = 4};  /** @brief Output FIFO Not Empty Interrupt Enable This bit enables the interrupt generation when output FIFO is not empty. */
+static const field32_t JPEG_CR_EOCIE          = {.msk = 0x00000020U, .pos = 5};  /** @brief End of Conversion Interrupt Enable This bit enables the interrupt generation on the end of conversion. */
+static const field32_t JPEG_CR_HPDIE          = {.msk = 0x00000040U, .pos = 6};  /** @brief Header Parsing Done Interrupt Enable This bit enables the interrupt generation on the Header Parsing Operation. */
+static const field32_t JPEG_CR_IDMAEN         = {.msk = 0x00000800U, .pos = 11}; /** @brief Input DMA Enable Enable the DMA request generation for the input FIFO. */
+static const field32_t JPEG_CR_ODMAEN         = {.msk = 0x00001000U, .pos = 12}; /** @brief Output DMA Enable Enable the DMA request generation for the output FIFO. */
+static const field32_t JPEG_CR_IFF            = {.msk = 0x00002000U, .pos = 13}; /** @brief Input FIFO Flush This bit flush the input FIFO. This bit is always read as 0. */
+static const field32_t JPEG_CR_OFF            = {.msk = 0x00004000U, .pos = 14}; /** @brief Output FIFO Flush This bit flush the output FIFO. This bit is always read as 0. */
+static const field32_t JPEG_SR_IFTF           = {.msk = 0x00000002U, .pos = 1};  /** @brief Input FIFO Threshold Flag This bit is set when the input FIFO is not full and is bellow its threshold. */
+static const field32_t JPEG_SR_IFNFF          = {.msk = 0x00000004U, .pos = 2};  /** @brief Input FIFO Not Full Flag This bit is set when the input FIFO is not full (a data can be written). */
+static const field32_t JPEG_SR_OFTF           = {.msk = 0x00000008U, .pos = 3};  /** @brief Output FIFO Threshold Flag This bit is set when the output FIFO is not empty and has reach its threshold. */
+static const field32_t JPEG_SR_OFNEF          = {.msk = 0x00000010U, .pos = 4};  /** @brief Output FIFO Not Empty Flag This bit is set when the output FIFO is not empty (a data is available). */
+static const field32_t JPEG_SR_EOCF           = {.msk = 0x00000020U, .pos = 5};  /** @brief End of Conversion Flag This bit is set when the JPEG codec core has finished the encoding or the decoding process and than last data has been sent to the output FIFO. */
+static const field32_t JPEG_SR_HPDF           = {.msk = 0x00000040U, .pos = 6};  /** @brief Header Parsing Done Flag This bit is set in decode mode when the JPEG codec has finished the parsing of the headers and the internal registers have been updated. */
+static const field32_t JPEG_SR_COF            = {.msk = 0x00000080U, .pos = 7};  /** @brief Codec Operation Flag This bit is set when when a JPEG codec operation is on going (encoding or decoding). */
+static const field32_t JPEG_CFR_CEOCF         = {.msk = 0x00000020U, .pos = 5};  /** @brief Clear End of Conversion Flag Writing 1 clears the End of Conversion Flag of the JPEG Status Register. */
+static const field32_t JPEG_CFR_CHPDF         = {.msk = 0x00000040U, .pos = 6};  /** @brief Clear Header Parsing Done Flag Writing 1 clears the Header Parsing Done Flag of the JPEG Status Register. */
+static const field32_t JPEG_CONFRNx_HD        = {.msk = 0x00000001U, .pos = 0};  /** @brief Huffman DC Selects the Huffman table for encoding the DC coefficients. */
+static const field32_t JPEG_CONFRNx_HA        = {.msk = 0x00000002U, .pos = 1};  /** @brief Huffman AC Selects the Huffman table for encoding the AC coefficients. */
+static const field32_t JPEG_CONFRNx_QT        = {.msk = 0x0000000CU, .pos = 2};  /** @brief Quantization Table Selects quantization table associated with a color component. */
+static const field32_t JPEG_CONFRNx_NB        = {.msk = 0x000000F0U, .pos = 4};  /** @brief Number of Block Number of data units minus 1 that belong to a particular color in the MCU. */
+static const field32_t JPEG_CONFRNx_VSF       = {.msk = 0x00000F00U, .pos = 8};  /** @brief Vertical Sampling Factor Vertical sampling factor for component i. */
+static const field32_t JPEG_CONFRNx_HSF       = {.msk = 0x0000F000U, .pos = 12}; /** @brief Horizontal Sampling Factor Horizontal sampling factor for component i. */
@@ -0,0 +1,148 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/lpuart1.h
+ * @authors UW SARP
+ * @brief Registers and fields of LPUART1.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section LPUART1 Definitions
+ **************************************************************************************************/
+
+/** @subsection LPUART1 Register Definitions */
+
+static rw_reg32_t const LPUART1_CR1   = (rw_reg32_t)0x58000C00U; /** @brief Control register 1. */
+static rw_reg32_t const LPUART1_CR2   = (rw_reg32_t)0x58000C04U; /** @brief Control register 2. */
+static rw_reg32_t const LPUART1_CR3   = (rw_reg32_t)0x58000C08U; /** @brief Control register 3. */
+static rw_reg32_t const LPUART1_BRR   = (rw_reg32_t)0x58000C0CU; /** @brief Baud rate register. */
+static rw_reg32_t const LPUART1_GTPR  = (rw_reg32_t)0x58000C10U; /** @brief Guard time and prescaler register. */
+static rw_reg32_t const LPUART1_RTOR  = (rw_reg32_t)0x58000C14U; /** @brief Receiver timeout register. */
+static rw_reg32_t const LPUART1_RQR   = (rw_reg32_t)0x58000C18U; /** @brief Request register. */
+static ro_reg32_t const LPUART1_ISR   = (ro_reg32_t)0x58000C1CU; /** @brief Interrupt & status register. */
+static rw_reg32_t const LPUART1_ICR   = (rw_reg32_t)0x58000C20U; /** @brief Interrupt flag clear register. */
+static ro_reg32_t const LPUART1_RDR   = (ro_reg32_t)0x58000C24U; /** @brief Receive data register. */
+static rw_reg32_t const LPUART1_TDR   = (rw_reg32_t)0x58000C28U; /** @brief Transmit data register. */
+static rw_reg32_t const LPUART1_PRESC = (rw_reg32_t)0x58000C2CU; /** @brief Prescaler register. */
+
+/** @subsection LPUART1 Register Field Definitions */
+
+static const field32_t LPUART1_CR1_RXFFIE      = {.msk = 0x80000000U, .pos = 31}; /** @brief RXFIFO Full interrupt enable. */
+static const field32_t LPUART1_CR1_TXFEIE      = {.msk = 0x40000000U, .pos = 30}; /** @brief TXFIFO empty interrupt enable. */
+static const field32_t LPUART1_CR1_FIFOEN      = {.msk = 0x20000000U, .pos = 29}; /** @brief FIFO mode enable. */
+static const field32_t LPUART1_CR1_M1          = {.msk = 0x10000000U, .pos = 28}; /** @brief Word length. */
+static const field32_t LPUART1_CR1_DEAT        = {.msk = 0x03E00000U, .pos = 21}; /** @brief Driver Enable assertion time. */
+static const field32_t LPUART1_CR1_DEDT        = {.msk = 0x001F0000U, .pos = 16}; /** @brief Driver Enable deassertion time. */
+static const field32_t LPUART1_CR1_CMIE        = {.msk = 0x00004000U, .pos = 14}; /** @brief Character match interrupt enable. */
+static const field32_t LPUART1_CR1_MME         = {.msk = 0x00002000U, .pos = 13}; /** @brief Mute mode enable. */
+static const field32_t LPUART1_CR1_M0          = {.msk = 0x00001000U, .pos = 12}; /** @brief Word length. */
+static const field32_t LPUART1_CR1_WAKE        = {.msk = 0x00000800U, .pos = 11}; /** @brief Receiver wakeup method. */
+static const field32_t LPUART1_CR1_PCE         = {.msk = 0x00000400U, .pos = 10}; /** @brief Parity control enable. */
+static const field32_t LPUART1_CR1_PS          = {.msk = 0x00000200U, .pos = 9};  /** @brief Parity selection. */
+static const field32_t LPUART1_CR1_PEIE        = {.msk = 0x00000100U, .pos = 8};  /** @brief PE interrupt enable. */
+static const field32_t LPUART1_CR1_TXEIE       = {.msk = 0x00000080U, .pos = 7};  /** @brief Interrupt enable. */
+static const field32_t LPUART1_CR1_TCIE        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete interrupt enable. */
+static const field32_t LPUART1_CR1_RXNEIE      = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE interrupt enable. */
+static const field32_t LPUART1_CR1_IDLEIE      = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE interrupt enable. */
+static const field32_t LPUART1_CR1_TE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Transmitter enable. */
+static const field32_t LPUART1_CR1_RE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Receiver enable. */
+static const field32_t LPUART1_CR1_UESM        = {.msk = 0x00000002U, .pos = 1};  /** @brief USART enable in Stop mode. */
+static const field32_t LPUART1_CR1_UE          = {.msk = 0x00000001U, .pos = 0};  /** @brief USART enable. */
+static const field32_t LPUART1_CR2_ADD         = {.msk = 0xFF000000U, .pos = 24}; /** @brief Address of the USART node. */
+static const field32_t LPUART1_CR2_MSBFIRST    = {.msk = 0x00080000U, .pos = 19}; /** @brief Most significant bit first. */
+static const field32_t LPUART1_CR2_DATAINV     = {.msk = 0x00040000U, .pos = 18}; /** @brief Binary data inversion. */
+static const field32_t LPUART1_CR2_TXINV       = {.msk = 0x00020000U, .pos = 17}; /** @brief TX pin active level inversion. */
+static const field32_t LPUART1_CR2_RXINV       = {.msk = 0x00010000U, .pos = 16}; /** @brief RX pin active level inversion. */
+static const field32_t LPUART1_CR2_SWAP        = {.msk = 0x00008000U, .pos = 15}; /** @brief Swap TX/RX pins. */
+static const field32_t LPUART1_CR2_STOP        = {.msk = 0x00003000U, .pos = 12}; /** @brief STOP bits. */
+static const field32_t LPUART1_CR2_ADDM7       = {.msk = 0x00000010U, .pos = 4};  /** @brief 7-bit Address Detection/4-bit Address Detection. */
+static const field32_t LPUART1_CR3_TXFTCFG     = {.msk = 0xE0000000U, .pos = 29}; /** @brief TXFIFO threshold configuration. */
+static const field32_t LPUART1_CR3_RXFTIE      = {.msk = 0x10000000U, .pos = 28}; /** @brief RXFIFO threshold interrupt enable. */
+static const field32_t LPUART1_CR3_RXFTCFG     = {.msk = 0x0E000000U, .pos = 25}; /** @brief Receive FIFO threshold configuration. */
+static const field32_t LPUART1_CR3_TXFTIE      = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO threshold interrupt enable. */
+static const field32_t LPUART1_CR3_WUFIE       = {.msk = 0x00400000U, .pos = 22}; /** @brief Wakeup from Stop mode interrupt enable. */
+static const field32_t LPUART1_CR3_WUS         = {.msk = 0x00300000U, .pos = 20}; /** @brief Wakeup from Stop mode interrupt flag selection. */
+static const field32_t LPUART1_CR3_DEP         = {.msk = 0x00008000U, .pos = 15}; /** @brief Driver enable polarity selection. */
+static const field32_t LPUART1_CR3_DEM         = {.msk = 0x00004000U, .pos = 14}; /** @brief Driver enable mode. */
+static const field32_t LPUART1_CR3_DDRE        = {.msk = 0x00002000U, .pos = 13}; /** @brief DMA Disable on Reception Error. */
+static const field32_t LPUART1_CR3_OVRDIS      = {.msk = 0x00001000U, .pos = 12}; /** @brief Overrun Disable. */
+static const field32_t LPUART1_CR3_CTSIE       = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS interrupt enable. */
+static const field32_t LPUART1_CR3_CTSE        = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS enable. */
+static const field32_t LPUART1_CR3_RTSE        = {.msk = 0x00000100U, .pos = 8};  /** @brief RTS enable. */
+static const field32_t LPUART1_CR3_DMAT        = {.msk = 0x00000080U, .pos = 7};  /** @brief DMA enable transmitter. */
+static const field32_t LPUART1_CR3_DMAR        = {.msk = 0x00000040U, .pos = 6};  /** @brief DMA enable receiver. */
+static const field32_t LPUART1_CR3_HDSEL       = {.msk = 0x00000008U, .pos = 3};  /** @brief Half-duplex selection. */
+static const field32_t LPUART1_CR3_EIE         = {.msk = 0x00000001U, .pos = 0};  /** @brief Error interrupt enable. */
+static const field32_t LPUART1_BRR_BRR         = {.msk = 0x000FFFFFU, .pos = 0};  /** @brief BRR. */
+static const field32_t LPUART1_GTPR_GT         = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Guard time value. */
+static const field32_t LPUART1_GTPR_PSC        = {.msk = 0x000000FFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t LPUART1_RTOR_BLEN       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Block Length. */
+static const field32_t LPUART1_RTOR_RTO        = {.msk = 0x00FFFFFFU, .pos = 0};  /** @brief Receiver timeout value. */
+static const field32_t LPUART1_RQR_TXFRQ       = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit data flush request. */
+static const field32_t LPUART1_RQR_RXFRQ       = {.msk = 0x00000008U, .pos = 3};  /** @brief Receive data flush request. */
+static const field32_t LPUART1_RQR_MMRQ        = {.msk = 0x00000004U, .pos = 2};  /** @brief Mute mode request. */
+static const field32_t LPUART1_RQR_SBKRQ       = {.msk = 0x00000002U, .pos = 1};  /** @brief Send break request. */
+static const field32_t LPUART1_RQR_ABRRQ       = {.msk = 0x00000001U, .pos = 0};  /** @brief Auto baud rate request. */
+static const field32_t LPUART1_ISR_TXFT        = {.msk = 0x08000000U, .pos = 27}; /** @brief TXFIFO threshold flag. */
+static const field32_t LPUART1_ISR_RXFT        = {.msk = 0x04000000U, .pos = 26}; /** @brief RXFIFO threshold flag. */
+static const field32_t LPUART1_ISR_RXFF        = {.msk = 0x01000000U, .pos = 24}; /** @brief RXFIFO Full. */
+static const field32_t LPUART1_ISR_TXFE        = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO Empty. */
+static const field32_t LPUART1_ISR_REACK       = {.msk = 0x00400000U, .pos = 22}; /** @brief REACK. */
+static const field32_t LPUART1_ISR_TEACK       = {.msk = 0x00200000U, .pos = 21}; /** @brief TEACK. */
+static const field32_t LPUART1_ISR_WUF         = {.msk = 0x00100000U, .pos = 20}; /** @brief WUF. */
+static const field32_t LPUART1_ISR_RWU         = {.msk = 0x00080000U, .pos = 19}; /** @brief RWU. */
+static const field32_t LPUART1_ISR_SBKF        = {.msk = 0x00040000U, .pos = 18}; /** @brief SBKF. */
+static const field32_t LPUART1_ISR_CMF         = {.msk = 0x00020000U, .pos = 17}; /** @brief CMF. */
+static const field32_t LPUART1_ISR_BUSY        = {.msk = 0x00010000U, .pos = 16}; /** @brief BUSY. */
+static const field32_t LPUART1_ISR_CTS         = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS. */
+static const field32_t LPUART1_ISR_CTSIF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTSIF. */
+static const field32_t LPUART1_ISR_TXE         = {.msk = 0x00000080U, .pos = 7};  /** @brief TXE. */
+static const field32_t LPUART1_ISR_TC          = {.msk = 0x00000040U, .pos = 6};  /** @brief TC. */
+static const field32_t LPUART1_ISR_RXNE        = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE. */
+static const field32_t LPUART1_ISR_IDLE        = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE. */
+static const field32_t LPUART1_ISR_ORE         = {.msk = 0x00000008U, .pos = 3};  /** @brief ORE. */
+static const field32_t LPUART1_ISR_NE          = {.msk = 0x00000004U, .pos = 2};  /** @brief NE. */
+static const field32_t LPUART1_ISR_FE          = {.msk = 0x00000002U, .pos = 1};  /** @brief FE. */
+static const field32_t LPUART1_ISR_PE          = {.msk = 0x00000001U, .pos = 0};  /** @brief PE. */
+static const field32_t LPUART1_ICR_WUCF        = {.msk = 0x00100000U, .pos = 20}; /** @brief Wakeup from Stop mode clear flag. */
+static const field32_t LPUART1_ICR_CMCF        = {.msk = 0x00020000U, .pos = 17}; /** @brief Character match clear flag. */
+static const field32_t LPUART1_ICR_CTSCF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS clear flag. */
+static const field32_t LPUART1_ICR_TCCF        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete clear flag. */
+static const field32_t LPUART1_ICR_IDLECF      = {.msk = 0x00000010U, .pos = 4};  /** @brief Idle line detected clear flag. */
+static const field32_t LPUART1_ICR_ORECF       = {.msk = 0x00000008U, .pos = 3};  /** @brief Overrun error clear flag. */
+static const field32_t LPUART1_ICR_NCF         = {.msk = 0x00000004U, .pos = 2};  /** @brief Noise detected clear flag. */
+static const field32_t LPUART1_ICR_FECF        = {.msk = 0x00000002U, .pos = 1};  /** @brief Framing error clear flag. */
+static const field32_t LPUART1_ICR_PECF        = {.msk = 0x00000001U, .pos = 0};  /** @brief Parity error clear flag. */
+static const field32_t LPUART1_RDR_RDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Receive data value. */
+static const field32_t LPUART1_TDR_TDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Transmit data value. */
+static const field32_t LPUART1_PRESC_PRESCALER = {.msk = 0x0000000FU, .pos = 0};  /** @brief Clock prescaler. */
+
+/** @subsection Enumerated LPUART1 Register Field Definitions */
+
+/** @brief Word length. */
+static const field32_t LPUART1_CR1_Mx[2] = {
+  [0] = {.msk = 0x00001000U, .pos = 12},
+  [1] = {.msk = 0x10000000U, .pos = 28},
+};
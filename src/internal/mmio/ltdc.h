@@ -0,0 +1,200 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/ltdc.h
+ * @authors UW SARP
+ * @brief Registers and fields of LTDC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section LTDC Definitions
+ **************************************************************************************************/
+
+/** @subsection LTDC Register Definitions */
+
+static rw_reg32_t const LTDC_SSCR  = (rw_reg32_t)0x50001008U; /** @brief Synchronization Size Configuration Register. */
+static rw_reg32_t const LTDC_BPCR  = (rw_reg32_t)0x5000100CU; /** @brief Back Porch Configuration Register. */
+static rw_reg32_t const LTDC_AWCR  = (rw_reg32_t)0x50001010U; /** @brief Active Width Configuration Register. */
+static rw_reg32_t const LTDC_TWCR  = (rw_reg32_t)0x50001014U; /** @brief Total Width Configuration Register. */
+static rw_reg32_t const LTDC_GCR   = (rw_reg32_t)0x50001018U; /** @brief Global Control Register. */
+static rw_reg32_t const LTDC_SRCR  = (rw_reg32_t)0x50001024U; /** @brief Shadow Reload Configuration Register. */
+static rw_reg32_t const LTDC_BCCR  = (rw_reg32_t)0x5000102CU; /** @brief Background Color Configuration Register. */
+static rw_reg32_t const LTDC_IER   = (rw_reg32_t)0x50001034U; /** @brief Interrupt Enable Register. */
+static ro_reg32_t const LTDC_ISR   = (ro_reg32_t)0x50001038U; /** @brief Interrupt Status Register. */
+static rw_reg32_t const LTDC_ICR   = (rw_reg32_t)0x5000103CU; /** @brief Interrupt Clear Register. */
+static rw_reg32_t const LTDC_LIPCR = (rw_reg32_t)0x50001040U; /** @brief Line Interrupt Position Configuration Register. */
+static ro_reg32_t const LTDC_CPSR  = (ro_reg32_t)0x50001044U; /** @brief Current Position Status Register. */
+static ro_reg32_t const LTDC_CDSR  = (ro_reg32_t)0x50001048U; /** @brief Current Display Status Register. */
+
+/** @subsection Enumerated LTDC Register Definitions */
+
+/** @brief Layerx Control Register. */
+static rw_reg32_t const LTDC_LxCR[3] = {
+  [1] = (rw_reg32_t)0x50001084U,
+  [2] = (rw_reg32_t)0x50001104U,
+};
+
+/** @brief Layerx Window Horizontal Position Configuration Register. */
+static rw_reg32_t const LTDC_LxWHPCR[3] = {
+  [1] = (rw_reg32_t)0x50001088U,
+  [2] = (rw_reg32_t)0x50001108U,
+};
+
+/** @brief Layerx Window Vertical Position Configuration Register. */
+static rw_reg32_t const LTDC_LxWVPCR[3] = {
+  [1] = (rw_reg32_t)0x5000108CU,
+  [2] = (rw_reg32_t)0x5000110CU,
+};
+
+/** @brief Layerx Color Keying Configuration Register. */
+static rw_reg32_t const LTDC_LxCKCR[3] = {
+  [1] = (rw_reg32_t)0x50001090U,
+  [2] = (rw_reg32_t)0x50001110U,
+};
+
+/** @brief Layerx Pixel Format Configuration Register. */
+static rw_reg32_t const LTDC_LxPFCR[3] = {
+  [1] = (rw_reg32_t)0x50001094U,
+  [2] = (rw_reg32_t)0x50001114U,
+};
+
+/** @brief Layerx Constant Alpha Configuration Register. */
+static rw_reg32_t const LTDC_LxCACR[3] = {
+  [1] = (rw_reg32_t)0x50001098U,
+  [2] = (rw_reg32_t)0x50001118U,
+};
+
+/** @brief Layerx Default Color Configuration Register. */
+static rw_reg32_t const LTDC_LxDCCR[3] = {
+  [1] = (rw_reg32_t)0x5000109CU,
+  [2] = (rw_reg32_t)0x5000111CU,
+};
+
+/** @brief Layerx Blending Factors Configuration Register. */
+static rw_reg32_t const LTDC_LxBFCR[3] = {
+  [1] = (rw_reg32_t)0x500010A0U,
+  [2] = (rw_reg32_t)0x50001120U,
+};
+
+/** @brief Layerx Color Frame Buffer Address Register. */
+static rw_reg32_t const LTDC_LxCFBAR[3] = {
+  [1] = (rw_reg32_t)0x500010ACU,
+  [2] = (rw_reg32_t)0x5000112CU,
+};
+
+/** @brief Layerx Color Frame Buffer Length Register. */
+static rw_reg32_t const LTDC_LxCFBLR[3] = {
+  [1] = (rw_reg32_t)0x500010B0U,
+  [2] = (rw_reg32_t)0x50001130U,
+};
+
+/** @brief Layerx ColorFrame Buffer Line Number Register. */
+static rw_reg32_t const LTDC_LxCFBLNR[3] = {
+  [1] = (rw_reg32_t)0x500010B4U,
+  [2] = (rw_reg32_t)0x50001134U,
+};
+
+/** @brief Layerx CLUT Write Register. */
+static rw_reg32_t const LTDC_LxCLUTWR[3] = {
+  [1] = (rw_reg32_t)0x500010C4U,
+  [2] = (rw_reg32_t)0x50001144U,
+};
+
+/** @subsection LTDC Register Field Definitions */
+
+static const field32_t LTDC_SSCR_HSW         = {.msk = 0x03FF0000U, .pos = 16}; /** @brief Horizontal Synchronization Width (in units of pixel clock period). */
+static const field32_t LTDC_SSCR_VSH         = {.msk = 0x000007FFU, .pos = 0};  /** @brief Vertical Synchronization Height (in units of horizontal scan line). */
+static const field32_t LTDC_BPCR_AHBP        = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Accumulated Horizontal back porch (in units of pixel clock period). */
+static const field32_t LTDC_BPCR_AVBP        = {.msk = 0x000007FFU, .pos = 0};  /** @brief Accumulated Vertical back porch (in units of horizontal scan line). */
+static const field32_t LTDC_AWCR_AAV         = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief AAV. */
+static const field32_t LTDC_AWCR_AAH         = {.msk = 0x000007FFU, .pos = 0};  /** @brief Accumulated Active Height (in units of horizontal scan line). */
+static const field32_t LTDC_TWCR_TOTALW      = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Total Width (in units of pixel clock period). */
+static const field32_t LTDC_TWCR_TOTALH      = {.msk = 0x000007FFU, .pos = 0};  /** @brief Total Height (in units of horizontal scan line). */
+static const field32_t LTDC_GCR_HSPOL        = {.msk = 0x80000000U, .pos = 31}; /** @brief Horizontal Synchronization Polarity. */
+static const field32_t LTDC_GCR_VSPOL        = {.msk = 0x40000000U, .pos = 30}; /** @brief Vertical Synchronization Polarity. */
+static const field32_t LTDC_GCR_DEPOL        = {.msk = 0x20000000U, .pos = 29}; /** @brief Data Enable Polarity. */
+static const field32_t LTDC_GCR_PCPOL        = {.msk = 0x10000000U, .pos = 28}; /** @brief Pixel Clock Polarity. */
+static const field32_t LTDC_GCR_DEN          = {.msk = 0x00010000U, .pos = 16}; /** @brief Dither Enable. */
+static const field32_t LTDC_GCR_DRW          = {.msk = 0x00007000U, .pos = 12}; /** @brief Dither Red Width. */
+static const field32_t LTDC_GCR_DGW          = {.msk = 0x00000700U, .pos = 8};  /** @brief Dither Green Width. */
+static const field32_t LTDC_GCR_DBW          = {.msk = 0x00000070U, .pos = 4};  /** @brief Dither Blue Width. */
+static const field32_t LTDC_GCR_LTDCEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief LCD-TFT controller enable bit. */
+static const field32_t LTDC_SRCR_VBR         = {.msk = 0x00000002U, .pos = 1};  /** @brief Vertical Blanking Reload. */
+static const field32_t LTDC_SRCR_IMR         = {.msk = 0x00000001U, .pos = 0};  /** @brief Immediate Reload. */
+static const field32_t LTDC_BCCR_BCBLUE      = {.msk = 0x000000FFU, .pos = 0};  /** @brief Background Color Blue value. */
+static const field32_t LTDC_BCCR_BCGREEN     = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Background Color Green value. */
+static const field32_t LTDC_BCCR_BCRED       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Background Color Red value. */
+static const field32_t LTDC_IER_RRIE         = {.msk = 0x00000008U, .pos = 3};  /** @brief Register Reload interrupt enable. */
+static const field32_t LTDC_IER_TERRIE       = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer Error Interrupt Enable. */
+static const field32_t LTDC_IER_FUIE         = {.msk = 0x00000002U, .pos = 1};  /** @brief FIFO Underrun Interrupt Enable. */
+static const field32_t LTDC_IER_LIE          = {.msk = 0x00000001U, .pos = 0};  /** @brief Line Interrupt Enable. */
+static const field32_t LTDC_ISR_RRIF         = {.msk = 0x00000008U, .pos = 3};  /** @brief Register Reload Interrupt Flag. */
+static const field32_t LTDC_ISR_TERRIF       = {.msk = 0x00000004U, .pos = 2};  /** @brief Transfer Error interrupt flag. */
+static const field32_t LTDC_ISR_FUIF         = {.msk = 0x00000002U, .pos = 1};  /** @brief FIFO Underrun Interrupt flag. */
+static const field32_t LTDC_ISR_LIF          = {.msk = 0x00000001U, .pos = 0};  /** @brief Line Interrupt flag. */
+static const field32_t LTDC_ICR_CRRIF        = {.msk = 0x00000008U, .pos = 3};  /** @brief Clears Register Reload Interrupt Flag. */
+static const field32_t LTDC_ICR_CTERRIF      = {.msk = 0x00000004U, .pos = 2};  /** @brief Clears the Transfer Error Interrupt Flag. */
+static const field32_t LTDC_ICR_CFUIF        = {.msk = 0x00000002U, .pos = 1};  /** @brief Clears the FIFO Underrun Interrupt flag. */
+static const field32_t LTDC_ICR_CLIF         = {.msk = 0x00000001U, .pos = 0};  /** @brief Clears the Line Interrupt Flag. */
+static const field32_t LTDC_LIPCR_LIPOS      = {.msk = 0x000007FFU, .pos = 0};  /** @brief Line Interrupt Position. */
+static const field32_t LTDC_CPSR_CXPOS       = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Current X Position. */
+static const field32_t LTDC_CPSR_CYPOS       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Current Y Position. */
+static const field32_t LTDC_CDSR_HSYNCS      = {.msk = 0x00000008U, .pos = 3};  /** @brief Horizontal Synchronization display Status. */
+static const field32_t LTDC_CDSR_VSYNCS      = {.msk = 0x00000004U, .pos = 2};  /** @brief Vertical Synchronization display Status. */
+static const field32_t LTDC_CDSR_HDES        = {.msk = 0x00000002U, .pos = 1};  /** @brief Horizontal Data Enable display Status. */
+static const field32_t LTDC_CDSR_VDES        = {.msk = 0x00000001U, .pos = 0};  /** @brief Vertical Data Enable display Status. */
+static const field32_t LTDC_LxCR_CLUTEN      = {.msk = 0x00000010U, .pos = 4};  /** @brief Color Look-Up Table Enable. */
+static const field32_t LTDC_LxCR_COLKEN      = {.msk = 0x00000002U, .pos = 1};  /** @brief Color Keying Enable. */
+static const field32_t LTDC_LxCR_LEN         = {.msk = 0x00000001U, .pos = 0};  /** @brief Layer Enable. */
+static const field32_t LTDC_LxWHPCR_WHSPPOS  = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Window Horizontal Stop Position. */
+static const field32_t LTDC_LxWHPCR_WHSTPOS  = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Window Horizontal Start Position. */
+static const field32_t LTDC_LxWVPCR_WVSPPOS  = {.msk = 0x07FF0000U, .pos = 16}; /** @brief Window Vertical Stop Position. */
+static const field32_t LTDC_LxWVPCR_WVSTPOS  = {.msk = 0x000007FFU, .pos = 0};  /** @brief Window Vertical Start Position. */
+static const field32_t LTDC_LxCKCR_CKRED     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Color Key Red value. */
+static const field32_t LTDC_LxCKCR_CKGREEN   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Color Key Green value. */
+static const field32_t LTDC_LxCKCR_CKBLUE    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Color Key Blue value. */
+static const field32_t LTDC_LxPFCR_PF        = {.msk = 0x00000007U, .pos = 0};  /** @brief Pixel Format. */
+static const field32_t LTDC_LxCACR_CONSTA    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Constant Alpha. */
+static const field32_t LTDC_LxDCCR_DCALPHA   = {.msk = 0xFF000000U, .pos = 24}; /** @brief Default Color Alpha. */
+static const field32_t LTDC_LxDCCR_DCRED     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Default Color Red. */
+static const field32_t LTDC_LxDCCR_DCGREEN   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Default Color Green. */
+static const field32_t LTDC_LxDCCR_DCBLUE    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Default Color Blue. */
+static const field32_t LTDC_LxBFCR_BF1       = {.msk = 0x00000700U, .pos = 8};  /** @brief Blending Factor 1. */
+static const field32_t LTDC_LxBFCR_BF2       = {.msk = 0x00000007U, .pos = 0};  /** @brief Blending Factor 2. */
+static const field32_t LTDC_LxCFBLR_CFBP     = {.msk = 0x1FFF0000U, .pos = 16}; /** @brief Color Frame Buffer Pitch in bytes. */
+static const field32_t LTDC_LxCFBLR_CFBLL    = {.msk = 0x00001FFFU, .pos = 0};  /** @brief Color Frame Buffer Line Length. */
+static const field32_t LTDC_LxCFBLNR_CFBLNBR = {.msk = 0x000007FFU, .pos = 0};  /** @brief Frame Buffer Line Number. */
+static const field32_t LTDC_LxCLUTWR_CLUTADD = {.msk = 0xFF000000U, .pos = 24}; /** @brief CLUT Address. */
+static const field32_t LTDC_LxCLUTWR_RED     = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Red value. */
+static const field32_t LTDC_LxCLUTWR_GREEN   = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Green value. */
+static const field32_t LTDC_LxCLUTWR_BLUE    = {.msk = 0x000000FFU, .pos = 0};  /** @brief Blue value. */
+
+/** @subsection Enumerated LTDC Register Field Definitions */
+
+/** @brief Blending Factor 1. */
+static const field32_t LTDC_LxBFCR_BFx[3] = {
+  [1] = {.msk = 0x00000700U, .pos = 8},
+  [2] = {.msk = 0x00000007U, .pos = 0},
+};
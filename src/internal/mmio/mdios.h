@@ -0,0 +1,186 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/mdios.h
+ * @authors UW SARP
+ * @brief Registers and fields of MDIOS.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section MDIOS Definitions
+ **************************************************************************************************/
+
+/** @subsection MDIOS Register Definitions */
+
+static rw_reg32_t const MDIOS_MDIOS_CR      = (rw_reg32_t)0x40009400U; /** @brief MDIOS configuration register. */
+static ro_reg32_t const MDIOS_MDIOS_WRFR    = (ro_reg32_t)0x40009404U; /** @brief MDIOS write flag register. */
+static rw_reg32_t const MDIOS_MDIOS_CWRFR   = (rw_reg32_t)0x40009408U; /** @brief MDIOS clear write flag register. */
+static ro_reg32_t const MDIOS_MDIOS_RDFR    = (ro_reg32_t)0x4000940CU; /** @brief MDIOS read flag register. */
+static rw_reg32_t const MDIOS_MDIOS_CRDFR   = (rw_reg32_t)0x40009410U; /** @brief MDIOS clear read flag register. */
+static ro_reg32_t const MDIOS_MDIOS_SR      = (ro_reg32_t)0x40009414U; /** @brief MDIOS status register. */
+static rw_reg32_t const MDIOS_MDIOS_CLRFR   = (rw_reg32_t)0x40009418U; /** @brief MDIOS clear flag register. */
+static ro_reg32_t const MDIOS_MDIOS_DINR0   = (ro_reg32_t)0x4000941CU; /** @brief MDIOS input data register 0. */
+static ro_reg32_t const MDIOS_MDIOS_DINR1   = (ro_reg32_t)0x40009420U; /** @brief MDIOS input data register 1. */
+static ro_reg32_t const MDIOS_MDIOS_DINR2   = (ro_reg32_t)0x40009424U; /** @brief MDIOS input data register 2. */
+static ro_reg32_t const MDIOS_MDIOS_DINR3   = (ro_reg32_t)0x40009428U; /** @brief MDIOS input data register 3. */
+static ro_reg32_t const MDIOS_MDIOS_DINR4   = (ro_reg32_t)0x4000942CU; /** @brief MDIOS input data register 4. */
+static ro_reg32_t const MDIOS_MDIOS_DINR5   = (ro_reg32_t)0x40009430U; /** @brief MDIOS input data register 5. */
+static ro_reg32_t const MDIOS_MDIOS_DINR6   = (ro_reg32_t)0x40009434U; /** @brief MDIOS input data register 6. */
+static ro_reg32_t const MDIOS_MDIOS_DINR7   = (ro_reg32_t)0x40009438U; /** @brief MDIOS input data register 7. */
+static ro_reg32_t const MDIOS_MDIOS_DINR8   = (ro_reg32_t)0x4000943CU; /** @brief MDIOS input data register 8. */
+static ro_reg32_t const MDIOS_MDIOS_DINR9   = (ro_reg32_t)0x40009440U; /** @brief MDIOS input data register 9. */
+static ro_reg32_t const MDIOS_MDIOS_DINR10  = (ro_reg32_t)0x40009444U; /** @brief MDIOS input data register 10. */
+static ro_reg32_t const MDIOS_MDIOS_DINR11  = (ro_reg32_t)0x40009448U; /** @brief MDIOS input data register 11. */
+static ro_reg32_t const MDIOS_MDIOS_DINR12  = (ro_reg32_t)0x4000944CU; /** @brief MDIOS input data register 12. */
+static ro_reg32_t const MDIOS_MDIOS_DINR13  = (ro_reg32_t)0x40009450U; /** @brief MDIOS input data register 13. */
+static ro_reg32_t const MDIOS_MDIOS_DINR14  = (ro_reg32_t)0x40009454U; /** @brief MDIOS input data register 14. */
+static ro_reg32_t const MDIOS_MDIOS_DINR15  = (ro_reg32_t)0x40009458U; /** @brief MDIOS input data register 15. */
+static ro_reg32_t const MDIOS_MDIOS_DINR16  = (ro_reg32_t)0x4000945CU; /** @brief MDIOS input data register 16. */
+static ro_reg32_t const MDIOS_MDIOS_DINR17  = (ro_reg32_t)0x40009460U; /** @brief MDIOS input data register 17. */
+static ro_reg32_t const MDIOS_MDIOS_DINR18  = (ro_reg32_t)0x40009464U; /** @brief MDIOS input data register 18. */
+static ro_reg32_t const MDIOS_MDIOS_DINR19  = (ro_reg32_t)0x40009468U; /** @brief MDIOS input data register 19. */
+static ro_reg32_t const MDIOS_MDIOS_DINR20  = (ro_reg32_t)0x4000946CU; /** @brief MDIOS input data register 20. */
+static ro_reg32_t const MDIOS_MDIOS_DINR21  = (ro_reg32_t)0x40009470U; /** @brief MDIOS input data register 21. */
+static ro_reg32_t const MDIOS_MDIOS_DINR22  = (ro_reg32_t)0x40009474U; /** @brief MDIOS input data register 22. */
+static ro_reg32_t const MDIOS_MDIOS_DINR23  = (ro_reg32_t)0x40009478U; /** @brief MDIOS input data register 23. */
+static ro_reg32_t const MDIOS_MDIOS_DINR24  = (ro_reg32_t)0x4000947CU; /** @brief MDIOS input data register 24. */
+static ro_reg32_t const MDIOS_MDIOS_DINR25  = (ro_reg32_t)0x40009480U; /** @brief MDIOS input data register 25. */
+static ro_reg32_t const MDIOS_MDIOS_DINR26  = (ro_reg32_t)0x40009484U; /** @brief MDIOS input data register 26. */
+static ro_reg32_t const MDIOS_MDIOS_DINR27  = (ro_reg32_t)0x40009488U; /** @brief MDIOS input data register 27. */
+static ro_reg32_t const MDIOS_MDIOS_DINR28  = (ro_reg32_t)0x4000948CU; /** @brief MDIOS input data register 28. */
+static ro_reg32_t const MDIOS_MDIOS_DINR29  = (ro_reg32_t)0x40009490U; /** @brief MDIOS input data register 29. */
+static ro_reg32_t const MDIOS_MDIOS_DINR30  = (ro_reg32_t)0x40009494U; /** @brief MDIOS input data register 30. */
+static ro_reg32_t const MDIOS_MDIOS_DINR31  = (ro_reg32_t)0x40009498U; /** @brief MDIOS input data register 31. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR0  = (rw_reg32_t)0x4000949CU; /** @brief MDIOS output data register 0. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR1  = (rw_reg32_t)0x400094A0U; /** @brief MDIOS output data register 1. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR2  = (rw_reg32_t)0x400094A4U; /** @brief MDIOS output data register 2. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR3  = (rw_reg32_t)0x400094A8U; /** @brief MDIOS output data register 3. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR4  = (rw_reg32_t)0x400094ACU; /** @brief MDIOS output data register 4. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR5  = (rw_reg32_t)0x400094B0U; /** @brief MDIOS output data register 5. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR6  = (rw_reg32_t)0x400094B4U; /** @brief MDIOS output data register 6. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR7  = (rw_reg32_t)0x400094B8U; /** @brief MDIOS output data register 7. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR8  = (rw_reg32_t)0x400094BCU; /** @brief MDIOS output data register 8. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR9  = (rw_reg32_t)0x400094C0U; /** @brief MDIOS output data register 9. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR10 = (rw_reg32_t)0x400094C4U; /** @brief MDIOS output data register 10. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR11 = (rw_reg32_t)0x400094C8U; /** @brief MDIOS output data register 11. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR12 = (rw_reg32_t)0x400094CCU; /** @brief MDIOS output data register 12. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR13 = (rw_reg32_t)0x400094D0U; /** @brief MDIOS output data register 13. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR14 = (rw_reg32_t)0x400094D4U; /** @brief MDIOS output data register 14. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR15 = (rw_reg32_t)0x400094D8U; /** @brief MDIOS output data register 15. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR16 = (rw_reg32_t)0x400094DCU; /** @brief MDIOS output data register 16. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR17 = (rw_reg32_t)0x400094E0U; /** @brief MDIOS output data register 17. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR18 = (rw_reg32_t)0x400094E4U; /** @brief MDIOS output data register 18. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR19 = (rw_reg32_t)0x400094E8U; /** @brief MDIOS output data register 19. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR20 = (rw_reg32_t)0x400094ECU; /** @brief MDIOS output data register 20. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR21 = (rw_reg32_t)0x400094F0U; /** @brief MDIOS output data register 21. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR22 = (rw_reg32_t)0x400094F4U; /** @brief MDIOS output data register 22. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR23 = (rw_reg32_t)0x400094F8U; /** @brief MDIOS output data register 23. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR24 = (rw_reg32_t)0x400094FCU; /** @brief MDIOS output data register 24. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR25 = (rw_reg32_t)0x40009500U; /** @brief MDIOS output data register 25. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR26 = (rw_reg32_t)0x40009504U; /** @brief MDIOS output data register 26. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR27 = (rw_reg32_t)0x40009508U; /** @brief MDIOS output data register 27. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR28 = (rw_reg32_t)0x4000950CU; /** @brief MDIOS output data register 28. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR29 = (rw_reg32_t)0x40009510U; /** @brief MDIOS output data register 29. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR30 = (rw_reg32_t)0x40009514U; /** @brief MDIOS output data register 30. */
+static rw_reg32_t const MDIOS_MDIOS_DOUTR31 = (rw_reg32_t)0x40009518U; /** @brief MDIOS output data register 31. */
+
+/** @subsection MDIOS Register Field Definitions */
+
+static const field32_t MDIOS_MDIOS_CR_EN           = {.msk = 0x00000001U, .pos = 0}; /** @brief Peripheral enable. */
+static const field32_t MDIOS_MDIOS_CR_WRIE         = {.msk = 0x00000002U, .pos = 1}; /** @brief Register write interrupt enable. */
+static const field32_t MDIOS_MDIOS_CR_RDIE         = {.msk = 0x00000004U, .pos = 2}; /** @brief Register Read Interrupt Enable. */
+static const field32_t MDIOS_MDIOS_CR_EIE          = {.msk = 0x00000008U, .pos = 3}; /** @brief Error interrupt enable. */
+static const field32_t MDIOS_MDIOS_CR_DPC          = {.msk = 0x00000080U, .pos = 7}; /** @brief Disable Preamble Check. */
+static const field32_t MDIOS_MDIOS_CR_PORT_ADDRESS = {.msk = 0x00001F00U, .pos = 8}; /** @brief Slaves's address. */
+static const field32_t MDIOS_MDIOS_SR_PERF         = {.msk = 0x00000001U, .pos = 0}; /** @brief Preamble error flag. */
+static const field32_t MDIOS_MDIOS_SR_SERF         = {.msk = 0x00000002U, .pos = 1}; /** @brief Start error flag. */
+static const field32_t MDIOS_MDIOS_SR_TERF         = {.msk = 0x00000004U, .pos = 2}; /** @brief Turnaround error flag. */
+static const field32_t MDIOS_MDIOS_CLRFR_CPERF     = {.msk = 0x00000001U, .pos = 0}; /** @brief Clear the preamble error flag. */
+static const field32_t MDIOS_MDIOS_CLRFR_CSERF     = {.msk = 0x00000002U, .pos = 1}; /** @brief Clear the start error flag. */
+static const field32_t MDIOS_MDIOS_CLRFR_CTERF     = {.msk = 0x00000004U, .pos = 2}; /** @brief Clear the turnaround error flag. */
+static const field32_t MDIOS_MDIOS_DINR0_DIN0      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR1_DIN1      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR2_DIN2      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR3_DIN3      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR4_DIN4      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR5_DIN5      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR6_DIN6      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR7_DIN7      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR8_DIN8      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR9_DIN9      = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR10_DIN10    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR11_DIN11    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR12_DIN12    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR13_DIN13    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR14_DIN14    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR15_DIN15    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR16_DIN16    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR17_DIN17    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR18_DIN18    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR19_DIN19    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR20_DIN20    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR21_DIN21    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR22_DIN22    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR23_DIN23    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR24_DIN24    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR25_DIN25    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR26_DIN26    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR27_DIN27    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR28_DIN28    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR29_DIN29    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR30_DIN30    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DINR31_DIN31    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Input data received from MDIO Master during write frames. */
+static const field32_t MDIOS_MDIOS_DOUTR0_DOUT0    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR1_DOUT1    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR2_DOUT2    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR3_DOUT3    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR4_DOUT4    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR5_DOUT5    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR6_DOUT6    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR7_DOUT7    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR8_DOUT8    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR9_DOUT9    = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR10_DOUT10  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR11_DOUT11  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR12_DOUT12  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR13_DOUT13  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR14_DOUT14  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR15_DOUT15  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR16_DOUT16  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR17_DOUT17  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR18_DOUT18  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR19_DOUT19  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR20_DOUT20  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR21_DOUT21  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR22_DOUT22  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR23_DOUT23  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR24_DOUT24  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR25_DOUT25  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR26_DOUT26  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR27_DOUT27  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR28_DOUT28  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR29_DOUT29  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR30_DOUT30  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
+static const field32_t MDIOS_MDIOS_DOUTR31_DOUT31  = {.msk = 0x0000FFFFU, .pos = 0}; /** @brief Output data sent to MDIO Master during read frames. */
@@ -0,0 +1,548 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/mdma.h
+ * @authors UW SARP
+ * @brief Registers and fields of MDMA.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section MDMA Definitions
+ **************************************************************************************************/
+
+/** @subsection MDMA Register Definitions */
+
+static ro_reg32_t const MDMA_MDMA_GISR0   = (ro_reg32_t)0x52000000U; /** @brief MDMA Global Interrupt/Status Register. */
+static ro_reg32_t const MDMA_MDMA_C0ISR   = (ro_reg32_t)0x52000040U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C0IFCR  = (rw_reg32_t)0x52000044U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C1ISR   = (ro_reg32_t)0x52000080U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C1IFCR  = (rw_reg32_t)0x52000084U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C2ISR   = (ro_reg32_t)0x520000C0U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C2IFCR  = (rw_reg32_t)0x520000C4U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C3ISR   = (ro_reg32_t)0x52000100U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C3IFCR  = (rw_reg32_t)0x52000104U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C4ISR   = (ro_reg32_t)0x52000140U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C4IFCR  = (rw_reg32_t)0x52000144U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C5ISR   = (ro_reg32_t)0x52000180U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C5IFCR  = (rw_reg32_t)0x52000184U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C6ISR   = (ro_reg32_t)0x520001C0U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C6IFCR  = (rw_reg32_t)0x520001C4U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C7ISR   = (ro_reg32_t)0x52000200U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C7IFCR  = (rw_reg32_t)0x52000204U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C8ISR   = (ro_reg32_t)0x52000240U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C8IFCR  = (rw_reg32_t)0x52000244U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C9ISR   = (ro_reg32_t)0x52000280U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C9IFCR  = (rw_reg32_t)0x52000284U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C10ISR  = (ro_reg32_t)0x520002C0U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C10IFCR = (rw_reg32_t)0x520002C4U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C11ISR  = (ro_reg32_t)0x52000300U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C11IFCR = (rw_reg32_t)0x52000304U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C12ISR  = (ro_reg32_t)0x52000340U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C12IFCR = (rw_reg32_t)0x52000344U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C13ISR  = (ro_reg32_t)0x52000380U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C13IFCR = (rw_reg32_t)0x52000384U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C14ISR  = (ro_reg32_t)0x520003C0U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C14IFCR = (rw_reg32_t)0x520003C4U; /** @brief MDMA channel x interrupt flag clear register. */
+static ro_reg32_t const MDMA_MDMA_C15ISR  = (ro_reg32_t)0x52000400U; /** @brief MDMA channel x interrupt/status register. */
+static rw_reg32_t const MDMA_MDMA_C15IFCR = (rw_reg32_t)0x52000404U; /** @brief MDMA channel x interrupt flag clear register. */
+
+/** @subsection Enumerated MDMA Register Definitions */
+
+/** @brief MDMA Channel x error status register. */
+static ro_reg32_t const MDMA_MDMA_CxESR[16] = {
+  [0]  = (ro_reg32_t)0x52000048U,
+  [1]  = (ro_reg32_t)0x52000088U,
+  [2]  = (ro_reg32_t)0x520000C8U,
+  [3]  = (ro_reg32_t)0x52000108U,
+  [4]  = (ro_reg32_t)0x52000148U,
+  [5]  = (ro_reg32_t)0x52000188U,
+  [6]  = (ro_reg32_t)0x520001C8U,
+  [7]  = (ro_reg32_t)0x52000208U,
+  [8]  = (ro_reg32_t)0x52000248U,
+  [9]  = (ro_reg32_t)0x52000288U,
+  [10] = (ro_reg32_t)0x520002C8U,
+  [11] = (ro_reg32_t)0x52000308U,
+  [12] = (ro_reg32_t)0x52000348U,
+  [13] = (ro_reg32_t)0x52000388U,
+  [14] = (ro_reg32_t)0x520003C8U,
+  [15] = (ro_reg32_t)0x52000408U,
+};
+
+/** @brief This register is used to control the concerned channel. */
+static rw_reg32_t const MDMA_MDMA_CxCR[16] = {
+  [0]  = (rw_reg32_t)0x5200004CU,
+  [1]  = (rw_reg32_t)0x5200008CU,
+  [2]  = (rw_reg32_t)0x520000CCU,
+  [3]  = (rw_reg32_t)0x5200010CU,
+  [4]  = (rw_reg32_t)0x5200014CU,
+  [5]  = (rw_reg32_t)0x5200018CU,
+  [6]  = (rw_reg32_t)0x520001CCU,
+  [7]  = (rw_reg32_t)0x5200020CU,
+  [8]  = (rw_reg32_t)0x5200024CU,
+  [9]  = (rw_reg32_t)0x5200028CU,
+  [10] = (rw_reg32_t)0x520002CCU,
+  [11] = (rw_reg32_t)0x5200030CU,
+  [12] = (rw_reg32_t)0x5200034CU,
+  [13] = (rw_reg32_t)0x5200038CU,
+  [14] = (rw_reg32_t)0x520003CCU,
+  [15] = (rw_reg32_t)0x5200040CU,
+};
+
+/** @brief This register is used to configure the concerned channel. */
+static rw_reg32_t const MDMA_MDMA_CxTCR[16] = {
+  [0]  = (rw_reg32_t)0x52000050U,
+  [1]  = (rw_reg32_t)0x52000090U,
+  [2]  = (rw_reg32_t)0x520000D0U,
+  [3]  = (rw_reg32_t)0x52000110U,
+  [4]  = (rw_reg32_t)0x52000150U,
+  [5]  = (rw_reg32_t)0x52000190U,
+  [6]  = (rw_reg32_t)0x520001D0U,
+  [7]  = (rw_reg32_t)0x52000210U,
+  [8]  = (rw_reg32_t)0x52000250U,
+  [9]  = (rw_reg32_t)0x52000290U,
+  [10] = (rw_reg32_t)0x520002D0U,
+  [11] = (rw_reg32_t)0x52000310U,
+  [12] = (rw_reg32_t)0x52000350U,
+  [13] = (rw_reg32_t)0x52000390U,
+  [14] = (rw_reg32_t)0x520003D0U,
+  [15] = (rw_reg32_t)0x52000410U,
+};
+
+/** @brief MDMA Channel x block number of data register. */
+static rw_reg32_t const MDMA_MDMA_CxBNDTR[16] = {
+  [0]  = (rw_reg32_t)0x52000054U,
+  [1]  = (rw_reg32_t)0x52000094U,
+  [2]  = (rw_reg32_t)0x520000D4U,
+  [3]  = (rw_reg32_t)0x52000114U,
+  [4]  = (rw_reg32_t)0x52000154U,
+  [5]  = (rw_reg32_t)0x52000194U,
+  [6]  = (rw_reg32_t)0x520001D4U,
+  [7]  = (rw_reg32_t)0x52000214U,
+  [8]  = (rw_reg32_t)0x52000254U,
+  [9]  = (rw_reg32_t)0x52000294U,
+  [10] = (rw_reg32_t)0x520002D4U,
+  [11] = (rw_reg32_t)0x52000314U,
+  [12] = (rw_reg32_t)0x52000354U,
+  [13] = (rw_reg32_t)0x52000394U,
+  [14] = (rw_reg32_t)0x520003D4U,
+  [15] = (rw_reg32_t)0x52000414U,
+};
+
+/** @brief MDMA channel x source address register. */
+static rw_reg32_t const MDMA_MDMA_CxSAR[16] = {
+  [0]  = (rw_reg32_t)0x52000058U,
+  [1]  = (rw_reg32_t)0x52000098U,
+  [2]  = (rw_reg32_t)0x520000D8U,
+  [3]  = (rw_reg32_t)0x52000118U,
+  [4]  = (rw_reg32_t)0x52000158U,
+  [5]  = (rw_reg32_t)0x52000198U,
+  [6]  = (rw_reg32_t)0x520001D8U,
+  [7]  = (rw_reg32_t)0x52000218U,
+  [8]  = (rw_reg32_t)0x52000258U,
+  [9]  = (rw_reg32_t)0x52000298U,
+  [10] = (rw_reg32_t)0x520002D8U,
+  [11] = (rw_reg32_t)0x52000318U,
+  [12] = (rw_reg32_t)0x52000358U,
+  [13] = (rw_reg32_t)0x52000398U,
+  [14] = (rw_reg32_t)0x520003D8U,
+  [15] = (rw_reg32_t)0x52000418U,
+};
+
+/** @brief MDMA channel x destination address register. */
+static rw_reg32_t const MDMA_MDMA_CxDAR[16] = {
+  [0]  = (rw_reg32_t)0x5200005CU,
+  [1]  = (rw_reg32_t)0x5200009CU,
+  [2]  = (rw_reg32_t)0x520000DCU,
+  [3]  = (rw_reg32_t)0x5200011CU,
+  [4]  = (rw_reg32_t)0x5200015CU,
+  [5]  = (rw_reg32_t)0x5200019CU,
+  [6]  = (rw_reg32_t)0x520001DCU,
+  [7]  = (rw_reg32_t)0x5200021CU,
+  [8]  = (rw_reg32_t)0x5200025CU,
+  [9]  = (rw_reg32_t)0x5200029CU,
+  [10] = (rw_reg32_t)0x520002DCU,
+  [11] = (rw_reg32_t)0x5200031CU,
+  [12] = (rw_reg32_t)0x5200035CU,
+  [13] = (rw_reg32_t)0x5200039CU,
+  [14] = (rw_reg32_t)0x520003DCU,
+  [15] = (rw_reg32_t)0x5200041CU,
+};
+
+/** @brief MDMA channel x Block Repeat address Update register. */
+static rw_reg32_t const MDMA_MDMA_CxBRUR[16] = {
+  [0]  = (rw_reg32_t)0x52000060U,
+  [1]  = (rw_reg32_t)0x520000A0U,
+  [2]  = (rw_reg32_t)0x520000E0U,
+  [3]  = (rw_reg32_t)0x52000120U,
+  [4]  = (rw_reg32_t)0x52000160U,
+  [5]  = (rw_reg32_t)0x520001A0U,
+  [6]  = (rw_reg32_t)0x520001E0U,
+  [7]  = (rw_reg32_t)0x52000220U,
+  [8]  = (rw_reg32_t)0x52000260U,
+  [9]  = (rw_reg32_t)0x520002A0U,
+  [10] = (rw_reg32_t)0x520002E0U,
+  [11] = (rw_reg32_t)0x52000320U,
+  [12] = (rw_reg32_t)0x52000360U,
+  [13] = (rw_reg32_t)0x520003A0U,
+  [14] = (rw_reg32_t)0x520003E0U,
+  [15] = (rw_reg32_t)0x52000420U,
+};
+
+/** @brief MDMA channel x Link Address register. */
+static rw_reg32_t const MDMA_MDMA_CxLAR[16] = {
+  [0]  = (rw_reg32_t)0x52000064U,
+  [1]  = (rw_reg32_t)0x520000A4U,
+  [2]  = (rw_reg32_t)0x520000E4U,
+  [3]  = (rw_reg32_t)0x52000124U,
+  [4]  = (rw_reg32_t)0x52000164U,
+  [5]  = (rw_reg32_t)0x520001A4U,
+  [6]  = (rw_reg32_t)0x520001E4U,
+  [7]  = (rw_reg32_t)0x52000224U,
+  [8]  = (rw_reg32_t)0x52000264U,
+  [9]  = (rw_reg32_t)0x520002A4U,
+  [10] = (rw_reg32_t)0x520002E4U,
+  [11] = (rw_reg32_t)0x52000324U,
+  [12] = (rw_reg32_t)0x52000364U,
+  [13] = (rw_reg32_t)0x520003A4U,
+  [14] = (rw_reg32_t)0x520003E4U,
+  [15] = (rw_reg32_t)0x52000424U,
+};
+
+/** @brief MDMA channel x Trigger and Bus selection Register. */
+static rw_reg32_t const MDMA_MDMA_CxTBR[16] = {
+  [0]  = (rw_reg32_t)0x52000068U,
+  [1]  = (rw_reg32_t)0x520000A8U,
+  [2]  = (rw_reg32_t)0x520000E8U,
+  [3]  = (rw_reg32_t)0x52000128U,
+  [4]  = (rw_reg32_t)0x52000168U,
+  [5]  = (rw_reg32_t)0x520001A8U,
+  [6]  = (rw_reg32_t)0x520001E8U,
+  [7]  = (rw_reg32_t)0x52000228U,
+  [8]  = (rw_reg32_t)0x52000268U,
+  [9]  = (rw_reg32_t)0x520002A8U,
+  [10] = (rw_reg32_t)0x520002E8U,
+  [11] = (rw_reg32_t)0x52000328U,
+  [12] = (rw_reg32_t)0x52000368U,
+  [13] = (rw_reg32_t)0x520003A8U,
+  [14] = (rw_reg32_t)0x520003E8U,
+  [15] = (rw_reg32_t)0x52000428U,
+};
+
+/** @brief MDMA channel x Mask address register. */
+static rw_reg32_t const MDMA_MDMA_CxMAR[16] = {
+  [0]  = (rw_reg32_t)0x52000070U,
+  [1]  = (rw_reg32_t)0x520000B0U,
+  [2]  = (rw_reg32_t)0x520000F0U,
+  [3]  = (rw_reg32_t)0x52000130U,
+  [4]  = (rw_reg32_t)0x52000170U,
+  [5]  = (rw_reg32_t)0x520001B0U,
+  [6]  = (rw_reg32_t)0x520001F0U,
+  [7]  = (rw_reg32_t)0x52000230U,
+  [8]  = (rw_reg32_t)0x52000270U,
+  [9]  = (rw_reg32_t)0x520002B0U,
+  [10] = (rw_reg32_t)0x520002F0U,
+  [11] = (rw_reg32_t)0x52000330U,
+  [12] = (rw_reg32_t)0x52000370U,
+  [13] = (rw_reg32_t)0x520003B0U,
+  [14] = (rw_reg32_t)0x520003F0U,
+  [15] = (rw_reg32_t)0x52000430U,
+};
+
+/** @brief MDMA channel x Mask Data register. */
+static rw_reg32_t const MDMA_MDMA_CxMDR[16] = {
+  [0]  = (rw_reg32_t)0x52000074U,
+  [1]  = (rw_reg32_t)0x520000B4U,
+  [2]  = (rw_reg32_t)0x520000F4U,
+  [3]  = (rw_reg32_t)0x52000134U,
+  [4]  = (rw_reg32_t)0x52000174U,
+  [5]  = (rw_reg32_t)0x520001B4U,
+  [6]  = (rw_reg32_t)0x520001F4U,
+  [7]  = (rw_reg32_t)0x52000234U,
+  [8]  = (rw_reg32_t)0x52000274U,
+  [9]  = (rw_reg32_t)0x520002B4U,
+  [10] = (rw_reg32_t)0x520002F4U,
+  [11] = (rw_reg32_t)0x52000334U,
+  [12] = (rw_reg32_t)0x52000374U,
+  [13] = (rw_reg32_t)0x520003B4U,
+  [14] = (rw_reg32_t)0x520003F4U,
+  [15] = (rw_reg32_t)0x52000434U,
+};
+
+/** @subsection MDMA Register Field Definitions */
+
+static const field32_t MDMA_MDMA_GISR0_GIF0       = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF1       = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF2       = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF3       = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF4       = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF5       = {.msk = 0x00000020U, .pos = 5};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF6       = {.msk = 0x00000040U, .pos = 6};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF7       = {.msk = 0x00000080U, .pos = 7};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF8       = {.msk = 0x00000100U, .pos = 8};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF9       = {.msk = 0x00000200U, .pos = 9};  /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF10      = {.msk = 0x00000400U, .pos = 10}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF11      = {.msk = 0x00000800U, .pos = 11}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF12      = {.msk = 0x00001000U, .pos = 12}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF13      = {.msk = 0x00002000U, .pos = 13}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF14      = {.msk = 0x00004000U, .pos = 14}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIF15      = {.msk = 0x00008000U, .pos = 15}; /** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_C0ISR_TEIF0      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C0ISR_CTCIF0     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C0ISR_BRTIF0     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C0ISR_BTIF0      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C0ISR_TCIF0      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C0ISR_CRQA0      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C0IFCR_CTEIF0    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C0IFCR_CCTCIF0   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C0IFCR_CBRTIF0   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C0IFCR_CBTIF0    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C0IFCR_CLTCIF0   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C1ISR_TEIF1      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C1ISR_CTCIF1     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C1ISR_BRTIF1     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C1ISR_BTIF1      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C1ISR_TCIF1      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C1ISR_CRQA1      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C1IFCR_CTEIF1    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C1IFCR_CCTCIF1   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C1IFCR_CBRTIF1   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C1IFCR_CBTIF1    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C1IFCR_CLTCIF1   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C2ISR_TEIF2      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C2ISR_CTCIF2     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C2ISR_BRTIF2     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C2ISR_BTIF2      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C2ISR_TCIF2      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C2ISR_CRQA2      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C2IFCR_CTEIF2    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C2IFCR_CCTCIF2   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C2IFCR_CBRTIF2   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C2IFCR_CBTIF2    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C2IFCR_CLTCIF2   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C3ISR_TEIF3      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C3ISR_CTCIF3     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C3ISR_BRTIF3     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C3ISR_BTIF3      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C3ISR_TCIF3      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C3ISR_CRQA3      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C3IFCR_CTEIF3    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C3IFCR_CCTCIF3   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C3IFCR_CBRTIF3   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C3IFCR_CBTIF3    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C3IFCR_CLTCIF3   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C4ISR_TEIF4      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C4ISR_CTCIF4     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C4ISR_BRTIF4     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C4ISR_BTIF4      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C4ISR_TCIF4      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C4ISR_CRQA4      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C4IFCR_CTEIF4    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C4IFCR_CCTCIF4   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C4IFCR_CBRTIF4   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C4IFCR_CBTIF4    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C4IFCR_CLTCIF4   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C5ISR_TEIF5      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C5ISR_CTCIF5     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C5ISR_BRTIF5     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C5ISR_BTIF5      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C5ISR_TCIF5      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C5ISR_CRQA5      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C5IFCR_CTEIF5    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C5IFCR_CCTCIF5   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C5IFCR_CBRTIF5   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C5IFCR_CBTIF5    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C5IFCR_CLTCIF5   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C6ISR_TEIF6      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C6ISR_CTCIF6     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C6ISR_BRTIF6     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C6ISR_BTIF6      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C6ISR_TCIF6      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C6ISR_CRQA6      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C6IFCR_CTEIF6    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C6IFCR_CCTCIF6   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C6IFCR_CBRTIF6   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C6IFCR_CBTIF6    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C6IFCR_CLTCIF6   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C7ISR_TEIF7      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C7ISR_CTCIF7     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C7ISR_BRTIF7     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C7ISR_BTIF7      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C7ISR_TCIF7      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C7ISR_CRQA7      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C7IFCR_CTEIF7    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C7IFCR_CCTCIF7   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C7IFCR_CBRTIF7   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C7IFCR_CBTIF7    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C7IFCR_CLTCIF7   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C8ISR_TEIF8      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C8ISR_CTCIF8     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C8ISR_BRTIF8     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C8ISR_BTIF8      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C8ISR_TCIF8      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C8ISR_CRQA8      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C8IFCR_CTEIF8    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C8IFCR_CCTCIF8   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C8IFCR_CBRTIF8   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C8IFCR_CBTIF8    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C8IFCR_CLTCIF8   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C9ISR_TEIF9      = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C9ISR_CTCIF9     = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C9ISR_BRTIF9     = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C9ISR_BTIF9      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C9ISR_TCIF9      = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C9ISR_CRQA9      = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C9IFCR_CTEIF9    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C9IFCR_CCTCIF9   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C9IFCR_CBRTIF9   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C9IFCR_CBTIF9    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C9IFCR_CLTCIF9   = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C10ISR_TEIF10    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C10ISR_CTCIF10   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C10ISR_BRTIF10   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C10ISR_BTIF10    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C10ISR_TCIF10    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C10ISR_CRQA10    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C10IFCR_CTEIF10  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C10IFCR_CCTCIF10 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C10IFCR_CBRTIF10 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C10IFCR_CBTIF10  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C10IFCR_CLTCIF10 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C11ISR_TEIF11    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C11ISR_CTCIF11   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C11ISR_BRTIF11   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C11ISR_BTIF11    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C11ISR_TCIF11    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C11ISR_CRQA11    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C11IFCR_CTEIF11  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C11IFCR_CCTCIF11 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C11IFCR_CBRTIF11 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C11IFCR_CBTIF11  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C11IFCR_CLTCIF11 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C12ISR_TEIF12    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C12ISR_CTCIF12   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C12ISR_BRTIF12   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C12ISR_BTIF12    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C12ISR_TCIF12    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C12ISR_CRQA12    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C12IFCR_CTEIF12  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C12IFCR_CCTCIF12 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C12IFCR_CBRTIF12 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C12IFCR_CBTIF12  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C12IFCR_CLTCIF12 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C13ISR_TEIF13    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C13ISR_CTCIF13   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C13ISR_BRTIF13   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C13ISR_BTIF13    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C13ISR_TCIF13    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C13ISR_CRQA13    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C13IFCR_CTEIF13  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C13IFCR_CCTCIF13 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C13IFCR_CBRTIF13 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C13IFCR_CBTIF13  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C13IFCR_CLTCIF13 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C14ISR_TEIF14    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C14ISR_CTCIF14   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C14ISR_BRTIF14   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C14ISR_BTIF14    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C14ISR_TCIF14    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C14ISR_CRQA14    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C14IFCR_CTEIF14  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C14IFCR_CCTCIF14 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C14IFCR_CBRTIF14 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C14IFCR_CBTIF14  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C14IFCR_CLTCIF14 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C15ISR_TEIF15    = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x transfer error interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C15ISR_CTCIF15   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel x Channel Transfer Complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. CTC is set when the last block was transferred and the channel has been automatically disabled. CTC is also set when the channel is suspended, as a result of writing EN bit to 0. */
+static const field32_t MDMA_MDMA_C15ISR_BRTIF15   = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x block repeat transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C15ISR_BTIF15    = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x block transfer complete interrupt flag This bit is set by hardware. It is cleared by software writing 1 to the corresponding bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_C15ISR_TCIF15    = {.msk = 0x00000010U, .pos = 4};  /** @brief Channel x buffer transfer complete. */
+static const field32_t MDMA_MDMA_C15ISR_CRQA15    = {.msk = 0x00010000U, .pos = 16}; /** @brief Channel x request active flag. */
+static const field32_t MDMA_MDMA_C15IFCR_CTEIF15  = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel x clear transfer error interrupt flag Writing a 1 into this bit clears TEIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C15IFCR_CCTCIF15 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear Channel transfer complete interrupt flag for channel x Writing a 1 into this bit clears CTCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C15IFCR_CBRTIF15 = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel x clear block repeat transfer complete interrupt flag Writing a 1 into this bit clears BRTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C15IFCR_CBTIF15  = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel x Clear block transfer complete interrupt flag Writing a 1 into this bit clears BTIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_C15IFCR_CLTCIF15 = {.msk = 0x00000010U, .pos = 4};  /** @brief CLear buffer Transfer Complete Interrupt Flag for channel x Writing a 1 into this bit clears TCIFx in the MDMA_ISRy register. */
+static const field32_t MDMA_MDMA_CxESR_TEA        = {.msk = 0x0000007FU, .pos = 0};  /** @brief Transfer Error Address These bits are set and cleared by HW, in case of an MDMA data transfer error. It is used in conjunction with TED. This field indicates the 7 LSBits of the address which generated a transfer/access error. It may be used by SW to retrieve the failing address, by adding this value (truncated to the buffer transfer length size) to the current SAR/DAR value. Note: The SAR/DAR current value doesnt reflect this last address due to the FIFO management system. The SAR/DAR are only updated at the end of a (buffer) transfer (of TLEN+1 bytes). Note: It is not set in case of a link data error. */
+static const field32_t MDMA_MDMA_CxESR_TED        = {.msk = 0x00000080U, .pos = 7};  /** @brief Transfer Error Direction These bit is set and cleared by HW, in case of an MDMA data transfer error. */
+static const field32_t MDMA_MDMA_CxESR_TELD       = {.msk = 0x00000100U, .pos = 8};  /** @brief Transfer Error Link Data These bit is set by HW, in case of a transfer error while reading the block link data structure. It is cleared by software writing 1 to the CTEIFx bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_CxESR_TEMD       = {.msk = 0x00000200U, .pos = 9};  /** @brief Transfer Error Mask Data These bit is set by HW, in case of a transfer error while writing the Mask Data. It is cleared by software writing 1 to the CTEIFx bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_CxESR_ASE        = {.msk = 0x00000400U, .pos = 10}; /** @brief Address/Size Error These bit is set by HW, when the programmed address is not aligned with the data size. TED will indicate whether the problem is on the source or destination. It is cleared by software writing 1 to the CTEIFx bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_CxESR_BSE        = {.msk = 0x00000800U, .pos = 11}; /** @brief Block Size Error These bit is set by HW, when the block size is not an integer multiple of the data size either for source or destination. TED will indicate whether the problem is on the source or destination. It is cleared by software writing 1 to the CTEIFx bit in the DMA_IFCRy register. */
+static const field32_t MDMA_MDMA_CxCR_EN          = {.msk = 0x00000001U, .pos = 0};  /** @brief Channel enable. */
+static const field32_t MDMA_MDMA_CxCR_TEIE        = {.msk = 0x00000002U, .pos = 1};  /** @brief Transfer error interrupt enable This bit is set and cleared by software. */
+static const field32_t MDMA_MDMA_CxCR_CTCIE       = {.msk = 0x00000004U, .pos = 2};  /** @brief Channel Transfer Complete interrupt enable This bit is set and cleared by software. */
+static const field32_t MDMA_MDMA_CxCR_BRTIE       = {.msk = 0x00000008U, .pos = 3};  /** @brief Block Repeat transfer interrupt enable This bit is set and cleared by software. */
+static const field32_t MDMA_MDMA_CxCR_BTIE        = {.msk = 0x00000010U, .pos = 4};  /** @brief Block Transfer interrupt enable This bit is set and cleared by software. */
+static const field32_t MDMA_MDMA_CxCR_TCIE        = {.msk = 0x00000020U, .pos = 5};  /** @brief Buffer Transfer Complete interrupt enable This bit is set and cleared by software. */
+static const field32_t MDMA_MDMA_CxCR_PL          = {.msk = 0x000000C0U, .pos = 6};  /** @brief Priority level These bits are set and cleared by software. These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxCR_BEX         = {.msk = 0x00001000U, .pos = 12}; /** @brief Byte Endianness exchange. */
+static const field32_t MDMA_MDMA_CxCR_HEX         = {.msk = 0x00002000U, .pos = 13}; /** @brief Half word Endianes exchange. */
+static const field32_t MDMA_MDMA_CxCR_WEX         = {.msk = 0x00004000U, .pos = 14}; /** @brief Word Endianness exchange. */
+static const field32_t MDMA_MDMA_CxCR_SWRQ        = {.msk = 0x00010000U, .pos = 16}; /** @brief SW ReQuest Writing a 1 into this bit sets the CRQAx in MDMA_ISRy register, activating the request on Channel x Note: Either the whole CxCR register or the 8-bit/16-bit register @ Address offset: 0x4E + 0x40 chn may be used for SWRQ activation. In case of a SW request, acknowledge is not generated (neither HW signal, nor CxMAR write access). */
+static const field32_t MDMA_MDMA_CxTCR_SINC       = {.msk = 0x00000003U, .pos = 0};  /** @brief Source increment mode These bits are set and cleared by software. These bits are protected and can be written only if EN is 0 Note: When source is AHB (SBUS=1), SINC = 00 is forbidden. In Linked List Mode, at the end of a block (single or last block in repeated block transfer mode), this register will be loaded from memory (from address given by current LAR[31:0] + 0x00). */
+static const field32_t MDMA_MDMA_CxTCR_DINC       = {.msk = 0x0000000CU, .pos = 2};  /** @brief Destination increment mode These bits are set and cleared by software. These bits are protected and can be written only if EN is 0 Note: When destination is AHB (DBUS=1), DINC = 00 is forbidden. */
+static const field32_t MDMA_MDMA_CxTCR_SSIZE      = {.msk = 0x00000030U, .pos = 4};  /** @brief Source data size These bits are set and cleared by software. These bits are protected and can be written only if EN is 0 Note: If a value of 11 is programmed for the TCM access/AHB port, a transfer error will occur (TEIF bit set) If SINCOS &lt; SSIZE and SINC &#8800; 00, the result will be unpredictable. Note: SSIZE = 11 (double-word) is forbidden when source is TCM/AHB bus (SBUS=1). */
+static const field32_t MDMA_MDMA_CxTCR_DSIZE      = {.msk = 0x000000C0U, .pos = 6};  /** @brief Destination data size These bits are set and cleared by software. These bits are protected and can be written only if EN is 0. Note: If a value of 11 is programmed for the TCM access/AHB port, a transfer error will occur (TEIF bit set) If DINCOS &lt; DSIZE and DINC &#8800; 00, the result will be unpredictable. Note: DSIZE = 11 (double-word) is forbidden when destination is TCM/AHB bus (DBUS=1). */
+static const field32_t MDMA_MDMA_CxTCR_SINCOS     = {.msk = 0x00000300U, .pos = 8};  /** @brief Source increment offset size. */
+static const field32_t MDMA_MDMA_CxTCR_DINCOS     = {.msk = 0x00000C00U, .pos = 10}; /** @brief Destination increment offset. */
+static const field32_t MDMA_MDMA_CxTCR_SBURST     = {.msk = 0x00007000U, .pos = 12}; /** @brief Source burst transfer configuration. */
+static const field32_t MDMA_MDMA_CxTCR_DBURST     = {.msk = 0x00038000U, .pos = 15}; /** @brief Destination burst transfer configuration. */
+static const field32_t MDMA_MDMA_CxTCR_TLEN       = {.msk = 0x01FC0000U, .pos = 18}; /** @brief Buffer transfer lengh. */
+static const field32_t MDMA_MDMA_CxTCR_PKE        = {.msk = 0x02000000U, .pos = 25}; /** @brief PacK Enable These bit is set and cleared by software. If the Source Size is smaller than the destination, it will be padded according to the PAM value. If the Source data size is larger than the destination one, it will be truncated. The alignment will be done according to the PAM[0] value. This bit is protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxTCR_PAM        = {.msk = 0x0C000000U, .pos = 26}; /** @brief Padding/Alignement Mode These bits are set and cleared by software. Case 1: Source data size smaller than destination data size - 3 options are valid. Case 2: Source data size larger than destination data size. The remainder part is discarded. When PKE = 1 or DSIZE=SSIZE, these bits are ignored. These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxTCR_TRGM       = {.msk = 0x30000000U, .pos = 28}; /** @brief Trigger Mode These bits are set and cleared by software. Note: If TRGM is 11 for the current block, all the values loaded at the end of the current block through the linked list mechanism must keep the same value (TRGM=11) and the same SWRM value, otherwise the result is undefined. These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxTCR_SWRM       = {.msk = 0x40000000U, .pos = 30}; /** @brief SW Request Mode This bit is set and cleared by software. If a HW or SW request is currently active, the bit change will be delayed until the current transfer is completed. If the CxMAR contains a valid address, the CxMDR value will also be written @ CxMAR address. This bit is protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxTCR_BWM        = {.msk = 0x80000000U, .pos = 31}; /** @brief Bufferable Write Mode This bit is set and cleared by software. This bit is protected and can be written only if EN is 0. Note: All MDMA destination accesses are non-cacheable. */
+static const field32_t MDMA_MDMA_CxBNDTR_BNDT     = {.msk = 0x0001FFFFU, .pos = 0};  /** @brief Block number of data to transfer. */
+static const field32_t MDMA_MDMA_CxBNDTR_BRSUM    = {.msk = 0x00040000U, .pos = 18}; /** @brief Block Repeat Source address Update Mode These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxBNDTR_BRDUM    = {.msk = 0x00080000U, .pos = 19}; /** @brief Block Repeat Destination address Update Mode These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxBNDTR_BRC      = {.msk = 0xFFF00000U, .pos = 20}; /** @brief Block Repeat Count This field contains the number of repetitions of the current block (0 to 4095). When the channel is enabled, this register is read-only, indicating the remaining number of blocks, excluding the current one. This register decrements after each complete block transfer. Once the last block transfer has completed, this register can either stay at zero or be reloaded automatically from memory (in Linked List mode - i.e. Link Address valid). These bits are protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxBRUR_SUV       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Source adresse update value. */
+static const field32_t MDMA_MDMA_CxBRUR_DUV       = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Destination address update. */
+static const field32_t MDMA_MDMA_CxTBR_TSEL       = {.msk = 0x0000003FU, .pos = 0};  /** @brief Trigger selection. */
+static const field32_t MDMA_MDMA_CxTBR_SBUS       = {.msk = 0x00010000U, .pos = 16}; /** @brief Source BUS select This bit is protected and can be written only if EN is 0. */
+static const field32_t MDMA_MDMA_CxTBR_DBUS       = {.msk = 0x00020000U, .pos = 17}; /** @brief Destination BUS slect This bit is protected and can be written only if EN is 0. */
+
+/** @subsection Enumerated MDMA Register Field Definitions */
+
+/** @brief Channel x global interrupt flag (x=...) This bit is set and reset by hardware. It is a logical OR of all the Channel x interrupt flags (CTCIFx, BTIFx, BRTIFx, TEIFx) which are enabled in the interrupt mask register (CTCIEx, BTIEx, BRTIEx, TEIEx). */
+static const field32_t MDMA_MDMA_GISR0_GIFx[16] = {
+  [0]  = {.msk = 0x00000001U, .pos = 0},
+  [1]  = {.msk = 0x00000002U, .pos = 1},
+  [2]  = {.msk = 0x00000004U, .pos = 2},
+  [3]  = {.msk = 0x00000008U, .pos = 3},
+  [4]  = {.msk = 0x00000010U, .pos = 4},
+  [5]  = {.msk = 0x00000020U, .pos = 5},
+  [6]  = {.msk = 0x00000040U, .pos = 6},
+  [7]  = {.msk = 0x00000080U, .pos = 7},
+  [8]  = {.msk = 0x00000100U, .pos = 8},
+  [9]  = {.msk = 0x00000200U, .pos = 9},
+  [10] = {.msk = 0x00000400U, .pos = 10},
+  [11] = {.msk = 0x00000800U, .pos = 11},
+  [12] = {.msk = 0x00001000U, .pos = 12},
+  [13] = {.msk = 0x00002000U, .pos = 13},
+  [14] = {.msk = 0x00004000U, .pos = 14},
+  [15] = {.msk = 0x00008000U, .pos = 15},
+};
@@ -0,0 +1,80 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/opamp.h
+ * @authors UW SARP
+ * @brief Registers and fields of OPAMP.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section OPAMP Definitions
+ **************************************************************************************************/
+
+/** @subsection OPAMP Register Definitions */
+
+static rw_reg32_t const OPAMP_OPAMP1_CSR = (rw_reg32_t)0x40009000U; /** @brief OPAMP1 control/status register. */
+static rw_reg32_t const OPAMP_OPAMP2_CSR = (rw_reg32_t)0x40009010U; /** @brief OPAMP2 control/status register. */
+
+/** @subsection Enumerated OPAMP Register Definitions */
+
+/** @brief OPAMP1 offset trimming register in normal mode. */
+static rw_reg32_t const OPAMP_OPAMPx_OTR[3] = {
+  [1] = (rw_reg32_t)0x40009004U,
+  [2] = (rw_reg32_t)0x40009014U,
+};
+
+/** @brief OPAMP1 offset trimming register in low-power mode. */
+static rw_reg32_t const OPAMP_OPAMPx_HSOTR[3] = {
+  [1] = (rw_reg32_t)0x40009008U,
+  [2] = (rw_reg32_t)0x40009018U,
+};
+
+/** @subsection OPAMP Register Field Definitions */
+
+static const field32_t OPAMP_OPAMP1_CSR_OPAEN           = {.msk = 0x00000001U, .pos = 0};  /** @brief Operational amplifier Enable. */
+static const field32_t OPAMP_OPAMP1_CSR_FORCE_VP        = {.msk = 0x00000002U, .pos = 1};  /** @brief Force internal reference on VP (reserved for test. */
+static const field32_t OPAMP_OPAMP1_CSR_VP_SEL          = {.msk = 0x0000000CU, .pos = 2};  /** @brief Operational amplifier PGA mode. */
+static const field32_t OPAMP_OPAMP1_CSR_VM_SEL          = {.msk = 0x00000060U, .pos = 5};  /** @brief Inverting input selection. */
+static const field32_t OPAMP_OPAMP1_CSR_OPAHSM          = {.msk = 0x00000100U, .pos = 8};  /** @brief Operational amplifier high-speed mode. */
+static const field32_t OPAMP_OPAMP1_CSR_CALON           = {.msk = 0x00000800U, .pos = 11}; /** @brief Calibration mode enabled. */
+static const field32_t OPAMP_OPAMP1_CSR_CALSEL          = {.msk = 0x00003000U, .pos = 12}; /** @brief Calibration selection. */
+static const field32_t OPAMP_OPAMP1_CSR_PGA_GAIN        = {.msk = 0x0003C000U, .pos = 14}; /** @brief Allows to switch from AOP offset trimmed values to AOP offset. */
+static const field32_t OPAMP_OPAMP1_CSR_USERTRIM        = {.msk = 0x00040000U, .pos = 18}; /** @brief User trimming enable. */
+static const field32_t OPAMP_OPAMP1_CSR_TSTREF          = {.msk = 0x20000000U, .pos = 29}; /** @brief OPAMP calibration reference voltage output control (reserved for test). */
+static const field32_t OPAMP_OPAMP1_CSR_CALOUT          = {.msk = 0x40000000U, .pos = 30}; /** @brief Operational amplifier calibration output. */
+static const field32_t OPAMP_OPAMP2_CSR_OPAEN           = {.msk = 0x00000001U, .pos = 0};  /** @brief Operational amplifier Enable. */
+static const field32_t OPAMP_OPAMP2_CSR_FORCE_VP        = {.msk = 0x00000002U, .pos = 1};  /** @brief Force internal reference on VP (reserved for test). */
+static const field32_t OPAMP_OPAMP2_CSR_VM_SEL          = {.msk = 0x00000060U, .pos = 5};  /** @brief Inverting input selection. */
+static const field32_t OPAMP_OPAMP2_CSR_OPAHSM          = {.msk = 0x00000100U, .pos = 8};  /** @brief Operational amplifier high-speed mode. */
+static const field32_t OPAMP_OPAMP2_CSR_CALON           = {.msk = 0x00000800U, .pos = 11}; /** @brief Calibration mode enabled. */
+static const field32_t OPAMP_OPAMP2_CSR_CALSEL          = {.msk = 0x00003000U, .pos = 12}; /** @brief Calibration selection. */
+static const field32_t OPAMP_OPAMP2_CSR_PGA_GAIN        = {.msk = 0x0003C000U, .pos = 14}; /** @brief Operational amplifier Programmable amplifier gain value. */
+static const field32_t OPAMP_OPAMP2_CSR_USERTRIM        = {.msk = 0x00040000U, .pos = 18}; /** @brief User trimming enable. */
+static const field32_t OPAMP_OPAMP2_CSR_TSTREF          = {.msk = 0x20000000U, .pos = 29}; /** @brief OPAMP calibration reference voltage output control (reserved for test). */
+static const field32_t OPAMP_OPAMP2_CSR_CALOUT          = {.msk = 0x40000000U, .pos = 30}; /** @brief Operational amplifier calibration output. */
+static const field32_t OPAMP_OPAMPx_OTR_TRIMOFFSETN     = {.msk = 0x0000001FU, .pos = 0};  /** @brief Trim for NMOS differential pairs. */
+static const field32_t OPAMP_OPAMPx_OTR_TRIMOFFSETP     = {.msk = 0x00001F00U, .pos = 8};  /** @brief Trim for PMOS differential pairs. */
+static const field32_t OPAMP_OPAMPx_HSOTR_TRIMLPOFFSETN = {.msk = 0x0000001FU, .pos = 0};  /** @brief Trim for NMOS differential pairs. */
+static const field32_t OPAMP_OPAMPx_HSOTR_TRIMLPOFFSETP = {.msk = 0x00001F00U, .pos = 8};  /** @brief Trim for PMOS differential pairs. */
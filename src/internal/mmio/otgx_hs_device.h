@@ -0,0 +1,520 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/otgx_hs_device.h
+ * @authors UW SARP
+ * @brief Registers and fields of OTG1_HS_DEVICE, OTG2_HS_DEVICE.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section OTGx_HS_DEVICE Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated OTGx_HS_DEVICE Register Definitions */
+
+/** @brief OTG_HS device configuration register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DCFG[3] = {
+  [1] = (rw_reg32_t)0x40040800U,
+  [2] = (rw_reg32_t)0x40080800U,
+};
+
+/** @brief OTG_HS device control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DCTL[3] = {
+  [1] = (rw_reg32_t)0x40040804U,
+  [2] = (rw_reg32_t)0x40080804U,
+};
+
+/** @brief OTG_HS device status register. */
+static ro_reg32_t const OTGx_HS_DEVICE_OTG_HS_DSTS[3] = {
+  [1] = (ro_reg32_t)0x40040808U,
+  [2] = (ro_reg32_t)0x40080808U,
+};
+
+/** @brief OTG_HS device IN endpoint common interrupt mask register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPMSK[3] = {
+  [1] = (rw_reg32_t)0x40040810U,
+  [2] = (rw_reg32_t)0x40080810U,
+};
+
+/** @brief OTG_HS device OUT endpoint common interrupt mask register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPMSK[3] = {
+  [1] = (rw_reg32_t)0x40040814U,
+  [2] = (rw_reg32_t)0x40080814U,
+};
+
+/** @brief OTG_HS device all endpoints interrupt register. */
+static ro_reg32_t const OTGx_HS_DEVICE_OTG_HS_DAINT[3] = {
+  [1] = (ro_reg32_t)0x40040818U,
+  [2] = (ro_reg32_t)0x40080818U,
+};
+
+/** @brief OTG_HS all endpoints interrupt mask register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DAINTMSK[3] = {
+  [1] = (rw_reg32_t)0x4004081CU,
+  [2] = (rw_reg32_t)0x4008081CU,
+};
+
+/** @brief OTG_HS device VBUS discharge time register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DVBUSDIS[3] = {
+  [1] = (rw_reg32_t)0x40040828U,
+  [2] = (rw_reg32_t)0x40080828U,
+};
+
+/** @brief OTG_HS device VBUS pulsing time register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DVBUSPULSE[3] = {
+  [1] = (rw_reg32_t)0x4004082CU,
+  [2] = (rw_reg32_t)0x4008082CU,
+};
+
+/** @brief OTG_HS Device threshold control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DTHRCTL[3] = {
+  [1] = (rw_reg32_t)0x40040830U,
+  [2] = (rw_reg32_t)0x40080830U,
+};
+
+/** @brief OTG_HS device IN endpoint FIFO empty interrupt mask register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPEMPMSK[3] = {
+  [1] = (rw_reg32_t)0x40040834U,
+  [2] = (rw_reg32_t)0x40080834U,
+};
+
+/** @brief OTG_HS device each endpoint interrupt register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DEACHINT[3] = {
+  [1] = (rw_reg32_t)0x40040838U,
+  [2] = (rw_reg32_t)0x40080838U,
+};
+
+/** @brief OTG_HS device each endpoint interrupt register mask. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DEACHINTMSK[3] = {
+  [1] = (rw_reg32_t)0x4004083CU,
+  [2] = (rw_reg32_t)0x4008083CU,
+};
+
+/** @brief OTG_HS device IN endpoint 0 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ0[3] = {
+  [1] = (rw_reg32_t)0x40040910U,
+  [2] = (rw_reg32_t)0x40080910U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ1[3] = {
+  [1] = (rw_reg32_t)0x40040930U,
+  [2] = (rw_reg32_t)0x40080930U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ2[3] = {
+  [1] = (rw_reg32_t)0x40040950U,
+  [2] = (rw_reg32_t)0x40080950U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ3[3] = {
+  [1] = (rw_reg32_t)0x40040970U,
+  [2] = (rw_reg32_t)0x40080970U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ4[3] = {
+  [1] = (rw_reg32_t)0x40040990U,
+  [2] = (rw_reg32_t)0x40080990U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ5[3] = {
+  [1] = (rw_reg32_t)0x400409B0U,
+  [2] = (rw_reg32_t)0x400809B0U,
+};
+
+/** @brief OTG_HS device control OUT endpoint 0 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL0[3] = {
+  [1] = (rw_reg32_t)0x40040B00U,
+  [2] = (rw_reg32_t)0x40080B00U,
+};
+
+/** @brief OTG device endpoint-1 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL1[3] = {
+  [1] = (rw_reg32_t)0x40040B20U,
+  [2] = (rw_reg32_t)0x40080B20U,
+};
+
+/** @brief OTG device endpoint-2 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL2[3] = {
+  [1] = (rw_reg32_t)0x40040B40U,
+  [2] = (rw_reg32_t)0x40080B40U,
+};
+
+/** @brief OTG device endpoint-3 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL3[3] = {
+  [1] = (rw_reg32_t)0x40040B60U,
+  [2] = (rw_reg32_t)0x40080B60U,
+};
+
+/** @brief OTG_HS device endpoint-0 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ0[3] = {
+  [1] = (rw_reg32_t)0x40040B10U,
+  [2] = (rw_reg32_t)0x40080B10U,
+};
+
+/** @brief OTG_HS device endpoint-1 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ1[3] = {
+  [1] = (rw_reg32_t)0x40040B30U,
+  [2] = (rw_reg32_t)0x40080B30U,
+};
+
+/** @brief OTG_HS device endpoint-2 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ2[3] = {
+  [1] = (rw_reg32_t)0x40040B50U,
+  [2] = (rw_reg32_t)0x40080B50U,
+};
+
+/** @brief OTG_HS device endpoint-3 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ3[3] = {
+  [1] = (rw_reg32_t)0x40040B70U,
+  [2] = (rw_reg32_t)0x40080B70U,
+};
+
+/** @brief OTG_HS device endpoint-4 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ4[3] = {
+  [1] = (rw_reg32_t)0x40040B90U,
+  [2] = (rw_reg32_t)0x40080B90U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ6[3] = {
+  [1] = (rw_reg32_t)0x400409A0U,
+  [2] = (rw_reg32_t)0x400809A0U,
+};
+
+/** @brief OTG_HS device endpoint transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ7[3] = {
+  [1] = (rw_reg32_t)0x400409A8U,
+  [2] = (rw_reg32_t)0x400809A8U,
+};
+
+/** @brief OTG device endpoint-4 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL4[3] = {
+  [1] = (rw_reg32_t)0x40040B80U,
+  [2] = (rw_reg32_t)0x40080B80U,
+};
+
+/** @brief OTG device endpoint-5 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL5[3] = {
+  [1] = (rw_reg32_t)0x40040BA0U,
+  [2] = (rw_reg32_t)0x40080BA0U,
+};
+
+/** @brief OTG device endpoint-6 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL6[3] = {
+  [1] = (rw_reg32_t)0x40040BC0U,
+  [2] = (rw_reg32_t)0x40080BC0U,
+};
+
+/** @brief OTG device endpoint-7 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPCTL7[3] = {
+  [1] = (rw_reg32_t)0x40040BE0U,
+  [2] = (rw_reg32_t)0x40080BE0U,
+};
+
+/** @brief OTG_HS device endpoint-5 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ5[3] = {
+  [1] = (rw_reg32_t)0x40040BB0U,
+  [2] = (rw_reg32_t)0x40080BB0U,
+};
+
+/** @brief OTG_HS device endpoint-6 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ6[3] = {
+  [1] = (rw_reg32_t)0x40040BD0U,
+  [2] = (rw_reg32_t)0x40080BD0U,
+};
+
+/** @brief OTG_HS device endpoint-7 transfer size register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ7[3] = {
+  [1] = (rw_reg32_t)0x40040BF0U,
+  [2] = (rw_reg32_t)0x40080BF0U,
+};
+
+/** @brief OTG device endpoint-0 control register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPCTLx[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40040900U, [1] = (rw_reg32_t)0x40040920U, [2] = (rw_reg32_t)0x40040940U, [3] = (rw_reg32_t)0x40040960U, [4] = (rw_reg32_t)0x40040980U, [5] = (rw_reg32_t)0x400409A0U, [6] = (rw_reg32_t)0x400409C0U, [7] = (rw_reg32_t)0x400409E0U},
+  [2] = {[0] = (rw_reg32_t)0x40080900U, [1] = (rw_reg32_t)0x40080920U, [2] = (rw_reg32_t)0x40080940U, [3] = (rw_reg32_t)0x40080960U, [4] = (rw_reg32_t)0x40080980U, [5] = (rw_reg32_t)0x400809A0U, [6] = (rw_reg32_t)0x400809C0U, [7] = (rw_reg32_t)0x400809E0U},
+};
+
+/** @brief OTG device endpoint-0 interrupt register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPINTx[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40040908U, [1] = (rw_reg32_t)0x40040928U, [2] = (rw_reg32_t)0x40040948U, [3] = (rw_reg32_t)0x40040968U, [4] = (rw_reg32_t)0x40040988U, [5] = (rw_reg32_t)0x400409A8U, [6] = (rw_reg32_t)0x400409C8U, [7] = (rw_reg32_t)0x400409E8U},
+  [2] = {[0] = (rw_reg32_t)0x40080908U, [1] = (rw_reg32_t)0x40080928U, [2] = (rw_reg32_t)0x40080948U, [3] = (rw_reg32_t)0x40080968U, [4] = (rw_reg32_t)0x40080988U, [5] = (rw_reg32_t)0x400809A8U, [6] = (rw_reg32_t)0x400809C8U, [7] = (rw_reg32_t)0x400809E8U},
+};
+
+/** @brief OTG_HS device endpoint-1 DMA address register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DIEPDMAx[3][6] = {
+  [1] = {[1] = (rw_reg32_t)0x40040914U, [2] = (rw_reg32_t)0x40040934U, [3] = (rw_reg32_t)0x40040954U, [4] = (rw_reg32_t)0x40040974U, [5] = (rw_reg32_t)0x40040994U},
+  [2] = {[1] = (rw_reg32_t)0x40080914U, [2] = (rw_reg32_t)0x40080934U, [3] = (rw_reg32_t)0x40080954U, [4] = (rw_reg32_t)0x40080974U, [5] = (rw_reg32_t)0x40080994U},
+};
+
+/** @brief OTG_HS device IN endpoint transmit FIFO status register. */
+static ro_reg32_t const OTGx_HS_DEVICE_OTG_HS_DTXFSTSx[3][8] = {
+  [1] = {[0] = (ro_reg32_t)0x40040918U, [1] = (ro_reg32_t)0x40040938U, [2] = (ro_reg32_t)0x40040958U, [3] = (ro_reg32_t)0x40040978U, [4] = (ro_reg32_t)0x40040998U, [5] = (ro_reg32_t)0x400409B8U, [6] = (ro_reg32_t)0x400409A4U, [7] = (ro_reg32_t)0x400409ACU},
+  [2] = {[0] = (ro_reg32_t)0x40080918U, [1] = (ro_reg32_t)0x40080938U, [2] = (ro_reg32_t)0x40080958U, [3] = (ro_reg32_t)0x40080978U, [4] = (ro_reg32_t)0x40080998U, [5] = (ro_reg32_t)0x400809B8U, [6] = (ro_reg32_t)0x400809A4U, [7] = (ro_reg32_t)0x400809ACU},
+};
+
+/** @brief OTG_HS device endpoint-0 interrupt register. */
+static rw_reg32_t const OTGx_HS_DEVICE_OTG_HS_DOEPINTx[3][8] = {
+  [1] = {[0] = (rw_reg32_t)0x40040B08U, [1] = (rw_reg32_t)0x40040B28U, [2] = (rw_reg32_t)0x40040B48U, [3] = (rw_reg32_t)0x40040B68U, [4] = (rw_reg32_t)0x40040B88U, [5] = (rw_reg32_t)0x40040BA8U, [6] = (rw_reg32_t)0x40040BC8U, [7] = (rw_reg32_t)0x40040BE8U},
+  [2] = {[0] = (rw_reg32_t)0x40080B08U, [1] = (rw_reg32_t)0x40080B28U, [2] = (rw_reg32_t)0x40080B48U, [3] = (rw_reg32_t)0x40080B68U, [4] = (rw_reg32_t)0x40080B88U, [5] = (rw_reg32_t)0x40080BA8U, [6] = (rw_reg32_t)0x40080BC8U, [7] = (rw_reg32_t)0x40080BE8U},
+};
+
+/** @subsection OTGx_HS_DEVICE Register Field Definitions */
+
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCFG_DSPD                = {.msk = 0x00000003U, .pos = 0};  /** @brief Device speed. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCFG_NZLSOHSK            = {.msk = 0x00000004U, .pos = 2};  /** @brief Nonzero-length status OUT handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCFG_DAD                 = {.msk = 0x000007F0U, .pos = 4};  /** @brief Device address. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCFG_PFIVL               = {.msk = 0x00001800U, .pos = 11}; /** @brief Periodic (micro)frame interval. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCFG_PERSCHIVL           = {.msk = 0x03000000U, .pos = 24}; /** @brief Periodic scheduling interval. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_RWUSIG              = {.msk = 0x00000001U, .pos = 0};  /** @brief Remote wakeup signaling. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_SDIS                = {.msk = 0x00000002U, .pos = 1};  /** @brief Soft disconnect. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_GINSTS              = {.msk = 0x00000004U, .pos = 2};  /** @brief Global IN NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_GONSTS              = {.msk = 0x00000008U, .pos = 3};  /** @brief Global OUT NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_TCTL                = {.msk = 0x00000070U, .pos = 4};  /** @brief Test control. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_SGINAK              = {.msk = 0x00000080U, .pos = 7};  /** @brief Set global IN NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_CGINAK              = {.msk = 0x00000100U, .pos = 8};  /** @brief Clear global IN NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_SGONAK              = {.msk = 0x00000200U, .pos = 9};  /** @brief Set global OUT NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_CGONAK              = {.msk = 0x00000400U, .pos = 10}; /** @brief Clear global OUT NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DCTL_POPRGDNE            = {.msk = 0x00000800U, .pos = 11}; /** @brief Power-on programming done. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DSTS_SUSPSTS             = {.msk = 0x00000001U, .pos = 0};  /** @brief Suspend status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DSTS_ENUMSPD             = {.msk = 0x00000006U, .pos = 1};  /** @brief Enumerated speed. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DSTS_EERR                = {.msk = 0x00000008U, .pos = 3};  /** @brief Erratic error. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DSTS_FNSOF               = {.msk = 0x003FFF00U, .pos = 8};  /** @brief Frame number of the received SOF. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_XFRCM            = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_EPDM             = {.msk = 0x00000002U, .pos = 1};  /** @brief Endpoint disabled interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_TOM              = {.msk = 0x00000008U, .pos = 3};  /** @brief Timeout condition mask (nonisochronous endpoints). */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_ITTXFEMSK        = {.msk = 0x00000010U, .pos = 4};  /** @brief IN token received when TxFIFO empty mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_INEPNMM          = {.msk = 0x00000020U, .pos = 5};  /** @brief IN token received with EP mismatch mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_INEPNEM          = {.msk = 0x00000040U, .pos = 6};  /** @brief IN endpoint NAK effective mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_TXFURM           = {.msk = 0x00000100U, .pos = 8};  /** @brief FIFO underrun mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPMSK_BIM              = {.msk = 0x00000200U, .pos = 9};  /** @brief BNA interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_XFRCM            = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_EPDM             = {.msk = 0x00000002U, .pos = 1};  /** @brief Endpoint disabled interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_STUPM            = {.msk = 0x00000008U, .pos = 3};  /** @brief SETUP phase done mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_OTEPDM           = {.msk = 0x00000010U, .pos = 4};  /** @brief OUT token received when endpoint disabled mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_B2BSTUP          = {.msk = 0x00000040U, .pos = 6};  /** @brief Back-to-back SETUP packets received mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_OPEM             = {.msk = 0x00000100U, .pos = 8};  /** @brief OUT packet error mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPMSK_BOIM             = {.msk = 0x00000200U, .pos = 9};  /** @brief BNA interrupt mask. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DAINT_IEPINT             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN endpoint interrupt bits. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DAINT_OEPINT             = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief OUT endpoint interrupt bits. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DAINTMSK_IEPM            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN EP interrupt mask bits. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DAINTMSK_OEPM            = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief OUT EP interrupt mask bits. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DVBUSDIS_VBUSDT          = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Device VBUS discharge time. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DVBUSPULSE_DVBUSP        = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Device VBUS pulsing time. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_NONISOTHREN      = {.msk = 0x00000001U, .pos = 0};  /** @brief Nonisochronous IN endpoints threshold enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_ISOTHREN         = {.msk = 0x00000002U, .pos = 1};  /** @brief ISO IN endpoint threshold enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_TXTHRLEN         = {.msk = 0x000007FCU, .pos = 2};  /** @brief Transmit threshold length. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_RXTHREN          = {.msk = 0x00010000U, .pos = 16}; /** @brief Receive threshold enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_RXTHRLEN         = {.msk = 0x03FE0000U, .pos = 17}; /** @brief Receive threshold length. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTHRCTL_ARPEN            = {.msk = 0x08000000U, .pos = 27}; /** @brief Arbiter parking enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPEMPMSK_INEPTXFEM     = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN EP Tx FIFO empty interrupt mask bits. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DEACHINT_IEP1INT         = {.msk = 0x00000002U, .pos = 1};  /** @brief IN endpoint 1interrupt bit. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DEACHINT_OEP1INT         = {.msk = 0x00020000U, .pos = 17}; /** @brief OUT endpoint 1 interrupt bit. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DEACHINTMSK_IEP1INTM     = {.msk = 0x00000002U, .pos = 1};  /** @brief IN Endpoint 1 interrupt mask bit. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DEACHINTMSK_OEP1INTM     = {.msk = 0x00020000U, .pos = 17}; /** @brief OUT Endpoint 1 interrupt mask bit. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ0_XFRSIZ         = {.msk = 0x0000007FU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ0_PKTCNT         = {.msk = 0x00180000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ1_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ1_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ1_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ2_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ2_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ2_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ3_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ3_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ3_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ4_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ4_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ4_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ5_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ5_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ5_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_MPSIZ           = {.msk = 0x00000003U, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL0_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL1_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL2_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL3_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ0_XFRSIZ         = {.msk = 0x0000007FU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ0_PKTCNT         = {.msk = 0x00080000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ0_STUPCNT        = {.msk = 0x60000000U, .pos = 29}; /** @brief SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ1_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ1_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ1_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ2_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ2_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ2_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ3_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ3_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ3_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ4_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ4_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ4_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ6_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ6_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ6_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ7_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ7_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPTSIZ7_MCNT           = {.msk = 0x60000000U, .pos = 29}; /** @brief Multi count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL4_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL5_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL6_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even odd frame/Endpoint data PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_SNPM            = {.msk = 0x00100000U, .pos = 20}; /** @brief Snoop mode. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID/Set even frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPCTL7_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ5_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ5_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ5_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ6_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ6_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ6_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ7_XFRSIZ         = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ7_PKTCNT         = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPTSIZ7_RXDPID_STUPCNT = {.msk = 0x60000000U, .pos = 29}; /** @brief Received data PID/SETUP packet count. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_MPSIZ           = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_USBAEP          = {.msk = 0x00008000U, .pos = 15}; /** @brief USB active endpoint. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_EONUM_DPID      = {.msk = 0x00010000U, .pos = 16}; /** @brief Even/odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_NAKSTS          = {.msk = 0x00020000U, .pos = 17}; /** @brief NAK status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_EPTYP           = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_STALL           = {.msk = 0x00200000U, .pos = 21}; /** @brief STALL handshake. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_TXFNUM          = {.msk = 0x03C00000U, .pos = 22}; /** @brief TxFIFO number. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_CNAK            = {.msk = 0x04000000U, .pos = 26}; /** @brief Clear NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_SNAK            = {.msk = 0x08000000U, .pos = 27}; /** @brief Set NAK. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_SD0PID_SEVNFRM  = {.msk = 0x10000000U, .pos = 28}; /** @brief Set DATA0 PID. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_SODDFRM         = {.msk = 0x20000000U, .pos = 29}; /** @brief Set odd frame. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_EPDIS           = {.msk = 0x40000000U, .pos = 30}; /** @brief Endpoint disable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPCTLx_EPENA           = {.msk = 0x80000000U, .pos = 31}; /** @brief Endpoint enable. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_XFRC            = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_EPDISD          = {.msk = 0x00000002U, .pos = 1};  /** @brief Endpoint disabled interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_TOC             = {.msk = 0x00000008U, .pos = 3};  /** @brief Timeout condition. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_ITTXFE          = {.msk = 0x00000010U, .pos = 4};  /** @brief IN token received when TxFIFO is empty. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_INEPNE          = {.msk = 0x00000040U, .pos = 6};  /** @brief IN endpoint NAK effective. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_TXFE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Transmit FIFO empty. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_TXFIFOUDRN      = {.msk = 0x00000100U, .pos = 8};  /** @brief Transmit Fifo Underrun. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_BNA             = {.msk = 0x00000200U, .pos = 9};  /** @brief Buffer not available interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_PKTDRPSTS       = {.msk = 0x00000800U, .pos = 11}; /** @brief Packet dropped status. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_BERR            = {.msk = 0x00001000U, .pos = 12}; /** @brief Babble error interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DIEPINTx_NAK             = {.msk = 0x00002000U, .pos = 13}; /** @brief NAK interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DTXFSTSx_INEPTFSAV       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN endpoint TxFIFO space avail. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_XFRC            = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_EPDISD          = {.msk = 0x00000002U, .pos = 1};  /** @brief Endpoint disabled interrupt. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_STUP            = {.msk = 0x00000008U, .pos = 3};  /** @brief SETUP phase done. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_OTEPDIS         = {.msk = 0x00000010U, .pos = 4};  /** @brief OUT token received when endpoint disabled. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_B2BSTUP         = {.msk = 0x00000040U, .pos = 6};  /** @brief Back-to-back SETUP packets received. */
+static const field32_t OTGx_HS_DEVICE_OTG_HS_DOEPINTx_NYET            = {.msk = 0x00004000U, .pos = 14}; /** @brief NYET interrupt. */
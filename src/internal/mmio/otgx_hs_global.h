@@ -0,0 +1,322 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/otgx_hs_global.h
+ * @authors UW SARP
+ * @brief Registers and fields of OTG1_HS_GLOBAL, OTG2_HS_GLOBAL.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section OTGx_HS_GLOBAL Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated OTGx_HS_GLOBAL Register Definitions */
+
+/** @brief OTG_HS control and status register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GOTGCTL[3] = {
+  [1] = (rw_reg32_t)0x40040000U,
+  [2] = (rw_reg32_t)0x40080000U,
+};
+
+/** @brief OTG_HS interrupt register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GOTGINT[3] = {
+  [1] = (rw_reg32_t)0x40040004U,
+  [2] = (rw_reg32_t)0x40080004U,
+};
+
+/** @brief OTG_HS AHB configuration register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GAHBCFG[3] = {
+  [1] = (rw_reg32_t)0x40040008U,
+  [2] = (rw_reg32_t)0x40080008U,
+};
+
+/** @brief OTG_HS USB configuration register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GUSBCFG[3] = {
+  [1] = (rw_reg32_t)0x4004000CU,
+  [2] = (rw_reg32_t)0x4008000CU,
+};
+
+/** @brief OTG_HS reset register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRSTCTL[3] = {
+  [1] = (rw_reg32_t)0x40040010U,
+  [2] = (rw_reg32_t)0x40080010U,
+};
+
+/** @brief OTG_HS core interrupt register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GINTSTS[3] = {
+  [1] = (rw_reg32_t)0x40040014U,
+  [2] = (rw_reg32_t)0x40080014U,
+};
+
+/** @brief OTG_HS interrupt mask register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GINTMSK[3] = {
+  [1] = (rw_reg32_t)0x40040018U,
+  [2] = (rw_reg32_t)0x40080018U,
+};
+
+/** @brief OTG_HS Receive status debug read register (host mode). */
+static ro_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_HOST[3] = {
+  [1] = (ro_reg32_t)0x4004001CU,
+  [2] = (ro_reg32_t)0x4008001CU,
+};
+
+/** @brief OTG_HS status read and pop register (host mode). */
+static ro_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_HOST[3] = {
+  [1] = (ro_reg32_t)0x40040020U,
+  [2] = (ro_reg32_t)0x40080020U,
+};
+
+/** @brief OTG_HS Receive FIFO size register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRXFSIZ[3] = {
+  [1] = (rw_reg32_t)0x40040024U,
+  [2] = (rw_reg32_t)0x40080024U,
+};
+
+/** @brief OTG_HS nonperiodic transmit FIFO size register (host mode). */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_HNPTXFSIZ_HOST[3] = {
+  [1] = (rw_reg32_t)0x40040028U,
+  [2] = (rw_reg32_t)0x40080028U,
+};
+
+/** @brief Endpoint 0 transmit FIFO size (peripheral mode). */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_DIEPTXF0_DEVICE[3] = {
+  [1] = (rw_reg32_t)0x40040028U,
+  [2] = (rw_reg32_t)0x40080028U,
+};
+
+/** @brief OTG_HS nonperiodic transmit FIFO/queue status register. */
+static ro_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GNPTXSTS[3] = {
+  [1] = (ro_reg32_t)0x4004002CU,
+  [2] = (ro_reg32_t)0x4008002CU,
+};
+
+/** @brief OTG_HS general core configuration register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GCCFG[3] = {
+  [1] = (rw_reg32_t)0x40040038U,
+  [2] = (rw_reg32_t)0x40080038U,
+};
+
+/** @brief OTG_HS core ID register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_CID[3] = {
+  [1] = (rw_reg32_t)0x4004003CU,
+  [2] = (rw_reg32_t)0x4008003CU,
+};
+
+/** @brief OTG_HS Host periodic transmit FIFO size register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_HPTXFSIZ[3] = {
+  [1] = (rw_reg32_t)0x40040100U,
+  [2] = (rw_reg32_t)0x40080100U,
+};
+
+/** @brief OTG_DIEPTXF8. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_DIEPTXF8[3] = {
+  [1] = (rw_reg32_t)0x40040120U,
+  [2] = (rw_reg32_t)0x40080120U,
+};
+
+/** @brief OTG_HS Receive status debug read register (peripheral mode mode). */
+static ro_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE[3] = {
+  [1] = (ro_reg32_t)0x4004001CU,
+  [2] = (ro_reg32_t)0x4008001CU,
+};
+
+/** @brief OTG_HS status read and pop register (peripheral mode). */
+static ro_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE[3] = {
+  [1] = (ro_reg32_t)0x40040020U,
+  [2] = (ro_reg32_t)0x40080020U,
+};
+
+/** @brief OTG core LPM configuration register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_GLPMCFG[3] = {
+  [1] = (rw_reg32_t)0x40040054U,
+  [2] = (rw_reg32_t)0x40080054U,
+};
+
+/** @brief OTG_HS device IN endpoint transmit FIFO size register. */
+static rw_reg32_t const OTGx_HS_GLOBAL_OTG_HS_DIEPTXFx[3][8] = {
+  [1] = {[1] = (rw_reg32_t)0x40040104U, [2] = (rw_reg32_t)0x40040108U, [3] = (rw_reg32_t)0x4004010CU, [4] = (rw_reg32_t)0x40040110U, [5] = (rw_reg32_t)0x40040114U, [6] = (rw_reg32_t)0x40040118U, [7] = (rw_reg32_t)0x4004011CU},
+  [2] = {[1] = (rw_reg32_t)0x40080104U, [2] = (rw_reg32_t)0x40080108U, [3] = (rw_reg32_t)0x4008010CU, [4] = (rw_reg32_t)0x40080110U, [5] = (rw_reg32_t)0x40080114U, [6] = (rw_reg32_t)0x40080118U, [7] = (rw_reg32_t)0x4008011CU},
+};
+
+/** @subsection OTGx_HS_GLOBAL Register Field Definitions */
+
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_SRQSCS            = {.msk = 0x00000001U, .pos = 0};  /** @brief Session request success. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_SRQ               = {.msk = 0x00000002U, .pos = 1};  /** @brief Session request. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_HNGSCS            = {.msk = 0x00000100U, .pos = 8};  /** @brief Host negotiation success. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_HNPRQ             = {.msk = 0x00000200U, .pos = 9};  /** @brief HNP request. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_HSHNPEN           = {.msk = 0x00000400U, .pos = 10}; /** @brief Host set HNP enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_DHNPEN            = {.msk = 0x00000800U, .pos = 11}; /** @brief Device HNP enabled. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_CIDSTS            = {.msk = 0x00010000U, .pos = 16}; /** @brief Connector ID status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_DBCT              = {.msk = 0x00020000U, .pos = 17}; /** @brief Long/short debounce time. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_ASVLD             = {.msk = 0x00040000U, .pos = 18}; /** @brief A-session valid. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_BSVLD             = {.msk = 0x00080000U, .pos = 19}; /** @brief B-session valid. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGCTL_EHEN              = {.msk = 0x00001000U, .pos = 12}; /** @brief Embedded host enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_SEDET             = {.msk = 0x00000004U, .pos = 2};  /** @brief Session end detected. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_SRSSCHG           = {.msk = 0x00000100U, .pos = 8};  /** @brief Session request success status change. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_HNSSCHG           = {.msk = 0x00000200U, .pos = 9};  /** @brief Host negotiation success status change. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_HNGDET            = {.msk = 0x00020000U, .pos = 17}; /** @brief Host negotiation detected. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_ADTOCHG           = {.msk = 0x00040000U, .pos = 18}; /** @brief A-device timeout change. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_DBCDNE            = {.msk = 0x00080000U, .pos = 19}; /** @brief Debounce done. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GOTGINT_IDCHNG            = {.msk = 0x00100000U, .pos = 20}; /** @brief ID input pin changed. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GAHBCFG_GINT              = {.msk = 0x00000001U, .pos = 0};  /** @brief Global interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GAHBCFG_HBSTLEN           = {.msk = 0x0000001EU, .pos = 1};  /** @brief Burst length/type. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GAHBCFG_DMAEN             = {.msk = 0x00000020U, .pos = 5};  /** @brief DMA enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GAHBCFG_TXFELVL           = {.msk = 0x00000080U, .pos = 7};  /** @brief TxFIFO empty level. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GAHBCFG_PTXFELVL          = {.msk = 0x00000100U, .pos = 8};  /** @brief Periodic TxFIFO empty level. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_TOCAL             = {.msk = 0x00000007U, .pos = 0};  /** @brief FS timeout calibration. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_PHYSEL            = {.msk = 0x00000040U, .pos = 6};  /** @brief USB 2.0 high-speed ULPI PHY or USB 1.1 full-speed serial transceiver select. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_SRPCAP            = {.msk = 0x00000100U, .pos = 8};  /** @brief SRP-capable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_HNPCAP            = {.msk = 0x00000200U, .pos = 9};  /** @brief HNP-capable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_TRDT              = {.msk = 0x00003C00U, .pos = 10}; /** @brief USB turnaround time. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_PHYLPCS           = {.msk = 0x00008000U, .pos = 15}; /** @brief PHY Low-power clock select. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPIFSLS          = {.msk = 0x00020000U, .pos = 17}; /** @brief ULPI FS/LS select. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPIAR            = {.msk = 0x00040000U, .pos = 18}; /** @brief ULPI Auto-resume. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPICSM           = {.msk = 0x00080000U, .pos = 19}; /** @brief ULPI Clock SuspendM. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPIEVBUSD        = {.msk = 0x00100000U, .pos = 20}; /** @brief ULPI External VBUS Drive. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPIEVBUSI        = {.msk = 0x00200000U, .pos = 21}; /** @brief ULPI external VBUS indicator. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_TSDPS             = {.msk = 0x00400000U, .pos = 22}; /** @brief TermSel DLine pulsing selection. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_PCCI              = {.msk = 0x00800000U, .pos = 23}; /** @brief Indicator complement. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_PTCI              = {.msk = 0x01000000U, .pos = 24}; /** @brief Indicator pass through. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_ULPIIPD           = {.msk = 0x02000000U, .pos = 25}; /** @brief ULPI interface protect disable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_FHMOD             = {.msk = 0x20000000U, .pos = 29}; /** @brief Forced host mode. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GUSBCFG_FDMOD             = {.msk = 0x40000000U, .pos = 30}; /** @brief Forced peripheral mode. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_CSRST             = {.msk = 0x00000001U, .pos = 0};  /** @brief Core soft reset. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_HSRST             = {.msk = 0x00000002U, .pos = 1};  /** @brief HCLK soft reset. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_FCRST             = {.msk = 0x00000004U, .pos = 2};  /** @brief Host frame counter reset. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_RXFFLSH           = {.msk = 0x00000010U, .pos = 4};  /** @brief RxFIFO flush. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_TXFFLSH           = {.msk = 0x00000020U, .pos = 5};  /** @brief TxFIFO flush. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_TXFNUM            = {.msk = 0x000007C0U, .pos = 6};  /** @brief TxFIFO number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_AHBIDL            = {.msk = 0x80000000U, .pos = 31}; /** @brief AHB master idle. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRSTCTL_DMAREQ            = {.msk = 0x40000000U, .pos = 30}; /** @brief DMA request signal enabled for USB OTG HS. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_CMOD              = {.msk = 0x00000001U, .pos = 0};  /** @brief Current mode of operation. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_MMIS              = {.msk = 0x00000002U, .pos = 1};  /** @brief Mode mismatch interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_OTGINT            = {.msk = 0x00000004U, .pos = 2};  /** @brief OTG interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_SOF               = {.msk = 0x00000008U, .pos = 3};  /** @brief Start of frame. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_RXFLVL            = {.msk = 0x00000010U, .pos = 4};  /** @brief RxFIFO nonempty. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_NPTXFE            = {.msk = 0x00000020U, .pos = 5};  /** @brief Nonperiodic TxFIFO empty. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_GINAKEFF          = {.msk = 0x00000040U, .pos = 6};  /** @brief Global IN nonperiodic NAK effective. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_BOUTNAKEFF        = {.msk = 0x00000080U, .pos = 7};  /** @brief Global OUT NAK effective. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_ESUSP             = {.msk = 0x00000400U, .pos = 10}; /** @brief Early suspend. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_USBSUSP           = {.msk = 0x00000800U, .pos = 11}; /** @brief USB suspend. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_USBRST            = {.msk = 0x00001000U, .pos = 12}; /** @brief USB reset. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_ENUMDNE           = {.msk = 0x00002000U, .pos = 13}; /** @brief Enumeration done. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_ISOODRP           = {.msk = 0x00004000U, .pos = 14}; /** @brief Isochronous OUT packet dropped interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_EOPF              = {.msk = 0x00008000U, .pos = 15}; /** @brief End of periodic frame interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_IEPINT            = {.msk = 0x00040000U, .pos = 18}; /** @brief IN endpoint interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_OEPINT            = {.msk = 0x00080000U, .pos = 19}; /** @brief OUT endpoint interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_IISOIXFR          = {.msk = 0x00100000U, .pos = 20}; /** @brief Incomplete isochronous IN transfer. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_PXFR_INCOMPISOOUT = {.msk = 0x00200000U, .pos = 21}; /** @brief Incomplete periodic transfer. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_DATAFSUSP         = {.msk = 0x00400000U, .pos = 22}; /** @brief Data fetch suspended. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_HPRTINT           = {.msk = 0x01000000U, .pos = 24}; /** @brief Host port interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_HCINT             = {.msk = 0x02000000U, .pos = 25}; /** @brief Host channels interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_PTXFE             = {.msk = 0x04000000U, .pos = 26}; /** @brief Periodic TxFIFO empty. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_CIDSCHG           = {.msk = 0x10000000U, .pos = 28}; /** @brief Connector ID status change. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_DISCINT           = {.msk = 0x20000000U, .pos = 29}; /** @brief Disconnect detected interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_SRQINT            = {.msk = 0x40000000U, .pos = 30}; /** @brief Session request/new session detected interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTSTS_WKUINT            = {.msk = 0x80000000U, .pos = 31}; /** @brief Resume/remote wakeup detected interrupt. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_MMISM             = {.msk = 0x00000002U, .pos = 1};  /** @brief Mode mismatch interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_OTGINT            = {.msk = 0x00000004U, .pos = 2};  /** @brief OTG interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_SOFM              = {.msk = 0x00000008U, .pos = 3};  /** @brief Start of frame mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_RXFLVLM           = {.msk = 0x00000010U, .pos = 4};  /** @brief Receive FIFO nonempty mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_NPTXFEM           = {.msk = 0x00000020U, .pos = 5};  /** @brief Nonperiodic TxFIFO empty mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_GINAKEFFM         = {.msk = 0x00000040U, .pos = 6};  /** @brief Global nonperiodic IN NAK effective mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_GONAKEFFM         = {.msk = 0x00000080U, .pos = 7};  /** @brief Global OUT NAK effective mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_ESUSPM            = {.msk = 0x00000400U, .pos = 10}; /** @brief Early suspend mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_USBSUSPM          = {.msk = 0x00000800U, .pos = 11}; /** @brief USB suspend mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_USBRST            = {.msk = 0x00001000U, .pos = 12}; /** @brief USB reset mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_ENUMDNEM          = {.msk = 0x00002000U, .pos = 13}; /** @brief Enumeration done mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_ISOODRPM          = {.msk = 0x00004000U, .pos = 14}; /** @brief Isochronous OUT packet dropped interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_EOPFM             = {.msk = 0x00008000U, .pos = 15}; /** @brief End of periodic frame interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_IEPINT            = {.msk = 0x00040000U, .pos = 18}; /** @brief IN endpoints interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_OEPINT            = {.msk = 0x00080000U, .pos = 19}; /** @brief OUT endpoints interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_IISOIXFRM         = {.msk = 0x00100000U, .pos = 20}; /** @brief Incomplete isochronous IN transfer mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_PXFRM_IISOOXFRM   = {.msk = 0x00200000U, .pos = 21}; /** @brief Incomplete periodic transfer mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_FSUSPM            = {.msk = 0x00400000U, .pos = 22}; /** @brief Data fetch suspended mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_PRTIM             = {.msk = 0x01000000U, .pos = 24}; /** @brief Host port interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_HCIM              = {.msk = 0x02000000U, .pos = 25}; /** @brief Host channels interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_PTXFEM            = {.msk = 0x04000000U, .pos = 26}; /** @brief Periodic TxFIFO empty mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_CIDSCHGM          = {.msk = 0x10000000U, .pos = 28}; /** @brief Connector ID status change mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_DISCINT           = {.msk = 0x20000000U, .pos = 29}; /** @brief Disconnect detected interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_SRQIM             = {.msk = 0x40000000U, .pos = 30}; /** @brief Session request/new session detected interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_WUIM              = {.msk = 0x80000000U, .pos = 31}; /** @brief Resume/remote wakeup detected interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_RSTDE             = {.msk = 0x00800000U, .pos = 23}; /** @brief Reset detected interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GINTMSK_LPMINTM           = {.msk = 0x08000000U, .pos = 27}; /** @brief LPM interrupt mask. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_HOST_CHNUM        = {.msk = 0x0000000FU, .pos = 0};  /** @brief Channel number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_HOST_BCNT         = {.msk = 0x00007FF0U, .pos = 4};  /** @brief Byte count. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_HOST_DPID         = {.msk = 0x00018000U, .pos = 15}; /** @brief Data PID. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_HOST_PKTSTS       = {.msk = 0x001E0000U, .pos = 17}; /** @brief Packet status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_HOST_CHNUM        = {.msk = 0x0000000FU, .pos = 0};  /** @brief Channel number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_HOST_BCNT         = {.msk = 0x00007FF0U, .pos = 4};  /** @brief Byte count. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_HOST_DPID         = {.msk = 0x00018000U, .pos = 15}; /** @brief Data PID. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_HOST_PKTSTS       = {.msk = 0x001E0000U, .pos = 17}; /** @brief Packet status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXFSIZ_RXFD              = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief RxFIFO depth. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_HNPTXFSIZ_HOST_NPTXFSA    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Nonperiodic transmit RAM start address. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_HNPTXFSIZ_HOST_NPTXFD     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Nonperiodic TxFIFO depth. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_DIEPTXF0_DEVICE_TX0FSA    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Endpoint 0 transmit RAM start address. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_DIEPTXF0_DEVICE_TX0FD     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Endpoint 0 TxFIFO depth. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GNPTXSTS_NPTXFSAV         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Nonperiodic TxFIFO space available. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GNPTXSTS_NPTQXSAV         = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Nonperiodic transmit request queue space available. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GNPTXSTS_NPTXQTOP         = {.msk = 0x7F000000U, .pos = 24}; /** @brief Top of the nonperiodic transmit request queue. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_PWRDWN              = {.msk = 0x00010000U, .pos = 16}; /** @brief Power down. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_BCDEN               = {.msk = 0x00020000U, .pos = 17}; /** @brief Battery charging detector (BCD) enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_DCDEN               = {.msk = 0x00040000U, .pos = 18}; /** @brief Data contact detection (DCD) mode enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_PDEN                = {.msk = 0x00080000U, .pos = 19}; /** @brief Primary detection (PD) mode enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_SDEN                = {.msk = 0x00100000U, .pos = 20}; /** @brief Secondary detection (SD) mode enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_VBDEN               = {.msk = 0x00200000U, .pos = 21}; /** @brief USB VBUS detection enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_DCDET               = {.msk = 0x00000001U, .pos = 0};  /** @brief Data contact detection (DCD) status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_PDET                = {.msk = 0x00000002U, .pos = 1};  /** @brief Primary detection (PD) status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_SDET                = {.msk = 0x00000004U, .pos = 2};  /** @brief Secondary detection (SD) status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GCCFG_PS2DET              = {.msk = 0x00000008U, .pos = 3};  /** @brief DM pull-up detection status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_HPTXFSIZ_PTXSA            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Host periodic TxFIFO start address. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_HPTXFSIZ_PTXFD            = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Host periodic TxFIFO depth. */
+static const field32_t OTGx_HS_GLOBAL_OTG_DIEPTXF8_INEPTXSA            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN endpoint FIFOx transmit RAM start address This field contains the memory start address for IN endpoint transmit FIFOx. The address must be aligned with a 32-bit memory location. */
+static const field32_t OTGx_HS_GLOBAL_OTG_DIEPTXF8_INEPTXFD            = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief IN endpoint Tx FIFO depth This value is in terms of 32-bit words. Minimum value is 16. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE_EPNUM      = {.msk = 0x0000000FU, .pos = 0};  /** @brief Endpoint number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE_BCNT       = {.msk = 0x00007FF0U, .pos = 4};  /** @brief Byte count. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE_DPID       = {.msk = 0x00018000U, .pos = 15}; /** @brief Data PID. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE_PKTSTS     = {.msk = 0x001E0000U, .pos = 17}; /** @brief Packet status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSR_DEVICE_FRMNUM     = {.msk = 0x01E00000U, .pos = 21}; /** @brief Frame number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE_EPNUM      = {.msk = 0x0000000FU, .pos = 0};  /** @brief Endpoint number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE_BCNT       = {.msk = 0x00007FF0U, .pos = 4};  /** @brief Byte count. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE_DPID       = {.msk = 0x00018000U, .pos = 15}; /** @brief Data PID. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE_PKTSTS     = {.msk = 0x001E0000U, .pos = 17}; /** @brief Packet status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GRXSTSP_DEVICE_FRMNUM     = {.msk = 0x01E00000U, .pos = 21}; /** @brief Frame number. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief LPM support enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMACK            = {.msk = 0x00000002U, .pos = 1};  /** @brief LPM token acknowledge enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_BESL              = {.msk = 0x0000003CU, .pos = 2};  /** @brief Best effort service latency. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_REMWAKE           = {.msk = 0x00000040U, .pos = 6};  /** @brief BRemoteWake value. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_L1SSEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief L1 Shallow Sleep enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_BESLTHRS          = {.msk = 0x00000F00U, .pos = 8};  /** @brief BESL threshold. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_L1DSEN            = {.msk = 0x00001000U, .pos = 12}; /** @brief L1 deep sleep enable. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMRST            = {.msk = 0x00006000U, .pos = 13}; /** @brief LPM response. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_SLPSTS            = {.msk = 0x00008000U, .pos = 15}; /** @brief Port sleep status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_L1RSMOK           = {.msk = 0x00010000U, .pos = 16}; /** @brief Sleep State Resume OK. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMCHIDX          = {.msk = 0x001E0000U, .pos = 17}; /** @brief LPM Channel Index. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMRCNT           = {.msk = 0x00E00000U, .pos = 21}; /** @brief LPM retry count. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_SNDLPM            = {.msk = 0x01000000U, .pos = 24}; /** @brief Send LPM transaction. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_LPMRCNTSTS        = {.msk = 0x0E000000U, .pos = 25}; /** @brief LPM retry count status. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_GLPMCFG_ENBESL            = {.msk = 0x10000000U, .pos = 28}; /** @brief Enable best effort service latency. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_DIEPTXFx_INEPTXSA         = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief IN endpoint FIFOx transmit RAM start address. */
+static const field32_t OTGx_HS_GLOBAL_OTG_HS_DIEPTXFx_INEPTXFD         = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief IN endpoint TxFIFO depth. */
@@ -0,0 +1,434 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/otgx_hs_host.h
+ * @authors UW SARP
+ * @brief Registers and fields of OTG1_HS_HOST, OTG2_HS_HOST.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section OTGx_HS_HOST Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated OTGx_HS_HOST Register Definitions */
+
+/** @brief OTG_HS host configuration register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCFG[3] = {
+  [1] = (rw_reg32_t)0x40040400U,
+  [2] = (rw_reg32_t)0x40080400U,
+};
+
+/** @brief OTG_HS Host frame interval register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HFIR[3] = {
+  [1] = (rw_reg32_t)0x40040404U,
+  [2] = (rw_reg32_t)0x40080404U,
+};
+
+/** @brief OTG_HS host frame number/frame time remaining register. */
+static ro_reg32_t const OTGx_HS_HOST_OTG_HS_HFNUM[3] = {
+  [1] = (ro_reg32_t)0x40040408U,
+  [2] = (ro_reg32_t)0x40080408U,
+};
+
+/** @brief OTG_HS_Host periodic transmit FIFO/queue status register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HPTXSTS[3] = {
+  [1] = (rw_reg32_t)0x40040410U,
+  [2] = (rw_reg32_t)0x40080410U,
+};
+
+/** @brief OTG_HS Host all channels interrupt register. */
+static ro_reg32_t const OTGx_HS_HOST_OTG_HS_HAINT[3] = {
+  [1] = (ro_reg32_t)0x40040414U,
+  [2] = (ro_reg32_t)0x40080414U,
+};
+
+/** @brief OTG_HS host all channels interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HAINTMSK[3] = {
+  [1] = (rw_reg32_t)0x40040418U,
+  [2] = (rw_reg32_t)0x40080418U,
+};
+
+/** @brief OTG_HS host port control and status register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HPRT[3] = {
+  [1] = (rw_reg32_t)0x40040440U,
+  [2] = (rw_reg32_t)0x40080440U,
+};
+
+/** @brief OTG_HS host channel-11 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK0[3] = {
+  [1] = (rw_reg32_t)0x4004050CU,
+  [2] = (rw_reg32_t)0x4008050CU,
+};
+
+/** @brief OTG_HS host channel-1 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK1[3] = {
+  [1] = (rw_reg32_t)0x4004052CU,
+  [2] = (rw_reg32_t)0x4008052CU,
+};
+
+/** @brief OTG_HS host channel-2 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK2[3] = {
+  [1] = (rw_reg32_t)0x4004054CU,
+  [2] = (rw_reg32_t)0x4008054CU,
+};
+
+/** @brief OTG_HS host channel-3 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK3[3] = {
+  [1] = (rw_reg32_t)0x4004056CU,
+  [2] = (rw_reg32_t)0x4008056CU,
+};
+
+/** @brief OTG_HS host channel-4 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK4[3] = {
+  [1] = (rw_reg32_t)0x4004058CU,
+  [2] = (rw_reg32_t)0x4008058CU,
+};
+
+/** @brief OTG_HS host channel-5 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK5[3] = {
+  [1] = (rw_reg32_t)0x400405ACU,
+  [2] = (rw_reg32_t)0x400805ACU,
+};
+
+/** @brief OTG_HS host channel-6 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK6[3] = {
+  [1] = (rw_reg32_t)0x400405CCU,
+  [2] = (rw_reg32_t)0x400805CCU,
+};
+
+/** @brief OTG_HS host channel-7 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK7[3] = {
+  [1] = (rw_reg32_t)0x400405ECU,
+  [2] = (rw_reg32_t)0x400805ECU,
+};
+
+/** @brief OTG_HS host channel-8 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK8[3] = {
+  [1] = (rw_reg32_t)0x4004060CU,
+  [2] = (rw_reg32_t)0x4008060CU,
+};
+
+/** @brief OTG_HS host channel-9 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK9[3] = {
+  [1] = (rw_reg32_t)0x4004062CU,
+  [2] = (rw_reg32_t)0x4008062CU,
+};
+
+/** @brief OTG_HS host channel-10 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK10[3] = {
+  [1] = (rw_reg32_t)0x4004064CU,
+  [2] = (rw_reg32_t)0x4008064CU,
+};
+
+/** @brief OTG_HS host channel-11 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK11[3] = {
+  [1] = (rw_reg32_t)0x4004066CU,
+  [2] = (rw_reg32_t)0x4008066CU,
+};
+
+/** @brief OTG_HS host channel-12 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK12[3] = {
+  [1] = (rw_reg32_t)0x40040684U,
+  [2] = (rw_reg32_t)0x40080684U,
+};
+
+/** @brief OTG_HS host channel-13 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK13[3] = {
+  [1] = (rw_reg32_t)0x4004069CU,
+  [2] = (rw_reg32_t)0x4008069CU,
+};
+
+/** @brief OTG_HS host channel-14 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK14[3] = {
+  [1] = (rw_reg32_t)0x400406B4U,
+  [2] = (rw_reg32_t)0x400806B4U,
+};
+
+/** @brief OTG_HS host channel-15 interrupt mask register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTMSK15[3] = {
+  [1] = (rw_reg32_t)0x400406CCU,
+  [2] = (rw_reg32_t)0x400806CCU,
+};
+
+/** @brief OTG_HS host channel-0 characteristics register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCCHARx[3][16] = {
+  [1] = {[0] = (rw_reg32_t)0x40040500U, [1] = (rw_reg32_t)0x40040520U, [2] = (rw_reg32_t)0x40040540U, [3] = (rw_reg32_t)0x40040560U, [4] = (rw_reg32_t)0x40040580U, [5] = (rw_reg32_t)0x400405A0U, [6] = (rw_reg32_t)0x400405C0U, [7] = (rw_reg32_t)0x400405E0U, [8] = (rw_reg32_t)0x40040600U, [9] = (rw_reg32_t)0x40040620U, [10] = (rw_reg32_t)0x40040640U, [11] = (rw_reg32_t)0x40040660U, [12] = (rw_reg32_t)0x40040678U, [13] = (rw_reg32_t)0x40040690U, [14] = (rw_reg32_t)0x400406A8U, [15] = (rw_reg32_t)0x400406C0U},
+  [2] = {[0] = (rw_reg32_t)0x40080500U, [1] = (rw_reg32_t)0x40080520U, [2] = (rw_reg32_t)0x40080540U, [3] = (rw_reg32_t)0x40080560U, [4] = (rw_reg32_t)0x40080580U, [5] = (rw_reg32_t)0x400805A0U, [6] = (rw_reg32_t)0x400805C0U, [7] = (rw_reg32_t)0x400805E0U, [8] = (rw_reg32_t)0x40080600U, [9] = (rw_reg32_t)0x40080620U, [10] = (rw_reg32_t)0x40080640U, [11] = (rw_reg32_t)0x40080660U, [12] = (rw_reg32_t)0x40080678U, [13] = (rw_reg32_t)0x40080690U, [14] = (rw_reg32_t)0x400806A8U, [15] = (rw_reg32_t)0x400806C0U},
+};
+
+/** @brief OTG_HS host channel-0 split control register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCSPLTx[3][16] = {
+  [1] = {[0] = (rw_reg32_t)0x40040504U, [1] = (rw_reg32_t)0x40040524U, [2] = (rw_reg32_t)0x40040544U, [3] = (rw_reg32_t)0x40040564U, [4] = (rw_reg32_t)0x40040584U, [5] = (rw_reg32_t)0x400405A4U, [6] = (rw_reg32_t)0x400405C4U, [7] = (rw_reg32_t)0x400405E4U, [8] = (rw_reg32_t)0x40040604U, [9] = (rw_reg32_t)0x40040624U, [10] = (rw_reg32_t)0x40040644U, [11] = (rw_reg32_t)0x40040664U, [12] = (rw_reg32_t)0x4004067CU, [13] = (rw_reg32_t)0x40040694U, [14] = (rw_reg32_t)0x400406ACU, [15] = (rw_reg32_t)0x400406C4U},
+  [2] = {[0] = (rw_reg32_t)0x40080504U, [1] = (rw_reg32_t)0x40080524U, [2] = (rw_reg32_t)0x40080544U, [3] = (rw_reg32_t)0x40080564U, [4] = (rw_reg32_t)0x40080584U, [5] = (rw_reg32_t)0x400805A4U, [6] = (rw_reg32_t)0x400805C4U, [7] = (rw_reg32_t)0x400805E4U, [8] = (rw_reg32_t)0x40080604U, [9] = (rw_reg32_t)0x40080624U, [10] = (rw_reg32_t)0x40080644U, [11] = (rw_reg32_t)0x40080664U, [12] = (rw_reg32_t)0x4008067CU, [13] = (rw_reg32_t)0x40080694U, [14] = (rw_reg32_t)0x400806ACU, [15] = (rw_reg32_t)0x400806C4U},
+};
+
+/** @brief OTG_HS host channel-11 interrupt register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCINTx[3][16] = {
+  [1] = {[0] = (rw_reg32_t)0x40040508U, [1] = (rw_reg32_t)0x40040528U, [2] = (rw_reg32_t)0x40040548U, [3] = (rw_reg32_t)0x40040568U, [4] = (rw_reg32_t)0x40040588U, [5] = (rw_reg32_t)0x400405A8U, [6] = (rw_reg32_t)0x400405C8U, [7] = (rw_reg32_t)0x400405E8U, [8] = (rw_reg32_t)0x40040608U, [9] = (rw_reg32_t)0x40040628U, [10] = (rw_reg32_t)0x40040648U, [11] = (rw_reg32_t)0x40040668U, [12] = (rw_reg32_t)0x40040680U, [13] = (rw_reg32_t)0x40040698U, [14] = (rw_reg32_t)0x400406B0U, [15] = (rw_reg32_t)0x400406C8U},
+  [2] = {[0] = (rw_reg32_t)0x40080508U, [1] = (rw_reg32_t)0x40080528U, [2] = (rw_reg32_t)0x40080548U, [3] = (rw_reg32_t)0x40080568U, [4] = (rw_reg32_t)0x40080588U, [5] = (rw_reg32_t)0x400805A8U, [6] = (rw_reg32_t)0x400805C8U, [7] = (rw_reg32_t)0x400805E8U, [8] = (rw_reg32_t)0x40080608U, [9] = (rw_reg32_t)0x40080628U, [10] = (rw_reg32_t)0x40080648U, [11] = (rw_reg32_t)0x40080668U, [12] = (rw_reg32_t)0x40080680U, [13] = (rw_reg32_t)0x40080698U, [14] = (rw_reg32_t)0x400806B0U, [15] = (rw_reg32_t)0x400806C8U},
+};
+
+/** @brief OTG_HS host channel-11 transfer size register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCTSIZx[3][16] = {
+  [1] = {[0] = (rw_reg32_t)0x40040510U, [1] = (rw_reg32_t)0x40040530U, [2] = (rw_reg32_t)0x40040550U, [3] = (rw_reg32_t)0x40040570U, [4] = (rw_reg32_t)0x40040590U, [5] = (rw_reg32_t)0x400405B0U, [6] = (rw_reg32_t)0x400405D0U, [7] = (rw_reg32_t)0x400405F0U, [8] = (rw_reg32_t)0x40040610U, [9] = (rw_reg32_t)0x40040630U, [10] = (rw_reg32_t)0x40040650U, [11] = (rw_reg32_t)0x40040670U, [12] = (rw_reg32_t)0x40040688U, [13] = (rw_reg32_t)0x400406A0U, [14] = (rw_reg32_t)0x400406B8U, [15] = (rw_reg32_t)0x400406D0U},
+  [2] = {[0] = (rw_reg32_t)0x40080510U, [1] = (rw_reg32_t)0x40080530U, [2] = (rw_reg32_t)0x40080550U, [3] = (rw_reg32_t)0x40080570U, [4] = (rw_reg32_t)0x40080590U, [5] = (rw_reg32_t)0x400805B0U, [6] = (rw_reg32_t)0x400805D0U, [7] = (rw_reg32_t)0x400805F0U, [8] = (rw_reg32_t)0x40080610U, [9] = (rw_reg32_t)0x40080630U, [10] = (rw_reg32_t)0x40080650U, [11] = (rw_reg32_t)0x40080670U, [12] = (rw_reg32_t)0x40080688U, [13] = (rw_reg32_t)0x400806A0U, [14] = (rw_reg32_t)0x400806B8U, [15] = (rw_reg32_t)0x400806D0U},
+};
+
+/** @brief OTG_HS host channel-0 DMA address register. */
+static rw_reg32_t const OTGx_HS_HOST_OTG_HS_HCDMAx[3][16] = {
+  [1] = {[0] = (rw_reg32_t)0x40040514U, [1] = (rw_reg32_t)0x40040534U, [2] = (rw_reg32_t)0x40040554U, [3] = (rw_reg32_t)0x40040574U, [4] = (rw_reg32_t)0x40040594U, [5] = (rw_reg32_t)0x400405B4U, [6] = (rw_reg32_t)0x400405D4U, [7] = (rw_reg32_t)0x400405F4U, [8] = (rw_reg32_t)0x40040614U, [9] = (rw_reg32_t)0x40040634U, [10] = (rw_reg32_t)0x40040654U, [11] = (rw_reg32_t)0x40040674U, [12] = (rw_reg32_t)0x4004068CU, [13] = (rw_reg32_t)0x400406A4U, [14] = (rw_reg32_t)0x400406BCU, [15] = (rw_reg32_t)0x400406D4U},
+  [2] = {[0] = (rw_reg32_t)0x40080514U, [1] = (rw_reg32_t)0x40080534U, [2] = (rw_reg32_t)0x40080554U, [3] = (rw_reg32_t)0x40080574U, [4] = (rw_reg32_t)0x40080594U, [5] = (rw_reg32_t)0x400805B4U, [6] = (rw_reg32_t)0x400805D4U, [7] = (rw_reg32_t)0x400805F4U, [8] = (rw_reg32_t)0x40080614U, [9] = (rw_reg32_t)0x40080634U, [10] = (rw_reg32_t)0x40080654U, [11] = (rw_reg32_t)0x40080674U, [12] = (rw_reg32_t)0x4008068CU, [13] = (rw_reg32_t)0x400806A4U, [14] = (rw_reg32_t)0x400806BCU, [15] = (rw_reg32_t)0x400806D4U},
+};
+
+/** @subsection OTGx_HS_HOST Register Field Definitions */
+
+static const field32_t OTGx_HS_HOST_OTG_HS_HCFG_FSLSPCS      = {.msk = 0x00000003U, .pos = 0};  /** @brief FS/LS PHY clock select. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCFG_FSLSS        = {.msk = 0x00000004U, .pos = 2};  /** @brief FS- and LS-only support. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HFIR_FRIVL        = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Frame interval. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HFNUM_FRNUM       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Frame number. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HFNUM_FTREM       = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Frame time remaining. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPTXSTS_PTXFSAVL  = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Periodic transmit data FIFO space available. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPTXSTS_PTXQSAV   = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Periodic transmit request queue space available. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPTXSTS_PTXQTOP   = {.msk = 0xFF000000U, .pos = 24}; /** @brief Top of the periodic transmit request queue. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HAINT_HAINT       = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Channel interrupts. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HAINTMSK_HAINTM   = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Channel interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PCSTS        = {.msk = 0x00000001U, .pos = 0};  /** @brief Port connect status. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PCDET        = {.msk = 0x00000002U, .pos = 1};  /** @brief Port connect detected. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PENA         = {.msk = 0x00000004U, .pos = 2};  /** @brief Port enable. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PENCHNG      = {.msk = 0x00000008U, .pos = 3};  /** @brief Port enable/disable change. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_POCA         = {.msk = 0x00000010U, .pos = 4};  /** @brief Port overcurrent active. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_POCCHNG      = {.msk = 0x00000020U, .pos = 5};  /** @brief Port overcurrent change. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PRES         = {.msk = 0x00000040U, .pos = 6};  /** @brief Port resume. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PSUSP        = {.msk = 0x00000080U, .pos = 7};  /** @brief Port suspend. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PRST         = {.msk = 0x00000100U, .pos = 8};  /** @brief Port reset. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PLSTS        = {.msk = 0x00000C00U, .pos = 10}; /** @brief Port line status. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PPWR         = {.msk = 0x00001000U, .pos = 12}; /** @brief Port power. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PTCTL        = {.msk = 0x0001E000U, .pos = 13}; /** @brief Port test control. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HPRT_PSPD         = {.msk = 0x00060000U, .pos = 17}; /** @brief Port speed. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK0_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK1_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK2_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK3_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK4_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK5_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK6_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK7_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK8_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_XFRCM   = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_CHHM    = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_AHBERR  = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_STALLM  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_NAKM    = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_ACKM    = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_NYET    = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_TXERRM  = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_BBERRM  = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_FRMORM  = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK9_DTERRM  = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_STALLM = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK10_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_STALLM = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK11_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_STALLM = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK12_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_STALLM = {.msk = 0x00000008U, .pos = 3};  /** @brief STALLM response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK13_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_STALLM = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAKM response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACKM response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK14_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_XFRCM  = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_CHHM   = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_AHBERR = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_STALL  = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_NAKM   = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_ACKM   = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_NYET   = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_TXERRM = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_BBERRM = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_FRMORM = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTMSK15_DTERRM = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error mask. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_MPSIZ     = {.msk = 0x000007FFU, .pos = 0};  /** @brief Maximum packet size. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_EPNUM     = {.msk = 0x00007800U, .pos = 11}; /** @brief Endpoint number. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_EPDIR     = {.msk = 0x00008000U, .pos = 15}; /** @brief Endpoint direction. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_LSDEV     = {.msk = 0x00020000U, .pos = 17}; /** @brief Low-speed device. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_EPTYP     = {.msk = 0x000C0000U, .pos = 18}; /** @brief Endpoint type. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_MC        = {.msk = 0x00300000U, .pos = 20}; /** @brief Multi Count (MC) / Error Count (EC). */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_DAD       = {.msk = 0x1FC00000U, .pos = 22}; /** @brief Device address. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_ODDFRM    = {.msk = 0x20000000U, .pos = 29}; /** @brief Odd frame. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_CHDIS     = {.msk = 0x40000000U, .pos = 30}; /** @brief Channel disable. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCCHARx_CHENA     = {.msk = 0x80000000U, .pos = 31}; /** @brief Channel enable. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCSPLTx_PRTADDR   = {.msk = 0x0000007FU, .pos = 0};  /** @brief Port address. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCSPLTx_HUBADDR   = {.msk = 0x00003F80U, .pos = 7};  /** @brief Hub address. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCSPLTx_XACTPOS   = {.msk = 0x0000C000U, .pos = 14}; /** @brief XACTPOS. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCSPLTx_COMPLSPLT = {.msk = 0x00010000U, .pos = 16}; /** @brief Do complete split. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCSPLTx_SPLITEN   = {.msk = 0x80000000U, .pos = 31}; /** @brief Split enable. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_XFRC       = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer completed. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_CHH        = {.msk = 0x00000002U, .pos = 1};  /** @brief Channel halted. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_AHBERR     = {.msk = 0x00000004U, .pos = 2};  /** @brief AHB error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_STALL      = {.msk = 0x00000008U, .pos = 3};  /** @brief STALL response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_NAK        = {.msk = 0x00000010U, .pos = 4};  /** @brief NAK response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_ACK        = {.msk = 0x00000020U, .pos = 5};  /** @brief ACK response received/transmitted interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_NYET       = {.msk = 0x00000040U, .pos = 6};  /** @brief Response received interrupt. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_TXERR      = {.msk = 0x00000080U, .pos = 7};  /** @brief Transaction error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_BBERR      = {.msk = 0x00000100U, .pos = 8};  /** @brief Babble error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_FRMOR      = {.msk = 0x00000200U, .pos = 9};  /** @brief Frame overrun. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCINTx_DTERR      = {.msk = 0x00000400U, .pos = 10}; /** @brief Data toggle error. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCTSIZx_XFRSIZ    = {.msk = 0x0007FFFFU, .pos = 0};  /** @brief Transfer size. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCTSIZx_PKTCNT    = {.msk = 0x1FF80000U, .pos = 19}; /** @brief Packet count. */
+static const field32_t OTGx_HS_HOST_OTG_HS_HCTSIZx_DPID      = {.msk = 0x60000000U, .pos = 29}; /** @brief Data PID. */
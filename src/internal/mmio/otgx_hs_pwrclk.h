@@ -0,0 +1,47 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/otgx_hs_pwrclk.h
+ * @authors UW SARP
+ * @brief Registers and fields of OTG1_HS_PWRCLK, OTG2_HS_PWRCLK.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section OTGx_HS_PWRCLK Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated OTGx_HS_PWRCLK Register Definitions */
+
+/** @brief Power and clock gating control register. */
+static rw_reg32_t const OTGx_HS_PWRCLK_OTG_HS_PCGCR[3] = {
+  [1] = (rw_reg32_t)0x40040E00U,
+  [2] = (rw_reg32_t)0x40080E00U,
+};
+
+/** @subsection OTGx_HS_PWRCLK Register Field Definitions */
+
+static const field32_t OTGx_HS_PWRCLK_OTG_HS_PCGCR_STPPCLK  = {.msk = 0x00000001U, .pos = 0}; /** @brief Stop PHY clock. */
+static const field32_t OTGx_HS_PWRCLK_OTG_HS_PCGCR_GATEHCLK = {.msk = 0x00000002U, .pos = 1}; /** @brief Gate HCLK. */
+static const field32_t OTGx_HS_PWRCLK_OTG_HS_PCGCR_PHYSUSP  = {.msk = 0x00000010U, .pos = 4}; /** @brief PHY suspended. */
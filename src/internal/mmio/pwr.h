@@ -0,0 +1,166 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/pwr.h
+ * @authors UW SARP
+ * @brief Registers and fields of PWR.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section PWR Definitions
+ **************************************************************************************************/
+
+/** @subsection PWR Register Definitions */
+
+static rw_reg32_t const PWR_CR1     = (rw_reg32_t)0x58024800U; /** @brief PWR control register 1. */
+static ro_reg32_t const PWR_CSR1    = (ro_reg32_t)0x58024804U; /** @brief PWR control status register 1. */
+static rw_reg32_t const PWR_CR2     = (rw_reg32_t)0x58024808U; /** @brief This register is not reset by wakeup from Standby mode, RESET signal and VDD POR. It is only reset by VSW POR and VSWRST reset. This register shall not be accessed when VSWRST bit in RCC_BDCR register resets the VSW domain.After reset, PWR_CR2 register is write-protected. Prior to modifying its content, the DBP bit in PWR_CR1 register must be set to disable the write protection. */
+static rw_reg32_t const PWR_CR3     = (rw_reg32_t)0x5802480CU; /** @brief Reset only by POR only, not reset by wakeup from Standby mode and RESET pad. The lower byte of this register is written once after POR and shall be written before changing VOS level or ck_sys clock frequency. No limitation applies to the upper bytes.Programming data corresponding to an invalid combination of SDLEVEL, SDEXTHP, SDEN, LDOEN and BYPASS bits (see Table9) will be ignored: data will not be written, the written-once mechanism will lock the register and any further write access will be ignored. The default supply configuration will be kept and the ACTVOSRDY bit in PWR control status register 1 (PWR_CSR1) will go on indicating invalid voltage levels. The system shall be power cycled before writing a new value. */
+static rw_reg32_t const PWR_CPUCR   = (rw_reg32_t)0x58024810U; /** @brief This register allows controlling CPU1 power. */
+static rw_reg32_t const PWR_D3CR    = (rw_reg32_t)0x58024818U; /** @brief This register allows controlling D3 domain power.Following reset VOSRDY will be read 1 by software. */
+static rw_reg32_t const PWR_WKUPCR  = (rw_reg32_t)0x58024820U; /** @brief Reset only by system reset, not reset by wakeup from Standby mode5 wait states are required when writing this register (when clearing a WKUPF bit in PWR_WKUPFR, the AHB write access will complete after the WKUPF has been cleared). */
+static rw_reg32_t const PWR_WKUPFR  = (rw_reg32_t)0x58024824U; /** @brief Reset only by system reset, not reset by wakeup from Standby mode. */
+static rw_reg32_t const PWR_WKUPEPR = (rw_reg32_t)0x58024828U; /** @brief Reset only by system reset, not reset by wakeup from Standby mode. */
+
+/** @subsection PWR Register Field Definitions */
+
+static const field32_t PWR_CR1_LPDS          = {.msk = 0x00000001U, .pos = 0};  /** @brief Low-power Deepsleep with SVOS3 (SVOS4 and SVOS5 always use low-power, regardless of the setting of this bit). */
+static const field32_t PWR_CR1_PVDE          = {.msk = 0x00000010U, .pos = 4};  /** @brief Programmable voltage detector enable. */
+static const field32_t PWR_CR1_PLS           = {.msk = 0x000000E0U, .pos = 5};  /** @brief Programmable voltage detector level selection These bits select the voltage threshold detected by the PVD. Note: Refer to Section Electrical characteristics of the product datasheet for more details. */
+static const field32_t PWR_CR1_DBP           = {.msk = 0x00000100U, .pos = 8};  /** @brief Disable backup domain write protection In reset state, the RCC_BDCR register, the RTC registers (including the backup registers), BREN and MOEN bits in PWR_CR2 register, are protected against parasitic write access. This bit must be set to enable write access to these registers. */
+static const field32_t PWR_CR1_FLPS          = {.msk = 0x00000200U, .pos = 9};  /** @brief Flash low-power mode in DStop mode This bit allows to obtain the best trade-off between low-power consumption and restart time when exiting from DStop mode. When it is set, the Flash memory enters low-power mode when D1 domain is in DStop mode. */
+static const field32_t PWR_CR1_SVOS          = {.msk = 0x0000C000U, .pos = 14}; /** @brief System Stop mode voltage scaling selection These bits control the VCORE voltage level in system Stop mode, to obtain the best trade-off between power consumption and performance. */
+static const field32_t PWR_CR1_AVDEN         = {.msk = 0x00010000U, .pos = 16}; /** @brief Peripheral voltage monitor on VDDA enable. */
+static const field32_t PWR_CR1_ALS           = {.msk = 0x00060000U, .pos = 17}; /** @brief Analog voltage detector level selection These bits select the voltage threshold detected by the AVD. */
+static const field32_t PWR_CSR1_PVDO         = {.msk = 0x00000010U, .pos = 4};  /** @brief Programmable voltage detect output This bit is set and cleared by hardware. It is valid only if the PVD has been enabled by the PVDE bit. Note: since the PVD is disabled in Standby mode, this bit is equal to 0 after Standby or reset until the PVDE bit is set. */
+static const field32_t PWR_CSR1_ACTVOSRDY    = {.msk = 0x00002000U, .pos = 13}; /** @brief Voltage levels ready bit for currently used VOS and SDLEVEL This bit is set to 1 by hardware when the voltage regulator and the SD converter are both disabled and Bypass mode is selected in PWR control register 3 (PWR_CR3). */
+static const field32_t PWR_CSR1_ACTVOS       = {.msk = 0x0000C000U, .pos = 14}; /** @brief VOS currently applied for VCORE voltage scaling selection. These bits reflect the last VOS value applied to the PMU. */
+static const field32_t PWR_CSR1_AVDO         = {.msk = 0x00010000U, .pos = 16}; /** @brief Analog voltage detector output on VDDA This bit is set and cleared by hardware. It is valid only if AVD on VDDA is enabled by the AVDEN bit. Note: Since the AVD is disabled in Standby mode, this bit is equal to 0 after Standby or reset until the AVDEN bit is set. */
+static const field32_t PWR_CR2_BREN          = {.msk = 0x00000001U, .pos = 0};  /** @brief Backup regulator enable When set, the Backup regulator (used to maintain the backup RAM content in Standby and VBAT modes) is enabled. If BREN is reset, the backup regulator is switched off. The backup RAM can still be used in Run and Stop modes. However, its content will be lost in Standby and VBAT modes. If BREN is set, the application must wait till the Backup Regulator Ready flag (BRRDY) is set to indicate that the data written into the SRAM will be maintained in Standby and VBAT modes. */
+static const field32_t PWR_CR2_MONEN         = {.msk = 0x00000010U, .pos = 4};  /** @brief VBAT and temperature monitoring enable When set, the VBAT supply and temperature monitoring is enabled. */
+static const field32_t PWR_CR2_BRRDY         = {.msk = 0x00010000U, .pos = 16}; /** @brief Backup regulator ready This bit is set by hardware to indicate that the Backup regulator is ready. */
+static const field32_t PWR_CR2_VBATL         = {.msk = 0x00100000U, .pos = 20}; /** @brief VBAT level monitoring versus low threshold. */
+static const field32_t PWR_CR2_VBATH         = {.msk = 0x00200000U, .pos = 21}; /** @brief VBAT level monitoring versus high threshold. */
+static const field32_t PWR_CR2_TEMPL         = {.msk = 0x00400000U, .pos = 22}; /** @brief Temperature level monitoring versus low threshold. */
+static const field32_t PWR_CR2_TEMPH         = {.msk = 0x00800000U, .pos = 23}; /** @brief Temperature level monitoring versus high threshold. */
+static const field32_t PWR_CR3_BYPASS        = {.msk = 0x00000001U, .pos = 0};  /** @brief Power management unit bypass. */
+static const field32_t PWR_CR3_LDOEN         = {.msk = 0x00000002U, .pos = 1};  /** @brief Low drop-out regulator enable. */
+static const field32_t PWR_CR3_SDEN          = {.msk = 0x00000004U, .pos = 2};  /** @brief SD converter Enable. */
+static const field32_t PWR_CR3_VBE           = {.msk = 0x00000100U, .pos = 8};  /** @brief VBAT charging enable. */
+static const field32_t PWR_CR3_VBRS          = {.msk = 0x00000200U, .pos = 9};  /** @brief VBAT charging resistor selection. */
+static const field32_t PWR_CR3_USB33DEN      = {.msk = 0x01000000U, .pos = 24}; /** @brief VDD33USB voltage level detector enable. */
+static const field32_t PWR_CR3_USBREGEN      = {.msk = 0x02000000U, .pos = 25}; /** @brief USB regulator enable. */
+static const field32_t PWR_CR3_USB33RDY      = {.msk = 0x04000000U, .pos = 26}; /** @brief USB supply ready. */
+static const field32_t PWR_CPUCR_PDDS_D1     = {.msk = 0x00000001U, .pos = 0};  /** @brief D1 domain Power Down Deepsleep selection. This bit allows CPU1 to define the Deepsleep mode for D1 domain. */
+static const field32_t PWR_CPUCR_PDDS_D2     = {.msk = 0x00000002U, .pos = 1};  /** @brief D2 domain Power Down Deepsleep. This bit allows CPU1 to define the Deepsleep mode for D2 domain. */
+static const field32_t PWR_CPUCR_PDDS_D3     = {.msk = 0x00000004U, .pos = 2};  /** @brief System D3 domain Power Down Deepsleep. This bit allows CPU1 to define the Deepsleep mode for System D3 domain. */
+static const field32_t PWR_CPUCR_STOPF       = {.msk = 0x00000020U, .pos = 5};  /** @brief STOP flag This bit is set by hardware and cleared only by any reset or by setting the CPU1 CSSF bit. */
+static const field32_t PWR_CPUCR_SBF         = {.msk = 0x00000040U, .pos = 6};  /** @brief System Standby flag This bit is set by hardware and cleared only by a POR (Power-on Reset) or by setting the CPU1 CSSF bit. */
+static const field32_t PWR_CPUCR_SBF_D1      = {.msk = 0x00000080U, .pos = 7};  /** @brief D1 domain DStandby flag This bit is set by hardware and cleared by any system reset or by setting the CPU1 CSSF bit. Once set, this bit can be cleared only when the D1 domain is no longer in DStandby mode. */
+static const field32_t PWR_CPUCR_SBF_D2      = {.msk = 0x00000100U, .pos = 8};  /** @brief D2 domain DStandby flag This bit is set by hardware and cleared by any system reset or by setting the CPU1 CSSF bit. Once set, this bit can be cleared only when the D2 domain is no longer in DStandby mode. */
+static const field32_t PWR_CPUCR_CSSF        = {.msk = 0x00000200U, .pos = 9};  /** @brief Clear D1 domain CPU1 Standby, Stop and HOLD flags (always read as 0) This bit is cleared to 0 by hardware. */
+static const field32_t PWR_CPUCR_RUN_D3      = {.msk = 0x00000800U, .pos = 11}; /** @brief Keep system D3 domain in Run mode regardless of the CPU sub-systems modes. */
+static const field32_t PWR_D3CR_VOSRDY       = {.msk = 0x00002000U, .pos = 13}; /** @brief VOS Ready bit for VCORE voltage scaling output selection. This bit is set to 1 by hardware when Bypass mode is selected in PWR control register 3 (PWR_CR3). */
+static const field32_t PWR_D3CR_VOS          = {.msk = 0x0000C000U, .pos = 14}; /** @brief Voltage scaling selection according to performance These bits control the VCORE voltage level and allow to obtains the best trade-off between power consumption and performance: When increasing the performance, the voltage scaling shall be changed before increasing the system frequency. When decreasing performance, the system frequency shall first be decreased before changing the voltage scaling. */
+static const field32_t PWR_WKUPCR_WKUPC      = {.msk = 0x0000003FU, .pos = 0};  /** @brief Clear Wakeup pin flag for WKUP. These bits are always read as 0. */
+static const field32_t PWR_WKUPFR_WKUPF1     = {.msk = 0x00000001U, .pos = 0};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPF2     = {.msk = 0x00000002U, .pos = 1};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPF3     = {.msk = 0x00000004U, .pos = 2};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPF4     = {.msk = 0x00000008U, .pos = 3};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPF5     = {.msk = 0x00000010U, .pos = 4};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPF6     = {.msk = 0x00000020U, .pos = 5};  /** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPEPR_WKUPEN1   = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPEN2   = {.msk = 0x00000002U, .pos = 1};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPEN3   = {.msk = 0x00000004U, .pos = 2};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPEN4   = {.msk = 0x00000008U, .pos = 3};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPEN5   = {.msk = 0x00000010U, .pos = 4};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPEN6   = {.msk = 0x00000020U, .pos = 5};  /** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPP1    = {.msk = 0x00000100U, .pos = 8};  /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPP2    = {.msk = 0x00000200U, .pos = 9};  /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPP3    = {.msk = 0x00000400U, .pos = 10}; /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPP4    = {.msk = 0x00000800U, .pos = 11}; /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPP5    = {.msk = 0x00001000U, .pos = 12}; /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPP6    = {.msk = 0x00002000U, .pos = 13}; /** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD1 = {.msk = 0x00030000U, .pos = 16}; /** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD2 = {.msk = 0x000C0000U, .pos = 18}; /** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD3 = {.msk = 0x00300000U, .pos = 20}; /** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD4 = {.msk = 0x00C00000U, .pos = 22}; /** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD5 = {.msk = 0x03000000U, .pos = 24}; /** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPD6 = {.msk = 0x0C000000U, .pos = 26}; /** @brief Wakeup pin pull configuration for WKUP(truncate(n/2)-7) These bits define the I/O pad pull configuration used when WKUPEN(truncate(n/2)-7) = 1. The associated GPIO port pull configuration shall be set to the same value or to 00. The Wakeup pin pull configuration is kept in Standby mode. */
+
+/** @subsection Enumerated PWR Register Field Definitions */
+
+/** @brief D1 domain Power Down Deepsleep selection. This bit allows CPU1 to define the Deepsleep mode for D1 domain. */
+static const field32_t PWR_CPUCR_PDDS_Dx[4] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief D1 domain DStandby flag This bit is set by hardware and cleared by any system reset or by setting the CPU1 CSSF bit. Once set, this bit can be cleared only when the D1 domain is no longer in DStandby mode. */
+static const field32_t PWR_CPUCR_SBF_Dx[3] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief Wakeup pin WKUPF flag. This bit is set by hardware and cleared only by a Reset pin or by setting the WKUPCn+1 bit in the PWR wakeup clear register (PWR_WKUPCR). */
+static const field32_t PWR_WKUPFR_WKUPFx[7] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Enable Wakeup Pin WKUPn+1 Each bit is set and cleared by software. Note: An additional wakeup event is detected if WKUPn+1 pin is enabled (by setting the WKUPENn+1 bit) when WKUPn+1 pin level is already high when WKUPPn+1 selects rising edge, or low when WKUPPn+1 selects falling edge. */
+static const field32_t PWR_WKUPEPR_WKUPENx[7] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+  [5] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Wakeup pin polarity bit for WKUPn-7 These bits define the polarity used for event detection on WKUPn-7 external wakeup pin. */
+static const field32_t PWR_WKUPEPR_WKUPPx[7] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+  [6] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief Wakeup pin pull configuration. */
+static const field32_t PWR_WKUPEPR_WKUPPUPDx[7] = {
+  [1] = {.msk = 0x00030000U, .pos = 16},
+  [2] = {.msk = 0x000C0000U, .pos = 18},
+  [3] = {.msk = 0x00300000U, .pos = 20},
+  [4] = {.msk = 0x00C00000U, .pos = 22},
+  [5] = {.msk = 0x03000000U, .pos = 24},
+  [6] = {.msk = 0x0C000000U, .pos = 26},
+};
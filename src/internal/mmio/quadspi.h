@@ -0,0 +1,96 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/quadspi.h
+ * @authors UW SARP
+ * @brief Registers and fields of QUADSPI.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section QUADSPI Definitions
+ **************************************************************************************************/
+
+/** @subsection QUADSPI Register Definitions */
+
+static rw_reg32_t const QUADSPI_CR    = (rw_reg32_t)0x52005000U; /** @brief QUADSPI control register. */
+static rw_reg32_t const QUADSPI_DCR   = (rw_reg32_t)0x52005004U; /** @brief QUADSPI device configuration register. */
+static ro_reg32_t const QUADSPI_SR    = (ro_reg32_t)0x52005008U; /** @brief QUADSPI status register. */
+static rw_reg32_t const QUADSPI_FCR   = (rw_reg32_t)0x5200500CU; /** @brief QUADSPI flag clear register. */
+static rw_reg32_t const QUADSPI_DLR   = (rw_reg32_t)0x52005010U; /** @brief QUADSPI data length register. */
+static rw_reg32_t const QUADSPI_CCR   = (rw_reg32_t)0x52005014U; /** @brief QUADSPI communication configuration register. */
+static rw_reg32_t const QUADSPI_AR    = (rw_reg32_t)0x52005018U; /** @brief QUADSPI address register. */
+static rw_reg32_t const QUADSPI_ABR   = (rw_reg32_t)0x5200501CU; /** @brief QUADSPI alternate bytes registers. */
+static rw_reg32_t const QUADSPI_DR    = (rw_reg32_t)0x52005020U; /** @brief QUADSPI data register. */
+static rw_reg32_t const QUADSPI_PSMKR = (rw_reg32_t)0x52005024U; /** @brief QUADSPI polling status mask register. */
+static rw_reg32_t const QUADSPI_PSMAR = (rw_reg32_t)0x52005028U; /** @brief QUADSPI polling status match register. */
+static rw_reg32_t const QUADSPI_PIR   = (rw_reg32_t)0x5200502CU; /** @brief QUADSPI polling interval register. */
+static rw_reg32_t const QUADSPI_LPTR  = (rw_reg32_t)0x52005030U; /** @brief QUADSPI low-power timeout register. */
+
+/** @subsection QUADSPI Register Field Definitions */
+
+static const field32_t QUADSPI_CR_EN           = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable Enable the QUADSPI. */
+static const field32_t QUADSPI_CR_ABORT        = {.msk = 0x00000002U, .pos = 1};  /** @brief Abort request This bit aborts the on-going command sequence. It is automatically reset once the abort is complete. This bit stops the current transfer. In polling mode or memory-mapped mode, this bit also reset the APM bit or the DM bit. */
+static const field32_t QUADSPI_CR_DMAEN        = {.msk = 0x00000004U, .pos = 2};  /** @brief DMA enable In indirect mode, DMA can be used to input or output data via the QUADSPI_DR register. DMA transfers are initiated when the FIFO threshold flag, FTF, is set. */
+static const field32_t QUADSPI_CR_TCEN         = {.msk = 0x00000008U, .pos = 3};  /** @brief Timeout counter enable This bit is valid only when memory-mapped mode (FMODE = 11) is selected. Activating this bit causes the chip select (nCS) to be released (and thus reduces consumption) if there has not been an access after a certain amount of time, where this time is defined by TIMEOUT[15:0] (QUADSPI_LPTR). Enable the timeout counter. By default, the QUADSPI never stops its prefetch operation, keeping the previous read operation active with nCS maintained low, even if no access to the Flash memory occurs for a long time. Since Flash memories tend to consume more when nCS is held low, the application might want to activate the timeout counter (TCEN = 1, QUADSPI_CR[3]) so that nCS is released after a period of TIMEOUT[15:0] (QUADSPI_LPTR) cycles have elapsed without an access since when the FIFO becomes full with prefetch data. This bit can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_CR_SSHIFT       = {.msk = 0x00000010U, .pos = 4};  /** @brief Sample shift By default, the QUADSPI samples data 1/2 of a CLK cycle after the data is driven by the Flash memory. This bit allows the data is to be sampled later in order to account for external signal delays. Firmware must assure that SSHIFT = 0 when in DDR mode (when DDRM = 1). This field can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_CR_DFM          = {.msk = 0x00000040U, .pos = 6};  /** @brief Dual-flash mode This bit activates dual-flash mode, where two external Flash memories are used simultaneously to double throughput and capacity. This bit can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_CR_FSEL         = {.msk = 0x00000080U, .pos = 7};  /** @brief Flash memory selection This bit selects the Flash memory to be addressed in single flash mode (when DFM = 0). This bit can be modified only when BUSY = 0. This bit is ignored when DFM = 1. */
+static const field32_t QUADSPI_CR_FTHRES       = {.msk = 0x00001F00U, .pos = 8};  /** @brief FIFO threshold level Defines, in indirect mode, the threshold number of bytes in the FIFO that will cause the FIFO threshold flag (FTF, QUADSPI_SR[2]) to be set. In indirect write mode (FMODE = 00): ... In indirect read mode (FMODE = 01): ... If DMAEN = 1, then the DMA controller for the corresponding channel must be disabled before changing the FTHRES value. */
+static const field32_t QUADSPI_CR_TEIE         = {.msk = 0x00010000U, .pos = 16}; /** @brief Transfer error interrupt enable This bit enables the transfer error interrupt. */
+static const field32_t QUADSPI_CR_TCIE         = {.msk = 0x00020000U, .pos = 17}; /** @brief Transfer complete interrupt enable This bit enables the transfer complete interrupt. */
+static const field32_t QUADSPI_CR_FTIE         = {.msk = 0x00040000U, .pos = 18}; /** @brief FIFO threshold interrupt enable This bit enables the FIFO threshold interrupt. */
+static const field32_t QUADSPI_CR_SMIE         = {.msk = 0x00080000U, .pos = 19}; /** @brief Status match interrupt enable This bit enables the status match interrupt. */
+static const field32_t QUADSPI_CR_TOIE         = {.msk = 0x00100000U, .pos = 20}; /** @brief TimeOut interrupt enable This bit enables the TimeOut interrupt. */
+static const field32_t QUADSPI_CR_APMS         = {.msk = 0x00400000U, .pos = 22}; /** @brief Automatic poll mode stop This bit determines if automatic polling is stopped after a match. This bit can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_CR_PMM          = {.msk = 0x00800000U, .pos = 23}; /** @brief Polling match mode This bit indicates which method should be used for determining a match during automatic polling mode. This bit can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_CR_PRESCALER    = {.msk = 0xFF000000U, .pos = 24}; /** @brief Clock prescaler. */
+static const field32_t QUADSPI_DCR_CKMODE      = {.msk = 0x00000001U, .pos = 0};  /** @brief Indicates the level that clk takes between command. */
+static const field32_t QUADSPI_DCR_CSHT        = {.msk = 0x00000700U, .pos = 8};  /** @brief Chip select high time CSHT+1 defines the minimum number of CLK cycles which the chip select (nCS) must remain high between commands issued to the Flash memory. ... This field can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_DCR_FSIZE       = {.msk = 0x001F0000U, .pos = 16}; /** @brief Flash memory size This field defines the size of external memory using the following formula: Number of bytes in Flash memory = 2[FSIZE+1] FSIZE+1 is effectively the number of address bits required to address the Flash memory. The Flash memory capacity can be up to 4GB (addressed using 32 bits) in indirect mode, but the addressable space in memory-mapped mode is limited to 256MB. If DFM = 1, FSIZE indicates the total capacity of the two Flash memories together. This field can be modified only when BUSY = 0. */
+static const field32_t QUADSPI_SR_TEF          = {.msk = 0x00000001U, .pos = 0};  /** @brief Transfer error flag This bit is set in indirect mode when an invalid address is being accessed in indirect mode. It is cleared by writing 1 to CTEF. */
+static const field32_t QUADSPI_SR_TCF          = {.msk = 0x00000002U, .pos = 1};  /** @brief Transfer complete flag This bit is set in indirect mode when the programmed number of data has been transferred or in any mode when the transfer has been aborted.It is cleared by writing 1 to CTCF. */
+static const field32_t QUADSPI_SR_FTF          = {.msk = 0x00000004U, .pos = 2};  /** @brief FIFO threshold flag In indirect mode, this bit is set when the FIFO threshold has been reached, or if there is any data left in the FIFO after reads from the Flash memory are complete. It is cleared automatically as soon as threshold condition is no longer true. In automatic polling mode this bit is set every time the status register is read, and the bit is cleared when the data register is read. */
+static const field32_t QUADSPI_SR_SMF          = {.msk = 0x00000008U, .pos = 3};  /** @brief Status match flag This bit is set in automatic polling mode when the unmasked received data matches the corresponding bits in the match register (QUADSPI_PSMAR). It is cleared by writing 1 to CSMF. */
+static const field32_t QUADSPI_SR_TOF          = {.msk = 0x00000010U, .pos = 4};  /** @brief Timeout flag This bit is set when timeout occurs. It is cleared by writing 1 to CTOF. */
+static const field32_t QUADSPI_SR_BUSY         = {.msk = 0x00000020U, .pos = 5};  /** @brief Busy This bit is set when an operation is on going. This bit clears automatically when the operation with the Flash memory is finished and the FIFO is empty. */
+static const field32_t QUADSPI_SR_FLEVEL       = {.msk = 0x00003F00U, .pos = 8};  /** @brief FIFO level This field gives the number of valid bytes which are being held in the FIFO. FLEVEL = 0 when the FIFO is empty, and 16 when it is full. In memory-mapped mode and in automatic status polling mode, FLEVEL is zero. */
+static const field32_t QUADSPI_FCR_CTEF        = {.msk = 0x00000001U, .pos = 0};  /** @brief Clear transfer error flag Writing 1 clears the TEF flag in the QUADSPI_SR register. */
+static const field32_t QUADSPI_FCR_CTCF        = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear transfer complete flag Writing 1 clears the TCF flag in the QUADSPI_SR register. */
+static const field32_t QUADSPI_FCR_CSMF        = {.msk = 0x00000008U, .pos = 3};  /** @brief Clear status match flag Writing 1 clears the SMF flag in the QUADSPI_SR register. */
+static const field32_t QUADSPI_FCR_CTOF        = {.msk = 0x00000010U, .pos = 4};  /** @brief Clear timeout flag Writing 1 clears the TOF flag in the QUADSPI_SR register. */
+static const field32_t QUADSPI_CCR_INSTRUCTION = {.msk = 0x000000FFU, .pos = 0};  /** @brief Instruction Instruction to be send to the external SPI device. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_IMODE       = {.msk = 0x00000300U, .pos = 8};  /** @brief Instruction mode This field defines the instruction phase mode of operation: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_ADMODE      = {.msk = 0x00000C00U, .pos = 10}; /** @brief Address mode This field defines the address phase mode of operation: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_ADSIZE      = {.msk = 0x00003000U, .pos = 12}; /** @brief Address size This bit defines address size: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_ABMODE      = {.msk = 0x0000C000U, .pos = 14}; /** @brief Alternate bytes mode This field defines the alternate-bytes phase mode of operation: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_ABSIZE      = {.msk = 0x00030000U, .pos = 16}; /** @brief Alternate bytes size This bit defines alternate bytes size: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_DCYC        = {.msk = 0x007C0000U, .pos = 18}; /** @brief Number of dummy cycles This field defines the duration of the dummy phase. In both SDR and DDR modes, it specifies a number of CLK cycles (0-31). This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_DMODE       = {.msk = 0x03000000U, .pos = 24}; /** @brief Data mode This field defines the data phases mode of operation: This field also determines the dummy phase mode of operation. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_FMODE       = {.msk = 0x0C000000U, .pos = 26}; /** @brief Functional mode This field defines the QUADSPI functional mode of operation. If DMAEN = 1 already, then the DMA controller for the corresponding channel must be disabled before changing the FMODE value. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_SIOO        = {.msk = 0x10000000U, .pos = 28}; /** @brief Send instruction only once mode See Section15.3.11: Sending the instruction only once on page13. This bit has no effect when IMODE = 00. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_DHHC        = {.msk = 0x40000000U, .pos = 30}; /** @brief DDR hold Delay the data output by 1/4 of the QUADSPI output clock cycle in DDR mode: This feature is only active in DDR mode. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_CCR_DDRM        = {.msk = 0x80000000U, .pos = 31}; /** @brief Double data rate mode This bit sets the DDR mode for the address, alternate byte and data phase: This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_PIR_INTERVAL    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Polling interval Number of CLK cycles between to read during automatic polling phases. This field can be written only when BUSY = 0. */
+static const field32_t QUADSPI_LPTR_TIMEOUT    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Timeout period After each access in memory-mapped mode, the QUADSPI prefetches the subsequent bytes and holds these bytes in the FIFO. This field indicates how many CLK cycles the QUADSPI waits after the FIFO becomes full until it raises nCS, putting the Flash memory in a lower-consumption state. This field can be written only when BUSY = 0. */
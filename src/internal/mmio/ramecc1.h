@@ -0,0 +1,109 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/ramecc1.h
+ * @authors UW SARP
+ * @brief Registers and fields of RAMECC1.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RAMECC1 Definitions
+ **************************************************************************************************/
+
+/** @subsection RAMECC1 Register Definitions */
+
+static rw_reg32_t const RAMECC1_IER    = (rw_reg32_t)0x52009000U; /** @brief RAMECC interrupt enable register. */
+static rw_reg32_t const RAMECC1_M1CR   = (rw_reg32_t)0x52009020U; /** @brief RAMECC monitor x configuration register. */
+static rw_reg32_t const RAMECC1_M1SR   = (rw_reg32_t)0x52009024U; /** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC1_M1FAR  = (rw_reg32_t)0x52009028U; /** @brief RAMECC monitor x failing address register. */
+static rw_reg32_t const RAMECC1_M1FDRL = (rw_reg32_t)0x5200902CU; /** @brief RAMECC monitor x failing data low register. */
+static rw_reg32_t const RAMECC1_M1FDRH = (rw_reg32_t)0x52009030U; /** @brief RAMECC monitor x failing data high register. */
+static rw_reg32_t const RAMECC1_M1FECR = (rw_reg32_t)0x52009034U; /** @brief RAMECC monitor x failing ECC error code register. */
+static rw_reg32_t const RAMECC1_M2CR   = (rw_reg32_t)0x52009040U; /** @brief RAMECC monitor x configuration register. */
+static rw_reg32_t const RAMECC1_M2SR   = (rw_reg32_t)0x52009044U; /** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC1_M2FAR  = (rw_reg32_t)0x52009048U; /** @brief RAMECC monitor x failing address register. */
+static rw_reg32_t const RAMECC1_M2FDRL = (rw_reg32_t)0x5200904CU; /** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC1_M2FDRH = (ro_reg32_t)0x52009050U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC1_M2FECR = (ro_reg32_t)0x52009058U; /** @brief RAMECC monitor x failing ECC error code register. */
+static ro_reg32_t const RAMECC1_M3CR   = (ro_reg32_t)0x52009060U; /** @brief RAMECC monitor x configuration register. */
+static ro_reg32_t const RAMECC1_M3SR   = (ro_reg32_t)0x52009064U; /** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC1_M3FAR  = (rw_reg32_t)0x52009068U; /** @brief RAMECC monitor x failing address register. */
+static ro_reg32_t const RAMECC1_M3FDRL = (ro_reg32_t)0x5200906CU; /** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC1_M3FDRH = (ro_reg32_t)0x52009070U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC1_M3FECR = (ro_reg32_t)0x5200907CU; /** @brief RAMECC monitor x failing ECC error code register. */
+static ro_reg32_t const RAMECC1_M4CR   = (ro_reg32_t)0x52009080U; /** @brief RAMECC monitor x configuration register. */
+static ro_reg32_t const RAMECC1_M4SR   = (ro_reg32_t)0x52009084U; /** @brief RAMECC monitor x status register. */
+static ro_reg32_t const RAMECC1_M4FAR  = (ro_reg32_t)0x52009088U; /** @brief RAMECC monitor x failing address register. */
+static rw_reg32_t const RAMECC1_M4FDRL = (rw_reg32_t)0x5200908CU; /** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC1_M4FDRH = (ro_reg32_t)0x52009090U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC1_M4FECR = (ro_reg32_t)0x52009090U; /** @brief RAMECC monitor x failing ECC error code register. */
+static ro_reg32_t const RAMECC1_M5CR   = (ro_reg32_t)0x520090A0U; /** @brief RAMECC monitor x configuration register. */
+static rw_reg32_t const RAMECC1_M5SR   = (rw_reg32_t)0x520090A4U; /** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC1_M5FAR  = (rw_reg32_t)0x520090A8U; /** @brief RAMECC monitor x failing address register. */
+static ro_reg32_t const RAMECC1_M5FDRL = (ro_reg32_t)0x520090ACU; /** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC1_M5FDRH = (ro_reg32_t)0x520090B0U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC1_M5FECR = (ro_reg32_t)0x520090B4U; /** @brief RAMECC monitor x failing ECC error code register. */
+
+/** @subsection RAMECC1 Register Field Definitions */
+
+static const field32_t RAMECC1_IER_GIE          = {.msk = 0x00000001U, .pos = 0}; /** @brief Global interrupt enable. */
+static const field32_t RAMECC1_IER_GECCSEIE_    = {.msk = 0x00000002U, .pos = 1}; /** @brief Global ECC single error interrupt enable. */
+static const field32_t RAMECC1_IER_GECCDEIE     = {.msk = 0x00000004U, .pos = 2}; /** @brief Global ECC double error interrupt enable. */
+static const field32_t RAMECC1_IER_GECCDEBWIE   = {.msk = 0x00000008U, .pos = 3}; /** @brief Global ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1CR_ECCSEIE     = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC1_M1CR_ECCDEIE     = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC1_M1CR_ECCDEBWIE   = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1CR_ECCELEN     = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC1_M1SR_ECCSEIE     = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC1_M1SR_ECCDEIE     = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC1_M1SR_ECCDEBWIE   = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1SR_ECCELEN     = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC1_M1FAR_ECCSEIE    = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC1_M1FAR_ECCDEIE    = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC1_M1FAR_ECCDEBWIE  = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1FAR_ECCELEN    = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC1_M1FDRL_ECCSEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC1_M1FDRL_ECCDEIE   = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC1_M1FDRL_ECCDEBWIE = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1FDRL_ECCELEN   = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC1_M1FDRH_ECCSEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC1_M1FDRH_ECCDEIE   = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC1_M1FDRH_ECCDEBWIE = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC1_M1FDRH_ECCELEN   = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC1_M1FECR_SEDCF     = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC1_M1FECR_DEDF      = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC1_M1FECR_DEBWDF    = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
+static const field32_t RAMECC1_M2CR_SEDCF       = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC1_M2CR_DEDF        = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC1_M2CR_DEBWDF      = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
+static const field32_t RAMECC1_M2SR_SEDCF       = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC1_M2SR_DEDF        = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC1_M2SR_DEBWDF      = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
+static const field32_t RAMECC1_M2FAR_SEDCF      = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC1_M2FAR_DEDF       = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC1_M2FAR_DEBWDF     = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
+static const field32_t RAMECC1_M2FDRL_SEDCF     = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC1_M2FDRL_DEDF      = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC1_M2FDRL_DEBWDF    = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
@@ -0,0 +1,103 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/ramecc2.h
+ * @authors UW SARP
+ * @brief Registers and fields of RAMECC2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RAMECC2 Definitions
+ **************************************************************************************************/
+
+/** @subsection RAMECC2 Register Definitions */
+
+static rw_reg32_t const RAMECC2_IER    = (rw_reg32_t)0x48023000U; /** @brief RAMECC interrupt enable register. */
+static ro_reg32_t const RAMECC2_M1FDRH = (ro_reg32_t)0x48023030U; /** @brief RAMECC monitor x failing data high register. */
+static rw_reg32_t const RAMECC2_M2FDRH = (rw_reg32_t)0x48023050U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC2_M3FDRH = (ro_reg32_t)0x48023070U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC2_M4FDRH = (ro_reg32_t)0x48023090U; /** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC2_M5FDRH = (ro_reg32_t)0x480230B0U; /** @brief RAMECC monitor x failing data high register. */
+
+/** @subsection Enumerated RAMECC2 Register Definitions */
+
+/** @brief RAMECC monitor x configuration register. */
+static rw_reg32_t const RAMECC2_MxCR[6] = {
+  [1] = (rw_reg32_t)0x48023020U,
+  [2] = (rw_reg32_t)0x48023040U,
+  [3] = (rw_reg32_t)0x48023060U,
+  [4] = (rw_reg32_t)0x48023080U,
+  [5] = (rw_reg32_t)0x480230A0U,
+};
+
+/** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC2_MxSR[6] = {
+  [1] = (rw_reg32_t)0x48023024U,
+  [2] = (rw_reg32_t)0x48023044U,
+  [3] = (rw_reg32_t)0x48023064U,
+  [4] = (rw_reg32_t)0x48023084U,
+  [5] = (rw_reg32_t)0x480230A4U,
+};
+
+/** @brief RAMECC monitor x failing address register. */
+static ro_reg32_t const RAMECC2_MxFAR[6] = {
+  [1] = (ro_reg32_t)0x48023028U,
+  [2] = (ro_reg32_t)0x48023048U,
+  [3] = (ro_reg32_t)0x48023068U,
+  [4] = (ro_reg32_t)0x48023088U,
+  [5] = (ro_reg32_t)0x480230A8U,
+};
+
+/** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC2_MxFDRL[6] = {
+  [1] = (ro_reg32_t)0x4802302CU,
+  [2] = (ro_reg32_t)0x4802304CU,
+  [3] = (ro_reg32_t)0x4802306CU,
+  [4] = (ro_reg32_t)0x4802308CU,
+  [5] = (ro_reg32_t)0x480230ACU,
+};
+
+/** @brief RAMECC monitor x failing ECC error code register. */
+static rw_reg32_t const RAMECC2_MxFECR[6] = {
+  [1] = (rw_reg32_t)0x48023034U,
+  [2] = (rw_reg32_t)0x48023058U,
+  [3] = (rw_reg32_t)0x4802307CU,
+  [4] = (rw_reg32_t)0x48023090U,
+  [5] = (rw_reg32_t)0x480230B4U,
+};
+
+/** @subsection RAMECC2 Register Field Definitions */
+
+static const field32_t RAMECC2_IER_GIE        = {.msk = 0x00000001U, .pos = 0}; /** @brief Global interrupt enable. */
+static const field32_t RAMECC2_IER_GECCSEIE_  = {.msk = 0x00000002U, .pos = 1}; /** @brief Global ECC single error interrupt enable. */
+static const field32_t RAMECC2_IER_GECCDEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief Global ECC double error interrupt enable. */
+static const field32_t RAMECC2_IER_GECCDEBWIE = {.msk = 0x00000008U, .pos = 3}; /** @brief Global ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC2_MxCR_ECCSEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC2_MxCR_ECCDEIE   = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC2_MxCR_ECCDEBWIE = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC2_MxCR_ECCELEN   = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC2_MxSR_SEDCF     = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC2_MxSR_DEDF      = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC2_MxSR_DEBWDF    = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
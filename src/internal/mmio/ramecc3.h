@@ -0,0 +1,89 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/ramecc3.h
+ * @authors UW SARP
+ * @brief Registers and fields of RAMECC3.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RAMECC3 Definitions
+ **************************************************************************************************/
+
+/** @subsection RAMECC3 Register Definitions */
+
+static rw_reg32_t const RAMECC3_IER = (rw_reg32_t)0x58027000U; /** @brief RAMECC interrupt enable register. */
+
+/** @subsection Enumerated RAMECC3 Register Definitions */
+
+/** @brief RAMECC monitor x configuration register. */
+static rw_reg32_t const RAMECC3_MxCR[3] = {
+  [1] = (rw_reg32_t)0x58027020U,
+  [2] = (rw_reg32_t)0x58027040U,
+};
+
+/** @brief RAMECC monitor x status register. */
+static rw_reg32_t const RAMECC3_MxSR[3] = {
+  [1] = (rw_reg32_t)0x58027024U,
+  [2] = (rw_reg32_t)0x58027044U,
+};
+
+/** @brief RAMECC monitor x failing address register. */
+static ro_reg32_t const RAMECC3_MxFAR[3] = {
+  [1] = (ro_reg32_t)0x58027028U,
+  [2] = (ro_reg32_t)0x58027048U,
+};
+
+/** @brief RAMECC monitor x failing data low register. */
+static ro_reg32_t const RAMECC3_MxFDRL[3] = {
+  [1] = (ro_reg32_t)0x5802702CU,
+  [2] = (ro_reg32_t)0x5802704CU,
+};
+
+/** @brief RAMECC monitor x failing data high register. */
+static ro_reg32_t const RAMECC3_MxFDRH[3] = {
+  [1] = (ro_reg32_t)0x58027030U,
+  [2] = (ro_reg32_t)0x58027050U,
+};
+
+/** @brief RAMECC monitor x failing ECC error code register. */
+static rw_reg32_t const RAMECC3_MxFECR[3] = {
+  [1] = (rw_reg32_t)0x58027034U,
+  [2] = (rw_reg32_t)0x58027058U,
+};
+
+/** @subsection RAMECC3 Register Field Definitions */
+
+static const field32_t RAMECC3_IER_GIE        = {.msk = 0x00000001U, .pos = 0}; /** @brief Global interrupt enable. */
+static const field32_t RAMECC3_IER_GECCSEIE_  = {.msk = 0x00000002U, .pos = 1}; /** @brief Global ECC single error interrupt enable. */
+static const field32_t RAMECC3_IER_GECCDEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief Global ECC double error interrupt enable. */
+static const field32_t RAMECC3_IER_GECCDEBWIE = {.msk = 0x00000008U, .pos = 3}; /** @brief Global ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC3_MxCR_ECCSEIE   = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC single error interrupt enable. */
+static const field32_t RAMECC3_MxCR_ECCDEIE   = {.msk = 0x00000008U, .pos = 3}; /** @brief ECC double error interrupt enable. */
+static const field32_t RAMECC3_MxCR_ECCDEBWIE = {.msk = 0x00000010U, .pos = 4}; /** @brief ECC double error on byte write (BW) interrupt enable. */
+static const field32_t RAMECC3_MxCR_ECCELEN   = {.msk = 0x00000020U, .pos = 5}; /** @brief ECC error latching enable. */
+static const field32_t RAMECC3_MxSR_SEDCF     = {.msk = 0x00000001U, .pos = 0}; /** @brief ECC single error detected and corrected flag. */
+static const field32_t RAMECC3_MxSR_DEDF      = {.msk = 0x00000002U, .pos = 1}; /** @brief ECC double error detected flag. */
+static const field32_t RAMECC3_MxSR_DEBWDF    = {.msk = 0x00000004U, .pos = 2}; /** @brief ECC double error on byte write (BW) detected flag. */
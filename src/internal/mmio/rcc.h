@@ -0,0 +1,1424 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/rcc.h
+ * @authors UW SARP
+ * @brief Registers and fields of RCC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RCC Definitions
+ **************************************************************************************************/
+
+/** @subsection RCC Register Definitions */
+
+static rw_reg32_t const RCC_CR            = (rw_reg32_t)0x58024400U; /** @brief Clock control register. */
+static rw_reg32_t const RCC_HSICFGR       = (rw_reg32_t)0x58024404U; /** @brief RCC HSI configuration register. */
+static ro_reg32_t const RCC_CRRCR         = (ro_reg32_t)0x58024408U; /** @brief RCC Clock Recovery RC Register. */
+static rw_reg32_t const RCC_CFGR          = (rw_reg32_t)0x58024410U; /** @brief RCC Clock Configuration Register. */
+static rw_reg32_t const RCC_D1CFGR        = (rw_reg32_t)0x58024418U; /** @brief RCC Domain 1 Clock Configuration Register. */
+static rw_reg32_t const RCC_D2CFGR        = (rw_reg32_t)0x5802441CU; /** @brief RCC Domain 2 Clock Configuration Register. */
+static rw_reg32_t const RCC_D3CFGR        = (rw_reg32_t)0x58024420U; /** @brief RCC Domain 3 Clock Configuration Register. */
+static rw_reg32_t const RCC_PLLCKSELR     = (rw_reg32_t)0x58024428U; /** @brief RCC PLLs Clock Source Selection Register. */
+static rw_reg32_t const RCC_PLLCFGR       = (rw_reg32_t)0x5802442CU; /** @brief RCC PLLs Configuration Register. */
+static rw_reg32_t const RCC_PLL1DIVR      = (rw_reg32_t)0x58024430U; /** @brief RCC PLL1 Dividers Configuration Register. */
+static rw_reg32_t const RCC_PLL1FRACR     = (rw_reg32_t)0x58024434U; /** @brief RCC PLL1 Fractional Divider Register. */
+static rw_reg32_t const RCC_PLL2DIVR      = (rw_reg32_t)0x58024438U; /** @brief RCC PLL2 Dividers Configuration Register. */
+static rw_reg32_t const RCC_PLL2FRACR     = (rw_reg32_t)0x5802443CU; /** @brief RCC PLL2 Fractional Divider Register. */
+static rw_reg32_t const RCC_PLL3DIVR      = (rw_reg32_t)0x58024440U; /** @brief RCC PLL3 Dividers Configuration Register. */
+static rw_reg32_t const RCC_PLL3FRACR     = (rw_reg32_t)0x58024444U; /** @brief RCC PLL3 Fractional Divider Register. */
+static rw_reg32_t const RCC_D1CCIPR       = (rw_reg32_t)0x5802444CU; /** @brief RCC Domain 1 Kernel Clock Configuration Register. */
+static rw_reg32_t const RCC_D2CCIP1R      = (rw_reg32_t)0x58024450U; /** @brief RCC Domain 2 Kernel Clock Configuration Register. */
+static rw_reg32_t const RCC_D2CCIP2R      = (rw_reg32_t)0x58024454U; /** @brief RCC Domain 2 Kernel Clock Configuration Register. */
+static rw_reg32_t const RCC_D3CCIPR       = (rw_reg32_t)0x58024458U; /** @brief RCC Domain 3 Kernel Clock Configuration Register. */
+static rw_reg32_t const RCC_CIER          = (rw_reg32_t)0x58024460U; /** @brief RCC Clock Source Interrupt Enable Register. */
+static rw_reg32_t const RCC_CIFR          = (rw_reg32_t)0x58024464U; /** @brief RCC Clock Source Interrupt Flag Register. */
+static rw_reg32_t const RCC_CICR          = (rw_reg32_t)0x58024468U; /** @brief RCC Clock Source Interrupt Clear Register. */
+static rw_reg32_t const RCC_BDCR          = (rw_reg32_t)0x58024470U; /** @brief RCC Backup Domain Control Register. */
+static rw_reg32_t const RCC_CSR           = (rw_reg32_t)0x58024474U; /** @brief RCC Clock Control and Status Register. */
+static rw_reg32_t const RCC_AHB3RSTR      = (rw_reg32_t)0x5802447CU; /** @brief RCC AHB3 Reset Register. */
+static rw_reg32_t const RCC_AHB1RSTR      = (rw_reg32_t)0x58024480U; /** @brief RCC AHB1 Peripheral Reset Register. */
+static rw_reg32_t const RCC_AHB2RSTR      = (rw_reg32_t)0x58024484U; /** @brief RCC AHB2 Peripheral Reset Register. */
+static rw_reg32_t const RCC_AHB4RSTR      = (rw_reg32_t)0x58024488U; /** @brief RCC AHB4 Peripheral Reset Register. */
+static rw_reg32_t const RCC_APB3RSTR      = (rw_reg32_t)0x5802448CU; /** @brief RCC APB3 Peripheral Reset Register. */
+static rw_reg32_t const RCC_APB1LRSTR     = (rw_reg32_t)0x58024490U; /** @brief RCC APB1 Peripheral Reset Register. */
+static rw_reg32_t const RCC_APB1HRSTR     = (rw_reg32_t)0x58024494U; /** @brief RCC APB1 Peripheral Reset Register. */
+static rw_reg32_t const RCC_APB2RSTR      = (rw_reg32_t)0x58024498U; /** @brief RCC APB2 Peripheral Reset Register. */
+static rw_reg32_t const RCC_APB4RSTR      = (rw_reg32_t)0x5802449CU; /** @brief RCC APB4 Peripheral Reset Register. */
+static rw_reg32_t const RCC_GCR           = (rw_reg32_t)0x580244A0U; /** @brief RCC Global Control Register. */
+static rw_reg32_t const RCC_D3AMR         = (rw_reg32_t)0x580244A8U; /** @brief RCC D3 Autonomous mode Register. */
+static rw_reg32_t const RCC_RSR           = (rw_reg32_t)0x580244D0U; /** @brief RCC Reset Status Register. */
+static rw_reg32_t const RCC_C1_RSR        = (rw_reg32_t)0x58024530U; /** @brief RCC Reset Status Register. */
+static rw_reg32_t const RCC_C1_AHB3ENR    = (rw_reg32_t)0x58024534U; /** @brief RCC AHB3 Clock Register. */
+static rw_reg32_t const RCC_AHB3ENR       = (rw_reg32_t)0x580244D4U; /** @brief RCC AHB3 Clock Register. */
+static rw_reg32_t const RCC_AHB1ENR       = (rw_reg32_t)0x580244D8U; /** @brief RCC AHB1 Clock Register. */
+static rw_reg32_t const RCC_C1_AHB1ENR    = (rw_reg32_t)0x58024538U; /** @brief RCC AHB1 Clock Register. */
+static rw_reg32_t const RCC_C1_AHB2ENR    = (rw_reg32_t)0x5802453CU; /** @brief RCC AHB2 Clock Register. */
+static rw_reg32_t const RCC_AHB2ENR       = (rw_reg32_t)0x580244DCU; /** @brief RCC AHB2 Clock Register. */
+static rw_reg32_t const RCC_AHB4ENR       = (rw_reg32_t)0x580244E0U; /** @brief RCC AHB4 Clock Register. */
+static rw_reg32_t const RCC_C1_AHB4ENR    = (rw_reg32_t)0x58024540U; /** @brief RCC AHB4 Clock Register. */
+static rw_reg32_t const RCC_C1_APB3ENR    = (rw_reg32_t)0x58024544U; /** @brief RCC APB3 Clock Register. */
+static rw_reg32_t const RCC_APB3ENR       = (rw_reg32_t)0x580244E4U; /** @brief RCC APB3 Clock Register. */
+static rw_reg32_t const RCC_APB1LENR      = (rw_reg32_t)0x580244E8U; /** @brief RCC APB1 Clock Register. */
+static rw_reg32_t const RCC_C1_APB1LENR   = (rw_reg32_t)0x58024548U; /** @brief RCC APB1 Clock Register. */
+static rw_reg32_t const RCC_APB1HENR      = (rw_reg32_t)0x580244ECU; /** @brief RCC APB1 Clock Register. */
+static rw_reg32_t const RCC_C1_APB1HENR   = (rw_reg32_t)0x5802454CU; /** @brief RCC APB1 Clock Register. */
+static rw_reg32_t const RCC_C1_APB2ENR    = (rw_reg32_t)0x58024550U; /** @brief RCC APB2 Clock Register. */
+static rw_reg32_t const RCC_APB2ENR       = (rw_reg32_t)0x580244F0U; /** @brief RCC APB2 Clock Register. */
+static rw_reg32_t const RCC_APB4ENR       = (rw_reg32_t)0x580244F4U; /** @brief RCC APB4 Clock Register. */
+static rw_reg32_t const RCC_C1_APB4ENR    = (rw_reg32_t)0x58024554U; /** @brief RCC APB4 Clock Register. */
+static rw_reg32_t const RCC_C1_AHB3LPENR  = (rw_reg32_t)0x5802455CU; /** @brief RCC AHB3 Sleep Clock Register. */
+static rw_reg32_t const RCC_AHB3LPENR     = (rw_reg32_t)0x580244FCU; /** @brief RCC AHB3 Sleep Clock Register. */
+static rw_reg32_t const RCC_AHB1LPENR     = (rw_reg32_t)0x58024500U; /** @brief RCC AHB1 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_AHB1LPENR  = (rw_reg32_t)0x58024560U; /** @brief RCC AHB1 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_AHB2LPENR  = (rw_reg32_t)0x58024564U; /** @brief RCC AHB2 Sleep Clock Register. */
+static rw_reg32_t const RCC_AHB2LPENR     = (rw_reg32_t)0x58024504U; /** @brief RCC AHB2 Sleep Clock Register. */
+static rw_reg32_t const RCC_AHB4LPENR     = (rw_reg32_t)0x58024508U; /** @brief RCC AHB4 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_AHB4LPENR  = (rw_reg32_t)0x58024568U; /** @brief RCC AHB4 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_APB3LPENR  = (rw_reg32_t)0x5802456CU; /** @brief RCC APB3 Sleep Clock Register. */
+static rw_reg32_t const RCC_APB3LPENR     = (rw_reg32_t)0x5802450CU; /** @brief RCC APB3 Sleep Clock Register. */
+static rw_reg32_t const RCC_APB1LLPENR    = (rw_reg32_t)0x58024510U; /** @brief RCC APB1 Low Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_APB1LLPENR = (rw_reg32_t)0x58024570U; /** @brief RCC APB1 Low Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_APB1HLPENR = (rw_reg32_t)0x58024574U; /** @brief RCC APB1 High Sleep Clock Register. */
+static rw_reg32_t const RCC_APB1HLPENR    = (rw_reg32_t)0x58024514U; /** @brief RCC APB1 High Sleep Clock Register. */
+static rw_reg32_t const RCC_APB2LPENR     = (rw_reg32_t)0x58024518U; /** @brief RCC APB2 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_APB2LPENR  = (rw_reg32_t)0x58024578U; /** @brief RCC APB2 Sleep Clock Register. */
+static rw_reg32_t const RCC_C1_APB4LPENR  = (rw_reg32_t)0x5802457CU; /** @brief RCC APB4 Sleep Clock Register. */
+static rw_reg32_t const RCC_APB4LPENR     = (rw_reg32_t)0x5802451CU; /** @brief RCC APB4 Sleep Clock Register. */
+
+/** @subsection RCC Register Field Definitions */
+
+static const field32_t RCC_CR_HSION                       = {.msk = 0x00000001U, .pos = 0};  /** @brief Internal high-speed clock enable. */
+static const field32_t RCC_CR_HSIKERON                    = {.msk = 0x00000002U, .pos = 1};  /** @brief High Speed Internal clock enable in Stop mode. */
+static const field32_t RCC_CR_HSIRDY                      = {.msk = 0x00000004U, .pos = 2};  /** @brief HSI clock ready flag. */
+static const field32_t RCC_CR_HSIDIV                      = {.msk = 0x00000018U, .pos = 3};  /** @brief HSI clock divider. */
+static const field32_t RCC_CR_HSIDIVF                     = {.msk = 0x00000020U, .pos = 5};  /** @brief HSI divider flag. */
+static const field32_t RCC_CR_CSION                       = {.msk = 0x00000080U, .pos = 7};  /** @brief CSI clock enable. */
+static const field32_t RCC_CR_CSIRDY                      = {.msk = 0x00000100U, .pos = 8};  /** @brief CSI clock ready flag. */
+static const field32_t RCC_CR_CSIKERON                    = {.msk = 0x00000200U, .pos = 9};  /** @brief CSI clock enable in Stop mode. */
+static const field32_t RCC_CR_RC48ON                      = {.msk = 0x00001000U, .pos = 12}; /** @brief RC48 clock enable. */
+static const field32_t RCC_CR_RC48RDY                     = {.msk = 0x00002000U, .pos = 13}; /** @brief RC48 clock ready flag. */
+static const field32_t RCC_CR_D1CKRDY                     = {.msk = 0x00004000U, .pos = 14}; /** @brief D1 domain clocks ready flag. */
+static const field32_t RCC_CR_D2CKRDY                     = {.msk = 0x00008000U, .pos = 15}; /** @brief D2 domain clocks ready flag. */
+static const field32_t RCC_CR_HSEON                       = {.msk = 0x00010000U, .pos = 16}; /** @brief HSE clock enable. */
+static const field32_t RCC_CR_HSERDY                      = {.msk = 0x00020000U, .pos = 17}; /** @brief HSE clock ready flag. */
+static const field32_t RCC_CR_HSEBYP                      = {.msk = 0x00040000U, .pos = 18}; /** @brief HSE clock bypass. */
+static const field32_t RCC_CR_HSECSSON                    = {.msk = 0x00080000U, .pos = 19}; /** @brief HSE Clock Security System enable. */
+static const field32_t RCC_CR_PLL1ON                      = {.msk = 0x01000000U, .pos = 24}; /** @brief PLL1 enable. */
+static const field32_t RCC_CR_PLL1RDY                     = {.msk = 0x02000000U, .pos = 25}; /** @brief PLL1 clock ready flag. */
+static const field32_t RCC_CR_PLL2ON                      = {.msk = 0x04000000U, .pos = 26}; /** @brief PLL2 enable. */
+static const field32_t RCC_CR_PLL2RDY                     = {.msk = 0x08000000U, .pos = 27}; /** @brief PLL2 clock ready flag. */
+static const field32_t RCC_CR_PLL3ON                      = {.msk = 0x10000000U, .pos = 28}; /** @brief PLL3 enable. */
+static const field32_t RCC_CR_PLL3RDY                     = {.msk = 0x20000000U, .pos = 29}; /** @brief PLL3 clock ready flag. */
+static const field32_t RCC_HSICFGR_HSICAL                 = {.msk = 0x00000FFFU, .pos = 0};  /** @brief HSI clock calibration. */
+static const field32_t RCC_HSICFGR_HSITRIM                = {.msk = 0x7F000000U, .pos = 24}; /** @brief HSI clock trimming. */
+static const field32_t RCC_CRRCR_RC48CAL                  = {.msk = 0x000003FFU, .pos = 0};  /** @brief Internal RC 48 MHz clock calibration. */
+static const field32_t RCC_CFGR_SW                        = {.msk = 0x00000007U, .pos = 0};  /** @brief System clock switch. */
+static const field32_t RCC_CFGR_SWS                       = {.msk = 0x00000038U, .pos = 3};  /** @brief System clock switch status. */
+static const field32_t RCC_CFGR_STOPWUCK                  = {.msk = 0x00000040U, .pos = 6};  /** @brief System clock selection after a wake up from system Stop. */
+static const field32_t RCC_CFGR_STOPKERWUCK               = {.msk = 0x00000080U, .pos = 7};  /** @brief Kernel clock selection after a wake up from system Stop. */
+static const field32_t RCC_CFGR_RTCPRE                    = {.msk = 0x00003F00U, .pos = 8};  /** @brief HSE division factor for RTC clock. */
+static const field32_t RCC_CFGR_HRTIMSEL                  = {.msk = 0x00004000U, .pos = 14}; /** @brief High Resolution Timer clock prescaler selection. */
+static const field32_t RCC_CFGR_TIMPRE                    = {.msk = 0x00008000U, .pos = 15}; /** @brief Timers clocks prescaler selection. */
+static const field32_t RCC_CFGR_MCO1PRE                   = {.msk = 0x003C0000U, .pos = 18}; /** @brief MCO1 prescaler. */
+static const field32_t RCC_CFGR_MCO1SEL                   = {.msk = 0x01C00000U, .pos = 22}; /** @brief Micro-controller clock output 1. */
+static const field32_t RCC_CFGR_MCO2PRE                   = {.msk = 0x1E000000U, .pos = 25}; /** @brief MCO2 prescaler. */
+static const field32_t RCC_CFGR_MCO2SEL                   = {.msk = 0xE0000000U, .pos = 29}; /** @brief Micro-controller clock output 2. */
+static const field32_t RCC_D1CFGR_HPRE                    = {.msk = 0x0000000FU, .pos = 0};  /** @brief D1 domain AHB prescaler. */
+static const field32_t RCC_D1CFGR_D1PPRE                  = {.msk = 0x00000070U, .pos = 4};  /** @brief D1 domain APB3 prescaler. */
+static const field32_t RCC_D1CFGR_D1CPRE                  = {.msk = 0x00000F00U, .pos = 8};  /** @brief D1 domain Core prescaler. */
+static const field32_t RCC_D2CFGR_D2PPRE1                 = {.msk = 0x00000070U, .pos = 4};  /** @brief D2 domain APB1 prescaler. */
+static const field32_t RCC_D2CFGR_D2PPRE2                 = {.msk = 0x00000700U, .pos = 8};  /** @brief D2 domain APB2 prescaler. */
+static const field32_t RCC_D3CFGR_D3PPRE                  = {.msk = 0x00000070U, .pos = 4};  /** @brief D3 domain APB4 prescaler. */
+static const field32_t RCC_PLLCKSELR_PLLSRC               = {.msk = 0x00000003U, .pos = 0};  /** @brief DIVMx and PLLs clock source selection. */
+static const field32_t RCC_PLLCKSELR_DIVM1                = {.msk = 0x000003F0U, .pos = 4};  /** @brief Prescaler for PLL1. */
+static const field32_t RCC_PLLCKSELR_DIVM2                = {.msk = 0x0003F000U, .pos = 12}; /** @brief Prescaler for PLL2. */
+static const field32_t RCC_PLLCKSELR_DIVM3                = {.msk = 0x03F00000U, .pos = 20}; /** @brief Prescaler for PLL3. */
+static const field32_t RCC_PLLCFGR_PLL1FRACEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief PLL1 fractional latch enable. */
+static const field32_t RCC_PLLCFGR_PLL1VCOSEL             = {.msk = 0x00000002U, .pos = 1};  /** @brief PLL1 VCO selection. */
+static const field32_t RCC_PLLCFGR_PLL1RGE                = {.msk = 0x0000000CU, .pos = 2};  /** @brief PLL1 input frequency range. */
+static const field32_t RCC_PLLCFGR_PLL2FRACEN             = {.msk = 0x00000010U, .pos = 4};  /** @brief PLL2 fractional latch enable. */
+static const field32_t RCC_PLLCFGR_PLL2VCOSEL             = {.msk = 0x00000020U, .pos = 5};  /** @brief PLL2 VCO selection. */
+static const field32_t RCC_PLLCFGR_PLL2RGE                = {.msk = 0x000000C0U, .pos = 6};  /** @brief PLL2 input frequency range. */
+static const field32_t RCC_PLLCFGR_PLL3FRACEN             = {.msk = 0x00000100U, .pos = 8};  /** @brief PLL3 fractional latch enable. */
+static const field32_t RCC_PLLCFGR_PLL3VCOSEL             = {.msk = 0x00000200U, .pos = 9};  /** @brief PLL3 VCO selection. */
+static const field32_t RCC_PLLCFGR_PLL3RGE                = {.msk = 0x00000C00U, .pos = 10}; /** @brief PLL3 input frequency range. */
+static const field32_t RCC_PLLCFGR_DIVP1EN                = {.msk = 0x00010000U, .pos = 16}; /** @brief PLL1 DIVP divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVQ1EN                = {.msk = 0x00020000U, .pos = 17}; /** @brief PLL1 DIVQ divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVR1EN                = {.msk = 0x00040000U, .pos = 18}; /** @brief PLL1 DIVR divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVP2EN                = {.msk = 0x00080000U, .pos = 19}; /** @brief PLL2 DIVP divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVQ2EN                = {.msk = 0x00100000U, .pos = 20}; /** @brief PLL2 DIVQ divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVR2EN                = {.msk = 0x00200000U, .pos = 21}; /** @brief PLL2 DIVR divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVP3EN                = {.msk = 0x00400000U, .pos = 22}; /** @brief PLL3 DIVP divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVQ3EN                = {.msk = 0x00800000U, .pos = 23}; /** @brief PLL3 DIVQ divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVR3EN                = {.msk = 0x01000000U, .pos = 24}; /** @brief PLL3 DIVR divider output enable. */
+static const field32_t RCC_PLL1DIVR_DIVN1                 = {.msk = 0x000001FFU, .pos = 0};  /** @brief Multiplication factor for PLL1 VCO. */
+static const field32_t RCC_PLL1DIVR_DIVP1                 = {.msk = 0x0000FE00U, .pos = 9};  /** @brief PLL1 DIVP division factor. */
+static const field32_t RCC_PLL1DIVR_DIVQ1                 = {.msk = 0x007F0000U, .pos = 16}; /** @brief PLL1 DIVQ division factor. */
+static const field32_t RCC_PLL1DIVR_DIVR1                 = {.msk = 0x7F000000U, .pos = 24}; /** @brief PLL1 DIVR division factor. */
+static const field32_t RCC_PLL1FRACR_FRACN1               = {.msk = 0x0000FFF8U, .pos = 3};  /** @brief Fractional part of the multiplication factor for PLL1 VCO. */
+static const field32_t RCC_PLL2DIVR_DIVN2                 = {.msk = 0x000001FFU, .pos = 0};  /** @brief Multiplication factor for PLL1 VCO. */
+static const field32_t RCC_PLL2DIVR_DIVP2                 = {.msk = 0x0000FE00U, .pos = 9};  /** @brief PLL1 DIVP division factor. */
+static const field32_t RCC_PLL2DIVR_DIVQ2                 = {.msk = 0x007F0000U, .pos = 16}; /** @brief PLL1 DIVQ division factor. */
+static const field32_t RCC_PLL2DIVR_DIVR2                 = {.msk = 0x7F000000U, .pos = 24}; /** @brief PLL1 DIVR division factor. */
+static const field32_t RCC_PLL2FRACR_FRACN2               = {.msk = 0x0000FFF8U, .pos = 3};  /** @brief Fractional part of the multiplication factor for PLL VCO. */
+static const field32_t RCC_PLL3DIVR_DIVN3                 = {.msk = 0x000001FFU, .pos = 0};  /** @brief Multiplication factor for PLL1 VCO. */
+static const field32_t RCC_PLL3DIVR_DIVP3                 = {.msk = 0x0000FE00U, .pos = 9};  /** @brief PLL DIVP division factor. */
+static const field32_t RCC_PLL3DIVR_DIVQ3                 = {.msk = 0x007F0000U, .pos = 16}; /** @brief PLL DIVQ division factor. */
+static const field32_t RCC_PLL3DIVR_DIVR3                 = {.msk = 0x7F000000U, .pos = 24}; /** @brief PLL DIVR division factor. */
+static const field32_t RCC_PLL3FRACR_FRACN3               = {.msk = 0x0000FFF8U, .pos = 3};  /** @brief Fractional part of the multiplication factor for PLL3 VCO. */
+static const field32_t RCC_D1CCIPR_FMCSRC                 = {.msk = 0x00000003U, .pos = 0};  /** @brief FMC kernel clock source selection. */
+static const field32_t RCC_D1CCIPR_QSPISRC                = {.msk = 0x00000030U, .pos = 4};  /** @brief QUADSPI kernel clock source selection. */
+static const field32_t RCC_D1CCIPR_SDMMCSRC               = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC kernel clock source selection. */
+static const field32_t RCC_D1CCIPR_CKPERSRC               = {.msk = 0x30000000U, .pos = 28}; /** @brief Per_ck clock source selection. */
+static const field32_t RCC_D2CCIP1R_SAI1SRC               = {.msk = 0x00000007U, .pos = 0};  /** @brief SAI1 and DFSDM1 kernel Aclk clock source selection. */
+static const field32_t RCC_D2CCIP1R_SAI23SRC              = {.msk = 0x000001C0U, .pos = 6};  /** @brief SAI2 and SAI3 kernel clock source selection. */
+static const field32_t RCC_D2CCIP1R_SPI123SRC             = {.msk = 0x00007000U, .pos = 12}; /** @brief SPI/I2S1,2 and 3 kernel clock source selection. */
+static const field32_t RCC_D2CCIP1R_SPI45SRC              = {.msk = 0x00070000U, .pos = 16}; /** @brief SPI4 and 5 kernel clock source selection. */
+static const field32_t RCC_D2CCIP1R_SPDIFSRC              = {.msk = 0x00300000U, .pos = 20}; /** @brief SPDIFRX kernel clock source selection. */
+static const field32_t RCC_D2CCIP1R_DFSDM1SRC             = {.msk = 0x01000000U, .pos = 24}; /** @brief DFSDM1 kernel Clk clock source selection. */
+static const field32_t RCC_D2CCIP1R_FDCANSRC              = {.msk = 0x30000000U, .pos = 28}; /** @brief FDCAN kernel clock source selection. */
+static const field32_t RCC_D2CCIP1R_SWPSRC                = {.msk = 0x80000000U, .pos = 31}; /** @brief SWPMI kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_USART234578SRC        = {.msk = 0x00000007U, .pos = 0};  /** @brief USART2/3, UART4,5, 7/8 (APB1) kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_USART16SRC            = {.msk = 0x00000038U, .pos = 3};  /** @brief USART1 and 6 kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_RNGSRC                = {.msk = 0x00000300U, .pos = 8};  /** @brief RNG kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_I2C123SRC             = {.msk = 0x00003000U, .pos = 12}; /** @brief I2C1,2,3 kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_USBSRC                = {.msk = 0x00300000U, .pos = 20}; /** @brief USBOTG 1 and 2 kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_CECSRC                = {.msk = 0x00C00000U, .pos = 22}; /** @brief HDMI-CEC kernel clock source selection. */
+static const field32_t RCC_D2CCIP2R_LPTIM1SRC             = {.msk = 0x70000000U, .pos = 28}; /** @brief LPTIM1 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_LPUART1SRC             = {.msk = 0x00000007U, .pos = 0};  /** @brief LPUART1 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_I2C4SRC                = {.msk = 0x00000300U, .pos = 8};  /** @brief I2C4 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_LPTIM2SRC              = {.msk = 0x00001C00U, .pos = 10}; /** @brief LPTIM2 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_LPTIM345SRC            = {.msk = 0x0000E000U, .pos = 13}; /** @brief LPTIM3,4,5 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_ADCSRC                 = {.msk = 0x00030000U, .pos = 16}; /** @brief SAR ADC kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_SAI4ASRC               = {.msk = 0x00E00000U, .pos = 21}; /** @brief Sub-Block A of SAI4 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_SAI4BSRC               = {.msk = 0x07000000U, .pos = 24}; /** @brief Sub-Block B of SAI4 kernel clock source selection. */
+static const field32_t RCC_D3CCIPR_SPI6SRC                = {.msk = 0x70000000U, .pos = 28}; /** @brief SPI6 kernel clock source selection. */
+static const field32_t RCC_CIER_LSIRDYIE                  = {.msk = 0x00000001U, .pos = 0};  /** @brief LSI ready Interrupt Enable. */
+static const field32_t RCC_CIER_LSERDYIE                  = {.msk = 0x00000002U, .pos = 1};  /** @brief LSE ready Interrupt Enable. */
+static const field32_t RCC_CIER_HSIRDYIE                  = {.msk = 0x00000004U, .pos = 2};  /** @brief HSI ready Interrupt Enable. */
+static const field32_t RCC_CIER_HSERDYIE                  = {.msk = 0x00000008U, .pos = 3};  /** @brief HSE ready Interrupt Enable. */
+static const field32_t RCC_CIER_CSIRDYIE                  = {.msk = 0x00000010U, .pos = 4};  /** @brief CSI ready Interrupt Enable. */
+static const field32_t RCC_CIER_RC48RDYIE                 = {.msk = 0x00000020U, .pos = 5};  /** @brief RC48 ready Interrupt Enable. */
+static const field32_t RCC_CIER_PLL1RDYIE                 = {.msk = 0x00000040U, .pos = 6};  /** @brief PLL1 ready Interrupt Enable. */
+static const field32_t RCC_CIER_PLL2RDYIE                 = {.msk = 0x00000080U, .pos = 7};  /** @brief PLL2 ready Interrupt Enable. */
+static const field32_t RCC_CIER_PLL3RDYIE                 = {.msk = 0x00000100U, .pos = 8};  /** @brief PLL3 ready Interrupt Enable. */
+static const field32_t RCC_CIER_LSECSSIE                  = {.msk = 0x00000200U, .pos = 9};  /** @brief LSE clock security system Interrupt Enable. */
+static const field32_t RCC_CIFR_LSIRDYF                   = {.msk = 0x00000001U, .pos = 0};  /** @brief LSI ready Interrupt Flag. */
+static const field32_t RCC_CIFR_LSERDYF                   = {.msk = 0x00000002U, .pos = 1};  /** @brief LSE ready Interrupt Flag. */
+static const field32_t RCC_CIFR_HSIRDYF                   = {.msk = 0x00000004U, .pos = 2};  /** @brief HSI ready Interrupt Flag. */
+static const field32_t RCC_CIFR_HSERDYF                   = {.msk = 0x00000008U, .pos = 3};  /** @brief HSE ready Interrupt Flag. */
+static const field32_t RCC_CIFR_CSIRDY                    = {.msk = 0x00000010U, .pos = 4};  /** @brief CSI ready Interrupt Flag. */
+static const field32_t RCC_CIFR_RC48RDYF                  = {.msk = 0x00000020U, .pos = 5};  /** @brief RC48 ready Interrupt Flag. */
+static const field32_t RCC_CIFR_PLL1RDYF                  = {.msk = 0x00000040U, .pos = 6};  /** @brief PLL1 ready Interrupt Flag. */
+static const field32_t RCC_CIFR_PLL2RDYF                  = {.msk = 0x00000080U, .pos = 7};  /** @brief PLL2 ready Interrupt Flag. */
+static const field32_t RCC_CIFR_PLL3RDYF                  = {.msk = 0x00000100U, .pos = 8};  /** @brief PLL3 ready Interrupt Flag. */
+static const field32_t RCC_CIFR_LSECSSF                   = {.msk = 0x00000200U, .pos = 9};  /** @brief LSE clock security system Interrupt Flag. */
+static const field32_t RCC_CIFR_HSECSSF                   = {.msk = 0x00000400U, .pos = 10}; /** @brief HSE clock security system Interrupt Flag. */
+static const field32_t RCC_CICR_LSIRDYC                   = {.msk = 0x00000001U, .pos = 0};  /** @brief LSI ready Interrupt Clear. */
+static const field32_t RCC_CICR_LSERDYC                   = {.msk = 0x00000002U, .pos = 1};  /** @brief LSE ready Interrupt Clear. */
+static const field32_t RCC_CICR_HSIRDYC                   = {.msk = 0x00000004U, .pos = 2};  /** @brief HSI ready Interrupt Clear. */
+static const field32_t RCC_CICR_HSERDYC                   = {.msk = 0x00000008U, .pos = 3};  /** @brief HSE ready Interrupt Clear. */
+static const field32_t RCC_CICR_HSE_READY_INTERRUPT_CLEAR = {.msk = 0x00000010U, .pos = 4};  /** @brief CSI ready Interrupt Clear. */
+static const field32_t RCC_CICR_RC48RDYC                  = {.msk = 0x00000020U, .pos = 5};  /** @brief RC48 ready Interrupt Clear. */
+static const field32_t RCC_CICR_PLL1RDYC                  = {.msk = 0x00000040U, .pos = 6};  /** @brief PLL1 ready Interrupt Clear. */
+static const field32_t RCC_CICR_PLL2RDYC                  = {.msk = 0x00000080U, .pos = 7};  /** @brief PLL2 ready Interrupt Clear. */
+static const field32_t RCC_CICR_PLL3RDYC                  = {.msk = 0x00000100U, .pos = 8};  /** @brief PLL3 ready Interrupt Clear. */
+static const field32_t RCC_CICR_LSECSSC                   = {.msk = 0x00000200U, .pos = 9};  /** @brief LSE clock security system Interrupt Clear. */
+static const field32_t RCC_CICR_HSECSSC                   = {.msk = 0x00000400U, .pos = 10}; /** @brief HSE clock security system Interrupt Clear. */
+static const field32_t RCC_BDCR_LSEON                     = {.msk = 0x00000001U, .pos = 0};  /** @brief LSE oscillator enabled. */
+static const field32_t RCC_BDCR_LSERDY                    = {.msk = 0x00000002U, .pos = 1};  /** @brief LSE oscillator ready. */
+static const field32_t RCC_BDCR_LSEBYP                    = {.msk = 0x00000004U, .pos = 2};  /** @brief LSE oscillator bypass. */
+static const field32_t RCC_BDCR_LSEDRV                    = {.msk = 0x00000018U, .pos = 3};  /** @brief LSE oscillator driving capability. */
+static const field32_t RCC_BDCR_LSECSSON                  = {.msk = 0x00000020U, .pos = 5};  /** @brief LSE clock security system enable. */
+static const field32_t RCC_BDCR_LSECSSD                   = {.msk = 0x00000040U, .pos = 6};  /** @brief LSE clock security system failure detection. */
+static const field32_t RCC_BDCR_RTCSRC                    = {.msk = 0x00000300U, .pos = 8};  /** @brief RTC clock source selection. */
+static const field32_t RCC_BDCR_RTCEN                     = {.msk = 0x00008000U, .pos = 15}; /** @brief RTC clock enable. */
+static const field32_t RCC_BDCR_VSWRST                    = {.msk = 0x00010000U, .pos = 16}; /** @brief VSwitch domain software reset. */
+static const field32_t RCC_CSR_LSION                      = {.msk = 0x00000001U, .pos = 0};  /** @brief LSI oscillator enable. */
+static const field32_t RCC_CSR_LSIRDY                     = {.msk = 0x00000002U, .pos = 1};  /** @brief LSI oscillator ready. */
+static const field32_t RCC_AHB3RSTR_MDMARST               = {.msk = 0x00000001U, .pos = 0};  /** @brief MDMA block reset. */
+static const field32_t RCC_AHB3RSTR_DMA2DRST              = {.msk = 0x00000010U, .pos = 4};  /** @brief DMA2D block reset. */
+static const field32_t RCC_AHB3RSTR_JPGDECRST             = {.msk = 0x00000020U, .pos = 5};  /** @brief JPGDEC block reset. */
+static const field32_t RCC_AHB3RSTR_FMCRST                = {.msk = 0x00001000U, .pos = 12}; /** @brief FMC block reset. */
+static const field32_t RCC_AHB3RSTR_QSPIRST               = {.msk = 0x00004000U, .pos = 14}; /** @brief QUADSPI and QUADSPI delay block reset. */
+static const field32_t RCC_AHB3RSTR_SDMMC1RST             = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC1 and SDMMC1 delay block reset. */
+static const field32_t RCC_AHB3RSTR_CPURST                = {.msk = 0x80000000U, .pos = 31}; /** @brief CPU reset. */
+static const field32_t RCC_AHB1RSTR_DMA1RST               = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA1 block reset. */
+static const field32_t RCC_AHB1RSTR_DMA2RST               = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA2 block reset. */
+static const field32_t RCC_AHB1RSTR_ADC12RST              = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC1&2 block reset. */
+static const field32_t RCC_AHB1RSTR_ETH1MACRST            = {.msk = 0x00008000U, .pos = 15}; /** @brief ETH1MAC block reset. */
+static const field32_t RCC_AHB1RSTR_USB1OTGRST            = {.msk = 0x02000000U, .pos = 25}; /** @brief USB1OTG block reset. */
+static const field32_t RCC_AHB1RSTR_USB2OTGRST            = {.msk = 0x08000000U, .pos = 27}; /** @brief USB2OTG block reset. */
+static const field32_t RCC_AHB2RSTR_CAMITFRST             = {.msk = 0x00000001U, .pos = 0};  /** @brief CAMITF block reset. */
+static const field32_t RCC_AHB2RSTR_CRYPTRST              = {.msk = 0x00000010U, .pos = 4};  /** @brief Cryptography block reset. */
+static const field32_t RCC_AHB2RSTR_HASHRST               = {.msk = 0x00000020U, .pos = 5};  /** @brief Hash block reset. */
+static const field32_t RCC_AHB2RSTR_RNGRST                = {.msk = 0x00000040U, .pos = 6};  /** @brief Random Number Generator block reset. */
+static const field32_t RCC_AHB2RSTR_SDMMC2RST             = {.msk = 0x00000200U, .pos = 9};  /** @brief SDMMC2 and SDMMC2 Delay block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOARST              = {.msk = 0x00000001U, .pos = 0};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOBRST              = {.msk = 0x00000002U, .pos = 1};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOCRST              = {.msk = 0x00000004U, .pos = 2};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIODRST              = {.msk = 0x00000008U, .pos = 3};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOERST              = {.msk = 0x00000010U, .pos = 4};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOFRST              = {.msk = 0x00000020U, .pos = 5};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOGRST              = {.msk = 0x00000040U, .pos = 6};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOHRST              = {.msk = 0x00000080U, .pos = 7};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOIRST              = {.msk = 0x00000100U, .pos = 8};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOJRST              = {.msk = 0x00000200U, .pos = 9};  /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_GPIOKRST              = {.msk = 0x00000400U, .pos = 10}; /** @brief GPIO block reset. */
+static const field32_t RCC_AHB4RSTR_CRCRST                = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC block reset. */
+static const field32_t RCC_AHB4RSTR_BDMARST               = {.msk = 0x00200000U, .pos = 21}; /** @brief BDMA block reset. */
+static const field32_t RCC_AHB4RSTR_ADC3RST               = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 block reset. */
+static const field32_t RCC_AHB4RSTR_HSEMRST               = {.msk = 0x02000000U, .pos = 25}; /** @brief HSEM block reset. */
+static const field32_t RCC_APB3RSTR_LTDCRST               = {.msk = 0x00000008U, .pos = 3};  /** @brief LTDC block reset. */
+static const field32_t RCC_APB1LRSTR_TIM2RST              = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM3RST              = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM4RST              = {.msk = 0x00000004U, .pos = 2};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM5RST              = {.msk = 0x00000008U, .pos = 3};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM6RST              = {.msk = 0x00000010U, .pos = 4};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM7RST              = {.msk = 0x00000020U, .pos = 5};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM12RST             = {.msk = 0x00000040U, .pos = 6};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM13RST             = {.msk = 0x00000080U, .pos = 7};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIM14RST             = {.msk = 0x00000100U, .pos = 8};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_LPTIM1RST            = {.msk = 0x00000200U, .pos = 9};  /** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_SPI2RST              = {.msk = 0x00004000U, .pos = 14}; /** @brief SPI2 block reset. */
+static const field32_t RCC_APB1LRSTR_SPI3RST              = {.msk = 0x00008000U, .pos = 15}; /** @brief SPI3 block reset. */
+static const field32_t RCC_APB1LRSTR_SPDIFRXRST           = {.msk = 0x00010000U, .pos = 16}; /** @brief SPDIFRX block reset. */
+static const field32_t RCC_APB1LRSTR_USART2RST            = {.msk = 0x00020000U, .pos = 17}; /** @brief USART2 block reset. */
+static const field32_t RCC_APB1LRSTR_USART3RST            = {.msk = 0x00040000U, .pos = 18}; /** @brief USART3 block reset. */
+static const field32_t RCC_APB1LRSTR_UART4RST             = {.msk = 0x00080000U, .pos = 19}; /** @brief UART4 block reset. */
+static const field32_t RCC_APB1LRSTR_UART5RST             = {.msk = 0x00100000U, .pos = 20}; /** @brief UART5 block reset. */
+static const field32_t RCC_APB1LRSTR_I2C1RST              = {.msk = 0x00200000U, .pos = 21}; /** @brief I2C1 block reset. */
+static const field32_t RCC_APB1LRSTR_I2C2RST              = {.msk = 0x00400000U, .pos = 22}; /** @brief I2C2 block reset. */
+static const field32_t RCC_APB1LRSTR_I2C3RST              = {.msk = 0x00800000U, .pos = 23}; /** @brief I2C3 block reset. */
+static const field32_t RCC_APB1LRSTR_HDMICECRST           = {.msk = 0x08000000U, .pos = 27}; /** @brief HDMI-CEC block reset. */
+static const field32_t RCC_APB1LRSTR_DAC12RST             = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC1 and 2 Blocks Reset. */
+static const field32_t RCC_APB1LRSTR_USART7RST            = {.msk = 0x40000000U, .pos = 30}; /** @brief USART7 block reset. */
+static const field32_t RCC_APB1LRSTR_USART8RST            = {.msk = 0x80000000U, .pos = 31}; /** @brief USART8 block reset. */
+static const field32_t RCC_APB1HRSTR_CRSRST               = {.msk = 0x00000002U, .pos = 1};  /** @brief Clock Recovery System reset. */
+static const field32_t RCC_APB1HRSTR_SWPRST               = {.msk = 0x00000004U, .pos = 2};  /** @brief SWPMI block reset. */
+static const field32_t RCC_APB1HRSTR_OPAMPRST             = {.msk = 0x00000010U, .pos = 4};  /** @brief OPAMP block reset. */
+static const field32_t RCC_APB1HRSTR_MDIOSRST             = {.msk = 0x00000020U, .pos = 5};  /** @brief MDIOS block reset. */
+static const field32_t RCC_APB1HRSTR_FDCANRST             = {.msk = 0x00000100U, .pos = 8};  /** @brief FDCAN block reset. */
+static const field32_t RCC_APB2RSTR_TIM1RST               = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM1 block reset. */
+static const field32_t RCC_APB2RSTR_TIM8RST               = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM8 block reset. */
+static const field32_t RCC_APB2RSTR_USART1RST             = {.msk = 0x00000010U, .pos = 4};  /** @brief USART1 block reset. */
+static const field32_t RCC_APB2RSTR_USART6RST             = {.msk = 0x00000020U, .pos = 5};  /** @brief USART6 block reset. */
+static const field32_t RCC_APB2RSTR_SPI1RST               = {.msk = 0x00001000U, .pos = 12}; /** @brief SPI1 block reset. */
+static const field32_t RCC_APB2RSTR_SPI4RST               = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI4 block reset. */
+static const field32_t RCC_APB2RSTR_TIM15RST              = {.msk = 0x00010000U, .pos = 16}; /** @brief TIM15 block reset. */
+static const field32_t RCC_APB2RSTR_TIM16RST              = {.msk = 0x00020000U, .pos = 17}; /** @brief TIM16 block reset. */
+static const field32_t RCC_APB2RSTR_TIM17RST              = {.msk = 0x00040000U, .pos = 18}; /** @brief TIM17 block reset. */
+static const field32_t RCC_APB2RSTR_SPI5RST               = {.msk = 0x00100000U, .pos = 20}; /** @brief SPI5 block reset. */
+static const field32_t RCC_APB2RSTR_SAI1RST               = {.msk = 0x00400000U, .pos = 22}; /** @brief SAI1 block reset. */
+static const field32_t RCC_APB2RSTR_SAI2RST               = {.msk = 0x00800000U, .pos = 23}; /** @brief SAI2 block reset. */
+static const field32_t RCC_APB2RSTR_SAI3RST               = {.msk = 0x01000000U, .pos = 24}; /** @brief SAI3 block reset. */
+static const field32_t RCC_APB2RSTR_DFSDM1RST             = {.msk = 0x10000000U, .pos = 28}; /** @brief DFSDM1 block reset. */
+static const field32_t RCC_APB2RSTR_HRTIMRST              = {.msk = 0x20000000U, .pos = 29}; /** @brief HRTIM block reset. */
+static const field32_t RCC_APB4RSTR_SYSCFGRST             = {.msk = 0x00000002U, .pos = 1};  /** @brief SYSCFG block reset. */
+static const field32_t RCC_APB4RSTR_LPUART1RST            = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 block reset. */
+static const field32_t RCC_APB4RSTR_SPI6RST               = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 block reset. */
+static const field32_t RCC_APB4RSTR_I2C4RST               = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 block reset. */
+static const field32_t RCC_APB4RSTR_LPTIM2RST             = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 block reset. */
+static const field32_t RCC_APB4RSTR_LPTIM3RST             = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 block reset. */
+static const field32_t RCC_APB4RSTR_LPTIM4RST             = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 block reset. */
+static const field32_t RCC_APB4RSTR_LPTIM5RST             = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 block reset. */
+static const field32_t RCC_APB4RSTR_COMP12RST             = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP12 Blocks Reset. */
+static const field32_t RCC_APB4RSTR_VREFRST               = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF block reset. */
+static const field32_t RCC_APB4RSTR_SAI4RST               = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 block reset. */
+static const field32_t RCC_GCR_WW1RSC                     = {.msk = 0x00000001U, .pos = 0};  /** @brief WWDG1 reset scope control. */
+static const field32_t RCC_D3AMR_BDMAAMEN                 = {.msk = 0x00000001U, .pos = 0};  /** @brief BDMA and DMAMUX Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPUART1AMEN              = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_SPI6AMEN                 = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_I2C4AMEN                 = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPTIM2AMEN               = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPTIM3AMEN               = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPTIM4AMEN               = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPTIM5AMEN               = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_COMP12AMEN               = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP12 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_VREFAMEN                 = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF Autonomous mode enable. */
+static const field32_t RCC_D3AMR_RTCAMEN                  = {.msk = 0x00010000U, .pos = 16}; /** @brief RTC Autonomous mode enable. */
+static const field32_t RCC_D3AMR_CRCAMEN                  = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC Autonomous mode enable. */
+static const field32_t RCC_D3AMR_SAI4AMEN                 = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_ADC3AMEN                 = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_BKPSRAMAMEN              = {.msk = 0x10000000U, .pos = 28}; /** @brief Backup RAM Autonomous mode enable. */
+static const field32_t RCC_D3AMR_SRAM4AMEN                = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM4 Autonomous mode enable. */
+static const field32_t RCC_RSR_RMVF                       = {.msk = 0x00010000U, .pos = 16}; /** @brief Remove reset flag. */
+static const field32_t RCC_RSR_CPURSTF                    = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU reset flag. */
+static const field32_t RCC_RSR_D1RSTF                     = {.msk = 0x00080000U, .pos = 19}; /** @brief D1 domain power switch reset flag. */
+static const field32_t RCC_RSR_D2RSTF                     = {.msk = 0x00100000U, .pos = 20}; /** @brief D2 domain power switch reset flag. */
+static const field32_t RCC_RSR_BORRSTF                    = {.msk = 0x00200000U, .pos = 21}; /** @brief BOR reset flag. */
+static const field32_t RCC_RSR_PINRSTF                    = {.msk = 0x00400000U, .pos = 22}; /** @brief Pin reset flag (NRST). */
+static const field32_t RCC_RSR_PORRSTF                    = {.msk = 0x00800000U, .pos = 23}; /** @brief POR/PDR reset flag. */
+static const field32_t RCC_RSR_SFTRSTF                    = {.msk = 0x01000000U, .pos = 24}; /** @brief System reset from CPU reset flag. */
+static const field32_t RCC_RSR_IWDG1RSTF                  = {.msk = 0x04000000U, .pos = 26}; /** @brief Independent Watchdog reset flag. */
+static const field32_t RCC_RSR_WWDG1RSTF                  = {.msk = 0x10000000U, .pos = 28}; /** @brief Window Watchdog reset flag. */
+static const field32_t RCC_RSR_LPWRRSTF                   = {.msk = 0x40000000U, .pos = 30}; /** @brief Reset due to illegal D1 DStandby or CPU CStop flag. */
+static const field32_t RCC_C1_RSR_RMVF                    = {.msk = 0x00010000U, .pos = 16}; /** @brief Remove reset flag. */
+static const field32_t RCC_C1_RSR_CPURSTF                 = {.msk = 0x00020000U, .pos = 17}; /** @brief CPU reset flag. */
+static const field32_t RCC_C1_RSR_D1RSTF                  = {.msk = 0x00080000U, .pos = 19}; /** @brief D1 domain power switch reset flag. */
+static const field32_t RCC_C1_RSR_D2RSTF                  = {.msk = 0x00100000U, .pos = 20}; /** @brief D2 domain power switch reset flag. */
+static const field32_t RCC_C1_RSR_BORRSTF                 = {.msk = 0x00200000U, .pos = 21}; /** @brief BOR reset flag. */
+static const field32_t RCC_C1_RSR_PINRSTF                 = {.msk = 0x00400000U, .pos = 22}; /** @brief Pin reset flag (NRST). */
+static const field32_t RCC_C1_RSR_PORRSTF                 = {.msk = 0x00800000U, .pos = 23}; /** @brief POR/PDR reset flag. */
+static const field32_t RCC_C1_RSR_SFTRSTF                 = {.msk = 0x01000000U, .pos = 24}; /** @brief System reset from CPU reset flag. */
+static const field32_t RCC_C1_RSR_IWDG1RSTF               = {.msk = 0x04000000U, .pos = 26}; /** @brief Independent Watchdog reset flag. */
+static const field32_t RCC_C1_RSR_WWDG1RSTF               = {.msk = 0x10000000U, .pos = 28}; /** @brief Window Watchdog reset flag. */
+static const field32_t RCC_C1_RSR_LPWRRSTF                = {.msk = 0x40000000U, .pos = 30}; /** @brief Reset due to illegal D1 DStandby or CPU CStop flag. */
+static const field32_t RCC_C1_AHB3ENR_MDMAEN              = {.msk = 0x00000001U, .pos = 0};  /** @brief MDMA Peripheral Clock Enable. */
+static const field32_t RCC_C1_AHB3ENR_DMA2DEN             = {.msk = 0x00000010U, .pos = 4};  /** @brief DMA2D Peripheral Clock Enable. */
+static const field32_t RCC_C1_AHB3ENR_JPGDECEN            = {.msk = 0x00000020U, .pos = 5};  /** @brief JPGDEC Peripheral Clock Enable. */
+static const field32_t RCC_C1_AHB3ENR_FMCEN               = {.msk = 0x00001000U, .pos = 12}; /** @brief FMC Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB3ENR_QSPIEN              = {.msk = 0x00004000U, .pos = 14}; /** @brief QUADSPI and QUADSPI Delay Clock Enable. */
+static const field32_t RCC_C1_AHB3ENR_SDMMC1EN            = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC1 and SDMMC1 Delay Clock Enable. */
+static const field32_t RCC_AHB3ENR_MDMAEN                 = {.msk = 0x00000001U, .pos = 0};  /** @brief MDMA Peripheral Clock Enable. */
+static const field32_t RCC_AHB3ENR_DMA2DEN                = {.msk = 0x00000010U, .pos = 4};  /** @brief DMA2D Peripheral Clock Enable. */
+static const field32_t RCC_AHB3ENR_JPGDECEN               = {.msk = 0x00000020U, .pos = 5};  /** @brief JPGDEC Peripheral Clock Enable. */
+static const field32_t RCC_AHB3ENR_FMCEN                  = {.msk = 0x00001000U, .pos = 12}; /** @brief FMC Peripheral Clocks Enable. */
+static const field32_t RCC_AHB3ENR_QSPIEN                 = {.msk = 0x00004000U, .pos = 14}; /** @brief QUADSPI and QUADSPI Delay Clock Enable. */
+static const field32_t RCC_AHB3ENR_SDMMC1EN               = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC1 and SDMMC1 Delay Clock Enable. */
+static const field32_t RCC_AHB1ENR_DMA1EN                 = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA1 Clock Enable. */
+static const field32_t RCC_AHB1ENR_DMA2EN                 = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA2 Clock Enable. */
+static const field32_t RCC_AHB1ENR_ADC12EN                = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC1/2 Peripheral Clocks Enable. */
+static const field32_t RCC_AHB1ENR_ETH1MACEN              = {.msk = 0x00008000U, .pos = 15}; /** @brief Ethernet MAC bus interface Clock Enable. */
+static const field32_t RCC_AHB1ENR_ETH1TXEN               = {.msk = 0x00010000U, .pos = 16}; /** @brief Ethernet Transmission Clock Enable. */
+static const field32_t RCC_AHB1ENR_ETH1RXEN               = {.msk = 0x00020000U, .pos = 17}; /** @brief Ethernet Reception Clock Enable. */
+static const field32_t RCC_AHB1ENR_USB1OTGEN              = {.msk = 0x02000000U, .pos = 25}; /** @brief USB1OTG Peripheral Clocks Enable. */
+static const field32_t RCC_AHB1ENR_USB1ULPIEN             = {.msk = 0x04000000U, .pos = 26}; /** @brief USB_PHY1 Clocks Enable. */
+static const field32_t RCC_AHB1ENR_USB2OTGEN              = {.msk = 0x08000000U, .pos = 27}; /** @brief USB2OTG Peripheral Clocks Enable. */
+static const field32_t RCC_AHB1ENR_USB2ULPIEN             = {.msk = 0x10000000U, .pos = 28}; /** @brief USB_PHY2 Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_DMA1EN              = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA1 Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_DMA2EN              = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA2 Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_ADC12EN             = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC1/2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_ETH1MACEN           = {.msk = 0x00008000U, .pos = 15}; /** @brief Ethernet MAC bus interface Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_ETH1TXEN            = {.msk = 0x00010000U, .pos = 16}; /** @brief Ethernet Transmission Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_ETH1RXEN            = {.msk = 0x00020000U, .pos = 17}; /** @brief Ethernet Reception Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_USB1OTGEN           = {.msk = 0x02000000U, .pos = 25}; /** @brief USB1OTG Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_USB1ULPIEN          = {.msk = 0x04000000U, .pos = 26}; /** @brief USB_PHY1 Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_USB2OTGEN           = {.msk = 0x08000000U, .pos = 27}; /** @brief USB2OTG Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_USB2ULPIEN          = {.msk = 0x10000000U, .pos = 28}; /** @brief USB_PHY2 Clocks Enable. */
+static const field32_t RCC_C1_AHB2ENR_CAMITFEN            = {.msk = 0x00000001U, .pos = 0};  /** @brief CAMITF peripheral clock enable. */
+static const field32_t RCC_C1_AHB2ENR_CRYPTEN             = {.msk = 0x00000010U, .pos = 4};  /** @brief CRYPT peripheral clock enable. */
+static const field32_t RCC_C1_AHB2ENR_HASHEN              = {.msk = 0x00000020U, .pos = 5};  /** @brief HASH peripheral clock enable. */
+static const field32_t RCC_C1_AHB2ENR_RNGEN               = {.msk = 0x00000040U, .pos = 6};  /** @brief RNG peripheral clocks enable. */
+static const field32_t RCC_C1_AHB2ENR_SDMMC2EN            = {.msk = 0x00000200U, .pos = 9};  /** @brief SDMMC2 and SDMMC2 delay clock enable. */
+static const field32_t RCC_C1_AHB2ENR_SRAM1EN             = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM1 block enable. */
+static const field32_t RCC_C1_AHB2ENR_SRAM2EN             = {.msk = 0x40000000U, .pos = 30}; /** @brief SRAM2 block enable. */
+static const field32_t RCC_C1_AHB2ENR_SRAM3EN             = {.msk = 0x80000000U, .pos = 31}; /** @brief SRAM3 block enable. */
+static const field32_t RCC_AHB2ENR_CAMITFEN               = {.msk = 0x00000001U, .pos = 0};  /** @brief CAMITF peripheral clock enable. */
+static const field32_t RCC_AHB2ENR_CRYPTEN                = {.msk = 0x00000010U, .pos = 4};  /** @brief CRYPT peripheral clock enable. */
+static const field32_t RCC_AHB2ENR_HASHEN                 = {.msk = 0x00000020U, .pos = 5};  /** @brief HASH peripheral clock enable. */
+static const field32_t RCC_AHB2ENR_RNGEN                  = {.msk = 0x00000040U, .pos = 6};  /** @brief RNG peripheral clocks enable. */
+static const field32_t RCC_AHB2ENR_SDMMC2EN               = {.msk = 0x00000200U, .pos = 9};  /** @brief SDMMC2 and SDMMC2 delay clock enable. */
+static const field32_t RCC_AHB2ENR_SRAM1EN                = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM1 block enable. */
+static const field32_t RCC_AHB2ENR_SRAM2EN                = {.msk = 0x40000000U, .pos = 30}; /** @brief SRAM2 block enable. */
+static const field32_t RCC_AHB2ENR_SRAM3EN                = {.msk = 0x80000000U, .pos = 31}; /** @brief SRAM3 block enable. */
+static const field32_t RCC_AHB4ENR_GPIOAEN                = {.msk = 0x00000001U, .pos = 0};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOBEN                = {.msk = 0x00000002U, .pos = 1};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOCEN                = {.msk = 0x00000004U, .pos = 2};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIODEN                = {.msk = 0x00000008U, .pos = 3};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOEEN                = {.msk = 0x00000010U, .pos = 4};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOFEN                = {.msk = 0x00000020U, .pos = 5};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOGEN                = {.msk = 0x00000040U, .pos = 6};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOHEN                = {.msk = 0x00000080U, .pos = 7};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOIEN                = {.msk = 0x00000100U, .pos = 8};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOJEN                = {.msk = 0x00000200U, .pos = 9};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_GPIOKEN                = {.msk = 0x00000400U, .pos = 10}; /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_CRCEN                  = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_BDMAEN                 = {.msk = 0x00200000U, .pos = 21}; /** @brief BDMA and DMAMUX2 Clock Enable. */
+static const field32_t RCC_AHB4ENR_ADC3EN                 = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 Peripheral Clocks Enable. */
+static const field32_t RCC_AHB4ENR_HSEMEN                 = {.msk = 0x02000000U, .pos = 25}; /** @brief HSEM peripheral clock enable. */
+static const field32_t RCC_AHB4ENR_BKPRAMEN               = {.msk = 0x10000000U, .pos = 28}; /** @brief Backup RAM Clock Enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOAEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOBEN             = {.msk = 0x00000002U, .pos = 1};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOCEN             = {.msk = 0x00000004U, .pos = 2};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIODEN             = {.msk = 0x00000008U, .pos = 3};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOEEN             = {.msk = 0x00000010U, .pos = 4};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOFEN             = {.msk = 0x00000020U, .pos = 5};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOGEN             = {.msk = 0x00000040U, .pos = 6};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOHEN             = {.msk = 0x00000080U, .pos = 7};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOIEN             = {.msk = 0x00000100U, .pos = 8};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOJEN             = {.msk = 0x00000200U, .pos = 9};  /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_GPIOKEN             = {.msk = 0x00000400U, .pos = 10}; /** @brief 0GPIO peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_CRCEN               = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_BDMAEN              = {.msk = 0x00200000U, .pos = 21}; /** @brief BDMA and DMAMUX2 Clock Enable. */
+static const field32_t RCC_C1_AHB4ENR_ADC3EN              = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB4ENR_HSEMEN              = {.msk = 0x02000000U, .pos = 25}; /** @brief HSEM peripheral clock enable. */
+static const field32_t RCC_C1_AHB4ENR_BKPRAMEN            = {.msk = 0x10000000U, .pos = 28}; /** @brief Backup RAM Clock Enable. */
+static const field32_t RCC_C1_APB3ENR_LTDCEN              = {.msk = 0x00000008U, .pos = 3};  /** @brief LTDC peripheral clock enable. */
+static const field32_t RCC_C1_APB3ENR_WWDG1EN             = {.msk = 0x00000040U, .pos = 6};  /** @brief WWDG1 Clock Enable. */
+static const field32_t RCC_APB3ENR_LTDCEN                 = {.msk = 0x00000008U, .pos = 3};  /** @brief LTDC peripheral clock enable. */
+static const field32_t RCC_APB3ENR_WWDG1EN                = {.msk = 0x00000040U, .pos = 6};  /** @brief WWDG1 Clock Enable. */
+static const field32_t RCC_APB1LENR_TIM2EN                = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM3EN                = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM4EN                = {.msk = 0x00000004U, .pos = 2};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM5EN                = {.msk = 0x00000008U, .pos = 3};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM6EN                = {.msk = 0x00000010U, .pos = 4};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM7EN                = {.msk = 0x00000020U, .pos = 5};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM12EN               = {.msk = 0x00000040U, .pos = 6};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM13EN               = {.msk = 0x00000080U, .pos = 7};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIM14EN               = {.msk = 0x00000100U, .pos = 8};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_LPTIM1EN              = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_SPI2EN                = {.msk = 0x00004000U, .pos = 14}; /** @brief SPI2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_SPI3EN                = {.msk = 0x00008000U, .pos = 15}; /** @brief SPI3 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_SPDIFRXEN             = {.msk = 0x00010000U, .pos = 16}; /** @brief SPDIFRX Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_USART2EN              = {.msk = 0x00020000U, .pos = 17}; /** @brief USART2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_USART3EN              = {.msk = 0x00040000U, .pos = 18}; /** @brief USART3 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_UART4EN               = {.msk = 0x00080000U, .pos = 19}; /** @brief UART4 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_UART5EN               = {.msk = 0x00100000U, .pos = 20}; /** @brief UART5 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_I2C1EN                = {.msk = 0x00200000U, .pos = 21}; /** @brief I2C1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_I2C2EN                = {.msk = 0x00400000U, .pos = 22}; /** @brief I2C2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_I2C3EN                = {.msk = 0x00800000U, .pos = 23}; /** @brief I2C3 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_HDMICECEN             = {.msk = 0x08000000U, .pos = 27}; /** @brief HDMI-CEC peripheral clock enable. */
+static const field32_t RCC_APB1LENR_DAC12EN               = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC1&2 peripheral clock enable. */
+static const field32_t RCC_APB1LENR_USART7EN              = {.msk = 0x40000000U, .pos = 30}; /** @brief USART7 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_USART8EN              = {.msk = 0x80000000U, .pos = 31}; /** @brief USART8 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_TIM2EN             = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM3EN             = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM4EN             = {.msk = 0x00000004U, .pos = 2};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM5EN             = {.msk = 0x00000008U, .pos = 3};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM6EN             = {.msk = 0x00000010U, .pos = 4};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM7EN             = {.msk = 0x00000020U, .pos = 5};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM12EN            = {.msk = 0x00000040U, .pos = 6};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM13EN            = {.msk = 0x00000080U, .pos = 7};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIM14EN            = {.msk = 0x00000100U, .pos = 8};  /** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_LPTIM1EN           = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_SPI2EN             = {.msk = 0x00004000U, .pos = 14}; /** @brief SPI2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_SPI3EN             = {.msk = 0x00008000U, .pos = 15}; /** @brief SPI3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_SPDIFRXEN          = {.msk = 0x00010000U, .pos = 16}; /** @brief SPDIFRX Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_USART2EN           = {.msk = 0x00020000U, .pos = 17}; /** @brief USART2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_USART3EN           = {.msk = 0x00040000U, .pos = 18}; /** @brief USART3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_UART4EN            = {.msk = 0x00080000U, .pos = 19}; /** @brief UART4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_UART5EN            = {.msk = 0x00100000U, .pos = 20}; /** @brief UART5 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_I2C1EN             = {.msk = 0x00200000U, .pos = 21}; /** @brief I2C1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_I2C2EN             = {.msk = 0x00400000U, .pos = 22}; /** @brief I2C2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_I2C3EN             = {.msk = 0x00800000U, .pos = 23}; /** @brief I2C3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_HDMICECEN          = {.msk = 0x08000000U, .pos = 27}; /** @brief HDMI-CEC peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_DAC12EN            = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC1&2 peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_USART7EN           = {.msk = 0x40000000U, .pos = 30}; /** @brief USART7 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_USART8EN           = {.msk = 0x80000000U, .pos = 31}; /** @brief USART8 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1HENR_CRSEN                 = {.msk = 0x00000002U, .pos = 1};  /** @brief Clock Recovery System peripheral clock enable. */
+static const field32_t RCC_APB1HENR_SWPEN                 = {.msk = 0x00000004U, .pos = 2};  /** @brief SWPMI Peripheral Clocks Enable. */
+static const field32_t RCC_APB1HENR_OPAMPEN               = {.msk = 0x00000010U, .pos = 4};  /** @brief OPAMP peripheral clock enable. */
+static const field32_t RCC_APB1HENR_MDIOSEN               = {.msk = 0x00000020U, .pos = 5};  /** @brief MDIOS peripheral clock enable. */
+static const field32_t RCC_APB1HENR_FDCANEN               = {.msk = 0x00000100U, .pos = 8};  /** @brief FDCAN Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1HENR_CRSEN              = {.msk = 0x00000002U, .pos = 1};  /** @brief Clock Recovery System peripheral clock enable. */
+static const field32_t RCC_C1_APB1HENR_SWPEN              = {.msk = 0x00000004U, .pos = 2};  /** @brief SWPMI Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1HENR_OPAMPEN            = {.msk = 0x00000010U, .pos = 4};  /** @brief OPAMP peripheral clock enable. */
+static const field32_t RCC_C1_APB1HENR_MDIOSEN            = {.msk = 0x00000020U, .pos = 5};  /** @brief MDIOS peripheral clock enable. */
+static const field32_t RCC_C1_APB1HENR_FDCANEN            = {.msk = 0x00000100U, .pos = 8};  /** @brief FDCAN Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_TIM1EN              = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM1 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_TIM8EN              = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM8 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_USART1EN            = {.msk = 0x00000010U, .pos = 4};  /** @brief USART1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_USART6EN            = {.msk = 0x00000020U, .pos = 5};  /** @brief USART6 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SPI1EN              = {.msk = 0x00001000U, .pos = 12}; /** @brief SPI1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SPI4EN              = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_TIM16EN             = {.msk = 0x00020000U, .pos = 17}; /** @brief TIM16 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_TIM15EN             = {.msk = 0x00010000U, .pos = 16}; /** @brief TIM15 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_TIM17EN             = {.msk = 0x00040000U, .pos = 18}; /** @brief TIM17 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_SPI5EN              = {.msk = 0x00100000U, .pos = 20}; /** @brief SPI5 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SAI1EN              = {.msk = 0x00400000U, .pos = 22}; /** @brief SAI1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SAI2EN              = {.msk = 0x00800000U, .pos = 23}; /** @brief SAI2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SAI3EN              = {.msk = 0x01000000U, .pos = 24}; /** @brief SAI3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_DFSDM1EN            = {.msk = 0x10000000U, .pos = 28}; /** @brief DFSDM1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_HRTIMEN             = {.msk = 0x20000000U, .pos = 29}; /** @brief HRTIM peripheral clock enable. */
+static const field32_t RCC_APB2ENR_TIM1EN                 = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM1 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_TIM8EN                 = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM8 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_USART1EN               = {.msk = 0x00000010U, .pos = 4};  /** @brief USART1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_USART6EN               = {.msk = 0x00000020U, .pos = 5};  /** @brief USART6 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SPI1EN                 = {.msk = 0x00001000U, .pos = 12}; /** @brief SPI1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SPI4EN                 = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI4 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_TIM16EN                = {.msk = 0x00020000U, .pos = 17}; /** @brief TIM16 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_TIM15EN                = {.msk = 0x00010000U, .pos = 16}; /** @brief TIM15 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_TIM17EN                = {.msk = 0x00040000U, .pos = 18}; /** @brief TIM17 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_SPI5EN                 = {.msk = 0x00100000U, .pos = 20}; /** @brief SPI5 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SAI1EN                 = {.msk = 0x00400000U, .pos = 22}; /** @brief SAI1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SAI2EN                 = {.msk = 0x00800000U, .pos = 23}; /** @brief SAI2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SAI3EN                 = {.msk = 0x01000000U, .pos = 24}; /** @brief SAI3 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_DFSDM1EN               = {.msk = 0x10000000U, .pos = 28}; /** @brief DFSDM1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_HRTIMEN                = {.msk = 0x20000000U, .pos = 29}; /** @brief HRTIM peripheral clock enable. */
+static const field32_t RCC_APB4ENR_SYSCFGEN               = {.msk = 0x00000002U, .pos = 1};  /** @brief SYSCFG peripheral clock enable. */
+static const field32_t RCC_APB4ENR_LPUART1EN              = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_SPI6EN                 = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_I2C4EN                 = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_LPTIM2EN               = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_LPTIM3EN               = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_LPTIM4EN               = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_LPTIM5EN               = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_COMP12EN               = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP1/2 peripheral clock enable. */
+static const field32_t RCC_APB4ENR_VREFEN                 = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF peripheral clock enable. */
+static const field32_t RCC_APB4ENR_RTCAPBEN               = {.msk = 0x00010000U, .pos = 16}; /** @brief RTC APB Clock Enable. */
+static const field32_t RCC_APB4ENR_SAI4EN                 = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_SYSCFGEN            = {.msk = 0x00000002U, .pos = 1};  /** @brief SYSCFG peripheral clock enable. */
+static const field32_t RCC_C1_APB4ENR_LPUART1EN           = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_SPI6EN              = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_I2C4EN              = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_LPTIM2EN            = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_LPTIM3EN            = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_LPTIM4EN            = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_LPTIM5EN            = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_COMP12EN            = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP1/2 peripheral clock enable. */
+static const field32_t RCC_C1_APB4ENR_VREFEN              = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF peripheral clock enable. */
+static const field32_t RCC_C1_APB4ENR_RTCAPBEN            = {.msk = 0x00010000U, .pos = 16}; /** @brief RTC APB Clock Enable. */
+static const field32_t RCC_C1_APB4ENR_SAI4EN              = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB3LPENR_MDMALPEN          = {.msk = 0x00000001U, .pos = 0};  /** @brief MDMA Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_DMA2DLPEN         = {.msk = 0x00000010U, .pos = 4};  /** @brief DMA2D Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_JPGDECLPEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief JPGDEC Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_FLITFLPEN         = {.msk = 0x00000100U, .pos = 8};  /** @brief FLITF Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_FMCLPEN           = {.msk = 0x00001000U, .pos = 12}; /** @brief FMC Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_QSPILPEN          = {.msk = 0x00004000U, .pos = 14}; /** @brief QUADSPI and QUADSPI Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_SDMMC1LPEN        = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC1 and SDMMC1 Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB3LPENR_D1DTCM1LPEN       = {.msk = 0x10000000U, .pos = 28}; /** @brief D1DTCM1 Block Clock Enable During CSleep mode. */
+static const field32_t RCC_C1_AHB3LPENR_DTCM2LPEN         = {.msk = 0x20000000U, .pos = 29}; /** @brief D1 DTCM2 Block Clock Enable During CSleep mode. */
+static const field32_t RCC_C1_AHB3LPENR_ITCMLPEN          = {.msk = 0x40000000U, .pos = 30}; /** @brief D1ITCM Block Clock Enable During CSleep mode. */
+static const field32_t RCC_C1_AHB3LPENR_AXISRAMLPEN       = {.msk = 0x80000000U, .pos = 31}; /** @brief AXISRAM Block Clock Enable During CSleep mode. */
+static const field32_t RCC_AHB3LPENR_MDMALPEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief MDMA Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_DMA2DLPEN            = {.msk = 0x00000010U, .pos = 4};  /** @brief DMA2D Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_JPGDECLPEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief JPGDEC Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_FLITFLPEN            = {.msk = 0x00000100U, .pos = 8};  /** @brief FLITF Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_FMCLPEN              = {.msk = 0x00001000U, .pos = 12}; /** @brief FMC Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_QSPILPEN             = {.msk = 0x00004000U, .pos = 14}; /** @brief QUADSPI and QUADSPI Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_SDMMC1LPEN           = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC1 and SDMMC1 Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB3LPENR_D1DTCM1LPEN          = {.msk = 0x10000000U, .pos = 28}; /** @brief D1DTCM1 Block Clock Enable During CSleep mode. */
+static const field32_t RCC_AHB3LPENR_DTCM2LPEN            = {.msk = 0x20000000U, .pos = 29}; /** @brief D1 DTCM2 Block Clock Enable During CSleep mode. */
+static const field32_t RCC_AHB3LPENR_ITCMLPEN             = {.msk = 0x40000000U, .pos = 30}; /** @brief D1ITCM Block Clock Enable During CSleep mode. */
+static const field32_t RCC_AHB3LPENR_AXISRAMLPEN          = {.msk = 0x80000000U, .pos = 31}; /** @brief AXISRAM Block Clock Enable During CSleep mode. */
+static const field32_t RCC_AHB1LPENR_DMA1LPEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_DMA2LPEN             = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA2 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_ADC12LPEN            = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC1/2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_ETH1MACLPEN          = {.msk = 0x00008000U, .pos = 15}; /** @brief Ethernet MAC bus interface Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_ETH1TXLPEN           = {.msk = 0x00010000U, .pos = 16}; /** @brief Ethernet Transmission Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_ETH1RXLPEN           = {.msk = 0x00020000U, .pos = 17}; /** @brief Ethernet Reception Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_USB1OTGLPEN          = {.msk = 0x02000000U, .pos = 25}; /** @brief USB1OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB1LPENR_USB1ULPILPEN         = {.msk = 0x04000000U, .pos = 26}; /** @brief USB_PHY1 clock enable during CSleep mode. */
+static const field32_t RCC_AHB1LPENR_USB2OTGLPEN          = {.msk = 0x08000000U, .pos = 27}; /** @brief USB2OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB1LPENR_USB2ULPILPEN         = {.msk = 0x10000000U, .pos = 28}; /** @brief USB_PHY2 clocks enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_DMA1LPEN          = {.msk = 0x00000001U, .pos = 0};  /** @brief DMA1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_DMA2LPEN          = {.msk = 0x00000002U, .pos = 1};  /** @brief DMA2 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_ADC12LPEN         = {.msk = 0x00000020U, .pos = 5};  /** @brief ADC1/2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_ETH1MACLPEN       = {.msk = 0x00008000U, .pos = 15}; /** @brief Ethernet MAC bus interface Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_ETH1TXLPEN        = {.msk = 0x00010000U, .pos = 16}; /** @brief Ethernet Transmission Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_ETH1RXLPEN        = {.msk = 0x00020000U, .pos = 17}; /** @brief Ethernet Reception Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_USB1OTGLPEN       = {.msk = 0x02000000U, .pos = 25}; /** @brief USB1OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_USB1ULPILPEN      = {.msk = 0x04000000U, .pos = 26}; /** @brief USB_PHY1 clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_USB2OTGLPEN       = {.msk = 0x08000000U, .pos = 27}; /** @brief USB2OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_USB2ULPILPEN      = {.msk = 0x10000000U, .pos = 28}; /** @brief USB_PHY2 clocks enable during CSleep mode. */
+static const field32_t RCC_C1_AHB2LPENR_CAMITFLPEN        = {.msk = 0x00000001U, .pos = 0};  /** @brief CAMITF peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB2LPENR_CRYPTLPEN         = {.msk = 0x00000010U, .pos = 4};  /** @brief CRYPT peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB2LPENR_HASHLPEN          = {.msk = 0x00000020U, .pos = 5};  /** @brief HASH peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB2LPENR_SDMMC2LPEN        = {.msk = 0x00000200U, .pos = 9};  /** @brief SDMMC2 and SDMMC2 Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB2LPENR_RNGLPEN           = {.msk = 0x00000040U, .pos = 6};  /** @brief RNG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB2LPENR_SRAM1LPEN         = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB2LPENR_SRAM2LPEN         = {.msk = 0x40000000U, .pos = 30}; /** @brief SRAM2 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB2LPENR_SRAM3LPEN         = {.msk = 0x80000000U, .pos = 31}; /** @brief SRAM3 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB2LPENR_CAMITFLPEN           = {.msk = 0x00000001U, .pos = 0};  /** @brief CAMITF peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB2LPENR_CRYPTLPEN            = {.msk = 0x00000010U, .pos = 4};  /** @brief CRYPT peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB2LPENR_HASHLPEN             = {.msk = 0x00000020U, .pos = 5};  /** @brief HASH peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB2LPENR_SDMMC2LPEN           = {.msk = 0x00000200U, .pos = 9};  /** @brief SDMMC2 and SDMMC2 Delay Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB2LPENR_RNGLPEN              = {.msk = 0x00000040U, .pos = 6};  /** @brief RNG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB2LPENR_SRAM1LPEN            = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB2LPENR_SRAM2LPEN            = {.msk = 0x40000000U, .pos = 30}; /** @brief SRAM2 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB2LPENR_SRAM3LPEN            = {.msk = 0x80000000U, .pos = 31}; /** @brief SRAM3 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB4LPENR_GPIOALPEN            = {.msk = 0x00000001U, .pos = 0};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOBLPEN            = {.msk = 0x00000002U, .pos = 1};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOCLPEN            = {.msk = 0x00000004U, .pos = 2};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIODLPEN            = {.msk = 0x00000008U, .pos = 3};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOELPEN            = {.msk = 0x00000010U, .pos = 4};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOFLPEN            = {.msk = 0x00000020U, .pos = 5};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOGLPEN            = {.msk = 0x00000040U, .pos = 6};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOHLPEN            = {.msk = 0x00000080U, .pos = 7};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOILPEN            = {.msk = 0x00000100U, .pos = 8};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOJLPEN            = {.msk = 0x00000200U, .pos = 9};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_GPIOKLPEN            = {.msk = 0x00000400U, .pos = 10}; /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_CRCLPEN              = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB4LPENR_BDMALPEN             = {.msk = 0x00200000U, .pos = 21}; /** @brief BDMA Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB4LPENR_ADC3LPEN             = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_AHB4LPENR_BKPRAMLPEN           = {.msk = 0x10000000U, .pos = 28}; /** @brief Backup RAM Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB4LPENR_SRAM4LPEN            = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM4 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOALPEN         = {.msk = 0x00000001U, .pos = 0};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOBLPEN         = {.msk = 0x00000002U, .pos = 1};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOCLPEN         = {.msk = 0x00000004U, .pos = 2};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIODLPEN         = {.msk = 0x00000008U, .pos = 3};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOELPEN         = {.msk = 0x00000010U, .pos = 4};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOFLPEN         = {.msk = 0x00000020U, .pos = 5};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOGLPEN         = {.msk = 0x00000040U, .pos = 6};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOHLPEN         = {.msk = 0x00000080U, .pos = 7};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOILPEN         = {.msk = 0x00000100U, .pos = 8};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOJLPEN         = {.msk = 0x00000200U, .pos = 9};  /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_GPIOKLPEN         = {.msk = 0x00000400U, .pos = 10}; /** @brief GPIO peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_CRCLPEN           = {.msk = 0x00080000U, .pos = 19}; /** @brief CRC peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB4LPENR_BDMALPEN          = {.msk = 0x00200000U, .pos = 21}; /** @brief BDMA Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB4LPENR_ADC3LPEN          = {.msk = 0x01000000U, .pos = 24}; /** @brief ADC3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB4LPENR_BKPRAMLPEN        = {.msk = 0x10000000U, .pos = 28}; /** @brief Backup RAM Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB4LPENR_SRAM4LPEN         = {.msk = 0x20000000U, .pos = 29}; /** @brief SRAM4 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB3LPENR_LTDCLPEN          = {.msk = 0x00000008U, .pos = 3};  /** @brief LTDC peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB3LPENR_WWDG1LPEN         = {.msk = 0x00000040U, .pos = 6};  /** @brief WWDG1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_APB3LPENR_LTDCLPEN             = {.msk = 0x00000008U, .pos = 3};  /** @brief LTDC peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB3LPENR_WWDG1LPEN            = {.msk = 0x00000040U, .pos = 6};  /** @brief WWDG1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_TIM2LPEN            = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM3LPEN            = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM3 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM4LPEN            = {.msk = 0x00000004U, .pos = 2};  /** @brief TIM4 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM5LPEN            = {.msk = 0x00000008U, .pos = 3};  /** @brief TIM5 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM6LPEN            = {.msk = 0x00000010U, .pos = 4};  /** @brief TIM6 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM7LPEN            = {.msk = 0x00000020U, .pos = 5};  /** @brief TIM7 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM12LPEN           = {.msk = 0x00000040U, .pos = 6};  /** @brief TIM12 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM13LPEN           = {.msk = 0x00000080U, .pos = 7};  /** @brief TIM13 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIM14LPEN           = {.msk = 0x00000100U, .pos = 8};  /** @brief TIM14 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_LPTIM1LPEN          = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_SPI2LPEN            = {.msk = 0x00004000U, .pos = 14}; /** @brief SPI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_SPI3LPEN            = {.msk = 0x00008000U, .pos = 15}; /** @brief SPI3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_SPDIFRXLPEN         = {.msk = 0x00010000U, .pos = 16}; /** @brief SPDIFRX Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_USART2LPEN          = {.msk = 0x00020000U, .pos = 17}; /** @brief USART2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_USART3LPEN          = {.msk = 0x00040000U, .pos = 18}; /** @brief USART3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_UART4LPEN           = {.msk = 0x00080000U, .pos = 19}; /** @brief UART4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_UART5LPEN           = {.msk = 0x00100000U, .pos = 20}; /** @brief UART5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_I2C1LPEN            = {.msk = 0x00200000U, .pos = 21}; /** @brief I2C1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_I2C2LPEN            = {.msk = 0x00400000U, .pos = 22}; /** @brief I2C2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_I2C3LPEN            = {.msk = 0x00800000U, .pos = 23}; /** @brief I2C3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_HDMICECLPEN         = {.msk = 0x08000000U, .pos = 27}; /** @brief HDMI-CEC Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_DAC12LPEN           = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC1/2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_USART7LPEN          = {.msk = 0x40000000U, .pos = 30}; /** @brief USART7 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_USART8LPEN          = {.msk = 0x80000000U, .pos = 31}; /** @brief USART8 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM2LPEN         = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM3LPEN         = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM3 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM4LPEN         = {.msk = 0x00000004U, .pos = 2};  /** @brief TIM4 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM5LPEN         = {.msk = 0x00000008U, .pos = 3};  /** @brief TIM5 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM6LPEN         = {.msk = 0x00000010U, .pos = 4};  /** @brief TIM6 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM7LPEN         = {.msk = 0x00000020U, .pos = 5};  /** @brief TIM7 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM12LPEN        = {.msk = 0x00000040U, .pos = 6};  /** @brief TIM12 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM13LPEN        = {.msk = 0x00000080U, .pos = 7};  /** @brief TIM13 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIM14LPEN        = {.msk = 0x00000100U, .pos = 8};  /** @brief TIM14 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_LPTIM1LPEN       = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_SPI2LPEN         = {.msk = 0x00004000U, .pos = 14}; /** @brief SPI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_SPI3LPEN         = {.msk = 0x00008000U, .pos = 15}; /** @brief SPI3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_SPDIFRXLPEN      = {.msk = 0x00010000U, .pos = 16}; /** @brief SPDIFRX Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_USART2LPEN       = {.msk = 0x00020000U, .pos = 17}; /** @brief USART2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_USART3LPEN       = {.msk = 0x00040000U, .pos = 18}; /** @brief USART3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_UART4LPEN        = {.msk = 0x00080000U, .pos = 19}; /** @brief UART4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_UART5LPEN        = {.msk = 0x00100000U, .pos = 20}; /** @brief UART5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_I2C1LPEN         = {.msk = 0x00200000U, .pos = 21}; /** @brief I2C1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_I2C2LPEN         = {.msk = 0x00400000U, .pos = 22}; /** @brief I2C2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_I2C3LPEN         = {.msk = 0x00800000U, .pos = 23}; /** @brief I2C3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_HDMICECLPEN      = {.msk = 0x08000000U, .pos = 27}; /** @brief HDMI-CEC Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_DAC12LPEN        = {.msk = 0x20000000U, .pos = 29}; /** @brief DAC1/2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_USART7LPEN       = {.msk = 0x40000000U, .pos = 30}; /** @brief USART7 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_USART8LPEN       = {.msk = 0x80000000U, .pos = 31}; /** @brief USART8 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1HLPENR_CRSLPEN          = {.msk = 0x00000002U, .pos = 1};  /** @brief Clock Recovery System peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1HLPENR_SWPLPEN          = {.msk = 0x00000004U, .pos = 2};  /** @brief SWPMI Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1HLPENR_OPAMPLPEN        = {.msk = 0x00000010U, .pos = 4};  /** @brief OPAMP peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1HLPENR_MDIOSLPEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief MDIOS peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1HLPENR_FDCANLPEN        = {.msk = 0x00000100U, .pos = 8};  /** @brief FDCAN Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1HLPENR_CRSLPEN             = {.msk = 0x00000002U, .pos = 1};  /** @brief Clock Recovery System peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1HLPENR_SWPLPEN             = {.msk = 0x00000004U, .pos = 2};  /** @brief SWPMI Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1HLPENR_OPAMPLPEN           = {.msk = 0x00000010U, .pos = 4};  /** @brief OPAMP peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1HLPENR_MDIOSLPEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief MDIOS peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1HLPENR_FDCANLPEN           = {.msk = 0x00000100U, .pos = 8};  /** @brief FDCAN Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_TIM1LPEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM1 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_TIM8LPEN             = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM8 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_USART1LPEN           = {.msk = 0x00000010U, .pos = 4};  /** @brief USART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_USART6LPEN           = {.msk = 0x00000020U, .pos = 5};  /** @brief USART6 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SPI1LPEN             = {.msk = 0x00001000U, .pos = 12}; /** @brief SPI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SPI4LPEN             = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_TIM15LPEN            = {.msk = 0x00010000U, .pos = 16}; /** @brief TIM15 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_TIM16LPEN            = {.msk = 0x00020000U, .pos = 17}; /** @brief TIM16 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_TIM17LPEN            = {.msk = 0x00040000U, .pos = 18}; /** @brief TIM17 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_SPI5LPEN             = {.msk = 0x00100000U, .pos = 20}; /** @brief SPI5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SAI1LPEN             = {.msk = 0x00400000U, .pos = 22}; /** @brief SAI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SAI2LPEN             = {.msk = 0x00800000U, .pos = 23}; /** @brief SAI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SAI3LPEN             = {.msk = 0x01000000U, .pos = 24}; /** @brief SAI3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_DFSDM1LPEN           = {.msk = 0x10000000U, .pos = 28}; /** @brief DFSDM1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_HRTIMLPEN            = {.msk = 0x20000000U, .pos = 29}; /** @brief HRTIM peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_TIM1LPEN          = {.msk = 0x00000001U, .pos = 0};  /** @brief TIM1 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_TIM8LPEN          = {.msk = 0x00000002U, .pos = 1};  /** @brief TIM8 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_USART1LPEN        = {.msk = 0x00000010U, .pos = 4};  /** @brief USART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_USART6LPEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief USART6 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SPI1LPEN          = {.msk = 0x00001000U, .pos = 12}; /** @brief SPI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SPI4LPEN          = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_TIM15LPEN         = {.msk = 0x00010000U, .pos = 16}; /** @brief TIM15 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_TIM16LPEN         = {.msk = 0x00020000U, .pos = 17}; /** @brief TIM16 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_TIM17LPEN         = {.msk = 0x00040000U, .pos = 18}; /** @brief TIM17 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_SPI5LPEN          = {.msk = 0x00100000U, .pos = 20}; /** @brief SPI5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SAI1LPEN          = {.msk = 0x00400000U, .pos = 22}; /** @brief SAI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SAI2LPEN          = {.msk = 0x00800000U, .pos = 23}; /** @brief SAI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SAI3LPEN          = {.msk = 0x01000000U, .pos = 24}; /** @brief SAI3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_DFSDM1LPEN        = {.msk = 0x10000000U, .pos = 28}; /** @brief DFSDM1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_HRTIMLPEN         = {.msk = 0x20000000U, .pos = 29}; /** @brief HRTIM peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB4LPENR_SYSCFGLPEN        = {.msk = 0x00000002U, .pos = 1};  /** @brief SYSCFG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB4LPENR_LPUART1LPEN       = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_SPI6LPEN          = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_I2C4LPEN          = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_LPTIM2LPEN        = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_LPTIM3LPEN        = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_LPTIM4LPEN        = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_LPTIM5LPEN        = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_COMP12LPEN        = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP1/2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB4LPENR_VREFLPEN          = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB4LPENR_RTCAPBLPEN        = {.msk = 0x00010000U, .pos = 16}; /** @brief RTC APB Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_SAI4LPEN          = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_SYSCFGLPEN           = {.msk = 0x00000002U, .pos = 1};  /** @brief SYSCFG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB4LPENR_LPUART1LPEN          = {.msk = 0x00000008U, .pos = 3};  /** @brief LPUART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_SPI6LPEN             = {.msk = 0x00000020U, .pos = 5};  /** @brief SPI6 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_I2C4LPEN             = {.msk = 0x00000080U, .pos = 7};  /** @brief I2C4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_LPTIM2LPEN           = {.msk = 0x00000200U, .pos = 9};  /** @brief LPTIM2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_LPTIM3LPEN           = {.msk = 0x00000400U, .pos = 10}; /** @brief LPTIM3 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_LPTIM4LPEN           = {.msk = 0x00000800U, .pos = 11}; /** @brief LPTIM4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_LPTIM5LPEN           = {.msk = 0x00001000U, .pos = 12}; /** @brief LPTIM5 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_COMP12LPEN           = {.msk = 0x00004000U, .pos = 14}; /** @brief COMP1/2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB4LPENR_VREFLPEN             = {.msk = 0x00008000U, .pos = 15}; /** @brief VREF peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB4LPENR_RTCAPBLPEN           = {.msk = 0x00010000U, .pos = 16}; /** @brief RTC APB Clock Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_SAI4LPEN             = {.msk = 0x00200000U, .pos = 21}; /** @brief SAI4 Peripheral Clocks Enable During CSleep Mode. */
+
+/** @subsection Enumerated RCC Register Field Definitions */
+
+/** @brief D1 domain clocks ready flag. */
+static const field32_t RCC_CR_DxCKRDY[3] = {
+  [1] = {.msk = 0x00004000U, .pos = 14},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief PLL1 enable. */
+static const field32_t RCC_CR_PLLxON[4] = {
+  [1] = {.msk = 0x01000000U, .pos = 24},
+  [2] = {.msk = 0x04000000U, .pos = 26},
+  [3] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief PLL1 clock ready flag. */
+static const field32_t RCC_CR_PLLxRDY[4] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+  [3] = {.msk = 0x20000000U, .pos = 29},
+};
+
+/** @brief MCO1 prescaler. */
+static const field32_t RCC_CFGR_MCOxPRE[3] = {
+  [1] = {.msk = 0x003C0000U, .pos = 18},
+  [2] = {.msk = 0x1E000000U, .pos = 25},
+};
+
+/** @brief Micro-controller clock output 1. */
+static const field32_t RCC_CFGR_MCOxSEL[3] = {
+  [1] = {.msk = 0x01C00000U, .pos = 22},
+  [2] = {.msk = 0xE0000000U, .pos = 29},
+};
+
+/** @brief D2 domain APB1 prescaler. */
+static const field32_t RCC_D2CFGR_D2PPREx[3] = {
+  [1] = {.msk = 0x00000070U, .pos = 4},
+  [2] = {.msk = 0x00000700U, .pos = 8},
+};
+
+/** @brief Prescaler for PLL1. */
+static const field32_t RCC_PLLCKSELR_DIVMx[4] = {
+  [1] = {.msk = 0x000003F0U, .pos = 4},
+  [2] = {.msk = 0x0003F000U, .pos = 12},
+  [3] = {.msk = 0x03F00000U, .pos = 20},
+};
+
+/** @brief PLL1 fractional latch enable. */
+static const field32_t RCC_PLLCFGR_PLLxFRACEN[4] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief PLL1 VCO selection. */
+static const field32_t RCC_PLLCFGR_PLLxVCOSEL[4] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+  [3] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief PLL1 input frequency range. */
+static const field32_t RCC_PLLCFGR_PLLxRGE[4] = {
+  [1] = {.msk = 0x0000000CU, .pos = 2},
+  [2] = {.msk = 0x000000C0U, .pos = 6},
+  [3] = {.msk = 0x00000C00U, .pos = 10},
+};
+
+/** @brief PLL1 DIVP divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVPxEN[4] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+  [3] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief PLL1 DIVQ divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVQxEN[4] = {
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief PLL1 DIVR divider output enable. */
+static const field32_t RCC_PLLCFGR_DIVRxEN[4] = {
+  [1] = {.msk = 0x00040000U, .pos = 18},
+  [2] = {.msk = 0x00200000U, .pos = 21},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief SAI1 and DFSDM1 kernel Aclk clock source selection. */
+static const field32_t RCC_D2CCIP1R_SAIxSRC[24] = {
+  [1]  = {.msk = 0x00000007U, .pos = 0},
+  [23] = {.msk = 0x000001C0U, .pos = 6},
+};
+
+/** @brief PLL1 ready Interrupt Enable. */
+static const field32_t RCC_CIER_PLLxRDYIE[4] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief PLL1 ready Interrupt Flag. */
+static const field32_t RCC_CIFR_PLLxRDYF[4] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief PLL1 ready Interrupt Clear. */
+static const field32_t RCC_CICR_PLLxRDYC[4] = {
+  [1] = {.msk = 0x00000040U, .pos = 6},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+  [3] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief DMA1 block reset. */
+static const field32_t RCC_AHB1RSTR_DMAxRST[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief USB1OTG block reset. */
+static const field32_t RCC_AHB1RSTR_USBxOTGRST[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief TIM block reset. */
+static const field32_t RCC_APB1LRSTR_TIMxRST[15] = {
+  [2]  = {.msk = 0x00000001U, .pos = 0},
+  [3]  = {.msk = 0x00000002U, .pos = 1},
+  [4]  = {.msk = 0x00000004U, .pos = 2},
+  [5]  = {.msk = 0x00000008U, .pos = 3},
+  [6]  = {.msk = 0x00000010U, .pos = 4},
+  [7]  = {.msk = 0x00000020U, .pos = 5},
+  [12] = {.msk = 0x00000040U, .pos = 6},
+  [13] = {.msk = 0x00000080U, .pos = 7},
+  [14] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief SPI2 block reset. */
+static const field32_t RCC_APB1LRSTR_SPIxRST[4] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief USART2 block reset. */
+static const field32_t RCC_APB1LRSTR_USARTxRST[9] = {
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x40000000U, .pos = 30},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief UART4 block reset. */
+static const field32_t RCC_APB1LRSTR_UARTxRST[6] = {
+  [4] = {.msk = 0x00080000U, .pos = 19},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief I2C1 block reset. */
+static const field32_t RCC_APB1LRSTR_I2CxRST[4] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief TIM1 block reset. */
+static const field32_t RCC_APB2RSTR_TIMxRST[18] = {
+  [1]  = {.msk = 0x00000001U, .pos = 0},
+  [8]  = {.msk = 0x00000002U, .pos = 1},
+  [15] = {.msk = 0x00010000U, .pos = 16},
+  [16] = {.msk = 0x00020000U, .pos = 17},
+  [17] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief USART1 block reset. */
+static const field32_t RCC_APB2RSTR_USARTxRST[7] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief SPI1 block reset. */
+static const field32_t RCC_APB2RSTR_SPIxRST[6] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SAI1 block reset. */
+static const field32_t RCC_APB2RSTR_SAIxRST[4] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief LPTIM2 block reset. */
+static const field32_t RCC_APB4RSTR_LPTIMxRST[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief LPTIM2 Autonomous mode enable. */
+static const field32_t RCC_D3AMR_LPTIMxAMEN[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief D1 domain power switch reset flag. */
+static const field32_t RCC_RSR_DxRSTF[3] = {
+  [1] = {.msk = 0x00080000U, .pos = 19},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief D1 domain power switch reset flag. */
+static const field32_t RCC_C1_RSR_DxRSTF[3] = {
+  [1] = {.msk = 0x00080000U, .pos = 19},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief DMA1 Clock Enable. */
+static const field32_t RCC_AHB1ENR_DMAxEN[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief USB1OTG Peripheral Clocks Enable. */
+static const field32_t RCC_AHB1ENR_USBxOTGEN[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief USB_PHY1 Clocks Enable. */
+static const field32_t RCC_AHB1ENR_USBxULPIEN[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief DMA1 Clock Enable. */
+static const field32_t RCC_C1_AHB1ENR_DMAxEN[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief USB1OTG Peripheral Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_USBxOTGEN[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief USB_PHY1 Clocks Enable. */
+static const field32_t RCC_C1_AHB1ENR_USBxULPIEN[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief SRAM1 block enable. */
+static const field32_t RCC_C1_AHB2ENR_SRAMxEN[4] = {
+  [1] = {.msk = 0x20000000U, .pos = 29},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+  [3] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief SRAM1 block enable. */
+static const field32_t RCC_AHB2ENR_SRAMxEN[4] = {
+  [1] = {.msk = 0x20000000U, .pos = 29},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+  [3] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief TIM peripheral clock enable. */
+static const field32_t RCC_APB1LENR_TIMxEN[15] = {
+  [2]  = {.msk = 0x00000001U, .pos = 0},
+  [3]  = {.msk = 0x00000002U, .pos = 1},
+  [4]  = {.msk = 0x00000004U, .pos = 2},
+  [5]  = {.msk = 0x00000008U, .pos = 3},
+  [6]  = {.msk = 0x00000010U, .pos = 4},
+  [7]  = {.msk = 0x00000020U, .pos = 5},
+  [12] = {.msk = 0x00000040U, .pos = 6},
+  [13] = {.msk = 0x00000080U, .pos = 7},
+  [14] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief SPI2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_SPIxEN[4] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief USART2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_USARTxEN[9] = {
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x40000000U, .pos = 30},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief UART4 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_UARTxEN[6] = {
+  [4] = {.msk = 0x00080000U, .pos = 19},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief I2C1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB1LENR_I2CxEN[4] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief TIM peripheral clock enable. */
+static const field32_t RCC_C1_APB1LENR_TIMxEN[15] = {
+  [2]  = {.msk = 0x00000001U, .pos = 0},
+  [3]  = {.msk = 0x00000002U, .pos = 1},
+  [4]  = {.msk = 0x00000004U, .pos = 2},
+  [5]  = {.msk = 0x00000008U, .pos = 3},
+  [6]  = {.msk = 0x00000010U, .pos = 4},
+  [7]  = {.msk = 0x00000020U, .pos = 5},
+  [12] = {.msk = 0x00000040U, .pos = 6},
+  [13] = {.msk = 0x00000080U, .pos = 7},
+  [14] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief SPI2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_SPIxEN[4] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief USART2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_USARTxEN[9] = {
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x40000000U, .pos = 30},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief UART4 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_UARTxEN[6] = {
+  [4] = {.msk = 0x00080000U, .pos = 19},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief I2C1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB1LENR_I2CxEN[4] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief TIM1 peripheral clock enable. */
+static const field32_t RCC_C1_APB2ENR_TIMxEN[18] = {
+  [1]  = {.msk = 0x00000001U, .pos = 0},
+  [8]  = {.msk = 0x00000002U, .pos = 1},
+  [15] = {.msk = 0x00010000U, .pos = 16},
+  [16] = {.msk = 0x00020000U, .pos = 17},
+  [17] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief USART1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_USARTxEN[7] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief SPI1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SPIxEN[6] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SAI1 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB2ENR_SAIxEN[4] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief TIM1 peripheral clock enable. */
+static const field32_t RCC_APB2ENR_TIMxEN[18] = {
+  [1]  = {.msk = 0x00000001U, .pos = 0},
+  [8]  = {.msk = 0x00000002U, .pos = 1},
+  [15] = {.msk = 0x00010000U, .pos = 16},
+  [16] = {.msk = 0x00020000U, .pos = 17},
+  [17] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief USART1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_USARTxEN[7] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief SPI1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SPIxEN[6] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SAI1 Peripheral Clocks Enable. */
+static const field32_t RCC_APB2ENR_SAIxEN[4] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief LPTIM2 Peripheral Clocks Enable. */
+static const field32_t RCC_APB4ENR_LPTIMxEN[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief LPTIM2 Peripheral Clocks Enable. */
+static const field32_t RCC_C1_APB4ENR_LPTIMxEN[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief DMA1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB1LPENR_DMAxLPEN[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief USB1OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_AHB1LPENR_USBxOTGLPEN[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief USB_PHY1 clock enable during CSleep mode. */
+static const field32_t RCC_AHB1LPENR_USBxULPILPEN[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief DMA1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB1LPENR_DMAxLPEN[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+};
+
+/** @brief USB1OTG peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_USBxOTGLPEN[3] = {
+  [1] = {.msk = 0x02000000U, .pos = 25},
+  [2] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief USB_PHY1 clock enable during CSleep mode. */
+static const field32_t RCC_C1_AHB1LPENR_USBxULPILPEN[3] = {
+  [1] = {.msk = 0x04000000U, .pos = 26},
+  [2] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief SRAM1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_C1_AHB2LPENR_SRAMxLPEN[4] = {
+  [1] = {.msk = 0x20000000U, .pos = 29},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+  [3] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief SRAM1 Clock Enable During CSleep Mode. */
+static const field32_t RCC_AHB2LPENR_SRAMxLPEN[4] = {
+  [1] = {.msk = 0x20000000U, .pos = 29},
+  [2] = {.msk = 0x40000000U, .pos = 30},
+  [3] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief TIM2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB1LLPENR_TIMxLPEN[15] = {
+  [2]  = {.msk = 0x00000001U, .pos = 0},
+  [3]  = {.msk = 0x00000002U, .pos = 1},
+  [4]  = {.msk = 0x00000004U, .pos = 2},
+  [5]  = {.msk = 0x00000008U, .pos = 3},
+  [6]  = {.msk = 0x00000010U, .pos = 4},
+  [7]  = {.msk = 0x00000020U, .pos = 5},
+  [12] = {.msk = 0x00000040U, .pos = 6},
+  [13] = {.msk = 0x00000080U, .pos = 7},
+  [14] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief SPI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_SPIxLPEN[4] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief USART2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_USARTxLPEN[9] = {
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x40000000U, .pos = 30},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief UART4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_UARTxLPEN[6] = {
+  [4] = {.msk = 0x00080000U, .pos = 19},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief I2C1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB1LLPENR_I2CxLPEN[4] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief TIM2 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB1LLPENR_TIMxLPEN[15] = {
+  [2]  = {.msk = 0x00000001U, .pos = 0},
+  [3]  = {.msk = 0x00000002U, .pos = 1},
+  [4]  = {.msk = 0x00000004U, .pos = 2},
+  [5]  = {.msk = 0x00000008U, .pos = 3},
+  [6]  = {.msk = 0x00000010U, .pos = 4},
+  [7]  = {.msk = 0x00000020U, .pos = 5},
+  [12] = {.msk = 0x00000040U, .pos = 6},
+  [13] = {.msk = 0x00000080U, .pos = 7},
+  [14] = {.msk = 0x00000100U, .pos = 8},
+};
+
+/** @brief SPI2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_SPIxLPEN[4] = {
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief USART2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_USARTxLPEN[9] = {
+  [2] = {.msk = 0x00020000U, .pos = 17},
+  [3] = {.msk = 0x00040000U, .pos = 18},
+  [7] = {.msk = 0x40000000U, .pos = 30},
+  [8] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief UART4 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_UARTxLPEN[6] = {
+  [4] = {.msk = 0x00080000U, .pos = 19},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief I2C1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB1LLPENR_I2CxLPEN[4] = {
+  [1] = {.msk = 0x00200000U, .pos = 21},
+  [2] = {.msk = 0x00400000U, .pos = 22},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief TIM1 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_APB2LPENR_TIMxLPEN[18] = {
+  [1]  = {.msk = 0x00000001U, .pos = 0},
+  [8]  = {.msk = 0x00000002U, .pos = 1},
+  [15] = {.msk = 0x00010000U, .pos = 16},
+  [16] = {.msk = 0x00020000U, .pos = 17},
+  [17] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief USART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_USARTxLPEN[7] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief SPI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SPIxLPEN[6] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SAI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB2LPENR_SAIxLPEN[4] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief TIM1 peripheral clock enable during CSleep mode. */
+static const field32_t RCC_C1_APB2LPENR_TIMxLPEN[18] = {
+  [1]  = {.msk = 0x00000001U, .pos = 0},
+  [8]  = {.msk = 0x00000002U, .pos = 1},
+  [15] = {.msk = 0x00010000U, .pos = 16},
+  [16] = {.msk = 0x00020000U, .pos = 17},
+  [17] = {.msk = 0x00040000U, .pos = 18},
+};
+
+/** @brief USART1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_USARTxLPEN[7] = {
+  [1] = {.msk = 0x00000010U, .pos = 4},
+  [6] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief SPI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SPIxLPEN[6] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [4] = {.msk = 0x00002000U, .pos = 13},
+  [5] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief SAI1 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB2LPENR_SAIxLPEN[4] = {
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief LPTIM2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_C1_APB4LPENR_LPTIMxLPEN[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
+
+/** @brief LPTIM2 Peripheral Clocks Enable During CSleep Mode. */
+static const field32_t RCC_APB4LPENR_LPTIMxLPEN[6] = {
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+  [5] = {.msk = 0x00001000U, .pos = 12},
+};
@@ -0,0 +1,50 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/rng.h
+ * @authors UW SARP
+ * @brief Registers and fields of RNG.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RNG Definitions
+ **************************************************************************************************/
+
+/** @subsection RNG Register Definitions */
+
+static rw_reg32_t const RNG_CR = (rw_reg32_t)0x48021800U; /** @brief RNG control register. */
+static rw_reg32_t const RNG_SR = (rw_reg32_t)0x48021804U; /** @brief RNG status register. */
+static ro_reg32_t const RNG_DR = (ro_reg32_t)0x48021808U; /** @brief The RNG_DR register is a read-only register that delivers a 32-bit random value when read. The content of this register is valid when DRDY= 1, even if RNGEN=0. */
+
+/** @subsection RNG Register Field Definitions */
+
+static const field32_t RNG_CR_RNGEN = {.msk = 0x00000004U, .pos = 2}; /** @brief Random number generator enable. */
+static const field32_t RNG_CR_IE    = {.msk = 0x00000008U, .pos = 3}; /** @brief Interrupt enable. */
+static const field32_t RNG_CR_CED   = {.msk = 0x00000020U, .pos = 5}; /** @brief Clock error detection Note: The clock error detection can be used only when ck_rc48 or ck_pll1_q (ck_pll1_q = 48MHz) source is selected otherwise, CED bit must be equal to 1. The clock error detection cannot be enabled nor disabled on the fly when RNG peripheral is enabled, to enable or disable CED the RNG must be disabled. */
+static const field32_t RNG_SR_DRDY  = {.msk = 0x00000001U, .pos = 0}; /** @brief Data ready Note: If IE=1 in RNG_CR, an interrupt is generated when DRDY=1. It can rise when the peripheral is disabled. When the output buffer becomes empty (after reading RNG_DR), this bit returns to 0 until a new random value is generated. */
+static const field32_t RNG_SR_CECS  = {.msk = 0x00000002U, .pos = 1}; /** @brief Clock error current status Note: This bit is meaningless if CED (Clock error detection) bit in RNG_CR is equal to 1. */
+static const field32_t RNG_SR_SECS  = {.msk = 0x00000004U, .pos = 2}; /** @brief Seed error current status ** More than 64 consecutive bits at the same value (0 or 1) ** More than 32 consecutive alternances of 0 and 1 (0101010101...01). */
+static const field32_t RNG_SR_CEIS  = {.msk = 0x00000020U, .pos = 5}; /** @brief Clock error interrupt status This bit is set at the same time as CECS. It is cleared by writing it to 0. An interrupt is pending if IE = 1 in the RNG_CR register. Note: This bit is meaningless if CED (Clock error detection) bit in RNG_CR is equal to 1. */
+static const field32_t RNG_SR_SEIS  = {.msk = 0x00000040U, .pos = 6}; /** @brief Seed error interrupt status This bit is set at the same time as SECS. It is cleared by writing it to 0. ** More than 64 consecutive bits at the same value (0 or 1) ** More than 32 consecutive alternances of 0 and 1 (0101010101...01) An interrupt is pending if IE = 1 in the RNG_CR register. */
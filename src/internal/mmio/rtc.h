@@ -0,0 +1,294 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/rtc.h
+ * @authors UW SARP
+ * @brief Registers and fields of RTC.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section RTC Definitions
+ **************************************************************************************************/
+
+/** @subsection RTC Register Definitions */
+
+static rw_reg32_t const RTC_RTC_TR       = (rw_reg32_t)0x58004000U; /** @brief The RTC_TR is the calendar time shadow register. This register must be written in initialization mode only. Refer to Calendar initialization and configuration on page9 and Reading the calendar on page10.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_DR       = (rw_reg32_t)0x58004004U; /** @brief The RTC_DR is the calendar date shadow register. This register must be written in initialization mode only. Refer to Calendar initialization and configuration on page9 and Reading the calendar on page10.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_CR       = (rw_reg32_t)0x58004008U; /** @brief RTC control register. */
+static rw_reg32_t const RTC_RTC_ISR      = (rw_reg32_t)0x5800400CU; /** @brief This register is write protected (except for RTC_ISR[13:8] bits). The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_PRER     = (rw_reg32_t)0x58004010U; /** @brief This register must be written in initialization mode only. The initialization must be performed in two separate write accesses. Refer to Calendar initialization and configuration on page9.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_WUTR     = (rw_reg32_t)0x58004014U; /** @brief This register can be written only when WUTWF is set to 1 in RTC_ISR.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_ALRMAR   = (rw_reg32_t)0x5800401CU; /** @brief This register can be written only when ALRAWF is set to 1 in RTC_ISR, or in initialization mode.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_ALRMBR   = (rw_reg32_t)0x58004020U; /** @brief This register can be written only when ALRBWF is set to 1 in RTC_ISR, or in initialization mode.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_WPR      = (rw_reg32_t)0x58004024U; /** @brief RTC write protection register. */
+static ro_reg32_t const RTC_RTC_SSR      = (ro_reg32_t)0x58004028U; /** @brief RTC sub second register. */
+static rw_reg32_t const RTC_RTC_SHIFTR   = (rw_reg32_t)0x5800402CU; /** @brief This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static ro_reg32_t const RTC_RTC_TSTR     = (ro_reg32_t)0x58004030U; /** @brief The content of this register is valid only when TSF is set to 1 in RTC_ISR. It is cleared when TSF bit is reset. */
+static ro_reg32_t const RTC_RTC_TSDR     = (ro_reg32_t)0x58004034U; /** @brief The content of this register is valid only when TSF is set to 1 in RTC_ISR. It is cleared when TSF bit is reset. */
+static ro_reg32_t const RTC_RTC_TSSSR    = (ro_reg32_t)0x58004038U; /** @brief The content of this register is valid only when RTC_ISR/TSF is set. It is cleared when the RTC_ISR/TSF bit is reset. */
+static rw_reg32_t const RTC_RTC_CALR     = (rw_reg32_t)0x5800403CU; /** @brief This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_TAMPCR   = (rw_reg32_t)0x58004040U; /** @brief RTC tamper and alternate function configuration register. */
+static rw_reg32_t const RTC_RTC_ALRMASSR = (rw_reg32_t)0x58004044U; /** @brief This register can be written only when ALRAE is reset in RTC_CR register, or in initialization mode.This register is write protected. The write access procedure is described in RTC register write protection on page9. */
+static rw_reg32_t const RTC_RTC_ALRMBSSR = (rw_reg32_t)0x58004048U; /** @brief This register can be written only when ALRBE is reset in RTC_CR register, or in initialization mode.This register is write protected.The write access procedure is described in Section: RTC register write protection. */
+static rw_reg32_t const RTC_RTC_OR       = (rw_reg32_t)0x5800404CU; /** @brief RTC option register. */
+
+/** @subsection Enumerated RTC Register Definitions */
+
+/** @brief RTC backup registers. */
+static rw_reg32_t const RTC_RTC_BKPxR[32] = {
+  [0]  = (rw_reg32_t)0x58004050U,
+  [1]  = (rw_reg32_t)0x58004054U,
+  [2]  = (rw_reg32_t)0x58004058U,
+  [3]  = (rw_reg32_t)0x5800405CU,
+  [4]  = (rw_reg32_t)0x58004060U,
+  [5]  = (rw_reg32_t)0x58004064U,
+  [6]  = (rw_reg32_t)0x58004068U,
+  [7]  = (rw_reg32_t)0x5800406CU,
+  [8]  = (rw_reg32_t)0x58004070U,
+  [9]  = (rw_reg32_t)0x58004074U,
+  [10] = (rw_reg32_t)0x58004078U,
+  [11] = (rw_reg32_t)0x5800407CU,
+  [12] = (rw_reg32_t)0x58004080U,
+  [13] = (rw_reg32_t)0x58004084U,
+  [14] = (rw_reg32_t)0x58004088U,
+  [15] = (rw_reg32_t)0x5800408CU,
+  [16] = (rw_reg32_t)0x58004090U,
+  [17] = (rw_reg32_t)0x58004094U,
+  [18] = (rw_reg32_t)0x58004098U,
+  [19] = (rw_reg32_t)0x5800409CU,
+  [20] = (rw_reg32_t)0x580040A0U,
+  [21] = (rw_reg32_t)0x580040A4U,
+  [22] = (rw_reg32_t)0x580040A8U,
+  [23] = (rw_reg32_t)0x580040ACU,
+  [24] = (rw_reg32_t)0x580040B0U,
+  [25] = (rw_reg32_t)0x580040B4U,
+  [26] = (rw_reg32_t)0x580040B8U,
+  [27] = (rw_reg32_t)0x580040BCU,
+  [28] = (rw_reg32_t)0x580040C0U,
+  [29] = (rw_reg32_t)0x580040C4U,
+  [30] = (rw_reg32_t)0x580040C8U,
+  [31] = (rw_reg32_t)0x580040CCU,
+};
+
+/** @subsection RTC Register Field Definitions */
+
+static const field32_t RTC_RTC_TR_SU               = {.msk = 0x0000000FU, .pos = 0};  /** @brief Second units in BCD format. */
+static const field32_t RTC_RTC_TR_ST               = {.msk = 0x00000070U, .pos = 4};  /** @brief Second tens in BCD format. */
+static const field32_t RTC_RTC_TR_MNU              = {.msk = 0x00000F00U, .pos = 8};  /** @brief Minute units in BCD format. */
+static const field32_t RTC_RTC_TR_MNT              = {.msk = 0x00007000U, .pos = 12}; /** @brief Minute tens in BCD format. */
+static const field32_t RTC_RTC_TR_HU               = {.msk = 0x000F0000U, .pos = 16}; /** @brief Hour units in BCD format. */
+static const field32_t RTC_RTC_TR_HT               = {.msk = 0x00300000U, .pos = 20}; /** @brief Hour tens in BCD format. */
+static const field32_t RTC_RTC_TR_PM               = {.msk = 0x00400000U, .pos = 22}; /** @brief AM/PM notation. */
+static const field32_t RTC_RTC_DR_DU               = {.msk = 0x0000000FU, .pos = 0};  /** @brief Date units in BCD format. */
+static const field32_t RTC_RTC_DR_DT               = {.msk = 0x00000030U, .pos = 4};  /** @brief Date tens in BCD format. */
+static const field32_t RTC_RTC_DR_MU               = {.msk = 0x00000F00U, .pos = 8};  /** @brief Month units in BCD format. */
+static const field32_t RTC_RTC_DR_MT               = {.msk = 0x00001000U, .pos = 12}; /** @brief Month tens in BCD format. */
+static const field32_t RTC_RTC_DR_WDU              = {.msk = 0x0000E000U, .pos = 13}; /** @brief Week day units. */
+static const field32_t RTC_RTC_DR_YU               = {.msk = 0x000F0000U, .pos = 16}; /** @brief Year units in BCD format. */
+static const field32_t RTC_RTC_DR_YT               = {.msk = 0x00F00000U, .pos = 20}; /** @brief Year tens in BCD format. */
+static const field32_t RTC_RTC_CR_WUCKSEL          = {.msk = 0x00000007U, .pos = 0};  /** @brief Wakeup clock selection. */
+static const field32_t RTC_RTC_CR_TSEDGE           = {.msk = 0x00000008U, .pos = 3};  /** @brief Time-stamp event active edge TSE must be reset when TSEDGE is changed to avoid unwanted TSF setting. */
+static const field32_t RTC_RTC_CR_REFCKON          = {.msk = 0x00000010U, .pos = 4};  /** @brief RTC_REFIN reference clock detection enable (50 or 60Hz) Note: PREDIV_S must be 0x00FF. */
+static const field32_t RTC_RTC_CR_BYPSHAD          = {.msk = 0x00000020U, .pos = 5};  /** @brief Bypass the shadow registers Note: If the frequency of the APB clock is less than seven times the frequency of RTCCLK, BYPSHAD must be set to 1. */
+static const field32_t RTC_RTC_CR_FMT              = {.msk = 0x00000040U, .pos = 6};  /** @brief Hour format. */
+static const field32_t RTC_RTC_CR_ALRAE            = {.msk = 0x00000100U, .pos = 8};  /** @brief Alarm A enable. */
+static const field32_t RTC_RTC_CR_ALRBE            = {.msk = 0x00000200U, .pos = 9};  /** @brief Alarm B enable. */
+static const field32_t RTC_RTC_CR_WUTE             = {.msk = 0x00000400U, .pos = 10}; /** @brief Wakeup timer enable. */
+static const field32_t RTC_RTC_CR_TSE              = {.msk = 0x00000800U, .pos = 11}; /** @brief Timestamp enable. */
+static const field32_t RTC_RTC_CR_ALRAIE           = {.msk = 0x00001000U, .pos = 12}; /** @brief Alarm A interrupt enable. */
+static const field32_t RTC_RTC_CR_ALRBIE           = {.msk = 0x00002000U, .pos = 13}; /** @brief Alarm B interrupt enable. */
+static const field32_t RTC_RTC_CR_WUTIE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Wakeup timer interrupt enable. */
+static const field32_t RTC_RTC_CR_TSIE             = {.msk = 0x00008000U, .pos = 15}; /** @brief Time-stamp interrupt enable. */
+static const field32_t RTC_RTC_CR_ADD1H            = {.msk = 0x00010000U, .pos = 16}; /** @brief Add 1 hour (summer time change) When this bit is set outside initialization mode, 1 hour is added to the calendar time. This bit is always read as 0. */
+static const field32_t RTC_RTC_CR_SUB1H            = {.msk = 0x00020000U, .pos = 17}; /** @brief Subtract 1 hour (winter time change) When this bit is set outside initialization mode, 1 hour is subtracted to the calendar time if the current hour is not 0. This bit is always read as 0. Setting this bit has no effect when current hour is 0. */
+static const field32_t RTC_RTC_CR_BKP              = {.msk = 0x00040000U, .pos = 18}; /** @brief Backup This bit can be written by the user to memorize whether the daylight saving time change has been performed or not. */
+static const field32_t RTC_RTC_CR_COSEL            = {.msk = 0x00080000U, .pos = 19}; /** @brief Calibration output selection When COE=1, this bit selects which signal is output on RTC_CALIB. These frequencies are valid for RTCCLK at 32.768 kHz and prescalers at their default values (PREDIV_A=127 and PREDIV_S=255). Refer to Section24.3.15: Calibration clock output. */
+static const field32_t RTC_RTC_CR_POL              = {.msk = 0x00100000U, .pos = 20}; /** @brief Output polarity This bit is used to configure the polarity of RTC_ALARM output. */
+static const field32_t RTC_RTC_CR_OSEL             = {.msk = 0x00600000U, .pos = 21}; /** @brief Output selection These bits are used to select the flag to be routed to RTC_ALARM output. */
+static const field32_t RTC_RTC_CR_COE              = {.msk = 0x00800000U, .pos = 23}; /** @brief Calibration output enable This bit enables the RTC_CALIB output. */
+static const field32_t RTC_RTC_CR_ITSE             = {.msk = 0x01000000U, .pos = 24}; /** @brief Timestamp on internal event enable. */
+static const field32_t RTC_RTC_ISR_ALRAWF          = {.msk = 0x00000001U, .pos = 0};  /** @brief Alarm A write flag This bit is set by hardware when Alarm A values can be changed, after the ALRAE bit has been set to 0 in RTC_CR. It is cleared by hardware in initialization mode. */
+static const field32_t RTC_RTC_ISR_ALRBWF          = {.msk = 0x00000002U, .pos = 1};  /** @brief Alarm B write flag This bit is set by hardware when Alarm B values can be changed, after the ALRBE bit has been set to 0 in RTC_CR. It is cleared by hardware in initialization mode. */
+static const field32_t RTC_RTC_ISR_WUTWF           = {.msk = 0x00000004U, .pos = 2};  /** @brief Wakeup timer write flag This bit is set by hardware up to 2 RTCCLK cycles after the WUTE bit has been set to 0 in RTC_CR, and is cleared up to 2 RTCCLK cycles after the WUTE bit has been set to 1. The wakeup timer values can be changed when WUTE bit is cleared and WUTWF is set. */
+static const field32_t RTC_RTC_ISR_SHPF            = {.msk = 0x00000008U, .pos = 3};  /** @brief Shift operation pending This flag is set by hardware as soon as a shift operation is initiated by a write to the RTC_SHIFTR register. It is cleared by hardware when the corresponding shift operation has been executed. Writing to the SHPF bit has no effect. */
+static const field32_t RTC_RTC_ISR_INITS           = {.msk = 0x00000010U, .pos = 4};  /** @brief Initialization status flag This bit is set by hardware when the calendar year field is different from 0 (Backup domain reset state). */
+static const field32_t RTC_RTC_ISR_RSF             = {.msk = 0x00000020U, .pos = 5};  /** @brief Registers synchronization flag This bit is set by hardware each time the calendar registers are copied into the shadow registers (RTC_SSRx, RTC_TRx and RTC_DRx). This bit is cleared by hardware in initialization mode, while a shift operation is pending (SHPF=1), or when in bypass shadow register mode (BYPSHAD=1). This bit can also be cleared by software. It is cleared either by software or by hardware in initialization mode. */
+static const field32_t RTC_RTC_ISR_INITF           = {.msk = 0x00000040U, .pos = 6};  /** @brief Initialization flag When this bit is set to 1, the RTC is in initialization state, and the time, date and prescaler registers can be updated. */
+static const field32_t RTC_RTC_ISR_INIT            = {.msk = 0x00000080U, .pos = 7};  /** @brief Initialization mode. */
+static const field32_t RTC_RTC_ISR_ALRAF           = {.msk = 0x00000100U, .pos = 8};  /** @brief Alarm A flag This flag is set by hardware when the time/date registers (RTC_TR and RTC_DR) match the Alarm A register (RTC_ALRMAR). This flag is cleared by software by writing 0. */
+static const field32_t RTC_RTC_ISR_ALRBF           = {.msk = 0x00000200U, .pos = 9};  /** @brief Alarm B flag This flag is set by hardware when the time/date registers (RTC_TR and RTC_DR) match the Alarm B register (RTC_ALRMBR). This flag is cleared by software by writing 0. */
+static const field32_t RTC_RTC_ISR_WUTF            = {.msk = 0x00000400U, .pos = 10}; /** @brief Wakeup timer flag This flag is set by hardware when the wakeup auto-reload counter reaches 0. This flag is cleared by software by writing 0. This flag must be cleared by software at least 1.5 RTCCLK periods before WUTF is set to 1 again. */
+static const field32_t RTC_RTC_ISR_TSF             = {.msk = 0x00000800U, .pos = 11}; /** @brief Time-stamp flag This flag is set by hardware when a time-stamp event occurs. This flag is cleared by software by writing 0. */
+static const field32_t RTC_RTC_ISR_TSOVF           = {.msk = 0x00001000U, .pos = 12}; /** @brief Time-stamp overflow flag This flag is set by hardware when a time-stamp event occurs while TSF is already set. This flag is cleared by software by writing 0. It is recommended to check and then clear TSOVF only after clearing the TSF bit. Otherwise, an overflow might not be noticed if a time-stamp event occurs immediately before the TSF bit is cleared. */
+static const field32_t RTC_RTC_ISR_TAMP1F          = {.msk = 0x00002000U, .pos = 13}; /** @brief RTC_TAMP1 detection flag This flag is set by hardware when a tamper detection event is detected on the RTC_TAMP1 input. It is cleared by software writing 0. */
+static const field32_t RTC_RTC_ISR_TAMP2F          = {.msk = 0x00004000U, .pos = 14}; /** @brief RTC_TAMP2 detection flag This flag is set by hardware when a tamper detection event is detected on the RTC_TAMP2 input. It is cleared by software writing 0. */
+static const field32_t RTC_RTC_ISR_TAMP3F          = {.msk = 0x00008000U, .pos = 15}; /** @brief RTC_TAMP3 detection flag This flag is set by hardware when a tamper detection event is detected on the RTC_TAMP3 input. It is cleared by software writing 0. */
+static const field32_t RTC_RTC_ISR_RECALPF         = {.msk = 0x00010000U, .pos = 16}; /** @brief Recalibration pending Flag The RECALPF status flag is automatically set to 1 when software writes to the RTC_CALR register, indicating that the RTC_CALR register is blocked. When the new calibration settings are taken into account, this bit returns to 0. Refer to Re-calibration on-the-fly. */
+static const field32_t RTC_RTC_ISR_ITSF            = {.msk = 0x00020000U, .pos = 17}; /** @brief Internal tTime-stamp flag. */
+static const field32_t RTC_RTC_PRER_PREDIV_S       = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Synchronous prescaler factor This is the synchronous division factor: ck_spre frequency = ck_apre frequency/(PREDIV_S+1). */
+static const field32_t RTC_RTC_PRER_PREDIV_A       = {.msk = 0x007F0000U, .pos = 16}; /** @brief Asynchronous prescaler factor This is the asynchronous division factor: ck_apre frequency = RTCCLK frequency/(PREDIV_A+1). */
+static const field32_t RTC_RTC_WUTR_WUT            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Wakeup auto-reload value bits When the wakeup timer is enabled (WUTE set to 1), the WUTF flag is set every (WUT[15:0] + 1) ck_wut cycles. The ck_wut period is selected through WUCKSEL[2:0] bits of the RTC_CR register When WUCKSEL[2] = 1, the wakeup timer becomes 17-bits and WUCKSEL[1] effectively becomes WUT[16] the most-significant bit to be reloaded into the timer. The first assertion of WUTF occurs (WUT+1) ck_wut cycles after WUTE is set. Setting WUT[15:0] to 0x0000 with WUCKSEL[2:0] =011 (RTCCLK/2) is forbidden. */
+static const field32_t RTC_RTC_ALRMAR_SU           = {.msk = 0x0000000FU, .pos = 0};  /** @brief Second units in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_ST           = {.msk = 0x00000070U, .pos = 4};  /** @brief Second tens in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_MSK1         = {.msk = 0x00000080U, .pos = 7};  /** @brief Alarm A seconds mask. */
+static const field32_t RTC_RTC_ALRMAR_MNU          = {.msk = 0x00000F00U, .pos = 8};  /** @brief Minute units in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_MNT          = {.msk = 0x00007000U, .pos = 12}; /** @brief Minute tens in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_MSK2         = {.msk = 0x00008000U, .pos = 15}; /** @brief Alarm A minutes mask. */
+static const field32_t RTC_RTC_ALRMAR_HU           = {.msk = 0x000F0000U, .pos = 16}; /** @brief Hour units in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_HT           = {.msk = 0x00300000U, .pos = 20}; /** @brief Hour tens in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_PM           = {.msk = 0x00400000U, .pos = 22}; /** @brief AM/PM notation. */
+static const field32_t RTC_RTC_ALRMAR_MSK3         = {.msk = 0x00800000U, .pos = 23}; /** @brief Alarm A hours mask. */
+static const field32_t RTC_RTC_ALRMAR_DU           = {.msk = 0x0F000000U, .pos = 24}; /** @brief Date units or day in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_DT           = {.msk = 0x30000000U, .pos = 28}; /** @brief Date tens in BCD format. */
+static const field32_t RTC_RTC_ALRMAR_WDSEL        = {.msk = 0x40000000U, .pos = 30}; /** @brief Week day selection. */
+static const field32_t RTC_RTC_ALRMAR_MSK4         = {.msk = 0x80000000U, .pos = 31}; /** @brief Alarm A date mask. */
+static const field32_t RTC_RTC_ALRMBR_SU           = {.msk = 0x0000000FU, .pos = 0};  /** @brief Second units in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_ST           = {.msk = 0x00000070U, .pos = 4};  /** @brief Second tens in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_MSK1         = {.msk = 0x00000080U, .pos = 7};  /** @brief Alarm B seconds mask. */
+static const field32_t RTC_RTC_ALRMBR_MNU          = {.msk = 0x00000F00U, .pos = 8};  /** @brief Minute units in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_MNT          = {.msk = 0x00007000U, .pos = 12}; /** @brief Minute tens in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_MSK2         = {.msk = 0x00008000U, .pos = 15}; /** @brief Alarm B minutes mask. */
+static const field32_t RTC_RTC_ALRMBR_HU           = {.msk = 0x000F0000U, .pos = 16}; /** @brief Hour units in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_HT           = {.msk = 0x00300000U, .pos = 20}; /** @brief Hour tens in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_PM           = {.msk = 0x00400000U, .pos = 22}; /** @brief AM/PM notation. */
+static const field32_t RTC_RTC_ALRMBR_MSK3         = {.msk = 0x00800000U, .pos = 23}; /** @brief Alarm B hours mask. */
+static const field32_t RTC_RTC_ALRMBR_DU           = {.msk = 0x0F000000U, .pos = 24}; /** @brief Date units or day in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_DT           = {.msk = 0x30000000U, .pos = 28}; /** @brief Date tens in BCD format. */
+static const field32_t RTC_RTC_ALRMBR_WDSEL        = {.msk = 0x40000000U, .pos = 30}; /** @brief Week day selection. */
+static const field32_t RTC_RTC_ALRMBR_MSK4         = {.msk = 0x80000000U, .pos = 31}; /** @brief Alarm B date mask. */
+static const field32_t RTC_RTC_WPR_KEY             = {.msk = 0x000000FFU, .pos = 0};  /** @brief Write protection key This byte is written by software. Reading this byte always returns 0x00. Refer to RTC register write protection for a description of how to unlock RTC register write protection. */
+static const field32_t RTC_RTC_SSR_SS              = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Sub second value SS[15:0] is the value in the synchronous prescaler counter. The fraction of a second is given by the formula below: Second fraction = (PREDIV_S - SS) / (PREDIV_S + 1) Note: SS can be larger than PREDIV_S only after a shift operation. In that case, the correct time/date is one second less than as indicated by RTC_TR/RTC_DR. */
+static const field32_t RTC_RTC_SHIFTR_SUBFS        = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Subtract a fraction of a second These bits are write only and is always read as zero. Writing to this bit has no effect when a shift operation is pending (when SHPF=1, in RTC_ISR). The value which is written to SUBFS is added to the synchronous prescaler counter. Since this counter counts down, this operation effectively subtracts from (delays) the clock by: Delay (seconds) = SUBFS / (PREDIV_S + 1) A fraction of a second can effectively be added to the clock (advancing the clock) when the ADD1S function is used in conjunction with SUBFS, effectively advancing the clock by: Advance (seconds) = (1 - (SUBFS / (PREDIV_S + 1))). Note: Writing to SUBFS causes RSF to be cleared. Software can then wait until RSF=1 to be sure that the shadow registers have been updated with the shifted time. */
+static const field32_t RTC_RTC_SHIFTR_ADD1S        = {.msk = 0x80000000U, .pos = 31}; /** @brief Add one second This bit is write only and is always read as zero. Writing to this bit has no effect when a shift operation is pending (when SHPF=1, in RTC_ISR). This function is intended to be used with SUBFS (see description below) in order to effectively add a fraction of a second to the clock in an atomic operation. */
+static const field32_t RTC_RTC_TSTR_SU             = {.msk = 0x0000000FU, .pos = 0};  /** @brief Second units in BCD format. */
+static const field32_t RTC_RTC_TSTR_ST             = {.msk = 0x00000070U, .pos = 4};  /** @brief Second tens in BCD format. */
+static const field32_t RTC_RTC_TSTR_MNU            = {.msk = 0x00000F00U, .pos = 8};  /** @brief Minute units in BCD format. */
+static const field32_t RTC_RTC_TSTR_MNT            = {.msk = 0x00007000U, .pos = 12}; /** @brief Minute tens in BCD format. */
+static const field32_t RTC_RTC_TSTR_HU             = {.msk = 0x000F0000U, .pos = 16}; /** @brief Hour units in BCD format. */
+static const field32_t RTC_RTC_TSTR_HT             = {.msk = 0x00300000U, .pos = 20}; /** @brief Hour tens in BCD format. */
+static const field32_t RTC_RTC_TSTR_PM             = {.msk = 0x00400000U, .pos = 22}; /** @brief AM/PM notation. */
+static const field32_t RTC_RTC_TSDR_DU             = {.msk = 0x0000000FU, .pos = 0};  /** @brief Date units in BCD format. */
+static const field32_t RTC_RTC_TSDR_DT             = {.msk = 0x00000030U, .pos = 4};  /** @brief Date tens in BCD format. */
+static const field32_t RTC_RTC_TSDR_MU             = {.msk = 0x00000F00U, .pos = 8};  /** @brief Month units in BCD format. */
+static const field32_t RTC_RTC_TSDR_MT             = {.msk = 0x00001000U, .pos = 12}; /** @brief Month tens in BCD format. */
+static const field32_t RTC_RTC_TSDR_WDU            = {.msk = 0x0000E000U, .pos = 13}; /** @brief Week day units. */
+static const field32_t RTC_RTC_TSSSR_SS            = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Sub second value SS[15:0] is the value of the synchronous prescaler counter when the timestamp event occurred. */
+static const field32_t RTC_RTC_CALR_CALM           = {.msk = 0x000001FFU, .pos = 0};  /** @brief Calibration minus The frequency of the calendar is reduced by masking CALM out of 220 RTCCLK pulses (32 seconds if the input frequency is 32768 Hz). This decreases the frequency of the calendar with a resolution of 0.9537 ppm. To increase the frequency of the calendar, this feature should be used in conjunction with CALP. See Section24.3.12: RTC smooth digital calibration on page13. */
+static const field32_t RTC_RTC_CALR_CALW16         = {.msk = 0x00002000U, .pos = 13}; /** @brief Use a 16-second calibration cycle period When CALW16 is set to 1, the 16-second calibration cycle period is selected.This bit must not be set to 1 if CALW8=1. Note: CALM[0] is stuck at 0 when CALW16= 1. Refer to Section24.3.12: RTC smooth digital calibration. */
+static const field32_t RTC_RTC_CALR_CALW8          = {.msk = 0x00004000U, .pos = 14}; /** @brief Use an 8-second calibration cycle period When CALW8 is set to 1, the 8-second calibration cycle period is selected. Note: CALM[1:0] are stuck at 00; when CALW8= 1. Refer to Section24.3.12: RTC smooth digital calibration. */
+static const field32_t RTC_RTC_CALR_CALP           = {.msk = 0x00008000U, .pos = 15}; /** @brief Increase frequency of RTC by 488.5 ppm This feature is intended to be used in conjunction with CALM, which lowers the frequency of the calendar with a fine resolution. if the input frequency is 32768 Hz, the number of RTCCLK pulses added during a 32-second window is calculated as follows: (512 * CALP) - CALM. Refer to Section24.3.12: RTC smooth digital calibration. */
+static const field32_t RTC_RTC_TAMPCR_TAMP1E       = {.msk = 0x00000001U, .pos = 0};  /** @brief RTC_TAMP1 input detection enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP1TRG     = {.msk = 0x00000002U, .pos = 1};  /** @brief Active level for RTC_TAMP1 input If TAMPFLT != 00 if TAMPFLT = 00:. */
+static const field32_t RTC_RTC_TAMPCR_TAMPIE       = {.msk = 0x00000004U, .pos = 2};  /** @brief Tamper interrupt enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP2E       = {.msk = 0x00000008U, .pos = 3};  /** @brief RTC_TAMP2 input detection enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP2TRG     = {.msk = 0x00000010U, .pos = 4};  /** @brief Active level for RTC_TAMP2 input if TAMPFLT != 00: if TAMPFLT = 00:. */
+static const field32_t RTC_RTC_TAMPCR_TAMP3E       = {.msk = 0x00000020U, .pos = 5};  /** @brief RTC_TAMP3 detection enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP3TRG     = {.msk = 0x00000040U, .pos = 6};  /** @brief Active level for RTC_TAMP3 input if TAMPFLT != 00: if TAMPFLT = 00:. */
+static const field32_t RTC_RTC_TAMPCR_TAMPTS       = {.msk = 0x00000080U, .pos = 7};  /** @brief Activate timestamp on tamper detection event TAMPTS is valid even if TSE=0 in the RTC_CR register. */
+static const field32_t RTC_RTC_TAMPCR_TAMPFREQ     = {.msk = 0x00000700U, .pos = 8};  /** @brief Tamper sampling frequency Determines the frequency at which each of the RTC_TAMPx inputs are sampled. */
+static const field32_t RTC_RTC_TAMPCR_TAMPFLT      = {.msk = 0x00001800U, .pos = 11}; /** @brief RTC_TAMPx filter count These bits determines the number of consecutive samples at the specified level (TAMP*TRG) needed to activate a Tamper event. TAMPFLT is valid for each of the RTC_TAMPx inputs. */
+static const field32_t RTC_RTC_TAMPCR_TAMPPRCH     = {.msk = 0x00006000U, .pos = 13}; /** @brief RTC_TAMPx precharge duration These bit determines the duration of time during which the pull-up/is activated before each sample. TAMPPRCH is valid for each of the RTC_TAMPx inputs. */
+static const field32_t RTC_RTC_TAMPCR_TAMPPUDIS    = {.msk = 0x00008000U, .pos = 15}; /** @brief RTC_TAMPx pull-up disable This bit determines if each of the RTC_TAMPx pins are pre-charged before each sample. */
+static const field32_t RTC_RTC_TAMPCR_TAMP1IE      = {.msk = 0x00010000U, .pos = 16}; /** @brief Tamper 1 interrupt enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP1NOERASE = {.msk = 0x00020000U, .pos = 17}; /** @brief Tamper 1 no erase. */
+static const field32_t RTC_RTC_TAMPCR_TAMP1MF      = {.msk = 0x00040000U, .pos = 18}; /** @brief Tamper 1 mask flag. */
+static const field32_t RTC_RTC_TAMPCR_TAMP2IE      = {.msk = 0x00080000U, .pos = 19}; /** @brief Tamper 2 interrupt enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP2NOERASE = {.msk = 0x00100000U, .pos = 20}; /** @brief Tamper 2 no erase. */
+static const field32_t RTC_RTC_TAMPCR_TAMP2MF      = {.msk = 0x00200000U, .pos = 21}; /** @brief Tamper 2 mask flag. */
+static const field32_t RTC_RTC_TAMPCR_TAMP3IE      = {.msk = 0x00400000U, .pos = 22}; /** @brief Tamper 3 interrupt enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMP3NOERASE = {.msk = 0x00800000U, .pos = 23}; /** @brief Tamper 3 no erase. */
+static const field32_t RTC_RTC_TAMPCR_TAMP3MF      = {.msk = 0x01000000U, .pos = 24}; /** @brief Tamper 3 mask flag. */
+static const field32_t RTC_RTC_ALRMASSR_SS         = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Sub seconds value This value is compared with the contents of the synchronous prescaler counter to determine if Alarm A is to be activated. Only bits 0 up MASKSS-1 are compared. */
+static const field32_t RTC_RTC_ALRMASSR_MASKSS     = {.msk = 0x0F000000U, .pos = 24}; /** @brief Mask the most-significant bits starting at this bit ... The overflow bits of the synchronous counter (bits 15) is never compared. This bit can be different from 0 only after a shift operation. */
+static const field32_t RTC_RTC_ALRMBSSR_SS         = {.msk = 0x00007FFFU, .pos = 0};  /** @brief Sub seconds value This value is compared with the contents of the synchronous prescaler counter to determine if Alarm B is to be activated. Only bits 0 up to MASKSS-1 are compared. */
+static const field32_t RTC_RTC_ALRMBSSR_MASKSS     = {.msk = 0x0F000000U, .pos = 24}; /** @brief Mask the most-significant bits starting at this bit ... The overflow bits of the synchronous counter (bits 15) is never compared. This bit can be different from 0 only after a shift operation. */
+static const field32_t RTC_RTC_OR_RTC_ALARM_TYPE   = {.msk = 0x00000001U, .pos = 0};  /** @brief RTC_ALARM output type on PC13. */
+static const field32_t RTC_RTC_OR_RTC_OUT_RMP      = {.msk = 0x00000002U, .pos = 1};  /** @brief RTC_OUT remap. */
+
+/** @subsection Enumerated RTC Register Field Definitions */
+
+/** @brief RTC_TAMP1 detection flag This flag is set by hardware when a tamper detection event is detected on the RTC_TAMP1 input. It is cleared by software writing 0. */
+static const field32_t RTC_RTC_ISR_TAMPxF[4] = {
+  [1] = {.msk = 0x00002000U, .pos = 13},
+  [2] = {.msk = 0x00004000U, .pos = 14},
+  [3] = {.msk = 0x00008000U, .pos = 15},
+};
+
+/** @brief Alarm A seconds mask. */
+static const field32_t RTC_RTC_ALRMAR_MSKx[5] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+  [4] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Alarm B seconds mask. */
+static const field32_t RTC_RTC_ALRMBR_MSKx[5] = {
+  [1] = {.msk = 0x00000080U, .pos = 7},
+  [2] = {.msk = 0x00008000U, .pos = 15},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+  [4] = {.msk = 0x80000000U, .pos = 31},
+};
+
+/** @brief Use an 8-second calibration cycle period When CALW8 is set to 1, the 8-second calibration cycle period is selected. Note: CALM[1:0] are stuck at 00; when CALW8= 1. Refer to Section24.3.12: RTC smooth digital calibration. */
+static const field32_t RTC_RTC_CALR_CALWx[17] = {
+  [8]  = {.msk = 0x00004000U, .pos = 14},
+  [16] = {.msk = 0x00002000U, .pos = 13},
+};
+
+/** @brief RTC_TAMP1 input detection enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMPxE[4] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000008U, .pos = 3},
+  [3] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Active level for RTC_TAMP1 input If TAMPFLT != 00 if TAMPFLT = 00:. */
+static const field32_t RTC_RTC_TAMPCR_TAMPxTRG[4] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+  [3] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief Tamper 1 interrupt enable. */
+static const field32_t RTC_RTC_TAMPCR_TAMPxIE[4] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x00080000U, .pos = 19},
+  [3] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/** @brief Tamper 1 no erase. */
+static const field32_t RTC_RTC_TAMPCR_TAMPxNOERASE[4] = {
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00100000U, .pos = 20},
+  [3] = {.msk = 0x00800000U, .pos = 23},
+};
+
+/** @brief Tamper 1 mask flag. */
+static const field32_t RTC_RTC_TAMPCR_TAMPxMF[4] = {
+  [1] = {.msk = 0x00040000U, .pos = 18},
+  [2] = {.msk = 0x00200000U, .pos = 21},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+};
@@ -0,0 +1,334 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/saix.h
+ * @authors UW SARP
+ * @brief Registers and fields of SAI1, SAI2, SAI3, SAI4.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SAIx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated SAIx Register Definitions */
+
+/** @brief Global configuration register. */
+static rw_reg32_t const SAIx_SAI_GCR[5] = {
+  [1] = (rw_reg32_t)0x40015800U,
+  [2] = (rw_reg32_t)0x40015C00U,
+  [3] = (rw_reg32_t)0x40016000U,
+  [4] = (rw_reg32_t)0x58005400U,
+};
+
+/** @brief Configuration register 1. */
+static rw_reg32_t const SAIx_SAI_ACR1[5] = {
+  [1] = (rw_reg32_t)0x40015804U,
+  [2] = (rw_reg32_t)0x40015C04U,
+  [3] = (rw_reg32_t)0x40016004U,
+  [4] = (rw_reg32_t)0x58005404U,
+};
+
+/** @brief Configuration register 2. */
+static rw_reg32_t const SAIx_SAI_ACR2[5] = {
+  [1] = (rw_reg32_t)0x40015808U,
+  [2] = (rw_reg32_t)0x40015C08U,
+  [3] = (rw_reg32_t)0x40016008U,
+  [4] = (rw_reg32_t)0x58005408U,
+};
+
+/** @brief This register has no meaning in AC97 and SPDIF audio protocol. */
+static rw_reg32_t const SAIx_SAI_AFRCR[5] = {
+  [1] = (rw_reg32_t)0x4001580CU,
+  [2] = (rw_reg32_t)0x40015C0CU,
+  [3] = (rw_reg32_t)0x4001600CU,
+  [4] = (rw_reg32_t)0x5800540CU,
+};
+
+/** @brief This register has no meaning in AC97 and SPDIF audio protocol. */
+static rw_reg32_t const SAIx_SAI_ASLOTR[5] = {
+  [1] = (rw_reg32_t)0x40015810U,
+  [2] = (rw_reg32_t)0x40015C10U,
+  [3] = (rw_reg32_t)0x40016010U,
+  [4] = (rw_reg32_t)0x58005410U,
+};
+
+/** @brief Interrupt mask register 2. */
+static rw_reg32_t const SAIx_SAI_AIM[5] = {
+  [1] = (rw_reg32_t)0x40015814U,
+  [2] = (rw_reg32_t)0x40015C14U,
+  [3] = (rw_reg32_t)0x40016014U,
+  [4] = (rw_reg32_t)0x58005414U,
+};
+
+/** @brief Status register. */
+static ro_reg32_t const SAIx_SAI_ASR[5] = {
+  [1] = (ro_reg32_t)0x40015818U,
+  [2] = (ro_reg32_t)0x40015C18U,
+  [3] = (ro_reg32_t)0x40016018U,
+  [4] = (ro_reg32_t)0x58005418U,
+};
+
+/** @brief Clear flag register. */
+static rw_reg32_t const SAIx_SAI_ACLRFR[5] = {
+  [1] = (rw_reg32_t)0x4001581CU,
+  [2] = (rw_reg32_t)0x40015C1CU,
+  [3] = (rw_reg32_t)0x4001601CU,
+  [4] = (rw_reg32_t)0x5800541CU,
+};
+
+/** @brief Data register. */
+static rw_reg32_t const SAIx_SAI_ADR[5] = {
+  [1] = (rw_reg32_t)0x40015820U,
+  [2] = (rw_reg32_t)0x40015C20U,
+  [3] = (rw_reg32_t)0x40016020U,
+  [4] = (rw_reg32_t)0x58005420U,
+};
+
+/** @brief Configuration register 1. */
+static rw_reg32_t const SAIx_SAI_BCR1[5] = {
+  [1] = (rw_reg32_t)0x40015824U,
+  [2] = (rw_reg32_t)0x40015C24U,
+  [3] = (rw_reg32_t)0x40016024U,
+  [4] = (rw_reg32_t)0x58005424U,
+};
+
+/** @brief Configuration register 2. */
+static rw_reg32_t const SAIx_SAI_BCR2[5] = {
+  [1] = (rw_reg32_t)0x40015828U,
+  [2] = (rw_reg32_t)0x40015C28U,
+  [3] = (rw_reg32_t)0x40016028U,
+  [4] = (rw_reg32_t)0x58005428U,
+};
+
+/** @brief This register has no meaning in AC97 and SPDIF audio protocol. */
+static rw_reg32_t const SAIx_SAI_BFRCR[5] = {
+  [1] = (rw_reg32_t)0x4001582CU,
+  [2] = (rw_reg32_t)0x40015C2CU,
+  [3] = (rw_reg32_t)0x4001602CU,
+  [4] = (rw_reg32_t)0x5800542CU,
+};
+
+/** @brief This register has no meaning in AC97 and SPDIF audio protocol. */
+static rw_reg32_t const SAIx_SAI_BSLOTR[5] = {
+  [1] = (rw_reg32_t)0x40015830U,
+  [2] = (rw_reg32_t)0x40015C30U,
+  [3] = (rw_reg32_t)0x40016030U,
+  [4] = (rw_reg32_t)0x58005430U,
+};
+
+/** @brief Interrupt mask register 2. */
+static rw_reg32_t const SAIx_SAI_BIM[5] = {
+  [1] = (rw_reg32_t)0x40015834U,
+  [2] = (rw_reg32_t)0x40015C34U,
+  [3] = (rw_reg32_t)0x40016034U,
+  [4] = (rw_reg32_t)0x58005434U,
+};
+
+/** @brief Status register. */
+static ro_reg32_t const SAIx_SAI_BSR[5] = {
+  [1] = (ro_reg32_t)0x40015838U,
+  [2] = (ro_reg32_t)0x40015C38U,
+  [3] = (ro_reg32_t)0x40016038U,
+  [4] = (ro_reg32_t)0x58005438U,
+};
+
+/** @brief Clear flag register. */
+static rw_reg32_t const SAIx_SAI_BCLRFR[5] = {
+  [1] = (rw_reg32_t)0x4001583CU,
+  [2] = (rw_reg32_t)0x40015C3CU,
+  [3] = (rw_reg32_t)0x4001603CU,
+  [4] = (rw_reg32_t)0x5800543CU,
+};
+
+/** @brief Data register. */
+static rw_reg32_t const SAIx_SAI_BDR[5] = {
+  [1] = (rw_reg32_t)0x40015840U,
+  [2] = (rw_reg32_t)0x40015C40U,
+  [3] = (rw_reg32_t)0x40016040U,
+  [4] = (rw_reg32_t)0x58005440U,
+};
+
+/** @brief PDM control register. */
+static rw_reg32_t const SAIx_SAI_PDMCR[5] = {
+  [1] = (rw_reg32_t)0x40015844U,
+  [2] = (rw_reg32_t)0x40015C44U,
+  [3] = (rw_reg32_t)0x40016044U,
+  [4] = (rw_reg32_t)0x58005444U,
+};
+
+/** @brief PDM delay register. */
+static rw_reg32_t const SAIx_SAI_PDMDLY[5] = {
+  [1] = (rw_reg32_t)0x40015848U,
+  [2] = (rw_reg32_t)0x40015C48U,
+  [3] = (rw_reg32_t)0x40016048U,
+  [4] = (rw_reg32_t)0x58005448U,
+};
+
+/** @subsection SAIx Register Field Definitions */
+
+static const field32_t SAIx_SAI_GCR_SYNCOUT     = {.msk = 0x00000030U, .pos = 4};  /** @brief Synchronization outputs These bits are set and cleared by software. */
+static const field32_t SAIx_SAI_GCR_SYNCIN      = {.msk = 0x00000003U, .pos = 0};  /** @brief Synchronization inputs. */
+static const field32_t SAIx_SAI_ACR1_MODE       = {.msk = 0x00000003U, .pos = 0};  /** @brief SAIx audio block mode immediately. */
+static const field32_t SAIx_SAI_ACR1_PRTCFG     = {.msk = 0x0000000CU, .pos = 2};  /** @brief Protocol configuration. These bits are set and cleared by software. These bits have to be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_ACR1_DS         = {.msk = 0x000000E0U, .pos = 5};  /** @brief Data size. These bits are set and cleared by software. These bits are ignored when the SPDIF protocols are selected (bit PRTCFG[1:0]), because the frame and the data size are fixed in such case. When the companding mode is selected through COMP[1:0] bits, DS[1:0] are ignored since the data size is fixed to 8 bits by the algorithm. These bits must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_ACR1_LSBFIRST   = {.msk = 0x00000100U, .pos = 8};  /** @brief Least significant bit first. This bit is set and cleared by software. It must be configured when the audio block is disabled. This bit has no meaning in AC97 audio protocol since AC97 data are always transferred with the MSB first. This bit has no meaning in SPDIF audio protocol since in SPDIF data are always transferred with LSB first. */
+static const field32_t SAIx_SAI_ACR1_CKSTR      = {.msk = 0x00000200U, .pos = 9};  /** @brief Clock strobing edge. This bit is set and cleared by software. It must be configured when the audio block is disabled. This bit has no meaning in SPDIF audio protocol. */
+static const field32_t SAIx_SAI_ACR1_SYNCEN     = {.msk = 0x00000C00U, .pos = 10}; /** @brief Synchronization enable. These bits are set and cleared by software. They must be configured when the audio sub-block is disabled. Note: The audio sub-block should be configured as asynchronous when SPDIF mode is enabled. */
+static const field32_t SAIx_SAI_ACR1_MONO       = {.msk = 0x00001000U, .pos = 12}; /** @brief Mono mode. This bit is set and cleared by software. It is meaningful only when the number of slots is equal to 2. When the mono mode is selected, slot 0 data are duplicated on slot 1 when the audio block operates as a transmitter. In reception mode, the slot1 is discarded and only the data received from slot 0 are stored. Refer to Section: Mono/stereo mode for more details. */
+static const field32_t SAIx_SAI_ACR1_OUTDRIV    = {.msk = 0x00002000U, .pos = 13}; /** @brief Output drive. This bit is set and cleared by software. Note: This bit has to be set before enabling the audio block and after the audio block configuration. */
+static const field32_t SAIx_SAI_ACR1_SAIXEN     = {.msk = 0x00010000U, .pos = 16}; /** @brief Audio block enable where x is A or B. This bit is set by software. To switch off the audio block, the application software must program this bit to 0 and poll the bit till it reads back 0, meaning that the block is completely disabled. Before setting this bit to 1, check that it is set to 0, otherwise the enable command will not be taken into account. This bit allows to control the state of SAIx audio block. If it is disabled when an audio frame transfer is ongoing, the ongoing transfer completes and the cell is fully disabled at the end of this audio frame transfer. Note: When SAIx block is configured in master mode, the clock must be present on the input of SAIx before setting SAIXEN bit. */
+static const field32_t SAIx_SAI_ACR1_DMAEN      = {.msk = 0x00020000U, .pos = 17}; /** @brief DMA enable. This bit is set and cleared by software. Note: Since the audio block defaults to operate as a transmitter after reset, the MODE[1:0] bits must be configured before setting DMAEN to avoid a DMA request in receiver mode. */
+static const field32_t SAIx_SAI_ACR1_NOMCK      = {.msk = 0x00080000U, .pos = 19}; /** @brief No divider. */
+static const field32_t SAIx_SAI_ACR1_MCKDIV     = {.msk = 0x00F00000U, .pos = 20}; /** @brief Master clock divider. These bits are set and cleared by software. These bits are meaningless when the audio block operates in slave mode. They have to be configured when the audio block is disabled. Others: the master clock frequency is calculated accordingly to the following formula:. */
+static const field32_t SAIx_SAI_ACR1_OSR        = {.msk = 0x04000000U, .pos = 26}; /** @brief Oversampling ratio for master clock. */
+static const field32_t SAIx_SAI_ACR2_FTH        = {.msk = 0x00000007U, .pos = 0};  /** @brief FIFO threshold. This bit is set and cleared by software. */
+static const field32_t SAIx_SAI_ACR2_FFLUSH     = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO flush. This bit is set by software. It is always read as 0. This bit should be configured when the SAI is disabled. */
+static const field32_t SAIx_SAI_ACR2_TRIS       = {.msk = 0x00000010U, .pos = 4};  /** @brief Tristate management on data line. This bit is set and cleared by software. It is meaningful only if the audio block is configured as a transmitter. This bit is not used when the audio block is configured in SPDIF mode. It should be configured when SAI is disabled. Refer to Section: Output data line management on an inactive slot for more details. */
+static const field32_t SAIx_SAI_ACR2_MUTE       = {.msk = 0x00000020U, .pos = 5};  /** @brief Mute. This bit is set and cleared by software. It is meaningful only when the audio block operates as a transmitter. The MUTE value is linked to value of MUTEVAL if the number of slots is lower or equal to 2, or equal to 0 if it is greater than 2. Refer to Section: Mute mode for more details. Note: This bit is meaningless and should not be used for SPDIF audio blocks. */
+static const field32_t SAIx_SAI_ACR2_MUTEVAL    = {.msk = 0x00000040U, .pos = 6};  /** @brief Mute value. This bit is set and cleared by software.It must be written before enabling the audio block: SAIXEN. This bit is meaningful only when the audio block operates as a transmitter, the number of slots is lower or equal to 2 and the MUTE bit is set. If more slots are declared, the bit value sent during the transmission in mute mode is equal to 0, whatever the value of MUTEVAL. if the number of slot is lower or equal to 2 and MUTEVAL = 1, the MUTE value transmitted for each slot is the one sent during the previous frame. Refer to Section: Mute mode for more details. Note: This bit is meaningless and should not be used for SPDIF audio blocks. */
+static const field32_t SAIx_SAI_ACR2_MUTECNT    = {.msk = 0x00001F80U, .pos = 7};  /** @brief Mute counter. These bits are set and cleared by software. They are used only in reception mode. The value set in these bits is compared to the number of consecutive mute frames detected in reception. When the number of mute frames is equal to this value, the flag MUTEDET will be set and an interrupt will be generated if bit MUTEDETIE is set. Refer to Section: Mute mode for more details. */
+static const field32_t SAIx_SAI_ACR2_CPL        = {.msk = 0x00002000U, .pos = 13}; /** @brief Complement bit. This bit is set and cleared by software. It defines the type of complement to be used for companding mode Note: This bit has effect only when the companding mode is -Law algorithm or A-Law algorithm. */
+static const field32_t SAIx_SAI_ACR2_COMP       = {.msk = 0x0000C000U, .pos = 14}; /** @brief Companding mode. These bits are set and cleared by software. The -Law and the A-Law log are a part of the CCITT G.711 recommendation, the type of complement that will be used depends on CPL bit. The data expansion or data compression are determined by the state of bit MODE[0]. The data compression is applied if the audio block is configured as a transmitter. The data expansion is automatically applied when the audio block is configured as a receiver. Refer to Section: Companding mode for more details. Note: Companding mode is applicable only when TDM is selected. */
+static const field32_t SAIx_SAI_AFRCR_FRL       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Frame length. These bits are set and cleared by software. They define the audio frame length expressed in number of SCK clock cycles: the number of bits in the frame is equal to FRL[7:0] + 1. The minimum number of bits to transfer in an audio frame must be equal to 8, otherwise the audio block will behaves in an unexpected way. This is the case when the data size is 8 bits and only one slot 0 is defined in NBSLOT[4:0] of SAI_xSLOTR register (NBSLOT[3:0] = 0000). In master mode, if the master clock (available on MCLK_x pin) is used, the frame length should be aligned with a number equal to a power of 2, ranging from 8 to 256. When the master clock is not used (NODIV = 1), it is recommended to program the frame length to an value ranging from 8 to 256. These bits are meaningless and are not used in AC97 or SPDIF audio block configuration. */
+static const field32_t SAIx_SAI_AFRCR_FSALL     = {.msk = 0x00007F00U, .pos = 8};  /** @brief Frame synchronization active level length. These bits are set and cleared by software. They specify the length in number of bit clock (SCK) + 1 (FSALL[6:0] + 1) of the active level of the FS signal in the audio frame These bits are meaningless and are not used in AC97 or SPDIF audio block configuration. They must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_AFRCR_FSDEF     = {.msk = 0x00010000U, .pos = 16}; /** @brief Frame synchronization definition. This bit is set and cleared by software. When the bit is set, the number of slots defined in the SAI_xSLOTR register has to be even. It means that half of this number of slots will be dedicated to the left channel and the other slots for the right channel (e.g: this bit has to be set for I2S or MSB/LSB-justified protocols...). This bit is meaningless and is not used in AC97 or SPDIF audio block configuration. It must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_AFRCR_FSPOL     = {.msk = 0x00020000U, .pos = 17}; /** @brief Frame synchronization polarity. This bit is set and cleared by software. It is used to configure the level of the start of frame on the FS signal. It is meaningless and is not used in AC97 or SPDIF audio block configuration. This bit must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_AFRCR_FSOFF     = {.msk = 0x00040000U, .pos = 18}; /** @brief Frame synchronization offset. This bit is set and cleared by software. It is meaningless and is not used in AC97 or SPDIF audio block configuration. This bit must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_ASLOTR_FBOFF    = {.msk = 0x0000001FU, .pos = 0};  /** @brief First bit offset These bits are set and cleared by software. The value set in this bitfield defines the position of the first data transfer bit in the slot. It represents an offset value. In transmission mode, the bits outside the data field are forced to 0. In reception mode, the extra received bits are discarded. These bits must be set when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_ASLOTR_SLOTSZ   = {.msk = 0x000000C0U, .pos = 6};  /** @brief Slot size This bits is set and cleared by software. The slot size must be higher or equal to the data size. If this condition is not respected, the behavior of the SAI will be undetermined. Refer to Section: Output data line management on an inactive slot for information on how to drive SD line. These bits must be set when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_ASLOTR_NBSLOT   = {.msk = 0x00000F00U, .pos = 8};  /** @brief Number of slots in an audio frame. These bits are set and cleared by software. The value set in this bitfield represents the number of slots + 1 in the audio frame (including the number of inactive slots). The maximum number of slots is 16. The number of slots should be even if FSDEF bit in the SAI_xFRCR register is set. The number of slots must be configured when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_ASLOTR_SLOTEN   = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Slot enable. These bits are set and cleared by software. Each SLOTEN bit corresponds to a slot position from 0 to 15 (maximum 16 slots). The slot must be enabled when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_AIM_OVRUDRIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief Overrun/underrun interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the OVRUDR bit in the SAI_xSR register is set. */
+static const field32_t SAIx_SAI_AIM_MUTEDETIE   = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the MUTEDET bit in the SAI_xSR register is set. This bit has a meaning only if the audio block is configured in receiver mode. */
+static const field32_t SAIx_SAI_AIM_WCKCFGIE    = {.msk = 0x00000004U, .pos = 2};  /** @brief Wrong clock configuration interrupt enable. This bit is set and cleared by software. This bit is taken into account only if the audio block is configured as a master (MODE[1] = 0) and NODIV = 0. It generates an interrupt if the WCKCFG flag in the SAI_xSR register is set. Note: This bit is used only in TDM mode and is meaningless in other modes. */
+static const field32_t SAIx_SAI_AIM_FREQIE      = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO request interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the FREQ bit in the SAI_xSR register is set. Since the audio block defaults to operate as a transmitter after reset, the MODE bit must be configured before setting FREQIE to avoid a parasitic interruption in receiver mode,. */
+static const field32_t SAIx_SAI_AIM_CNRDYIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Codec not ready interrupt enable (AC97). This bit is set and cleared by software. When the interrupt is enabled, the audio block detects in the slot 0 (tag0) of the AC97 frame if the Codec connected to this line is ready or not. If it is not ready, the CNRDY flag in the SAI_xSR register is set and an interruption i generated. This bit has a meaning only if the AC97 mode is selected through PRTCFG[1:0] bits and the audio block is operates as a receiver. */
+static const field32_t SAIx_SAI_AIM_AFSDETIE    = {.msk = 0x00000020U, .pos = 5};  /** @brief Anticipated frame synchronization detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt will be generated if the AFSDET bit in the SAI_xSR register is set. This bit is meaningless in AC97, SPDIF mode or when the audio block operates as a master. */
+static const field32_t SAIx_SAI_AIM_LFSDETIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief Late frame synchronization detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt will be generated if the LFSDET bit is set in the SAI_xSR register. This bit is meaningless in AC97, SPDIF mode or when the audio block operates as a master. */
+static const field32_t SAIx_SAI_ASR_OVRUDR      = {.msk = 0x00000001U, .pos = 0};  /** @brief Overrun / underrun. This bit is read only. The overrun and underrun conditions can occur only when the audio block is configured as a receiver and a transmitter, respectively. It can generate an interrupt if OVRUDRIE bit is set in SAI_xIM register. This flag is cleared when the software sets COVRUDR bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_MUTEDET     = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection. This bit is read only. This flag is set if consecutive 0 values are received in each slot of a given audio frame and for a consecutive number of audio frames (set in the MUTECNT bit in the SAI_xCR2 register). It can generate an interrupt if MUTEDETIE bit is set in SAI_xIM register. This flag is cleared when the software sets bit CMUTEDET in the SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_WCKCFG      = {.msk = 0x00000004U, .pos = 2};  /** @brief Wrong clock configuration flag. This bit is read only. This bit is used only when the audio block operates in master mode (MODE[1] = 0) and NODIV = 0. It can generate an interrupt if WCKCFGIE bit is set in SAI_xIM register. This flag is cleared when the software sets CWCKCFG bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_FREQ        = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO request. This bit is read only. The request depends on the audio block configuration: If the block is configured in transmission mode, the FIFO request is related to a write request operation in the SAI_xDR. If the block configured in reception, the FIFO request related to a read request operation from the SAI_xDR. This flag can generate an interrupt if FREQIE bit is set in SAI_xIM register. */
+static const field32_t SAIx_SAI_ASR_CNRDY       = {.msk = 0x00000010U, .pos = 4};  /** @brief Codec not ready. This bit is read only. This bit is used only when the AC97 audio protocol is selected in the SAI_xCR1 register and configured in receiver mode. It can generate an interrupt if CNRDYIE bit is set in SAI_xIM register. This flag is cleared when the software sets CCNRDY bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_AFSDET      = {.msk = 0x00000020U, .pos = 5};  /** @brief Anticipated frame synchronization detection. This bit is read only. This flag can be set only if the audio block is configured in slave mode. It is not used in AC97or SPDIF mode. It can generate an interrupt if AFSDETIE bit is set in SAI_xIM register. This flag is cleared when the software sets CAFSDET bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_LFSDET      = {.msk = 0x00000040U, .pos = 6};  /** @brief Late frame synchronization detection. This bit is read only. This flag can be set only if the audio block is configured in slave mode. It is not used in AC97 or SPDIF mode. It can generate an interrupt if LFSDETIE bit is set in the SAI_xIM register. This flag is cleared when the software sets bit CLFSDET in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_ASR_FLVL        = {.msk = 0x00070000U, .pos = 16}; /** @brief FIFO level threshold. This bit is read only. The FIFO level threshold flag is managed only by hardware and its setting depends on SAI block configuration (transmitter or receiver mode). If the SAI block is configured as transmitter: If SAI block is configured as receiver:. */
+static const field32_t SAIx_SAI_ACLRFR_COVRUDR  = {.msk = 0x00000001U, .pos = 0};  /** @brief Clear overrun / underrun. This bit is write only. Programming this bit to 1 clears the OVRUDR flag in the SAI_xSR register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_ACLRFR_CMUTEDET = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection flag. This bit is write only. Programming this bit to 1 clears the MUTEDET flag in the SAI_xSR register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_ACLRFR_CWCKCFG  = {.msk = 0x00000004U, .pos = 2};  /** @brief Clear wrong clock configuration flag. This bit is write only. Programming this bit to 1 clears the WCKCFG flag in the SAI_xSR register. This bit is used only when the audio block is set as master (MODE[1] = 0) and NODIV = 0 in the SAI_xCR1 register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_ACLRFR_CCNRDY   = {.msk = 0x00000010U, .pos = 4};  /** @brief Clear Codec not ready flag. This bit is write only. Programming this bit to 1 clears the CNRDY flag in the SAI_xSR register. This bit is used only when the AC97 audio protocol is selected in the SAI_xCR1 register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_ACLRFR_CAFSDET  = {.msk = 0x00000020U, .pos = 5};  /** @brief Clear anticipated frame synchronization detection flag. This bit is write only. Programming this bit to 1 clears the AFSDET flag in the SAI_xSR register. It is not used in AC97or SPDIF mode. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_ACLRFR_CLFSDET  = {.msk = 0x00000040U, .pos = 6};  /** @brief Clear late frame synchronization detection flag. This bit is write only. Programming this bit to 1 clears the LFSDET flag in the SAI_xSR register. This bit is not used in AC97or SPDIF mode Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCR1_MODE       = {.msk = 0x00000003U, .pos = 0};  /** @brief SAIx audio block mode immediately. */
+static const field32_t SAIx_SAI_BCR1_PRTCFG     = {.msk = 0x0000000CU, .pos = 2};  /** @brief Protocol configuration. These bits are set and cleared by software. These bits have to be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BCR1_DS         = {.msk = 0x000000E0U, .pos = 5};  /** @brief Data size. These bits are set and cleared by software. These bits are ignored when the SPDIF protocols are selected (bit PRTCFG[1:0]), because the frame and the data size are fixed in such case. When the companding mode is selected through COMP[1:0] bits, DS[1:0] are ignored since the data size is fixed to 8 bits by the algorithm. These bits must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BCR1_LSBFIRST   = {.msk = 0x00000100U, .pos = 8};  /** @brief Least significant bit first. This bit is set and cleared by software. It must be configured when the audio block is disabled. This bit has no meaning in AC97 audio protocol since AC97 data are always transferred with the MSB first. This bit has no meaning in SPDIF audio protocol since in SPDIF data are always transferred with LSB first. */
+static const field32_t SAIx_SAI_BCR1_CKSTR      = {.msk = 0x00000200U, .pos = 9};  /** @brief Clock strobing edge. This bit is set and cleared by software. It must be configured when the audio block is disabled. This bit has no meaning in SPDIF audio protocol. */
+static const field32_t SAIx_SAI_BCR1_SYNCEN     = {.msk = 0x00000C00U, .pos = 10}; /** @brief Synchronization enable. These bits are set and cleared by software. They must be configured when the audio sub-block is disabled. Note: The audio sub-block should be configured as asynchronous when SPDIF mode is enabled. */
+static const field32_t SAIx_SAI_BCR1_MONO       = {.msk = 0x00001000U, .pos = 12}; /** @brief Mono mode. This bit is set and cleared by software. It is meaningful only when the number of slots is equal to 2. When the mono mode is selected, slot 0 data are duplicated on slot 1 when the audio block operates as a transmitter. In reception mode, the slot1 is discarded and only the data received from slot 0 are stored. Refer to Section: Mono/stereo mode for more details. */
+static const field32_t SAIx_SAI_BCR1_OUTDRIV    = {.msk = 0x00002000U, .pos = 13}; /** @brief Output drive. This bit is set and cleared by software. Note: This bit has to be set before enabling the audio block and after the audio block configuration. */
+static const field32_t SAIx_SAI_BCR1_SAIXEN     = {.msk = 0x00010000U, .pos = 16}; /** @brief Audio block enable where x is A or B. This bit is set by software. To switch off the audio block, the application software must program this bit to 0 and poll the bit till it reads back 0, meaning that the block is completely disabled. Before setting this bit to 1, check that it is set to 0, otherwise the enable command will not be taken into account. This bit allows to control the state of SAIx audio block. If it is disabled when an audio frame transfer is ongoing, the ongoing transfer completes and the cell is fully disabled at the end of this audio frame transfer. Note: When SAIx block is configured in master mode, the clock must be present on the input of SAIx before setting SAIXEN bit. */
+static const field32_t SAIx_SAI_BCR1_DMAEN      = {.msk = 0x00020000U, .pos = 17}; /** @brief DMA enable. This bit is set and cleared by software. Note: Since the audio block defaults to operate as a transmitter after reset, the MODE[1:0] bits must be configured before setting DMAEN to avoid a DMA request in receiver mode. */
+static const field32_t SAIx_SAI_BCR1_NOMCK      = {.msk = 0x00080000U, .pos = 19}; /** @brief No divider. */
+static const field32_t SAIx_SAI_BCR1_MCKDIV     = {.msk = 0x00F00000U, .pos = 20}; /** @brief Master clock divider. These bits are set and cleared by software. These bits are meaningless when the audio block operates in slave mode. They have to be configured when the audio block is disabled. Others: the master clock frequency is calculated accordingly to the following formula:. */
+static const field32_t SAIx_SAI_BCR1_OSR        = {.msk = 0x04000000U, .pos = 26}; /** @brief Oversampling ratio for master clock. */
+static const field32_t SAIx_SAI_BCR2_FTH        = {.msk = 0x00000007U, .pos = 0};  /** @brief FIFO threshold. This bit is set and cleared by software. */
+static const field32_t SAIx_SAI_BCR2_FFLUSH     = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO flush. This bit is set by software. It is always read as 0. This bit should be configured when the SAI is disabled. */
+static const field32_t SAIx_SAI_BCR2_TRIS       = {.msk = 0x00000010U, .pos = 4};  /** @brief Tristate management on data line. This bit is set and cleared by software. It is meaningful only if the audio block is configured as a transmitter. This bit is not used when the audio block is configured in SPDIF mode. It should be configured when SAI is disabled. Refer to Section: Output data line management on an inactive slot for more details. */
+static const field32_t SAIx_SAI_BCR2_MUTE       = {.msk = 0x00000020U, .pos = 5};  /** @brief Mute. This bit is set and cleared by software. It is meaningful only when the audio block operates as a transmitter. The MUTE value is linked to value of MUTEVAL if the number of slots is lower or equal to 2, or equal to 0 if it is greater than 2. Refer to Section: Mute mode for more details. Note: This bit is meaningless and should not be used for SPDIF audio blocks. */
+static const field32_t SAIx_SAI_BCR2_MUTEVAL    = {.msk = 0x00000040U, .pos = 6};  /** @brief Mute value. This bit is set and cleared by software.It must be written before enabling the audio block: SAIXEN. This bit is meaningful only when the audio block operates as a transmitter, the number of slots is lower or equal to 2 and the MUTE bit is set. If more slots are declared, the bit value sent during the transmission in mute mode is equal to 0, whatever the value of MUTEVAL. if the number of slot is lower or equal to 2 and MUTEVAL = 1, the MUTE value transmitted for each slot is the one sent during the previous frame. Refer to Section: Mute mode for more details. Note: This bit is meaningless and should not be used for SPDIF audio blocks. */
+static const field32_t SAIx_SAI_BCR2_MUTECNT    = {.msk = 0x00001F80U, .pos = 7};  /** @brief Mute counter. These bits are set and cleared by software. They are used only in reception mode. The value set in these bits is compared to the number of consecutive mute frames detected in reception. When the number of mute frames is equal to this value, the flag MUTEDET will be set and an interrupt will be generated if bit MUTEDETIE is set. Refer to Section: Mute mode for more details. */
+static const field32_t SAIx_SAI_BCR2_CPL        = {.msk = 0x00002000U, .pos = 13}; /** @brief Complement bit. This bit is set and cleared by software. It defines the type of complement to be used for companding mode Note: This bit has effect only when the companding mode is -Law algorithm or A-Law algorithm. */
+static const field32_t SAIx_SAI_BCR2_COMP       = {.msk = 0x0000C000U, .pos = 14}; /** @brief Companding mode. These bits are set and cleared by software. The -Law and the A-Law log are a part of the CCITT G.711 recommendation, the type of complement that will be used depends on CPL bit. The data expansion or data compression are determined by the state of bit MODE[0]. The data compression is applied if the audio block is configured as a transmitter. The data expansion is automatically applied when the audio block is configured as a receiver. Refer to Section: Companding mode for more details. Note: Companding mode is applicable only when TDM is selected. */
+static const field32_t SAIx_SAI_BFRCR_FRL       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Frame length. These bits are set and cleared by software. They define the audio frame length expressed in number of SCK clock cycles: the number of bits in the frame is equal to FRL[7:0] + 1. The minimum number of bits to transfer in an audio frame must be equal to 8, otherwise the audio block will behaves in an unexpected way. This is the case when the data size is 8 bits and only one slot 0 is defined in NBSLOT[4:0] of SAI_xSLOTR register (NBSLOT[3:0] = 0000). In master mode, if the master clock (available on MCLK_x pin) is used, the frame length should be aligned with a number equal to a power of 2, ranging from 8 to 256. When the master clock is not used (NODIV = 1), it is recommended to program the frame length to an value ranging from 8 to 256. These bits are meaningless and are not used in AC97 or SPDIF audio block configuration. */
+static const field32_t SAIx_SAI_BFRCR_FSALL     = {.msk = 0x00007F00U, .pos = 8};  /** @brief Frame synchronization active level length. These bits are set and cleared by software. They specify the length in number of bit clock (SCK) + 1 (FSALL[6:0] + 1) of the active level of the FS signal in the audio frame These bits are meaningless and are not used in AC97 or SPDIF audio block configuration. They must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BFRCR_FSDEF     = {.msk = 0x00010000U, .pos = 16}; /** @brief Frame synchronization definition. This bit is set and cleared by software. When the bit is set, the number of slots defined in the SAI_xSLOTR register has to be even. It means that half of this number of slots will be dedicated to the left channel and the other slots for the right channel (e.g: this bit has to be set for I2S or MSB/LSB-justified protocols...). This bit is meaningless and is not used in AC97 or SPDIF audio block configuration. It must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BFRCR_FSPOL     = {.msk = 0x00020000U, .pos = 17}; /** @brief Frame synchronization polarity. This bit is set and cleared by software. It is used to configure the level of the start of frame on the FS signal. It is meaningless and is not used in AC97 or SPDIF audio block configuration. This bit must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BFRCR_FSOFF     = {.msk = 0x00040000U, .pos = 18}; /** @brief Frame synchronization offset. This bit is set and cleared by software. It is meaningless and is not used in AC97 or SPDIF audio block configuration. This bit must be configured when the audio block is disabled. */
+static const field32_t SAIx_SAI_BSLOTR_FBOFF    = {.msk = 0x0000001FU, .pos = 0};  /** @brief First bit offset These bits are set and cleared by software. The value set in this bitfield defines the position of the first data transfer bit in the slot. It represents an offset value. In transmission mode, the bits outside the data field are forced to 0. In reception mode, the extra received bits are discarded. These bits must be set when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_BSLOTR_SLOTSZ   = {.msk = 0x000000C0U, .pos = 6};  /** @brief Slot size This bits is set and cleared by software. The slot size must be higher or equal to the data size. If this condition is not respected, the behavior of the SAI will be undetermined. Refer to Section: Output data line management on an inactive slot for information on how to drive SD line. These bits must be set when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_BSLOTR_NBSLOT   = {.msk = 0x00000F00U, .pos = 8};  /** @brief Number of slots in an audio frame. These bits are set and cleared by software. The value set in this bitfield represents the number of slots + 1 in the audio frame (including the number of inactive slots). The maximum number of slots is 16. The number of slots should be even if FSDEF bit in the SAI_xFRCR register is set. The number of slots must be configured when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_BSLOTR_SLOTEN   = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Slot enable. These bits are set and cleared by software. Each SLOTEN bit corresponds to a slot position from 0 to 15 (maximum 16 slots). The slot must be enabled when the audio block is disabled. They are ignored in AC97 or SPDIF mode. */
+static const field32_t SAIx_SAI_BIM_OVRUDRIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief Overrun/underrun interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the OVRUDR bit in the SAI_xSR register is set. */
+static const field32_t SAIx_SAI_BIM_MUTEDETIE   = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the MUTEDET bit in the SAI_xSR register is set. This bit has a meaning only if the audio block is configured in receiver mode. */
+static const field32_t SAIx_SAI_BIM_WCKCFGIE    = {.msk = 0x00000004U, .pos = 2};  /** @brief Wrong clock configuration interrupt enable. This bit is set and cleared by software. This bit is taken into account only if the audio block is configured as a master (MODE[1] = 0) and NODIV = 0. It generates an interrupt if the WCKCFG flag in the SAI_xSR register is set. Note: This bit is used only in TDM mode and is meaningless in other modes. */
+static const field32_t SAIx_SAI_BIM_FREQIE      = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO request interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt is generated if the FREQ bit in the SAI_xSR register is set. Since the audio block defaults to operate as a transmitter after reset, the MODE bit must be configured before setting FREQIE to avoid a parasitic interruption in receiver mode,. */
+static const field32_t SAIx_SAI_BIM_CNRDYIE     = {.msk = 0x00000010U, .pos = 4};  /** @brief Codec not ready interrupt enable (AC97). This bit is set and cleared by software. When the interrupt is enabled, the audio block detects in the slot 0 (tag0) of the AC97 frame if the Codec connected to this line is ready or not. If it is not ready, the CNRDY flag in the SAI_xSR register is set and an interruption i generated. This bit has a meaning only if the AC97 mode is selected through PRTCFG[1:0] bits and the audio block is operates as a receiver. */
+static const field32_t SAIx_SAI_BIM_AFSDETIE    = {.msk = 0x00000020U, .pos = 5};  /** @brief Anticipated frame synchronization detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt will be generated if the AFSDET bit in the SAI_xSR register is set. This bit is meaningless in AC97, SPDIF mode or when the audio block operates as a master. */
+static const field32_t SAIx_SAI_BIM_LFSDETIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief Late frame synchronization detection interrupt enable. This bit is set and cleared by software. When this bit is set, an interrupt will be generated if the LFSDET bit is set in the SAI_xSR register. This bit is meaningless in AC97, SPDIF mode or when the audio block operates as a master. */
+static const field32_t SAIx_SAI_BSR_OVRUDR      = {.msk = 0x00000001U, .pos = 0};  /** @brief Overrun / underrun. This bit is read only. The overrun and underrun conditions can occur only when the audio block is configured as a receiver and a transmitter, respectively. It can generate an interrupt if OVRUDRIE bit is set in SAI_xIM register. This flag is cleared when the software sets COVRUDR bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_MUTEDET     = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection. This bit is read only. This flag is set if consecutive 0 values are received in each slot of a given audio frame and for a consecutive number of audio frames (set in the MUTECNT bit in the SAI_xCR2 register). It can generate an interrupt if MUTEDETIE bit is set in SAI_xIM register. This flag is cleared when the software sets bit CMUTEDET in the SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_WCKCFG      = {.msk = 0x00000004U, .pos = 2};  /** @brief Wrong clock configuration flag. This bit is read only. This bit is used only when the audio block operates in master mode (MODE[1] = 0) and NODIV = 0. It can generate an interrupt if WCKCFGIE bit is set in SAI_xIM register. This flag is cleared when the software sets CWCKCFG bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_FREQ        = {.msk = 0x00000008U, .pos = 3};  /** @brief FIFO request. This bit is read only. The request depends on the audio block configuration: If the block is configured in transmission mode, the FIFO request is related to a write request operation in the SAI_xDR. If the block configured in reception, the FIFO request related to a read request operation from the SAI_xDR. This flag can generate an interrupt if FREQIE bit is set in SAI_xIM register. */
+static const field32_t SAIx_SAI_BSR_CNRDY       = {.msk = 0x00000010U, .pos = 4};  /** @brief Codec not ready. This bit is read only. This bit is used only when the AC97 audio protocol is selected in the SAI_xCR1 register and configured in receiver mode. It can generate an interrupt if CNRDYIE bit is set in SAI_xIM register. This flag is cleared when the software sets CCNRDY bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_AFSDET      = {.msk = 0x00000020U, .pos = 5};  /** @brief Anticipated frame synchronization detection. This bit is read only. This flag can be set only if the audio block is configured in slave mode. It is not used in AC97or SPDIF mode. It can generate an interrupt if AFSDETIE bit is set in SAI_xIM register. This flag is cleared when the software sets CAFSDET bit in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_LFSDET      = {.msk = 0x00000040U, .pos = 6};  /** @brief Late frame synchronization detection. This bit is read only. This flag can be set only if the audio block is configured in slave mode. It is not used in AC97 or SPDIF mode. It can generate an interrupt if LFSDETIE bit is set in the SAI_xIM register. This flag is cleared when the software sets bit CLFSDET in SAI_xCLRFR register. */
+static const field32_t SAIx_SAI_BSR_FLVL        = {.msk = 0x00070000U, .pos = 16}; /** @brief FIFO level threshold. This bit is read only. The FIFO level threshold flag is managed only by hardware and its setting depends on SAI block configuration (transmitter or receiver mode). If the SAI block is configured as transmitter: If SAI block is configured as receiver:. */
+static const field32_t SAIx_SAI_BCLRFR_COVRUDR  = {.msk = 0x00000001U, .pos = 0};  /** @brief Clear overrun / underrun. This bit is write only. Programming this bit to 1 clears the OVRUDR flag in the SAI_xSR register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCLRFR_CMUTEDET = {.msk = 0x00000002U, .pos = 1};  /** @brief Mute detection flag. This bit is write only. Programming this bit to 1 clears the MUTEDET flag in the SAI_xSR register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCLRFR_CWCKCFG  = {.msk = 0x00000004U, .pos = 2};  /** @brief Clear wrong clock configuration flag. This bit is write only. Programming this bit to 1 clears the WCKCFG flag in the SAI_xSR register. This bit is used only when the audio block is set as master (MODE[1] = 0) and NODIV = 0 in the SAI_xCR1 register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCLRFR_CCNRDY   = {.msk = 0x00000010U, .pos = 4};  /** @brief Clear Codec not ready flag. This bit is write only. Programming this bit to 1 clears the CNRDY flag in the SAI_xSR register. This bit is used only when the AC97 audio protocol is selected in the SAI_xCR1 register. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCLRFR_CAFSDET  = {.msk = 0x00000020U, .pos = 5};  /** @brief Clear anticipated frame synchronization detection flag. This bit is write only. Programming this bit to 1 clears the AFSDET flag in the SAI_xSR register. It is not used in AC97or SPDIF mode. Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_BCLRFR_CLFSDET  = {.msk = 0x00000040U, .pos = 6};  /** @brief Clear late frame synchronization detection flag. This bit is write only. Programming this bit to 1 clears the LFSDET flag in the SAI_xSR register. This bit is not used in AC97or SPDIF mode Reading this bit always returns the value 0. */
+static const field32_t SAIx_SAI_PDMCR_PDMEN     = {.msk = 0x00000001U, .pos = 0};  /** @brief PDM enable. */
+static const field32_t SAIx_SAI_PDMCR_MICNBR    = {.msk = 0x00000030U, .pos = 4};  /** @brief Number of microphones. */
+static const field32_t SAIx_SAI_PDMCR_CKEN1     = {.msk = 0x00000100U, .pos = 8};  /** @brief Clock enable of bitstream clock number 1. */
+static const field32_t SAIx_SAI_PDMCR_CKEN2     = {.msk = 0x00000200U, .pos = 9};  /** @brief Clock enable of bitstream clock number 2. */
+static const field32_t SAIx_SAI_PDMCR_CKEN3     = {.msk = 0x00000400U, .pos = 10}; /** @brief Clock enable of bitstream clock number 3. */
+static const field32_t SAIx_SAI_PDMCR_CKEN4     = {.msk = 0x00000800U, .pos = 11}; /** @brief Clock enable of bitstream clock number 4. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM1L   = {.msk = 0x00000007U, .pos = 0};  /** @brief Delay line adjust for first microphone of pair 1. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM1R   = {.msk = 0x00000070U, .pos = 4};  /** @brief Delay line adjust for second microphone of pair 1. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM2L   = {.msk = 0x00000700U, .pos = 8};  /** @brief Delay line for first microphone of pair 2. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM2R   = {.msk = 0x00007000U, .pos = 12}; /** @brief Delay line for second microphone of pair 2. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM3L   = {.msk = 0x00070000U, .pos = 16}; /** @brief Delay line for first microphone of pair 3. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM3R   = {.msk = 0x00700000U, .pos = 20}; /** @brief Delay line for second microphone of pair 3. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM4L   = {.msk = 0x07000000U, .pos = 24}; /** @brief Delay line for first microphone of pair 4. */
+static const field32_t SAIx_SAI_PDMDLY_DLYM4R   = {.msk = 0x70000000U, .pos = 28}; /** @brief Delay line for second microphone of pair 4. */
+
+/** @subsection Enumerated SAIx Register Field Definitions */
+
+/** @brief Clock enable of bitstream clock number 1. */
+static const field32_t SAIx_SAI_PDMCR_CKENx[5] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000200U, .pos = 9},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Delay line adjust for first microphone of pair 1. */
+static const field32_t SAIx_SAI_PDMDLY_DLYMxL[5] = {
+  [1] = {.msk = 0x00000007U, .pos = 0},
+  [2] = {.msk = 0x00000700U, .pos = 8},
+  [3] = {.msk = 0x00070000U, .pos = 16},
+  [4] = {.msk = 0x07000000U, .pos = 24},
+};
+
+/** @brief Delay line adjust for second microphone of pair 1. */
+static const field32_t SAIx_SAI_PDMDLY_DLYMxR[5] = {
+  [1] = {.msk = 0x00000070U, .pos = 4},
+  [2] = {.msk = 0x00007000U, .pos = 12},
+  [3] = {.msk = 0x00700000U, .pos = 20},
+  [4] = {.msk = 0x70000000U, .pos = 28},
+};
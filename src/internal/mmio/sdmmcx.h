@@ -0,0 +1,283 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/sdmmcx.h
+ * @authors UW SARP
+ * @brief Registers and fields of SDMMC1, SDMMC2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SDMMCx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated SDMMCx Register Definitions */
+
+/** @brief SDMMC power control register. */
+static rw_reg32_t const SDMMCx_POWER[3] = {
+  [1] = (rw_reg32_t)0x52007000U,
+  [2] = (rw_reg32_t)0x48022400U,
+};
+
+/** @brief The SDMMC_CLKCR register controls the SDMMC_CK output clock, the SDMMC_RX_CLK receive clock, and the bus width. */
+static rw_reg32_t const SDMMCx_CLKCR[3] = {
+  [1] = (rw_reg32_t)0x52007004U,
+  [2] = (rw_reg32_t)0x48022404U,
+};
+
+/** @brief The SDMMC_ARGR register contains a 32-bit command argument, which is sent to a card as part of a command message. */
+static rw_reg32_t const SDMMCx_ARGR[3] = {
+  [1] = (rw_reg32_t)0x52007008U,
+  [2] = (rw_reg32_t)0x48022408U,
+};
+
+/** @brief The SDMMC_CMDR register contains the command index and command type bits. The command index is sent to a card as part of a command message. The command type bits control the command path state machine (CPSM). */
+static rw_reg32_t const SDMMCx_CMDR[3] = {
+  [1] = (rw_reg32_t)0x5200700CU,
+  [2] = (rw_reg32_t)0x4802240CU,
+};
+
+/** @brief The SDMMC_RESP1/2/3/4R registers contain the status of a card, which is part of the received response. */
+static ro_reg32_t const SDMMCx_RESP1R[3] = {
+  [1] = (ro_reg32_t)0x52007014U,
+  [2] = (ro_reg32_t)0x48022414U,
+};
+
+/** @brief The SDMMC_RESP1/2/3/4R registers contain the status of a card, which is part of the received response. */
+static ro_reg32_t const SDMMCx_RESP2R[3] = {
+  [1] = (ro_reg32_t)0x52007018U,
+  [2] = (ro_reg32_t)0x48022418U,
+};
+
+/** @brief The SDMMC_RESP1/2/3/4R registers contain the status of a card, which is part of the received response. */
+static ro_reg32_t const SDMMCx_RESP3R[3] = {
+  [1] = (ro_reg32_t)0x5200701CU,
+  [2] = (ro_reg32_t)0x4802241CU,
+};
+
+/** @brief The SDMMC_RESP1/2/3/4R registers contain the status of a card, which is part of the received response. */
+static ro_reg32_t const SDMMCx_RESP4R[3] = {
+  [1] = (ro_reg32_t)0x52007020U,
+  [2] = (ro_reg32_t)0x48022420U,
+};
+
+/** @brief The SDMMC_DTIMER register contains the data timeout period, in card bus clock periods. A counter loads the value from the SDMMC_DTIMER register, and starts decrementing when the data path state machine (DPSM) enters the Wait_R or Busy state. If the timer reaches 0 while the DPSM is in either of these states, the timeout status flag is set. */
+static rw_reg32_t const SDMMCx_DTIMER[3] = {
+  [1] = (rw_reg32_t)0x52007024U,
+  [2] = (rw_reg32_t)0x48022424U,
+};
+
+/** @brief The SDMMC_DLENR register contains the number of data bytes to be transferred. The value is loaded into the data counter when data transfer starts. */
+static rw_reg32_t const SDMMCx_DLENR[3] = {
+  [1] = (rw_reg32_t)0x52007028U,
+  [2] = (rw_reg32_t)0x48022428U,
+};
+
+/** @brief The SDMMC_DCTRL register control the data path state machine (DPSM). */
+static rw_reg32_t const SDMMCx_DCTRL[3] = {
+  [1] = (rw_reg32_t)0x5200702CU,
+  [2] = (rw_reg32_t)0x4802242CU,
+};
+
+/** @brief The SDMMC_DCNTR register loads the value from the data length register (see SDMMC_DLENR) when the DPSM moves from the Idle state to the Wait_R or Wait_S state. As data is transferred, the counter decrements the value until it reaches 0. The DPSM then moves to the Idle state and when there has been no error, the data status end flag (DATAEND) is set. */
+static ro_reg32_t const SDMMCx_DCNTR[3] = {
+  [1] = (ro_reg32_t)0x52007030U,
+  [2] = (ro_reg32_t)0x48022430U,
+};
+
+/** @brief The SDMMC_STAR register is a read-only register. It contains two types of flag:Static flags (bits [29,21,11:0]): these bits remain asserted until they are cleared by writing to the SDMMC interrupt Clear register (see SDMMC_ICR)Dynamic flags (bits [20:12]): these bits change state depending on the state of the underlying logic (for example, FIFO full and empty flags are asserted and de-asserted as data while written to the FIFO). */
+static ro_reg32_t const SDMMCx_STAR[3] = {
+  [1] = (ro_reg32_t)0x52007034U,
+  [2] = (ro_reg32_t)0x48022434U,
+};
+
+/** @brief The SDMMC_ICR register is a write-only register. Writing a bit with 1 clears the corresponding bit in the SDMMC_STAR status register. */
+static rw_reg32_t const SDMMCx_ICR[3] = {
+  [1] = (rw_reg32_t)0x52007038U,
+  [2] = (rw_reg32_t)0x48022438U,
+};
+
+/** @brief The interrupt mask register determines which status flags generate an interrupt request by setting the corresponding bit to 1. */
+static rw_reg32_t const SDMMCx_MASKR[3] = {
+  [1] = (rw_reg32_t)0x5200703CU,
+  [2] = (rw_reg32_t)0x4802243CU,
+};
+
+/** @brief The SDMMC_ACKTIMER register contains the acknowledgment timeout period, in SDMMC_CK bus clock periods. A counter loads the value from the SDMMC_ACKTIMER register, and starts decrementing when the data path state machine (DPSM) enters the Wait_Ack state. If the timer reaches 0 while the DPSM is in this states, the acknowledgment timeout status flag is set. */
+static rw_reg32_t const SDMMCx_ACKTIMER[3] = {
+  [1] = (rw_reg32_t)0x52007040U,
+  [2] = (rw_reg32_t)0x48022440U,
+};
+
+/** @brief The receive and transmit FIFOs can be read or written as 32-bit wide registers. The FIFOs contain 32 entries on 32 sequential addresses. This allows the CPU to use its load and store multiple operands to read from/write to the FIFO. */
+static rw_reg32_t const SDMMCx_IDMACTRLR[3] = {
+  [1] = (rw_reg32_t)0x52007050U,
+  [2] = (rw_reg32_t)0x48022450U,
+};
+
+/** @brief The SDMMC_IDMABSIZER register contains the buffers size when in double buffer configuration. */
+static rw_reg32_t const SDMMCx_IDMABSIZER[3] = {
+  [1] = (rw_reg32_t)0x52007054U,
+  [2] = (rw_reg32_t)0x48022454U,
+};
+
+/** @brief The SDMMC_IDMABASE0R register contains the memory buffer base address in single buffer configuration and the buffer 0 base address in double buffer configuration. */
+static rw_reg32_t const SDMMCx_IDMABASE0R[3] = {
+  [1] = (rw_reg32_t)0x52007058U,
+  [2] = (rw_reg32_t)0x48022458U,
+};
+
+/** @brief The SDMMC_IDMABASE1R register contains the double buffer configuration second buffer memory base address. */
+static rw_reg32_t const SDMMCx_IDMABASE1R[3] = {
+  [1] = (rw_reg32_t)0x5200705CU,
+  [2] = (rw_reg32_t)0x4802245CU,
+};
+
+/** @brief The receive and transmit FIFOs can be only read or written as word (32-bit) wide registers. The FIFOs contain 16 entries on sequential addresses. This allows the CPU to use its load and store multiple operands to read from/write to the FIFO.When accessing SDMMC_FIFOR with half word or byte access an AHB bus fault is generated. */
+static rw_reg32_t const SDMMCx_FIFOR[3] = {
+  [1] = (rw_reg32_t)0x52007080U,
+  [2] = (rw_reg32_t)0x48022480U,
+};
+
+/** @brief SDMMC command response register. */
+static ro_reg32_t const SDMMCx_RESPCMDR[3] = {
+  [1] = (ro_reg32_t)0x52007010U,
+  [2] = (ro_reg32_t)0x48022410U,
+};
+
+/** @subsection SDMMCx Register Field Definitions */
+
+static const field32_t SDMMCx_POWER_PWRCTRL       = {.msk = 0x00000003U, .pos = 0};  /** @brief SDMMC state control bits. These bits can only be written when the SDMMC is not in the power-on state (PWRCTRL?11). These bits are used to define the functional state of the SDMMC signals: Any further write will be ignored, PWRCTRL value will keep 11. */
+static const field32_t SDMMCx_POWER_VSWITCH       = {.msk = 0x00000004U, .pos = 2};  /** @brief Voltage switch sequence start. This bit is used to start the timing critical section of the voltage switch sequence:. */
+static const field32_t SDMMCx_POWER_VSWITCHEN     = {.msk = 0x00000008U, .pos = 3};  /** @brief Voltage switch procedure enable. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). This bit is used to stop the SDMMC_CK after the voltage switch command response:. */
+static const field32_t SDMMCx_POWER_DIRPOL        = {.msk = 0x00000010U, .pos = 4};  /** @brief Data and command direction signals polarity selection. This bit can only be written when the SDMMC is in the power-off state (PWRCTRL = 00). */
+static const field32_t SDMMCx_CLKCR_CLKDIV        = {.msk = 0x000003FFU, .pos = 0};  /** @brief Clock divide factor This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0). This field defines the divide factor between the input clock (SDMMCCLK) and the output clock (SDMMC_CK): SDMMC_CK frequency = SDMMCCLK / [2 * CLKDIV]. 0xx: etc.. xxx: etc.. */
+static const field32_t SDMMCx_CLKCR_PWRSAV        = {.msk = 0x00001000U, .pos = 12}; /** @brief Power saving configuration bit This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0) For power saving, the SDMMC_CK clock output can be disabled when the bus is idle by setting PWRSAV:. */
+static const field32_t SDMMCx_CLKCR_WIDBUS        = {.msk = 0x0000C000U, .pos = 14}; /** @brief Wide bus mode enable bit This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0). */
+static const field32_t SDMMCx_CLKCR_NEGEDGE       = {.msk = 0x00010000U, .pos = 16}; /** @brief SDMMC_CK dephasing selection bit for data and Command. This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0). When clock division = 1 (CLKDIV = 0), this bit has no effect. Data and Command change on SDMMC_CK falling edge. When clock division &gt;1 (CLKDIV &gt; 0) &amp; DDR = 0: - SDMMC_CK edge occurs on SDMMCCLK rising edge. When clock division >1 (CLKDIV > 0) & DDR = 1: - Data changed on the SDMMCCLK falling edge succeeding a SDMMC_CK edge. - SDMMC_CK edge occurs on SDMMCCLK rising edge. - Data changed on the SDMMC_CK falling edge succeeding a SDMMC_CK edge. - SDMMC_CK edge occurs on SDMMCCLK rising edge. */
+static const field32_t SDMMCx_CLKCR_HWFC_EN       = {.msk = 0x00020000U, .pos = 17}; /** @brief Hardware flow control enable This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0) When Hardware flow control is enabled, the meaning of the TXFIFOE and RXFIFOF flags change, please see SDMMC status register definition in Section56.8.11. */
+static const field32_t SDMMCx_CLKCR_DDR           = {.msk = 0x00040000U, .pos = 18}; /** @brief Data rate signaling selection This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0) DDR rate shall only be selected with 4-bit or 8-bit wide bus mode. (WIDBUS &gt; 00). DDR = 1 has no effect when WIDBUS = 00 (1-bit wide bus). DDR rate shall only be selected with clock division &gt;1. (CLKDIV &gt; 0). */
+static const field32_t SDMMCx_CLKCR_BUSSPEED      = {.msk = 0x00080000U, .pos = 19}; /** @brief Bus speed mode selection between DS, HS, SDR12, SDR25 and SDR50, DDR50, SDR104. This bit can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0). */
+static const field32_t SDMMCx_CLKCR_SELCLKRX      = {.msk = 0x00300000U, .pos = 20}; /** @brief Receive clock selection. These bits can only be written when the CPSM and DPSM are not active (CPSMACT = 0 and DPSMACT = 0). */
+static const field32_t SDMMCx_CMDR_CMDINDEX       = {.msk = 0x0000003FU, .pos = 0};  /** @brief Command index. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). The command index is sent to the card as part of a command message. */
+static const field32_t SDMMCx_CMDR_CMDTRANS       = {.msk = 0x00000040U, .pos = 6};  /** @brief The CPSM treats the command as a data transfer command, stops the interrupt period, and signals DataEnable to the DPSM This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). If this bit is set, the CPSM issues an end of interrupt period and issues DataEnable signal to the DPSM when the command is sent. */
+static const field32_t SDMMCx_CMDR_CMDSTOP        = {.msk = 0x00000080U, .pos = 7};  /** @brief The CPSM treats the command as a Stop Transmission command and signals Abort to the DPSM. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). If this bit is set, the CPSM issues the Abort signal to the DPSM when the command is sent. */
+static const field32_t SDMMCx_CMDR_WAITRESP       = {.msk = 0x00000300U, .pos = 8};  /** @brief Wait for response bits. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). They are used to configure whether the CPSM is to wait for a response, and if yes, which kind of response. */
+static const field32_t SDMMCx_CMDR_WAITINT        = {.msk = 0x00000400U, .pos = 10}; /** @brief CPSM waits for interrupt request. If this bit is set, the CPSM disables command timeout and waits for an card interrupt request (Response). If this bit is cleared in the CPSM Wait state, will cause the abort of the interrupt mode. */
+static const field32_t SDMMCx_CMDR_WAITPEND       = {.msk = 0x00000800U, .pos = 11}; /** @brief CPSM Waits for end of data transfer (CmdPend internal signal) from DPSM. This bit when set, the CPSM waits for the end of data transfer trigger before it starts sending a command. WAITPEND is only taken into account when DTMODE = MMC stream data transfer, WIDBUS = 1-bit wide bus mode, DPSMACT = 1 and DTDIR = from host to card. */
+static const field32_t SDMMCx_CMDR_CPSMEN         = {.msk = 0x00001000U, .pos = 12}; /** @brief Command path state machine (CPSM) Enable bit This bit is written 1 by firmware, and cleared by hardware when the CPSM enters the Idle state. If this bit is set, the CPSM is enabled. When DTEN = 1, no command will be transfered nor boot procedure will be started. CPSMEN is cleared to 0. */
+static const field32_t SDMMCx_CMDR_DTHOLD         = {.msk = 0x00002000U, .pos = 13}; /** @brief Hold new data block transmission and reception in the DPSM. If this bit is set, the DPSM will not move from the Wait_S state to the Send state or from the Wait_R state to the Receive state. */
+static const field32_t SDMMCx_CMDR_BOOTMODE       = {.msk = 0x00004000U, .pos = 14}; /** @brief Select the boot mode procedure to be used. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). */
+static const field32_t SDMMCx_CMDR_BOOTEN         = {.msk = 0x00008000U, .pos = 15}; /** @brief Enable boot mode procedure. */
+static const field32_t SDMMCx_CMDR_CMDSUSPEND     = {.msk = 0x00010000U, .pos = 16}; /** @brief The CPSM treats the command as a Suspend or Resume command and signals interrupt period start/end. This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). CMDSUSPEND = 1 and CMDTRANS = 0 Suspend command, start interrupt period when response bit BS=0. CMDSUSPEND = 1 and CMDTRANS = 1 Resume command with data, end interrupt period when response bit DF=1. */
+static const field32_t SDMMCx_DLENR_DATALENGTH    = {.msk = 0x01FFFFFFU, .pos = 0};  /** @brief Data length value This register can only be written by firmware when DPSM is inactive (DPSMACT = 0). Number of data bytes to be transferred. When DDR = 1 DATALENGTH is truncated to a multiple of 2. (The last odd byte is not transfered) When DATALENGTH = 0 no data will be transfered, when requested by a CPSMEN and CMDTRANS = 1 also no command will be transfered. DTEN and CPSMEN are cleared to 0. */
+static const field32_t SDMMCx_DCTRL_DTEN          = {.msk = 0x00000001U, .pos = 0};  /** @brief Data transfer enable bit This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). This bit is cleared by Hardware when data transfer completes. This bit shall only be used to transfer data when no associated data transfer command is used, i.e. shall not be used with SD or eMMC cards. */
+static const field32_t SDMMCx_DCTRL_DTDIR         = {.msk = 0x00000002U, .pos = 1};  /** @brief Data transfer direction selection This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_DCTRL_DTMODE        = {.msk = 0x0000000CU, .pos = 2};  /** @brief Data transfer mode selection. This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_DCTRL_DBLOCKSIZE    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Data block size This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). Define the data block length when the block data transfer mode is selected: When DATALENGTH is not a multiple of DBLOCKSIZE, the transfered data is truncated at a multiple of DBLOCKSIZE. (Any remain data will not be transfered.) When DDR = 1, DBLOCKSIZE = 0000 shall not be used. (No data will be transfered). */
+static const field32_t SDMMCx_DCTRL_RWSTART       = {.msk = 0x00000100U, .pos = 8};  /** @brief Read wait start. If this bit is set, read wait operation starts. */
+static const field32_t SDMMCx_DCTRL_RWSTOP        = {.msk = 0x00000200U, .pos = 9};  /** @brief Read wait stop This bit is written by firmware and auto cleared by hardware when the DPSM moves from the READ_WAIT state to the WAIT_R or IDLE state. */
+static const field32_t SDMMCx_DCTRL_RWMOD         = {.msk = 0x00000400U, .pos = 10}; /** @brief Read wait mode. This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_DCTRL_SDIOEN        = {.msk = 0x00000800U, .pos = 11}; /** @brief SD I/O interrupt enable functions This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). If this bit is set, the DPSM enables the SD I/O card specific interrupt operation. */
+static const field32_t SDMMCx_DCTRL_BOOTACKEN     = {.msk = 0x00001000U, .pos = 12}; /** @brief Enable the reception of the boot acknowledgment. This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_DCTRL_FIFORST       = {.msk = 0x00002000U, .pos = 13}; /** @brief FIFO reset, will flush any remaining data. This bit can only be written by firmware when IDMAEN= 0 and DPSM is active (DPSMACT = 1). This bit will only take effect when a transfer error or transfer hold occurs. */
+static const field32_t SDMMCx_DCNTR_DATACOUNT     = {.msk = 0x01FFFFFFU, .pos = 0};  /** @brief Data count value When read, the number of remaining data bytes to be transferred is returned. Write has no effect. */
+static const field32_t SDMMCx_STAR_CCRCFAIL       = {.msk = 0x00000001U, .pos = 0};  /** @brief Command response received (CRC check failed). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DCRCFAIL       = {.msk = 0x00000002U, .pos = 1};  /** @brief Data block sent/received (CRC check failed). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_CTIMEOUT       = {.msk = 0x00000004U, .pos = 2};  /** @brief Command response timeout. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. The Command Timeout period has a fixed value of 64 SDMMC_CK clock periods. */
+static const field32_t SDMMCx_STAR_DTIMEOUT       = {.msk = 0x00000008U, .pos = 3};  /** @brief Data timeout. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_TXUNDERR       = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit FIFO underrun error or IDMA read transfer error. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_RXOVERR        = {.msk = 0x00000020U, .pos = 5};  /** @brief Received FIFO overrun error or IDMA write transfer error. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_CMDREND        = {.msk = 0x00000040U, .pos = 6};  /** @brief Command response received (CRC check passed, or no CRC). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_CMDSENT        = {.msk = 0x00000080U, .pos = 7};  /** @brief Command sent (no response required). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DATAEND        = {.msk = 0x00000100U, .pos = 8};  /** @brief Data transfer ended correctly. (data counter, DATACOUNT is zero and no errors occur). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DHOLD          = {.msk = 0x00000200U, .pos = 9};  /** @brief Data transfer Hold. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DBCKEND        = {.msk = 0x00000400U, .pos = 10}; /** @brief Data block sent/received. (CRC check passed) and DPSM moves to the READWAIT state. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DABORT         = {.msk = 0x00000800U, .pos = 11}; /** @brief Data transfer aborted by CMD12. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_DPSMACT        = {.msk = 0x00001000U, .pos = 12}; /** @brief Data path state machine active, i.e. not in Idle state. This is a hardware status flag only, does not generate an interrupt. */
+static const field32_t SDMMCx_STAR_CPSMACT        = {.msk = 0x00002000U, .pos = 13}; /** @brief Command path state machine active, i.e. not in Idle state. This is a hardware status flag only, does not generate an interrupt. */
+static const field32_t SDMMCx_STAR_TXFIFOHE       = {.msk = 0x00004000U, .pos = 14}; /** @brief Transmit FIFO half empty At least half the number of words can be written into the FIFO. This bit is cleared when the FIFO becomes half+1 full. */
+static const field32_t SDMMCx_STAR_RXFIFOHF       = {.msk = 0x00008000U, .pos = 15}; /** @brief Receive FIFO half full There are at least half the number of words in the FIFO. This bit is cleared when the FIFO becomes half+1 empty. */
+static const field32_t SDMMCx_STAR_TXFIFOF        = {.msk = 0x00010000U, .pos = 16}; /** @brief Transmit FIFO full This is a hardware status flag only, does not generate an interrupt. This bit is cleared when one FIFO location becomes empty. */
+static const field32_t SDMMCx_STAR_RXFIFOF        = {.msk = 0x00020000U, .pos = 17}; /** @brief Receive FIFO full This bit is cleared when one FIFO location becomes empty. */
+static const field32_t SDMMCx_STAR_TXFIFOE        = {.msk = 0x00040000U, .pos = 18}; /** @brief Transmit FIFO empty This bit is cleared when one FIFO location becomes full. */
+static const field32_t SDMMCx_STAR_RXFIFOE        = {.msk = 0x00080000U, .pos = 19}; /** @brief Receive FIFO empty This is a hardware status flag only, does not generate an interrupt. This bit is cleared when one FIFO location becomes full. */
+static const field32_t SDMMCx_STAR_BUSYD0         = {.msk = 0x00100000U, .pos = 20}; /** @brief Inverted value of SDMMC_D0 line (Busy), sampled at the end of a CMD response and a second time 2 SDMMC_CK cycles after the CMD response. This bit is reset to not busy when the SDMMCD0 line changes from busy to not busy. This bit does not signal busy due to data transfer. This is a hardware status flag only, it does not generate an interrupt. */
+static const field32_t SDMMCx_STAR_BUSYD0END      = {.msk = 0x00200000U, .pos = 21}; /** @brief End of SDMMC_D0 Busy following a CMD response detected. This indicates only end of busy following a CMD response. This bit does not signal busy due to data transfer. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_SDIOIT         = {.msk = 0x00400000U, .pos = 22}; /** @brief SDIO interrupt received. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_ACKFAIL        = {.msk = 0x00800000U, .pos = 23}; /** @brief Boot acknowledgment received (boot acknowledgment check fail). Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_ACKTIMEOUT     = {.msk = 0x01000000U, .pos = 24}; /** @brief Boot acknowledgment timeout. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_VSWEND         = {.msk = 0x02000000U, .pos = 25}; /** @brief Voltage switch critical timing section completion. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_CKSTOP         = {.msk = 0x04000000U, .pos = 26}; /** @brief SDMMC_CK stopped in Voltage switch procedure. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_IDMATE         = {.msk = 0x08000000U, .pos = 27}; /** @brief IDMA transfer error. Interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_STAR_IDMABTC        = {.msk = 0x10000000U, .pos = 28}; /** @brief IDMA buffer transfer complete. interrupt flag is cleared by writing corresponding interrupt clear bit in SDMMC_ICR. */
+static const field32_t SDMMCx_ICR_CCRCFAILC       = {.msk = 0x00000001U, .pos = 0};  /** @brief CCRCFAIL flag clear bit Set by software to clear the CCRCFAIL flag. */
+static const field32_t SDMMCx_ICR_DCRCFAILC       = {.msk = 0x00000002U, .pos = 1};  /** @brief DCRCFAIL flag clear bit Set by software to clear the DCRCFAIL flag. */
+static const field32_t SDMMCx_ICR_CTIMEOUTC       = {.msk = 0x00000004U, .pos = 2};  /** @brief CTIMEOUT flag clear bit Set by software to clear the CTIMEOUT flag. */
+static const field32_t SDMMCx_ICR_DTIMEOUTC       = {.msk = 0x00000008U, .pos = 3};  /** @brief DTIMEOUT flag clear bit Set by software to clear the DTIMEOUT flag. */
+static const field32_t SDMMCx_ICR_TXUNDERRC       = {.msk = 0x00000010U, .pos = 4};  /** @brief TXUNDERR flag clear bit Set by software to clear TXUNDERR flag. */
+static const field32_t SDMMCx_ICR_RXOVERRC        = {.msk = 0x00000020U, .pos = 5};  /** @brief RXOVERR flag clear bit Set by software to clear the RXOVERR flag. */
+static const field32_t SDMMCx_ICR_CMDRENDC        = {.msk = 0x00000040U, .pos = 6};  /** @brief CMDREND flag clear bit Set by software to clear the CMDREND flag. */
+static const field32_t SDMMCx_ICR_CMDSENTC        = {.msk = 0x00000080U, .pos = 7};  /** @brief CMDSENT flag clear bit Set by software to clear the CMDSENT flag. */
+static const field32_t SDMMCx_ICR_DATAENDC        = {.msk = 0x00000100U, .pos = 8};  /** @brief DATAEND flag clear bit Set by software to clear the DATAEND flag. */
+static const field32_t SDMMCx_ICR_DHOLDC          = {.msk = 0x00000200U, .pos = 9};  /** @brief DHOLD flag clear bit Set by software to clear the DHOLD flag. */
+static const field32_t SDMMCx_ICR_DBCKENDC        = {.msk = 0x00000400U, .pos = 10}; /** @brief DBCKEND flag clear bit Set by software to clear the DBCKEND flag. */
+static const field32_t SDMMCx_ICR_DABORTC         = {.msk = 0x00000800U, .pos = 11}; /** @brief DABORT flag clear bit Set by software to clear the DABORT flag. */
+static const field32_t SDMMCx_ICR_BUSYD0ENDC      = {.msk = 0x00200000U, .pos = 21}; /** @brief BUSYD0END flag clear bit Set by software to clear the BUSYD0END flag. */
+static const field32_t SDMMCx_ICR_SDIOITC         = {.msk = 0x00400000U, .pos = 22}; /** @brief SDIOIT flag clear bit Set by software to clear the SDIOIT flag. */
+static const field32_t SDMMCx_ICR_ACKFAILC        = {.msk = 0x00800000U, .pos = 23}; /** @brief ACKFAIL flag clear bit Set by software to clear the ACKFAIL flag. */
+static const field32_t SDMMCx_ICR_ACKTIMEOUTC     = {.msk = 0x01000000U, .pos = 24}; /** @brief ACKTIMEOUT flag clear bit Set by software to clear the ACKTIMEOUT flag. */
+static const field32_t SDMMCx_ICR_VSWENDC         = {.msk = 0x02000000U, .pos = 25}; /** @brief VSWEND flag clear bit Set by software to clear the VSWEND flag. */
+static const field32_t SDMMCx_ICR_CKSTOPC         = {.msk = 0x04000000U, .pos = 26}; /** @brief CKSTOP flag clear bit Set by software to clear the CKSTOP flag. */
+static const field32_t SDMMCx_ICR_IDMATEC         = {.msk = 0x08000000U, .pos = 27}; /** @brief IDMA transfer error clear bit Set by software to clear the IDMATE flag. */
+static const field32_t SDMMCx_ICR_IDMABTCC        = {.msk = 0x10000000U, .pos = 28}; /** @brief IDMA buffer transfer complete clear bit Set by software to clear the IDMABTC flag. */
+static const field32_t SDMMCx_MASKR_CCRCFAILIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief Command CRC fail interrupt enable Set and cleared by software to enable/disable interrupt caused by command CRC failure. */
+static const field32_t SDMMCx_MASKR_DCRCFAILIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief Data CRC fail interrupt enable Set and cleared by software to enable/disable interrupt caused by data CRC failure. */
+static const field32_t SDMMCx_MASKR_CTIMEOUTIE    = {.msk = 0x00000004U, .pos = 2};  /** @brief Command timeout interrupt enable Set and cleared by software to enable/disable interrupt caused by command timeout. */
+static const field32_t SDMMCx_MASKR_DTIMEOUTIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Data timeout interrupt enable Set and cleared by software to enable/disable interrupt caused by data timeout. */
+static const field32_t SDMMCx_MASKR_TXUNDERRIE    = {.msk = 0x00000010U, .pos = 4};  /** @brief Tx FIFO underrun error interrupt enable Set and cleared by software to enable/disable interrupt caused by Tx FIFO underrun error. */
+static const field32_t SDMMCx_MASKR_RXOVERRIE     = {.msk = 0x00000020U, .pos = 5};  /** @brief Rx FIFO overrun error interrupt enable Set and cleared by software to enable/disable interrupt caused by Rx FIFO overrun error. */
+static const field32_t SDMMCx_MASKR_CMDRENDIE     = {.msk = 0x00000040U, .pos = 6};  /** @brief Command response received interrupt enable Set and cleared by software to enable/disable interrupt caused by receiving command response. */
+static const field32_t SDMMCx_MASKR_CMDSENTIE     = {.msk = 0x00000080U, .pos = 7};  /** @brief Command sent interrupt enable Set and cleared by software to enable/disable interrupt caused by sending command. */
+static const field32_t SDMMCx_MASKR_DATAENDIE     = {.msk = 0x00000100U, .pos = 8};  /** @brief Data end interrupt enable Set and cleared by software to enable/disable interrupt caused by data end. */
+static const field32_t SDMMCx_MASKR_DHOLDIE       = {.msk = 0x00000200U, .pos = 9};  /** @brief Data hold interrupt enable Set and cleared by software to enable/disable the interrupt generated when sending new data is hold in the DPSM Wait_S state. */
+static const field32_t SDMMCx_MASKR_DBCKENDIE     = {.msk = 0x00000400U, .pos = 10}; /** @brief Data block end interrupt enable Set and cleared by software to enable/disable interrupt caused by data block end. */
+static const field32_t SDMMCx_MASKR_DABORTIE      = {.msk = 0x00000800U, .pos = 11}; /** @brief Data transfer aborted interrupt enable Set and cleared by software to enable/disable interrupt caused by a data transfer being aborted. */
+static const field32_t SDMMCx_MASKR_TXFIFOHEIE    = {.msk = 0x00004000U, .pos = 14}; /** @brief Tx FIFO half empty interrupt enable Set and cleared by software to enable/disable interrupt caused by Tx FIFO half empty. */
+static const field32_t SDMMCx_MASKR_RXFIFOHFIE    = {.msk = 0x00008000U, .pos = 15}; /** @brief Rx FIFO half full interrupt enable Set and cleared by software to enable/disable interrupt caused by Rx FIFO half full. */
+static const field32_t SDMMCx_MASKR_RXFIFOFIE     = {.msk = 0x00020000U, .pos = 17}; /** @brief Rx FIFO full interrupt enable Set and cleared by software to enable/disable interrupt caused by Rx FIFO full. */
+static const field32_t SDMMCx_MASKR_TXFIFOEIE     = {.msk = 0x00040000U, .pos = 18}; /** @brief Tx FIFO empty interrupt enable Set and cleared by software to enable/disable interrupt caused by Tx FIFO empty. */
+static const field32_t SDMMCx_MASKR_BUSYD0ENDIE   = {.msk = 0x00200000U, .pos = 21}; /** @brief BUSYD0END interrupt enable Set and cleared by software to enable/disable the interrupt generated when SDMMC_D0 signal changes from busy to NOT busy following a CMD response. */
+static const field32_t SDMMCx_MASKR_SDIOITIE      = {.msk = 0x00400000U, .pos = 22}; /** @brief SDIO mode interrupt received interrupt enable Set and cleared by software to enable/disable the interrupt generated when receiving the SDIO mode interrupt. */
+static const field32_t SDMMCx_MASKR_ACKFAILIE     = {.msk = 0x00800000U, .pos = 23}; /** @brief Acknowledgment Fail interrupt enable Set and cleared by software to enable/disable interrupt caused by acknowledgment Fail. */
+static const field32_t SDMMCx_MASKR_ACKTIMEOUTIE  = {.msk = 0x01000000U, .pos = 24}; /** @brief Acknowledgment timeout interrupt enable Set and cleared by software to enable/disable interrupt caused by acknowledgment timeout. */
+static const field32_t SDMMCx_MASKR_VSWENDIE      = {.msk = 0x02000000U, .pos = 25}; /** @brief Voltage switch critical timing section completion interrupt enable Set and cleared by software to enable/disable the interrupt generated when voltage switch critical timing section completion. */
+static const field32_t SDMMCx_MASKR_CKSTOPIE      = {.msk = 0x04000000U, .pos = 26}; /** @brief Voltage Switch clock stopped interrupt enable Set and cleared by software to enable/disable interrupt caused by Voltage Switch clock stopped. */
+static const field32_t SDMMCx_MASKR_IDMABTCIE     = {.msk = 0x10000000U, .pos = 28}; /** @brief IDMA buffer transfer complete interrupt enable Set and cleared by software to enable/disable the interrupt generated when the IDMA has transferred all data belonging to a memory buffer. */
+static const field32_t SDMMCx_ACKTIMER_ACKTIME    = {.msk = 0x01FFFFFFU, .pos = 0};  /** @brief Boot acknowledgment timeout period This bit can only be written by firmware when CPSM is disabled (CPSMEN = 0). Boot acknowledgment timeout period expressed in card bus clock periods. */
+static const field32_t SDMMCx_IDMACTRLR_IDMAEN    = {.msk = 0x00000001U, .pos = 0};  /** @brief IDMA enable This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_IDMACTRLR_IDMABMODE = {.msk = 0x00000002U, .pos = 1};  /** @brief Buffer mode selection. This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_IDMACTRLR_IDMABACT  = {.msk = 0x00000004U, .pos = 2};  /** @brief Double buffer mode active buffer indication This bit can only be written by firmware when DPSM is inactive (DPSMACT = 0). When IDMA is enabled this bit is toggled by hardware. */
+static const field32_t SDMMCx_IDMABSIZER_IDMABNDT = {.msk = 0x00001FE0U, .pos = 5};  /** @brief Number of transfers per buffer. This 8-bit value shall be multiplied by 8 to get the size of the buffer in 32-bit words and by 32 to get the size of the buffer in bytes. Example: IDMABNDT = 0x01: buffer size = 8 words = 32 bytes. These bits can only be written by firmware when DPSM is inactive (DPSMACT = 0). */
+static const field32_t SDMMCx_RESPCMDR_RESPCMD    = {.msk = 0x0000003FU, .pos = 0};  /** @brief Response command index. */
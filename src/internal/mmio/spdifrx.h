@@ -0,0 +1,116 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/spdifrx.h
+ * @authors UW SARP
+ * @brief Registers and fields of SPDIFRX.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SPDIFRX Definitions
+ **************************************************************************************************/
+
+/** @subsection SPDIFRX Register Definitions */
+
+static rw_reg32_t const SPDIFRX_CR    = (rw_reg32_t)0x40004000U; /** @brief Control register. */
+static rw_reg32_t const SPDIFRX_IMR   = (rw_reg32_t)0x40004004U; /** @brief Interrupt mask register. */
+static ro_reg32_t const SPDIFRX_SR    = (ro_reg32_t)0x40004008U; /** @brief Status register. */
+static rw_reg32_t const SPDIFRX_IFCR  = (rw_reg32_t)0x4000400CU; /** @brief Interrupt Flag Clear register. */
+static ro_reg32_t const SPDIFRX_DR_00 = (ro_reg32_t)0x40004010U; /** @brief Data input register. */
+static ro_reg32_t const SPDIFRX_CSR   = (ro_reg32_t)0x40004014U; /** @brief Channel Status register. */
+static ro_reg32_t const SPDIFRX_DIR   = (ro_reg32_t)0x40004018U; /** @brief Debug Information register. */
+static ro_reg32_t const SPDIFRX_VERR  = (ro_reg32_t)0x400043F4U; /** @brief SPDIFRX version register. */
+static ro_reg32_t const SPDIFRX_IDR   = (ro_reg32_t)0x400043F8U; /** @brief SPDIFRX identification register. */
+static ro_reg32_t const SPDIFRX_SIDR  = (ro_reg32_t)0x400043FCU; /** @brief SPDIFRX size identification register. */
+static ro_reg32_t const SPDIFRX_DR_01 = (ro_reg32_t)0x40004010U; /** @brief Data input register. */
+static ro_reg32_t const SPDIFRX_DR_10 = (ro_reg32_t)0x40004010U; /** @brief Data input register. */
+
+/** @subsection SPDIFRX Register Field Definitions */
+
+static const field32_t SPDIFRX_CR_SPDIFRXEN = {.msk = 0x00000003U, .pos = 0};  /** @brief Peripheral Block Enable. */
+static const field32_t SPDIFRX_CR_RXDMAEN   = {.msk = 0x00000004U, .pos = 2};  /** @brief Receiver DMA ENable for data flow. */
+static const field32_t SPDIFRX_CR_RXSTEO    = {.msk = 0x00000008U, .pos = 3};  /** @brief STerEO Mode. */
+static const field32_t SPDIFRX_CR_DRFMT     = {.msk = 0x00000030U, .pos = 4};  /** @brief RX Data format. */
+static const field32_t SPDIFRX_CR_PMSK      = {.msk = 0x00000040U, .pos = 6};  /** @brief Mask Parity error bit. */
+static const field32_t SPDIFRX_CR_VMSK      = {.msk = 0x00000080U, .pos = 7};  /** @brief Mask of Validity bit. */
+static const field32_t SPDIFRX_CR_CUMSK     = {.msk = 0x00000100U, .pos = 8};  /** @brief Mask of channel status and user bits. */
+static const field32_t SPDIFRX_CR_PTMSK     = {.msk = 0x00000200U, .pos = 9};  /** @brief Mask of Preamble Type bits. */
+static const field32_t SPDIFRX_CR_CBDMAEN   = {.msk = 0x00000400U, .pos = 10}; /** @brief Control Buffer DMA ENable for control flow. */
+static const field32_t SPDIFRX_CR_CHSEL     = {.msk = 0x00000800U, .pos = 11}; /** @brief Channel Selection. */
+static const field32_t SPDIFRX_CR_NBTR      = {.msk = 0x00003000U, .pos = 12}; /** @brief Maximum allowed re-tries during synchronization phase. */
+static const field32_t SPDIFRX_CR_WFA       = {.msk = 0x00004000U, .pos = 14}; /** @brief Wait For Activity. */
+static const field32_t SPDIFRX_CR_INSEL     = {.msk = 0x00070000U, .pos = 16}; /** @brief Input selection. */
+static const field32_t SPDIFRX_CR_CKSEN     = {.msk = 0x00100000U, .pos = 20}; /** @brief Symbol Clock Enable. */
+static const field32_t SPDIFRX_CR_CKSBKPEN  = {.msk = 0x00200000U, .pos = 21}; /** @brief Backup Symbol Clock Enable. */
+static const field32_t SPDIFRX_IMR_RXNEIE   = {.msk = 0x00000001U, .pos = 0};  /** @brief RXNE interrupt enable. */
+static const field32_t SPDIFRX_IMR_CSRNEIE  = {.msk = 0x00000002U, .pos = 1};  /** @brief Control Buffer Ready Interrupt Enable. */
+static const field32_t SPDIFRX_IMR_PERRIE   = {.msk = 0x00000004U, .pos = 2};  /** @brief Parity error interrupt enable. */
+static const field32_t SPDIFRX_IMR_OVRIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Overrun error Interrupt Enable. */
+static const field32_t SPDIFRX_IMR_SBLKIE   = {.msk = 0x00000010U, .pos = 4};  /** @brief Synchronization Block Detected Interrupt Enable. */
+static const field32_t SPDIFRX_IMR_SYNCDIE  = {.msk = 0x00000020U, .pos = 5};  /** @brief Synchronization Done. */
+static const field32_t SPDIFRX_IMR_IFEIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief Serial Interface Error Interrupt Enable. */
+static const field32_t SPDIFRX_SR_RXNE      = {.msk = 0x00000001U, .pos = 0};  /** @brief Read data register not empty. */
+static const field32_t SPDIFRX_SR_CSRNE     = {.msk = 0x00000002U, .pos = 1};  /** @brief Control Buffer register is not empty. */
+static const field32_t SPDIFRX_SR_PERR      = {.msk = 0x00000004U, .pos = 2};  /** @brief Parity error. */
+static const field32_t SPDIFRX_SR_OVR       = {.msk = 0x00000008U, .pos = 3};  /** @brief Overrun error. */
+static const field32_t SPDIFRX_SR_SBD       = {.msk = 0x00000010U, .pos = 4};  /** @brief Synchronization Block Detected. */
+static const field32_t SPDIFRX_SR_SYNCD     = {.msk = 0x00000020U, .pos = 5};  /** @brief Synchronization Done. */
+static const field32_t SPDIFRX_SR_FERR      = {.msk = 0x00000040U, .pos = 6};  /** @brief Framing error. */
+static const field32_t SPDIFRX_SR_SERR      = {.msk = 0x00000080U, .pos = 7};  /** @brief Synchronization error. */
+static const field32_t SPDIFRX_SR_TERR      = {.msk = 0x00000100U, .pos = 8};  /** @brief Time-out error. */
+static const field32_t SPDIFRX_SR_WIDTH5    = {.msk = 0x7FFF0000U, .pos = 16}; /** @brief Duration of 5 symbols counted with SPDIF_CLK. */
+static const field32_t SPDIFRX_IFCR_PERRCF  = {.msk = 0x00000004U, .pos = 2};  /** @brief Clears the Parity error flag. */
+static const field32_t SPDIFRX_IFCR_OVRCF   = {.msk = 0x00000008U, .pos = 3};  /** @brief Clears the Overrun error flag. */
+static const field32_t SPDIFRX_IFCR_SBDCF   = {.msk = 0x00000010U, .pos = 4};  /** @brief Clears the Synchronization Block Detected flag. */
+static const field32_t SPDIFRX_IFCR_SYNCDCF = {.msk = 0x00000020U, .pos = 5};  /** @brief Clears the Synchronization Done flag. */
+static const field32_t SPDIFRX_DR_00_DR     = {.msk = 0x00FFFFFFU, .pos = 0};  /** @brief Parity Error bit. */
+static const field32_t SPDIFRX_DR_00_PE     = {.msk = 0x01000000U, .pos = 24}; /** @brief Parity Error bit. */
+static const field32_t SPDIFRX_DR_00_V      = {.msk = 0x02000000U, .pos = 25}; /** @brief Validity bit. */
+static const field32_t SPDIFRX_DR_00_U      = {.msk = 0x04000000U, .pos = 26}; /** @brief User bit. */
+static const field32_t SPDIFRX_DR_00_C      = {.msk = 0x08000000U, .pos = 27}; /** @brief Channel Status bit. */
+static const field32_t SPDIFRX_DR_00_PT     = {.msk = 0x30000000U, .pos = 28}; /** @brief Preamble Type. */
+static const field32_t SPDIFRX_CSR_USR      = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief User data information. */
+static const field32_t SPDIFRX_CSR_CS       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Channel A status information. */
+static const field32_t SPDIFRX_CSR_SOB      = {.msk = 0x01000000U, .pos = 24}; /** @brief Start Of Block. */
+static const field32_t SPDIFRX_DIR_THI      = {.msk = 0x00001FFFU, .pos = 0};  /** @brief Threshold HIGH. */
+static const field32_t SPDIFRX_DIR_TLO      = {.msk = 0x1FFF0000U, .pos = 16}; /** @brief Threshold LOW. */
+static const field32_t SPDIFRX_VERR_MINREV  = {.msk = 0x0000000FU, .pos = 0};  /** @brief Minor revision. */
+static const field32_t SPDIFRX_VERR_MAJREV  = {.msk = 0x000000F0U, .pos = 4};  /** @brief Major revision. */
+static const field32_t SPDIFRX_DR_01_PE     = {.msk = 0x00000001U, .pos = 0};  /** @brief Parity Error bit. */
+static const field32_t SPDIFRX_DR_01_V      = {.msk = 0x00000002U, .pos = 1};  /** @brief Validity bit. */
+static const field32_t SPDIFRX_DR_01_U      = {.msk = 0x00000004U, .pos = 2};  /** @brief User bit. */
+static const field32_t SPDIFRX_DR_01_C      = {.msk = 0x00000008U, .pos = 3};  /** @brief Channel Status bit. */
+static const field32_t SPDIFRX_DR_01_PT     = {.msk = 0x00000030U, .pos = 4};  /** @brief Preamble Type. */
+static const field32_t SPDIFRX_DR_01_DR     = {.msk = 0xFFFFFF00U, .pos = 8};  /** @brief Data value. */
+static const field32_t SPDIFRX_DR_10_DRNL1  = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Data value. */
+static const field32_t SPDIFRX_DR_10_DRNL2  = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Data value. */
+
+/** @subsection Enumerated SPDIFRX Register Field Definitions */
+
+/** @brief Data value. */
+static const field32_t SPDIFRX_DR_10_DRNLx[3] = {
+  [1] = {.msk = 0x0000FFFFU, .pos = 0},
+  [2] = {.msk = 0xFFFF0000U, .pos = 16},
+};
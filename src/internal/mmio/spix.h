@@ -0,0 +1,262 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/spix.h
+ * @authors UW SARP
+ * @brief Registers and fields of SPI1, SPI2, SPI3, SPI4, SPI5, SPI6.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SPIx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated SPIx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const SPIx_CR1[7] = {
+  [1] = (rw_reg32_t)0x40013000U,
+  [2] = (rw_reg32_t)0x40003800U,
+  [3] = (rw_reg32_t)0x40003C00U,
+  [4] = (rw_reg32_t)0x40013400U,
+  [5] = (rw_reg32_t)0x40015000U,
+  [6] = (rw_reg32_t)0x58001400U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const SPIx_CR2[7] = {
+  [1] = (rw_reg32_t)0x40013004U,
+  [2] = (rw_reg32_t)0x40003804U,
+  [3] = (rw_reg32_t)0x40003C04U,
+  [4] = (rw_reg32_t)0x40013404U,
+  [5] = (rw_reg32_t)0x40015004U,
+  [6] = (rw_reg32_t)0x58001404U,
+};
+
+/** @brief Configuration register 1. */
+static rw_reg32_t const SPIx_CFG1[7] = {
+  [1] = (rw_reg32_t)0x40013008U,
+  [2] = (rw_reg32_t)0x40003808U,
+  [3] = (rw_reg32_t)0x40003C08U,
+  [4] = (rw_reg32_t)0x40013408U,
+  [5] = (rw_reg32_t)0x40015008U,
+  [6] = (rw_reg32_t)0x58001408U,
+};
+
+/** @brief Configuration register 2. */
+static rw_reg32_t const SPIx_CFG2[7] = {
+  [1] = (rw_reg32_t)0x4001300CU,
+  [2] = (rw_reg32_t)0x4000380CU,
+  [3] = (rw_reg32_t)0x40003C0CU,
+  [4] = (rw_reg32_t)0x4001340CU,
+  [5] = (rw_reg32_t)0x4001500CU,
+  [6] = (rw_reg32_t)0x5800140CU,
+};
+
+/** @brief Interrupt Enable Register. */
+static rw_reg32_t const SPIx_IER[7] = {
+  [1] = (rw_reg32_t)0x40013010U,
+  [2] = (rw_reg32_t)0x40003810U,
+  [3] = (rw_reg32_t)0x40003C10U,
+  [4] = (rw_reg32_t)0x40013410U,
+  [5] = (rw_reg32_t)0x40015010U,
+  [6] = (rw_reg32_t)0x58001410U,
+};
+
+/** @brief Status Register. */
+static ro_reg32_t const SPIx_SR[7] = {
+  [1] = (ro_reg32_t)0x40013014U,
+  [2] = (ro_reg32_t)0x40003814U,
+  [3] = (ro_reg32_t)0x40003C14U,
+  [4] = (ro_reg32_t)0x40013414U,
+  [5] = (ro_reg32_t)0x40015014U,
+  [6] = (ro_reg32_t)0x58001414U,
+};
+
+/** @brief Interrupt/Status Flags Clear Register. */
+static rw_reg32_t const SPIx_IFCR[7] = {
+  [1] = (rw_reg32_t)0x40013018U,
+  [2] = (rw_reg32_t)0x40003818U,
+  [3] = (rw_reg32_t)0x40003C18U,
+  [4] = (rw_reg32_t)0x40013418U,
+  [5] = (rw_reg32_t)0x40015018U,
+  [6] = (rw_reg32_t)0x58001418U,
+};
+
+/** @brief Transmit Data Register. */
+static rw_reg32_t const SPIx_TXDR[7] = {
+  [1] = (rw_reg32_t)0x40013020U,
+  [2] = (rw_reg32_t)0x40003820U,
+  [3] = (rw_reg32_t)0x40003C20U,
+  [4] = (rw_reg32_t)0x40013420U,
+  [5] = (rw_reg32_t)0x40015020U,
+  [6] = (rw_reg32_t)0x58001420U,
+};
+
+/** @brief Receive Data Register. */
+static ro_reg32_t const SPIx_RXDR[7] = {
+  [1] = (ro_reg32_t)0x40013030U,
+  [2] = (ro_reg32_t)0x40003830U,
+  [3] = (ro_reg32_t)0x40003C30U,
+  [4] = (ro_reg32_t)0x40013430U,
+  [5] = (ro_reg32_t)0x40015030U,
+  [6] = (ro_reg32_t)0x58001430U,
+};
+
+/** @brief Polynomial Register. */
+static rw_reg32_t const SPIx_CRCPOLY[7] = {
+  [1] = (rw_reg32_t)0x40013040U,
+  [2] = (rw_reg32_t)0x40003840U,
+  [3] = (rw_reg32_t)0x40003C40U,
+  [4] = (rw_reg32_t)0x40013440U,
+  [5] = (rw_reg32_t)0x40015040U,
+  [6] = (rw_reg32_t)0x58001440U,
+};
+
+/** @brief Transmitter CRC Register. */
+static rw_reg32_t const SPIx_TXCRC[7] = {
+  [1] = (rw_reg32_t)0x40013044U,
+  [2] = (rw_reg32_t)0x40003844U,
+  [3] = (rw_reg32_t)0x40003C44U,
+  [4] = (rw_reg32_t)0x40013444U,
+  [5] = (rw_reg32_t)0x40015044U,
+  [6] = (rw_reg32_t)0x58001444U,
+};
+
+/** @brief Receiver CRC Register. */
+static rw_reg32_t const SPIx_RXCRC[7] = {
+  [1] = (rw_reg32_t)0x40013048U,
+  [2] = (rw_reg32_t)0x40003848U,
+  [3] = (rw_reg32_t)0x40003C48U,
+  [4] = (rw_reg32_t)0x40013448U,
+  [5] = (rw_reg32_t)0x40015048U,
+  [6] = (rw_reg32_t)0x58001448U,
+};
+
+/** @brief Underrun Data Register. */
+static rw_reg32_t const SPIx_UDRDR[7] = {
+  [1] = (rw_reg32_t)0x4001304CU,
+  [2] = (rw_reg32_t)0x4000384CU,
+  [3] = (rw_reg32_t)0x40003C4CU,
+  [4] = (rw_reg32_t)0x4001344CU,
+  [5] = (rw_reg32_t)0x4001504CU,
+  [6] = (rw_reg32_t)0x5800144CU,
+};
+
+/** @brief Configuration register. */
+static rw_reg32_t const SPIx_CGFR[7] = {
+  [1] = (rw_reg32_t)0x40013050U,
+  [2] = (rw_reg32_t)0x40003850U,
+  [3] = (rw_reg32_t)0x40003C50U,
+  [4] = (rw_reg32_t)0x40013450U,
+  [5] = (rw_reg32_t)0x40015050U,
+  [6] = (rw_reg32_t)0x58001450U,
+};
+
+/** @subsection SPIx Register Field Definitions */
+
+static const field32_t SPIx_CR1_IOLOCK   = {.msk = 0x00010000U, .pos = 16}; /** @brief Locking the AF configuration of associated IOs. */
+static const field32_t SPIx_CR1_TCRCI    = {.msk = 0x00008000U, .pos = 15}; /** @brief CRC calculation initialization pattern control for transmitter. */
+static const field32_t SPIx_CR1_RCRCI    = {.msk = 0x00004000U, .pos = 14}; /** @brief CRC calculation initialization pattern control for receiver. */
+static const field32_t SPIx_CR1_CRC33_17 = {.msk = 0x00002000U, .pos = 13}; /** @brief 32-bit CRC polynomial configuration. */
+static const field32_t SPIx_CR1_SSI      = {.msk = 0x00001000U, .pos = 12}; /** @brief Internal SS signal input level. */
+static const field32_t SPIx_CR1_HDDIR    = {.msk = 0x00000800U, .pos = 11}; /** @brief Rx/Tx direction at Half-duplex mode. */
+static const field32_t SPIx_CR1_CSUSP    = {.msk = 0x00000400U, .pos = 10}; /** @brief Master SUSPend request. */
+static const field32_t SPIx_CR1_CSTART   = {.msk = 0x00000200U, .pos = 9};  /** @brief Master transfer start. */
+static const field32_t SPIx_CR1_MASRX    = {.msk = 0x00000100U, .pos = 8};  /** @brief Master automatic SUSP in Receive mode. */
+static const field32_t SPIx_CR1_SPE      = {.msk = 0x00000001U, .pos = 0};  /** @brief Serial Peripheral Enable. */
+static const field32_t SPIx_CR2_TSER     = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Number of data transfer extension to be reload into TSIZE just when a previous. */
+static const field32_t SPIx_CR2_TSIZE    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Number of data at current transfer. */
+static const field32_t SPIx_CFG1_MBR     = {.msk = 0x70000000U, .pos = 28}; /** @brief Master baud rate. */
+static const field32_t SPIx_CFG1_CRCEN   = {.msk = 0x00400000U, .pos = 22}; /** @brief Hardware CRC computation enable. */
+static const field32_t SPIx_CFG1_CRCSIZE = {.msk = 0x001F0000U, .pos = 16}; /** @brief Length of CRC frame to be transacted and compared. */
+static const field32_t SPIx_CFG1_TXDMAEN = {.msk = 0x00008000U, .pos = 15}; /** @brief Tx DMA stream enable. */
+static const field32_t SPIx_CFG1_RXDMAEN = {.msk = 0x00004000U, .pos = 14}; /** @brief Rx DMA stream enable. */
+static const field32_t SPIx_CFG1_UDRDET  = {.msk = 0x00001800U, .pos = 11}; /** @brief Detection of underrun condition at slave transmitter. */
+static const field32_t SPIx_CFG1_UDRCFG  = {.msk = 0x00000600U, .pos = 9};  /** @brief Behavior of slave transmitter at underrun condition. */
+static const field32_t SPIx_CFG1_FTHVL   = {.msk = 0x000001E0U, .pos = 5};  /** @brief Threshold level. */
+static const field32_t SPIx_CFG1_DSIZE   = {.msk = 0x0000001FU, .pos = 0};  /** @brief Number of bits in at single SPI data frame. */
+static const field32_t SPIx_CFG2_AFCNTR  = {.msk = 0x80000000U, .pos = 31}; /** @brief Alternate function GPIOs control. */
+static const field32_t SPIx_CFG2_SSOM    = {.msk = 0x40000000U, .pos = 30}; /** @brief SS output management in master mode. */
+static const field32_t SPIx_CFG2_SSOE    = {.msk = 0x20000000U, .pos = 29}; /** @brief SS output enable. */
+static const field32_t SPIx_CFG2_SSIOP   = {.msk = 0x10000000U, .pos = 28}; /** @brief SS input/output polarity. */
+static const field32_t SPIx_CFG2_SSM     = {.msk = 0x04000000U, .pos = 26}; /** @brief Software management of SS signal input. */
+static const field32_t SPIx_CFG2_CPOL    = {.msk = 0x02000000U, .pos = 25}; /** @brief Clock polarity. */
+static const field32_t SPIx_CFG2_CPHA    = {.msk = 0x01000000U, .pos = 24}; /** @brief Clock phase. */
+static const field32_t SPIx_CFG2_LSBFRST = {.msk = 0x00800000U, .pos = 23}; /** @brief Data frame format. */
+static const field32_t SPIx_CFG2_MASTER  = {.msk = 0x00400000U, .pos = 22}; /** @brief SPI Master. */
+static const field32_t SPIx_CFG2_SP      = {.msk = 0x00380000U, .pos = 19}; /** @brief Serial Protocol. */
+static const field32_t SPIx_CFG2_COMM    = {.msk = 0x00060000U, .pos = 17}; /** @brief SPI Communication Mode. */
+static const field32_t SPIx_CFG2_IOSWP   = {.msk = 0x00008000U, .pos = 15}; /** @brief Swap functionality of MISO and MOSI pins. */
+static const field32_t SPIx_CFG2_MIDI    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Master Inter-Data Idleness. */
+static const field32_t SPIx_CFG2_MSSI    = {.msk = 0x0000000FU, .pos = 0};  /** @brief Master SS Idleness. */
+static const field32_t SPIx_IER_TSERFIE  = {.msk = 0x00000400U, .pos = 10}; /** @brief Additional number of transactions reload interrupt enable. */
+static const field32_t SPIx_IER_MODFIE   = {.msk = 0x00000200U, .pos = 9};  /** @brief Mode Fault interrupt enable. */
+static const field32_t SPIx_IER_TIFREIE  = {.msk = 0x00000100U, .pos = 8};  /** @brief TIFRE interrupt enable. */
+static const field32_t SPIx_IER_CRCEIE   = {.msk = 0x00000080U, .pos = 7};  /** @brief CRC Interrupt enable. */
+static const field32_t SPIx_IER_OVRIE    = {.msk = 0x00000040U, .pos = 6};  /** @brief OVR interrupt enable. */
+static const field32_t SPIx_IER_UDRIE    = {.msk = 0x00000020U, .pos = 5};  /** @brief UDR interrupt enable. */
+static const field32_t SPIx_IER_TXTFIE   = {.msk = 0x00000010U, .pos = 4};  /** @brief TXTFIE interrupt enable. */
+static const field32_t SPIx_IER_EOTIE    = {.msk = 0x00000008U, .pos = 3};  /** @brief EOT, SUSP and TXC interrupt enable. */
+static const field32_t SPIx_IER_DPXPIE   = {.msk = 0x00000004U, .pos = 2};  /** @brief DXP interrupt enabled. */
+static const field32_t SPIx_IER_TXPIE    = {.msk = 0x00000002U, .pos = 1};  /** @brief TXP interrupt enable. */
+static const field32_t SPIx_IER_RXPIE    = {.msk = 0x00000001U, .pos = 0};  /** @brief RXP Interrupt Enable. */
+static const field32_t SPIx_SR_CTSIZE    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Number of data frames remaining in current TSIZE session. */
+static const field32_t SPIx_SR_RXWNE     = {.msk = 0x00008000U, .pos = 15}; /** @brief RxFIFO Word Not Empty. */
+static const field32_t SPIx_SR_RXPLVL    = {.msk = 0x00006000U, .pos = 13}; /** @brief RxFIFO Packing LeVeL. */
+static const field32_t SPIx_SR_TXC       = {.msk = 0x00001000U, .pos = 12}; /** @brief TxFIFO transmission complete. */
+static const field32_t SPIx_SR_SUSP      = {.msk = 0x00000800U, .pos = 11}; /** @brief SUSPend. */
+static const field32_t SPIx_SR_TSERF     = {.msk = 0x00000400U, .pos = 10}; /** @brief Additional number of SPI data to be transacted was reload. */
+static const field32_t SPIx_SR_MODF      = {.msk = 0x00000200U, .pos = 9};  /** @brief Mode Fault. */
+static const field32_t SPIx_SR_TIFRE     = {.msk = 0x00000100U, .pos = 8};  /** @brief TI frame format error. */
+static const field32_t SPIx_SR_CRCE      = {.msk = 0x00000080U, .pos = 7};  /** @brief CRC Error. */
+static const field32_t SPIx_SR_OVR       = {.msk = 0x00000040U, .pos = 6};  /** @brief Overrun. */
+static const field32_t SPIx_SR_UDR       = {.msk = 0x00000020U, .pos = 5};  /** @brief Underrun at slave transmission mode. */
+static const field32_t SPIx_SR_TXTF      = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmission Transfer Filled. */
+static const field32_t SPIx_SR_EOT       = {.msk = 0x00000008U, .pos = 3};  /** @brief End Of Transfer. */
+static const field32_t SPIx_SR_DXP       = {.msk = 0x00000004U, .pos = 2};  /** @brief Duplex Packet. */
+static const field32_t SPIx_SR_TXP       = {.msk = 0x00000002U, .pos = 1};  /** @brief Tx-Packet space available. */
+static const field32_t SPIx_SR_RXP       = {.msk = 0x00000001U, .pos = 0};  /** @brief Rx-Packet available. */
+static const field32_t SPIx_IFCR_SUSPC   = {.msk = 0x00000800U, .pos = 11}; /** @brief SUSPend flag clear. */
+static const field32_t SPIx_IFCR_TSERFC  = {.msk = 0x00000400U, .pos = 10}; /** @brief TSERFC flag clear. */
+static const field32_t SPIx_IFCR_MODFC   = {.msk = 0x00000200U, .pos = 9};  /** @brief Mode Fault flag clear. */
+static const field32_t SPIx_IFCR_TIFREC  = {.msk = 0x00000100U, .pos = 8};  /** @brief TI frame format error flag clear. */
+static const field32_t SPIx_IFCR_CRCEC   = {.msk = 0x00000080U, .pos = 7};  /** @brief CRC Error flag clear. */
+static const field32_t SPIx_IFCR_OVRC    = {.msk = 0x00000040U, .pos = 6};  /** @brief Overrun flag clear. */
+static const field32_t SPIx_IFCR_UDRC    = {.msk = 0x00000020U, .pos = 5};  /** @brief Underrun flag clear. */
+static const field32_t SPIx_IFCR_TXTFC   = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmission Transfer Filled flag clear. */
+static const field32_t SPIx_IFCR_EOTC    = {.msk = 0x00000008U, .pos = 3};  /** @brief End Of Transfer flag clear. */
+static const field32_t SPIx_CGFR_MCKOE   = {.msk = 0x02000000U, .pos = 25}; /** @brief Master clock output enable. */
+static const field32_t SPIx_CGFR_ODD     = {.msk = 0x01000000U, .pos = 24}; /** @brief Odd factor for the prescaler. */
+static const field32_t SPIx_CGFR_I2SDIV  = {.msk = 0x00FF0000U, .pos = 16}; /** @brief I2S linear prescaler. */
+static const field32_t SPIx_CGFR_DATFMT  = {.msk = 0x00004000U, .pos = 14}; /** @brief Data format. */
+static const field32_t SPIx_CGFR_WSINV   = {.msk = 0x00002000U, .pos = 13}; /** @brief Fixed channel length in SLAVE. */
+static const field32_t SPIx_CGFR_FIXCH   = {.msk = 0x00001000U, .pos = 12}; /** @brief Word select inversion. */
+static const field32_t SPIx_CGFR_CKPOL   = {.msk = 0x00000800U, .pos = 11}; /** @brief Serial audio clock polarity. */
+static const field32_t SPIx_CGFR_CHLEN   = {.msk = 0x00000400U, .pos = 10}; /** @brief Channel length (number of bits per audio channel). */
+static const field32_t SPIx_CGFR_DATLEN  = {.msk = 0x00000300U, .pos = 8};  /** @brief Data length to be transferred. */
+static const field32_t SPIx_CGFR_PCMSYNC = {.msk = 0x00000080U, .pos = 7};  /** @brief PCM frame synchronization. */
+static const field32_t SPIx_CGFR_I2SSTD  = {.msk = 0x00000030U, .pos = 4};  /** @brief I2S standard selection. */
+static const field32_t SPIx_CGFR_I2SCFG  = {.msk = 0x0000000EU, .pos = 1};  /** @brief I2S configuration mode. */
+static const field32_t SPIx_CGFR_I2SMOD  = {.msk = 0x00000001U, .pos = 0};  /** @brief I2S mode selection. */
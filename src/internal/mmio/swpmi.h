@@ -0,0 +1,90 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/swpmi.h
+ * @authors UW SARP
+ * @brief Registers and fields of SWPMI.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SWPMI Definitions
+ **************************************************************************************************/
+
+/** @subsection SWPMI Register Definitions */
+
+static rw_reg32_t const SWPMI_CR  = (rw_reg32_t)0x40008800U; /** @brief SWPMI Configuration/Control register. */
+static rw_reg32_t const SWPMI_BRR = (rw_reg32_t)0x40008804U; /** @brief SWPMI Bitrate register. */
+static ro_reg32_t const SWPMI_ISR = (ro_reg32_t)0x4000880CU; /** @brief SWPMI Interrupt and Status register. */
+static rw_reg32_t const SWPMI_ICR = (rw_reg32_t)0x40008810U; /** @brief SWPMI Interrupt Flag Clear register. */
+static rw_reg32_t const SWPMI_IER = (rw_reg32_t)0x40008814U; /** @brief SWPMI Interrupt Enable register. */
+static ro_reg32_t const SWPMI_RFL = (ro_reg32_t)0x40008818U; /** @brief SWPMI Receive Frame Length register. */
+static rw_reg32_t const SWPMI_TDR = (rw_reg32_t)0x4000881CU; /** @brief SWPMI Transmit data register. */
+static ro_reg32_t const SWPMI_RDR = (ro_reg32_t)0x40008820U; /** @brief SWPMI Receive data register. */
+static rw_reg32_t const SWPMI_OR  = (rw_reg32_t)0x40008824U; /** @brief SWPMI Option register. */
+
+/** @subsection SWPMI Register Field Definitions */
+
+static const field32_t SWPMI_CR_RXDMA     = {.msk = 0x00000001U, .pos = 0};  /** @brief Reception DMA enable. */
+static const field32_t SWPMI_CR_TXDMA     = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmission DMA enable. */
+static const field32_t SWPMI_CR_RXMODE    = {.msk = 0x00000004U, .pos = 2};  /** @brief Reception buffering mode. */
+static const field32_t SWPMI_CR_TXMODE    = {.msk = 0x00000008U, .pos = 3};  /** @brief Transmission buffering mode. */
+static const field32_t SWPMI_CR_LPBK      = {.msk = 0x00000010U, .pos = 4};  /** @brief Loopback mode enable. */
+static const field32_t SWPMI_CR_SWPACT    = {.msk = 0x00000020U, .pos = 5};  /** @brief Single wire protocol master interface activate. */
+static const field32_t SWPMI_CR_DEACT     = {.msk = 0x00000400U, .pos = 10}; /** @brief Single wire protocol master interface deactivate. */
+static const field32_t SWPMI_CR_SWPTEN    = {.msk = 0x00000800U, .pos = 11}; /** @brief Single wire protocol master transceiver enable. */
+static const field32_t SWPMI_BRR_BR       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Bitrate prescaler. */
+static const field32_t SWPMI_ISR_RXBFF    = {.msk = 0x00000001U, .pos = 0};  /** @brief Receive buffer full flag. */
+static const field32_t SWPMI_ISR_TXBEF    = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit buffer empty flag. */
+static const field32_t SWPMI_ISR_RXBERF   = {.msk = 0x00000004U, .pos = 2};  /** @brief Receive CRC error flag. */
+static const field32_t SWPMI_ISR_RXOVRF   = {.msk = 0x00000008U, .pos = 3};  /** @brief Receive overrun error flag. */
+static const field32_t SWPMI_ISR_TXUNRF   = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit underrun error flag. */
+static const field32_t SWPMI_ISR_RXNE     = {.msk = 0x00000020U, .pos = 5};  /** @brief Receive data register not empty. */
+static const field32_t SWPMI_ISR_TXE      = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmit data register empty. */
+static const field32_t SWPMI_ISR_TCF      = {.msk = 0x00000080U, .pos = 7};  /** @brief Transfer complete flag. */
+static const field32_t SWPMI_ISR_SRF      = {.msk = 0x00000100U, .pos = 8};  /** @brief Slave resume flag. */
+static const field32_t SWPMI_ISR_SUSP     = {.msk = 0x00000200U, .pos = 9};  /** @brief SUSPEND flag. */
+static const field32_t SWPMI_ISR_DEACTF   = {.msk = 0x00000400U, .pos = 10}; /** @brief DEACTIVATED flag. */
+static const field32_t SWPMI_ISR_RDYF     = {.msk = 0x00000800U, .pos = 11}; /** @brief Transceiver ready flag. */
+static const field32_t SWPMI_ICR_CRXBFF   = {.msk = 0x00000001U, .pos = 0};  /** @brief Clear receive buffer full flag. */
+static const field32_t SWPMI_ICR_CTXBEF   = {.msk = 0x00000002U, .pos = 1};  /** @brief Clear transmit buffer empty flag. */
+static const field32_t SWPMI_ICR_CRXBERF  = {.msk = 0x00000004U, .pos = 2};  /** @brief Clear receive CRC error flag. */
+static const field32_t SWPMI_ICR_CRXOVRF  = {.msk = 0x00000008U, .pos = 3};  /** @brief Clear receive overrun error flag. */
+static const field32_t SWPMI_ICR_CTXUNRF  = {.msk = 0x00000010U, .pos = 4};  /** @brief Clear transmit underrun error flag. */
+static const field32_t SWPMI_ICR_CTCF     = {.msk = 0x00000080U, .pos = 7};  /** @brief Clear transfer complete flag. */
+static const field32_t SWPMI_ICR_CSRF     = {.msk = 0x00000100U, .pos = 8};  /** @brief Clear slave resume flag. */
+static const field32_t SWPMI_ICR_CRDYF    = {.msk = 0x00000800U, .pos = 11}; /** @brief Clear transceiver ready flag. */
+static const field32_t SWPMI_IER_RXBFIE   = {.msk = 0x00000001U, .pos = 0};  /** @brief Receive buffer full interrupt enable. */
+static const field32_t SWPMI_IER_TXBEIE   = {.msk = 0x00000002U, .pos = 1};  /** @brief Transmit buffer empty interrupt enable. */
+static const field32_t SWPMI_IER_RXBERIE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Receive CRC error interrupt enable. */
+static const field32_t SWPMI_IER_RXOVRIE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Receive overrun error interrupt enable. */
+static const field32_t SWPMI_IER_TXUNRIE  = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit underrun error interrupt enable. */
+static const field32_t SWPMI_IER_RIE      = {.msk = 0x00000020U, .pos = 5};  /** @brief Receive interrupt enable. */
+static const field32_t SWPMI_IER_TIE      = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmit interrupt enable. */
+static const field32_t SWPMI_IER_TCIE     = {.msk = 0x00000080U, .pos = 7};  /** @brief Transmit complete interrupt enable. */
+static const field32_t SWPMI_IER_SRIE     = {.msk = 0x00000100U, .pos = 8};  /** @brief Slave resume interrupt enable. */
+static const field32_t SWPMI_IER_RDYIE    = {.msk = 0x00000800U, .pos = 11}; /** @brief Transceiver ready interrupt enable. */
+static const field32_t SWPMI_RFL_RFL      = {.msk = 0x0000001FU, .pos = 0};  /** @brief Receive frame length. */
+static const field32_t SWPMI_OR_SWP_TBYP  = {.msk = 0x00000001U, .pos = 0};  /** @brief SWP transceiver bypass. */
+static const field32_t SWPMI_OR_SWP_CLASS = {.msk = 0x00000002U, .pos = 1};  /** @brief SWP class selection. */
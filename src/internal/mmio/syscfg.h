@@ -0,0 +1,244 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/syscfg.h
+ * @authors UW SARP
+ * @brief Registers and fields of SYSCFG.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section SYSCFG Definitions
+ **************************************************************************************************/
+
+/** @subsection SYSCFG Register Definitions */
+
+static rw_reg32_t const SYSCFG_PMCR    = (rw_reg32_t)0x58000404U; /** @brief Peripheral mode configuration register. */
+static rw_reg32_t const SYSCFG_EXTICR1 = (rw_reg32_t)0x58000408U; /** @brief External interrupt configuration register 1. */
+static rw_reg32_t const SYSCFG_EXTICR2 = (rw_reg32_t)0x5800040CU; /** @brief External interrupt configuration register 2. */
+static rw_reg32_t const SYSCFG_EXTICR3 = (rw_reg32_t)0x58000410U; /** @brief External interrupt configuration register 3. */
+static rw_reg32_t const SYSCFG_EXTICR4 = (rw_reg32_t)0x58000414U; /** @brief External interrupt configuration register 4. */
+static rw_reg32_t const SYSCFG_CFGR    = (rw_reg32_t)0x58000418U; /** @brief Configuration register. */
+static rw_reg32_t const SYSCFG_CCCSR   = (rw_reg32_t)0x58000420U; /** @brief Compensation cell control/status register. */
+static ro_reg32_t const SYSCFG_CCVR    = (ro_reg32_t)0x58000424U; /** @brief SYSCFG compensation cell value register. */
+static rw_reg32_t const SYSCFG_CCCR    = (rw_reg32_t)0x58000428U; /** @brief SYSCFG compensation cell code register. */
+static rw_reg32_t const SYSCFG_PWRCR   = (rw_reg32_t)0x5800042CU; /** @brief SYSCFG power control register. */
+static ro_reg32_t const SYSCFG_PKGR    = (ro_reg32_t)0x58000524U; /** @brief SYSCFG package register. */
+static ro_reg32_t const SYSCFG_UR0     = (ro_reg32_t)0x58000700U; /** @brief SYSCFG user register 0. */
+static rw_reg32_t const SYSCFG_UR1     = (rw_reg32_t)0x58000704U; /** @brief SYSCFG user register 1. */
+static rw_reg32_t const SYSCFG_UR2     = (rw_reg32_t)0x58000708U; /** @brief SYSCFG user register 2. */
+static rw_reg32_t const SYSCFG_UR3     = (rw_reg32_t)0x5800070CU; /** @brief SYSCFG user register 3. */
+static rw_reg32_t const SYSCFG_UR4     = (rw_reg32_t)0x58000710U; /** @brief SYSCFG user register 4. */
+static ro_reg32_t const SYSCFG_UR5     = (ro_reg32_t)0x58000714U; /** @brief SYSCFG user register 5. */
+static ro_reg32_t const SYSCFG_UR6     = (ro_reg32_t)0x58000718U; /** @brief SYSCFG user register 6. */
+static ro_reg32_t const SYSCFG_UR7     = (ro_reg32_t)0x5800071CU; /** @brief SYSCFG user register 7. */
+static ro_reg32_t const SYSCFG_UR8     = (ro_reg32_t)0x58000720U; /** @brief SYSCFG user register 8. */
+static ro_reg32_t const SYSCFG_UR9     = (ro_reg32_t)0x58000724U; /** @brief SYSCFG user register 9. */
+static ro_reg32_t const SYSCFG_UR10    = (ro_reg32_t)0x58000728U; /** @brief SYSCFG user register 10. */
+static ro_reg32_t const SYSCFG_UR11    = (ro_reg32_t)0x5800072CU; /** @brief SYSCFG user register 11. */
+static ro_reg32_t const SYSCFG_UR12    = (ro_reg32_t)0x58000730U; /** @brief SYSCFG user register 12. */
+static ro_reg32_t const SYSCFG_UR13    = (ro_reg32_t)0x58000734U; /** @brief SYSCFG user register 13. */
+static rw_reg32_t const SYSCFG_UR14    = (rw_reg32_t)0x58000738U; /** @brief SYSCFG user register 14. */
+static rw_reg32_t const SYSCFG_UR15    = (rw_reg32_t)0x5800073CU; /** @brief SYSCFG user register 15. */
+static ro_reg32_t const SYSCFG_UR16    = (ro_reg32_t)0x58000740U; /** @brief SYSCFG user register 16. */
+static ro_reg32_t const SYSCFG_UR17    = (ro_reg32_t)0x58000744U; /** @brief SYSCFG user register 17. */
+
+/** @subsection SYSCFG Register Field Definitions */
+
+static const field32_t SYSCFG_PMCR_I2C1FMP     = {.msk = 0x00000001U, .pos = 0};  /** @brief I2C1 Fm+. */
+static const field32_t SYSCFG_PMCR_I2C2FMP     = {.msk = 0x00000002U, .pos = 1};  /** @brief I2C2 Fm+. */
+static const field32_t SYSCFG_PMCR_I2C3FMP     = {.msk = 0x00000004U, .pos = 2};  /** @brief I2C3 Fm+. */
+static const field32_t SYSCFG_PMCR_I2C4FMP     = {.msk = 0x00000008U, .pos = 3};  /** @brief I2C4 Fm+. */
+static const field32_t SYSCFG_PMCR_PB6FMP      = {.msk = 0x00000010U, .pos = 4};  /** @brief PB(6) Fm+. */
+static const field32_t SYSCFG_PMCR_PB7FMP      = {.msk = 0x00000020U, .pos = 5};  /** @brief PB(7) Fast Mode Plus. */
+static const field32_t SYSCFG_PMCR_PB8FMP      = {.msk = 0x00000040U, .pos = 6};  /** @brief PB(8) Fast Mode Plus. */
+static const field32_t SYSCFG_PMCR_PB9FMP      = {.msk = 0x00000080U, .pos = 7};  /** @brief PB(9) Fm+. */
+static const field32_t SYSCFG_PMCR_BOOSTE      = {.msk = 0x00000100U, .pos = 8};  /** @brief Booster Enable. */
+static const field32_t SYSCFG_PMCR_BOOSTVDDSEL = {.msk = 0x00000200U, .pos = 9};  /** @brief Analog switch supply voltage selection. */
+static const field32_t SYSCFG_PMCR_EPIS        = {.msk = 0x00E00000U, .pos = 21}; /** @brief Ethernet PHY Interface Selection. */
+static const field32_t SYSCFG_PMCR_PA0SO       = {.msk = 0x01000000U, .pos = 24}; /** @brief PA0 Switch Open. */
+static const field32_t SYSCFG_PMCR_PA1SO       = {.msk = 0x02000000U, .pos = 25}; /** @brief PA1 Switch Open. */
+static const field32_t SYSCFG_PMCR_PC2SO       = {.msk = 0x04000000U, .pos = 26}; /** @brief PC2 Switch Open. */
+static const field32_t SYSCFG_PMCR_PC3SO       = {.msk = 0x08000000U, .pos = 27}; /** @brief PC3 Switch Open. */
+static const field32_t SYSCFG_EXTICR1_EXTI3    = {.msk = 0x0000F000U, .pos = 12}; /** @brief EXTI x configuration (x = 0 to 3). */
+static const field32_t SYSCFG_EXTICR1_EXTI2    = {.msk = 0x00000F00U, .pos = 8};  /** @brief EXTI x configuration (x = 0 to 3). */
+static const field32_t SYSCFG_EXTICR1_EXTI1    = {.msk = 0x000000F0U, .pos = 4};  /** @brief EXTI x configuration (x = 0 to 3). */
+static const field32_t SYSCFG_EXTICR1_EXTI0    = {.msk = 0x0000000FU, .pos = 0};  /** @brief EXTI x configuration (x = 0 to 3). */
+static const field32_t SYSCFG_EXTICR2_EXTI7    = {.msk = 0x0000F000U, .pos = 12}; /** @brief EXTI x configuration (x = 4 to 7). */
+static const field32_t SYSCFG_EXTICR2_EXTI6    = {.msk = 0x00000F00U, .pos = 8};  /** @brief EXTI x configuration (x = 4 to 7). */
+static const field32_t SYSCFG_EXTICR2_EXTI5    = {.msk = 0x000000F0U, .pos = 4};  /** @brief EXTI x configuration (x = 4 to 7). */
+static const field32_t SYSCFG_EXTICR2_EXTI4    = {.msk = 0x0000000FU, .pos = 0};  /** @brief EXTI x configuration (x = 4 to 7). */
+static const field32_t SYSCFG_EXTICR3_EXTI11   = {.msk = 0x0000F000U, .pos = 12}; /** @brief EXTI x configuration (x = 8 to 11). */
+static const field32_t SYSCFG_EXTICR3_EXTI10   = {.msk = 0x00000F00U, .pos = 8};  /** @brief EXTI10. */
+static const field32_t SYSCFG_EXTICR3_EXTI9    = {.msk = 0x000000F0U, .pos = 4};  /** @brief EXTI x configuration (x = 8 to 11). */
+static const field32_t SYSCFG_EXTICR3_EXTI8    = {.msk = 0x0000000FU, .pos = 0};  /** @brief EXTI x configuration (x = 8 to 11). */
+static const field32_t SYSCFG_EXTICR4_EXTI15   = {.msk = 0x0000F000U, .pos = 12}; /** @brief EXTI x configuration (x = 12 to 15). */
+static const field32_t SYSCFG_EXTICR4_EXTI14   = {.msk = 0x00000F00U, .pos = 8};  /** @brief EXTI x configuration (x = 12 to 15). */
+static const field32_t SYSCFG_EXTICR4_EXTI13   = {.msk = 0x000000F0U, .pos = 4};  /** @brief EXTI x configuration (x = 12 to 15). */
+static const field32_t SYSCFG_EXTICR4_EXTI12   = {.msk = 0x0000000FU, .pos = 0};  /** @brief EXTI x configuration (x = 12 to 15). */
+static const field32_t SYSCFG_CFGR_CM4L        = {.msk = 0x00000001U, .pos = 0};  /** @brief CM4L. */
+static const field32_t SYSCFG_CFGR_PVDL        = {.msk = 0x00000004U, .pos = 2};  /** @brief PVDL. */
+static const field32_t SYSCFG_CFGR_FLASHL      = {.msk = 0x00000008U, .pos = 3};  /** @brief FLASHL. */
+static const field32_t SYSCFG_CFGR_CM7L        = {.msk = 0x00000040U, .pos = 6};  /** @brief CM7L. */
+static const field32_t SYSCFG_CFGR_BKRAML      = {.msk = 0x00000080U, .pos = 7};  /** @brief BKRAML. */
+static const field32_t SYSCFG_CFGR_SRAM4L      = {.msk = 0x00000200U, .pos = 9};  /** @brief SRAM4L. */
+static const field32_t SYSCFG_CFGR_SRAM3L      = {.msk = 0x00000400U, .pos = 10}; /** @brief SRAM3L. */
+static const field32_t SYSCFG_CFGR_SRAM2L      = {.msk = 0x00000800U, .pos = 11}; /** @brief SRAM2L. */
+static const field32_t SYSCFG_CFGR_SRAM1L      = {.msk = 0x00001000U, .pos = 12}; /** @brief SRAM1L. */
+static const field32_t SYSCFG_CFGR_DTCML       = {.msk = 0x00002000U, .pos = 13}; /** @brief DTCML. */
+static const field32_t SYSCFG_CFGR_ITCML       = {.msk = 0x00004000U, .pos = 14}; /** @brief ITCML. */
+static const field32_t SYSCFG_CFGR_AXISRAML    = {.msk = 0x00008000U, .pos = 15}; /** @brief AXISRAML. */
+static const field32_t SYSCFG_CCCSR_EN         = {.msk = 0x00000001U, .pos = 0};  /** @brief Enable. */
+static const field32_t SYSCFG_CCCSR_CS         = {.msk = 0x00000002U, .pos = 1};  /** @brief Code selection. */
+static const field32_t SYSCFG_CCCSR_READY      = {.msk = 0x00000100U, .pos = 8};  /** @brief Compensation cell ready flag. */
+static const field32_t SYSCFG_CCCSR_HSLV       = {.msk = 0x00010000U, .pos = 16}; /** @brief High-speed at low-voltage. */
+static const field32_t SYSCFG_CCVR_NCV         = {.msk = 0x0000000FU, .pos = 0};  /** @brief NMOS compensation value. */
+static const field32_t SYSCFG_CCVR_PCV         = {.msk = 0x000000F0U, .pos = 4};  /** @brief PMOS compensation value. */
+static const field32_t SYSCFG_CCCR_NCC         = {.msk = 0x0000000FU, .pos = 0};  /** @brief NMOS compensation code. */
+static const field32_t SYSCFG_CCCR_PCC         = {.msk = 0x000000F0U, .pos = 4};  /** @brief PMOS compensation code. */
+static const field32_t SYSCFG_PWRCR_ODEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Overdrive enable. */
+static const field32_t SYSCFG_PKGR_PKG         = {.msk = 0x0000000FU, .pos = 0};  /** @brief Package. */
+static const field32_t SYSCFG_UR0_BKS          = {.msk = 0x00000001U, .pos = 0};  /** @brief Bank Swap. */
+static const field32_t SYSCFG_UR0_RDP          = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Readout protection. */
+static const field32_t SYSCFG_UR1_BCM4         = {.msk = 0x00000001U, .pos = 0};  /** @brief Boot Cortex-M4. */
+static const field32_t SYSCFG_UR1_BCM7         = {.msk = 0x00010000U, .pos = 16}; /** @brief Boot Cortex-M7. */
+static const field32_t SYSCFG_UR2_BORH         = {.msk = 0x00000003U, .pos = 0};  /** @brief BOR_LVL Brownout Reset Threshold Level. */
+static const field32_t SYSCFG_UR2_BCM7_ADD0    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Cortex-M7 Boot Address 0. */
+static const field32_t SYSCFG_UR3_BCM4_ADD1    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Cortex-M4 Boot Address 0. */
+static const field32_t SYSCFG_UR3_BCM7_ADD1    = {.msk = 0xFFFF0000U, .pos = 16}; /** @brief Cortex-M7 Boot Address 1. */
+static const field32_t SYSCFG_UR4_BCM4_ADD1    = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Mass Erase Protected Area Disabled for bank 1. */
+static const field32_t SYSCFG_UR4_MEPAD_1      = {.msk = 0x00010000U, .pos = 16}; /** @brief Boot Cortex-M4 Address 1. */
+static const field32_t SYSCFG_UR5_MESAD_1      = {.msk = 0x00000001U, .pos = 0};  /** @brief Mass erase secured area disabled for bank 1. */
+static const field32_t SYSCFG_UR5_WRPS_1       = {.msk = 0x00FF0000U, .pos = 16}; /** @brief Write protection for flash bank 1. */
+static const field32_t SYSCFG_UR6_PA_BEG_1     = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Protected area start address for bank 1. */
+static const field32_t SYSCFG_UR6_PA_END_1     = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Protected area end address for bank 1. */
+static const field32_t SYSCFG_UR7_SA_BEG_1     = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Secured area start address for bank 1. */
+static const field32_t SYSCFG_UR7_SA_END_1     = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Secured area end address for bank 1. */
+static const field32_t SYSCFG_UR8_MEPAD_2      = {.msk = 0x00000001U, .pos = 0};  /** @brief Mass erase protected area disabled for bank 2. */
+static const field32_t SYSCFG_UR8_MESAD_2      = {.msk = 0x00010000U, .pos = 16}; /** @brief Mass erase secured area disabled for bank 2. */
+static const field32_t SYSCFG_UR9_WRPS_2       = {.msk = 0x000000FFU, .pos = 0};  /** @brief Write protection for flash bank 2. */
+static const field32_t SYSCFG_UR9_PA_BEG_2     = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Protected area start address for bank 2. */
+static const field32_t SYSCFG_UR10_PA_END_2    = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Protected area end address for bank 2. */
+static const field32_t SYSCFG_UR10_SA_BEG_2    = {.msk = 0x0FFF0000U, .pos = 16}; /** @brief Secured area start address for bank 2. */
+static const field32_t SYSCFG_UR11_SA_END_2    = {.msk = 0x00000FFFU, .pos = 0};  /** @brief Secured area end address for bank 2. */
+static const field32_t SYSCFG_UR11_IWDG1M      = {.msk = 0x00010000U, .pos = 16}; /** @brief Independent Watchdog 1 mode. */
+static const field32_t SYSCFG_UR12_IWDG2M      = {.msk = 0x00000001U, .pos = 0};  /** @brief Independent Watchdog 2 mode. */
+static const field32_t SYSCFG_UR12_SECURE      = {.msk = 0x00010000U, .pos = 16}; /** @brief Secure mode. */
+static const field32_t SYSCFG_UR13_SDRS        = {.msk = 0x00000003U, .pos = 0};  /** @brief Secured DTCM RAM Size. */
+static const field32_t SYSCFG_UR13_D1SBRST     = {.msk = 0x00010000U, .pos = 16}; /** @brief D1 Standby reset. */
+static const field32_t SYSCFG_UR14_D1STPRST    = {.msk = 0x00000001U, .pos = 0};  /** @brief D1 Stop Reset. */
+static const field32_t SYSCFG_UR14_D2SBRST     = {.msk = 0x00010000U, .pos = 16}; /** @brief D2 Standby Reset. */
+static const field32_t SYSCFG_UR15_D2STPRST    = {.msk = 0x00000001U, .pos = 0};  /** @brief D2 Stop Reset. */
+static const field32_t SYSCFG_UR15_FZIWDGSTB   = {.msk = 0x00010000U, .pos = 16}; /** @brief Freeze independent watchdog in Standby mode. */
+static const field32_t SYSCFG_UR16_FZIWDGSTP   = {.msk = 0x00000001U, .pos = 0};  /** @brief Freeze independent watchdog in Stop mode. */
+static const field32_t SYSCFG_UR16_PKP         = {.msk = 0x00010000U, .pos = 16}; /** @brief Private key programmed. */
+static const field32_t SYSCFG_UR17_IO_HSLV     = {.msk = 0x00000001U, .pos = 0};  /** @brief I/O high speed / low voltage. */
+
+/** @subsection Enumerated SYSCFG Register Field Definitions */
+
+/** @brief I2C1 Fm+. */
+static const field32_t SYSCFG_PMCR_I2CxFMP[5] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000002U, .pos = 1},
+  [3] = {.msk = 0x00000004U, .pos = 2},
+  [4] = {.msk = 0x00000008U, .pos = 3},
+};
+
+/** @brief PB(6) Fm+. */
+static const field32_t SYSCFG_PMCR_PBxFMP[10] = {
+  [6] = {.msk = 0x00000010U, .pos = 4},
+  [7] = {.msk = 0x00000020U, .pos = 5},
+  [8] = {.msk = 0x00000040U, .pos = 6},
+  [9] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief PA0 Switch Open. */
+static const field32_t SYSCFG_PMCR_PAxSO[2] = {
+  [0] = {.msk = 0x01000000U, .pos = 24},
+  [1] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief PC2 Switch Open. */
+static const field32_t SYSCFG_PMCR_PCxSO[4] = {
+  [2] = {.msk = 0x04000000U, .pos = 26},
+  [3] = {.msk = 0x08000000U, .pos = 27},
+};
+
+/** @brief EXTI x configuration (x = 0 to 3). */
+static const field32_t SYSCFG_EXTICR1_EXTIx[4] = {
+  [0] = {.msk = 0x0000000FU, .pos = 0},
+  [1] = {.msk = 0x000000F0U, .pos = 4},
+  [2] = {.msk = 0x00000F00U, .pos = 8},
+  [3] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief EXTI x configuration (x = 4 to 7). */
+static const field32_t SYSCFG_EXTICR2_EXTIx[8] = {
+  [4] = {.msk = 0x0000000FU, .pos = 0},
+  [5] = {.msk = 0x000000F0U, .pos = 4},
+  [6] = {.msk = 0x00000F00U, .pos = 8},
+  [7] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief EXTI x configuration (x = 8 to 11). */
+static const field32_t SYSCFG_EXTICR3_EXTIx[12] = {
+  [8]  = {.msk = 0x0000000FU, .pos = 0},
+  [9]  = {.msk = 0x000000F0U, .pos = 4},
+  [10] = {.msk = 0x00000F00U, .pos = 8},
+  [11] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief EXTI x configuration (x = 12 to 15). */
+static const field32_t SYSCFG_EXTICR4_EXTIx[16] = {
+  [12] = {.msk = 0x0000000FU, .pos = 0},
+  [13] = {.msk = 0x000000F0U, .pos = 4},
+  [14] = {.msk = 0x00000F00U, .pos = 8},
+  [15] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief CM4L. */
+static const field32_t SYSCFG_CFGR_CMxL[8] = {
+  [4] = {.msk = 0x00000001U, .pos = 0},
+  [7] = {.msk = 0x00000040U, .pos = 6},
+};
+
+/** @brief SRAM1L. */
+static const field32_t SYSCFG_CFGR_SRAMxL[5] = {
+  [1] = {.msk = 0x00001000U, .pos = 12},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+  [3] = {.msk = 0x00000400U, .pos = 10},
+  [4] = {.msk = 0x00000200U, .pos = 9},
+};
+
+/** @brief Boot Cortex-M4. */
+static const field32_t SYSCFG_UR1_BCMx[8] = {
+  [4] = {.msk = 0x00000001U, .pos = 0},
+  [7] = {.msk = 0x00010000U, .pos = 16},
+};
+
+/** @brief Cortex-M4 Boot Address 0. */
+static const field32_t SYSCFG_UR3_BCMx_ADD1[8] = {
+  [4] = {.msk = 0x0000FFFFU, .pos = 0},
+  [7] = {.msk = 0xFFFF0000U, .pos = 16},
+};
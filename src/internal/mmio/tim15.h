@@ -0,0 +1,277 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/tim15.h
+ * @authors UW SARP
+ * @brief Registers and fields of TIM15.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section TIM15 Definitions
+ **************************************************************************************************/
+
+/** @subsection TIM15 Register Definitions */
+
+static rw_reg32_t const TIM15_CR1          = (rw_reg32_t)0x40014000U; /** @brief Control register 1. */
+static rw_reg32_t const TIM15_CR2          = (rw_reg32_t)0x40014004U; /** @brief Control register 2. */
+static rw_reg32_t const TIM15_SMCR         = (rw_reg32_t)0x40014008U; /** @brief Slave mode control register. */
+static rw_reg32_t const TIM15_DIER         = (rw_reg32_t)0x4001400CU; /** @brief DMA/Interrupt enable register. */
+static rw_reg32_t const TIM15_SR           = (rw_reg32_t)0x40014010U; /** @brief Status register. */
+static rw_reg32_t const TIM15_EGR          = (rw_reg32_t)0x40014014U; /** @brief Event generation register. */
+static rw_reg32_t const TIM15_CCMR1_OUTPUT = (rw_reg32_t)0x40014018U; /** @brief Capture/compare mode register (output mode). */
+static rw_reg32_t const TIM15_CCMR1_INPUT  = (rw_reg32_t)0x40014018U; /** @brief Capture/compare mode register 1 (input mode). */
+static rw_reg32_t const TIM15_CCER         = (rw_reg32_t)0x40014020U; /** @brief Capture/compare enable register. */
+static rw_reg32_t const TIM15_CNT          = (rw_reg32_t)0x40014024U; /** @brief Counter. */
+static rw_reg32_t const TIM15_PSC          = (rw_reg32_t)0x40014028U; /** @brief Prescaler. */
+static rw_reg32_t const TIM15_ARR          = (rw_reg32_t)0x4001402CU; /** @brief Auto-reload register. */
+static rw_reg32_t const TIM15_RCR          = (rw_reg32_t)0x40014030U; /** @brief Repetition counter register. */
+static rw_reg32_t const TIM15_CCR1         = (rw_reg32_t)0x40014034U; /** @brief Capture/compare register 1. */
+static rw_reg32_t const TIM15_CCR2         = (rw_reg32_t)0x40014038U; /** @brief Capture/compare register 2. */
+static rw_reg32_t const TIM15_BDTR         = (rw_reg32_t)0x40014044U; /** @brief Break and dead-time register. */
+static rw_reg32_t const TIM15_DCR          = (rw_reg32_t)0x40014048U; /** @brief DMA control register. */
+static rw_reg32_t const TIM15_DMAR         = (rw_reg32_t)0x4001404CU; /** @brief DMA address for full transfer. */
+static rw_reg32_t const TIM15_AF1          = (rw_reg32_t)0x40014060U; /** @brief TIM15 alternate fdfsdm1_breakon register 1. */
+static rw_reg32_t const TIM15_TISEL        = (rw_reg32_t)0x40014068U; /** @brief TIM15 input selection register. */
+
+/** @subsection TIM15 Register Field Definitions */
+
+static const field32_t TIM15_CR1_CEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief Counter enable. */
+static const field32_t TIM15_CR1_UDIS            = {.msk = 0x00000002U, .pos = 1};  /** @brief Update disable. */
+static const field32_t TIM15_CR1_URS             = {.msk = 0x00000004U, .pos = 2};  /** @brief Update request source. */
+static const field32_t TIM15_CR1_OPM             = {.msk = 0x00000008U, .pos = 3};  /** @brief One-pulse mode. */
+static const field32_t TIM15_CR1_ARPE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Auto-reload preload enable. */
+static const field32_t TIM15_CR1_CKD             = {.msk = 0x00000300U, .pos = 8};  /** @brief Clock division. */
+static const field32_t TIM15_CR1_UIFREMAP        = {.msk = 0x00000800U, .pos = 11}; /** @brief UIF status bit remapping. */
+static const field32_t TIM15_CR2_CCPC            = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/compare preloaded control. */
+static const field32_t TIM15_CR2_CCUS            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare control update selection. */
+static const field32_t TIM15_CR2_CCDS            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare DMA selection. */
+static const field32_t TIM15_CR2_MMS             = {.msk = 0x00000070U, .pos = 4};  /** @brief Master mode selection. */
+static const field32_t TIM15_CR2_TI1S            = {.msk = 0x00000080U, .pos = 7};  /** @brief TI1 selection. */
+static const field32_t TIM15_CR2_OIS1            = {.msk = 0x00000100U, .pos = 8};  /** @brief Output Idle state 1. */
+static const field32_t TIM15_CR2_OIS1N           = {.msk = 0x00000200U, .pos = 9};  /** @brief Output Idle state 1. */
+static const field32_t TIM15_CR2_OIS2            = {.msk = 0x00000400U, .pos = 10}; /** @brief Output Idle state 2. */
+static const field32_t TIM15_SMCR_SMS            = {.msk = 0x00000007U, .pos = 0};  /** @brief Slave mode selection. */
+static const field32_t TIM15_SMCR_TS_2_0         = {.msk = 0x00000070U, .pos = 4};  /** @brief Trigger selection. */
+static const field32_t TIM15_SMCR_MSM            = {.msk = 0x00000080U, .pos = 7};  /** @brief Master/Slave mode. */
+static const field32_t TIM15_SMCR_SMS_3          = {.msk = 0x00010000U, .pos = 16}; /** @brief Slave mode selection bit 3. */
+static const field32_t TIM15_SMCR_TS_4_3         = {.msk = 0x00300000U, .pos = 20}; /** @brief Trigger selection - bit 4:3. */
+static const field32_t TIM15_DIER_UIE            = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt enable. */
+static const field32_t TIM15_DIER_CC1IE          = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t TIM15_DIER_CC2IE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt enable. */
+static const field32_t TIM15_DIER_COMIE          = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt enable. */
+static const field32_t TIM15_DIER_TIE            = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt enable. */
+static const field32_t TIM15_DIER_BIE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt enable. */
+static const field32_t TIM15_DIER_UDE            = {.msk = 0x00000100U, .pos = 8};  /** @brief Update DMA request enable. */
+static const field32_t TIM15_DIER_CC1DE          = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t TIM15_DIER_CC2DE          = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/Compare 2 DMA request enable. */
+static const field32_t TIM15_DIER_COMDE          = {.msk = 0x00002000U, .pos = 13}; /** @brief COM DMA request enable. */
+static const field32_t TIM15_DIER_TDE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Trigger DMA request enable. */
+static const field32_t TIM15_SR_CC2OF            = {.msk = 0x00000400U, .pos = 10}; /** @brief Capture/compare 2 overcapture flag. */
+static const field32_t TIM15_SR_CC1OF            = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t TIM15_SR_BIF              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt flag. */
+static const field32_t TIM15_SR_TIF              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger interrupt flag. */
+static const field32_t TIM15_SR_COMIF            = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt flag. */
+static const field32_t TIM15_SR_CC2IF            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 2 interrupt flag. */
+static const field32_t TIM15_SR_CC1IF            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 interrupt flag. */
+static const field32_t TIM15_SR_UIF              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt flag. */
+static const field32_t TIM15_EGR_BG              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break generation. */
+static const field32_t TIM15_EGR_TG              = {.msk = 0x00000040U, .pos = 6};  /** @brief Trigger generation. */
+static const field32_t TIM15_EGR_COMG            = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare control update generation. */
+static const field32_t TIM15_EGR_CC2G            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare 2 generation. */
+static const field32_t TIM15_EGR_CC1G            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 generation. */
+static const field32_t TIM15_EGR_UG              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update generation. */
+static const field32_t TIM15_CCMR1_OUTPUT_CC1S   = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC1FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Output Compare 1 fast enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC1PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Output Compare 1 preload enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC1M   = {.msk = 0x00000070U, .pos = 4};  /** @brief Output Compare 1 mode. */
+static const field32_t TIM15_CCMR1_OUTPUT_CC2S   = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 2 selection. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC2FE  = {.msk = 0x00000400U, .pos = 10}; /** @brief Output Compare 2 fast enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC2PE  = {.msk = 0x00000800U, .pos = 11}; /** @brief Output Compare 2 preload enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC2M   = {.msk = 0x00007000U, .pos = 12}; /** @brief Output Compare 2 mode. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC1M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 1 mode bit 3. */
+static const field32_t TIM15_CCMR1_OUTPUT_OC2M_3 = {.msk = 0x01000000U, .pos = 24}; /** @brief Output Compare 2 mode bit 3. */
+static const field32_t TIM15_CCMR1_INPUT_IC2F    = {.msk = 0x0000F000U, .pos = 12}; /** @brief Input capture 2 filter. */
+static const field32_t TIM15_CCMR1_INPUT_IC2PSC  = {.msk = 0x00000C00U, .pos = 10}; /** @brief Input capture 2 prescaler. */
+static const field32_t TIM15_CCMR1_INPUT_CC2S    = {.msk = 0x00000300U, .pos = 8};  /** @brief Capture/Compare 2 selection. */
+static const field32_t TIM15_CCMR1_INPUT_IC1F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 1 filter. */
+static const field32_t TIM15_CCMR1_INPUT_IC1PSC  = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 1 prescaler. */
+static const field32_t TIM15_CCMR1_INPUT_CC1S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t TIM15_CCER_CC2NP          = {.msk = 0x00000080U, .pos = 7};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t TIM15_CCER_CC2P           = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare 2 output Polarity. */
+static const field32_t TIM15_CCER_CC2E           = {.msk = 0x00000010U, .pos = 4};  /** @brief Capture/Compare 2 output enable. */
+static const field32_t TIM15_CCER_CC1NP          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM15_CCER_CC1NE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 1 complementary output enable. */
+static const field32_t TIM15_CCER_CC1P           = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM15_CCER_CC1E           = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/Compare 1 output enable. */
+static const field32_t TIM15_CNT_CNT             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter value. */
+static const field32_t TIM15_CNT_UIFCPY          = {.msk = 0x80000000U, .pos = 31}; /** @brief UIF copy. */
+static const field32_t TIM15_PSC_PSC             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t TIM15_ARR_ARR             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Auto-reload value. */
+static const field32_t TIM15_RCR_REP             = {.msk = 0x000000FFU, .pos = 0};  /** @brief Repetition counter value. */
+static const field32_t TIM15_CCR1_CCR1           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 1 value. */
+static const field32_t TIM15_CCR2_CCR2           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 2 value. */
+static const field32_t TIM15_BDTR_MOE            = {.msk = 0x00008000U, .pos = 15}; /** @brief Main output enable. */
+static const field32_t TIM15_BDTR_AOE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Automatic output enable. */
+static const field32_t TIM15_BDTR_BKP            = {.msk = 0x00002000U, .pos = 13}; /** @brief Break polarity. */
+static const field32_t TIM15_BDTR_BKE            = {.msk = 0x00001000U, .pos = 12}; /** @brief Break enable. */
+static const field32_t TIM15_BDTR_OSSR           = {.msk = 0x00000800U, .pos = 11}; /** @brief Off-state selection for Run mode. */
+static const field32_t TIM15_BDTR_OSSI           = {.msk = 0x00000400U, .pos = 10}; /** @brief Off-state selection for Idle mode. */
+static const field32_t TIM15_BDTR_LOCK           = {.msk = 0x00000300U, .pos = 8};  /** @brief Lock configuration. */
+static const field32_t TIM15_BDTR_DTG            = {.msk = 0x000000FFU, .pos = 0};  /** @brief Dead-time generator setup. */
+static const field32_t TIM15_BDTR_BKF            = {.msk = 0x000F0000U, .pos = 16}; /** @brief Break filter. */
+static const field32_t TIM15_DCR_DBL             = {.msk = 0x00001F00U, .pos = 8};  /** @brief DMA burst length. */
+static const field32_t TIM15_DCR_DBA             = {.msk = 0x0000001FU, .pos = 0};  /** @brief DMA base address. */
+static const field32_t TIM15_DMAR_DMAB           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief DMA register for burst accesses. */
+static const field32_t TIM15_AF1_BKINE           = {.msk = 0x00000001U, .pos = 0};  /** @brief BRK BKIN input enable. */
+static const field32_t TIM15_AF1_BKCMP1E         = {.msk = 0x00000002U, .pos = 1};  /** @brief BRK COMP1 enable. */
+static const field32_t TIM15_AF1_BKCMP2E         = {.msk = 0x00000004U, .pos = 2};  /** @brief BRK COMP2 enable. */
+static const field32_t TIM15_AF1_BKDF1BK0E       = {.msk = 0x00000100U, .pos = 8};  /** @brief BRK dfsdm1_break[0] enable. */
+static const field32_t TIM15_AF1_BKINP           = {.msk = 0x00000200U, .pos = 9};  /** @brief BRK BKIN input polarity. */
+static const field32_t TIM15_AF1_BKCMP1P         = {.msk = 0x00000400U, .pos = 10}; /** @brief BRK COMP1 input polarity. */
+static const field32_t TIM15_AF1_BKCMP2P         = {.msk = 0x00000800U, .pos = 11}; /** @brief BRK COMP2 input polarity. */
+static const field32_t TIM15_TISEL_TI1SEL        = {.msk = 0x0000000FU, .pos = 0};  /** @brief Selects TI1[0] to TI1[15] input. */
+static const field32_t TIM15_TISEL_TI2SEL        = {.msk = 0x00000F00U, .pos = 8};  /** @brief Selects TI2[0] to TI2[15] input. */
+
+/** @subsection Enumerated TIM15 Register Field Definitions */
+
+/** @brief Output Idle state 1. */
+static const field32_t TIM15_CR2_OISx[3] = {
+  [1] = {.msk = 0x00000100U, .pos = 8},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t TIM15_DIER_CCxIE[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t TIM15_DIER_CCxDE[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t TIM15_SR_CCxOF[3] = {
+  [1] = {.msk = 0x00000200U, .pos = 9},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Capture/compare 1 interrupt flag. */
+static const field32_t TIM15_SR_CCxIF[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief Capture/compare 1 generation. */
+static const field32_t TIM15_EGR_CCxG[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief Capture/Compare 1 selection. */
+static const field32_t TIM15_CCMR1_OUTPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Output Compare 1 fast enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OCxFE[3] = {
+  [1] = {.msk = 0x00000004U, .pos = 2},
+  [2] = {.msk = 0x00000400U, .pos = 10},
+};
+
+/** @brief Output Compare 1 preload enable. */
+static const field32_t TIM15_CCMR1_OUTPUT_OCxPE[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Output Compare 1 mode. */
+static const field32_t TIM15_CCMR1_OUTPUT_OCxM[3] = {
+  [1] = {.msk = 0x00000070U, .pos = 4},
+  [2] = {.msk = 0x00007000U, .pos = 12},
+};
+
+/** @brief Output Compare 1 mode bit 3. */
+static const field32_t TIM15_CCMR1_OUTPUT_OCxM_3[3] = {
+  [1] = {.msk = 0x00010000U, .pos = 16},
+  [2] = {.msk = 0x01000000U, .pos = 24},
+};
+
+/** @brief Input capture 1 filter. */
+static const field32_t TIM15_CCMR1_INPUT_ICxF[3] = {
+  [1] = {.msk = 0x000000F0U, .pos = 4},
+  [2] = {.msk = 0x0000F000U, .pos = 12},
+};
+
+/** @brief Input capture 1 prescaler. */
+static const field32_t TIM15_CCMR1_INPUT_ICxPSC[3] = {
+  [1] = {.msk = 0x0000000CU, .pos = 2},
+  [2] = {.msk = 0x00000C00U, .pos = 10},
+};
+
+/** @brief Capture/Compare 1 selection. */
+static const field32_t TIM15_CCMR1_INPUT_CCxS[3] = {
+  [1] = {.msk = 0x00000003U, .pos = 0},
+  [2] = {.msk = 0x00000300U, .pos = 8},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM15_CCER_CCxNP[3] = {
+  [1] = {.msk = 0x00000008U, .pos = 3},
+  [2] = {.msk = 0x00000080U, .pos = 7},
+};
+
+/** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM15_CCER_CCxP[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000020U, .pos = 5},
+};
+
+/** @brief Capture/Compare 1 output enable. */
+static const field32_t TIM15_CCER_CCxE[3] = {
+  [1] = {.msk = 0x00000001U, .pos = 0},
+  [2] = {.msk = 0x00000010U, .pos = 4},
+};
+
+/** @brief BRK COMP1 enable. */
+static const field32_t TIM15_AF1_BKCMPxE[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief BRK COMP1 input polarity. */
+static const field32_t TIM15_AF1_BKCMPxP[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
+
+/** @brief Selects TI1[0] to TI1[15] input. */
+static const field32_t TIM15_TISEL_TIxSEL[3] = {
+  [1] = {.msk = 0x0000000FU, .pos = 0},
+  [2] = {.msk = 0x00000F00U, .pos = 8},
+};
@@ -0,0 +1,137 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/tim17.h
+ * @authors UW SARP
+ * @brief Registers and fields of TIM17.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section TIM17 Definitions
+ **************************************************************************************************/
+
+/** @subsection TIM17 Register Definitions */
+
+static rw_reg32_t const TIM17_CR1          = (rw_reg32_t)0x40014800U; /** @brief Control register 1. */
+static rw_reg32_t const TIM17_CR2          = (rw_reg32_t)0x40014804U; /** @brief Control register 2. */
+static rw_reg32_t const TIM17_DIER         = (rw_reg32_t)0x4001480CU; /** @brief DMA/Interrupt enable register. */
+static rw_reg32_t const TIM17_SR           = (rw_reg32_t)0x40014810U; /** @brief Status register. */
+static rw_reg32_t const TIM17_EGR          = (rw_reg32_t)0x40014814U; /** @brief Event generation register. */
+static rw_reg32_t const TIM17_CCMR1_OUTPUT = (rw_reg32_t)0x40014818U; /** @brief Capture/compare mode register (output mode). */
+static rw_reg32_t const TIM17_CCMR1_INPUT  = (rw_reg32_t)0x40014818U; /** @brief Capture/compare mode register 1 (input mode). */
+static rw_reg32_t const TIM17_CCER         = (rw_reg32_t)0x40014820U; /** @brief Capture/compare enable register. */
+static rw_reg32_t const TIM17_CNT          = (rw_reg32_t)0x40014824U; /** @brief Counter. */
+static rw_reg32_t const TIM17_PSC          = (rw_reg32_t)0x40014828U; /** @brief Prescaler. */
+static rw_reg32_t const TIM17_ARR          = (rw_reg32_t)0x4001482CU; /** @brief Auto-reload register. */
+static rw_reg32_t const TIM17_RCR          = (rw_reg32_t)0x40014830U; /** @brief Repetition counter register. */
+static rw_reg32_t const TIM17_CCR1         = (rw_reg32_t)0x40014834U; /** @brief Capture/compare register 1. */
+static rw_reg32_t const TIM17_BDTR         = (rw_reg32_t)0x40014844U; /** @brief Break and dead-time register. */
+static rw_reg32_t const TIM17_DCR          = (rw_reg32_t)0x40014848U; /** @brief DMA control register. */
+static rw_reg32_t const TIM17_DMAR         = (rw_reg32_t)0x4001484CU; /** @brief DMA address for full transfer. */
+static rw_reg32_t const TIM17_TIM17_AF1    = (rw_reg32_t)0x40014860U; /** @brief TIM17 alternate function register 1. */
+static rw_reg32_t const TIM17_TIM17_TISEL  = (rw_reg32_t)0x40014868U; /** @brief TIM17 input selection register. */
+
+/** @subsection TIM17 Register Field Definitions */
+
+static const field32_t TIM17_CR1_CEN             = {.msk = 0x00000001U, .pos = 0};  /** @brief Counter enable. */
+static const field32_t TIM17_CR1_UDIS            = {.msk = 0x00000002U, .pos = 1};  /** @brief Update disable. */
+static const field32_t TIM17_CR1_URS             = {.msk = 0x00000004U, .pos = 2};  /** @brief Update request source. */
+static const field32_t TIM17_CR1_OPM             = {.msk = 0x00000008U, .pos = 3};  /** @brief One-pulse mode. */
+static const field32_t TIM17_CR1_ARPE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Auto-reload preload enable. */
+static const field32_t TIM17_CR1_CKD             = {.msk = 0x00000300U, .pos = 8};  /** @brief Clock division. */
+static const field32_t TIM17_CR1_UIFREMAP        = {.msk = 0x00000800U, .pos = 11}; /** @brief UIF status bit remapping. */
+static const field32_t TIM17_CR2_OIS1N           = {.msk = 0x00000200U, .pos = 9};  /** @brief Output Idle state 1. */
+static const field32_t TIM17_CR2_OIS1            = {.msk = 0x00000100U, .pos = 8};  /** @brief Output Idle state 1. */
+static const field32_t TIM17_CR2_CCDS            = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/compare DMA selection. */
+static const field32_t TIM17_CR2_CCUS            = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/compare control update selection. */
+static const field32_t TIM17_CR2_CCPC            = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/compare preloaded control. */
+static const field32_t TIM17_DIER_UIE            = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt enable. */
+static const field32_t TIM17_DIER_CC1IE          = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 interrupt enable. */
+static const field32_t TIM17_DIER_COMIE          = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt enable. */
+static const field32_t TIM17_DIER_BIE            = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt enable. */
+static const field32_t TIM17_DIER_UDE            = {.msk = 0x00000100U, .pos = 8};  /** @brief Update DMA request enable. */
+static const field32_t TIM17_DIER_CC1DE          = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 DMA request enable. */
+static const field32_t TIM17_DIER_COMDE          = {.msk = 0x00002000U, .pos = 13}; /** @brief COM DMA request enable. */
+static const field32_t TIM17_SR_CC1OF            = {.msk = 0x00000200U, .pos = 9};  /** @brief Capture/Compare 1 overcapture flag. */
+static const field32_t TIM17_SR_BIF              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break interrupt flag. */
+static const field32_t TIM17_SR_COMIF            = {.msk = 0x00000020U, .pos = 5};  /** @brief COM interrupt flag. */
+static const field32_t TIM17_SR_CC1IF            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 interrupt flag. */
+static const field32_t TIM17_SR_UIF              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update interrupt flag. */
+static const field32_t TIM17_EGR_BG              = {.msk = 0x00000080U, .pos = 7};  /** @brief Break generation. */
+static const field32_t TIM17_EGR_COMG            = {.msk = 0x00000020U, .pos = 5};  /** @brief Capture/Compare control update generation. */
+static const field32_t TIM17_EGR_CC1G            = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/compare 1 generation. */
+static const field32_t TIM17_EGR_UG              = {.msk = 0x00000001U, .pos = 0};  /** @brief Update generation. */
+static const field32_t TIM17_CCMR1_OUTPUT_CC1S   = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t TIM17_CCMR1_OUTPUT_OC1FE  = {.msk = 0x00000004U, .pos = 2};  /** @brief Output Compare 1 fast enable. */
+static const field32_t TIM17_CCMR1_OUTPUT_OC1PE  = {.msk = 0x00000008U, .pos = 3};  /** @brief Output Compare 1 preload enable. */
+static const field32_t TIM17_CCMR1_OUTPUT_OC1M   = {.msk = 0x00000070U, .pos = 4};  /** @brief Output Compare 1 mode. */
+static const field32_t TIM17_CCMR1_OUTPUT_OC1M_3 = {.msk = 0x00010000U, .pos = 16}; /** @brief Output Compare 1 mode. */
+static const field32_t TIM17_CCMR1_INPUT_IC1F    = {.msk = 0x000000F0U, .pos = 4};  /** @brief Input capture 1 filter. */
+static const field32_t TIM17_CCMR1_INPUT_IC1PSC  = {.msk = 0x0000000CU, .pos = 2};  /** @brief Input capture 1 prescaler. */
+static const field32_t TIM17_CCMR1_INPUT_CC1S    = {.msk = 0x00000003U, .pos = 0};  /** @brief Capture/Compare 1 selection. */
+static const field32_t TIM17_CCER_CC1NP          = {.msk = 0x00000008U, .pos = 3};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM17_CCER_CC1NE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Capture/Compare 1 complementary output enable. */
+static const field32_t TIM17_CCER_CC1P           = {.msk = 0x00000002U, .pos = 1};  /** @brief Capture/Compare 1 output Polarity. */
+static const field32_t TIM17_CCER_CC1E           = {.msk = 0x00000001U, .pos = 0};  /** @brief Capture/Compare 1 output enable. */
+static const field32_t TIM17_CNT_CNT             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Counter value. */
+static const field32_t TIM17_CNT_UIFCPY          = {.msk = 0x80000000U, .pos = 31}; /** @brief UIF Copy. */
+static const field32_t TIM17_PSC_PSC             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t TIM17_ARR_ARR             = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Auto-reload value. */
+static const field32_t TIM17_RCR_REP             = {.msk = 0x000000FFU, .pos = 0};  /** @brief Repetition counter value. */
+static const field32_t TIM17_CCR1_CCR1           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief Capture/Compare 1 value. */
+static const field32_t TIM17_BDTR_DTG            = {.msk = 0x000000FFU, .pos = 0};  /** @brief Dead-time generator setup. */
+static const field32_t TIM17_BDTR_LOCK           = {.msk = 0x00000300U, .pos = 8};  /** @brief Lock configuration. */
+static const field32_t TIM17_BDTR_OSSI           = {.msk = 0x00000400U, .pos = 10}; /** @brief Off-state selection for Idle mode. */
+static const field32_t TIM17_BDTR_OSSR           = {.msk = 0x00000800U, .pos = 11}; /** @brief Off-state selection for Run mode. */
+static const field32_t TIM17_BDTR_BKE            = {.msk = 0x00001000U, .pos = 12}; /** @brief Break enable. */
+static const field32_t TIM17_BDTR_BKP            = {.msk = 0x00002000U, .pos = 13}; /** @brief Break polarity. */
+static const field32_t TIM17_BDTR_AOE            = {.msk = 0x00004000U, .pos = 14}; /** @brief Automatic output enable. */
+static const field32_t TIM17_BDTR_MOE            = {.msk = 0x00008000U, .pos = 15}; /** @brief Main output enable. */
+static const field32_t TIM17_BDTR_BKF            = {.msk = 0x000F0000U, .pos = 16}; /** @brief Break filter. */
+static const field32_t TIM17_DCR_DBL             = {.msk = 0x00001F00U, .pos = 8};  /** @brief DMA burst length. */
+static const field32_t TIM17_DCR_DBA             = {.msk = 0x0000001FU, .pos = 0};  /** @brief DMA base address. */
+static const field32_t TIM17_DMAR_DMAB           = {.msk = 0x0000FFFFU, .pos = 0};  /** @brief DMA register for burst accesses. */
+static const field32_t TIM17_TIM17_AF1_BKINE     = {.msk = 0x00000001U, .pos = 0};  /** @brief BRK BKIN input enable. */
+static const field32_t TIM17_TIM17_AF1_BKCMP1E   = {.msk = 0x00000002U, .pos = 1};  /** @brief BRK COMP1 enable. */
+static const field32_t TIM17_TIM17_AF1_BKCMP2E   = {.msk = 0x00000004U, .pos = 2};  /** @brief BRK COMP2 enable. */
+static const field32_t TIM17_TIM17_AF1_BKDFBK1E  = {.msk = 0x00000100U, .pos = 8};  /** @brief BRK dfsdm1_break[1] enable. */
+static const field32_t TIM17_TIM17_AF1_BKINP     = {.msk = 0x00000200U, .pos = 9};  /** @brief BRK BKIN input polarity. */
+static const field32_t TIM17_TIM17_AF1_BKCMP1P   = {.msk = 0x00000400U, .pos = 10}; /** @brief BRK COMP1 input polarity. */
+static const field32_t TIM17_TIM17_AF1_BKCMP2P   = {.msk = 0x00000800U, .pos = 11}; /** @brief BRK COMP2 input polarity. */
+static const field32_t TIM17_TIM17_TISEL_TI1SEL  = {.msk = 0x0000000FU, .pos = 0};  /** @brief Selects TI1[0] to TI1[15] input. */
+
+/** @subsection Enumerated TIM17 Register Field Definitions */
+
+/** @brief BRK COMP1 enable. */
+static const field32_t TIM17_TIM17_AF1_BKCMPxE[3] = {
+  [1] = {.msk = 0x00000002U, .pos = 1},
+  [2] = {.msk = 0x00000004U, .pos = 2},
+};
+
+/** @brief BRK COMP1 input polarity. */
+static const field32_t TIM17_TIM17_AF1_BKCMPxP[3] = {
+  [1] = {.msk = 0x00000400U, .pos = 10},
+  [2] = {.msk = 0x00000800U, .pos = 11},
+};
@@ -0,0 +1,573 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/usartx.h
+ * @authors UW SARP
+ * @brief Registers and fields of USART1, USART2, USART3, USART6, UART4, UART5, UART7, UART8.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section USARTx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated USARTx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const USARTx_CR1[7] = {
+  [1] = (rw_reg32_t)0x40011000U,
+  [2] = (rw_reg32_t)0x40004400U,
+  [3] = (rw_reg32_t)0x40004800U,
+  [6] = (rw_reg32_t)0x40011400U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const USARTx_CR2[7] = {
+  [1] = (rw_reg32_t)0x40011004U,
+  [2] = (rw_reg32_t)0x40004404U,
+  [3] = (rw_reg32_t)0x40004804U,
+  [6] = (rw_reg32_t)0x40011404U,
+};
+
+/** @brief Control register 3. */
+static rw_reg32_t const USARTx_CR3[7] = {
+  [1] = (rw_reg32_t)0x40011008U,
+  [2] = (rw_reg32_t)0x40004408U,
+  [3] = (rw_reg32_t)0x40004808U,
+  [6] = (rw_reg32_t)0x40011408U,
+};
+
+/** @brief Baud rate register. */
+static rw_reg32_t const USARTx_BRR[7] = {
+  [1] = (rw_reg32_t)0x4001100CU,
+  [2] = (rw_reg32_t)0x4000440CU,
+  [3] = (rw_reg32_t)0x4000480CU,
+  [6] = (rw_reg32_t)0x4001140CU,
+};
+
+/** @brief Guard time and prescaler register. */
+static rw_reg32_t const USARTx_GTPR[7] = {
+  [1] = (rw_reg32_t)0x40011010U,
+  [2] = (rw_reg32_t)0x40004410U,
+  [3] = (rw_reg32_t)0x40004810U,
+  [6] = (rw_reg32_t)0x40011410U,
+};
+
+/** @brief Receiver timeout register. */
+static rw_reg32_t const USARTx_RTOR[7] = {
+  [1] = (rw_reg32_t)0x40011014U,
+  [2] = (rw_reg32_t)0x40004414U,
+  [3] = (rw_reg32_t)0x40004814U,
+  [6] = (rw_reg32_t)0x40011414U,
+};
+
+/** @brief Request register. */
+static rw_reg32_t const USARTx_RQR[7] = {
+  [1] = (rw_reg32_t)0x40011018U,
+  [2] = (rw_reg32_t)0x40004418U,
+  [3] = (rw_reg32_t)0x40004818U,
+  [6] = (rw_reg32_t)0x40011418U,
+};
+
+/** @brief Interrupt & status register. */
+static ro_reg32_t const USARTx_ISR[7] = {
+  [1] = (ro_reg32_t)0x4001101CU,
+  [2] = (ro_reg32_t)0x4000441CU,
+  [3] = (ro_reg32_t)0x4000481CU,
+  [6] = (ro_reg32_t)0x4001141CU,
+};
+
+/** @brief Interrupt flag clear register. */
+static rw_reg32_t const USARTx_ICR[7] = {
+  [1] = (rw_reg32_t)0x40011020U,
+  [2] = (rw_reg32_t)0x40004420U,
+  [3] = (rw_reg32_t)0x40004820U,
+  [6] = (rw_reg32_t)0x40011420U,
+};
+
+/** @brief Receive data register. */
+static ro_reg32_t const USARTx_RDR[7] = {
+  [1] = (ro_reg32_t)0x40011024U,
+  [2] = (ro_reg32_t)0x40004424U,
+  [3] = (ro_reg32_t)0x40004824U,
+  [6] = (ro_reg32_t)0x40011424U,
+};
+
+/** @brief Transmit data register. */
+static rw_reg32_t const USARTx_TDR[7] = {
+  [1] = (rw_reg32_t)0x40011028U,
+  [2] = (rw_reg32_t)0x40004428U,
+  [3] = (rw_reg32_t)0x40004828U,
+  [6] = (rw_reg32_t)0x40011428U,
+};
+
+/** @brief USART prescaler register. */
+static rw_reg32_t const USARTx_PRESC[7] = {
+  [1] = (rw_reg32_t)0x4001102CU,
+  [2] = (rw_reg32_t)0x4000442CU,
+  [3] = (rw_reg32_t)0x4000482CU,
+  [6] = (rw_reg32_t)0x4001142CU,
+};
+
+/** @subsection USARTx Register Field Definitions */
+
+static const field32_t USARTx_CR1_RXFFIE      = {.msk = 0x80000000U, .pos = 31}; /** @brief RXFIFO Full interrupt enable. */
+static const field32_t USARTx_CR1_TXFEIE      = {.msk = 0x40000000U, .pos = 30}; /** @brief TXFIFO empty interrupt enable. */
+static const field32_t USARTx_CR1_FIFOEN      = {.msk = 0x20000000U, .pos = 29}; /** @brief FIFO mode enable. */
+static const field32_t USARTx_CR1_M1          = {.msk = 0x10000000U, .pos = 28}; /** @brief Word length. */
+static const field32_t USARTx_CR1_EOBIE       = {.msk = 0x08000000U, .pos = 27}; /** @brief End of Block interrupt enable. */
+static const field32_t USARTx_CR1_RTOIE       = {.msk = 0x04000000U, .pos = 26}; /** @brief Receiver timeout interrupt enable. */
+static const field32_t USARTx_CR1_DEAT4       = {.msk = 0x02000000U, .pos = 25}; /** @brief Driver Enable assertion time. */
+static const field32_t USARTx_CR1_DEAT3       = {.msk = 0x01000000U, .pos = 24}; /** @brief DEAT3. */
+static const field32_t USARTx_CR1_DEAT2       = {.msk = 0x00800000U, .pos = 23}; /** @brief DEAT2. */
+static const field32_t USARTx_CR1_DEAT1       = {.msk = 0x00400000U, .pos = 22}; /** @brief DEAT1. */
+static const field32_t USARTx_CR1_DEAT0       = {.msk = 0x00200000U, .pos = 21}; /** @brief DEAT0. */
+static const field32_t USARTx_CR1_DEDT4       = {.msk = 0x00100000U, .pos = 20}; /** @brief Driver Enable de-assertion time. */
+static const field32_t USARTx_CR1_DEDT3       = {.msk = 0x00080000U, .pos = 19}; /** @brief DEDT3. */
+static const field32_t USARTx_CR1_DEDT2       = {.msk = 0x00040000U, .pos = 18}; /** @brief DEDT2. */
+static const field32_t USARTx_CR1_DEDT1       = {.msk = 0x00020000U, .pos = 17}; /** @brief DEDT1. */
+static const field32_t USARTx_CR1_DEDT0       = {.msk = 0x00010000U, .pos = 16}; /** @brief DEDT0. */
+static const field32_t USARTx_CR1_OVER8       = {.msk = 0x00008000U, .pos = 15}; /** @brief Oversampling mode. */
+static const field32_t USARTx_CR1_CMIE        = {.msk = 0x00004000U, .pos = 14}; /** @brief Character match interrupt enable. */
+static const field32_t USARTx_CR1_MME         = {.msk = 0x00002000U, .pos = 13}; /** @brief Mute mode enable. */
+static const field32_t USARTx_CR1_M0          = {.msk = 0x00001000U, .pos = 12}; /** @brief Word length. */
+static const field32_t USARTx_CR1_WAKE        = {.msk = 0x00000800U, .pos = 11}; /** @brief Receiver wakeup method. */
+static const field32_t USARTx_CR1_PCE         = {.msk = 0x00000400U, .pos = 10}; /** @brief Parity control enable. */
+static const field32_t USARTx_CR1_PS          = {.msk = 0x00000200U, .pos = 9};  /** @brief Parity selection. */
+static const field32_t USARTx_CR1_PEIE        = {.msk = 0x00000100U, .pos = 8};  /** @brief PE interrupt enable. */
+static const field32_t USARTx_CR1_TXEIE       = {.msk = 0x00000080U, .pos = 7};  /** @brief Interrupt enable. */
+static const field32_t USARTx_CR1_TCIE        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete interrupt enable. */
+static const field32_t USARTx_CR1_RXNEIE      = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE interrupt enable. */
+static const field32_t USARTx_CR1_IDLEIE      = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE interrupt enable. */
+static const field32_t USARTx_CR1_TE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Transmitter enable. */
+static const field32_t USARTx_CR1_RE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Receiver enable. */
+static const field32_t USARTx_CR1_UESM        = {.msk = 0x00000002U, .pos = 1};  /** @brief USART enable in Stop mode. */
+static const field32_t USARTx_CR1_UE          = {.msk = 0x00000001U, .pos = 0};  /** @brief USART enable. */
+static const field32_t USARTx_CR2_ADD4_7      = {.msk = 0xF0000000U, .pos = 28}; /** @brief Address of the USART node. */
+static const field32_t USARTx_CR2_ADD0_3      = {.msk = 0x0F000000U, .pos = 24}; /** @brief Address of the USART node. */
+static const field32_t USARTx_CR2_RTOEN       = {.msk = 0x00800000U, .pos = 23}; /** @brief Receiver timeout enable. */
+static const field32_t USARTx_CR2_ABRMOD1     = {.msk = 0x00400000U, .pos = 22}; /** @brief Auto baud rate mode. */
+static const field32_t USARTx_CR2_ABRMOD0     = {.msk = 0x00200000U, .pos = 21}; /** @brief ABRMOD0. */
+static const field32_t USARTx_CR2_ABREN       = {.msk = 0x00100000U, .pos = 20}; /** @brief Auto baud rate enable. */
+static const field32_t USARTx_CR2_MSBFIRST    = {.msk = 0x00080000U, .pos = 19}; /** @brief Most significant bit first. */
+static const field32_t USARTx_CR2_TAINV       = {.msk = 0x00040000U, .pos = 18}; /** @brief Binary data inversion. */
+static const field32_t USARTx_CR2_TXINV       = {.msk = 0x00020000U, .pos = 17}; /** @brief TX pin active level inversion. */
+static const field32_t USARTx_CR2_RXINV       = {.msk = 0x00010000U, .pos = 16}; /** @brief RX pin active level inversion. */
+static const field32_t USARTx_CR2_SWAP        = {.msk = 0x00008000U, .pos = 15}; /** @brief Swap TX/RX pins. */
+static const field32_t USARTx_CR2_LINEN       = {.msk = 0x00004000U, .pos = 14}; /** @brief LIN mode enable. */
+static const field32_t USARTx_CR2_STOP        = {.msk = 0x00003000U, .pos = 12}; /** @brief STOP bits. */
+static const field32_t USARTx_CR2_CLKEN       = {.msk = 0x00000800U, .pos = 11}; /** @brief Clock enable. */
+static const field32_t USARTx_CR2_CPOL        = {.msk = 0x00000400U, .pos = 10}; /** @brief Clock polarity. */
+static const field32_t USARTx_CR2_CPHA        = {.msk = 0x00000200U, .pos = 9};  /** @brief Clock phase. */
+static const field32_t USARTx_CR2_LBCL        = {.msk = 0x00000100U, .pos = 8};  /** @brief Last bit clock pulse. */
+static const field32_t USARTx_CR2_LBDIE       = {.msk = 0x00000040U, .pos = 6};  /** @brief LIN break detection interrupt enable. */
+static const field32_t USARTx_CR2_LBDL        = {.msk = 0x00000020U, .pos = 5};  /** @brief LIN break detection length. */
+static const field32_t USARTx_CR2_ADDM7       = {.msk = 0x00000010U, .pos = 4};  /** @brief 7-bit Address Detection/4-bit Address Detection. */
+static const field32_t USARTx_CR2_DIS_NSS     = {.msk = 0x00000008U, .pos = 3};  /** @brief When the DSI_NSS bit is set, the NSS pin input is ignored. */
+static const field32_t USARTx_CR2_SLVEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Synchronous Slave mode enable. */
+static const field32_t USARTx_CR3_TXFTCFG     = {.msk = 0xE0000000U, .pos = 29}; /** @brief TXFIFO threshold configuration. */
+static const field32_t USARTx_CR3_RXFTIE      = {.msk = 0x10000000U, .pos = 28}; /** @brief RXFIFO threshold interrupt enable. */
+static const field32_t USARTx_CR3_RXFTCFG     = {.msk = 0x0E000000U, .pos = 25}; /** @brief Receive FIFO threshold configuration. */
+static const field32_t USARTx_CR3_TCBGTIE     = {.msk = 0x01000000U, .pos = 24}; /** @brief Transmission Complete before guard time, interrupt enable. */
+static const field32_t USARTx_CR3_TXFTIE      = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO threshold interrupt enable. */
+static const field32_t USARTx_CR3_WUFIE       = {.msk = 0x00400000U, .pos = 22}; /** @brief Wakeup from Stop mode interrupt enable. */
+static const field32_t USARTx_CR3_WUS         = {.msk = 0x00300000U, .pos = 20}; /** @brief Wakeup from Stop mode interrupt flag selection. */
+static const field32_t USARTx_CR3_SCARCNT     = {.msk = 0x000E0000U, .pos = 17}; /** @brief Smartcard auto-retry count. */
+static const field32_t USARTx_CR3_DEP         = {.msk = 0x00008000U, .pos = 15}; /** @brief Driver enable polarity selection. */
+static const field32_t USARTx_CR3_DEM         = {.msk = 0x00004000U, .pos = 14}; /** @brief Driver enable mode. */
+static const field32_t USARTx_CR3_DDRE        = {.msk = 0x00002000U, .pos = 13}; /** @brief DMA Disable on Reception Error. */
+static const field32_t USARTx_CR3_OVRDIS      = {.msk = 0x00001000U, .pos = 12}; /** @brief Overrun Disable. */
+static const field32_t USARTx_CR3_ONEBIT      = {.msk = 0x00000800U, .pos = 11}; /** @brief One sample bit method enable. */
+static const field32_t USARTx_CR3_CTSIE       = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS interrupt enable. */
+static const field32_t USARTx_CR3_CTSE        = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS enable. */
+static const field32_t USARTx_CR3_RTSE        = {.msk = 0x00000100U, .pos = 8};  /** @brief RTS enable. */
+static const field32_t USARTx_CR3_DMAT        = {.msk = 0x00000080U, .pos = 7};  /** @brief DMA enable transmitter. */
+static const field32_t USARTx_CR3_DMAR        = {.msk = 0x00000040U, .pos = 6};  /** @brief DMA enable receiver. */
+static const field32_t USARTx_CR3_SCEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief Smartcard mode enable. */
+static const field32_t USARTx_CR3_NACK        = {.msk = 0x00000010U, .pos = 4};  /** @brief Smartcard NACK enable. */
+static const field32_t USARTx_CR3_HDSEL       = {.msk = 0x00000008U, .pos = 3};  /** @brief Half-duplex selection. */
+static const field32_t USARTx_CR3_IRLP        = {.msk = 0x00000004U, .pos = 2};  /** @brief Ir low-power. */
+static const field32_t USARTx_CR3_IREN        = {.msk = 0x00000002U, .pos = 1};  /** @brief Ir mode enable. */
+static const field32_t USARTx_CR3_EIE         = {.msk = 0x00000001U, .pos = 0};  /** @brief Error interrupt enable. */
+static const field32_t USARTx_BRR_BRR_4_15    = {.msk = 0x0000FFF0U, .pos = 4};  /** @brief DIV_Mantissa. */
+static const field32_t USARTx_BRR_BRR_0_3     = {.msk = 0x0000000FU, .pos = 0};  /** @brief DIV_Fraction. */
+static const field32_t USARTx_GTPR_GT         = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Guard time value. */
+static const field32_t USARTx_GTPR_PSC        = {.msk = 0x000000FFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t USARTx_RTOR_BLEN       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Block Length. */
+static const field32_t USARTx_RTOR_RTO        = {.msk = 0x00FFFFFFU, .pos = 0};  /** @brief Receiver timeout value. */
+static const field32_t USARTx_RQR_TXFRQ       = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit data flush request. */
+static const field32_t USARTx_RQR_RXFRQ       = {.msk = 0x00000008U, .pos = 3};  /** @brief Receive data flush request. */
+static const field32_t USARTx_RQR_MMRQ        = {.msk = 0x00000004U, .pos = 2};  /** @brief Mute mode request. */
+static const field32_t USARTx_RQR_SBKRQ       = {.msk = 0x00000002U, .pos = 1};  /** @brief Send break request. */
+static const field32_t USARTx_RQR_ABRRQ       = {.msk = 0x00000001U, .pos = 0};  /** @brief Auto baud rate request. */
+static const field32_t USARTx_ISR_TXFT        = {.msk = 0x08000000U, .pos = 27}; /** @brief TXFIFO threshold flag. */
+static const field32_t USARTx_ISR_RXFT        = {.msk = 0x04000000U, .pos = 26}; /** @brief RXFIFO threshold flag. */
+static const field32_t USARTx_ISR_TCBGT       = {.msk = 0x02000000U, .pos = 25}; /** @brief Transmission complete before guard time flag. */
+static const field32_t USARTx_ISR_RXFF        = {.msk = 0x01000000U, .pos = 24}; /** @brief RXFIFO Full. */
+static const field32_t USARTx_ISR_TXFE        = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO Empty. */
+static const field32_t USARTx_ISR_REACK       = {.msk = 0x00400000U, .pos = 22}; /** @brief REACK. */
+static const field32_t USARTx_ISR_TEACK       = {.msk = 0x00200000U, .pos = 21}; /** @brief TEACK. */
+static const field32_t USARTx_ISR_WUF         = {.msk = 0x00100000U, .pos = 20}; /** @brief WUF. */
+static const field32_t USARTx_ISR_RWU         = {.msk = 0x00080000U, .pos = 19}; /** @brief RWU. */
+static const field32_t USARTx_ISR_SBKF        = {.msk = 0x00040000U, .pos = 18}; /** @brief SBKF. */
+static const field32_t USARTx_ISR_CMF         = {.msk = 0x00020000U, .pos = 17}; /** @brief CMF. */
+static const field32_t USARTx_ISR_BUSY        = {.msk = 0x00010000U, .pos = 16}; /** @brief BUSY. */
+static const field32_t USARTx_ISR_ABRF        = {.msk = 0x00008000U, .pos = 15}; /** @brief ABRF. */
+static const field32_t USARTx_ISR_ABRE        = {.msk = 0x00004000U, .pos = 14}; /** @brief ABRE. */
+static const field32_t USARTx_ISR_UDR         = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI slave underrun error flag. */
+static const field32_t USARTx_ISR_EOBF        = {.msk = 0x00001000U, .pos = 12}; /** @brief EOBF. */
+static const field32_t USARTx_ISR_RTOF        = {.msk = 0x00000800U, .pos = 11}; /** @brief RTOF. */
+static const field32_t USARTx_ISR_CTS         = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS. */
+static const field32_t USARTx_ISR_CTSIF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTSIF. */
+static const field32_t USARTx_ISR_LBDF        = {.msk = 0x00000100U, .pos = 8};  /** @brief LBDF. */
+static const field32_t USARTx_ISR_TXE         = {.msk = 0x00000080U, .pos = 7};  /** @brief TXE. */
+static const field32_t USARTx_ISR_TC          = {.msk = 0x00000040U, .pos = 6};  /** @brief TC. */
+static const field32_t USARTx_ISR_RXNE        = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE. */
+static const field32_t USARTx_ISR_IDLE        = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE. */
+static const field32_t USARTx_ISR_ORE         = {.msk = 0x00000008U, .pos = 3};  /** @brief ORE. */
+static const field32_t USARTx_ISR_NF          = {.msk = 0x00000004U, .pos = 2};  /** @brief NF. */
+static const field32_t USARTx_ISR_FE          = {.msk = 0x00000002U, .pos = 1};  /** @brief FE. */
+static const field32_t USARTx_ISR_PE          = {.msk = 0x00000001U, .pos = 0};  /** @brief PE. */
+static const field32_t USARTx_ICR_WUCF        = {.msk = 0x00100000U, .pos = 20}; /** @brief Wakeup from Stop mode clear flag. */
+static const field32_t USARTx_ICR_CMCF        = {.msk = 0x00020000U, .pos = 17}; /** @brief Character match clear flag. */
+static const field32_t USARTx_ICR_UDRCF       = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI slave underrun clear flag. */
+static const field32_t USARTx_ICR_EOBCF       = {.msk = 0x00001000U, .pos = 12}; /** @brief End of block clear flag. */
+static const field32_t USARTx_ICR_RTOCF       = {.msk = 0x00000800U, .pos = 11}; /** @brief Receiver timeout clear flag. */
+static const field32_t USARTx_ICR_CTSCF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS clear flag. */
+static const field32_t USARTx_ICR_LBDCF       = {.msk = 0x00000100U, .pos = 8};  /** @brief LIN break detection clear flag. */
+static const field32_t USARTx_ICR_TCBGTC      = {.msk = 0x00000080U, .pos = 7};  /** @brief Transmission complete before Guard time clear flag. */
+static const field32_t USARTx_ICR_TCCF        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete clear flag. */
+static const field32_t USARTx_ICR_TXFECF      = {.msk = 0x00000020U, .pos = 5};  /** @brief TXFIFO empty clear flag. */
+static const field32_t USARTx_ICR_IDLECF      = {.msk = 0x00000010U, .pos = 4};  /** @brief Idle line detected clear flag. */
+static const field32_t USARTx_ICR_ORECF       = {.msk = 0x00000008U, .pos = 3};  /** @brief Overrun error clear flag. */
+static const field32_t USARTx_ICR_NCF         = {.msk = 0x00000004U, .pos = 2};  /** @brief Noise detected clear flag. */
+static const field32_t USARTx_ICR_FECF        = {.msk = 0x00000002U, .pos = 1};  /** @brief Framing error clear flag. */
+static const field32_t USARTx_ICR_PECF        = {.msk = 0x00000001U, .pos = 0};  /** @brief Parity error clear flag. */
+static const field32_t USARTx_RDR_RDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Receive data value. */
+static const field32_t USARTx_TDR_TDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Transmit data value. */
+static const field32_t USARTx_PRESC_PRESCALER = {.msk = 0x0000000FU, .pos = 0};  /** @brief Clock prescaler. */
+
+/** @subsection Enumerated USARTx Register Field Definitions */
+
+/** @brief Word length. */
+static const field32_t USARTx_CR1_Mx[2] = {
+  [0] = {.msk = 0x00001000U, .pos = 12},
+  [1] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief DEAT0. */
+static const field32_t USARTx_CR1_DEATx[5] = {
+  [0] = {.msk = 0x00200000U, .pos = 21},
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief DEDT0. */
+static const field32_t USARTx_CR1_DEDTx[5] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief ABRMOD0. */
+static const field32_t USARTx_CR2_ABRMODx[2] = {
+  [0] = {.msk = 0x00200000U, .pos = 21},
+  [1] = {.msk = 0x00400000U, .pos = 22},
+};
+
+/**************************************************************************************************
+ * @section UARTx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated UARTx Register Definitions */
+
+/** @brief Control register 1. */
+static rw_reg32_t const UARTx_CR1[9] = {
+  [4] = (rw_reg32_t)0x40004C00U,
+  [5] = (rw_reg32_t)0x40005000U,
+  [7] = (rw_reg32_t)0x40007800U,
+  [8] = (rw_reg32_t)0x40007C00U,
+};
+
+/** @brief Control register 2. */
+static rw_reg32_t const UARTx_CR2[9] = {
+  [4] = (rw_reg32_t)0x40004C04U,
+  [5] = (rw_reg32_t)0x40005004U,
+  [7] = (rw_reg32_t)0x40007804U,
+  [8] = (rw_reg32_t)0x40007C04U,
+};
+
+/** @brief Control register 3. */
+static rw_reg32_t const UARTx_CR3[9] = {
+  [4] = (rw_reg32_t)0x40004C08U,
+  [5] = (rw_reg32_t)0x40005008U,
+  [7] = (rw_reg32_t)0x40007808U,
+  [8] = (rw_reg32_t)0x40007C08U,
+};
+
+/** @brief Baud rate register. */
+static rw_reg32_t const UARTx_BRR[9] = {
+  [4] = (rw_reg32_t)0x40004C0CU,
+  [5] = (rw_reg32_t)0x4000500CU,
+  [7] = (rw_reg32_t)0x4000780CU,
+  [8] = (rw_reg32_t)0x40007C0CU,
+};
+
+/** @brief Guard time and prescaler register. */
+static rw_reg32_t const UARTx_GTPR[9] = {
+  [4] = (rw_reg32_t)0x40004C10U,
+  [5] = (rw_reg32_t)0x40005010U,
+  [7] = (rw_reg32_t)0x40007810U,
+  [8] = (rw_reg32_t)0x40007C10U,
+};
+
+/** @brief Receiver timeout register. */
+static rw_reg32_t const UARTx_RTOR[9] = {
+  [4] = (rw_reg32_t)0x40004C14U,
+  [5] = (rw_reg32_t)0x40005014U,
+  [7] = (rw_reg32_t)0x40007814U,
+  [8] = (rw_reg32_t)0x40007C14U,
+};
+
+/** @brief Request register. */
+static rw_reg32_t const UARTx_RQR[9] = {
+  [4] = (rw_reg32_t)0x40004C18U,
+  [5] = (rw_reg32_t)0x40005018U,
+  [7] = (rw_reg32_t)0x40007818U,
+  [8] = (rw_reg32_t)0x40007C18U,
+};
+
+/** @brief Interrupt & status register. */
+static ro_reg32_t const UARTx_ISR[9] = {
+  [4] = (ro_reg32_t)0x40004C1CU,
+  [5] = (ro_reg32_t)0x4000501CU,
+  [7] = (ro_reg32_t)0x4000781CU,
+  [8] = (ro_reg32_t)0x40007C1CU,
+};
+
+/** @brief Interrupt flag clear register. */
+static rw_reg32_t const UARTx_ICR[9] = {
+  [4] = (rw_reg32_t)0x40004C20U,
+  [5] = (rw_reg32_t)0x40005020U,
+  [7] = (rw_reg32_t)0x40007820U,
+  [8] = (rw_reg32_t)0x40007C20U,
+};
+
+/** @brief Receive data register. */
+static ro_reg32_t const UARTx_RDR[9] = {
+  [4] = (ro_reg32_t)0x40004C24U,
+  [5] = (ro_reg32_t)0x40005024U,
+  [7] = (ro_reg32_t)0x40007824U,
+  [8] = (ro_reg32_t)0x40007C24U,
+};
+
+/** @brief Transmit data register. */
+static rw_reg32_t const UARTx_TDR[9] = {
+  [4] = (rw_reg32_t)0x40004C28U,
+  [5] = (rw_reg32_t)0x40005028U,
+  [7] = (rw_reg32_t)0x40007828U,
+  [8] = (rw_reg32_t)0x40007C28U,
+};
+
+/** @brief USART prescaler register. */
+static rw_reg32_t const UARTx_PRESC[9] = {
+  [4] = (rw_reg32_t)0x40004C2CU,
+  [5] = (rw_reg32_t)0x4000502CU,
+  [7] = (rw_reg32_t)0x4000782CU,
+  [8] = (rw_reg32_t)0x40007C2CU,
+};
+
+/** @subsection UARTx Register Field Definitions */
+
+static const field32_t UARTx_CR1_RXFFIE      = {.msk = 0x80000000U, .pos = 31}; /** @brief RXFIFO Full interrupt enable. */
+static const field32_t UARTx_CR1_TXFEIE      = {.msk = 0x40000000U, .pos = 30}; /** @brief TXFIFO empty interrupt enable. */
+static const field32_t UARTx_CR1_FIFOEN      = {.msk = 0x20000000U, .pos = 29}; /** @brief FIFO mode enable. */
+static const field32_t UARTx_CR1_M1          = {.msk = 0x10000000U, .pos = 28}; /** @brief Word length. */
+static const field32_t UARTx_CR1_EOBIE       = {.msk = 0x08000000U, .pos = 27}; /** @brief End of Block interrupt enable. */
+static const field32_t UARTx_CR1_RTOIE       = {.msk = 0x04000000U, .pos = 26}; /** @brief Receiver timeout interrupt enable. */
+static const field32_t UARTx_CR1_DEAT4       = {.msk = 0x02000000U, .pos = 25}; /** @brief Driver Enable assertion time. */
+static const field32_t UARTx_CR1_DEAT3       = {.msk = 0x01000000U, .pos = 24}; /** @brief DEAT3. */
+static const field32_t UARTx_CR1_DEAT2       = {.msk = 0x00800000U, .pos = 23}; /** @brief DEAT2. */
+static const field32_t UARTx_CR1_DEAT1       = {.msk = 0x00400000U, .pos = 22}; /** @brief DEAT1. */
+static const field32_t UARTx_CR1_DEAT0       = {.msk = 0x00200000U, .pos = 21}; /** @brief DEAT0. */
+static const field32_t UARTx_CR1_DEDT4       = {.msk = 0x00100000U, .pos = 20}; /** @brief Driver Enable de-assertion time. */
+static const field32_t UARTx_CR1_DEDT3       = {.msk = 0x00080000U, .pos = 19}; /** @brief DEDT3. */
+static const field32_t UARTx_CR1_DEDT2       = {.msk = 0x00040000U, .pos = 18}; /** @brief DEDT2. */
+static const field32_t UARTx_CR1_DEDT1       = {.msk = 0x00020000U, .pos = 17}; /** @brief DEDT1. */
+static const field32_t UARTx_CR1_DEDT0       = {.msk = 0x00010000U, .pos = 16}; /** @brief DEDT0. */
+static const field32_t UARTx_CR1_OVER8       = {.msk = 0x00008000U, .pos = 15}; /** @brief Oversampling mode. */
+static const field32_t UARTx_CR1_CMIE        = {.msk = 0x00004000U, .pos = 14}; /** @brief Character match interrupt enable. */
+static const field32_t UARTx_CR1_MME         = {.msk = 0x00002000U, .pos = 13}; /** @brief Mute mode enable. */
+static const field32_t UARTx_CR1_M0          = {.msk = 0x00001000U, .pos = 12}; /** @brief Word length. */
+static const field32_t UARTx_CR1_WAKE        = {.msk = 0x00000800U, .pos = 11}; /** @brief Receiver wakeup method. */
+static const field32_t UARTx_CR1_PCE         = {.msk = 0x00000400U, .pos = 10}; /** @brief Parity control enable. */
+static const field32_t UARTx_CR1_PS          = {.msk = 0x00000200U, .pos = 9};  /** @brief Parity selection. */
+static const field32_t UARTx_CR1_PEIE        = {.msk = 0x00000100U, .pos = 8};  /** @brief PE interrupt enable. */
+static const field32_t UARTx_CR1_TXEIE       = {.msk = 0x00000080U, .pos = 7};  /** @brief Interrupt enable. */
+static const field32_t UARTx_CR1_TCIE        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete interrupt enable. */
+static const field32_t UARTx_CR1_RXNEIE      = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE interrupt enable. */
+static const field32_t UARTx_CR1_IDLEIE      = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE interrupt enable. */
+static const field32_t UARTx_CR1_TE          = {.msk = 0x00000008U, .pos = 3};  /** @brief Transmitter enable. */
+static const field32_t UARTx_CR1_RE          = {.msk = 0x00000004U, .pos = 2};  /** @brief Receiver enable. */
+static const field32_t UARTx_CR1_UESM        = {.msk = 0x00000002U, .pos = 1};  /** @brief USART enable in Stop mode. */
+static const field32_t UARTx_CR1_UE          = {.msk = 0x00000001U, .pos = 0};  /** @brief USART enable. */
+static const field32_t UARTx_CR2_ADD4_7      = {.msk = 0xF0000000U, .pos = 28}; /** @brief Address of the USART node. */
+static const field32_t UARTx_CR2_ADD0_3      = {.msk = 0x0F000000U, .pos = 24}; /** @brief Address of the USART node. */
+static const field32_t UARTx_CR2_RTOEN       = {.msk = 0x00800000U, .pos = 23}; /** @brief Receiver timeout enable. */
+static const field32_t UARTx_CR2_ABRMOD1     = {.msk = 0x00400000U, .pos = 22}; /** @brief Auto baud rate mode. */
+static const field32_t UARTx_CR2_ABRMOD0     = {.msk = 0x00200000U, .pos = 21}; /** @brief ABRMOD0. */
+static const field32_t UARTx_CR2_ABREN       = {.msk = 0x00100000U, .pos = 20}; /** @brief Auto baud rate enable. */
+static const field32_t UARTx_CR2_MSBFIRST    = {.msk = 0x00080000U, .pos = 19}; /** @brief Most significant bit first. */
+static const field32_t UARTx_CR2_TAINV       = {.msk = 0x00040000U, .pos = 18}; /** @brief Binary data inversion. */
+static const field32_t UARTx_CR2_TXINV       = {.msk = 0x00020000U, .pos = 17}; /** @brief TX pin active level inversion. */
+static const field32_t UARTx_CR2_RXINV       = {.msk = 0x00010000U, .pos = 16}; /** @brief RX pin active level inversion. */
+static const field32_t UARTx_CR2_SWAP        = {.msk = 0x00008000U, .pos = 15}; /** @brief Swap TX/RX pins. */
+static const field32_t UARTx_CR2_LINEN       = {.msk = 0x00004000U, .pos = 14}; /** @brief LIN mode enable. */
+static const field32_t UARTx_CR2_STOP        = {.msk = 0x00003000U, .pos = 12}; /** @brief STOP bits. */
+static const field32_t UARTx_CR2_CLKEN       = {.msk = 0x00000800U, .pos = 11}; /** @brief Clock enable. */
+static const field32_t UARTx_CR2_CPOL        = {.msk = 0x00000400U, .pos = 10}; /** @brief Clock polarity. */
+static const field32_t UARTx_CR2_CPHA        = {.msk = 0x00000200U, .pos = 9};  /** @brief Clock phase. */
+static const field32_t UARTx_CR2_LBCL        = {.msk = 0x00000100U, .pos = 8};  /** @brief Last bit clock pulse. */
+static const field32_t UARTx_CR2_LBDIE       = {.msk = 0x00000040U, .pos = 6};  /** @brief LIN break detection interrupt enable. */
+static const field32_t UARTx_CR2_LBDL        = {.msk = 0x00000020U, .pos = 5};  /** @brief LIN break detection length. */
+static const field32_t UARTx_CR2_ADDM7       = {.msk = 0x00000010U, .pos = 4};  /** @brief 7-bit Address Detection/4-bit Address Detection. */
+static const field32_t UARTx_CR2_DIS_NSS     = {.msk = 0x00000008U, .pos = 3};  /** @brief When the DSI_NSS bit is set, the NSS pin input is ignored. */
+static const field32_t UARTx_CR2_SLVEN       = {.msk = 0x00000001U, .pos = 0};  /** @brief Synchronous Slave mode enable. */
+static const field32_t UARTx_CR3_TXFTCFG     = {.msk = 0xE0000000U, .pos = 29}; /** @brief TXFIFO threshold configuration. */
+static const field32_t UARTx_CR3_RXFTIE      = {.msk = 0x10000000U, .pos = 28}; /** @brief RXFIFO threshold interrupt enable. */
+static const field32_t UARTx_CR3_RXFTCFG     = {.msk = 0x0E000000U, .pos = 25}; /** @brief Receive FIFO threshold configuration. */
+static const field32_t UARTx_CR3_TCBGTIE     = {.msk = 0x01000000U, .pos = 24}; /** @brief Transmission Complete before guard time, interrupt enable. */
+static const field32_t UARTx_CR3_TXFTIE      = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO threshold interrupt enable. */
+static const field32_t UARTx_CR3_WUFIE       = {.msk = 0x00400000U, .pos = 22}; /** @brief Wakeup from Stop mode interrupt enable. */
+static const field32_t UARTx_CR3_WUS         = {.msk = 0x00300000U, .pos = 20}; /** @brief Wakeup from Stop mode interrupt flag selection. */
+static const field32_t UARTx_CR3_SCARCNT     = {.msk = 0x000E0000U, .pos = 17}; /** @brief Smartcard auto-retry count. */
+static const field32_t UARTx_CR3_DEP         = {.msk = 0x00008000U, .pos = 15}; /** @brief Driver enable polarity selection. */
+static const field32_t UARTx_CR3_DEM         = {.msk = 0x00004000U, .pos = 14}; /** @brief Driver enable mode. */
+static const field32_t UARTx_CR3_DDRE        = {.msk = 0x00002000U, .pos = 13}; /** @brief DMA Disable on Reception Error. */
+static const field32_t UARTx_CR3_OVRDIS      = {.msk = 0x00001000U, .pos = 12}; /** @brief Overrun Disable. */
+static const field32_t UARTx_CR3_ONEBIT      = {.msk = 0x00000800U, .pos = 11}; /** @brief One sample bit method enable. */
+static const field32_t UARTx_CR3_CTSIE       = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS interrupt enable. */
+static const field32_t UARTx_CR3_CTSE        = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS enable. */
+static const field32_t UARTx_CR3_RTSE        = {.msk = 0x00000100U, .pos = 8};  /** @brief RTS enable. */
+static const field32_t UARTx_CR3_DMAT        = {.msk = 0x00000080U, .pos = 7};  /** @brief DMA enable transmitter. */
+static const field32_t UARTx_CR3_DMAR        = {.msk = 0x00000040U, .pos = 6};  /** @brief DMA enable receiver. */
+static const field32_t UARTx_CR3_SCEN        = {.msk = 0x00000020U, .pos = 5};  /** @brief Smartcard mode enable. */
+static const field32_t UARTx_CR3_NACK        = {.msk = 0x00000010U, .pos = 4};  /** @brief Smartcard NACK enable. */
+static const field32_t UARTx_CR3_HDSEL       = {.msk = 0x00000008U, .pos = 3};  /** @brief Half-duplex selection. */
+static const field32_t UARTx_CR3_IRLP        = {.msk = 0x00000004U, .pos = 2};  /** @brief Ir low-power. */
+static const field32_t UARTx_CR3_IREN        = {.msk = 0x00000002U, .pos = 1};  /** @brief Ir mode enable. */
+static const field32_t UARTx_CR3_EIE         = {.msk = 0x00000001U, .pos = 0};  /** @brief Error interrupt enable. */
+static const field32_t UARTx_BRR_BRR_4_15    = {.msk = 0x0000FFF0U, .pos = 4};  /** @brief DIV_Mantissa. */
+static const field32_t UARTx_BRR_BRR_0_3     = {.msk = 0x0000000FU, .pos = 0};  /** @brief DIV_Fraction. */
+static const field32_t UARTx_GTPR_GT         = {.msk = 0x0000FF00U, .pos = 8};  /** @brief Guard time value. */
+static const field32_t UARTx_GTPR_PSC        = {.msk = 0x000000FFU, .pos = 0};  /** @brief Prescaler value. */
+static const field32_t UARTx_RTOR_BLEN       = {.msk = 0xFF000000U, .pos = 24}; /** @brief Block Length. */
+static const field32_t UARTx_RTOR_RTO        = {.msk = 0x00FFFFFFU, .pos = 0};  /** @brief Receiver timeout value. */
+static const field32_t UARTx_RQR_TXFRQ       = {.msk = 0x00000010U, .pos = 4};  /** @brief Transmit data flush request. */
+static const field32_t UARTx_RQR_RXFRQ       = {.msk = 0x00000008U, .pos = 3};  /** @brief Receive data flush request. */
+static const field32_t UARTx_RQR_MMRQ        = {.msk = 0x00000004U, .pos = 2};  /** @brief Mute mode request. */
+static const field32_t UARTx_RQR_SBKRQ       = {.msk = 0x00000002U, .pos = 1};  /** @brief Send break request. */
+static const field32_t UARTx_RQR_ABRRQ       = {.msk = 0x00000001U, .pos = 0};  /** @brief Auto baud rate request. */
+static const field32_t UARTx_ISR_TXFT        = {.msk = 0x08000000U, .pos = 27}; /** @brief TXFIFO threshold flag. */
+static const field32_t UARTx_ISR_RXFT        = {.msk = 0x04000000U, .pos = 26}; /** @brief RXFIFO threshold flag. */
+static const field32_t UARTx_ISR_TCBGT       = {.msk = 0x02000000U, .pos = 25}; /** @brief Transmission complete before guard time flag. */
+static const field32_t UARTx_ISR_RXFF        = {.msk = 0x01000000U, .pos = 24}; /** @brief RXFIFO Full. */
+static const field32_t UARTx_ISR_TXFE        = {.msk = 0x00800000U, .pos = 23}; /** @brief TXFIFO Empty. */
+static const field32_t UARTx_ISR_REACK       = {.msk = 0x00400000U, .pos = 22}; /** @brief REACK. */
+static const field32_t UARTx_ISR_TEACK       = {.msk = 0x00200000U, .pos = 21}; /** @brief TEACK. */
+static const field32_t UARTx_ISR_WUF         = {.msk = 0x00100000U, .pos = 20}; /** @brief WUF. */
+static const field32_t UARTx_ISR_RWU         = {.msk = 0x00080000U, .pos = 19}; /** @brief RWU. */
+static const field32_t UARTx_ISR_SBKF        = {.msk = 0x00040000U, .pos = 18}; /** @brief SBKF. */
+static const field32_t UARTx_ISR_CMF         = {.msk = 0x00020000U, .pos = 17}; /** @brief CMF. */
+static const field32_t UARTx_ISR_BUSY        = {.msk = 0x00010000U, .pos = 16}; /** @brief BUSY. */
+static const field32_t UARTx_ISR_ABRF        = {.msk = 0x00008000U, .pos = 15}; /** @brief ABRF. */
+static const field32_t UARTx_ISR_ABRE        = {.msk = 0x00004000U, .pos = 14}; /** @brief ABRE. */
+static const field32_t UARTx_ISR_UDR         = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI slave underrun error flag. */
+static const field32_t UARTx_ISR_EOBF        = {.msk = 0x00001000U, .pos = 12}; /** @brief EOBF. */
+static const field32_t UARTx_ISR_RTOF        = {.msk = 0x00000800U, .pos = 11}; /** @brief RTOF. */
+static const field32_t UARTx_ISR_CTS         = {.msk = 0x00000400U, .pos = 10}; /** @brief CTS. */
+static const field32_t UARTx_ISR_CTSIF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTSIF. */
+static const field32_t UARTx_ISR_LBDF        = {.msk = 0x00000100U, .pos = 8};  /** @brief LBDF. */
+static const field32_t UARTx_ISR_TXE         = {.msk = 0x00000080U, .pos = 7};  /** @brief TXE. */
+static const field32_t UARTx_ISR_TC          = {.msk = 0x00000040U, .pos = 6};  /** @brief TC. */
+static const field32_t UARTx_ISR_RXNE        = {.msk = 0x00000020U, .pos = 5};  /** @brief RXNE. */
+static const field32_t UARTx_ISR_IDLE        = {.msk = 0x00000010U, .pos = 4};  /** @brief IDLE. */
+static const field32_t UARTx_ISR_ORE         = {.msk = 0x00000008U, .pos = 3};  /** @brief ORE. */
+static const field32_t UARTx_ISR_NF          = {.msk = 0x00000004U, .pos = 2};  /** @brief NF. */
+static const field32_t UARTx_ISR_FE          = {.msk = 0x00000002U, .pos = 1};  /** @brief FE. */
+static const field32_t UARTx_ISR_PE          = {.msk = 0x00000001U, .pos = 0};  /** @brief PE. */
+static const field32_t UARTx_ICR_WUCF        = {.msk = 0x00100000U, .pos = 20}; /** @brief Wakeup from Stop mode clear flag. */
+static const field32_t UARTx_ICR_CMCF        = {.msk = 0x00020000U, .pos = 17}; /** @brief Character match clear flag. */
+static const field32_t UARTx_ICR_UDRCF       = {.msk = 0x00002000U, .pos = 13}; /** @brief SPI slave underrun clear flag. */
+static const field32_t UARTx_ICR_EOBCF       = {.msk = 0x00001000U, .pos = 12}; /** @brief End of block clear flag. */
+static const field32_t UARTx_ICR_RTOCF       = {.msk = 0x00000800U, .pos = 11}; /** @brief Receiver timeout clear flag. */
+static const field32_t UARTx_ICR_CTSCF       = {.msk = 0x00000200U, .pos = 9};  /** @brief CTS clear flag. */
+static const field32_t UARTx_ICR_LBDCF       = {.msk = 0x00000100U, .pos = 8};  /** @brief LIN break detection clear flag. */
+static const field32_t UARTx_ICR_TCBGTC      = {.msk = 0x00000080U, .pos = 7};  /** @brief Transmission complete before Guard time clear flag. */
+static const field32_t UARTx_ICR_TCCF        = {.msk = 0x00000040U, .pos = 6};  /** @brief Transmission complete clear flag. */
+static const field32_t UARTx_ICR_TXFECF      = {.msk = 0x00000020U, .pos = 5};  /** @brief TXFIFO empty clear flag. */
+static const field32_t UARTx_ICR_IDLECF      = {.msk = 0x00000010U, .pos = 4};  /** @brief Idle line detected clear flag. */
+static const field32_t UARTx_ICR_ORECF       = {.msk = 0x00000008U, .pos = 3};  /** @brief Overrun error clear flag. */
+static const field32_t UARTx_ICR_NCF         = {.msk = 0x00000004U, .pos = 2};  /** @brief Noise detected clear flag. */
+static const field32_t UARTx_ICR_FECF        = {.msk = 0x00000002U, .pos = 1};  /** @brief Framing error clear flag. */
+static const field32_t UARTx_ICR_PECF        = {.msk = 0x00000001U, .pos = 0};  /** @brief Parity error clear flag. */
+static const field32_t UARTx_RDR_RDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Receive data value. */
+static const field32_t UARTx_TDR_TDR         = {.msk = 0x000001FFU, .pos = 0};  /** @brief Transmit data value. */
+static const field32_t UARTx_PRESC_PRESCALER = {.msk = 0x0000000FU, .pos = 0};  /** @brief Clock prescaler. */
+
+/** @subsection Enumerated UARTx Register Field Definitions */
+
+/** @brief Word length. */
+static const field32_t UARTx_CR1_Mx[2] = {
+  [0] = {.msk = 0x00001000U, .pos = 12},
+  [1] = {.msk = 0x10000000U, .pos = 28},
+};
+
+/** @brief DEAT0. */
+static const field32_t UARTx_CR1_DEATx[5] = {
+  [0] = {.msk = 0x00200000U, .pos = 21},
+  [1] = {.msk = 0x00400000U, .pos = 22},
+  [2] = {.msk = 0x00800000U, .pos = 23},
+  [3] = {.msk = 0x01000000U, .pos = 24},
+  [4] = {.msk = 0x02000000U, .pos = 25},
+};
+
+/** @brief DEDT0. */
+static const field32_t UARTx_CR1_DEDTx[5] = {
+  [0] = {.msk = 0x00010000U, .pos = 16},
+  [1] = {.msk = 0x00020000U, .pos = 17},
+  [2] = {.msk = 0x00040000U, .pos = 18},
+  [3] = {.msk = 0x00080000U, .pos = 19},
+  [4] = {.msk = 0x00100000U, .pos = 20},
+};
+
+/** @brief ABRMOD0. */
+static const field32_t UARTx_CR2_ABRMODx[2] = {
+  [0] = {.msk = 0x00200000U, .pos = 21},
+  [1] = {.msk = 0x00400000U, .pos = 22},
+};
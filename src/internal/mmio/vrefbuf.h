@@ -0,0 +1,46 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/vrefbuf.h
+ * @authors UW SARP
+ * @brief Registers and fields of VREFBUF.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section VREFBUF Definitions
+ **************************************************************************************************/
+
+/** @subsection VREFBUF Register Definitions */
+
+static rw_reg32_t const VREFBUF_CSR = (rw_reg32_t)0x58003C00U; /** @brief VREFBUF control and status register. */
+static rw_reg32_t const VREFBUF_CCR = (rw_reg32_t)0x58003C04U; /** @brief VREFBUF calibration control register. */
+
+/** @subsection VREFBUF Register Field Definitions */
+
+static const field32_t VREFBUF_CSR_ENVR = {.msk = 0x00000001U, .pos = 0}; /** @brief Voltage reference buffer mode enable This bit is used to enable the voltage reference buffer mode. */
+static const field32_t VREFBUF_CSR_HIZ  = {.msk = 0x00000002U, .pos = 1}; /** @brief High impedance mode This bit controls the analog switch to connect or not the VREF+ pin. Refer to Table196: VREF buffer modes for the mode descriptions depending on ENVR bit configuration. */
+static const field32_t VREFBUF_CSR_VRR  = {.msk = 0x00000008U, .pos = 3}; /** @brief Voltage reference buffer ready. */
+static const field32_t VREFBUF_CSR_VRS  = {.msk = 0x00000070U, .pos = 4}; /** @brief Voltage reference scale These bits select the value generated by the voltage reference buffer. Other: Reserved. */
+static const field32_t VREFBUF_CCR_TRIM = {.msk = 0x0000003FU, .pos = 0}; /** @brief Trimming code These bits are automatically initialized after reset with the trimming value stored in the Flash memory during the production test. Writing into these bits allows to tune the internal reference buffer voltage. */
@@ -0,0 +1,62 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @file internal/mmio/wwdgx.h
+ * @authors UW SARP
+ * @brief Registers and fields of WWDG1, WWDG2.
+ * @note - Generated from port.svd by tools/svd2mmio.py, do not edit.
+ */
+
+#pragma once
+#include "internal/mmio_base.h"
+
+#ifdef MMIO_WHOLE_CHIP
+#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"
+#endif
+#define MMIO_PERIPHERAL_HEADERS
+
+/**************************************************************************************************
+ * @section WWDGx Definitions
+ **************************************************************************************************/
+
+/** @subsection Enumerated WWDGx Register Definitions */
+
+/** @brief Control register. */
+static rw_reg32_t const WWDGx_CR[3] = {
+  [1] = (rw_reg32_t)0x50003000U,
+  [2] = (rw_reg32_t)0x40002C00U,
+};
+
+/** @brief Configuration register. */
+static rw_reg32_t const WWDGx_CFR[3] = {
+  [1] = (rw_reg32_t)0x50003004U,
+  [2] = (rw_reg32_t)0x40002C04U,
+};
+
+/** @brief Status register. */
+static rw_reg32_t const WWDGx_SR[3] = {
+  [1] = (rw_reg32_t)0x50003008U,
+  [2] = (rw_reg32_t)0x40002C08U,
+};
+
+/** @subsection WWDGx Register Field Definitions */
+
+static const field32_t WWDGx_CR_T      = {.msk = 0x0000007FU, .pos = 0};  /** @brief 7-bit counter (MSB to LSB) These bits contain the value of the watchdog counter. It is decremented every (4096 x 2WDGTB[1:0]) PCLK cycles. A reset is produced when it is decremented from 0x40 to 0x3F (T6 becomes cleared). */
+static const field32_t WWDGx_CR_WDGA   = {.msk = 0x00000080U, .pos = 7};  /** @brief Activation bit This bit is set by software and only cleared by hardware after a reset. When WDGA=1, the watchdog can generate a reset. */
+static const field32_t WWDGx_CFR_W     = {.msk = 0x0000007FU, .pos = 0};  /** @brief 7-bit window value These bits contain the window value to be compared to the downcounter. */
+static const field32_t WWDGx_CFR_WDGTB = {.msk = 0x00001800U, .pos = 11}; /** @brief Timer base The time base of the prescaler can be modified as follows:. */
+static const field32_t WWDGx_CFR_EWI   = {.msk = 0x00000200U, .pos = 9};  /** @brief Early wakeup interrupt When set, an interrupt occurs whenever the counter reaches the value 0x40. This interrupt is only cleared by hardware after a reset. */
+static const field32_t WWDGx_SR_EWIF   = {.msk = 0x00000001U, .pos = 0};  /** @brief Early wakeup interrupt flag This bit is set by hardware when the counter has reached the value 0x40. It must be cleared by software by writing 0. A write of 1 has no effect. This bit is also set if the interrupt is not enabled. */
@@ -0,0 +1,450 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * @file modules/internal/include/internal/mmio_base.h
+ * @authors Aaron McBride
+ * @brief Register and field types and the field access macros shared by all mmio headers.
+ * @note - Included by internal/mmio.h (the whole chip) and by every generated per-peripheral
+ *         header in internal/mmio/, so drivers can use either without redefining these.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Check every shadowed register against the hardware before each shadowed write and report drift
+// through mmio_shadow_fault() (see Shadow Registers below).  Usually set from the build (-DMMIO_SHADOW_CHECK).
+// #define MMIO_SHADOW_CHECK
+
+/**************************************************************************************************
+ * @section MMIO Type Definitions
+ **************************************************************************************************/
+
+typedef volatile uint64_t* rw_reg64_t; /** @brief 64 bit read-write register pointer type. */
+typedef volatile uint32_t* rw_reg32_t; /** @brief 32 bit read-write register pointer type. */
+typedef volatile uint16_t* rw_reg16_t; /** @brief 16 bit read-write register pointer type. */
+typedef volatile uint8_t*  rw_reg8_t;  /** @brief 8 bit read-write register pointer type. */
+
+typedef const volatile uint64_t* ro_reg64_t; /** @brief 64 bit read-only register pointer type. */
+typedef const volatile uint32_t* ro_reg32_t; /** @brief 32 bit read-only register pointer type. */
+typedef const volatile uint16_t* ro_reg16_t; /** @brief 16 bit read-only register pointer type. */
+typedef const volatile uint8_t*  ro_reg8_t;  /** @brief 8 bit read-only register pointer type. */
+
+typedef struct { uint64_t msk; int32_t pos; } field64_t; /** @brief 64 bit register field type. */
+typedef struct { uint32_t msk; int32_t pos; } field32_t; /** @brief 32 bit register field type. */
+typedef struct { uint16_t msk; int32_t pos; } field16_t; /** @brief 16 bit register field type. */
+typedef struct { uint8_t  msk; int32_t pos; } field8_t;  /** @brief 8 bit register field type. */
+
+typedef struct { uint64_t msk; uint64_t val; } field_update_t; /** @brief Pending write to one or more fields (see WRITE_FIELDS). */
+
+typedef struct { uint32_t val; bool valid; } shadow32_t; /** @brief RAM copy of a 32 bit register (see SHADOW_WRITE_FIELDS). */
+
+/**************************************************************************************************
+ * @section MMIO Utilities
+ **************************************************************************************************/
+
+/**
+ * @brief Constructs a field struct from a position and width.
+ * @param ftype (type) The type of the field to construct.
+ * @param pos (integral value) The position of the field.
+ * @param width (integral value) The width of the field.
+ * @returns (field_t) A struct which defines the location of the specified field.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define MAKE_FIELD(ftype, pos, width) ({ \
+  const __auto_type _pos = (pos); \
+  const __auto_type _width = (width); \
+  (ftype) { \
+    .msk = ((UINT64_C(1) << (_width)) - 1U) << _pos, \
+    .pos = _pos \
+  }; \
+})
+
+/**
+ * @brief Determines if a value fits in the range of a field.
+ * @param field (field_t) The target field.
+ * @param value (integral value) The target value.
+ * @returns (bool) True if @p [value] can be represented in @p [field], 
+ *          or false otherwise.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define IN_RANGE_FIELD(field, value) ({ \
+  const __auto_type _field = (field); \
+  const __auto_type _value = (value); \
+  (_value & ~(_field.msk >> _field.pos)) == 0U; \
+})
+
+/**
+ * @brief Writes a value to a field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @param value (integral value) The value to write to the field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define WRITE_FIELD(dst, field, value) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+  const __auto_type _value = (value); \
+ *_dst = (*_dst & ~_field.msk) | ((_value << _field.pos) & _field.msk); \
+})
+
+/**
+ * @brief Writes a value to a write-only field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @param value (integral value) The value to write to the field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define WRITE_WO_FIELD(dst, field, value) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+  const __auto_type _value = (value); \
+ *_dst = (_value << _field.pos) & _field.msk; \
+})
+
+/**
+ * @brief Sets all the bits in a field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SET_FIELD(dst, field) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+  *_dst |= _field.msk; \
+})
+
+/**
+ * @brief Sets all the bits in a write-only field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SET_WO_FIELD(dst, field) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+ *_dst = _field.msk; \
+})
+
+/**
+ * @brief Clears all the bits in a field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define CLR_FIELD(dst, field) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+ *_dst &= ~_field.msk; \
+})
+
+/**
+ * @brief Toggles all the bits in a field.
+ * @param dst (integral pointer) The location to write to.
+ * @param field (field_t) The target field.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define TOGL_FIELD(dst, field) ({ \
+  const __auto_type _dst = (dst); \
+  const __auto_type _field = (field); \
+ *_dst ^= _field.msk; \
+})
+
+/**
+ * @brief Reads the value of a field
+ * @param src (integral pointer) The location to read from.
+ * @param field (field_t) The target field.
+ * @returns (integral value) The value of @p [field] in @p [src].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define READ_FIELD(src, field) ({ \
+  const __auto_type _src = (src); \
+  const __auto_type _field = (field); \
+  (*_src & _field.msk) >> _field.pos; \
+})
+
+/**
+ * @brief Determines if a field is set.
+ * @param src (integral pointer) The location to read from.
+ * @param field (field_t) The target field.
+ * @returns (bool) True if all bits  @p [field] in @p [src] are set, or false otherwise.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define IS_FIELD_SET(src, field) ({ \
+  const __auto_type _src = (src); \
+  const __auto_type _field = (field); \
+  (*_src & _field.msk) == _field.msk; \
+})
+
+/**
+ * @brief Determines if a field is clear.
+ * @param src (integral pointer) The location to read from.
+ * @param field (field_t) The target field.
+ * @returns (bool) True if all bits in @p [field] in @p [src] are clear, or false otherwise.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define IS_FIELD_CLR(src, field) ({ \
+  const __auto_type _src = (src); \
+  const __auto_type _field = (field); \
+  (*_src & _field.msk) == 0U; \
+})
+
+#define TO_FIELD(value, field) ({ \
+  const __auto_type _value = (value); \
+  const __auto_type _field = (field); \
+  (_value << _field.pos) & _field.msk; \
+})
+
+/**************************************************************************************************
+ * @section Batched Field Writes
+ **************************************************************************************************/
+
+/**
+ * @brief Builds a field update which sets all the bits in a field.
+ * @param field (field_t) The target field.
+ * @returns (field_update_t) An update for WRITE_FIELDS or WRITE_WO_FIELDS.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define FIELD_SET(field) ({ \
+  const __auto_type _field = (field); \
+  (field_update_t){.msk = _field.msk, .val = _field.msk}; \
+})
+
+/**
+ * @brief Builds a field update which clears all the bits in a field.
+ * @param field (field_t) The target field.
+ * @returns (field_update_t) An update for WRITE_FIELDS or WRITE_WO_FIELDS.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define FIELD_CLR(field) ({ \
+  const __auto_type _field = (field); \
+  (field_update_t){.msk = _field.msk, .val = 0U}; \
+})
+
+/**
+ * @brief Builds a field update which writes a value to a field.
+ * @param field (field_t) The target field.
+ * @param value (integral value) The value to write to the field.
+ * @returns (field_update_t) An update for WRITE_FIELDS or WRITE_WO_FIELDS.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define FIELD_VAL(field, value) ({ \
+  const __auto_type _field = (field); \
+  const __auto_type _value = (value); \
+  (field_update_t){.msk = _field.msk, .val = ((uint64_t)_value << _field.pos) & _field.msk}; \
+})
+
+/**
+ * @brief Applies several field updates to a register with a single read-modify-write.
+ * @param dst (integral pointer) The location to write to.
+ * @param ... (field_update_t) 1 to 16 updates (FIELD_SET, FIELD_CLR or FIELD_VAL), applied in order,
+ *            so a later update of the same bits wins.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ * @note - With optimization on and constant fields, the updates fold into one mask and value at
+ *         compile time: WRITE_FIELDS(r, FIELD_SET(a), FIELD_CLR(b)) is one load, and, or and store,
+ *         where SET_FIELD(r, a); CLR_FIELD(r, b); is two of each.
+ */
+#define WRITE_FIELDS(dst, ...) ({ \
+  const __auto_type _dst = (dst); \
+  field_update_t _upd = {.msk = 0U, .val = 0U}; \
+  _MMIO_MERGE_UPDATES(_upd, __VA_ARGS__) \
+  *_dst = (*_dst & ~_upd.msk) | _upd.val; \
+})
+
+/**
+ * @brief Writes several fields of a write-only register with a single store.
+ * @param dst (integral pointer) The location to write to.
+ * @param ... (field_update_t) 1 to 16 updates (FIELD_SET, FIELD_CLR or FIELD_VAL), applied in order.
+ * @returns (integral value) The value assigned to @p [dst].
+ * @note - All bits not covered by an update are written as zero.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define WRITE_WO_FIELDS(dst, ...) ({ \
+  const __auto_type _dst = (dst); \
+  field_update_t _upd = {.msk = 0U, .val = 0U}; \
+  _MMIO_MERGE_UPDATES(_upd, __VA_ARGS__) \
+  *_dst = _upd.val; \
+})
+
+/** @brief Internal macros. Merges each update into @p [upd], one statement per update. */
+#define _MMIO_MERGE_UPDATES(upd, ...) \
+  _MMIO_CAT(_MMIO_MERGE_, _MMIO_COUNT(__VA_ARGS__))(upd, __VA_ARGS__)
+#define _MMIO_CAT(a, b) _MMIO_CAT_(a, b)
+#define _MMIO_CAT_(a, b) a##b
+#define _MMIO_COUNT(...) \
+  _MMIO_COUNT_(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _MMIO_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, n, ...) n
+#define _MMIO_MERGE_1(upd, u) { \
+  const field_update_t _u = (u); \
+  upd.msk |= _u.msk; \
+  upd.val = (upd.val & ~_u.msk) | _u.val; \
+}
+#define _MMIO_MERGE_2(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_1(upd, __VA_ARGS__)
+#define _MMIO_MERGE_3(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_2(upd, __VA_ARGS__)
+#define _MMIO_MERGE_4(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_3(upd, __VA_ARGS__)
+#define _MMIO_MERGE_5(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_4(upd, __VA_ARGS__)
+#define _MMIO_MERGE_6(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_5(upd, __VA_ARGS__)
+#define _MMIO_MERGE_7(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_6(upd, __VA_ARGS__)
+#define _MMIO_MERGE_8(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_7(upd, __VA_ARGS__)
+#define _MMIO_MERGE_9(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_8(upd, __VA_ARGS__)
+#define _MMIO_MERGE_10(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_9(upd, __VA_ARGS__)
+#define _MMIO_MERGE_11(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_10(upd, __VA_ARGS__)
+#define _MMIO_MERGE_12(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_11(upd, __VA_ARGS__)
+#define _MMIO_MERGE_13(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_12(upd, __VA_ARGS__)
+#define _MMIO_MERGE_14(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_13(upd, __VA_ARGS__)
+#define _MMIO_MERGE_15(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_14(upd, __VA_ARGS__)
+#define _MMIO_MERGE_16(upd, u, ...) _MMIO_MERGE_1(upd, u) _MMIO_MERGE_15(upd, __VA_ARGS__)
+
+/**************************************************************************************************
+ * @section Shadow Registers
+ **************************************************************************************************/
+
+/**
+ * A shadow32_t keeps a RAM copy of a configuration register, so a field update is computed from the
+ * copy and only written to the register: no read of the peripheral bus, which costs the M7 far more
+ * than a write.  Drivers opt in per register by declaring a zeroed shadow32_t next to it and using
+ * the SHADOW_ macros for every write to that register.
+ *
+ * - The first write loads the copy from the register (once), SHADOW_INVALIDATE forces a reload.  Call
+ *   it whenever the register may have changed behind the shadow's back: the peripheral was reset or
+ *   its clock was off during the first write (reads then return 0).
+ * - Only for registers that hardware never changes and only one context writes (mode and
+ *   configuration registers, not status, data or ODR).
+ * - With MMIO_SHADOW_CHECK each shadowed write first reads the register and, if it differs from the
+ *   copy, calls mmio_shadow_fault() and reloads the copy from the register before applying the update.
+ */
+
+#ifdef MMIO_SHADOW_CHECK
+/**
+ * @brief Called when a shadowed register no longer matches its copy.  The default in
+ *        internal/mmio_shadow.c is weak and stops at a breakpoint on the target; define it to log instead.
+ * @param reg (rw_reg32_t) The register.
+ * @param shadow (uint32_t) The value the shadow expected.
+ * @param actual (uint32_t) The value read from the register.
+ */
+void mmio_shadow_fault(rw_reg32_t reg, uint32_t shadow, uint32_t actual);
+#endif
+
+/** @brief Internal function. Loads @p [shadow] from @p [reg] if needed, checking it with MMIO_SHADOW_CHECK. */
+static inline void _mmio_shadow_load(rw_reg32_t reg, shadow32_t* shadow) {
+  if (!shadow->valid) {
+    shadow->val = *reg;
+    shadow->valid = true;
+    return;
+  }
+#ifdef MMIO_SHADOW_CHECK
+  const uint32_t actual = *reg;
+  if (actual != shadow->val) {
+    mmio_shadow_fault(reg, shadow->val, actual);
+    shadow->val = actual;
+  }
+#endif
+}
+
+/**
+ * @brief Applies several field updates to a shadowed register with a single write.
+ * @param dst (rw_reg32_t) The register to write to.
+ * @param shadow (shadow32_t*) The register's shadow.
+ * @param ... (field_update_t) 1 to 16 updates (FIELD_SET, FIELD_CLR or FIELD_VAL), applied in order.
+ * @returns (uint32_t) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_WRITE_FIELDS(dst, shadow, ...) ({ \
+  const __auto_type _dst = (dst); \
+  shadow32_t* const _shadow = (shadow); \
+  field_update_t _upd = {.msk = 0U, .val = 0U}; \
+  _MMIO_MERGE_UPDATES(_upd, __VA_ARGS__) \
+  _mmio_shadow_load(_dst, _shadow); \
+  _shadow->val = (uint32_t)((_shadow->val & ~_upd.msk) | _upd.val); \
+  *_dst = _shadow->val; \
+})
+
+/**
+ * @brief Writes a value to a field of a shadowed register.
+ * @param dst (rw_reg32_t) The register to write to.
+ * @param shadow (shadow32_t*) The register's shadow.
+ * @param field (field32_t) The target field.
+ * @param value (integral value) The value to write to the field.
+ * @returns (uint32_t) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_WRITE_FIELD(dst, shadow, field, value) \
+  SHADOW_WRITE_FIELDS(dst, shadow, FIELD_VAL(field, value))
+
+/**
+ * @brief Sets all the bits in a field of a shadowed register.
+ * @param dst (rw_reg32_t) The register to write to.
+ * @param shadow (shadow32_t*) The register's shadow.
+ * @param field (field32_t) The target field.
+ * @returns (uint32_t) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_SET_FIELD(dst, shadow, field) \
+  SHADOW_WRITE_FIELDS(dst, shadow, FIELD_SET(field))
+
+/**
+ * @brief Clears all the bits in a field of a shadowed register.
+ * @param dst (rw_reg32_t) The register to write to.
+ * @param shadow (shadow32_t*) The register's shadow.
+ * @param field (field32_t) The target field.
+ * @returns (uint32_t) The value assigned to @p [dst].
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_CLR_FIELD(dst, shadow, field) \
+  SHADOW_WRITE_FIELDS(dst, shadow, FIELD_CLR(field))
+
+/**
+ * @brief Reads the value of a field from a register's shadow, without touching the register.
+ * @param shadow (shadow32_t*) The register's shadow, which must have been written through already.
+ * @param field (field32_t) The target field.
+ * @returns (integral value) The value of @p [field] in the shadow.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_READ_FIELD(shadow, field) ({ \
+  const shadow32_t* const _shadow = (shadow); \
+  const __auto_type _field = (field); \
+  (_shadow->val & _field.msk) >> _field.pos; \
+})
+
+/**
+ * @brief Makes the next shadowed write reload the shadow from its register.
+ * @param shadow (shadow32_t*) The shadow to invalidate.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_INVALIDATE(shadow) ({ \
+  shadow32_t* const _shadow = (shadow); \
+  _shadow->valid = false; \
+})
+
+/**
+ * @brief Determines if a shadow matches its register, for debug checks and tests.
+ * @param dst (rw_reg32_t) The register.
+ * @param shadow (shadow32_t*) The register's shadow.
+ * @returns (bool) True if the shadow is not loaded yet or equals the register, or false otherwise.
+ * @note - All arguments of this macro are only expanded once.
+ */
+#define SHADOW_MATCHES(dst, shadow) ({ \
+  const __auto_type _dst = (dst); \
+  const shadow32_t* const _shadow = (shadow); \
+  !_shadow->valid || *_dst == _shadow->val; \
+})
@@ -0,0 +1,36 @@
+/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * @file src/internal/mmio_shadow.c
+ * @authors UW SARP
+ * @brief Default drift report of the shadow registers (see Shadow Registers in mmio_base.h).
+ */
+
+#include "mmio_base.h"
+
+#ifdef MMIO_SHADOW_CHECK
+
+// Weak so that an application can define its own, in one place for the whole image
+__attribute__((weak)) void mmio_shadow_fault(rw_reg32_t reg, uint32_t shadow, uint32_t actual) {
+  (void)reg;
+  (void)shadow;
+  (void)actual;
+#ifdef __arm__
+  asm volatile("BKPT #0");
+#endif
+}
+
+#endif
@@ -22,6 +22,15 @@ void delay(int delay) {
 }
 
 extern uint32_t __heap_start;
+extern uint32_t __heap_dtcm_start;
+extern uint32_t __heap_axi_start;
+extern uint32_t __scratch_start;
+extern uint32_t __scratch_end;
+
+// Shadows of the capture/compare mode registers of TIM2-TIM5 (see Shadow Registers in internal/mmio_base.h).
+// Reloaded from the timer when ti_set_pwm() turns its clock on, kept while it stays on.
+static shadow32_t pwm_ccmr1_shadow[6];
+static shadow32_t pwm_ccmr2_shadow[6];
 
 
 void test_spi() {
@@ -136,10 +145,10 @@ void test_pwm_first_principles(){
 
     SET_FIELD(RCC_APB1LENR, RCC_APB1LENR_TIMxEN[3]);
 
-    WRITE_FIELD(G_TIMx_ARR[3], G_TIMx_ARR_ARR_L, (1 << 16) - 1);
-    WRITE_FIELD(G_TIMx_ARR[3], G_TIMx_ARR_ARR_H, (1 << 16) - 1);
-    WRITE_FIELD(G_TIMx_CCR3[3], G_TIMx_CCR3_CCR3_L, (1 << 16) - 1);
-    WRITE_FIELD(G_TIMx_CCR3[3], G_TIMx_CCR3_CCR3_H, (1 << 16) - 1);
+    WRITE_FIELDS(G_TIMx_ARR[3],
+        FIELD_VAL(G_TIMx_ARR_ARR_L, (1 << 16) - 1), FIELD_VAL(G_TIMx_ARR_ARR_H, (1 << 16) - 1));
+    WRITE_FIELDS(G_TIMx_CCR3[3],
+        FIELD_VAL(G_TIMx_CCR3_CCR3_L, (1 << 16) - 1), FIELD_VAL(G_TIMx_CCR3_CCR3_H, (1 << 16) - 1));
 
     field32_t G_TIMx_CCMR2_OUTPUT_OC3M = {
         .msk = (0b111 << 4),
@@ -150,8 +159,9 @@ void test_pwm_first_principles(){
         .pos = 3
     };
 
-    WRITE_FIELD(G_TIMx_CCMR2_OUTPUT[3], G_TIMx_CCMR2_OUTPUT_OC3M, 0b0110); // configure as PWM output
-    SET_FIELD(G_TIMx_CCMR2_OUTPUT[3], G_TIMx_CCMR2_OUTPUT_OC3PE);
+    SHADOW_WRITE_FIELDS(G_TIMx_CCMR2_OUTPUT[3], &pwm_ccmr2_shadow[3],
+        FIELD_VAL(G_TIMx_CCMR2_OUTPUT_OC3M, 0b0110), // configure as PWM output
+        FIELD_SET(G_TIMx_CCMR2_OUTPUT_OC3PE));
     SET_FIELD(G_TIMx_CR1[3], G_TIMx_CR1_ARPE);
 
     SET_FIELD(G_TIMx_CCER[3], G_TIMx_CCER_CCxE[3]);
@@ -239,7 +249,12 @@ void ti_set_pwm(int32_t pwm_inst, struct ti_pwm_config_t config) {
         return;    
     }
     // Enable peripheral clock
-    SET_FIELD(RCC_APB1LENR, RCC_APB1LENR_TIMxEN[pwm_inst]);
+    if (IS_FIELD_CLR(RCC_APB1LENR, RCC_APB1LENR_TIMxEN[pwm_inst])) {
+        // registers written while the clock was off or since a reset read back differently, reload the shadows
+        SHADOW_INVALIDATE(&pwm_ccmr1_shadow[pwm_inst]);
+        SHADOW_INVALIDATE(&pwm_ccmr2_shadow[pwm_inst]);
+        SET_FIELD(RCC_APB1LENR, RCC_APB1LENR_TIMxEN[pwm_inst]);
+    }
 
     // Set up GPIO pin
     tal_enable_clock(config.pin);
@@ -255,11 +270,13 @@ void ti_set_pwm(int32_t pwm_inst, struct ti_pwm_config_t config) {
 
     // Set to output compare
     if (config.channel >= 3) {
-        WRITE_FIELD(G_TIMx_CCMR2_OUTPUT[pwm_inst], G_TIMx_CCMR2_OUTPUT_OCxM[config.channel], 0b0110);
-        SET_FIELD(G_TIMx_CCMR2_OUTPUT[pwm_inst], G_TIMx_CCMR2_OUTPUT_OCxPE[config.channel]);
+        SHADOW_WRITE_FIELDS(G_TIMx_CCMR2_OUTPUT[pwm_inst], &pwm_ccmr2_shadow[pwm_inst],
+            FIELD_VAL(G_TIMx_CCMR2_OUTPUT_OCxM[config.channel], 0b0110),
+            FIELD_SET(G_TIMx_CCMR2_OUTPUT_OCxPE[config.channel]));
     } else {
-        WRITE_FIELD(G_TIMx_CCMR1_OUTPUT[pwm_inst], G_TIMx_CCMR1_OUTPUT_OCxM[config.channel], 0b0110);
-        SET_FIELD(G_TIMx_CCMR1_OUTPUT[pwm_inst], G_TIMx_CCMR2_OUTPUT_OCxPE[config.channel]);
+        SHADOW_WRITE_FIELDS(G_TIMx_CCMR1_OUTPUT[pwm_inst], &pwm_ccmr1_shadow[pwm_inst],
+            FIELD_VAL(G_TIMx_CCMR1_OUTPUT_OCxM[config.channel], 0b0110),
+            FIELD_SET(G_TIMx_CCMR1_OUTPUT_OCxPE[config.channel]));
     }
     // Do some magic
     SET_FIELD(G_TIMx_CCER[pwm_inst], G_TIMx_CCER_CCxE[config.channel]);
@@ -303,12 +320,17 @@ void _start() {
     // tal_set_mode(USR_BUTTON, 0);
     
     // HEAP_START = &__heap_start;
+    // HEAP_DTCM_START = &__heap_dtcm_start;
+    // HEAP_AXI_START = &__heap_axi_start;
     // int heap_status = init_heap();
 
     // if(heap_status != 1){
     //     asm("BKPT #0"); // heap init failure 
     // }
 
+    // struct alloc_arena_t scratch;
+    // arena_init(&scratch, &__scratch_start, (uint32_t)((uint8_t*)&__scratch_end - (uint8_t*)&__scratch_start));
+
     // tal_set_pin(YELLOW_LED, 1);
     
 
@@ -57,6 +57,19 @@ typedef enum {
     GPIO_PORT_K,
 } gpio_port_t;
 
+#define GPIO_PORT_COUNT 11
+
+// Shadows of the configuration registers of each port (see Shadow Registers in internal/mmio_base.h),
+// so setting up a pin only writes the port's registers.  Reloaded from the port on tal_enable_clock().
+static struct {
+  shadow32_t moder;
+  shadow32_t otyper;
+  shadow32_t ospeedr;
+  shadow32_t pupdr;
+  shadow32_t afrl;
+  shadow32_t afrh;
+} port_shadows[GPIO_PORT_COUNT];
+
 
 void tal_set_mode(int pin, int mode)
 {
@@ -67,7 +80,7 @@ void tal_set_mode(int pin, int mode)
   int port = v / 100;
   int index = v - 100 * port;
 
-  WRITE_FIELD(GPIOx_MODER[port], GPIOx_MODER_MODEx[index], mode);
+  SHADOW_WRITE_FIELD(GPIOx_MODER[port], &port_shadows[port].moder, GPIOx_MODER_MODEx[index], mode);
 }
 
 void tal_set_drain(int pin, int drain)
@@ -79,7 +92,7 @@ void tal_set_drain(int pin, int drain)
   int port = v / 100;
   int index = v - 100 * port;
 
-  WRITE_FIELD(GPIOx_OTYPER[port], GPIOx_OTYPER_OTx[index], drain);
+  SHADOW_WRITE_FIELD(GPIOx_OTYPER[port], &port_shadows[port].otyper, GPIOx_OTYPER_OTx[index], drain);
 }
 
 void tal_set_speed(int pin, int speed)
@@ -91,7 +104,7 @@ void tal_set_speed(int pin, int speed)
   int port = v / 100;
   int index = v - 100 * port;
 
-  WRITE_FIELD(GPIOx_OSPEEDR[port], GPIOx_OSPEEDR_OSPEEDx[index], speed);
+  SHADOW_WRITE_FIELD(GPIOx_OSPEEDR[port], &port_shadows[port].ospeedr, GPIOx_OSPEEDR_OSPEEDx[index], speed);
 }
 
 
@@ -107,15 +120,15 @@ void tal_pull_pin(int pin, int pull)
   switch (pull)
   {
     case 1:{
-      WRITE_FIELD(GPIOx_PUPDR[port], GPIOx_PUPDR_PUPDx[index], 1);
+      SHADOW_WRITE_FIELD(GPIOx_PUPDR[port], &port_shadows[port].pupdr, GPIOx_PUPDR_PUPDx[index], 1);
       break;
     }
     case 0:{
-      WRITE_FIELD(GPIOx_PUPDR[port], GPIOx_PUPDR_PUPDx[index], 0);
+      SHADOW_WRITE_FIELD(GPIOx_PUPDR[port], &port_shadows[port].pupdr, GPIOx_PUPDR_PUPDx[index], 0);
       break;
     }
     case -1:{
-      WRITE_FIELD(GPIOx_PUPDR[port], GPIOx_PUPDR_PUPDx[index], 2);
+      SHADOW_WRITE_FIELD(GPIOx_PUPDR[port], &port_shadows[port].pupdr, GPIOx_PUPDR_PUPDx[index], 2);
       break;
     }
     
@@ -134,13 +147,14 @@ void tal_set_pin(int pin, int value)
   int port = v / 100;
   int index = v - 100 * port;
 
+  // BSRR sets/resets the pin with a single write, no read-modify-write of ODR
   switch (value){
     case 0:{
-      WRITE_FIELD(GPIOx_ODR[port], GPIOx_ODR_ODx[index], 0);
+      SET_WO_FIELD(GPIOx_BSRR[port], GPIOx_BSRR_BRx[index]);
       break;
     }
     case 1:{
-      WRITE_FIELD(GPIOx_ODR[port], GPIOx_ODR_ODx[index], 1);
+      SET_WO_FIELD(GPIOx_BSRR[port], GPIOx_BSRR_BSx[index]);
       break;
     }
 
@@ -161,11 +175,11 @@ void tal_alternate_mode(int pin, int value)
 
   if(index <= 7){
     // use AFRL
-    WRITE_FIELD(GPIOx_AFRL[port], GPIOx_AFRL_AFSELx[index], value);
+    SHADOW_WRITE_FIELD(GPIOx_AFRL[port], &port_shadows[port].afrl, GPIOx_AFRL_AFSELx[index], value);
 
   }else{
     // use AFRH
-    WRITE_FIELD(GPIOx_AFRH[port], GPIOx_AFRH_AFSELx[index - 8], value); // subtract 8 from index for offset
+    SHADOW_WRITE_FIELD(GPIOx_AFRH[port], &port_shadows[port].afrh, GPIOx_AFRH_AFSELx[index - 8], value); // subtract 8 from index for offset
   }
 }
 
@@ -184,6 +198,15 @@ bool tal_read_pin(int pin)
 
 bool tal_enable_clock(int pin) {
     gpio_port_t port = port_index_from_pin[pin] / 100;
+    if (port < GPIO_PORT_COUNT) {
+        // registers written while the clock was off read back as 0, reload the shadows
+        SHADOW_INVALIDATE(&port_shadows[port].moder);
+        SHADOW_INVALIDATE(&port_shadows[port].otyper);
+        SHADOW_INVALIDATE(&port_shadows[port].ospeedr);
+        SHADOW_INVALIDATE(&port_shadows[port].pupdr);
+        SHADOW_INVALIDATE(&port_shadows[port].afrl);
+        SHADOW_INVALIDATE(&port_shadows[port].afrh);
+    }
     switch (port) {
         case (GPIO_PORT_A): // 
             SET_FIELD(RCC_AHB4ENR, RCC_AHB4ENR_GPIOAEN);
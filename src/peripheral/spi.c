@@ -19,7 +19,8 @@
  * @brief Implementation of SPI driver interface
  */
 #include "spi.h"
-#include "internal/mmio.h"
+#include "internal/mmio/spix.h"
+#include "internal/mmio/rcc.h"
 #include "gpio.h"
 #include <stdint.h>
 // #include "mutex.h"
@@ -178,7 +179,7 @@ int spi_init(uint8_t instance, spi_config_t *spi_config) {
     // Enable SPI Peripheral Clock
     switch (instance) {
         case (1):
-            // SET_FIELD(RCC_APB2ENR, RCC_APB2ENR_SPI[1]); // TODO: Can't find this field
+            SET_FIELD(RCC_APB2ENR, RCC_APB2ENR_SPIxEN[1]);
             break;
         case (2):
             SET_FIELD(RCC_APB1LENR, RCC_APB1LENR_SPIxEN[2]);
@@ -187,90 +188,29 @@ int spi_init(uint8_t instance, spi_config_t *spi_config) {
             SET_FIELD(RCC_APB1LENR, RCC_APB1LENR_SPIxEN[3]);
             break;
         case (4):
-            // SET_FIELD(RCC_APB2ENR, RCC_APB2ENR_SPI4EN); // TODO: Can't find this field
+            SET_FIELD(RCC_APB2ENR, RCC_APB2ENR_SPIxEN[4]);
             break;
         case (5):
-            // SET_FIELD(RCC_APB2ENR, RCC_ABP2ENR_SPI5EN); // TODO: Can't find this field
+            SET_FIELD(RCC_APB2ENR, RCC_APB2ENR_SPIxEN[5]);
             break;
         case (6):
-            // SET_FIELD(RCC_ABP4ENR, RCC_ABP4ENR_SPI6EN); // TODO: Can't find this field
+            SET_FIELD(RCC_APB4ENR, RCC_APB4ENR_SPI6EN);
             break;
     }
 
-    // Configure SPI Mode
-    switch (spi_config->mode) {
-        case (0):
-            CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPOL);
-            CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPHA);
-            break;
-        case (1):
-            CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPOL);
-            SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPHA);
-            break;
-        case (2):
-            SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPOL);
-            CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPHA);
-            break;
-        case (3):
-            SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPOL);
-            SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_CPHA);
-            break;
-    }
-
-    // Configure Baude Rate Prescaler
-    switch (spi_config->baudrate_prescaler) {
-        case (256):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b111);
-            break;
-        case (128):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b110);
-            break;
-        case (64):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b101);
-            break;
-        case (32):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b100);
-            break;
-        case (16):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b011);
-            break;
-        case (8):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b010);
-            break;
-        case (4):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b001);
-            break;
-        case (2):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_MBR, 0b000);
-            break;
-    }
-
-    // Set the Data Frame Format
-    switch (spi_config->data_size) {
-        case (16):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_DSIZE, 0b1111);
-            break;
-        case (8):
-            WRITE_FIELD(SPIx_CFG1[instance], SPIx_CFG1_DSIZE, 0b111);
-            break;
-    }
-
-    // Configure First Bit Transmitted
-    switch (spi_config->first_bit) {
-        case (0):
-            SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_LSBFRST);
-            break;
-        case (1):
-            CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_LSBFRST);
-            break;
-    }
-
-    // Configure as master
-    SET_FIELD(SPIx_CFG2[instance], SPIx_CFG2_MASTER);
-
-    // Configure SPI software-NSS
-    CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_SSOE);
-    CLR_FIELD(SPIx_CFG2[instance], SPIx_CFG2_SSM);
+    // Configure baud rate prescaler (2^(MBR + 1)) and data frame size (DSIZE + 1 bits)
+    WRITE_FIELDS(SPIx_CFG1[instance],
+        FIELD_VAL(SPIx_CFG1_MBR, __builtin_ctz(spi_config->baudrate_prescaler) - 1),
+        FIELD_VAL(SPIx_CFG1_DSIZE, spi_config->data_size - 1));
+
+    // Configure SPI mode, first bit transmitted, master and software-NSS
+    WRITE_FIELDS(SPIx_CFG2[instance],
+        FIELD_VAL(SPIx_CFG2_CPOL, spi_config->mode >> 1),
+        FIELD_VAL(SPIx_CFG2_CPHA, spi_config->mode & 1),
+        FIELD_VAL(SPIx_CFG2_LSBFRST, spi_config->first_bit == 0),
+        FIELD_SET(SPIx_CFG2_MASTER),
+        FIELD_CLR(SPIx_CFG2_SSOE),
+        FIELD_CLR(SPIx_CFG2_SSM));
 
     // Enable the SPI
     SET_FIELD(SPIx_CR1[instance], SPIx_CR1_SPE);
@@ -21,6 +21,7 @@
 
 #include "uart.h"
 #include "../internal/mmio.h"
+#include "../internal/cache.h"
 #include "gpio.h"
 #include <stdbool.h>
 #include <stddef.h>
@@ -605,102 +606,59 @@ bool uart_init(uart_config_t *usart_config, dma_callback_t *callback,
     CLR_FIELD(UARTx_CR2[channel], UARTx_CR2_CLKEN);
   }
 
-  // TODO: maybe calculate via using ints for mantissa/exponent field?
-  uint32_t brr_value = clk_freq / baud_rate;
-  if (IS_USART_CHANNEL(channel)) {
-  WRITE_FIELD(USARTx_BRR[channel], USARTx_BRR_BRR_4_15, brr_value);
-
-  // Set parity
-  switch (parity) {
-    case UART_PARITY_DISABLED:
-      CLR_FIELD(USARTx_CR1[channel], USARTx_CR1_PCE);
-      break;
-    case UART_PARITY_EVEN:
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_PCE);
-      CLR_FIELD(USARTx_CR1[channel], USARTx_CR1_PS);
-      break;
-    case UART_PARITY_ODD:
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_PCE);
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_PS);
-      break;
-  }
-
-
-  // Set data length
+  // Word length bits for CR1, checked against the parity setting before anything is written
+  bool m0;
+  bool m1;
   switch (data_length) {
     case UART_DATALENGTH_7:
       if (!parity) {
         // tal_raise(flag, "Invalid parity datasize combo");
         return false;
       }
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[0]);
-      CLR_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[1]);
+      m0 = true;
+      m1 = false;
       break;
     case UART_DATALENGTH_8:
-      CLR_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[0]);
-      CLR_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[1]);
+      m0 = false;
+      m1 = false;
       break;
     case UART_DATALENGTH_9:
       if (parity) {
         // tal_raise(flag, "Invalid parity datasize combo");
         return false;
       }
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[0]);
-      SET_FIELD(USARTx_CR1[channel], USARTx_CR1_Mx[1]);
-      break;
-  }
-  
-
-  // Enable FIFOs
-  SET_FIELD(USARTx_CR1[channel], USARTx_CR1_FIFOEN);
-} else {
-  WRITE_FIELD(UARTx_BRR[channel], UARTx_BRR_BRR_4_15, brr_value);
-
-  // Set parity
-  switch (parity) {
-    case UART_PARITY_DISABLED:
-      CLR_FIELD(UARTx_CR1[channel], UARTx_CR1_PCE);
-      break;
-    case UART_PARITY_EVEN:
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_PCE);
-      CLR_FIELD(UARTx_CR1[channel], UARTx_CR1_PS);
-      break;
-    case UART_PARITY_ODD:
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_PCE);
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_PS);
+      m0 = true;
+      m1 = true;
       break;
+    default:
+      return false;
   }
+  bool parity_enable = parity != UART_PARITY_DISABLED;
+  bool parity_odd = parity == UART_PARITY_ODD;
 
-
-  // Set data length
-  switch (data_length) {
-    case UART_DATALENGTH_7:
-      if (!parity) {
-        // tal_raise(flag, "Invalid parity datasize combo");
-        return false;
-      }
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[0]);
-      CLR_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[1]);
-      break;
-    case UART_DATALENGTH_8:
-      CLR_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[0]);
-      CLR_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[1]);
-      break;
-    case UART_DATALENGTH_9:
-      if (parity) {
-        // tal_raise(flag, "Invalid parity datasize combo");
-        return false;
-      }
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[0]);
-      SET_FIELD(UARTx_CR1[channel], UARTx_CR1_Mx[1]);
-      break;
+  // TODO: maybe calculate via using ints for mantissa/exponent field?
+  uint32_t brr_value = clk_freq / baud_rate;
+  if (IS_USART_CHANNEL(channel)) {
+    WRITE_FIELD(USARTx_BRR[channel], USARTx_BRR_BRR_4_15, brr_value);
+
+    // Set parity and data length, and enable FIFOs
+    WRITE_FIELDS(USARTx_CR1[channel],
+      FIELD_VAL(USARTx_CR1_PCE, parity_enable),
+      FIELD_VAL(USARTx_CR1_PS, parity_odd),
+      FIELD_VAL(USARTx_CR1_Mx[0], m0),
+      FIELD_VAL(USARTx_CR1_Mx[1], m1),
+      FIELD_SET(USARTx_CR1_FIFOEN));
+  } else {
+    WRITE_FIELD(UARTx_BRR[channel], UARTx_BRR_BRR_4_15, brr_value);
+
+    // Set parity and data length, and enable FIFOs
+    WRITE_FIELDS(UARTx_CR1[channel],
+      FIELD_VAL(UARTx_CR1_PCE, parity_enable),
+      FIELD_VAL(UARTx_CR1_PS, parity_odd),
+      FIELD_VAL(UARTx_CR1_Mx[0], m0),
+      FIELD_VAL(UARTx_CR1_Mx[1], m1),
+      FIELD_SET(UARTx_CR1_FIFOEN));
   }
-  
-
-  // Enable FIFOs
-  SET_FIELD(UARTx_CR1[channel], UARTx_CR1_FIFOEN);
-
-}
 
   dma_config_t dma_tx_stream = {
       .instance = tx_stream->instance,
@@ -740,13 +698,11 @@ bool uart_init(uart_config_t *usart_config, dma_callback_t *callback,
   // Enable the peripheral
 
   if (IS_USART_CHANNEL(channel)) {
-    SET_FIELD(USARTx_CR1[channel], USARTx_CR1_TE);
-    SET_FIELD(USARTx_CR1[channel], USARTx_CR1_RE);
-    SET_FIELD(USARTx_CR1[channel], USARTx_CR1_UE);
+    WRITE_FIELDS(USARTx_CR1[channel],
+      FIELD_SET(USARTx_CR1_TE), FIELD_SET(USARTx_CR1_RE), FIELD_SET(USARTx_CR1_UE));
   } else {
-     SET_FIELD(UARTx_CR1[channel], UARTx_CR1_TE);
-    SET_FIELD(UARTx_CR1[channel], UARTx_CR1_RE);
-    SET_FIELD(UARTx_CR1[channel], UARTx_CR1_UE);
+    WRITE_FIELDS(UARTx_CR1[channel],
+      FIELD_SET(UARTx_CR1_TE), FIELD_SET(UARTx_CR1_RE), FIELD_SET(UARTx_CR1_UE));
   }
 
   return true;
@@ -781,6 +737,8 @@ bool uart_write_async(uart_channel_t channel, uint8_t *tx_buff, uint32_t size) {
       .context = &uart_contexts[channel],
       .disable_mem_inc = false,
   };
+  // Write the buffer back to memory, the DMA does not see the D-cache
+  cache_clean_range(tx_buff, size);
   dma_start_transfer(&tx_transfer);
 
   // Enable the dma requests
@@ -789,6 +747,52 @@ bool uart_write_async(uart_channel_t channel, uint8_t *tx_buff, uint32_t size) {
   return true;
 }
 
+bool uart_writev_async(uart_channel_t channel, const dma_iovec_t *iov, size_t iov_count) {
+  // Verify parameters
+  if (iov == NULL || iov_count == 0) {
+    return false;
+  }
+  for (size_t i = 0; i < iov_count; i++) {
+    if (!verify_transfer_parameters(channel, iov[i].base, iov[i].size)) {
+      return false;
+    }
+  }
+
+  // Check if usart channel is busy
+  if (uart_busy[channel]) {
+    return false;
+  }
+  uart_busy[channel] = true;
+
+  // Configure DMA stream
+  uart_context_t context = {
+      .busy = &uart_busy[channel],
+      .channel = channel,
+  };
+  uart_contexts[channel] = context;
+  dma_sg_transfer_t tx_transfer = {
+      .instance = uart_to_dma[channel].tx_instance,
+      .stream = uart_to_dma[channel].tx_stream,
+      .periph = UARTx_TDR[channel],
+      .iov = iov,
+      .iov_count = iov_count,
+      .context = &uart_contexts[channel],
+  };
+  // Write the buffers back to memory, the DMA does not see the D-cache
+  for (size_t i = 0; i < iov_count; i++) {
+    cache_clean_range(iov[i].base, iov[i].size);
+  }
+  if (!dma_start_sg(&tx_transfer)) {
+    uart_busy[channel] = false;
+    return false;
+  }
+
+  // Enable the dma requests
+  SET_FIELD(UARTx_CR3[channel], UARTx_CR3_DMAT);
+
+  return true;
+}
+
 bool uart_read_async(uart_channel_t channel, uint8_t *rx_buff, uint32_t size) {
   // Verify parameters
   bool test_params = verify_transfer_parameters(channel, rx_buff, size);
@@ -809,19 +813,21 @@ bool uart_read_async(uart_channel_t channel, uint8_t *rx_buff, uint32_t size) {
       .channel = channel,
   };
   uart_contexts[channel] = context;
-  dma_transfer_t tx_transfer = {
-      .instance = uart_to_dma[channel].tx_instance,
-      .stream = uart_to_dma[channel].tx_stream,
+  dma_transfer_t rx_transfer = {
+      .instance = uart_to_dma[channel].rx_instance,
+      .stream = uart_to_dma[channel].rx_stream,
       .src = (void *) UARTx_RDR[channel],
       .dest = rx_buff,
       .size = size,
       .context = &uart_contexts[channel],
       .disable_mem_inc = false,
   };
-  dma_start_transfer(&tx_transfer);
+  // Drop cached lines of the buffer so none is evicted on top of the incoming data
+  cache_invalidate_range(rx_buff, size);
+  dma_start_transfer(&rx_transfer);
 
   // Enable the dma requests
-  SET_FIELD(UARTx_CR3[channel], UARTx_CR3_DMAT);
+  SET_FIELD(UARTx_CR3[channel], UARTx_CR3_DMAR);
   return true;
 }
 
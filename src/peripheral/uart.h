@@ -94,15 +94,37 @@ bool uart_init(uart_config_t *usart_config, dma_callback_t *callback,
  * @param size Number of bytes to transmit.
  *
  * @return true if data transmission is successful, false otherwise.
+ *
+ * @note The buffer is cleaned from the D-cache before the transfer starts. Use
+ * alloc_dma() for it, so it lives in DMA reachable memory on its own cache lines.
  */
 bool uart_write_async(uart_channel_t channel, uint8_t *tx_buff, uint32_t size);
 
+/**
+ * @brief Sends a list of buffers (e.g. header, payload and CRC) over the specified UART channel
+ * as one transmission, without copying them together. Asyncronous function.
+ *
+ * @param channel USART channel
+ * @param iov The buffers, in order. The list and the buffers must stay valid until the
+ * transfer's callback.
+ * @param iov_count Number of buffers.
+ *
+ * @return true if the transmission started, false otherwise.
+ *
+ * @note The buffers are cleaned from the D-cache, as for uart_write_async().
+ */
+bool uart_writev_async(uart_channel_t channel, const dma_iovec_t *iov, size_t iov_count);
+
 /**
  * @brief Receives data from the specified UART channel. Asyncronous function
  *
  * @param channel USART channel
  * @param rx_buff Pointer to the buffer where received data will be stored.
  * @param size Number of bytes to read.
+ *
+ * @note The buffer is invalidated in the D-cache before the transfer starts. Call
+ * cache_invalidate_range() on it again in the completion callback, before reading
+ * it. Use alloc_dma() for it, so invalidation never touches neighbouring data.
  */
 bool uart_read_async(uart_channel_t channel, uint8_t *rx_buff, uint32_t size);
 
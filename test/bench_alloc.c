@@ -0,0 +1,244 @@
+#define _POSIX_C_SOURCE 200809L // clock_gettime under -std=c18
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "../src/internal/alloc.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Host micro-benchmark of every public allocator call, in ns (and TSC cycles on x86) per call.
+//
+// Each call runs in batches of BATCH so that paired calls (alloc/free, mark/release) can be timed
+// separately; the figure is the best of ROUNDS rounds, which filters scheduler noise.  Host numbers
+// only rank the calls against each other and catch regressions, they are not Cortex-M7 cycle counts.
+//
+//   bench_alloc [rounds]
+
+extern void* HEAP_START;
+extern void* HEAP_DTCM_START;
+extern void* HEAP_AXI_START;
+
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char heap_buf[sizeof(struct alloc_SRAM123_layout_t)];
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char dtcm_buf[sizeof(struct alloc_DTCM_layout_t)];
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char axi_buf[sizeof(struct alloc_AXI_layout_t)];
+
+#define BATCH 64 // fits in one pool of every region, so each batch times the same path
+#define SIZE 24  // lands in a small pool of every region
+
+static void* blocks[BATCH];
+static volatile uintptr_t sink; // keeps results alive at -O2
+static unsigned rounds = 2000;
+
+struct bench_timer_t {
+    struct timespec ts;
+    uint64_t tsc;
+};
+
+static inline uint64_t read_tsc(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static inline void timer_start(struct bench_timer_t* t) {
+    clock_gettime(CLOCK_MONOTONIC, &t->ts);
+    t->tsc = read_tsc();
+}
+
+// elapsed ns since timer_start; *cycles gets the TSC delta
+static inline uint64_t timer_stop(struct bench_timer_t* t, uint64_t* cycles) {
+    uint64_t tsc = read_tsc();
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    *cycles = tsc - t->tsc;
+    return (uint64_t)(now.tv_sec - t->ts.tv_sec) * 1000000000ull + (uint64_t)(now.tv_nsec - t->ts.tv_nsec);
+}
+
+struct result_t {
+    uint64_t ns;
+    uint64_t cycles;
+};
+
+static void keep_best(struct result_t* best, uint64_t ns, uint64_t cycles) {
+    if (ns < best->ns) best->ns = ns;
+    if (cycles < best->cycles) best->cycles = cycles;
+}
+
+static void report(const char* name, struct result_t best, unsigned per_batch) {
+    printf("%-22s %9.1f ns", name, (double)best.ns / per_batch);
+#if defined(__x86_64__) || defined(__i386__)
+    printf(" %9.1f cycles", (double)best.cycles / per_batch);
+#endif
+    printf("\n");
+}
+
+#define BEST_INIT {UINT64_MAX, UINT64_MAX}
+
+// times `setup; [start] body; [stop] teardown` and keeps the best round in `best`
+#define MEASURE(best, setup, body, teardown)                \
+    do {                                                    \
+        (best) = (struct result_t)BEST_INIT;                \
+        for (unsigned r = 0; r < rounds; ++r) {             \
+            setup;                                          \
+            struct bench_timer_t t;                         \
+            uint64_t cycles;                                \
+            timer_start(&t);                                \
+            body;                                           \
+            uint64_t ns = timer_stop(&t, &cycles);          \
+            teardown;                                       \
+            keep_best(&(best), ns, cycles);                 \
+        }                                                   \
+    } while (0)
+
+// times `setup; [start] body; [stop] teardown` and reports body per call
+#define BENCH(name, per_batch, setup, body, teardown)       \
+    do {                                                    \
+        struct result_t best;                               \
+        MEASURE(best, setup, body, teardown);               \
+        report((name), best, (per_batch));                  \
+    } while (0)
+
+#define EACH for (unsigned k = 0; k < BATCH; ++k)
+
+static void free_all(void) {
+    EACH free(blocks[k]);
+}
+
+// isFree() of the last block of each default pool, the worst case for a walk from HEAP_START;
+// get_pool() is one range check per region, so the figures should be flat across pools
+static void bench_lookup_per_pool(void) {
+    double lo = 0, hi = 0;
+    uint32_t offset = 0;
+    for (uint32_t p = 0; p < NUMBER_OF_POOLS; ++p) {
+        offset += POOL_BLOCK_SIZES[p] * POOL_SIZES[p];
+        void* last = heap_buf + offset - POOL_BLOCK_SIZES[p];
+        char name[32];
+        snprintf(name, sizeof(name), "isFree(pool %4u B)", POOL_BLOCK_SIZES[p]);
+        struct result_t best;
+        MEASURE(best, , EACH sink += isFree(last), );
+        report(name, best, BATCH);
+        double ns = (double)best.ns / BATCH;
+        if (p == 0 || ns < lo) lo = ns;
+        if (p == 0 || ns > hi) hi = ns;
+    }
+    printf("%-22s %9.2f max/min\n", "isFree across pools", lo > 0 ? hi / lo : 0.0);
+}
+
+// alloc() against alloc_uninit() per default pool, timed as alloc+free pairs; the difference
+// is the zeroing of a whole block
+static void bench_zeroing_per_pool(void) {
+    for (uint32_t p = 0; p < NUMBER_OF_POOLS; ++p) {
+        const uint32_t size = POOL_BLOCK_SIZES[p] - ALLOC_GUARD_SIZE;
+        char name[32];
+        struct result_t zero, uninit;
+        MEASURE(zero, , EACH free(alloc(size)), );
+        MEASURE(uninit, , EACH free(alloc_uninit(size)), );
+        snprintf(name, sizeof(name), "alloc(%4u B)", POOL_BLOCK_SIZES[p]);
+        report(name, zero, BATCH);
+        snprintf(name, sizeof(name), "alloc_uninit(%4u B)", POOL_BLOCK_SIZES[p]);
+        report(name, uninit, BATCH);
+    }
+}
+
+// one loop iteration's scratch buffers through the pools against through an arena
+static void bench_arena_frame(void) {
+    static const uint32_t frame[] = { 24, 48, 100, 200, 16, 64, 300, 32, 12, 120 };
+    enum { FRAME_LEN = sizeof(frame) / sizeof(frame[0]) };
+    void* bufs[FRAME_LEN];
+
+    BENCH("frame(pools)", 1, ,
+          for (unsigned k = 0; k < FRAME_LEN; ++k) bufs[k] = alloc_uninit(frame[k]);
+          for (unsigned k = 0; k < FRAME_LEN; ++k) free(bufs[k]), );
+
+    struct alloc_arena_t* a = arena_create(1000, ALLOC_HINT_DEFAULT); // a 1 KiB block
+    if (a == NULL) return;
+    BENCH("frame(arena)", 1, ,
+          for (unsigned k = 0; k < FRAME_LEN; ++k) bufs[k] = arena_alloc(a, frame[k]);
+          sink += (uintptr_t)bufs[FRAME_LEN - 1]; arena_reset(a), );
+    free(a);
+}
+
+static void setup_heap(void) {
+    HEAP_START = heap_buf;
+    HEAP_DTCM_START = dtcm_buf;
+    HEAP_AXI_START = axi_buf;
+    init_heap();
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        rounds = (unsigned)strtoul(argv[1], NULL, 0);
+        if (rounds == 0) rounds = 1;
+    }
+    setup_heap();
+    printf("%u rounds of %u calls, %u byte blocks\n", rounds, BATCH, SIZE);
+
+    // init_heap rebuilds every free list, one call per round
+    BENCH("init_heap", 1, , init_heap(), );
+
+    BENCH("alloc", BATCH, , EACH blocks[k] = alloc(SIZE), free_all());
+    BENCH("alloc_uninit", BATCH, , EACH blocks[k] = alloc_uninit(SIZE), free_all());
+    bench_zeroing_per_pool();
+    BENCH("alloc_hint(FAST)", BATCH, , EACH blocks[k] = alloc_hint(SIZE, ALLOC_HINT_FAST), free_all());
+    BENCH("alloc_hint(DMA)", BATCH, , EACH blocks[k] = alloc_hint(SIZE, ALLOC_HINT_DMA), free_all());
+    BENCH("alloc_dma", BATCH, , EACH blocks[k] = alloc_dma(SIZE), free_all());
+    BENCH("free", BATCH, EACH blocks[k] = alloc_uninit(SIZE), free_all(), );
+
+    bench_lookup_per_pool();
+    BENCH("isFree", BATCH, EACH blocks[k] = alloc_uninit(SIZE), EACH sink += isFree(blocks[k]), free_all());
+    BENCH("alloc_usable_size", BATCH, EACH blocks[k] = alloc_uninit(SIZE),
+          EACH sink += alloc_usable_size(blocks[k]), free_all());
+    // shrink in place: no copy, the common case for trimming a buffer
+    BENCH("alloc_resize(shrink)", BATCH, EACH blocks[k] = alloc_uninit(SIZE),
+          EACH blocks[k] = alloc_resize(blocks[k], SIZE / 2), free_all());
+    // grow into the next pool: a pop, a copy and a free per call
+    BENCH("alloc_resize(grow)", BATCH, EACH blocks[k] = alloc_uninit(SIZE),
+          EACH blocks[k] = alloc_resize(blocks[k], 4 * SIZE), free_all());
+
+    {
+        static struct alloc_cache_t cache;
+        memset(&cache, 0, sizeof(cache));
+        BENCH("alloc_cached", BATCH, , EACH blocks[k] = alloc_cached(&cache, SIZE),
+              EACH free_cached(&cache, blocks[k]));
+        BENCH("free_cached", BATCH, EACH blocks[k] = alloc_cached(&cache, SIZE),
+              EACH free_cached(&cache, blocks[k]), );
+        BENCH("alloc_cache_flush", 1, EACH free_cached(&cache, alloc_uninit(SIZE)), alloc_cache_flush(&cache), );
+    }
+
+    {
+        static struct alloc_slab_t slab;
+        static _Alignas(8) unsigned char slab_buf[SLAB_BYTES(SIZE, BATCH)];
+        slab_init(&slab, slab_buf, SIZE, BATCH);
+        BENCH("slab_alloc", BATCH, , EACH blocks[k] = slab_alloc(&slab), EACH slab_free(&slab, blocks[k]));
+        BENCH("slab_free", BATCH, EACH blocks[k] = slab_alloc(&slab), EACH slab_free(&slab, blocks[k]), );
+        BENCH("slab_create", 1, , blocks[0] = slab_create(SIZE, 16, ALLOC_HINT_DEFAULT), free(blocks[0]));
+    }
+
+    {
+        static struct alloc_arena_t arena;
+        static _Alignas(8) unsigned char arena_buf[BATCH * SIZE];
+        arena_init(&arena, arena_buf, sizeof(arena_buf));
+        BENCH("arena_alloc", BATCH, , EACH blocks[k] = arena_alloc(&arena, SIZE), arena_reset(&arena));
+        BENCH("arena_mark", BATCH, , EACH sink += arena_mark(&arena), );
+        BENCH("arena_release", BATCH, , EACH arena_release(&arena, 0), );
+        BENCH("arena_reset", BATCH, , EACH arena_reset(&arena), );
+        BENCH("arena_init", BATCH, , EACH arena_init(&arena, arena_buf, sizeof(arena_buf)), );
+        BENCH("arena_create", 1, , blocks[0] = arena_create(512, ALLOC_HINT_DEFAULT), free(blocks[0]));
+    }
+    bench_arena_frame();
+
+    {
+        struct alloc_pool_stats_t st;
+        BENCH("alloc_get_stats", BATCH, , EACH sink += alloc_get_stats(0, &st), );
+        BENCH("alloc_reset_stats", 1, , alloc_reset_stats(), );
+    }
+
+    // walks every free list and bitmap, one call per round
+    BENCH("heap_validate", 1, , sink += heap_validate(), );
+    return 0;
+}
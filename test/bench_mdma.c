@@ -0,0 +1,117 @@
+#define _POSIX_C_SOURCE 200809L // clock_gettime under -std=c17
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "mmio_fake.h"
+#include "internal/mdma.h"
+#include "internal/interrupt.h"
+#include "internal/mmio/mdma.h"
+
+// Host benchmark of the CPU time a copy costs on the CPU against handing it to the MDMA, per size.
+//
+// "cpu" is mdma_cpu_memcpy() doing the copy. "mdma" is what the CPU spends when the MDMA does it:
+// mdma_memcpy() programming a channel, the cache maintenance of both buffers and the completion IRQ,
+// once with the D-cache off and once on (every line of both buffers then goes through a maintenance
+// register). The copy itself is the controller's and costs the CPU nothing. The crossover is the
+// first size where offloading is cheaper, which is where MDMA_CPU_THRESHOLD belongs. Host numbers
+// only rank the two paths, they are not Cortex-M7 cycle counts. Built with MDMA_CPU_THRESHOLD=1
+// so that every size reaches the MDMA path.
+//
+//   bench_mdma [rounds]
+
+#define BATCH 32
+#define MAX_SIZE 65536
+#define DEST 0x20000 // destination offset in the fake SRAM, the source is at 0
+
+static unsigned rounds = 2000;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint8_t* sram(uint32_t offset) {
+    return (uint8_t*)(uintptr_t)(MMIO_FAKE_SRAM_BASE + offset);
+}
+
+// What the controller and NVIC do at the end of a transfer on channel 0
+static void fake_complete(void) {
+    CLR_FIELD(MDMA_MDMA_CxCR[0], MDMA_MDMA_CxCR_EN);
+    MMIO_FAKE_REG(0x52000040U) = MDMA_MDMA_C0ISR_CTCIF0.msk;
+    MMIO_FAKE_REG(MDMA_MDMA_GISR0) = 1U;
+    mdma_irq_handler();
+}
+
+// Best time per call of BATCH calls, over every round
+static double time_cpu(size_t size) {
+    uint64_t best = UINT64_MAX;
+    for (unsigned r = 0; r < rounds; r++) {
+        const uint64_t start = now_ns();
+        for (unsigned k = 0; k < BATCH; k++) {
+            mdma_cpu_memcpy(sram(DEST), sram(0), size);
+        }
+        const uint64_t ns = now_ns() - start;
+        if (ns < best) best = ns;
+    }
+    return (double)best / BATCH;
+}
+
+static double time_mdma(size_t size) {
+    uint64_t best = UINT64_MAX;
+    for (unsigned r = 0; r < rounds; r++) {
+        const uint64_t start = now_ns();
+        for (unsigned k = 0; k < BATCH; k++) {
+            mdma_memcpy(sram(DEST), sram(0), size, NULL, NULL);
+            fake_complete();
+        }
+        const uint64_t ns = now_ns() - start;
+        if (ns < best) best = ns;
+    }
+    return (double)best / BATCH;
+}
+
+static void set_dcache(bool on) {
+    if (on) {
+        MMIO_FAKE_REG(0xE000ED14U) |= 1U << 16; // SCB_CCR.DC
+    } else {
+        MMIO_FAKE_REG(0xE000ED14U) &= ~(1U << 16);
+    }
+}
+
+static void report_crossover(const char* name, size_t crossover) {
+    if (crossover != 0) {
+        printf("crossover (%s): offloading is cheaper from %zu bytes\n", name, crossover);
+    } else {
+        printf("crossover (%s): above %d bytes\n", name, MAX_SIZE);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        rounds = (unsigned)strtoul(argv[1], NULL, 0);
+        if (rounds == 0) rounds = 1;
+    }
+    if (!mmio_fake_init()) return 1;
+    memset(sram(0), 0x5A, MAX_SIZE);
+
+    printf("%u rounds of %u copies\n", rounds, BATCH);
+    printf("%8s %12s %16s %16s\n", "bytes", "cpu ns", "mdma ns (D off)", "mdma ns (D on)");
+    size_t crossover_off = 0;
+    size_t crossover_on = 0;
+    for (size_t size = 16; size <= MAX_SIZE; size *= 2) {
+        const double cpu = time_cpu(size);
+        set_dcache(false);
+        const double mdma_off = time_mdma(size);
+        set_dcache(true);
+        const double mdma_on = time_mdma(size);
+        printf("%8zu %12.1f %16.1f %16.1f\n", size, cpu, mdma_off, mdma_on);
+        if (crossover_off == 0 && mdma_off < cpu) crossover_off = size;
+        if (crossover_on == 0 && mdma_on < cpu) crossover_on = size;
+    }
+    report_crossover("D-cache off", crossover_off);
+    report_crossover("D-cache on", crossover_on);
+    return 0;
+}
@@ -0,0 +1,404 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/internal/alloc.h"
+
+// Randomized alloc/free fuzzer and trace replayer for the pool allocator.
+//
+// Every operation is mirrored in a reference model (the live blocks, their requested sizes and the
+// byte pattern written into them), and checked against it:
+//   - blocks are aligned, inside their region, at least the requested size, and never overlap
+//   - alloc()/alloc_hint() blocks are zeroed, and every live block keeps its contents
+//   - a default region request only fails when every pool it fits in is in use
+//   - heap_validate() passes every VALIDATE_EVERY operations, and the heap is whole again at the end
+//
+//   fuzz_alloc [--seed N] [--ops N] [--record FILE]   random trace (optionally written to FILE)
+//   fuzz_alloc --replay FILE                          replay a recorded or captured trace
+//   --dump-trace FILE                                 (ALLOC_TRACE builds) write the alloc_trace ring
+//                                                     at the end, as gdb would dump it from the board
+//
+// Trace format, one operation per line (ids name live blocks, sizes are in bytes, '#' starts a comment):
+//   a <id> <size>          alloc
+//   u <id> <size>          alloc_uninit
+//   h <id> <size> <hint>   alloc_hint (hint is the alloc_hint_t value)
+//   d <id> <size>          alloc_dma
+//   r <id> <size>          alloc_resize
+//   f <id>                 free
+
+extern void* HEAP_START;
+extern void* HEAP_DTCM_START;
+extern void* HEAP_AXI_START;
+
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char heap_buf[sizeof(struct alloc_SRAM123_layout_t)];
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char dtcm_buf[sizeof(struct alloc_DTCM_layout_t)];
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char axi_buf[sizeof(struct alloc_AXI_layout_t)];
+
+#define MAX_IDS 4096
+#define VALIDATE_EVERY 64
+
+struct live_t {
+    unsigned char* mem;  // NULL if the id is not live
+    uint32_t size;       // bytes requested
+    unsigned char fill;  // pattern the first size bytes hold
+};
+
+static struct live_t live[MAX_IDS];
+static uint32_t live_count = 0;
+static uint64_t op_count = 0;
+static uint64_t null_count = 0;
+static uint32_t peak_live = 0;
+static FILE* record_fp = NULL;
+static int replaying = 0;
+static const char* dump_path = NULL;
+
+static void fail(const char* what, uint32_t id) {
+    fprintf(stderr, "FAIL after %llu ops (id %u): %s\n", (unsigned long long)op_count, id, what);
+    exit(1);
+}
+
+static int in_buf(const unsigned char* p, const unsigned char* buf, size_t size) {
+    return p >= buf && p < buf + size;
+}
+
+// pool of a default region block, as an index into POOL_BLOCK_SIZES
+static uint32_t default_pool_of(const unsigned char* p) {
+    uint32_t offset = (uint32_t)(p - heap_buf);
+    uint32_t idx = 0;
+    while (offset >= POOL_BLOCK_SIZES[idx] * POOL_SIZES[idx]) {
+        offset -= POOL_BLOCK_SIZES[idx] * POOL_SIZES[idx];
+        idx++;
+    }
+    return idx;
+}
+
+// a default region request for size came back NULL: every pool it fits in must be fully in use
+static void check_null_is_exhaustion(uint32_t size, uint32_t id) {
+    uint32_t first = alloc_pool_for_size(size);
+    if (first >= NUMBER_OF_POOLS) {
+        return; // larger than any block, NULL is the only answer
+    }
+    uint32_t used[NUMBER_OF_POOLS] = {0};
+    for (uint32_t k = 0; k < MAX_IDS; ++k) {
+        if (live[k].mem != NULL && in_buf(live[k].mem, heap_buf, sizeof(heap_buf))) {
+            used[default_pool_of(live[k].mem)]++;
+        }
+    }
+    for (uint32_t p = first; p < NUMBER_OF_POOLS; ++p) {
+        if (used[p] < POOL_SIZES[p]) {
+            fail("allocation failed with a free block that fits", id);
+        }
+    }
+}
+
+static void check_contents(uint32_t id) {
+    for (uint32_t i = 0; i < live[id].size; ++i) {
+        if (live[id].mem[i] != live[id].fill) {
+            fail("live block contents changed", id);
+        }
+    }
+}
+
+// a new block for id: placement, size, overlap and (if zeroed) contents
+static void check_new_block(uint32_t id, unsigned char* mem, uint32_t size, int zeroed, uint32_t align) {
+    if (!in_buf(mem, heap_buf, sizeof(heap_buf)) && !in_buf(mem, dtcm_buf, sizeof(dtcm_buf)) &&
+        !in_buf(mem, axi_buf, sizeof(axi_buf))) {
+        fail("block outside every region", id);
+    }
+    if ((uintptr_t)mem % align != 0) {
+        fail("block misaligned", id);
+    }
+    uint32_t usable = alloc_usable_size(mem);
+    if (usable < size || isFree(mem)) {
+        fail("block too small or not marked in use", id);
+    }
+    for (uint32_t k = 0; k < MAX_IDS; ++k) {
+        if (k == id || live[k].mem == NULL) {
+            continue;
+        }
+        uint32_t other = alloc_usable_size(live[k].mem);
+        if (mem < live[k].mem + other && live[k].mem < mem + usable) {
+            fail("blocks overlap", id);
+        }
+    }
+    if (zeroed) {
+        for (uint32_t i = 0; i < usable; ++i) {
+            if (mem[i] != 0) {
+                fail("block not zeroed", id);
+            }
+        }
+    }
+}
+
+static void set_live(uint32_t id, unsigned char* mem, uint32_t size) {
+    if (live[id].mem == NULL) {
+        live_count++;
+        if (live_count > peak_live) peak_live = live_count;
+    }
+    live[id].mem = mem;
+    live[id].size = size;
+    live[id].fill = (unsigned char)(id * 37 + op_count);
+    memset(mem, live[id].fill, size);
+}
+
+static void drop_live(uint32_t id) {
+    live[id].mem = NULL;
+    live_count--;
+}
+
+// runs one operation against the allocator and the model
+static void run_op(char op, uint32_t id, uint32_t size, uint32_t hint) {
+    if (id >= MAX_IDS) {
+        fail("id out of range", id);
+    }
+    op_count++;
+    if (record_fp != NULL) {
+        if (op == 'f') fprintf(record_fp, "f %u\n", id);
+        else if (op == 'h') fprintf(record_fp, "h %u %u %u\n", id, size, hint);
+        else fprintf(record_fp, "%c %u %u\n", op, id, size);
+    }
+
+    unsigned char* mem;
+    switch (op) {
+    case 'a':
+    case 'u':
+    case 'h':
+    case 'd':
+        if (live[id].mem != NULL) {
+            if (!replaying) {
+                fail("allocation into a live id", id);
+            }
+            // the build that captured the trace failed this id's last allocation (its pools were
+            // fuller, e.g. guard words), so the block it would have freed by now is still ours
+            run_op('f', id, 0, 0);
+        }
+        if (op == 'a') mem = alloc(size);
+        else if (op == 'u') mem = alloc_uninit(size);
+        else if (op == 'h') mem = alloc_hint(size, (enum alloc_hint_t)hint);
+        else mem = alloc_dma(size);
+
+        if (mem == NULL) {
+            null_count++;
+            if (size != 0 && (op == 'a' || op == 'u' || (op == 'h' && hint == ALLOC_HINT_DEFAULT))) {
+                check_null_is_exhaustion(size, id);
+            }
+            return;
+        }
+        if (size == 0) {
+            fail("alloc(0) returned a block", id);
+        }
+        check_new_block(id, mem, size, op == 'a' || op == 'h', op == 'd' ? ALLOC_DMA_ALIGN : ALLOC_ALIGN);
+        set_live(id, mem, size);
+        break;
+
+    case 'r':
+        if (live[id].mem != NULL) {
+            check_contents(id);
+        }
+        {
+            unsigned char* old = live[id].mem;
+            uint32_t old_size = live[id].size;
+            unsigned char old_fill = live[id].fill;
+            mem = alloc_resize(old, size);
+            if (size == 0) {
+                if (mem != NULL) fail("resize to 0 returned a block", id);
+                if (old != NULL) drop_live(id);
+                return;
+            }
+            if (mem == NULL) {
+                null_count++;
+                if (old != NULL && isFree(old)) fail("failed resize freed the block", id);
+                return;
+            }
+            if (old != NULL) {
+                uint32_t kept = old_size < size ? old_size : size;
+                for (uint32_t i = 0; i < kept; ++i) {
+                    if (mem[i] != old_fill) fail("resize lost the contents", id);
+                }
+                if (mem != old && !isFree(old)) fail("resize did not free the old block", id);
+                live[id].mem = NULL; // excluded from the overlap check
+                live_count--;
+            }
+            check_new_block(id, mem, size, old == NULL, ALLOC_ALIGN);
+            set_live(id, mem, size);
+        }
+        break;
+
+    case 'f':
+        if (live[id].mem == NULL) {
+            return; // ids that were never live (e.g. a failed allocation in a captured trace)
+        }
+        check_contents(id);
+        mem = live[id].mem;
+        free(mem);
+        if (!isFree(mem)) {
+            fail("free did not mark the block free", id);
+        }
+        drop_live(id);
+        break;
+
+    default:
+        fail("unknown trace operation", id);
+    }
+
+    if (op_count % VALIDATE_EVERY == 0 && heap_validate() != ALLOC_OK) {
+        fail("heap_validate failed", id);
+    }
+}
+
+static void setup_heap(void) {
+    HEAP_START = heap_buf;
+    HEAP_DTCM_START = dtcm_buf;
+    HEAP_AXI_START = axi_buf;
+    if (init_heap() != 1) {
+        fail("init_heap failed", 0);
+    }
+}
+
+// writes the trace ring for --dump-trace, while the blocks of the run are still live
+static void dump_trace(void) {
+    if (dump_path == NULL) {
+        return;
+    }
+#ifdef ALLOC_TRACE
+    FILE* fp = fopen(dump_path, "wb");
+    if (fp == NULL || fwrite(&alloc_trace, sizeof(alloc_trace), 1, fp) != 1) {
+        perror(dump_path);
+        exit(2);
+    }
+    fclose(fp);
+#else
+    fprintf(stderr, "--dump-trace needs a build with ALLOC_TRACE\n");
+    exit(2);
+#endif
+}
+
+// frees every live block and checks the heap is whole again
+static void finish(void) {
+    dump_trace();
+    for (uint32_t id = 0; id < MAX_IDS; ++id) {
+        if (live[id].mem != NULL) {
+            run_op('f', id, 0, 0);
+        }
+    }
+    if (heap_validate() != ALLOC_OK) {
+        fail("heap_validate failed after freeing everything", 0);
+    }
+    printf("%llu ops, %llu failed allocations, peak %u live blocks: OK\n",
+           (unsigned long long)op_count, (unsigned long long)null_count, peak_live);
+}
+
+// xorshift32, so a seed gives the same trace on every host
+static uint32_t rng_state;
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// request size skewed toward small blocks, with the odd oversize one
+static uint32_t random_size(void) {
+    uint32_t r = rng() % 100;
+    if (r < 60) return 1 + rng() % 64;
+    if (r < 90) return 1 + rng() % 512;
+    if (r < 99) return 1 + rng() % 4096;
+    return rng() % 2 ? 0 : 4097 + rng() % 4096;
+}
+
+static void fuzz(uint32_t seed, uint64_t ops) {
+    rng_state = seed != 0 ? seed : 1;
+    setup_heap();
+
+    for (uint64_t n = 0; n < ops; ++n) {
+        uint32_t id = rng() % 1024;
+        uint32_t r = rng() % 100;
+        if (live[id].mem != NULL) {
+            if (r < 70) run_op('f', id, 0, 0);
+            else run_op('r', id, random_size(), 0);
+        } else if (r < 40) {
+            run_op('a', id, random_size(), 0);
+        } else if (r < 60) {
+            run_op('u', id, random_size(), 0);
+        } else if (r < 80) {
+            run_op('h', id, random_size(), rng() % 3);
+        } else if (r < 90) {
+            run_op('d', id, random_size(), 0);
+        } else {
+            run_op('r', id, random_size(), 0);
+        }
+    }
+    finish();
+}
+
+static void replay(const char* path) {
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL) {
+        perror(path);
+        exit(2);
+    }
+    setup_heap();
+    replaying = 1;
+
+    char line[256];
+    unsigned long lineno = 0;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        lineno++;
+        char* hash = strchr(line, '#');
+        if (hash != NULL) *hash = '\0';
+
+        char op;
+        unsigned id = 0, size = 0, hint = 0;
+        int n = sscanf(line, " %c %u %u %u", &op, &id, &size, &hint);
+        if (n <= 0) {
+            continue; // blank or comment
+        }
+        if (n < 2 || (op != 'f' && n < 3) || (op == 'h' && n < 4)) {
+            fprintf(stderr, "%s:%lu: malformed line\n", path, lineno);
+            exit(2);
+        }
+        run_op(op, id, size, hint);
+    }
+    fclose(fp);
+    finish();
+}
+
+int main(int argc, char** argv) {
+    uint32_t seed = 1;
+    uint64_t ops = 200000;
+    const char* replay_path = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc) {
+            ops = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_fp = fopen(argv[++i], "w");
+            if (record_fp == NULL) {
+                perror(argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--dump-trace") == 0 && i + 1 < argc) {
+            dump_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--seed N] [--ops N] [--record FILE] | --replay FILE [--dump-trace FILE]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    if (replay_path != NULL) {
+        replay(replay_path);
+    } else {
+        printf("seed %u: ", seed);
+        fuzz(seed, ops);
+    }
+
+    if (record_fp != NULL) {
+        fclose(record_fp);
+    }
+    return 0;
+}
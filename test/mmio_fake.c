@@ -0,0 +1,42 @@
+#define _DEFAULT_SOURCE // MAP_ANONYMOUS under -std=c17
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "mmio_fake.h"
+
+// Address windows backed by host memory, page aligned
+static const struct {
+    const char* name;
+    uintptr_t base;
+    size_t size;
+} windows[] = {
+    {"DMA1/DMA2/DMAMUX1", 0x40020000U, 0x1000U},
+    {"MDMA", 0x52000000U, 0x1000U},
+    {"GPIOA-GPIOK", 0x58020000U, 0x3000U},
+    {"RCC", 0x58024000U, 0x1000U},
+    {"NVIC", 0xE000E000U, 0x1000U},
+    {"AXI SRAM", MMIO_FAKE_SRAM_BASE, MMIO_FAKE_SRAM_SIZE},
+};
+
+#define WINDOW_COUNT (sizeof(windows) / sizeof(windows[0]))
+
+bool mmio_fake_init(void) {
+    for (size_t i = 0; i < WINDOW_COUNT; i++) {
+        // a hint rather than MAP_FIXED, which would silently replace anything already mapped there
+        void* want = (void*)windows[i].base;
+        void* got = mmap(want, windows[i].size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (got != want) {
+            if (got != MAP_FAILED) munmap(got, windows[i].size);
+            fprintf(stderr, "[ERROR] cannot map the fake %s registers at %#lx\n",
+                    windows[i].name, (unsigned long)windows[i].base);
+            return false;
+        }
+    }
+    return true;
+}
+
+void mmio_fake_reset(void) {
+    for (size_t i = 0; i < WINDOW_COUNT; i++) {
+        memset((void*)windows[i].base, 0, windows[i].size);
+    }
+}
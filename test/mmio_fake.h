@@ -0,0 +1,27 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+// Register-level fake of the H7 address space for host tests of the drivers.
+//
+// The drivers are compiled against the real internal/mmio headers, whose registers are fixed
+// addresses.  mmio_fake_init() maps zeroed host memory at exactly those addresses, so every register
+// access becomes a plain RAM access the test can inspect and poke.  The fake has no side effects of
+// its own (writing an IFCR does not clear the ISR, EN stays set until the test clears it); tests play
+// the hardware's part where they need it.
+//
+// Only the windows listed in mmio_fake.c are mapped, touching any other register still faults.
+
+// Scratch RAM mapped at the AXI SRAM address, for buffers whose addresses the DMA registers
+// (32 bit) have to hold, large enough for copies of several MDMA blocks
+#define MMIO_FAKE_SRAM_BASE 0x24000000U
+#define MMIO_FAKE_SRAM_SIZE 0x80000U
+
+// Maps the fake windows, returns false if the host already uses one of the addresses
+bool mmio_fake_init(void);
+
+// Zeroes every register and the scratch RAM
+void mmio_fake_reset(void);
+
+// Reads/writes a register through its address, for registers the test has no definition of
+#define MMIO_FAKE_REG(addr) (*(volatile uint32_t*)(uintptr_t)(addr))
@@ -0,0 +1,12 @@
+#include "internal/mmio_base.h"
+
+// Must fail to compile: WRITE_FIELDS takes at most 16 updates (built by the mmio_too_many_updates test).
+
+#define BIT(n) FIELD_SET(((field32_t){.msk = 1U << (n), .pos = (n)}))
+
+int main(void) {
+    static volatile uint32_t reg;
+    WRITE_FIELDS(&reg, BIT(0), BIT(1), BIT(2), BIT(3), BIT(4), BIT(5), BIT(6), BIT(7), BIT(8),
+                 BIT(9), BIT(10), BIT(11), BIT(12), BIT(13), BIT(14), BIT(15), BIT(16));
+    return (int)reg;
+}
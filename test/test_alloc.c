@@ -1,16 +1,22 @@
+#define _POSIX_C_SOURCE 200809L // fdopen, strdup, clock_gettime under -std=c18
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <stdarg.h>
+#include <pthread.h>
 #include "../src/internal/alloc.h"
 
 extern void* HEAP_START;
 
 // heap buffer + reset helper
-static unsigned char heap_buf[TOTAL_HEAP_SIZE];
+static _Alignas(ALLOC_ALIGN) unsigned char heap_buf[TOTAL_HEAP_SIZE];
+
+// largest request a block of pool p holds (ALLOC_DEBUG keeps a guard word at the end of each block)
+#define USABLE(p) (POOL_BLOCK_SIZES[p] - ALLOC_GUARD_SIZE)
 static void reset_heap(void) {
     memset(heap_buf, 0xA5, sizeof(heap_buf)); // fill pattern
     HEAP_START = (void*)heap_buf;
@@ -193,6 +199,13 @@ static void run_test(const TestCase* tc) {
     }
 }
 
+// monotonic clock in ns, for the micro-benchmarks
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
 // basic heap init
 static void test_init_heap_basic(void) {
     reset_heap();
@@ -201,6 +214,58 @@ static void test_init_heap_basic(void) {
     assert_check(!isFree(oob), "out-of-range not free");
 }
 
+// init_heap() must not walk the blocks; fresh blocks come out in address order, recycled ones first
+static void test_init_is_lazy(void) {
+    reset_heap(); // fills the heap with 0xA5 before init_heap()
+    uint32_t touched = 0;
+    for (uint32_t i = 0; i < TOTAL_HEAP_SIZE; ++i) touched += heap_buf[i] != 0xA5;
+    assert_check(touched == 0, "init_heap leaves the blocks untouched");
+
+    void* a = alloc(64);
+    void* b = alloc(64);
+    assert_check(a != NULL && (unsigned char*)b == (unsigned char*)a + POOL_BLOCK_SIZES[alloc_pool_for_size(64)],
+                 "fresh blocks in address order");
+    free(a);
+    assert_check(alloc(64) == a, "recycled block before a fresh one");
+
+    const int iters = 2000;
+    double t0 = now_ns();
+    for (int i = 0; i < iters; ++i) init_heap();
+    log_printf("      init_heap %.1f ns\n", (now_ns() - t0) / iters);
+    reset_heap();
+}
+
+// derived pool table: layout, size classes, heap alignment
+static void test_pool_table(void) {
+    uint32_t total = 0, blocks = 0;
+    for (uint32_t p = 0; p < NUMBER_OF_POOLS; ++p) {
+        total += POOL_BLOCK_SIZES[p] * POOL_SIZES[p];
+        blocks += POOL_SIZES[p];
+        assert_check(alloc_pool_for_size(USABLE(p)) == p, "exact size maps to its pool");
+        if (p > 0)
+            assert_check(alloc_pool_for_size(USABLE(p - 1) + 1) == p, "size just over a class rounds up");
+    }
+    assert_check(total == TOTAL_HEAP_SIZE, "TOTAL_HEAP_SIZE matches table");
+    assert_check(TOTAL_BLOCK_COUNT == blocks, "TOTAL_BLOCK_COUNT matches table");
+    assert_check(IS_FREE_SIZE == (ALLOC_TOTAL_BLOCKS + 7) / 8 && ALLOC_TOTAL_BLOCKS >= blocks,
+                 "IS_FREE_SIZE covers every region");
+    assert_check(alloc_pool_for_size(USABLE(NUMBER_OF_POOLS - 1) + 1) == NUMBER_OF_POOLS,
+                 "oversize maps past the last pool");
+
+    // size class table against a linear scan, for every size up to one past the largest block
+    uint32_t mismatches = 0;
+    for (uint32_t size = 1; size <= USABLE(NUMBER_OF_POOLS - 1) + 1; ++size) {
+        uint32_t expect = 0;
+        while (expect < NUMBER_OF_POOLS && size > USABLE(expect)) expect++;
+        mismatches += alloc_pool_for_size(size) != expect;
+    }
+    assert_check(mismatches == 0, "size class table matches linear scan");
+
+    HEAP_START = (void*)(heap_buf + 1);
+    assert_check(init_heap() == (uint32_t)-1, "misaligned HEAP_START rejected");
+    reset_heap();
+}
+
 // alloc/free/realloc
 static void test_alloc_free_realloc(void) {
     reset_heap();
@@ -259,6 +324,247 @@ static void test_invalid_and_large_allocs(void) {
     assert_check(too == NULL, "alloc too large");
 }
 
+// which pool a block came from, by address
+static uint32_t pool_of(void* p) {
+    uint32_t offset = (uint32_t)((unsigned char*)p - (unsigned char*)HEAP_START);
+    uint32_t idx = 0;
+    while (offset >= POOL_BLOCK_SIZES[idx] * POOL_SIZES[idx]) {
+        offset -= POOL_BLOCK_SIZES[idx] * POOL_SIZES[idx];
+        idx++;
+    }
+    return idx;
+}
+
+// every block must be back on exactly one free list: draining each pool in order must return
+// exactly POOL_SIZES[p] distinct, in-use-marked blocks and nothing more (leaves the heap drained)
+static int pools_intact(void) {
+    int ok = 1;
+    for (uint32_t p = 0; p < NUMBER_OF_POOLS; ++p) {
+        for (uint32_t i = 0; i < POOL_SIZES[p]; ++i) {
+            void* b = alloc(USABLE(p));
+            if (!b || isFree(b) || pool_of(b) != p) ok = 0;
+        }
+    }
+    return ok && alloc(USABLE(0)) == NULL;
+}
+
+// full pools are skipped in one step, and a pool is used again as soon as a block comes back
+static void test_fallback_skips_empty_pools(void) {
+    reset_heap();
+    void* held[3][200];
+    for (uint32_t p = 0; p < 3; ++p)
+        for (uint32_t i = 0; i < POOL_SIZES[p]; ++i) held[p][i] = alloc(USABLE(p));
+
+    void* a = alloc(16);
+    assert_check(a != NULL && pool_of(a) == 3, "alloc(16) falls back past three full pools");
+
+    free(held[1][7]);
+    void* b = alloc(16);
+    assert_check(b == held[1][7], "alloc(16) takes the block returned to pool 1");
+    void* c = alloc(16);
+    assert_check(c != NULL && pool_of(c) == 3, "pool 1 empty again, back to pool 3");
+
+    free(held[0][0]);
+    void* d = alloc(USABLE(1));
+    assert_check(d != NULL && pool_of(d) == 3, "refilled smaller pool is not used for larger size");
+    free(a); free(b); free(c); free(d);
+    for (uint32_t p = 0; p < 3; ++p)
+        for (uint32_t i = 0; i < POOL_SIZES[p]; ++i) free(held[p][i]);
+}
+
+#ifdef ALLOC_STATS
+// per-pool counters: in_use/peak, fallbacks and failures charged to the ideal pool, waste
+static void test_stats(void) {
+    reset_heap();
+    struct alloc_pool_stats_t st;
+    assert_check(!alloc_get_stats(ALLOC_TOTAL_POOLS, &st), "out of range pool rejected");
+
+    void* a = alloc(USABLE(0) - 6);
+    void* b = alloc(USABLE(0));
+    assert_check(alloc_get_stats(0, &st), "stats available");
+    assert_check(st.in_use == 2 && st.peak == 2 && st.allocs == 2, "two live blocks in pool 0");
+    assert_check(st.requested_bytes == 2 * USABLE(0) - 6 && st.wasted_bytes == 2 * POOL_BLOCK_SIZES[0] - st.requested_bytes,
+                 "requested and wasted bytes");
+    free(a);
+    alloc_get_stats(0, &st);
+    assert_check(st.in_use == 1 && st.peak == 2, "peak survives free");
+
+    // empty pool 5 so the next request for it falls back to pool 6, then fill pool 6 too
+    void* held[POOL_SIZES[5] + POOL_SIZES[6]];
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < POOL_SIZES[5]; ++i) held[n++] = alloc(USABLE(5));
+    while (n < POOL_SIZES[5] + POOL_SIZES[6]) held[n++] = alloc(USABLE(5));
+    assert_check(alloc(USABLE(5)) == NULL, "pools 5 and 6 exhausted");
+    assert_check(alloc(USABLE(NUMBER_OF_POOLS - 1) + 1) == NULL, "oversize fails");
+
+    alloc_get_stats(5, &st);
+    assert_check(st.fallbacks == POOL_SIZES[6] && st.failed == 1, "fallbacks and failure charged to ideal pool");
+    alloc_get_stats(6, &st);
+    assert_check(st.allocs == POOL_SIZES[6] && st.fallbacks == 0, "fallback allocs counted where served");
+    assert_check(st.wasted_bytes == POOL_SIZES[6] * (POOL_BLOCK_SIZES[6] - USABLE(5)), "fallback waste");
+    assert_check(st.failed == 1, "oversize charged to last pool");
+
+    for (uint32_t i = 0; i < n; ++i) free(held[i]);
+    alloc_reset_stats();
+    alloc_get_stats(6, &st);
+    assert_check(st.in_use == 0 && st.peak == 0 && st.allocs == 0 && st.failed == 0, "reset");
+    alloc_get_stats(0, &st);
+    assert_check(st.in_use == 1 && st.peak == 1, "reset keeps live blocks");
+    free(b);
+}
+#endif
+
+#ifdef ALLOC_TRACE
+static uint32_t trace_ticks = 0;
+
+// strong override of the weak clock, so entries get increasing timestamps
+uint32_t alloc_trace_clock(void) {
+    return ++trace_ticks;
+}
+
+// every heap call leaves one entry with its op, size, pool, block and caller, oldest first
+static void test_trace(void) {
+    static struct alloc_trace_entry_t out[ALLOC_TRACE_DEPTH];
+    reset_heap();
+    assert_check(alloc_trace.magic == ALLOC_TRACE_MAGIC && alloc_trace.depth == ALLOC_TRACE_DEPTH &&
+                 alloc_trace.entry_size == sizeof(struct alloc_trace_entry_t), "ring header for dumps");
+    assert_check(alloc_trace_copy(out, ALLOC_TRACE_DEPTH) == 0, "init_heap empties the ring");
+
+    unsigned char* a = alloc(10);
+    uint32_t p = alloc_pool_for_size(10);
+    void* u = alloc_uninit(USABLE(2));
+    assert_check(alloc(USABLE(NUMBER_OF_POOLS - 1) + 1) == NULL, "oversize fails");
+    assert_check(alloc_resize(a, 12) == a, "resize in place");
+    unsigned char* b = alloc_resize(a, USABLE(p) + 1);
+    free(u);
+    free(u); // double free, not traced
+
+    uint32_t n = alloc_trace_copy(out, ALLOC_TRACE_DEPTH);
+    assert_check(n == 7, "one entry per call, double free skipped");
+    assert_check(out[0].op == ALLOC_TRACE_ALLOC && out[0].size == 10 && out[0].pool == p &&
+                 out[0].addr == (uint32_t)(uintptr_t)a && out[0].hint == ALLOC_HINT_DEFAULT, "alloc entry");
+    assert_check(out[1].op == ALLOC_TRACE_ALLOC && out[1].pool == 2 && out[1].addr == (uint32_t)(uintptr_t)u,
+                 "alloc_uninit entry");
+    assert_check(out[2].op == ALLOC_TRACE_ALLOC && out[2].addr == 0 && out[2].pool == 0xFF, "failure entry");
+    assert_check(out[3].op == ALLOC_TRACE_RESIZE && out[3].size == 12 && out[3].addr == (uint32_t)(uintptr_t)a,
+                 "in place resize entry");
+    assert_check(out[4].op == ALLOC_TRACE_ALLOC && out[4].addr == (uint32_t)(uintptr_t)b && out[4].pool == p + 1 &&
+                 out[5].op == ALLOC_TRACE_FREE && out[5].addr == (uint32_t)(uintptr_t)a && out[5].pool == p,
+                 "moving resize is an alloc and a free");
+    assert_check(out[4].caller == out[5].caller, "both halves of a move have the resize's caller");
+    assert_check(out[6].op == ALLOC_TRACE_FREE && out[6].addr == (uint32_t)(uintptr_t)u && out[6].size == 0, "free entry");
+
+    uint32_t distinct = 1, ordered = 1;
+    for (uint32_t k = 0; k < n; ++k) {
+        ordered &= k == 0 || out[k].time > out[k - 1].time;
+        if (k > 0 && k != 5) distinct &= out[k].caller != out[k - 1].caller && out[k].caller != 0;
+    }
+    assert_check(ordered, "timestamps from alloc_trace_clock, oldest first");
+    assert_check(distinct, "each call site has its own caller address");
+    free(b);
+
+    // the ring keeps the newest ALLOC_TRACE_DEPTH entries
+    alloc_trace_clear();
+    for (uint32_t k = 0; k < ALLOC_TRACE_DEPTH + 10; ++k) {
+        free(alloc_uninit(k % 100 + 1));
+    }
+    n = alloc_trace_copy(out, ALLOC_TRACE_DEPTH);
+    assert_check(alloc_trace.count == 2 * (ALLOC_TRACE_DEPTH + 10) && n == ALLOC_TRACE_DEPTH, "ring wraps");
+    uint32_t first = ALLOC_TRACE_DEPTH + 10 - ALLOC_TRACE_DEPTH / 2; // allocation the oldest kept entry is from
+    assert_check(out[0].op == ALLOC_TRACE_ALLOC && out[0].size == first % 100 + 1 &&
+                 out[n - 1].op == ALLOC_TRACE_FREE, "oldest kept entry first");
+    assert_check(alloc_trace_copy(out, 3) == 3 && out[2].op == ALLOC_TRACE_FREE && out[1].size == (ALLOC_TRACE_DEPTH + 9) % 100 + 1,
+                 "copy of fewer entries keeps the newest");
+}
+#endif
+
+static _Alignas(ALLOC_ALIGN) unsigned char dtcm_buf[sizeof(struct alloc_DTCM_layout_t)];
+static _Alignas(ALLOC_DMA_ALIGN) unsigned char axi_buf[sizeof(struct alloc_AXI_layout_t)];
+
+static int in_buf(void* p, unsigned char* buf, size_t size) {
+    return (unsigned char*)p >= buf && (unsigned char*)p < buf + size;
+}
+
+// placement hints pick the region, fall back to the default region, and skip unused regions
+static void test_regions(void) {
+    reset_heap(); // DTCM and AXI not in use
+    void* f = alloc_hint(16, ALLOC_HINT_FAST);
+    assert_check(in_buf(f, heap_buf, sizeof(heap_buf)), "unused region skipped");
+    free(f);
+
+    HEAP_DTCM_START = dtcm_buf;
+    HEAP_AXI_START = axi_buf + 1;
+    assert_check(init_heap() == (uint32_t)-1, "misaligned region start rejected");
+    HEAP_AXI_START = axi_buf;
+    assert_check(init_heap() == 1, "init with three regions");
+
+    void* d = alloc(16);
+    void* fast = alloc_hint(16, ALLOC_HINT_FAST);
+    void* dma = alloc_hint(16, ALLOC_HINT_DMA);
+    assert_check(in_buf(d, heap_buf, sizeof(heap_buf)), "alloc uses the default region");
+    assert_check(in_buf(fast, dtcm_buf, sizeof(dtcm_buf)), "FAST hint places in DTCM");
+    assert_check(in_buf(dma, axi_buf, sizeof(axi_buf)), "DMA hint places in AXI SRAM");
+    assert_check(!isFree(fast) && !isFree(dma), "blocks in other regions marked in use");
+    free(fast);
+    free(dma);
+    assert_check(isFree(fast) && isFree(dma), "blocks in other regions freed");
+    assert_check(alloc_hint(16, ALLOC_HINT_DMA) == dma, "freed AXI block reused");
+    assert_check(alloc_hint(16, (enum alloc_hint_t)42) == NULL, "unknown hint rejected");
+    assert_check(slab_create(16, 4, (enum alloc_hint_t)42) == NULL, "unknown slab hint rejected");
+
+    void* big = alloc_hint(4096 - ALLOC_GUARD_SIZE, ALLOC_HINT_DMA);
+    assert_check(in_buf(big, axi_buf, sizeof(axi_buf)) &&
+                 (unsigned char*)big + 4096 <= axi_buf + sizeof(axi_buf), "4 KiB block from AXI");
+    assert_check(alloc(4096) == NULL, "default region has no 4 KiB blocks");
+    void* spill = alloc_hint(512, ALLOC_HINT_FAST);
+    assert_check(in_buf(spill, heap_buf, sizeof(heap_buf)), "too big for DTCM falls back to default");
+
+    // FAST requests fill every DTCM pool they fit in before spilling to the default region
+    uint32_t dtcm_blocks = sizeof(struct alloc_DTCM_blocks_t);
+    uint32_t in_dtcm = 0;
+    for (uint32_t i = 0; i < dtcm_blocks; ++i) {
+        void* p = alloc_hint(16 - ALLOC_GUARD_SIZE, ALLOC_HINT_FAST);
+        in_dtcm += in_buf(p, dtcm_buf, sizeof(dtcm_buf));
+    }
+    assert_check(in_dtcm == dtcm_blocks, "DTCM hands out every block");
+    void* over = alloc_hint(16 - ALLOC_GUARD_SIZE, ALLOC_HINT_FAST);
+    assert_check(in_buf(over, heap_buf, sizeof(heap_buf)), "then spills to the default region");
+}
+
+// alloc_dma: AXI only, cache line aligned and padded, not zeroed
+static void test_alloc_dma(void) {
+    reset_heap(); // AXI not in use
+    assert_check(alloc_dma(16) == NULL, "no AXI region, no DMA buffer");
+
+    memset(axi_buf, 0xA5, sizeof(axi_buf));
+    HEAP_AXI_START = axi_buf + ALLOC_ALIGN;
+    assert_check(init_heap() == (uint32_t)-1, "AXI start off a cache line rejected");
+    HEAP_AXI_START = axi_buf;
+    assert_check(init_heap() == 1, "init with AXI region");
+
+    void* a = alloc_dma(1);
+    void* b = alloc_dma(33);
+    void* c = alloc_dma(33);
+    assert_check(in_buf(a, axi_buf, sizeof(axi_buf)) && in_buf(b, axi_buf, sizeof(axi_buf)),
+                 "DMA buffers come from AXI SRAM");
+    assert_check((uintptr_t)a % ALLOC_DMA_ALIGN == 0 && (uintptr_t)b % ALLOC_DMA_ALIGN == 0 &&
+                 (uintptr_t)c % ALLOC_DMA_ALIGN == 0, "DMA buffers start on a cache line");
+    uintptr_t gap = (uintptr_t)c > (uintptr_t)b ? (uintptr_t)c - (uintptr_t)b : (uintptr_t)b - (uintptr_t)c;
+    assert_check(gap >= 64, "33 bytes are padded to two whole lines");
+
+    free(a);
+    assert_check(isFree(a), "DMA buffer freed with free()");
+    unsigned char* again = alloc_dma(ALLOC_DMA_ALIGN - ALLOC_GUARD_SIZE);
+    assert_check(again == a, "freed DMA buffer reused");
+    unsigned char* fresh = alloc_dma(512);
+    assert_check(fresh[ALLOC_DMA_ALIGN - 1] == 0xA5, "DMA buffer is not zeroed");
+    assert_check(alloc_dma(4097) == NULL, "larger than the largest AXI block");
+    free(again);
+    free(fresh);
+    free(b);
+    free(c);
+}
+
 // isFree across pools
 static void test_isFree_across_pools(void) {
     reset_heap();
@@ -294,7 +600,7 @@ static void test_stress_pattern(void) {
 // allocate every block in pool idx, check exhaustion, free one and re-alloc
 static void test_pool_generic(uint32_t idx) {
     reset_heap();
-    uint32_t sz = POOL_BLOCK_SIZES[idx];
+    uint32_t sz = USABLE(idx);
     uint32_t cnt = POOL_SIZES[idx];
 
     // allocate all blocks from the pool
@@ -338,11 +644,421 @@ static void test_pool_256(void)  { test_pool_generic(4); }
 static void test_pool_512(void)  { test_pool_generic(5); }
 static void test_pool_1024(void) { test_pool_generic(6); }
 
-int main(void) {
+// concurrent alloc/free: each pthread stands in for an ISR or thread context hammering the allocator
+#define STRESS_THREADS 4
+#define STRESS_ITERS 200000
+#define STRESS_HELD 8
+
+static volatile int stress_corrupt = 0;
+
+static void* stress_worker(void* arg) {
+    unsigned id = (unsigned)(size_t)arg;
+    unsigned seed = id * 2654435761u + 1;
+    unsigned char* held[STRESS_HELD] = {0};
+    uint32_t held_size[STRESS_HELD] = {0};
+
+    for (int n = 0; n < STRESS_ITERS; ++n) {
+        seed = seed * 1103515245u + 12345u;
+        int slot = (int)((seed >> 16) % STRESS_HELD);
+        if (held[slot]) {
+            // block must still hold our pattern, otherwise someone else was handed it too
+            for (uint32_t k = 0; k < held_size[slot]; ++k) {
+                if (held[slot][k] != (unsigned char)(id + 1)) { stress_corrupt = 1; break; }
+            }
+            free(held[slot]);
+            held[slot] = NULL;
+        } else {
+            uint32_t sz = USABLE((seed >> 8) % 3); // small pools, most contention
+            unsigned char* p = alloc(sz);
+            if (p) {
+                memset(p, (int)(id + 1), sz);
+                held[slot] = p;
+                held_size[slot] = sz;
+            }
+        }
+    }
+    for (int k = 0; k < STRESS_HELD; ++k) if (held[k]) free(held[k]);
+    return NULL;
+}
+
+static void test_concurrent_alloc_free(void) {
+    reset_heap();
+    pthread_t th[STRESS_THREADS];
+    for (size_t t = 0; t < STRESS_THREADS; ++t) {
+        pthread_create(&th[t], NULL, stress_worker, (void*)t);
+    }
+    for (int t = 0; t < STRESS_THREADS; ++t) pthread_join(th[t], NULL);
+
+    assert_check(!stress_corrupt, "no block handed to two contexts at once");
+    assert_check(pools_intact(), "free lists intact after stress");
+}
+
+// alloc_cached()/free_cached() stay inside the cache until it runs dry or overflows
+static void test_cache_basic(void) {
+    reset_heap();
+    struct alloc_cache_t cache = {0};
+
+    void* a = alloc_cached(&cache, USABLE(0));
+    assert_check(a != NULL && !isFree(a), "cached alloc");
+    assert_check(cache.count[0] == ALLOC_CACHE_DEPTH / 2 - 1, "refilled half a cache");
+    free_cached(&cache, a);
+    assert_check(!isFree(a), "block in cache still reads as in use");
+    void* s = alloc(USABLE(0));
+    assert_check(s != a, "shared pool does not see cached block");
+    assert_check(alloc_cached(&cache, USABLE(0)) == a, "cache hands back its own block first (LIFO)");
+
+    // overflow: the cache keeps at most ALLOC_CACHE_DEPTH blocks per pool
+    void* blk[ALLOC_CACHE_DEPTH * 2];
+    for (int i = 0; i < ALLOC_CACHE_DEPTH * 2; ++i) blk[i] = alloc(USABLE(1));
+    for (int i = 0; i < ALLOC_CACHE_DEPTH * 2; ++i) free_cached(&cache, blk[i]);
+    assert_check(cache.count[1] <= ALLOC_CACHE_DEPTH, "cache bounded");
+    uint32_t back = 0;
+    for (int i = 0; i < ALLOC_CACHE_DEPTH * 2; ++i) back += isFree(blk[i]);
+    assert_check(back == (uint32_t)(ALLOC_CACHE_DEPTH * 2 - cache.count[1]), "overflow returned to shared pool");
+
+    memset(a, 0x5A, USABLE(0));
+    free_cached(&cache, a);
+    unsigned char* z = alloc_cached(&cache, USABLE(0));
+    assert_check(z == a && z[0] == 0 && z[USABLE(0) - 1] == 0, "cached alloc zeroes");
+    assert_check(alloc_cached(&cache, 0) == NULL, "alloc_cached(0)");
+    assert_check(alloc_cached(&cache, USABLE(NUMBER_OF_POOLS - 1) + 1) == NULL, "too large");
+
+    free_cached(&cache, z);
+    free(s);
+    alloc_cache_flush(&cache);
+    assert_check(cache.count[0] == 0 && cache.count[1] == 0, "flush empties cache");
+    assert_check(isFree(a) && pools_intact(), "flush returns every block");
+}
+
+// pool exhaustion through a cache still falls back to larger pools
+static void test_cache_fallback(void) {
+    reset_heap();
+    struct alloc_cache_t cache = {0};
+    void* held[1024];
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < POOL_SIZES[5]; ++i) held[n++] = alloc_cached(&cache, USABLE(5));
+    void* x = alloc_cached(&cache, USABLE(5));
+    assert_check(x != NULL && pool_of(x) == 6, "cached alloc falls back when pool is empty");
+    free_cached(&cache, x);
+    for (uint32_t i = 0; i < n; ++i) free_cached(&cache, held[i]);
+    alloc_cache_flush(&cache);
+    assert_check(pools_intact(), "pools intact");
+}
+
+#define SCALE_ITERS 200000
+
+struct scale_arg {
+    int cached;
+    unsigned id;
+};
+
+static void* scale_worker(void* argp) {
+    struct scale_arg* arg = argp;
+    struct alloc_cache_t cache = {0};
+    void* held[4] = {0};
+    for (int n = 0; n < SCALE_ITERS; ++n) {
+        int k = n & 3;
+        uint32_t sz = USABLE((n >> 2) % 3);
+        if (arg->cached) {
+            free_cached(&cache, held[k]);
+            held[k] = alloc_cached(&cache, sz);
+        } else {
+            free(held[k]);
+            held[k] = alloc(sz);
+        }
+        if (held[k]) *(unsigned*)held[k] = arg->id;
+    }
+    for (int k = 0; k < 4; ++k) free(held[k]);
+    alloc_cache_flush(&cache);
+    return NULL;
+}
+
+// micro-benchmark: shared pools vs per-thread caches with 1..4 threads
+static void test_cache_scaling(void) {
+    int ok = 1;
+    for (int cached = 0; cached <= 1; ++cached) {
+        for (int threads = 1; threads <= 4; threads *= 2) {
+            reset_heap();
+            pthread_t th[4];
+            struct scale_arg args[4];
+            double t0 = now_ns();
+            for (int t = 0; t < threads; ++t) {
+                args[t] = (struct scale_arg){cached, (unsigned)t};
+                pthread_create(&th[t], NULL, scale_worker, &args[t]);
+            }
+            for (int t = 0; t < threads; ++t) pthread_join(th[t], NULL);
+            double mops = (double)threads * SCALE_ITERS / ((now_ns() - t0) / 1e3);
+            log_printf("      %-6s %d thread(s): %6.2f M alloc+free/s\n", cached ? "cached" : "shared", threads, mops);
+            ok &= pools_intact();
+        }
+    }
+    assert_check(ok, "pools intact after scaling runs");
+}
+
+// alloc() zeroes the whole block, alloc_uninit() leaves it alone
+static void test_alloc_uninit_contents(void) {
+    for (uint32_t p = 0; p < NUMBER_OF_POOLS; ++p) {
+        reset_heap(); // heap is filled with 0xA5
+        unsigned char* u = alloc_uninit(USABLE(p));
+        uint32_t kept = 0;
+        for (uint32_t i = sizeof(void*); i < USABLE(p); ++i) kept += u[i] == 0xA5;
+        assert_check(u != NULL && kept == USABLE(p) - sizeof(void*), "alloc_uninit leaves contents");
+        assert_check(!isFree(u), "alloc_uninit marks block in use");
+        free(u);
+
+        unsigned char* z = alloc(USABLE(p));
+        uint32_t zeros = 0;
+        for (uint32_t i = 0; i < USABLE(p); ++i) zeros += z[i] == 0;
+        assert_check(z == u && zeros == USABLE(p), "alloc zeroes the whole block");
+        free(z);
+    }
+    assert_check(alloc_uninit(0) == NULL, "alloc_uninit(0)");
+    assert_check(alloc_uninit(USABLE(NUMBER_OF_POOLS - 1) + 1) == NULL, "alloc_uninit too large");
+}
+
+struct test_descriptor_t { uint32_t a; uint32_t b; uint8_t c; }; // 12 bytes, 16 byte pool block
+
+SLAB_DEFINE(test_slab, struct test_descriptor_t, 10);
+
+// static slab: no init, exact stride, O(1) recycle, foreign pointers ignored
+static void test_slab_static(void) {
+    reset_heap();
+    assert_check(test_slab.stride == 16 && sizeof(test_slab_storage) == 160, "stride rounds to ALLOC_ALIGN only");
+
+    struct test_descriptor_t* objs[10];
+    for (int i = 0; i < 10; ++i) {
+        objs[i] = slab_alloc(&test_slab);
+        assert_check(objs[i] == (void*)(test_slab_storage + 16 * i), "objects handed out in address order");
+    }
+    assert_check(slab_alloc(&test_slab) == NULL, "slab exhausted");
+
+    objs[3]->a = 0xDEADBEEF;
+    objs[3]->c = 7;
+    slab_free(&test_slab, objs[3]);
+    slab_free(&test_slab, NULL);
+    slab_free(&test_slab, (uint8_t*)objs[5] + 4);
+    slab_free(&test_slab, heap_buf);
+    struct test_descriptor_t* again = slab_alloc(&test_slab);
+    assert_check(again == objs[3] && again->a == 0 && again->c == 0, "freed object reused, zeroed");
+    assert_check(slab_alloc(&test_slab) == NULL, "misaligned and foreign pointers ignored");
+    assert_check(isFree(heap_buf), "pool heap untouched by static slab");
+
+    struct alloc_slab_t s;
+    static _Alignas(ALLOC_ALIGN) uint8_t buf[SLAB_BYTES(20, 4)];
+    assert_check(!slab_init(&s, buf + 4, 20, 4), "misaligned buffer rejected");
+    assert_check(!slab_init(&s, buf, 20, 0), "empty slab rejected");
+    assert_check(!slab_init(&s, buf, 0, 4), "zero object size rejected");
+    assert_check(!slab_init(&s, buf, 0xFFFFFFFCu, 1), "stride overflow rejected");
+    assert_check(!slab_init(&s, buf, 0x10000000u, 16), "slab size overflow rejected");
+    assert_check(slab_init(&s, buf, 20, 4) && s.stride == 24, "runtime slab on a static buffer");
+    void* x = slab_alloc(&s);
+    void* y = slab_alloc(&s);
+    assert_check(x == buf && y == buf + 24, "packed at the rounded stride");
+}
+
+// slab_create: carves one pool block, O(1), packs more objects than individual allocs
+static void test_slab_create(void) {
+    reset_heap();
+    assert_check(slab_create(12, 0, ALLOC_HINT_DEFAULT) == NULL, "empty slab");
+    assert_check(slab_create(0, 4, ALLOC_HINT_DEFAULT) == NULL, "zero object size");
+    assert_check(slab_create(1024, 64, ALLOC_HINT_DEFAULT) == NULL, "larger than any block");
+    assert_check(slab_create(0xFFFFFFF0u, 2, ALLOC_HINT_DEFAULT) == NULL, "size overflow");
+
+    // 20 objects of 12 bytes: 20 * 16 + header fits a 512 block, where alloc(12) x 20 takes 20 blocks
+    struct alloc_slab_t* s = slab_create(12, 20, ALLOC_HINT_DEFAULT);
+    assert_check(s != NULL && !isFree(s), "slab block taken from the pools");
+    assert_check(pool_of(s) == 5, "smallest block that fits the slab");
+
+    void* objs[20];
+    for (int i = 0; i < 20; ++i) {
+        objs[i] = slab_alloc(s);
+        assert_check(objs[i] != NULL && (uintptr_t)objs[i] % ALLOC_ALIGN == 0, "aligned object");
+        assert_check((uint8_t*)objs[i] + 12 <= (uint8_t*)s + 512 && (uint8_t*)objs[i] >= (uint8_t*)(s + 1),
+                     "object inside the slab block, after the descriptor");
+    }
+    assert_check(slab_alloc(s) == NULL, "slab exhausted");
+    for (int i = 0; i < 20; ++i) slab_free(s, objs[i]);
+    assert_check(slab_alloc(s) == objs[19], "LIFO reuse");
+
+    free(s);
+    assert_check(isFree(s), "slab released with free()");
+}
+
+// arena: aligned bump allocation, nested marks, O(1) reset
+static void test_arena_basic(void) {
+    static _Alignas(ALLOC_ALIGN) uint8_t buf[260];
+    struct alloc_arena_t a;
+    assert_check(!arena_init(&a, buf + 1, 64), "misaligned buffer rejected");
+    assert_check(arena_init(&a, buf, sizeof(buf)) && a.size == 256, "size rounded down to ALLOC_ALIGN");
+
+    uint8_t* p = arena_alloc(&a, 3);
+    uint8_t* q = arena_alloc(&a, 17);
+    assert_check(p == buf && q == buf + ALLOC_ALIGN, "bump, rounded to ALLOC_ALIGN");
+    assert_check(arena_alloc(&a, 0) == NULL, "arena_alloc(0)");
+
+    uint32_t outer = arena_mark(&a);
+    uint8_t* r = arena_alloc(&a, 40);
+    uint32_t inner = arena_mark(&a);
+    arena_alloc(&a, 40);
+    arena_release(&a, inner);
+    assert_check(arena_alloc(&a, 8) == r + 40, "inner release");
+    arena_release(&a, outer);
+    assert_check(arena_alloc(&a, 8) == r, "outer release drops inner allocations too");
+    arena_release(&a, inner); // stale, above the fill
+    assert_check(arena_mark(&a) == outer + 8, "stale mark ignored");
+
+    arena_reset(&a);
+    assert_check(arena_alloc(&a, 256) == buf, "reset, whole arena in one go");
+    assert_check(arena_alloc(&a, 1) == NULL, "full");
+    arena_reset(&a);
+    assert_check(arena_alloc(&a, 0xFFFFFFFFu) == NULL, "huge request does not wrap");
+}
+
+// arena_create: carves one pool block and uses all of it
+static void test_arena_create(void) {
+    reset_heap();
+    assert_check(arena_create(4096, ALLOC_HINT_DEFAULT) == NULL, "larger than any block");
+    struct alloc_arena_t* a = arena_create(400, ALLOC_HINT_DEFAULT);
+    assert_check(a != NULL && pool_of(a) == 5 && !isFree(a), "arena in the smallest block that fits");
+    assert_check(a->base >= (uint8_t*)(a + 1) && a->base + a->size == (uint8_t*)a + 512 - ALLOC_GUARD_SIZE,
+                 "arena gets the rest of the block");
+    uint32_t n = 0;
+    while (arena_alloc(a, 16) != NULL) n++;
+    assert_check(n == a->size / 16, "every byte usable");
+    free(a);
+    assert_check(isFree(a), "arena released with free()");
+}
+
+// alloc_usable_size / alloc_resize: in place while it fits, one move to a larger block otherwise
+static void test_alloc_resize(void) {
+    reset_heap();
+    assert_check(alloc_usable_size(NULL) == 0 && alloc_usable_size(heap_buf + TOTAL_HEAP_SIZE) == 0,
+                 "no usable size outside the heap");
+
+    unsigned char* a = alloc_resize(NULL, 10);
+    uint32_t p = alloc_pool_for_size(10);
+    assert_check(a != NULL && alloc_usable_size(a) == USABLE(p), "resize(NULL) allocates, usable = pool size");
+    for (uint32_t i = 0; i < USABLE(p); ++i) a[i] = (unsigned char)i;
+    assert_check(alloc_resize(a, USABLE(p)) == a, "grow within the block keeps the pointer");
+    assert_check(alloc_resize(a, 1) == a, "shrink keeps the pointer");
+
+    unsigned char* b = alloc_resize(a, USABLE(p) + 1);
+    uint32_t same = 0;
+    for (uint32_t i = 0; i < USABLE(p); ++i) same += b[i] == (unsigned char)i;
+    assert_check(b != a && same == USABLE(p), "grow past the block moves the contents");
+    assert_check(isFree(a) && !isFree(b) && alloc_usable_size(b) == USABLE(p + 1), "old block freed");
+
+    assert_check(alloc_resize(b, USABLE(NUMBER_OF_POOLS - 1) + 1) == NULL && !isFree(b), "too large leaves the block");
+    assert_check(alloc_resize(b, 0) == NULL && isFree(b), "resize to 0 frees");
+
+    // a growing buffer only moves when it crosses a pool
+    unsigned char* frame = NULL;
+    uint32_t moves = 0;
+    for (uint32_t len = 1; len <= USABLE(NUMBER_OF_POOLS - 1); ++len) {
+        unsigned char* next = alloc_resize(frame, len);
+        moves += next != frame;
+        frame = next;
+        frame[len - 1] = (unsigned char)len;
+    }
+    assert_check(moves == NUMBER_OF_POOLS && frame[99] == 100, "one move per pool crossed");
+    free(frame);
+
+    // blocks stay in their region
+    HEAP_DTCM_START = dtcm_buf;
+    HEAP_AXI_START = axi_buf;
+    init_heap();
+    void* fast = alloc_resize(alloc_hint(16 - ALLOC_GUARD_SIZE, ALLOC_HINT_FAST), 100);
+    void* dma = alloc_resize(alloc_dma(16), 1000);
+    assert_check(in_buf(fast, dtcm_buf, sizeof(dtcm_buf)), "DTCM block grows within DTCM");
+    assert_check(in_buf(dma, axi_buf, sizeof(axi_buf)) && (uintptr_t)dma % ALLOC_DMA_ALIGN == 0,
+                 "DMA block grows within AXI, line aligned");
+}
+
+// overrides the allocator's weak handler so faults are recorded instead of stopping the test
+static enum alloc_fault_t last_fault = ALLOC_OK;
+static void* last_fault_block = NULL;
+static uint32_t fault_count = 0;
+
+void alloc_fault_handler(enum alloc_fault_t fault, void* block) {
+    last_fault = fault;
+    last_fault_block = block;
+    fault_count++;
+}
+
+// heap_validate: clean heap passes, double free is skipped, corrupted lists are caught
+static void test_heap_validate(void) {
+    reset_heap();
+    fault_count = 0;
+    assert_check(heap_validate() == ALLOC_OK, "fresh heap valid");
+
+    void* held[40];
+    for (int i = 0; i < 40; ++i) held[i] = alloc(1 + (uint32_t)i * 7);
+    for (int i = 0; i < 40; i += 3) free(held[i]);
+    assert_check(heap_validate() == ALLOC_OK && fault_count == 0, "mixed alloc/free valid");
+
+    void* a = alloc(USABLE(0));
+    free(a);
+    free(a); // skipped: the block is already marked free
+    void* x = alloc(USABLE(0));
+    void* y = alloc(USABLE(0));
+    assert_check(x == a && y != a, "double free does not put a block on its list twice");
+    assert_check(heap_validate() == ALLOC_OK, "heap valid after double free");
+
+    // write after free: a free block's list link overwritten
+    free(y);
+    *(void**)y = heap_buf + 3;
+    assert_check(heap_validate() == ALLOC_FAULT_FREE_LIST && last_fault == ALLOC_FAULT_FREE_LIST,
+                 "bad free list link caught");
+    *(void**)y = y; // cycle
+    assert_check(heap_validate() == ALLOC_FAULT_FREE_LIST, "free list cycle caught");
+}
+
+#ifdef ALLOC_DEBUG
+// An aligned object outside the heap, for frees of foreign pointers
+static _Alignas(ALLOC_ALIGN) unsigned char outside_heap[32];
+
+// ALLOC_DEBUG: free() checks alignment, double frees and guard words, each reported to the handler
+static void test_debug_checks(void) {
+    reset_heap();
+    unsigned char* a = alloc(20);
+    unsigned char* b = alloc(20);
+
+    fault_count = 0;
+    free(a + 4);
+    assert_check(last_fault == ALLOC_FAULT_MISALIGNED && last_fault_block == a + 4, "interior pointer reported");
+    assert_check(!isFree(a), "interior pointer not freed");
+
+    free(a);
+    free(a);
+    assert_check(last_fault == ALLOC_FAULT_DOUBLE_FREE && last_fault_block == a && fault_count == 2, "double free reported");
+
+    free(outside_heap);
+    assert_check(last_fault == ALLOC_FAULT_BAD_POINTER, "pointer outside the heap reported");
+
+    uint32_t usable = POOL_BLOCK_SIZES[alloc_pool_for_size(20)] - ALLOC_GUARD_SIZE;
+    assert_check(usable >= 20, "request fits before the guard");
+    b[usable] = 0; // one byte past the usable end
+    fault_count = 0;
+    assert_check(heap_validate() == ALLOC_FAULT_GUARD && last_fault_block == b, "overrun found by heap_validate");
+    free(b);
+    assert_check(last_fault == ALLOC_FAULT_GUARD && fault_count == 2 && isFree(b), "overrun reported by free, block still freed");
+
+    struct alloc_cache_t cache = {0};
+    void* c = alloc(20);
+    free(c);
+    free_cached(&cache, c);
+    assert_check(last_fault == ALLOC_FAULT_DOUBLE_FREE && cache.count[alloc_pool_for_size(20)] == 0,
+                 "double free into a cache reported");
+}
+#endif
+
+// test_alloc [log file], the log defaults to alloctest_output.txt in the working directory
+int main(int argc, char** argv) {
     // open output file
-    out_fp = fopen("alloctest_output.txt", "w");
+    const char* out_path = argc > 1 ? argv[1] : "alloctest_output.txt";
+    out_fp = fopen(out_path, "w");
     if (!out_fp) {
-        perror("fopen alloctest_output.txt");
+        perror(out_path);
         // continue without file output
     }
 
@@ -350,12 +1066,23 @@ int main(void) {
 
     TestCase tests[] = {
         TEST_CASE(test_init_heap_basic),
+        TEST_CASE(test_init_is_lazy),
+        TEST_CASE(test_pool_table),
         TEST_CASE(test_alloc_free_realloc),
         TEST_CASE(test_double_free),
         TEST_CASE(test_free_null_and_oob),
         TEST_CASE(test_exhaust_small_pool),
         TEST_CASE(test_invalid_and_large_allocs),
         TEST_CASE(test_isFree_across_pools),
+        TEST_CASE(test_fallback_skips_empty_pools),
+        TEST_CASE(test_regions),
+        TEST_CASE(test_alloc_dma),
+#ifdef ALLOC_STATS
+        TEST_CASE(test_stats),
+#endif
+#ifdef ALLOC_TRACE
+        TEST_CASE(test_trace),
+#endif
         
         TEST_CASE(test_pool_16),
         TEST_CASE(test_pool_32),
@@ -365,7 +1092,23 @@ int main(void) {
         TEST_CASE(test_pool_512),
         TEST_CASE(test_pool_1024),
 
-        TEST_CASE(test_stress_pattern)
+        TEST_CASE(test_stress_pattern),
+        TEST_CASE(test_concurrent_alloc_free),
+        TEST_CASE(test_cache_basic),
+        TEST_CASE(test_cache_fallback),
+
+        TEST_CASE(test_alloc_uninit_contents),
+        TEST_CASE(test_slab_static),
+        TEST_CASE(test_slab_create),
+        TEST_CASE(test_arena_basic),
+        TEST_CASE(test_arena_create),
+        TEST_CASE(test_alloc_resize),
+        TEST_CASE(test_heap_validate),
+#ifdef ALLOC_DEBUG
+        TEST_CASE(test_debug_checks),
+#endif
+
+        TEST_CASE(test_cache_scaling)
     };
 
     int num_tests = sizeof(tests) / sizeof(tests[0]);
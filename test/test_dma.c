@@ -0,0 +1,826 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mmio_fake.h"
+#include "internal/dma.h"
+#include "internal/interrupt.h"
+#include "internal/mmio/dmax.h"
+#include "internal/mmio/dmamux1.h"
+#include "internal/mmio/rcc.h"
+
+// Tests of the DMA1/DMA2 stream driver against the register fake (see mmio_fake.h).
+//
+// fake_finish() stands in for the controller: it moves the transfer programmed into a stream's
+// registers, raises the stream's flags and runs its IRQ handler, as the NVIC would.
+
+static rw_reg32_t const *const stream_cr[DMA_STREAM_COUNT] = {
+    DMAx_S0CR, DMAx_S1CR, DMAx_S2CR, DMAx_S3CR,
+    DMAx_S4CR, DMAx_S5CR, DMAx_S6CR, DMAx_S7CR,
+};
+
+static void (*const stream_irq[DMA_INSTANCE_COUNT][DMA_STREAM_COUNT])() = {
+    [DMA1] = {dma_str0_irq_handler, dma_str1_irq_handler, dma_str2_irq_handler, dma_str3_irq_handler,
+              dma_str4_irq_handler, dma_str5_irq_handler, dma_str6_irq_handler, dma1_str7_irq_handler},
+    [DMA2] = {dma2_str0_irq_handler, dma2_str1_irq_handler, dma2_str2_irq_handler, dma2_str3_irq_handler,
+              dma2_str4_irq_handler, dma2_str5_irq_handler, dma2_str6_irq_handler, dma2_str7_irq_handler},
+};
+
+static int total_asserts = 0;
+static int total_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+static void check(int condition, const char* msg, int line) {
+    total_asserts++;
+    if (!condition) {
+        total_failures++;
+        printf("    - line %d: %s [FAIL]\n", line, msg);
+    }
+}
+
+// callback record
+static int callback_count;
+static bool callback_success;
+static void* callback_context;
+static void* callback_log[8];
+
+static void record_callback(bool success, void* context) {
+    if (callback_count < 8) callback_log[callback_count] = context;
+    callback_count++;
+    callback_success = success;
+    callback_context = context;
+}
+
+// Tests configure fixed streams, which takes them out of the pool: put every stream back
+static void reset(void) {
+    for (int bit = 0; bit < 2 * DMA_STREAM_COUNT; bit++) {
+        dma_release_stream((dma_stream_id_t){DMA_INSTANCE_MIN + bit % 2, bit / 2}, NULL);
+    }
+    mmio_fake_reset();
+    callback_count = 0;
+    callback_success = false;
+    callback_context = NULL;
+}
+
+static uint8_t* sram(uint32_t offset) {
+    return (uint8_t*)(uintptr_t)(MMIO_FAKE_SRAM_BASE + offset);
+}
+
+static bool nvic_enabled(int32_t irq) {
+    return (MMIO_FAKE_REG(0xE000E100U + 4U * (uint32_t)(irq / 32)) >> (irq % 32)) & 1U;
+}
+
+static uint32_t isr_value(dma_instance_t instance, dma_stream_t stream) {
+    return stream < 4 ? *DMAx_LISR[instance] : *DMAx_HISR[instance];
+}
+
+static void set_isr(dma_instance_t instance, dma_stream_t stream, uint32_t value) {
+    MMIO_FAKE_REG(stream < 4 ? DMAx_LISR[instance] : DMAx_HISR[instance]) = value;
+}
+
+static uint32_t ifcr_value(dma_instance_t instance, dma_stream_t stream) {
+    return stream < 4 ? *DMAx_LIFCR[instance] : *DMAx_HIFCR[instance];
+}
+
+// Moves the programmed transfer, then ends it with the given flags (TCIF and/or TEIF of the stream)
+static void fake_finish(dma_instance_t instance, dma_stream_t stream, bool error) {
+    rw_reg32_t cr = stream_cr[stream][instance];
+    const bool to_periph = READ_FIELD(cr, DMAx_S0CR_DIR) == MEM_TO_PERIPH;
+    const uint32_t periph_width = 1U << READ_FIELD(cr, DMAx_S0CR_PSIZE);
+    const bool minc = IS_FIELD_SET(cr, DMAx_S0CR_MINC);
+    const uint32_t items = READ_FIELD(DMAx_SxNDTR[instance][stream], DMAx_SxNDTR_NDT);
+    uint8_t* periph = (uint8_t*)(uintptr_t)*DMAx_SxPAR[instance][stream];
+    uint8_t* mem = (uint8_t*)(uintptr_t)*DMAx_SxM0AR[instance][stream];
+
+    if (!error) {
+        for (uint32_t i = 0; i < items; i++) {
+            uint8_t* m = mem + (minc ? i * periph_width : 0);
+            if (to_periph) memcpy(periph, m, periph_width);
+            else memcpy(m, periph, periph_width);
+        }
+        *DMAx_SxNDTR[instance][stream] = 0;
+    }
+    CLR_FIELD(cr, DMAx_S0CR_EN);
+
+    const uint32_t slot = stream % 4;
+    const uint32_t flag = error ? DMAx_LISR_TEIFx[slot].msk : DMAx_LISR_TCIFx[slot].msk;
+    set_isr(instance, stream, isr_value(instance, stream) | flag);
+    stream_irq[instance][stream]();
+}
+
+static dma_config_t tx_config(dma_instance_t instance, dma_stream_t stream) {
+    return (dma_config_t){
+        .instance = instance,
+        .stream = stream,
+        .request_id = 42,
+        .direction = MEM_TO_PERIPH,
+        .src_data_size = DMA_DATA_SIZE_BYTE,
+        .dest_data_size = DMA_DATA_SIZE_BYTE,
+        .priority = DMA_PRIORITY_HIGH,
+        .fifo_enabled = false,
+        .fifo_threshold = DMA_FIFO_THRESHOLD_FULL,
+        .callback = record_callback,
+    };
+}
+
+static void test_init_enables_clocks(void) {
+    reset();
+    CHECK(dma_init() == NULL);
+    CHECK(IS_FIELD_SET(RCC_AHB1ENR, RCC_AHB1ENR_DMAxEN[1]));
+    CHECK(IS_FIELD_SET(RCC_AHB1ENR, RCC_AHB1ENR_DMAxEN[2]));
+}
+
+static void test_configure_routes_request(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_3);
+    CHECK(dma_configure_stream(&config));
+    CHECK(READ_FIELD(DMAMUX1_CxCR[3], DMAMUX1_CxCR_DMAREQ_ID) == 42);
+    CHECK(nvic_enabled(DMAx_STRx_IRQ_NUM[DMA1][DMA_STREAM_3]));
+
+    // DMA2 streams sit behind DMAMUX1 channels 8-15
+    config = tx_config(DMA2, DMA_STREAM_5);
+    config.request_id = 71;
+    CHECK(dma_configure_stream(&config));
+    CHECK(READ_FIELD(DMAMUX1_CxCR[13], DMAMUX1_CxCR_DMAREQ_ID) == 71);
+    CHECK(READ_FIELD(DMAMUX1_CxCR[5], DMAMUX1_CxCR_DMAREQ_ID) == 0);
+    CHECK(nvic_enabled(DMAx_STRx_IRQ_NUM[DMA2][DMA_STREAM_5]));
+}
+
+static void test_configure_stream_registers(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_7);
+    config.src_data_size = DMA_DATA_SIZE_WORD;
+    config.dest_data_size = DMA_DATA_SIZE_HALFWORD;
+    config.fifo_enabled = true;
+    config.fifo_threshold = DMA_FIFO_THRESHOLD_QUARTER;
+    CHECK(dma_configure_stream(&config));
+
+    rw_reg32_t cr = DMAx_S7CR[DMA1];
+    CHECK(READ_FIELD(cr, DMAx_S0CR_DIR) == MEM_TO_PERIPH);
+    CHECK(READ_FIELD(cr, DMAx_S0CR_MSIZE) == DMA_DATA_SIZE_WORD);     // source is memory
+    CHECK(READ_FIELD(cr, DMAx_S0CR_PSIZE) == DMA_DATA_SIZE_HALFWORD); // destination is the peripheral
+    CHECK(READ_FIELD(cr, DMAx_S0CR_PL) == DMA_PRIORITY_HIGH);
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_MINC) && IS_FIELD_CLR(cr, DMAx_S0CR_PINC));
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_TCIE) && IS_FIELD_SET(cr, DMAx_S0CR_TEIE));
+    CHECK(IS_FIELD_CLR(cr, DMAx_S0CR_EN));
+    CHECK(IS_FIELD_SET(DMAx_SxFCR[DMA1][DMA_STREAM_7], DMAx_SxFCR_DMDIS));
+    CHECK(READ_FIELD(DMAx_SxFCR[DMA1][DMA_STREAM_7], DMAx_SxFCR_FTH) == 0);
+
+    config.fifo_threshold = DMA_FIFO_THRESHOLD_FULL;
+    config.direction = PERIPH_TO_MEM;
+    CHECK(dma_configure_stream(&config));
+    CHECK(READ_FIELD(cr, DMAx_S0CR_DIR) == PERIPH_TO_MEM);
+    CHECK(READ_FIELD(cr, DMAx_S0CR_PSIZE) == DMA_DATA_SIZE_WORD);
+    CHECK(READ_FIELD(cr, DMAx_S0CR_MSIZE) == DMA_DATA_SIZE_HALFWORD);
+    CHECK(READ_FIELD(DMAx_SxFCR[DMA1][DMA_STREAM_7], DMAx_SxFCR_FTH) == 3);
+}
+
+static void test_configure_rejects_invalid(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_0);
+    config.request_id = 0;
+    CHECK(!dma_configure_stream(&config));
+    config.request_id = 256;
+    CHECK(!dma_configure_stream(&config));
+
+    config = tx_config(DMA1, DMA_STREAM_0);
+    config.dest_data_size = DMA_DATA_SIZE_WORD; // widths differ without the FIFO
+    CHECK(!dma_configure_stream(&config));
+
+    config = tx_config(DMA_INSTANCE_COUNT, DMA_STREAM_0);
+    CHECK(!dma_configure_stream(&config));
+    config = tx_config(DMA1, DMA_STREAM_COUNT);
+    CHECK(!dma_configure_stream(&config));
+    config = tx_config(DMA1, DMA_STREAM_0);
+    config.fifo_threshold = DMA_FIFO_THRESHOLD_COUNT;
+    CHECK(!dma_configure_stream(&config));
+    CHECK(!dma_configure_stream(NULL));
+
+    CHECK(*DMAMUX1_CxCR[0] == 0);
+}
+
+static void test_start_programs_stream(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_2);
+    config.src_data_size = DMA_DATA_SIZE_HALFWORD;
+    config.dest_data_size = DMA_DATA_SIZE_HALFWORD;
+    CHECK(dma_configure_stream(&config));
+
+    dma_transfer_t transfer = {
+        .instance = DMA1, .stream = DMA_STREAM_2, .src = sram(0x100), .dest = sram(0x10), .size = 64,
+    };
+    set_isr(DMA1, DMA_STREAM_2, 0);
+    CHECK(dma_start_transfer(&transfer));
+    CHECK(*DMAx_SxPAR[DMA1][DMA_STREAM_2] == MMIO_FAKE_SRAM_BASE + 0x10);
+    CHECK(*DMAx_SxM0AR[DMA1][DMA_STREAM_2] == MMIO_FAKE_SRAM_BASE + 0x100);
+    CHECK(READ_FIELD(DMAx_SxNDTR[DMA1][DMA_STREAM_2], DMAx_SxNDTR_NDT) == 32);
+    CHECK(IS_FIELD_SET(DMAx_S2CR[DMA1], DMAx_S0CR_EN));
+
+    // busy until the stream finishes
+    CHECK(!dma_start_transfer(&transfer));
+    CLR_FIELD(DMAx_S2CR[DMA1], DMAx_S0CR_EN);
+
+    transfer.size = 63;
+    CHECK(!dma_start_transfer(&transfer));
+    transfer.size = 2 * 0x10000;
+    CHECK(!dma_start_transfer(&transfer));
+    transfer.size = 64;
+    transfer.src = sram(0x101);
+    CHECK(!dma_start_transfer(&transfer));
+
+    dma_transfer_t unconfigured = transfer;
+    unconfigured.stream = DMA_STREAM_6;
+    unconfigured.src = sram(0x100);
+    CHECK(!dma_start_transfer(&unconfigured));
+}
+
+static void test_transfer_to_peripheral(void) {
+    reset();
+    dma_config_t config = tx_config(DMA2, DMA_STREAM_1);
+    CHECK(dma_configure_stream(&config));
+
+    static const char msg[] = "titan";
+    memcpy(sram(0x200), msg, sizeof(msg));
+    int context;
+    dma_transfer_t transfer = {
+        .instance = DMA2, .stream = DMA_STREAM_1, .src = sram(0x200), .dest = sram(0x20),
+        .size = sizeof(msg) - 1, .context = &context,
+    };
+    CHECK(dma_start_transfer(&transfer));
+    fake_finish(DMA2, DMA_STREAM_1, false);
+
+    CHECK(*sram(0x20) == 'n'); // data register holds the last byte
+    CHECK(callback_count == 1 && callback_success && callback_context == &context);
+    CHECK(ifcr_value(DMA2, DMA_STREAM_1) == DMAx_LIFCR_CTCIFx[1].msk);
+}
+
+static void test_transfer_from_peripheral(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_5);
+    config.direction = PERIPH_TO_MEM;
+    config.src_data_size = DMA_DATA_SIZE_WORD;
+    config.dest_data_size = DMA_DATA_SIZE_WORD;
+    CHECK(dma_configure_stream(&config));
+
+    MMIO_FAKE_REG(MMIO_FAKE_SRAM_BASE + 0x30) = 0xC0FFEE00U;
+    dma_transfer_t transfer = {
+        .instance = DMA1, .stream = DMA_STREAM_5, .src = sram(0x30), .dest = sram(0x300), .size = 16,
+    };
+    CHECK(dma_start_transfer(&transfer));
+    CHECK(*DMAx_SxPAR[DMA1][DMA_STREAM_5] == MMIO_FAKE_SRAM_BASE + 0x30);
+    fake_finish(DMA1, DMA_STREAM_5, false);
+
+    uint32_t words[4];
+    memcpy(words, sram(0x300), sizeof(words));
+    CHECK(words[0] == 0xC0FFEE00U && words[3] == 0xC0FFEE00U);
+    CHECK(callback_count == 1 && callback_success);
+    // stream 5 uses the high registers
+    CHECK(ifcr_value(DMA1, DMA_STREAM_5) == DMAx_HIFCR_CTCIFx[5].msk);
+    CHECK(*DMAx_LIFCR[DMA1] == 0);
+
+    // stream is free for the next transfer
+    transfer.disable_mem_inc = true;
+    CHECK(dma_start_transfer(&transfer));
+    CHECK(IS_FIELD_CLR(DMAx_S5CR[DMA1], DMAx_S0CR_MINC));
+}
+
+static void test_transfer_error(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_0);
+    CHECK(dma_configure_stream(&config));
+    dma_transfer_t transfer = {
+        .instance = DMA1, .stream = DMA_STREAM_0, .src = sram(0x400), .dest = sram(0x40), .size = 8,
+    };
+    CHECK(dma_start_transfer(&transfer));
+    fake_finish(DMA1, DMA_STREAM_0, true);
+    CHECK(callback_count == 1 && !callback_success);
+    CHECK(ifcr_value(DMA1, DMA_STREAM_0) == DMAx_LIFCR_CTEIFx[0].msk);
+
+    // an IRQ with only flags the driver does not report (FIFO error) clears them without a callback
+    set_isr(DMA1, DMA_STREAM_0, DMAx_LISR_FEIFx[0].msk);
+    dma_str0_irq_handler();
+    CHECK(callback_count == 1);
+    CHECK(ifcr_value(DMA1, DMA_STREAM_0) == DMAx_LIFCR_CFEIFx[0].msk);
+}
+
+static void test_irq_ignores_other_streams(void) {
+    reset();
+    dma_config_t config = tx_config(DMA2, DMA_STREAM_2);
+    CHECK(dma_configure_stream(&config));
+    config.stream = DMA_STREAM_3;
+    CHECK(dma_configure_stream(&config));
+
+    // stream 3 finished, stream 2's IRQ must leave its flag alone
+    set_isr(DMA2, DMA_STREAM_3, DMAx_LISR_TCIFx[3].msk);
+    *DMAx_LIFCR[DMA2] = 0;
+    dma2_str2_irq_handler();
+    CHECK(callback_count == 0);
+    CHECK(*DMAx_LIFCR[DMA2] == 0);
+    dma2_str3_irq_handler();
+    CHECK(callback_count == 1);
+    CHECK(*DMAx_LIFCR[DMA2] == DMAx_LIFCR_CTCIFx[3].msk);
+}
+
+static bool same_stream(dma_stream_id_t id, dma_instance_t instance, dma_stream_t stream) {
+    return id.instance == instance && id.stream == stream;
+}
+
+static void test_claim_placement(void) {
+    reset();
+    int owner;
+    dma_stream_id_t a, b, c, d, e;
+    CHECK(dma_claim_stream(DMA_PRIORITY_VERY_HIGH, &owner, &a) == TI_ERRC_NONE);
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &b) == TI_ERRC_NONE);
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &c) == TI_ERRC_NONE);
+    CHECK(same_stream(a, DMA1, DMA_STREAM_0));
+    CHECK(same_stream(b, DMA2, DMA_STREAM_0));
+    CHECK(same_stream(c, DMA1, DMA_STREAM_1));
+
+    // low classes fill from the top, where the arbiter ranks them last
+    CHECK(dma_claim_stream(DMA_PRIORITY_LOW, &owner, &d) == TI_ERRC_NONE);
+    CHECK(dma_claim_stream(DMA_PRIORITY_MEDIUM, &owner, &e) == TI_ERRC_NONE);
+    CHECK(same_stream(d, DMA2, DMA_STREAM_7));
+    CHECK(same_stream(e, DMA1, DMA_STREAM_7));
+
+    // only the owner releases, once
+    int other;
+    CHECK(dma_release_stream(b, &other) == TI_ERRC_INVALID_ARG);
+    CHECK(dma_release_stream(b, &owner) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(b, &owner) == TI_ERRC_INVALID_ARG);
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &other, &b) == TI_ERRC_NONE);
+    CHECK(same_stream(b, DMA2, DMA_STREAM_0));
+
+    CHECK(dma_release_stream(a, &owner) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(b, &other) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(c, &owner) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(d, &owner) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(e, &owner) == TI_ERRC_NONE);
+    CHECK(dma_claim_stream(DMA_PRIORITY_COUNT, &owner, &a) == TI_ERRC_INVALID_ARG);
+}
+
+static void test_claim_exhaustion(void) {
+    reset();
+    int owner;
+    dma_stream_id_t ids[2 * DMA_STREAM_COUNT];
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT; i++) {
+        CHECK(dma_claim_stream(DMA_PRIORITY_LOW, &owner, &ids[i]) == TI_ERRC_NONE);
+    }
+    dma_stream_id_t extra;
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &extra) == TI_ERRC_DMA_NO_AVAIL_STREAM);
+
+    // a claimed stream is configured by its owner and released like any other, and its IRQ is masked again
+    dma_config_t config = tx_config(ids[5].instance, ids[5].stream);
+    config.owner = &owner;
+    CHECK(dma_configure_stream(&config));
+    CHECK(dma_release_stream(ids[5], &owner) == TI_ERRC_NONE);
+    const int32_t irq = DMAx_STRx_IRQ_NUM[ids[5].instance][ids[5].stream];
+    CHECK((MMIO_FAKE_REG(0xE000E180U + 4U * (uint32_t)(irq / 32)) >> (irq % 32)) & 1U);
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &extra) == TI_ERRC_NONE);
+    CHECK(same_stream(extra, ids[5].instance, ids[5].stream));
+    ids[5] = extra;
+
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT; i++) {
+        CHECK(dma_release_stream(ids[i], &owner) == TI_ERRC_NONE);
+    }
+}
+
+static void test_configure_takes_fixed_stream(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_0);
+    CHECK(dma_configure_stream(&config));
+    int owner;
+    dma_stream_id_t id;
+    CHECK(dma_claim_stream(DMA_PRIORITY_VERY_HIGH, &owner, &id) == TI_ERRC_NONE);
+    CHECK(same_stream(id, DMA2, DMA_STREAM_0));
+    CHECK(dma_release_stream((dma_stream_id_t){DMA1, DMA_STREAM_0}, &owner) == TI_ERRC_INVALID_ARG);
+
+    // configuring a claimed stream leaves it with its owner
+    config = tx_config(DMA2, DMA_STREAM_0);
+    config.owner = &owner;
+    CHECK(dma_configure_stream(&config));
+    dma_transfer_t transfer = {
+        .instance = DMA2, .stream = DMA_STREAM_0, .src = sram(0x100), .dest = sram(0x10), .size = 4,
+    };
+    CHECK(dma_start_transfer(&transfer));
+
+    // anyone else is refused and the owner's transfer keeps running
+    int other;
+    config.owner = &other;
+    config.priority = DMA_PRIORITY_LOW;
+    CHECK(!dma_configure_stream(&config));
+    config.owner = NULL;
+    CHECK(!dma_configure_stream(&config));
+    CHECK(IS_FIELD_SET(DMAx_S0CR[DMA2], DMAx_S0CR_EN));
+    CHECK(READ_FIELD(DMAx_S0CR[DMA2], DMAx_S0CR_PL) == DMA_PRIORITY_HIGH);
+    CHECK(dma_release_stream(id, &owner) == TI_ERRC_NONE);
+}
+
+static void test_lease_shares_streams(void) {
+    reset();
+    int owner;
+    dma_stream_id_t ids[2 * DMA_STREAM_COUNT - 1];
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT - 1; i++) {
+        CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &ids[i]) == TI_ERRC_NONE);
+    }
+    // DMA2 stream 7 is the one left
+
+    dma_lease_t leases[3];
+    for (int i = 0; i < 3; i++) {
+        leases[i] = (dma_lease_t){
+            .config = tx_config(DMA1, DMA_STREAM_0), // instance and stream are ignored
+            .transfer = {.src = sram(0x500 + 0x10 * i), .dest = sram(0x50), .size = 4, .context = &leases[i]},
+        };
+    }
+    leases[1].config.priority = DMA_PRIORITY_LOW;
+    leases[2].config.priority = DMA_PRIORITY_VERY_HIGH;
+
+    CHECK(dma_lease_transfer(&leases[0]) == TI_ERRC_NONE);
+    CHECK(leases[0].transfer.instance == DMA2 && leases[0].transfer.stream == DMA_STREAM_7);
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_7] == MMIO_FAKE_SRAM_BASE + 0x500);
+
+    // no stream left: both wait, the higher priority one goes first
+    CHECK(dma_lease_transfer(&leases[1]) == TI_ERRC_NONE);
+    CHECK(dma_lease_transfer(&leases[2]) == TI_ERRC_NONE);
+
+    fake_finish(DMA2, DMA_STREAM_7, false);
+    CHECK(callback_count == 1 && callback_log[0] == &leases[0]);
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_7] == MMIO_FAKE_SRAM_BASE + 0x520);
+    CHECK(IS_FIELD_SET(DMAx_S7CR[DMA2], DMAx_S0CR_EN));
+    CHECK(READ_FIELD(DMAx_S7CR[DMA2], DMAx_S0CR_PL) == DMA_PRIORITY_VERY_HIGH);
+
+    fake_finish(DMA2, DMA_STREAM_7, false);
+    CHECK(callback_count == 2 && callback_log[1] == &leases[2]);
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_7] == MMIO_FAKE_SRAM_BASE + 0x510);
+
+    fake_finish(DMA2, DMA_STREAM_7, false);
+    CHECK(callback_count == 3 && callback_log[2] == &leases[1] && callback_success);
+
+    // the last lease gave the stream back
+    dma_stream_id_t id;
+    CHECK(dma_claim_stream(DMA_PRIORITY_LOW, &owner, &id) == TI_ERRC_NONE);
+    CHECK(same_stream(id, DMA2, DMA_STREAM_7));
+    CHECK(dma_release_stream(id, &owner) == TI_ERRC_NONE);
+
+    // a lease that cannot start is refused and leaves no stream behind
+    dma_lease_t bad = leases[0];
+    bad.transfer.size = 0;
+    CHECK(dma_lease_transfer(&bad) == TI_ERRC_INVALID_ARG);
+    bad = leases[0];
+    bad.config.request_id = 0;
+    CHECK(dma_lease_transfer(&bad) == TI_ERRC_INVALID_ARG);
+    CHECK(dma_claim_stream(DMA_PRIORITY_LOW, &owner, &id) == TI_ERRC_NONE);
+    CHECK(same_stream(id, DMA2, DMA_STREAM_7));
+    CHECK(dma_release_stream(id, &owner) == TI_ERRC_NONE);
+
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT - 1; i++) {
+        CHECK(dma_release_stream(ids[i], &owner) == TI_ERRC_NONE);
+    }
+}
+
+static void test_release_starts_waiting_lease(void) {
+    reset();
+    int owner;
+    dma_stream_id_t ids[2 * DMA_STREAM_COUNT];
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT; i++) {
+        CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &ids[i]) == TI_ERRC_NONE);
+    }
+
+    // every stream is claimed and no lease runs: the lease waits for a release
+    dma_lease_t lease = {
+        .config = tx_config(DMA1, DMA_STREAM_0),
+        .transfer = {.src = sram(0x500), .dest = sram(0x50), .size = 4, .context = &lease},
+    };
+    CHECK(dma_lease_transfer(&lease) == TI_ERRC_NONE);
+    CHECK(callback_count == 0);
+
+    CHECK(dma_release_stream(ids[3], &owner) == TI_ERRC_NONE);
+    CHECK(lease.transfer.instance == ids[3].instance && lease.transfer.stream == ids[3].stream);
+    CHECK(*DMAx_SxM0AR[ids[3].instance][ids[3].stream] == MMIO_FAKE_SRAM_BASE + 0x500);
+    CHECK(IS_FIELD_SET(stream_cr[ids[3].stream][ids[3].instance], DMAx_S0CR_EN));
+
+    // the stream stays with the lease until it ends, then goes back to the pool
+    dma_stream_id_t id;
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &id) == TI_ERRC_DMA_NO_AVAIL_STREAM);
+    fake_finish(ids[3].instance, ids[3].stream, false);
+    CHECK(callback_count == 1 && callback_context == &lease && callback_success);
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &id) == TI_ERRC_NONE);
+    CHECK(same_stream(id, ids[3].instance, ids[3].stream));
+    ids[3] = id;
+
+    // a waiting lease that cannot start reports it, and the stream goes back to the pool stopped
+    dma_lease_t bad = lease;
+    bad.transfer.size = 0;
+    bad.transfer.context = &bad;
+    CHECK(dma_lease_transfer(&bad) == TI_ERRC_NONE);
+    CHECK(dma_release_stream(ids[7], &owner) == TI_ERRC_NONE);
+    CHECK(callback_count == 2 && callback_context == &bad && !callback_success);
+    CHECK(IS_FIELD_CLR(stream_cr[ids[7].stream][ids[7].instance], DMAx_S0CR_EN));
+    const int32_t irq = DMAx_STRx_IRQ_NUM[ids[7].instance][ids[7].stream];
+    CHECK((MMIO_FAKE_REG(0xE000E180U + 4U * (uint32_t)(irq / 32)) >> (irq % 32)) & 1U);
+    bad.transfer.instance = ids[7].instance;
+    bad.transfer.stream = ids[7].stream;
+    CHECK(!dma_start_transfer(&bad.transfer)); // left unconfigured
+    CHECK(dma_claim_stream(DMA_PRIORITY_HIGH, &owner, &id) == TI_ERRC_NONE);
+    CHECK(same_stream(id, ids[7].instance, ids[7].stream));
+    ids[7] = id;
+
+    for (int i = 0; i < 2 * DMA_STREAM_COUNT; i++) {
+        CHECK(dma_release_stream(ids[i], &owner) == TI_ERRC_NONE);
+    }
+}
+
+// continuous callback record
+static int event_count;
+static struct { dma_event_t event; void* done; size_t size; } events[8];
+
+static void record_event(dma_event_t event, void* done, size_t size, void* context) {
+    (void)context;
+    if (event_count < 8) {
+        events[event_count].event = event;
+        events[event_count].done = done;
+        events[event_count].size = size;
+    }
+    event_count++;
+}
+
+// Raises flags of a running stream and runs its IRQ, as the hardware does mid-stream (EN stays set).
+// The flags replace the ISR, standing in for the driver's clear of the previous ones.
+static void fake_flags(dma_instance_t instance, dma_stream_t stream, uint32_t flags) {
+    set_isr(instance, stream, flags);
+    stream_irq[instance][stream]();
+}
+
+static void test_circular_half_and_complete(void) {
+    reset();
+    event_count = 0;
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_1);
+    config.direction = PERIPH_TO_MEM;
+    CHECK(dma_configure_stream(&config));
+
+    dma_continuous_t rx = {
+        .instance = DMA1, .stream = DMA_STREAM_1, .periph = sram(0x60), .buffers = {sram(0x600)},
+        .size = 32, .half_transfer = true, .callback = record_event,
+    };
+    CHECK(dma_start_continuous(&rx));
+    rw_reg32_t cr = DMAx_S1CR[DMA1];
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_CIRC) && IS_FIELD_CLR(cr, DMAx_S0CR_DBM));
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_HTIE) && IS_FIELD_SET(cr, DMAx_S0CR_EN));
+    CHECK(*DMAx_SxPAR[DMA1][DMA_STREAM_1] == MMIO_FAKE_SRAM_BASE + 0x60);
+    CHECK(READ_FIELD(DMAx_SxNDTR[DMA1][DMA_STREAM_1], DMAx_SxNDTR_NDT) == 32);
+
+    fake_flags(DMA1, DMA_STREAM_1, DMAx_LISR_HTIFx[1].msk);
+    CHECK(event_count == 1 && events[0].event == DMA_EVENT_HALF_TRANSFER);
+    CHECK(events[0].done == sram(0x600) && events[0].size == 16);
+    fake_flags(DMA1, DMA_STREAM_1, DMAx_LISR_TCIFx[1].msk);
+    CHECK(event_count == 2 && events[1].event == DMA_EVENT_TRANSFER_COMPLETE);
+    CHECK(events[1].done == sram(0x610) && events[1].size == 16);
+    CHECK(callback_count == 0); // the one-shot callback is not used
+
+    // late IRQ with both halves pending reports them in order
+    fake_flags(DMA1, DMA_STREAM_1, DMAx_LISR_HTIFx[1].msk | DMAx_LISR_TCIFx[1].msk);
+    CHECK(event_count == 4 && events[2].event == DMA_EVENT_HALF_TRANSFER);
+    CHECK(events[3].event == DMA_EVENT_TRANSFER_COMPLETE);
+
+    // busy, and stopping is silent
+    CHECK(!dma_start_continuous(&rx));
+    CHECK(!dma_swap_buffer(DMA1, DMA_STREAM_1, sram(0x700)));
+    CHECK(dma_stop_transfer(DMA1, DMA_STREAM_1));
+    CHECK(IS_FIELD_CLR(cr, DMAx_S0CR_EN));
+    set_isr(DMA1, DMA_STREAM_1, DMAx_LISR_TCIFx[1].msk);
+    dma_str1_irq_handler();
+    CHECK(event_count == 4 && callback_count == 1); // back to the one-shot callback
+
+    // a one-shot transfer leaves circular mode
+    dma_transfer_t transfer = {
+        .instance = DMA1, .stream = DMA_STREAM_1, .src = sram(0x60), .dest = sram(0x600), .size = 4,
+    };
+    CHECK(dma_start_transfer(&transfer));
+    CHECK(IS_FIELD_CLR(cr, DMAx_S0CR_CIRC) && IS_FIELD_CLR(cr, DMAx_S0CR_HTIE));
+}
+
+static void test_double_buffer_swap(void) {
+    reset();
+    event_count = 0;
+    dma_config_t config = tx_config(DMA2, DMA_STREAM_4);
+    config.direction = PERIPH_TO_MEM;
+    config.src_data_size = DMA_DATA_SIZE_HALFWORD;
+    config.dest_data_size = DMA_DATA_SIZE_HALFWORD;
+    CHECK(dma_configure_stream(&config));
+
+    dma_continuous_t rx = {
+        .instance = DMA2, .stream = DMA_STREAM_4, .periph = sram(0x70),
+        .buffers = {sram(0x800), sram(0x840)}, .size = 64, .callback = record_event,
+    };
+    CHECK(dma_start_continuous(&rx));
+    rw_reg32_t cr = DMAx_S4CR[DMA2];
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_DBM) && IS_FIELD_CLR(cr, DMAx_S0CR_HTIE));
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_4] == MMIO_FAKE_SRAM_BASE + 0x800);
+    CHECK(*DMAx_SxM1AR[DMA2][DMA_STREAM_4] == MMIO_FAKE_SRAM_BASE + 0x840);
+    CHECK(READ_FIELD(DMAx_SxNDTR[DMA2][DMA_STREAM_4], DMAx_SxNDTR_NDT) == 32);
+
+    // buffer 0 done, the hardware moved on to buffer 1
+    SET_FIELD(cr, DMAx_S0CR_CT);
+    fake_flags(DMA2, DMA_STREAM_4, DMAx_HISR_TCIFx[4].msk);
+    CHECK(event_count == 1 && events[0].done == sram(0x800) && events[0].size == 64);
+    CHECK(dma_swap_buffer(DMA2, DMA_STREAM_4, sram(0x880)));
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_4] == MMIO_FAKE_SRAM_BASE + 0x880);
+    CHECK(*DMAx_SxM1AR[DMA2][DMA_STREAM_4] == MMIO_FAKE_SRAM_BASE + 0x840);
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_EN));
+
+    // buffer 1 done, back on (the new) buffer 0
+    CLR_FIELD(cr, DMAx_S0CR_CT);
+    fake_flags(DMA2, DMA_STREAM_4, DMAx_HISR_TCIFx[4].msk);
+    CHECK(event_count == 2 && events[1].done == sram(0x840));
+    CHECK(dma_swap_buffer(DMA2, DMA_STREAM_4, sram(0x8C0)));
+    CHECK(*DMAx_SxM1AR[DMA2][DMA_STREAM_4] == MMIO_FAKE_SRAM_BASE + 0x8C0);
+    CHECK(!dma_swap_buffer(DMA2, DMA_STREAM_4, sram(0x8C1))); // misaligned
+
+    // an error ends the stream
+    fake_flags(DMA2, DMA_STREAM_4, DMAx_HISR_TEIFx[4].msk);
+    CHECK(event_count == 3 && events[2].event == DMA_EVENT_ERROR && events[2].done == NULL);
+    CHECK(!dma_swap_buffer(DMA2, DMA_STREAM_4, sram(0x880)));
+}
+
+static void test_double_buffer_half_and_complete(void) {
+    reset();
+    event_count = 0;
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_2);
+    config.direction = PERIPH_TO_MEM;
+    CHECK(dma_configure_stream(&config));
+
+    dma_continuous_t rx = {
+        .instance = DMA1, .stream = DMA_STREAM_2, .periph = sram(0x90),
+        .buffers = {sram(0xA00), sram(0xA40)}, .size = 32, .half_transfer = true, .callback = record_event,
+    };
+    CHECK(dma_start_continuous(&rx));
+    rw_reg32_t cr = DMAx_S2CR[DMA1];
+    CHECK(IS_FIELD_SET(cr, DMAx_S0CR_DBM) && IS_FIELD_SET(cr, DMAx_S0CR_HTIE));
+
+    // first half of buffer 0, still on buffer 0
+    fake_flags(DMA1, DMA_STREAM_2, DMAx_LISR_HTIFx[2].msk);
+    CHECK(event_count == 1 && events[0].event == DMA_EVENT_HALF_TRANSFER);
+    CHECK(events[0].done == sram(0xA00) && events[0].size == 16);
+
+    // late IRQ: both halves of buffer 0 pending, the hardware already moved on to buffer 1
+    SET_FIELD(cr, DMAx_S0CR_CT);
+    fake_flags(DMA1, DMA_STREAM_2, DMAx_LISR_HTIFx[2].msk | DMAx_LISR_TCIFx[2].msk);
+    CHECK(event_count == 3 && events[1].event == DMA_EVENT_HALF_TRANSFER);
+    CHECK(events[1].done == sram(0xA00) && events[1].size == 16);
+    CHECK(events[2].event == DMA_EVENT_TRANSFER_COMPLETE);
+    CHECK(events[2].done == sram(0xA10) && events[2].size == 16);
+
+    // same for buffer 1, back on buffer 0
+    CLR_FIELD(cr, DMAx_S0CR_CT);
+    fake_flags(DMA1, DMA_STREAM_2, DMAx_LISR_HTIFx[2].msk | DMAx_LISR_TCIFx[2].msk);
+    CHECK(event_count == 5 && events[3].done == sram(0xA40) && events[4].done == sram(0xA50));
+    CHECK(dma_stop_transfer(DMA1, DMA_STREAM_2));
+}
+
+static void test_continuous_rejects_invalid(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_6);
+    config.direction = PERIPH_TO_MEM;
+    dma_continuous_t rx = {
+        .instance = DMA1, .stream = DMA_STREAM_6, .periph = sram(0x80), .buffers = {sram(0x900)},
+        .size = 7, .half_transfer = true, .callback = record_event,
+    };
+    CHECK(!dma_start_continuous(&rx)); // not configured
+    CHECK(dma_configure_stream(&config));
+    CHECK(!dma_start_continuous(&rx)); // odd count with half transfer events
+    rx.half_transfer = false;
+    CHECK(dma_start_continuous(&rx));
+    CHECK(dma_stop_transfer(DMA1, DMA_STREAM_6));
+    rx.callback = NULL;
+    CHECK(!dma_start_continuous(&rx));
+    rx.callback = record_event;
+    rx.size = 0;
+    CHECK(!dma_start_continuous(&rx));
+}
+
+static void test_sg_gathers_buffers(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_2);
+    CHECK(dma_configure_stream(&config));
+
+    // Header, payload and CRC of one frame, nowhere near each other
+    const dma_iovec_t iov[] = {{sram(0x100), 4}, {sram(0x800), 9}, {sram(0x400), 2}};
+    int context;
+    dma_sg_transfer_t sg = {
+        .instance = DMA1, .stream = DMA_STREAM_2, .periph = sram(0x20),
+        .iov = iov, .iov_count = 3, .context = &context,
+    };
+    CHECK(dma_start_sg(&sg));
+    CHECK(*DMAx_SxPAR[DMA1][DMA_STREAM_2] == (uint32_t)(uintptr_t)sram(0x20));
+
+    // Each buffer is re-armed from the IRQ of the one before, the callback only runs at the end
+    for (int i = 0; i < 3; i++) {
+        CHECK(IS_FIELD_SET(stream_cr[DMA_STREAM_2][DMA1], DMAx_S0CR_EN));
+        CHECK(*DMAx_SxM0AR[DMA1][DMA_STREAM_2] == (uint32_t)(uintptr_t)iov[i].base);
+        CHECK(READ_FIELD(DMAx_SxNDTR[DMA1][DMA_STREAM_2], DMAx_SxNDTR_NDT) == iov[i].size);
+        CHECK(callback_count == 0);
+        fake_finish(DMA1, DMA_STREAM_2, false);
+    }
+    CHECK(callback_count == 1 && callback_success && callback_context == &context);
+    CHECK(!IS_FIELD_SET(stream_cr[DMA_STREAM_2][DMA1], DMAx_S0CR_EN));
+
+    // A plain transfer afterwards does not continue the list
+    dma_transfer_t transfer = {
+        .instance = DMA1, .stream = DMA_STREAM_2, .src = sram(0x100), .dest = sram(0x20), .size = 4,
+    };
+    CHECK(dma_start_transfer(&transfer));
+    fake_finish(DMA1, DMA_STREAM_2, false);
+    CHECK(callback_count == 2);
+}
+
+static void test_sg_scatters_and_stops_on_error(void) {
+    reset();
+    dma_config_t config = tx_config(DMA2, DMA_STREAM_5);
+    config.direction = PERIPH_TO_MEM;
+    CHECK(dma_configure_stream(&config));
+
+    memset(sram(0x1000), 0, 0x100);
+    *sram(0x40) = 0x7E;
+    const dma_iovec_t iov[] = {{sram(0x1000), 3}, {sram(0x1010), 5}, {sram(0x1020), 4}};
+    dma_sg_transfer_t sg = {
+        .instance = DMA2, .stream = DMA_STREAM_5, .periph = sram(0x40), .iov = iov, .iov_count = 3,
+    };
+    CHECK(dma_start_sg(&sg));
+    fake_finish(DMA2, DMA_STREAM_5, false);
+    CHECK(sram(0x1000)[2] == 0x7E && sram(0x1000)[3] == 0);
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_5] == (uint32_t)(uintptr_t)sram(0x1010));
+
+    // An error ends the list, the last buffer is never started
+    fake_finish(DMA2, DMA_STREAM_5, true);
+    CHECK(callback_count == 1 && !callback_success);
+    CHECK(*DMAx_SxM0AR[DMA2][DMA_STREAM_5] == (uint32_t)(uintptr_t)sram(0x1010));
+    CHECK(!IS_FIELD_SET(stream_cr[DMA_STREAM_5][DMA2], DMAx_S0CR_EN));
+}
+
+static void test_sg_rejects_invalid(void) {
+    reset();
+    dma_config_t config = tx_config(DMA1, DMA_STREAM_4);
+    config.src_data_size = DMA_DATA_SIZE_HALFWORD;
+    config.dest_data_size = DMA_DATA_SIZE_HALFWORD;
+    dma_iovec_t iov[] = {{sram(0x100), 4}, {sram(0x200), 6}};
+    dma_sg_transfer_t sg = {
+        .instance = DMA1, .stream = DMA_STREAM_4, .periph = sram(0x20), .iov = iov, .iov_count = 2,
+    };
+    CHECK(!dma_start_sg(&sg)); // not configured
+    CHECK(dma_configure_stream(&config));
+    iov[1].size = 5; // not a whole number of halfwords
+    CHECK(!dma_start_sg(&sg));
+    iov[1].size = 0;
+    CHECK(!dma_start_sg(&sg));
+    iov[1].size = 6;
+    iov[1].base = NULL;
+    CHECK(!dma_start_sg(&sg));
+    iov[1].base = sram(0x201); // misaligned
+    CHECK(!dma_start_sg(&sg));
+    iov[1].base = sram(0x200);
+    sg.iov_count = 0;
+    CHECK(!dma_start_sg(&sg));
+    sg.iov_count = 2;
+    CHECK(!IS_FIELD_SET(stream_cr[DMA_STREAM_4][DMA1], DMAx_S0CR_EN)); // nothing was started
+    CHECK(dma_start_sg(&sg));
+    CHECK(!dma_start_sg(&sg)); // busy
+    CHECK(dma_stop_transfer(DMA1, DMA_STREAM_4));
+}
+
+typedef struct { const char* name; void (*fn)(void); } TestCase;
+#define TEST_CASE(fn) { #fn, fn }
+
+int main(void) {
+    if (!mmio_fake_init()) return 1;
+
+    const TestCase tests[] = {
+        TEST_CASE(test_init_enables_clocks),
+        TEST_CASE(test_configure_routes_request),
+        TEST_CASE(test_configure_stream_registers),
+        TEST_CASE(test_configure_rejects_invalid),
+        TEST_CASE(test_start_programs_stream),
+        TEST_CASE(test_transfer_to_peripheral),
+        TEST_CASE(test_transfer_from_peripheral),
+        TEST_CASE(test_transfer_error),
+        TEST_CASE(test_irq_ignores_other_streams),
+        TEST_CASE(test_claim_placement),
+        TEST_CASE(test_claim_exhaustion),
+        TEST_CASE(test_configure_takes_fixed_stream),
+        TEST_CASE(test_lease_shares_streams),
+        TEST_CASE(test_release_starts_waiting_lease),
+        TEST_CASE(test_circular_half_and_complete),
+        TEST_CASE(test_double_buffer_swap),
+        TEST_CASE(test_double_buffer_half_and_complete),
+        TEST_CASE(test_continuous_rejects_invalid),
+        TEST_CASE(test_sg_gathers_buffers),
+        TEST_CASE(test_sg_scatters_and_stops_on_error),
+        TEST_CASE(test_sg_rejects_invalid),
+    };
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        const int failures = total_failures;
+        tests[i].fn();
+        printf("%s %s\n", tests[i].name, total_failures == failures ? "[OK]" : "[FAIL]");
+    }
+
+    printf("\nSummary: %d/%d assertions passed, %d failed.\n",
+           total_asserts - total_failures, total_asserts, total_failures);
+    return total_failures == 0 ? 0 : 1;
+}
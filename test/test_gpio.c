@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mmio_fake.h"
+#include "peripheral/gpio.h"
+#include "internal/mmio/gpiox.h"
+#include "internal/mmio/rcc.h"
+
+// Tests of the GPIO driver's shadowed configuration registers against the register fake (see
+// mmio_fake.h). Pins 37 and 38 are PA0 and PA1.
+
+static int total_asserts = 0;
+static int total_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+static void check(int condition, const char* msg, int line) {
+    total_asserts++;
+    if (!condition) {
+        total_failures++;
+        printf("    - line %d: %s [FAIL]\n", line, msg);
+    }
+}
+
+#define PA0 37
+#define PA1 38
+#define PORT_A 0
+
+// Reset value of GPIOA_MODER
+#define MODER_A_RESET 0xABFFFFFFU
+
+// Zeroes the fake, and reloads the driver's shadows of port A with its reset values
+static void reset(void) {
+    mmio_fake_reset();
+    *GPIOx_MODER[PORT_A] = MODER_A_RESET;
+    CHECK(tal_enable_clock(PA0));
+}
+
+static void test_first_write_loads_register(void) {
+    reset();
+    CHECK(IS_FIELD_SET(RCC_AHB4ENR, RCC_AHB4ENR_GPIOAEN));
+    tal_set_mode(PA0, 1);
+    CHECK(*GPIOx_MODER[PORT_A] == ((MODER_A_RESET & ~0x3U) | 0x1U));
+}
+
+static void test_later_write_skips_read(void) {
+    reset();
+    tal_set_mode(PA0, 1);
+    // A write the driver does not know about is not read back: the next one comes from the shadow
+    *GPIOx_MODER[PORT_A] = 0;
+    tal_set_mode(PA1, 2);
+    CHECK(*GPIOx_MODER[PORT_A] == ((MODER_A_RESET & ~0xFU) | 0x9U));
+}
+
+static void test_enable_clock_reloads(void) {
+    reset();
+    tal_set_mode(PA0, 1);
+    tal_set_speed(PA0, 3);
+    // Registers written while the clock was off read back as 0, enabling it reloads every shadow
+    *GPIOx_MODER[PORT_A] = 0x0000000FU;
+    *GPIOx_OSPEEDR[PORT_A] = 0x000000F0U;
+    CHECK(tal_enable_clock(PA0));
+    tal_set_mode(PA0, 0);
+    tal_set_speed(PA0, 1);
+    CHECK(*GPIOx_MODER[PORT_A] == 0x0000000CU);
+    CHECK(*GPIOx_OSPEEDR[PORT_A] == 0x000000F1U);
+}
+
+typedef struct { const char* name; void (*fn)(void); } TestCase;
+#define TEST_CASE(fn) { #fn, fn }
+
+int main(void) {
+    if (!mmio_fake_init()) return 1;
+
+    const TestCase tests[] = {
+        TEST_CASE(test_first_write_loads_register),
+        TEST_CASE(test_later_write_skips_read),
+        TEST_CASE(test_enable_clock_reloads),
+    };
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        const int failures = total_failures;
+        tests[i].fn();
+        printf("%s %s\n", tests[i].name, total_failures == failures ? "[OK]" : "[FAIL]");
+    }
+
+    printf("\nSummary: %d/%d assertions passed, %d failed.\n",
+           total_asserts - total_failures, total_asserts, total_failures);
+    return total_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,381 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mmio_fake.h"
+#include "internal/mdma.h"
+#include "internal/interrupt.h"
+#include "internal/mmio/mdma.h"
+#include "internal/mmio/rcc.h"
+
+// Tests of the MDMA copy engine against the register fake (see mmio_fake.h).
+//
+// fake_run() stands in for the controller: it runs the chain programmed into a channel, loading
+// each linked descriptor from memory as the MDMA would, raises the channel's flags and runs the
+// MDMA IRQ handler. Descriptors hold 32 bit addresses, so the binary is linked without PIE to keep
+// the engine's own static descriptors below 4 GiB.
+
+static int total_asserts = 0;
+static int total_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+static void check(int condition, const char* msg, int line) {
+    total_asserts++;
+    if (!condition) {
+        total_failures++;
+        printf("    - line %d: %s [FAIL]\n", line, msg);
+    }
+}
+
+// callback record
+static int callback_count;
+static bool callback_success;
+static void* callback_context;
+
+static void record_callback(bool success, void* context) {
+    callback_count++;
+    callback_success = success;
+    callback_context = context;
+}
+
+// Every transfer a test starts is finished by it, so the channels are free again here
+static void reset(void) {
+    mmio_fake_reset();
+    callback_count = 0;
+    callback_success = false;
+    callback_context = NULL;
+}
+
+static uint8_t* sram(uint32_t offset) {
+    return (uint8_t*)(uintptr_t)(MMIO_FAKE_SRAM_BASE + offset);
+}
+
+static bool nvic_enabled(int32_t irq) {
+    return (MMIO_FAKE_REG(0xE000E100U + 4U * (uint32_t)(irq / 32)) >> (irq % 32)) & 1U;
+}
+
+static uint32_t channel_isr_addr(uint32_t channel) {
+    return 0x52000040U + 0x40U * channel;
+}
+
+static void fill_pattern(uint8_t* buf, size_t size, uint8_t seed) {
+    for (size_t i = 0; i < size; i++) buf[i] = (uint8_t)(seed + i * 7);
+}
+
+// Runs the chain programmed into a channel, then ends it with CTCIF (or TEIF, without moving anything)
+static void fake_run(uint32_t channel, bool error) {
+    if (!error) {
+        while (true) {
+            const uint32_t tcr = *MDMA_MDMA_CxTCR[channel];
+            const uint32_t block = READ_FIELD(MDMA_MDMA_CxBNDTR[channel], MDMA_MDMA_CxBNDTR_BNDT);
+            const uint32_t repeats = READ_FIELD(MDMA_MDMA_CxBNDTR[channel], MDMA_MDMA_CxBNDTR_BRC);
+            const uint32_t width = 1U << ((tcr & MDMA_MDMA_CxTCR_SSIZE.msk) >> MDMA_MDMA_CxTCR_SSIZE.pos);
+            const bool fixed_src = (tcr & MDMA_MDMA_CxTCR_SINC.msk) == 0;
+            const uint8_t* src = (const uint8_t*)(uintptr_t)*MDMA_MDMA_CxSAR[channel];
+            uint8_t* dest = (uint8_t*)(uintptr_t)*MDMA_MDMA_CxDAR[channel];
+            const size_t size = (size_t)block * (repeats + 1);
+            for (size_t i = 0; i < size; i += width) {
+                memcpy(dest + i, src + (fixed_src ? 0 : i), width);
+            }
+            const uint32_t lar = *MDMA_MDMA_CxLAR[channel];
+            if (lar == 0) break;
+            const mdma_desc_t* next = (const mdma_desc_t*)(uintptr_t)lar;
+            *MDMA_MDMA_CxTCR[channel] = next->tcr;
+            *MDMA_MDMA_CxBNDTR[channel] = next->bndtr;
+            *MDMA_MDMA_CxSAR[channel] = next->sar;
+            *MDMA_MDMA_CxDAR[channel] = next->dar;
+            *MDMA_MDMA_CxLAR[channel] = next->lar;
+            *MDMA_MDMA_CxTBR[channel] = next->tbr;
+        }
+        CLR_FIELD(MDMA_MDMA_CxCR[channel], MDMA_MDMA_CxCR_EN);
+    }
+    MMIO_FAKE_REG(channel_isr_addr(channel)) = error ? MDMA_MDMA_C0ISR_TEIF0.msk : MDMA_MDMA_C0ISR_CTCIF0.msk;
+    MMIO_FAKE_REG(MDMA_MDMA_GISR0) = 1U << channel;
+    mdma_irq_handler();
+    MMIO_FAKE_REG(MDMA_MDMA_GISR0) = 0;
+}
+
+static bool channel_running(uint32_t channel) {
+    return IS_FIELD_SET(MDMA_MDMA_CxCR[channel], MDMA_MDMA_CxCR_EN);
+}
+
+static void test_init_enables_clock(void) {
+    reset();
+    CHECK(mdma_init() == NULL);
+    CHECK(IS_FIELD_SET(RCC_AHB3ENR, RCC_AHB3ENR_MDMAEN));
+    CHECK(nvic_enabled(MDMA_IRQ_NUM));
+}
+
+static void test_small_copy_on_cpu(void) {
+    reset();
+    uint8_t src[MDMA_CPU_THRESHOLD - 1];
+    uint8_t dest[MDMA_CPU_THRESHOLD - 1] = {0};
+    fill_pattern(src, sizeof(src), 3);
+    CHECK(mdma_memcpy(dest, src, sizeof(src), record_callback, src));
+    // Done and reported before returning, without touching a channel
+    CHECK(callback_count == 1);
+    CHECK(callback_success);
+    CHECK(callback_context == src);
+    CHECK(memcmp(dest, src, sizeof(src)) == 0);
+    CHECK(!channel_running(0));
+    CHECK(!IS_FIELD_SET(MDMA_MDMA_CxCR[0], MDMA_MDMA_CxCR_SWRQ));
+}
+
+static void test_copy_programs_channel(void) {
+    reset();
+    uint8_t* src = sram(0x0);
+    uint8_t* dest = sram(0x8000);
+    fill_pattern(src, 4096, 9);
+    CHECK(mdma_memcpy(dest, src, 4096, record_callback, dest));
+    CHECK(callback_count == 0);
+
+    CHECK(channel_running(0));
+    CHECK(IS_FIELD_SET(MDMA_MDMA_CxCR[0], MDMA_MDMA_CxCR_SWRQ));
+    CHECK(IS_FIELD_SET(MDMA_MDMA_CxCR[0], MDMA_MDMA_CxCR_CTCIE));
+    CHECK(IS_FIELD_SET(MDMA_MDMA_CxCR[0], MDMA_MDMA_CxCR_TEIE));
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SINC) == 2);
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_DINC) == 2);
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SSIZE) == 3); // double words
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_DSIZE) == 3);
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_TRGM) == 3);
+    CHECK(IS_FIELD_SET(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SWRM));
+    CHECK(READ_FIELD(MDMA_MDMA_CxBNDTR[0], MDMA_MDMA_CxBNDTR_BNDT) == 4096);
+    CHECK(READ_FIELD(MDMA_MDMA_CxBNDTR[0], MDMA_MDMA_CxBNDTR_BRC) == 0);
+    CHECK(*MDMA_MDMA_CxSAR[0] == (uint32_t)(uintptr_t)src);
+    CHECK(*MDMA_MDMA_CxDAR[0] == (uint32_t)(uintptr_t)dest);
+    CHECK(*MDMA_MDMA_CxLAR[0] == 0);
+    CHECK(*MDMA_MDMA_CxTBR[0] == 0);
+
+    fake_run(0, false);
+    CHECK(callback_count == 1);
+    CHECK(callback_success);
+    CHECK(callback_context == dest);
+    CHECK(memcmp(dest, src, 4096) == 0);
+    CHECK(MMIO_FAKE_REG(channel_isr_addr(0) + 4) == MDMA_MDMA_C0ISR_CTCIF0.msk);
+
+    // The channel is free again
+    CHECK(mdma_memcpy(dest, src, 1024, NULL, NULL));
+    CHECK(channel_running(0));
+    fake_run(0, false);
+}
+
+static void test_item_width_follows_alignment(void) {
+    reset();
+    CHECK(mdma_memcpy(sram(0x101), sram(0x2001), 1100, NULL, NULL));
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SSIZE) == 0);
+    fake_run(0, false);
+
+    CHECK(mdma_memcpy(sram(0x100), sram(0x2000), 1026, NULL, NULL));
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SSIZE) == 1);
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SINCOS) == 1);
+    fake_run(0, false);
+
+    CHECK(mdma_memcpy(sram(0x104), sram(0x2004), 1024, NULL, NULL));
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SSIZE) == 2);
+    fake_run(0, false);
+}
+
+static void test_large_copy_chains_blocks(void) {
+    reset();
+    const size_t size = 2 * MDMA_BLOCK_SIZE + 100;
+    uint8_t* src = sram(0x0);
+    uint8_t* dest = sram(0x40000);
+    fill_pattern(src, size, 1);
+    memset(dest, 0, size + 16);
+    CHECK(mdma_memcpy(dest, src, size, record_callback, NULL));
+
+    // Two repeated full blocks, then a linked descriptor for the rest
+    CHECK(READ_FIELD(MDMA_MDMA_CxBNDTR[0], MDMA_MDMA_CxBNDTR_BNDT) == MDMA_BLOCK_SIZE);
+    CHECK(READ_FIELD(MDMA_MDMA_CxBNDTR[0], MDMA_MDMA_CxBNDTR_BRC) == 1);
+    const mdma_desc_t* rest = (const mdma_desc_t*)(uintptr_t)*MDMA_MDMA_CxLAR[0];
+    CHECK(rest != NULL);
+    CHECK(((uintptr_t)rest & 7U) == 0);
+    CHECK(rest->sar == (uint32_t)(uintptr_t)(src + 2 * MDMA_BLOCK_SIZE));
+    CHECK(rest->dar == (uint32_t)(uintptr_t)(dest + 2 * MDMA_BLOCK_SIZE));
+    CHECK(rest->lar == 0);
+
+    fake_run(0, false);
+    CHECK(callback_count == 1);
+    CHECK(callback_success);
+    CHECK(memcmp(dest, src, size) == 0);
+    CHECK(dest[size] == 0);
+}
+
+static void test_memset(void) {
+    reset();
+    uint8_t* dest = sram(0x1000);
+    memset(dest - 8, 0x11, 1024 + 16);
+    CHECK(mdma_memset(dest, 0xA5, 1024, record_callback, NULL));
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_SINC) == 0);
+    CHECK(READ_FIELD(MDMA_MDMA_CxTCR[0], MDMA_MDMA_CxTCR_DINC) == 2);
+    fake_run(0, false);
+    CHECK(callback_count == 1);
+    bool filled = true;
+    for (int i = 0; i < 1024; i++) filled = filled && dest[i] == 0xA5;
+    CHECK(filled);
+    CHECK(dest[-1] == 0x11);
+    CHECK(dest[1024] == 0x11);
+
+    // Below the threshold it runs on the CPU
+    CHECK(mdma_memset(dest + 3, 0x5A, 13, record_callback, NULL));
+    CHECK(callback_count == 2);
+    CHECK(dest[2] == 0xA5 && dest[3] == 0x5A && dest[15] == 0x5A && dest[16] == 0xA5);
+}
+
+static void test_submit_chain(void) {
+    reset();
+    mdma_desc_t* descs = (mdma_desc_t*)sram(0x30000);
+    uint64_t* pattern = (uint64_t*)sram(0x30100);
+    *pattern = MDMA_FILL_PATTERN(0xEE);
+    uint8_t* header = sram(0x0);
+    uint8_t* payload = sram(0x1000);
+    uint8_t* frame = sram(0x8000);
+    fill_pattern(header, 16, 40);
+    fill_pattern(payload, 600, 80);
+
+    CHECK(mdma_desc_copy(&descs[0], frame, header, 16));
+    CHECK(mdma_desc_fill(&descs[1], frame + 16, pattern, 32));
+    CHECK(mdma_desc_copy(&descs[2], frame + 48, payload, 600)); // below the CPU threshold is fine here
+    CHECK(mdma_submit(descs, 3, record_callback, frame));
+
+    CHECK(descs[0].lar == (uint32_t)(uintptr_t)&descs[1]);
+    CHECK(descs[1].lar == (uint32_t)(uintptr_t)&descs[2]);
+    CHECK(descs[2].lar == 0);
+    CHECK(*MDMA_MDMA_CxLAR[0] == descs[0].lar);
+
+    fake_run(0, false);
+    CHECK(callback_count == 1);
+    CHECK(callback_context == frame);
+    CHECK(memcmp(frame, header, 16) == 0);
+    CHECK(frame[16] == 0xEE && frame[47] == 0xEE);
+    CHECK(memcmp(frame + 48, payload, 600) == 0);
+}
+
+static void test_desc_rejects_invalid(void) {
+    reset();
+    mdma_desc_t desc;
+    uint64_t pattern = 0;
+    CHECK(!mdma_desc_copy(&desc, sram(0), sram(0x100), 0));
+    CHECK(!mdma_desc_copy(&desc, sram(0), sram(0x100), MDMA_BLOCK_SIZE + 1));
+    CHECK(!mdma_desc_copy(&desc, sram(0), NULL, 64));
+    CHECK(!mdma_desc_copy(NULL, sram(0), sram(0x100), 64));
+    CHECK(mdma_desc_copy(&desc, sram(0), sram(0x100), 3 * MDMA_BLOCK_SIZE));
+    CHECK(!mdma_desc_fill(&desc, sram(0), NULL, 64));
+    CHECK(mdma_desc_fill(&desc, sram(0), &pattern, 64));
+    // The AHB port cannot read a fixed address
+    CHECK(!mdma_desc_fill(&desc, sram(0), (const uint64_t*)(uintptr_t)0x20000100U, 64));
+    CHECK(!mdma_submit(NULL, 1, NULL, NULL));
+    CHECK(!mdma_submit(&desc, 0, NULL, NULL));
+    CHECK(!mdma_memcpy(NULL, sram(0), 64, NULL, NULL));
+    CHECK(!mdma_memset(NULL, 0, 64, NULL, NULL));
+}
+
+static void test_tcm_uses_ahb_port(void) {
+    reset();
+    mdma_desc_t desc;
+    CHECK(mdma_desc_copy(&desc, (void*)(uintptr_t)0x20000000U, sram(0), 1024));
+    CHECK((desc.tbr & MDMA_MDMA_CxTBR_DBUS.msk) != 0);
+    CHECK((desc.tbr & MDMA_MDMA_CxTBR_SBUS.msk) == 0);
+    // Words at most through the AHB port
+    CHECK(((desc.tcr & MDMA_MDMA_CxTCR_SSIZE.msk) >> MDMA_MDMA_CxTCR_SSIZE.pos) == 2);
+}
+
+static void test_error_frees_channel(void) {
+    reset();
+    CHECK(mdma_memcpy(sram(0x1000), sram(0), 1024, record_callback, NULL));
+    fake_run(0, true);
+    CHECK(callback_count == 1);
+    CHECK(!callback_success);
+    CHECK(!channel_running(0));
+    CHECK(mdma_memcpy(sram(0x1000), sram(0), 1024, NULL, NULL));
+    CHECK(channel_running(0));
+    fake_run(0, false);
+}
+
+static void test_busy_falls_back_to_cpu(void) {
+    reset();
+    for (uint32_t channel = 0; channel < MDMA_COPY_CHANNELS; channel++) {
+        CHECK(mdma_memcpy(sram(0x10000 + channel * 0x1000), sram(0), 1024, NULL, NULL));
+        CHECK(channel_running(channel));
+    }
+    mdma_desc_t* desc = (mdma_desc_t*)sram(0x30000);
+    CHECK(mdma_desc_copy(desc, sram(0x8000), sram(0), 1024));
+    CHECK(!mdma_submit(desc, 1, NULL, NULL));
+
+    // Every channel is busy, the copy still happens
+    fill_pattern(sram(0x2000), 1024, 77);
+    CHECK(mdma_memcpy(sram(0x4000), sram(0x2000), 1024, record_callback, NULL));
+    CHECK(callback_count == 1);
+    CHECK(memcmp(sram(0x4000), sram(0x2000), 1024) == 0);
+
+    for (uint32_t channel = 0; channel < MDMA_COPY_CHANNELS; channel++) fake_run(channel, false);
+    CHECK(mdma_submit(desc, 1, NULL, NULL));
+    fake_run(0, false);
+}
+
+static void test_completion_invalidates_dest(void) {
+    reset();
+    // With the D-cache on, the fake's maintenance registers hold the last line written to them
+    MMIO_FAKE_REG(0xE000ED14U) |= 1U << 16; // SCB_CCR.DC
+    uint8_t* dest = sram(0x8000);
+    CHECK(mdma_memcpy(dest, sram(0), 1024, NULL, NULL));
+    CHECK(MMIO_FAKE_REG(0xE000EF70U) == (uint32_t)(uintptr_t)(dest + 1024 - 32)); // DCCIMVAC
+    MMIO_FAKE_REG(0xE000EF5CU) = 0;
+    fake_run(0, false);
+    CHECK(MMIO_FAKE_REG(0xE000EF5CU) == (uint32_t)(uintptr_t)(dest + 1024 - 32)); // DCIMVAC
+}
+
+static void test_cpu_copies(void) {
+    uint8_t src[96], dest[100], expect[100];
+    fill_pattern(src, sizeof(src), 5);
+    bool copies = true;
+    bool fills = true;
+    for (size_t so = 0; so < 4; so++) {
+        for (size_t doff = 0; doff < 4; doff++) {
+            for (size_t size = 0; size <= 64 + 3; size++) {
+                memset(dest, 0xCC, sizeof(dest));
+                memset(expect, 0xCC, sizeof(expect));
+                memcpy(expect + doff, src + so, size);
+                mdma_cpu_memcpy(dest + doff, src + so, size);
+                copies = copies && memcmp(dest, expect, sizeof(dest)) == 0;
+
+                memset(expect + doff, 0x3C, size);
+                mdma_cpu_memset(dest + doff, 0x3C, size);
+                fills = fills && memcmp(dest, expect, sizeof(dest)) == 0;
+            }
+        }
+    }
+    CHECK(copies);
+    CHECK(fills);
+}
+
+typedef struct { const char* name; void (*fn)(void); } TestCase;
+#define TEST_CASE(fn) { #fn, fn }
+
+int main(void) {
+    if (!mmio_fake_init()) return 1;
+
+    const TestCase tests[] = {
+        TEST_CASE(test_init_enables_clock),
+        TEST_CASE(test_small_copy_on_cpu),
+        TEST_CASE(test_copy_programs_channel),
+        TEST_CASE(test_item_width_follows_alignment),
+        TEST_CASE(test_large_copy_chains_blocks),
+        TEST_CASE(test_memset),
+        TEST_CASE(test_submit_chain),
+        TEST_CASE(test_desc_rejects_invalid),
+        TEST_CASE(test_tcm_uses_ahb_port),
+        TEST_CASE(test_error_frees_channel),
+        TEST_CASE(test_busy_falls_back_to_cpu),
+        TEST_CASE(test_completion_invalidates_dest),
+        TEST_CASE(test_cpu_copies),
+    };
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        const int failures = total_failures;
+        tests[i].fn();
+        printf("%s %s\n", tests[i].name, total_failures == failures ? "[OK]" : "[FAIL]");
+    }
+
+    printf("\nSummary: %d/%d assertions passed, %d failed.\n",
+           total_asserts - total_failures, total_asserts, total_failures);
+    return total_failures == 0 ? 0 : 1;
+}
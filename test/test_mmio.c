@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "internal/mmio_base.h"
+
+// Tests of the field macros and shadow registers in internal/mmio_base.h, on plain memory standing
+// in for a register. Built twice: test_mmio as drivers build by default, and test_mmio_check with
+// MMIO_SHADOW_CHECK, where this file's mmio_shadow_fault() replaces the weak default.
+
+static int total_asserts = 0;
+static int total_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+static void check(int condition, const char* msg, int line) {
+    total_asserts++;
+    if (!condition) {
+        total_failures++;
+        printf("    - line %d: %s [FAIL]\n", line, msg);
+    }
+}
+
+static volatile uint32_t reg;
+
+// A field of width bits at pos
+#define FIELD(pos_, width) ((field32_t){.msk = ((1U << (width)) - 1U) << (pos_), .pos = (pos_)})
+#define BIT(n) FIELD(n, 1)
+
+static void test_write_fields_keeps_other_bits(void) {
+    reg = 0xF0F0F0F0U;
+    const uint32_t written = WRITE_FIELDS(&reg,
+        FIELD_SET(FIELD(0, 4)),
+        FIELD_CLR(FIELD(4, 4)),
+        FIELD_VAL(FIELD(8, 8), 0x5A));
+    CHECK(reg == 0xF0F05A0FU);
+    CHECK(written == 0xF0F05A0FU);
+}
+
+static void test_write_fields_later_update_wins(void) {
+    const field32_t nibble = FIELD(4, 4);
+    reg = 0;
+    WRITE_FIELDS(&reg, FIELD_SET(nibble), FIELD_CLR(nibble));
+    CHECK(reg == 0);
+    WRITE_FIELDS(&reg, FIELD_CLR(nibble), FIELD_VAL(nibble, 0x9));
+    CHECK(reg == 0x90U);
+    // A later update overlapping only part of an earlier one replaces just those bits
+    reg = 0;
+    WRITE_FIELDS(&reg, FIELD_VAL(FIELD(0, 8), 0xFF), FIELD_CLR(nibble));
+    CHECK(reg == 0x0FU);
+    // Values wider than the field are cut to it rather than spilling into its neighbours
+    reg = 0;
+    WRITE_FIELDS(&reg, FIELD_VAL(nibble, 0x1F));
+    CHECK(reg == 0xF0U);
+}
+
+static void test_write_wo_fields_zeroes_the_rest(void) {
+    reg = 0xFFFFFFFFU;
+    const uint32_t written = WRITE_WO_FIELDS(&reg,
+        FIELD_SET(BIT(31)),
+        FIELD_VAL(FIELD(8, 4), 0x3));
+    CHECK(reg == 0x80000300U);
+    CHECK(written == 0x80000300U);
+    // Cleared fields are zero like every bit no update covers, and later updates win here too
+    reg = 0xFFFFFFFFU;
+    WRITE_WO_FIELDS(&reg, FIELD_SET(BIT(0)), FIELD_CLR(BIT(0)), FIELD_SET(BIT(1)));
+    CHECK(reg == 0x2U);
+}
+
+static void test_write_fields_sixteen_updates(void) {
+    // 16 updates is the most one call takes (a 17th fails to compile, see CMakeLists.txt)
+    reg = 0xFFFF0000U;
+    WRITE_FIELDS(&reg,
+        FIELD_SET(BIT(0)), FIELD_SET(BIT(1)), FIELD_SET(BIT(2)), FIELD_SET(BIT(3)),
+        FIELD_SET(BIT(4)), FIELD_SET(BIT(5)), FIELD_SET(BIT(6)), FIELD_SET(BIT(7)),
+        FIELD_SET(BIT(8)), FIELD_SET(BIT(9)), FIELD_SET(BIT(10)), FIELD_SET(BIT(11)),
+        FIELD_SET(BIT(12)), FIELD_SET(BIT(13)), FIELD_SET(BIT(14)), FIELD_CLR(BIT(31)));
+    CHECK(reg == 0x7FFF7FFFU);
+    reg = 0xFFFFFFFFU;
+    WRITE_WO_FIELDS(&reg,
+        FIELD_SET(BIT(16)), FIELD_SET(BIT(17)), FIELD_SET(BIT(18)), FIELD_SET(BIT(19)),
+        FIELD_SET(BIT(20)), FIELD_SET(BIT(21)), FIELD_SET(BIT(22)), FIELD_SET(BIT(23)),
+        FIELD_SET(BIT(24)), FIELD_SET(BIT(25)), FIELD_SET(BIT(26)), FIELD_SET(BIT(27)),
+        FIELD_SET(BIT(28)), FIELD_SET(BIT(29)), FIELD_SET(BIT(30)), FIELD_SET(BIT(31)));
+    CHECK(reg == 0xFFFF0000U);
+}
+
+// mmio_shadow_fault() record, fault_count stays 0 without MMIO_SHADOW_CHECK
+static int fault_count;
+
+#ifdef MMIO_SHADOW_CHECK
+static rw_reg32_t fault_reg;
+static uint32_t fault_shadow;
+static uint32_t fault_actual;
+
+void mmio_shadow_fault(rw_reg32_t reg, uint32_t shadow, uint32_t actual) {
+    fault_count++;
+    fault_reg = reg;
+    fault_shadow = shadow;
+    fault_actual = actual;
+}
+#endif
+
+static void test_shadow_loads_on_first_write(void) {
+    shadow32_t shadow = {0};
+    fault_count = 0;
+    reg = 0x00FF0000U;
+    const uint32_t written = SHADOW_WRITE_FIELDS(&reg, &shadow, FIELD_SET(BIT(0)), FIELD_VAL(FIELD(4, 4), 0x6));
+    CHECK(reg == 0x00FF0061U);
+    CHECK(written == 0x00FF0061U);
+    CHECK(shadow.valid && shadow.val == 0x00FF0061U);
+    CHECK(SHADOW_READ_FIELD(&shadow, FIELD(16, 8)) == 0xFF);
+    CHECK(SHADOW_MATCHES(&reg, &shadow));
+    CHECK(fault_count == 0);
+}
+
+static void test_shadow_later_write_skips_read(void) {
+    shadow32_t shadow = {0};
+    fault_count = 0;
+    reg = 0x00FF0000U;
+    SHADOW_SET_FIELD(&reg, &shadow, BIT(0));
+    // Changed behind the shadow's back
+    reg = 0x0000000FU;
+    CHECK(!SHADOW_MATCHES(&reg, &shadow));
+    SHADOW_CLR_FIELD(&reg, &shadow, BIT(0));
+#ifdef MMIO_SHADOW_CHECK
+    // The write reads the register, reports the drift and applies the update to what it read
+    CHECK(fault_count == 1);
+    CHECK(fault_reg == &reg && fault_shadow == 0x00FF0001U && fault_actual == 0x0000000FU);
+    CHECK(reg == 0x0000000EU);
+#else
+    // The write is computed from the copy alone, so the register's new value is never seen
+    CHECK(reg == 0x00FF0000U);
+#endif
+    CHECK(shadow.val == reg);
+}
+
+static void test_shadow_invalidate_reloads(void) {
+    shadow32_t shadow = {0};
+    fault_count = 0;
+    reg = 0x00FF0000U;
+    SHADOW_SET_FIELD(&reg, &shadow, BIT(0));
+    // E.g. the peripheral was reset: invalidate, and the next write starts from the register again
+    reg = 0x00000100U;
+    SHADOW_INVALIDATE(&shadow);
+    CHECK(!shadow.valid);
+    CHECK(SHADOW_MATCHES(&reg, &shadow));
+    SHADOW_WRITE_FIELD(&reg, &shadow, FIELD(4, 4), 0x3);
+    CHECK(reg == 0x00000130U);
+    CHECK(shadow.valid && shadow.val == 0x00000130U);
+    CHECK(fault_count == 0);
+}
+
+typedef struct { const char* name; void (*fn)(void); } TestCase;
+#define TEST_CASE(fn) { #fn, fn }
+
+int main(void) {
+    const TestCase tests[] = {
+        TEST_CASE(test_write_fields_keeps_other_bits),
+        TEST_CASE(test_write_fields_later_update_wins),
+        TEST_CASE(test_write_wo_fields_zeroes_the_rest),
+        TEST_CASE(test_write_fields_sixteen_updates),
+        TEST_CASE(test_shadow_loads_on_first_write),
+        TEST_CASE(test_shadow_later_write_skips_read),
+        TEST_CASE(test_shadow_invalidate_reloads),
+    };
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        const int failures = total_failures;
+        tests[i].fn();
+        printf("%s %s\n", tests[i].name, total_failures == failures ? "[OK]" : "[FAIL]");
+    }
+
+    printf("\nSummary: %d/%d assertions passed, %d failed.\n",
+           total_asserts - total_failures, total_asserts, total_failures);
+    return total_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,406 @@
+#!/usr/bin/env python3
+# This file is part of the titan project.
+# Copyright (c) 2025 UW SARP
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# @file alloc_replay.py
+# @authors UW SARP
+# @brief Replays an allocator trace against other pool geometries.
+"""Replay an allocation trace against pool configurations and report usage.
+
+The trace is either a raw dump of the firmware's alloc_trace ring (built with ALLOC_TRACE, see
+src/internal/alloc.h), e.g. from gdb:
+
+    dump binary value trace.bin alloc_trace
+
+or a text trace as read by test/fuzz_alloc (--replay).  Every request in the trace is replayed against
+each configuration: the pool tables in src/internal/alloc.h by default, plus any given with --header
+(another copy of alloc.h) or --pools (a table on the command line).  For each one this reports the
+peak blocks in use, failures and fallbacks per pool, and which call sites held the blocks when the
+first request failed.
+
+    tools/alloc_replay.py trace.bin
+    tools/alloc_replay.py trace.bin --pools "SRAM123=16:200,32:100,64:150,128:100,256:100,512:5,1024:5"
+    tools/alloc_replay.py trace.bin --elf src/build/titan.elf         # name the call sites
+    tools/alloc_replay.py trace.bin --text trace.txt                  # convert for fuzz_alloc --replay
+
+Requests the board failed are replayed too (and given back at once, since the firmware never held
+them), so a configuration that would have served them shows up as having fewer failures.  If the
+ring wrapped, blocks allocated before its oldest entry are invisible: their frees are skipped and the
+peaks only count blocks allocated inside the window.
+"""
+
+import argparse
+import collections
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+TRACE_MAGIC = 0x54434C41  # ALLOC_TRACE_MAGIC
+HEADER = struct.Struct("<IHHII")  # magic, depth, entry_size, count, reserved
+ENTRY = struct.Struct("<IIIHBB")  # time, caller, addr, size, op (low nibble) | hint (high nibble), pool
+
+OP_ALLOC, OP_FREE, OP_RESIZE = 0, 1, 2
+HINT_DEFAULT, HINT_FAST, HINT_DMA, HINT_DMA_ALIGNED = 0, 1, 2, 3
+HINT_NAMES = ["default", "fast", "dma", "dma_aligned"]
+FAILED_POOL = 0xFF
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_HEADER = os.path.join(REPO, "src", "internal", "alloc.h")
+
+
+class Op:
+    """One heap call: kind, request size, hint, board block address (0 if it failed), caller."""
+
+    __slots__ = ("kind", "size", "hint", "addr", "caller", "time")
+
+    def __init__(self, kind, size=0, hint=HINT_DEFAULT, addr=0, caller=0, time=0):
+        self.kind, self.size, self.hint, self.addr, self.caller, self.time = kind, size, hint, addr, caller, time
+
+
+# ---------------------------------------------------------------------------------------------------
+# configurations
+# ---------------------------------------------------------------------------------------------------
+
+class Config:
+    """Pool tables of every region, in ALLOC_REGIONS order, as [(region, [(block size, count)])]."""
+
+    def __init__(self, name, regions, guard=0):
+        self.name = name
+        self.regions = regions
+        self.guard = guard
+        self.pools = []  # (region index, block size, count), numbered across regions like the firmware
+        for r, (_, table) in enumerate(regions):
+            for size, count in table:
+                self.pools.append((r, size, count))
+
+    def region_index(self, name):
+        for r, (region, _) in enumerate(self.regions):
+            if region == name:
+                return r
+        return None
+
+    def hint_regions(self, hint):
+        """Regions tried for a hint, in order (hint_regions in alloc.c)."""
+        order = {
+            HINT_DEFAULT: ["SRAM123"],
+            HINT_FAST: ["DTCM", "SRAM123"],
+            HINT_DMA: ["AXI", "SRAM123"],
+            HINT_DMA_ALIGNED: ["AXI"],
+        }[hint]
+        return [r for r in (self.region_index(name) for name in order) if r is not None]
+
+
+def parse_header(path, guard):
+    """Pool tables from the ALLOC_POOLS_<REGION>(X) macros and region order from ALLOC_REGIONS."""
+    with open(path) as f:
+        text = f.read().replace("\\\n", " ")
+    tables = {}
+    for m in re.finditer(r"#define\s+ALLOC_POOLS_(\w+)\(X\)(.*)", text):
+        tables[m.group(1)] = [(int(s), int(c)) for _, s, c in re.findall(r"X\(\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)", m.group(2))]
+    order = re.search(r"#define\s+ALLOC_REGIONS\(X\)(.*)", text)
+    names = re.findall(r"X\(\s*(\w+)\s*,", order.group(1)) if order else list(tables)
+    regions = [(name, tables[name]) for name in names if name in tables]
+    if not regions:
+        sys.exit(f"{path}: no ALLOC_POOLS_* tables found")
+    return Config(os.path.relpath(path), regions, guard)
+
+
+def parse_pools(spec, base):
+    """--pools "REGION=size:count,...[;REGION=...]": replaces those regions' tables in base."""
+    regions = dict(base.regions)
+    for part in spec.split(";"):
+        if not part.strip():
+            continue
+        region, _, table = part.partition("=")
+        region = region.strip()
+        if region not in regions:
+            sys.exit(f"--pools: unknown region {region} (have {', '.join(regions)})")
+        pools = []
+        for entry in table.split(","):
+            size, _, count = entry.strip().partition(":")
+            pools.append((int(size), int(count)))
+        if [s for s, _ in pools] != sorted(set(s for s, _ in pools)):
+            sys.exit(f"--pools: block sizes of {region} must be strictly increasing")
+        regions[region] = pools
+    return Config(spec, [(name, regions[name]) for name, _ in base.regions], base.guard)
+
+
+# ---------------------------------------------------------------------------------------------------
+# traces
+# ---------------------------------------------------------------------------------------------------
+
+def read_binary(data):
+    """Ops from a raw alloc_trace dump, oldest first, and how many older entries the ring dropped."""
+    magic, depth, entry_size, count, _ = HEADER.unpack_from(data, 0)
+    if entry_size != ENTRY.size or len(data) < HEADER.size + depth * entry_size:
+        sys.exit(f"trace dump is truncated or has {entry_size} byte entries (expected {ENTRY.size})")
+    entries = [ENTRY.unpack_from(data, HEADER.size + k * entry_size) for k in range(depth)]
+    if count <= depth:
+        window, lost = entries[:count], 0
+    else:
+        start = count % depth
+        window, lost = entries[start:] + entries[:start], count - depth
+    ops = []
+    for time, caller, addr, size, op_hint, _pool in window:
+        ops.append(Op(op_hint & 0xF, size, op_hint >> 4, addr, caller, time))
+    return ops, lost
+
+
+def read_text(lines):
+    """Ops from a text trace (format in test/fuzz_alloc.c).  Ids stand in for block addresses."""
+    ops = []
+    live = set()
+    for lineno, line in enumerate(lines, 1):
+        fields = line.split("#", 1)[0].split()
+        if not fields:
+            continue
+        try:
+            op, nums = fields[0], [int(x) for x in fields[1:]]
+            ident = nums[0] + 1  # keep 0 for "failed"
+            if op in "auhd":
+                hint = {"a": HINT_DEFAULT, "u": HINT_DEFAULT, "d": HINT_DMA_ALIGNED}.get(op) if op != "h" else nums[2]
+                ops.append(Op(OP_ALLOC, nums[1], hint, ident))
+                live.add(ident)
+            elif op == "f":
+                ops.append(Op(OP_FREE, addr=ident))
+                live.discard(ident)
+            elif op == "r":
+                if ident in live:
+                    ops.append(Op(OP_RESIZE, nums[1], addr=ident))
+                else:
+                    ops.append(Op(OP_ALLOC, nums[1], HINT_DEFAULT, ident))
+                    live.add(ident)
+            else:
+                raise ValueError(op)
+        except (ValueError, IndexError):
+            sys.exit(f"line {lineno}: malformed trace line: {line.rstrip()}")
+    return ops, 0
+
+
+def read_trace(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) >= HEADER.size and struct.unpack_from("<I", data, 0)[0] == TRACE_MAGIC:
+        return read_binary(data)
+    return read_text(data.decode().splitlines())
+
+
+def write_text(ops, path):
+    """Writes ops in the text format fuzz_alloc --replay reads, recycling ids."""
+    free_ids = []
+    next_id = 0
+    ids = {}
+    with open(path, "w") as f:
+        f.write("# converted by tools/alloc_replay.py\n")
+        for op in ops:
+            if op.kind == OP_ALLOC:
+                ident = free_ids.pop() if free_ids else next_id
+                next_id = max(next_id, ident + 1)
+                letter = "d" if op.hint == HINT_DMA_ALIGNED else "h"
+                suffix = "" if letter == "d" else f" {op.hint}"
+                f.write(f"{letter} {ident} {op.size}{suffix}\n")
+                if op.addr and op.addr not in ids:
+                    ids[op.addr] = ident
+                else:
+                    free_ids.append(ident)  # failed on the board, or a duplicate address
+            elif op.kind == OP_FREE and op.addr in ids:
+                ident = ids.pop(op.addr)
+                f.write(f"f {ident}\n")
+                free_ids.append(ident)
+            elif op.kind == OP_RESIZE and op.addr in ids:
+                f.write(f"r {ids[op.addr]} {op.size}\n")
+
+
+# ---------------------------------------------------------------------------------------------------
+# simulation
+# ---------------------------------------------------------------------------------------------------
+
+class PoolStats:
+    __slots__ = ("in_use", "peak", "allocs", "failed", "fallbacks")
+
+    def __init__(self):
+        self.in_use = self.peak = self.allocs = self.failed = self.fallbacks = 0
+
+
+class Heap:
+    """The firmware's pool selection (take_block/take_from_region in alloc.c) over counts only."""
+
+    def __init__(self, config):
+        self.config = config
+        self.stats = [PoolStats() for _ in config.pools]
+
+    def take(self, hint, size):
+        """Pool index for a request, or None; charges failures/fallbacks like ALLOC_STATS does."""
+        size += self.config.guard
+        charged = None
+        for r in self.config.hint_regions(hint):
+            pools = [i for i, p in enumerate(self.config.pools) if p[0] == r]
+            fitting = [i for i in pools if self.config.pools[i][1] >= size]
+            if not fitting:
+                if charged is None and pools:
+                    charged = pools[-1]
+                continue
+            ideal = fitting[0]
+            if charged is None:
+                charged = ideal
+            for i in fitting:
+                st = self.stats[i]
+                if st.in_use < self.config.pools[i][2]:
+                    st.in_use += 1
+                    st.peak = max(st.peak, st.in_use)
+                    st.allocs += 1
+                    if i != charged:
+                        self.stats[charged].fallbacks += 1
+                    return i
+        if charged is not None:
+            self.stats[charged].failed += 1
+        return None
+
+    def give(self, i):
+        self.stats[i].in_use -= 1
+
+    def usable(self, i):
+        return self.config.pools[i][1] - self.config.guard
+
+    def resize_hint(self, i):
+        name = self.config.regions[self.config.pools[i][0]][0]
+        return {"DTCM": HINT_FAST, "AXI": HINT_DMA_ALIGNED}.get(name, HINT_DEFAULT)
+
+
+def simulate(config, ops):
+    """Replays ops; returns the heap, failures [(op, holders)] and unmatched free count."""
+    heap = Heap(config)
+    live = {}  # board address -> (pool, caller)
+    failures = []
+    unmatched = 0
+
+    def holders():
+        by_caller = collections.Counter()
+        for pool, caller in live.values():
+            by_caller[caller] += 1
+        return by_caller
+
+    for op in ops:
+        if op.kind == OP_ALLOC:
+            if op.size == 0:
+                continue
+            i = heap.take(op.hint, op.size)
+            if i is None:
+                failures.append((op, holders() if not failures else None))
+            elif not op.addr or op.addr in live:
+                heap.give(i)  # the board never held this block
+            else:
+                live[op.addr] = (i, op.caller)
+        elif op.kind == OP_FREE:
+            if op.addr in live:
+                heap.give(live.pop(op.addr)[0])
+            else:
+                unmatched += 1
+        elif op.kind == OP_RESIZE and op.addr in live:
+            i, caller = live[op.addr]
+            if op.size > heap.usable(i):
+                j = heap.take(heap.resize_hint(i), op.size)
+                if j is None:
+                    failures.append((op, holders() if not failures else None))
+                else:
+                    heap.give(i)
+                    live[op.addr] = (j, caller)
+    return heap, failures, unmatched
+
+
+# ---------------------------------------------------------------------------------------------------
+# report
+# ---------------------------------------------------------------------------------------------------
+
+class Symbolizer:
+    def __init__(self, elf, tool):
+        self.elf = elf
+        self.tool = tool if shutil.which(tool) else None
+        self.cache = {}
+        if elf and not self.tool:
+            print(f"warning: {tool} not found, call sites are shown as addresses", file=sys.stderr)
+
+    def __call__(self, pc):
+        if not self.elf or not self.tool or pc == 0:
+            return f"0x{pc:08x}"
+        if pc not in self.cache:
+            # return addresses point after the call, step back into it (thumb: bit 0 set)
+            out = subprocess.run([self.tool, "-f", "-C", "-e", self.elf, hex((pc & ~1) - 2)],
+                                 capture_output=True, text=True).stdout.split("\n")
+            func = out[0] if out and out[0] else "??"
+            where = os.path.basename(out[1]) if len(out) > 1 else "??"
+            self.cache[pc] = f"0x{pc:08x} {func} ({where})"
+        return self.cache[pc]
+
+
+def report(config, heap, failures, unmatched, symbolize, top):
+    print(f"== {config.name}" + (f" (guard {config.guard})" if config.guard else ""))
+    print(f"  {'pool':<16}{'blocks':>8}{'peak':>8}{'allocs':>9}{'failed':>8}{'fallbk':>8}")
+    for i, (r, size, count) in enumerate(config.pools):
+        st = heap.stats[i]
+        name = f"{config.regions[r][0]}_{size}"
+        mark = "  FULL" if st.peak == count and count else ""
+        print(f"  {name:<16}{count:>8}{st.peak:>8}{st.allocs:>9}{st.failed:>8}{st.fallbacks:>8}{mark}")
+    peak_bytes = sum(heap.stats[i].peak * size for i, (_, size, _) in enumerate(config.pools))
+    print(f"  failed requests: {len(failures)}, sum of pool peaks: {peak_bytes} bytes"
+          + (f", {unmatched} frees of blocks from before the trace" if unmatched else ""))
+    if failures:
+        op, held = failures[0]
+        kind = "resize" if op.kind == OP_RESIZE else f"alloc ({HINT_NAMES[op.hint]})"
+        print(f"  first failure: {kind} of {op.size} bytes from {symbolize(op.caller)} at t={op.time}")
+        print("  blocks held at that point, by call site:")
+        for caller, n in held.most_common(top):
+            print(f"    {n:>5}  {symbolize(caller)}")
+        failed_by = collections.Counter(op.caller for op, _ in failures)
+        print("  failed requests by call site:")
+        for caller, n in failed_by.most_common(top):
+            print(f"    {n:>5}  {symbolize(caller)}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("trace", help="raw alloc_trace dump or text trace")
+    parser.add_argument("--header", action="append", default=[], metavar="ALLOC_H",
+                        help="also replay against the pool tables of another alloc.h")
+    parser.add_argument("--pools", action="append", default=[], metavar="SPEC",
+                        help='also replay with regions replaced, "REGION=size:count,...[;REGION=...]"')
+    parser.add_argument("--guard", type=int, default=0,
+                        help="bytes ALLOC_DEBUG adds to each request (ALLOC_ALIGN if the board ran with it)")
+    parser.add_argument("--elf", help="firmware image, to name call sites with addr2line")
+    parser.add_argument("--addr2line", default="arm-none-eabi-addr2line")
+    parser.add_argument("--top", type=int, default=8, help="call sites to list (default 8)")
+    parser.add_argument("--text", metavar="OUT", help="also write the trace in fuzz_alloc's text format")
+    args = parser.parse_args()
+
+    ops, lost = read_trace(args.trace)
+    print(f"{len(ops)} trace entries" + (f" (ring wrapped, {lost} older entries lost)" if lost else ""))
+    print()
+    if args.text:
+        write_text(ops, args.text)
+
+    base = parse_header(DEFAULT_HEADER, args.guard)
+    configs = [base] + [parse_header(h, args.guard) for h in args.header] + [parse_pools(p, base) for p in args.pools]
+    symbolize = Symbolizer(args.elf, args.addr2line)
+    for config in configs:
+        heap, failures, unmatched = simulate(config, ops)
+        report(config, heap, failures, unmatched, symbolize, args.top)
+
+
+if __name__ == "__main__":
+    main()
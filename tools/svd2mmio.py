@@ -0,0 +1,475 @@
+#!/usr/bin/env python3
+# This file is part of the titan project.
+# Copyright (c) 2025 UW SARP
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# @file svd2mmio.py
+# @authors UW SARP
+# @brief Generates per-peripheral mmio headers from an SVD file.
+"""Generate per-peripheral mmio headers (src/internal/mmio/*.h) from port.svd.
+
+    tools/svd2mmio.py                                  # port.svd -> src/internal/mmio/
+    tools/svd2mmio.py --svd other.svd --out DIR
+    tools/svd2mmio.py --compare src/internal/mmio.h    # list names whose values differ from mmio.h
+
+Each SVD peripheral and the ones derived from it become one header, with the same naming scheme as
+internal/mmio.h and every definition a static const (see mmio_base.h):
+
+  - A peripheral with one instance keeps its name: RCC_APB2ENR, RCC_APB2ENR_SPI1EN.
+  - Instances that differ only by a number (or a GPIO port letter) are one group, with that part
+    replaced by x.  Its registers are arrays indexed by instance number: SPIx_CFG1[7] holds SPI1 to
+    SPI6 at [1] to [6], GPIOx_MODER[11] holds GPIOA to GPIOK at [0] to [10].  Its fields are shared:
+    SPIx_CFG1_MBR.  Instances named differently (USART1 and UART4, both derived from USART1) form
+    separate groups (USARTx, UARTx) in the same header.
+  - Fields numbered within a register are also collected into an array indexed by their number:
+    RCC_APB1LENR_SPI2EN and RCC_APB1LENR_SPI3EN are RCC_APB1LENR_SPIxEN[2] and [3].
+  - Registers numbered within a peripheral whose members all have the same fields are collected
+    the same way, and their fields are defined once under the family name: DMAx_S0NDTR ..
+    DMAx_S7NDTR are DMAx_SxNDTR[3][8] ([instance][stream]) with field DMAx_SxNDTR_NDT.  Families
+    whose members differ (DMAx_S0CR .. DMAx_S7CR) stay individual registers.
+  - Core peripherals (SCB, NVIC, MPU, ...) are not in the SVD; they are only in internal/mmio.h.
+
+Every header is written from scratch; do not edit them by hand.
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Groups whose x name would collide with another group's get a fixed name instead.  The timer
+# names are the ones internal/mmio.h uses (advanced, general purpose and basic timers).
+GROUP_NAMES = {
+    "TIM1": "A_TIMx",
+    "TIM2": "G_TIMx",
+    "TIM6": "B_TIMx",
+    "LPTIM3": "B_LPTIMx",  # LPTIM3 to LPTIM5, which lack LPTIM1/2's encoder and input 2
+}
+
+LICENSE = """/**
+ * This file is part of the Titan Project.
+ * Copyright (c) 2025 UW SARP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *"""
+
+BANNER = "/" + "*" * 98
+
+
+# ---------------------------------------------------------------------------------------------------
+# SVD model
+# ---------------------------------------------------------------------------------------------------
+
+class Field:
+    def __init__(self, name, pos, width, desc):
+        self.name, self.pos, self.width, self.desc = name, pos, width, desc
+
+    def key(self):
+        return (self.name, self.pos, self.width)
+
+
+class Register:
+    def __init__(self, name, offset, size, access, desc, fields):
+        self.name, self.offset, self.size, self.access, self.desc, self.fields = name, offset, size, access, desc, fields
+
+
+class Peripheral:
+    def __init__(self, name, base, registers, derived_from=None):
+        self.name, self.base, self.registers, self.derived_from = name, base, registers, derived_from
+
+
+def text(elem, tag, default=None):
+    child = elem.find(tag)
+    return child.text.strip() if child is not None and child.text else default
+
+
+def number(value):
+    return int(value, 0)
+
+
+def clean_desc(desc, fallback):
+    desc = " ".join((desc or fallback).split())
+    desc = desc.replace("*/", "* /")
+    if desc and desc[0].islower():
+        desc = desc[0].upper() + desc[1:]
+    if desc and desc[-1] not in ".!?":
+        desc += "."
+    return desc
+
+
+def load_svd(path):
+    root = ET.parse(path).getroot()
+    default_size = number(text(root, "size", "32"))
+    peripherals = []
+    by_name = {}
+    for p in root.find("peripherals"):
+        name = text(p, "name").upper()
+        base = number(text(p, "baseAddress"))
+        derived = p.get("derivedFrom")
+        derived = derived.upper() if derived else None
+        registers = []
+        regs = p.find("registers")
+        if regs is not None:
+            for r in regs.findall("register"):
+                fields = []
+                fs = r.find("fields")
+                if fs is not None:
+                    for f in fs.findall("field"):
+                        fields.append(Field(text(f, "name").upper(), number(text(f, "bitOffset")),
+                                            number(text(f, "bitWidth")), clean_desc(text(f, "description"), text(f, "name"))))
+                registers.append(Register(text(r, "name").upper(), number(text(r, "addressOffset")),
+                                          number(text(r, "size", str(default_size))), text(r, "access", "read-write"),
+                                          clean_desc(text(r, "description"), text(r, "name")), fields))
+        periph = Peripheral(name, base, registers, derived)
+        peripherals.append(periph)
+        by_name[name] = periph
+    for periph in peripherals:
+        if periph.derived_from:
+            periph.registers = by_name[periph.derived_from].registers
+    return peripherals
+
+
+# ---------------------------------------------------------------------------------------------------
+# naming
+# ---------------------------------------------------------------------------------------------------
+
+def instance_id(name):
+    """(x name, index) of an instance name, or None if it has no number/port letter to replace."""
+    m = re.match(r"^(GPIO)([A-K])$", name)
+    if m:
+        return m.group(1) + "x", ord(m.group(2)) - ord("A")
+    runs = list(re.finditer(r"\d+", name))
+    if not runs:
+        return None
+    run = runs[-1]  # I2C1 is instance 1 of I2Cx
+    return name[:run.start()] + "x" + name[run.end():], int(run.group())
+
+
+class Group:
+    """Instances sharing one register layout.  instances is [(index, Peripheral)], or index None for
+    a single instance that keeps its own name."""
+
+    def __init__(self, name, instances):
+        self.name, self.instances = name, instances
+
+    @property
+    def multi(self):
+        return self.instances[0][0] is not None
+
+    @property
+    def registers(self):
+        return self.instances[0][1].registers
+
+    def array_size(self):
+        return max(i for i, _ in self.instances) + 1
+
+
+def make_groups(peripherals):
+    """{base peripheral name: [Group]} in SVD order."""
+    families = {}
+    for p in peripherals:
+        families.setdefault(p.derived_from or p.name, []).append(p)
+
+    result = {}
+    taken = {}
+    for base, members in families.items():
+        groups = []
+        if len(members) == 1:
+            groups.append(Group(members[0].name, [(None, members[0])]))
+        else:
+            by_x = {}
+            for p in members:
+                ident = instance_id(p.name)
+                if ident is None:
+                    groups.append(Group(p.name, [(None, p)]))
+                else:
+                    by_x.setdefault(ident[0], []).append((ident[1], p))
+            for xname, inst in by_x.items():
+                indices = [i for i, _ in inst]
+                if len(inst) == 1 or len(set(indices)) != len(indices):
+                    groups.extend(Group(p.name, [(None, p)]) for _, p in inst)
+                    continue
+                owns_base = any(p.name == base for _, p in inst)
+                name = GROUP_NAMES[base] if owns_base and base in GROUP_NAMES else xname
+                groups.append(Group(name, sorted(inst, key=lambda t: t[0])))
+        for g in groups:
+            if g.name in taken:
+                sys.exit(f"group name {g.name} of {base} is also used by {taken[g.name]}, add it to GROUP_NAMES")
+            taken[g.name] = base
+        result[base] = groups
+    return result
+
+
+def families(names):
+    """{family name: {index: member name}} for names that differ only by one number (CC1E, CC2E -> CCxE).
+    A family needs two members with distinct indices below 64, and must not clash with a real name.
+    A name numbered more than once joins the family of its first number that forms one (S0M0AR and
+    S1M0AR -> SxM0AR)."""
+    candidates = {}  # family -> {index: [names]}
+    choices = {}     # name -> [family] in order of its numbers
+    for name in names:
+        for m in re.finditer(r"\d+", name):
+            if len(m.group()) > 1 and m.group().startswith("0"):
+                continue
+            key = name[:m.start()] + "x" + name[m.end():]
+            candidates.setdefault(key, {}).setdefault(int(m.group()), []).append(name)
+            choices.setdefault(name, []).append(key)
+
+    def valid(key):
+        members = candidates[key]
+        return len(members) >= 2 and all(len(v) == 1 for v in members.values()) and max(members) < 64 \
+            and key not in names
+
+    result = {}
+    for name in names:
+        key = next((k for k in choices.get(name, []) if valid(k)), None)
+        if key is not None:
+            index = next(i for i, v in candidates[key].items() if v[0] == name)
+            result.setdefault(key, {})[index] = name
+    return {k: dict(sorted(v.items())) for k, v in result.items() if len(v) >= 2}
+
+
+# ---------------------------------------------------------------------------------------------------
+# emitting
+# ---------------------------------------------------------------------------------------------------
+
+def reg_type(reg):
+    bits = reg.size
+    kind = "ro" if reg.access == "read-only" else "rw"
+    return f"{kind}_reg{bits}_t"
+
+
+def field_type(reg):
+    return f"field{reg.size}_t"
+
+
+def hexval(value, bits):
+    return f"0x{value:0{bits // 4}X}U"
+
+
+def aligned(lines):
+    """[(decl, value, comment)] -> aligned 'decl = value; comment' lines."""
+    if not lines:
+        return []
+    w1 = max(len(d) for d, _, _ in lines)
+    w2 = max(len(f"{d:<{w1}} = {v};") for d, v, _ in lines)
+    return [f"{d:<{w1}} = {v};".ljust(w2) + f" /** @brief {c} */" for d, v, c in lines]
+
+
+def array_block(decl, entries, comment, values_fmt):
+    """Multi-line array definition with designated initializers."""
+    out = [f"/** @brief {comment} */", decl + " = {"]
+    wi = max(len(f"[{i}]") for i in entries)
+    for i, value in sorted(entries.items()):
+        out.append(f"  {f'[{i}]':<{wi}} = {values_fmt(value)},")
+    out.append("};")
+    out.append("")
+    return out
+
+
+def field_value(reg, f):
+    bits = reg.size
+    return f"{{.msk = {hexval(((1 << f.width) - 1) << f.pos, bits)}, .pos = {f.pos}}}"
+
+
+def emit_group(group):
+    """Lines for one group: registers, fields, and their enumerated forms."""
+    g = group.name
+    regs = group.registers
+    reg_by_name = {r.name: r for r in regs}
+
+    # a numbered register family is only collected if its members have the same fields, which are then
+    # defined once under the family name; otherwise its members stay individual registers
+    reg_fams = {}
+    for fam, members in families([r.name for r in regs]).items():
+        keys = [tuple(f.key() for f in reg_by_name[m].fields) for m in members.values()]
+        if all(k == keys[0] for k in keys) and len({reg_by_name[m].size for m in members.values()}) == 1:
+            reg_fams[fam] = members
+    covered = {m for members in reg_fams.values() for m in members.values()}
+    single = [r for r in regs if r.name not in covered]
+
+    def addr(periph, reg):
+        return periph.base + reg.offset
+
+    def reg_addr(t, a):
+        return f"({t}){hexval(a, 32)}"
+
+    out = [BANNER, f" * @section {g} Definitions", " " + "*" * 98 + "/", ""]
+
+    if single and not group.multi:
+        p = group.instances[0][1]
+        out += [f"/** @subsection {g} Register Definitions */", ""]
+        out += aligned([(f"static {reg_type(r)} const {g}_{r.name}", reg_addr(reg_type(r), addr(p, r)), r.desc)
+                        for r in single])
+        out.append("")
+
+    enumerated = []
+    if group.multi:
+        for r in single:
+            t = reg_type(r)
+            entries = {i: addr(p, r) for i, p in group.instances}
+            enumerated += array_block(f"static {t} const {g}_{r.name}[{group.array_size()}]", entries, r.desc,
+                                      lambda a, t=t: reg_addr(t, a))
+    for fam, members in reg_fams.items():
+        first = reg_by_name[members[min(members)]]
+        t = reg_type(first)
+        size = max(members) + 1
+        if group.multi:
+            enumerated.append(f"/** @brief {first.desc} */")
+            enumerated.append(f"static {t} const {g}_{fam}[{group.array_size()}][{size}] = {{")
+            wi = max(len(f"[{i}]") for i, _ in group.instances)
+            for i, p in group.instances:
+                row = ", ".join(f"[{k}] = {reg_addr(t, addr(p, reg_by_name[m]))}" for k, m in sorted(members.items()))
+                enumerated.append(f"  {f'[{i}]':<{wi}} = {{{row}}},")
+            enumerated += ["};", ""]
+        else:
+            p = group.instances[0][1]
+            entries = {k: addr(p, reg_by_name[m]) for k, m in members.items()}
+            enumerated += array_block(f"static {t} const {g}_{fam}[{size}]", entries, first.desc,
+                                      lambda a, t=t: reg_addr(t, a))
+    if enumerated:
+        out += [f"/** @subsection Enumerated {g} Register Definitions */", ""] + enumerated
+
+    plain = []
+    enumerated = []
+    owners = [(r, r.name) for r in single] + [(reg_by_name[m[min(m)]], fam) for fam, m in reg_fams.items()]
+    for r, rname in owners:
+        ft = field_type(r)
+        prefix = f"{g}_{rname}"
+        fields = [f for f in r.fields if not (f.pos == 0 and f.width == r.size)]  # whole register, nothing to mask
+        for f in fields:
+            plain.append((f"static const {ft} {prefix}_{f.name}", field_value(r, f), f.desc))
+        by_name = {f.name: f for f in fields}
+        for fam, members in families(list(by_name)).items():
+            first = by_name[members[min(members)]]
+            entries = {k: by_name[m] for k, m in members.items()}
+            enumerated += array_block(f"static const {ft} {prefix}_{fam}[{max(members) + 1}]", entries,
+                                      first.desc, lambda f, r=r: field_value(r, f))
+
+    if plain:
+        out += [f"/** @subsection {g} Register Field Definitions */", ""]
+        out += aligned(plain)
+        out.append("")
+    if enumerated:
+        out += [f"/** @subsection Enumerated {g} Register Field Definitions */", ""]
+        out += enumerated
+    return out
+
+
+def header_name(base, groups):
+    multi = [g for g in groups if g.multi]
+    return (multi[0].name if multi else groups[0].name).lower() + ".h"
+
+
+def emit_header(base, groups, svd_name):
+    names = ", ".join(p.name for g in groups for _, p in g.instances)
+    fname = header_name(base, groups)
+    out = [LICENSE + f"\n * @file internal/mmio/{fname}",
+           " * @authors UW SARP",
+           f" * @brief Registers and fields of {names}.",
+           f" * @note - Generated from {svd_name} by tools/svd2mmio.py, do not edit.",
+           " */", "",
+           "#pragma once",
+           '#include "internal/mmio_base.h"', "",
+           "#ifdef MMIO_WHOLE_CHIP",
+           '#error "internal/mmio.h already defines these, include either it or the internal/mmio/ headers"',
+           "#endif",
+           "#define MMIO_PERIPHERAL_HEADERS", ""]
+    for g in groups:
+        out += emit_group(g)
+    while out and out[-1] == "":
+        out.pop()
+    return fname, "\n".join(out) + "\n"
+
+
+# ---------------------------------------------------------------------------------------------------
+# comparison with a hand-written header
+# ---------------------------------------------------------------------------------------------------
+
+DEF_RE = re.compile(r"^static\s+(?:const\s+)?\w+\s+(?:const\s+)?(\w+)\s*=\s*(.*?);", re.M)
+ARRAY_RE = re.compile(r"^static\s+(?:const\s+)?\w+\s+(?:const\s+)?(\w+)((?:\[\d+\])+)\s*=\s*\{(.*?)^\};", re.M | re.S)
+
+
+def definitions(text):
+    defs = {}
+    for m in DEF_RE.finditer(text):
+        defs[m.group(1)] = " ".join(m.group(2).split())
+    for m in ARRAY_RE.finditer(text):
+        defs[m.group(1)] = " ".join(re.sub(r"\s+", " ", m.group(3)).split())
+    return defs
+
+
+def normalize(value):
+    return re.sub(r",}", "}", re.sub(r"\s+", "", value)).rstrip(",")
+
+
+def compare(headers, legacy_path):
+    legacy = definitions(open(legacy_path).read())
+    generated = {}
+    for text_ in headers.values():
+        generated.update(definitions(text_))
+    common = sorted(set(legacy) & set(generated))
+    differ = [n for n in common if normalize(legacy[n]) != normalize(generated[n])]
+    only_legacy = sorted(set(legacy) - set(generated))
+    print(f"{len(generated)} generated names, {len(legacy)} in {legacy_path}, {len(common)} in both")
+    print(f"{len(differ)} with different values:")
+    for n in differ:
+        print(f"  {n}\n    {legacy_path}: {legacy[n]}\n    generated: {generated[n]}")
+    print(f"{len(only_legacy)} only in {legacy_path}")
+    return 1 if differ else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--svd", default=os.path.join(REPO, "port.svd"))
+    parser.add_argument("--out", default=os.path.join(REPO, "src", "internal", "mmio"))
+    parser.add_argument("--compare", metavar="MMIO_H", help="compare with a header instead of writing files")
+    args = parser.parse_args()
+
+    peripherals = load_svd(args.svd)
+    headers = {}
+    for base, groups in make_groups(peripherals).items():
+        fname, body = emit_header(base, groups, os.path.basename(args.svd))
+        if fname in headers:
+            sys.exit(f"two peripherals map to {fname}")
+        headers[fname] = body
+
+    if args.compare:
+        sys.exit(compare(headers, args.compare))
+
+    os.makedirs(args.out, exist_ok=True)
+    for old in os.listdir(args.out):
+        if old.endswith(".h") and old not in headers:
+            os.remove(os.path.join(args.out, old))
+    for fname, body in headers.items():
+        with open(os.path.join(args.out, fname), "w") as f:
+            f.write(body)
+    print(f"wrote {len(headers)} headers to {os.path.relpath(args.out)}")
+
+
+if __name__ == "__main__":
+    main()